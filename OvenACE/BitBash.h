@@ -10,6 +10,16 @@ extern "C" {
 uint8_t TC_SPI_ONE(uint8_t tx);
 
 void TX_SDCARD(uint8_t byte);
+uint8_t RX_SDCARD(void);
+void RX_SDCARD_BLOCK(uint8_t *dest, uint32_t len);
+
+void LCD_WRITE_BITMAP(const uint16_t *data, uint32_t len);
+void LCD_FLOOD(uint16_t color, uint32_t len);
+uint8_t LCD_WRITE_RLE(const uint16_t *data, uint32_t len);
+void FLASH_TO_LCD(uint32_t len);
+void FLASH_READ_QUAD(uint8_t *dest, uint32_t len);
+void LCD_READ_RGB565(uint16_t *data, uint32_t len);
+void LCD_READ_24BIT(uint8_t *data, uint32_t len);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,229 @@
+// Install an asset pack from the SD card into external flash
+//
+// The whole pack is checked before anything is erased: the header, the directory, and
+// every bitmap's data (decoded, and its CRC).  So the pack is read twice.
+// The directory CRC is saved with the bitmap address table (see getProvisionedTag), so
+// the pack is only installed once.  The directory is too big to keep in RAM, so each entry
+// is read just before its bitmap.  endBitmapProvisioning() reloads the RAM bitmap directory
+// and the bitmap cache at the end.
+#include <stdint.h>
+#include "AssetPack.h"
+#include "Controleo3SD.h"
+#include "FlashProvision.h"
+#include "ReflowWizard.h"
+#include "printf-stdarg.h"
+#include "string.h"
+
+// Reads a bitmap's pixels from the pack, decoding them if they are run-length encoded
+struct assetReader {
+  File *file;
+  uint8_t format;
+  uint32_t crc;                         // CRC32 of the pack bytes read so far
+  uint32_t bytesLeft;                   // Pack bytes left for this bitmap
+  uint16_t pixelsLeft;                  // Pixels left in the current run-length token
+  bool isRun;
+  uint16_t runColor;
+};
+
+
+// Read a 16-bit word of the bitmap from the pack
+static bool readAssetWord(assetReader *r, uint16_t *word)
+{
+  if (r->bytesLeft < 2 || r->file->read(word, 2) != 2)
+    return false;
+  r->crc = flashCRC32(r->crc, (uint8_t *) word, 2);
+  r->bytesLeft -= 2;
+  return true;
+}
+
+
+// Source of pixels for provisionBitmap()
+static uint16_t assetSource(uint8_t *dest, uint16_t bytes, void *context)
+{
+  assetReader *r = (assetReader *) context;
+  uint16_t bytesDone = 0, pixel;
+
+  if (r->format == ASSET_FORMAT_RAW) {
+    if (bytes > r->bytesLeft)
+      return 0;
+    bytesDone = flashProvisionFileSource(dest, bytes, r->file);
+    r->crc = flashCRC32(r->crc, dest, bytesDone);
+    r->bytesLeft -= bytesDone;
+    return bytesDone;
+  }
+
+  while (bytesDone < bytes) {
+    // Start the next token
+    if (r->pixelsLeft == 0) {
+      if (!readAssetWord(r, &pixel))
+        break;
+      r->pixelsLeft = pixel & 0x7FFF;
+      r->isRun = pixel & 0x8000;
+      if (r->isRun && !readAssetWord(r, &r->runColor))
+        break;
+      continue;
+    }
+    if (r->isRun)
+      pixel = r->runColor;
+    else if (!readAssetWord(r, &pixel))
+      break;
+    memcpy(dest + bytesDone, &pixel, 2);
+    bytesDone += 2;
+    r->pixelsLeft--;
+  }
+  return bytesDone;
+}
+
+
+// Read a directory entry
+static bool readAssetEntry(File *file, assetPackHeader *header, uint16_t index, assetPackEntry *entry)
+{
+  return file->seek(header->headerSize + (uint32_t) index * header->entrySize) &&
+         file->read(entry, sizeof(assetPackEntry)) == sizeof(assetPackEntry);
+}
+
+
+// Seek to a bitmap's data and set up the reader for it
+static bool startAssetReader(File *file, assetPackHeader *header, assetPackEntry *entry, assetReader *reader)
+{
+  memset(reader, 0, sizeof(assetReader));
+  reader->file = file;
+  reader->format = entry->format;
+  reader->bytesLeft = entry->size;
+  return file->seek(header->payloadOffset + entry->offset);
+}
+
+
+// Read a bitmap's data without writing anything.  It must decode to exactly width x height
+// pixels, use all of its bytes, and have the right CRC
+static bool checkAssetData(File *file, assetPackHeader *header, assetPackEntry *entry)
+{
+  assetReader reader;
+  uint32_t bytes = (uint32_t) entry->width * entry->height * 2;
+
+  if (!startAssetReader(file, header, entry, &reader))
+    return false;
+  while (bytes) {
+    uint16_t n = bytes > sizeof(buffer100Bytes)? sizeof(buffer100Bytes) : bytes;
+    if (assetSource((uint8_t *) buffer100Bytes, n, &reader) != n)
+      return false;
+    bytes -= n;
+  }
+  return reader.bytesLeft == 0 && reader.pixelsLeft == 0 && reader.crc == entry->crc;
+}
+
+
+// Check the header, directory and bitmaps.  Returns false if the pack is bad, otherwise
+// sets pages to the number of flash pages the bitmaps need.
+// Installing erases all the bitmaps, so the pack must have every bitmap the firmware uses
+// (0 to BITMAP_LAST_ONE), not just the ones that are changing
+static bool checkAssetPack(File *file, assetPackHeader *header, uint16_t *pages)
+{
+  assetPackEntry entry;
+  uint32_t crc = 0, bitmapPages = 0;
+  int32_t lastId = -1;
+  uint16_t usedBitmaps = 0;
+
+  if (file->read(header, sizeof(assetPackHeader)) != sizeof(assetPackHeader) || header->magic != ASSET_PACK_MAGIC ||
+      header->headerCrc != flashCRC32(0, (uint8_t *) header, sizeof(assetPackHeader) - sizeof(uint32_t))) {
+    printfD("Asset pack: bad header\n");
+    return false;
+  }
+  if (header->formatVersion != ASSET_PACK_FORMAT_VERSION || header->entrySize < sizeof(assetPackEntry) || header->headerSize < sizeof(assetPackHeader)) {
+    printfD("Asset pack: format version %d isn't supported\n", header->formatVersion);
+    return false;
+  }
+
+  // The directory CRC covers whole entries (including any fields added by later versions)
+  if (!file->seek(header->headerSize))
+    return false;
+  for (uint32_t bytes = (uint32_t) header->entries * header->entrySize; bytes; ) {
+    uint16_t n = bytes > sizeof(buffer100Bytes)? sizeof(buffer100Bytes) : bytes;
+    if (file->read(buffer100Bytes, n) != n)
+      return false;
+    crc = flashCRC32(crc, (uint8_t *) buffer100Bytes, n);
+    bytes -= n;
+  }
+  if (crc != header->directoryCrc) {
+    printfD("Asset pack: bad directory CRC\n");
+    return false;
+  }
+
+  for (uint16_t i=0; i < header->entries; i++) {
+    if (!readAssetEntry(file, header, i, &entry) || (int32_t) entry.id <= lastId || entry.id >= PROVISION_MAXIMUM_BITMAPS ||
+        entry.format > ASSET_FORMAT_RLE || entry.width > PROVISION_MAXIMUM_DIMENSION || entry.height > PROVISION_MAXIMUM_DIMENSION ||
+        (entry.format == ASSET_FORMAT_RAW && entry.size != (uint32_t) entry.width * entry.height * 2) ||
+        header->payloadOffset + entry.offset + entry.size > file->size()) {
+      printfD("Asset pack: bad directory entry %d\n", i);
+      return false;
+    }
+    if (!checkAssetData(file, header, &entry)) {
+      printfD("Asset pack: bitmap %d is corrupt\n", entry.id);
+      return false;
+    }
+    lastId = entry.id;
+    if (entry.id <= BITMAP_LAST_ONE)
+      usedBitmaps++;
+    bitmapPages += ((uint32_t) entry.width * entry.height * 2 + 255) >> 8;
+  }
+
+  // The ids are in increasing order, so this means none are missing
+  if (usedBitmaps != BITMAP_LAST_ONE + 1) {
+    printfD("Asset pack: only %d of bitmaps 0 to %d are in the pack\n", usedBitmaps, BITMAP_LAST_ONE);
+    return false;
+  }
+  if (bitmapPages > PROVISION_BITMAP_PAGES) {
+    printfD("Asset pack: the bitmaps need %lu pages, but there are only %d\n", bitmapPages, PROVISION_BITMAP_PAGES);
+    return false;
+  }
+  *pages = bitmapPages;
+  return true;
+}
+
+
+// Install the pack from the SD card into external flash, unless it is already installed
+// (or force is true).  The SD card must have been initialized.  Returns true if the pack
+// is installed when this returns
+bool installAssetPack(const char *filename, bool force)
+{
+  assetPackHeader header;
+  assetPackEntry entry;
+  assetReader reader;
+  bool ok = true;
+
+  File file = SD.open(filename);
+  if (!file) {
+    printfD("Asset pack: can't open %s\n", filename);
+    return false;
+  }
+
+  uint16_t pages;
+  if (!checkAssetPack(&file, &header, &pages)) {
+    file.close();
+    return false;
+  }
+  if (!force && getProvisionedTag() == header.directoryCrc) {
+    printfD("Asset pack version %lu is already installed\n", header.packVersion);
+    file.close();
+    return true;
+  }
+
+  printfD("Installing asset pack version %lu (%d bitmaps, %u pages)\n", header.packVersion, header.entries, pages);
+  startBitmapProvisioning(pages, header.directoryCrc);
+  for (uint16_t i=0; i < header.entries && ok; i++) {
+    if (!readAssetEntry(&file, &header, i, &entry) || !startAssetReader(&file, &header, &entry, &reader)) {
+      ok = false;
+      break;
+    }
+    ok = provisionBitmap(entry.id, entry.width, entry.height, assetSource, &reader);
+    if (ok && reader.crc != entry.crc) {
+      printfD("Asset pack: bitmap %d has a bad CRC\n", entry.id);
+      ok = false;
+    }
+  }
+
+  // A pack that didn't install isn't tagged, so it is tried again next time
+  ok = endBitmapProvisioning(ok) && ok;
+  file.close();
+  return ok;
+}
@@ -0,0 +1,62 @@
+// Asset packs: the bitmaps (and font glyphs) for external flash in one file
+//
+// A pack is built on a PC by tools/build-asset-pack.py and copied to the SD card as
+// ASSETS.PAK.  At boot the pack is installed into external flash if it isn't the pack
+// that is already there.  Installing replaces all the bitmaps in external flash, so a pack
+// must have every bitmap from 0 to BITMAP_LAST_ONE.  All numbers are little-endian.
+//
+//   Header (32 bytes)
+//   Directory (one 20-byte entry per bitmap, in increasing id order)
+//   Payload (starts on a 256-byte boundary; each bitmap starts on a 256-byte boundary)
+//
+// Bitmaps can be stored raw (RGB565 pixels) or run-length encoded in the same way as the
+// bitmaps in Bitmaps.cpp (without the size word).  Either way they are written to flash
+// as raw pixels, because that is what the renderer streams to the LCD.
+#ifndef __ASSETPACK_H__
+#define __ASSETPACK_H__
+
+#include <stdint.h>
+
+#define ASSET_PACK_FILENAME             "ASSETS.PAK"
+#define ASSET_PACK_MAGIC                0x4B504141    // "AAPK"
+#define ASSET_PACK_FORMAT_VERSION       1
+#define ASSET_PACK_ALIGNMENT            256
+
+// Bitmap formats
+#define ASSET_FORMAT_RAW                0
+#define ASSET_FORMAT_RLE                1
+
+struct assetPackHeader {
+  uint32_t magic;                       // ASSET_PACK_MAGIC
+  uint16_t formatVersion;               // ASSET_PACK_FORMAT_VERSION
+  uint16_t headerSize;                  // sizeof(assetPackHeader)
+  uint32_t packVersion;                 // Version of the artwork, chosen by whoever built the pack
+  uint16_t entries;                     // Number of directory entries
+  uint16_t entrySize;                   // sizeof(assetPackEntry)
+  uint32_t directoryCrc;                // CRC32 of the directory
+  uint32_t payloadOffset;               // Offset of the payload from the start of the file
+  uint32_t payloadSize;
+  uint32_t headerCrc;                   // CRC32 of the header before this field
+};
+
+struct assetPackEntry {
+  uint16_t id;                          // Bitmap number (see ReflowWizard.h)
+  uint16_t width;
+  uint16_t height;
+  uint8_t  format;                      // ASSET_FORMAT_RAW or ASSET_FORMAT_RLE
+  uint8_t  reserved;
+  uint32_t offset;                      // Offset of the data from the start of the payload
+  uint32_t size;                        // Bytes of data in the pack
+  uint32_t crc;                         // CRC32 of the data in the pack
+};
+
+#ifdef __cplusplus
+
+// Install the pack from the SD card into external flash, unless it is already installed
+// (or force is true).  The SD card must have been initialized.  Returns true if the pack
+// is installed when this returns
+bool installAssetPack(const char *filename, bool force);
+
+#endif // __cplusplus
+
+#endif
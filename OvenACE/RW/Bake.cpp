@@ -7,6 +7,8 @@
 #include "Utility.h"
 #include "Help.h"
 #include "Render.h"
+#include "TextField.h"
+#include "Compositor.h"
 #include "Screens.h"
 #include "Touch.h"
 #include "Outputs.h"
@@ -21,6 +23,9 @@
 #include "stdio.h"
 #include "printf-stdarg.h"
 
+// The countdown clock
+static TextField bakeTimer(240, 110, FONT_22PT_BLACK_ON_WHITE_FIXED, TEXT_ALIGN_CENTER);
+
 // Stay in this function until the bake is done or canceled
 void bake() {
   uint32_t secondsLeftOfBake, lastLoopTime = millis();
@@ -64,9 +69,12 @@ void bake() {
   // Ug, hate goto's!  But this saves a lot of extraneous code.
 userChangedMindAboutAborting:
 
+  // The countdown clock has been erased
+  bakeTimer.invalidate();
+
   // Setup the tap targets on this screen
   clearTouchTargets();
-  drawButton(110, 230, 260, 87, BUTTON_LARGE_FONT, (char *) "STOP");
+  drawButton(110, 230, 260, BUTTON_LARGE_FONT, (char *) "STOP");
   defineTouchArea(20, 150, 440, 170); // Large tap target to stop baking
 
   // Toggle the baking temperature between C/F if the user taps in the top-right corner
@@ -263,7 +271,7 @@ userChangedMindAboutAborting:
 
         // Change the STOP button to DONE
         tft.fillRect(150, 242, 180, 36, WHITE);
-        drawButton(110, 230, 260, 93, BUTTON_LARGE_FONT, (char *) "DONE");
+        drawButton(110, 230, 260, BUTTON_LARGE_FONT, (char *) "DONE");
         
         // Cooling should be at least 60 seconds in duration
         coolingDuration = 60;
@@ -376,14 +384,16 @@ void displayBakePhase(uint8_t phase, bool abortDialogIsOnScreen)
 // Draw the abort dialog on the screen.  The user needs to confirm that they want to exit bake
 void drawBakingAbortDialog()
 {
+  // Build the dialog in RAM so it appears all at once
+  startComposition(0, 90, 480, 230, WHITE);
   drawThickRectangle(0, 90, 480, 230, 15, RED);
-  tft.fillRect(15, 105, 450, 200, WHITE);
-  displayString(140, 110, FONT_12PT_BLACK_ON_WHITE, (char *) "Stop Baking");
-  displayString(62, 150, FONT_9PT_BLACK_ON_WHITE, (char *) "Are you sure you want to stop");
-  displayString(62, 180, FONT_9PT_BLACK_ON_WHITE, (char *) "baking?");
+  composeText(140, 110, FONT_12PT_BLACK_ON_WHITE, "Stop Baking");
+  composeText(62, 150, FONT_9PT_BLACK_ON_WHITE, "Are you sure you want to stop");
+  composeText(62, 180, FONT_9PT_BLACK_ON_WHITE, "baking?");
   clearTouchTargets();
-  drawTouchButton(60, 230, 160, 72, BUTTON_LARGE_FONT, (char *) "Stop");
-  drawTouchButton(260, 230, 160, 105, BUTTON_LARGE_FONT, (char *) "Cancel");
+  drawTouchButton(60, 230, 160, BUTTON_LARGE_FONT, (char *) "Stop");
+  drawTouchButton(260, 230, 160, BUTTON_LARGE_FONT, (char *) "Cancel");
+  endComposition();
 }
 
 
@@ -404,21 +414,10 @@ void displayBakeTemperatureAndDuration(bool displayCelsius)
 
 
 // Display the countdown timer
+// The timer is kept centered, and only the digits that change are redrawn
 void displayBakeSecondsLeft(uint32_t seconds)
 {
-  static uint16_t oldWidth = 1, timerX = 130;
-
-  // Update the clock display
-  uint16_t newWidth = displayString(timerX, 110, FONT_22PT_BLACK_ON_WHITE_FIXED, secondsInClockFormat(buffer100Bytes, seconds));
-  // Keep the timer display centered
-  if (newWidth != oldWidth) {
-    // The width has changed (one less character on the display).  Erase what was there
-    tft.fillRect(timerX, 110, newWidth > oldWidth? newWidth : oldWidth, 48, WHITE);
-    // Redraw the timer
-    oldWidth = newWidth;
-    timerX = 240 - (newWidth >> 1);
-    displayString(timerX, 110, FONT_22PT_BLACK_ON_WHITE_FIXED, buffer100Bytes);
-  }
+  bakeTimer.display(secondsInClockFormat(buffer100Bytes, seconds));
 }
 
 
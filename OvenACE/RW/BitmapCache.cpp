@@ -0,0 +1,266 @@
+// SRAM cache for bitmaps that are only stored in external flash
+//
+// Cached bitmaps are packed end-to-end in a fixed block of RAM, in the same order
+// as the entries in the cache table.  When space is needed the least recently used
+// bitmap that isn't pinned is evicted, and the bitmaps after it are moved down to
+// close the gap.  Evictions are rare (once the digits are cached they stay there) so
+// the simplicity is worth more than avoiding the memmove.
+//
+// The cache is only used by the UI task.  The statistics are printed from the USB task,
+// so they are copied with the scheduler suspended.
+#include <stdint.h>
+#include "BitmapCache.h"
+#include "Bitmaps.h"
+#include "Render.h"
+#include "ReflowWizard.h"
+#include "printf-stdarg.h"
+#include "rtos_support.h"
+#include "string.h"
+
+struct bitmapCacheEntry {
+  uint16_t bitmapNumber;
+  uint16_t bitmapWidth;
+  uint16_t bitmapHeight;
+  uint16_t offset;                    // Offset (in pixels) into bitmapCacheData
+  uint32_t lastUsed;                  // Value of bitmapCacheClock when last rendered
+  bool     pinned;                    // Pinned bitmaps are never evicted
+};
+
+static uint16_t *bitmapCacheData = 0;
+static uint16_t bitmapCacheBytes = 0;  // Size of bitmapCacheData (0 until initBitmapCache)
+static uint32_t bitmapCacheHeapLowWater = 0;
+static bitmapCacheEntry bitmapCache[BITMAP_CACHE_ENTRIES];
+static uint8_t bitmapCacheCount = 0;
+static uint16_t bitmapCachePixelsUsed = 0;
+static uint32_t bitmapCacheClock = 0;
+
+// Statistics
+static uint32_t bitmapCacheHits = 0;
+static uint32_t bitmapCacheMisses = 0;
+static uint32_t bitmapCacheEvictions = 0;
+static uint32_t bitmapCacheBypassed = 0;
+
+
+// Allocate the cache from the heap.  Call once all the tasks have been created.  Until
+// then no bitmaps are cached
+void initBitmapCache()
+{
+  uint32_t bytes = BITMAP_CACHE_BYTES;
+
+  if (bitmapCacheData)
+    return;
+
+  // Leave the reserve free below the heap's low-water mark
+  bitmapCacheHeapLowWater = xPortGetMinimumEverFreeHeapSize();
+  if (bitmapCacheHeapLowWater < BITMAP_CACHE_HEAP_RESERVE + bytes)
+    bytes = bitmapCacheHeapLowWater > BITMAP_CACHE_HEAP_RESERVE? (bitmapCacheHeapLowWater - BITMAP_CACHE_HEAP_RESERVE) & ~3 : 0;
+  if (bytes)
+    bitmapCacheData = (uint16_t *) pvPortMalloc(bytes);
+  bitmapCacheBytes = bitmapCacheData? bytes : 0;
+  if (bitmapCacheBytes < BITMAP_CACHE_BYTES)
+    printfD("initBitmapCache: only %u of %u bytes (heap low-water mark %lu)\n", (unsigned int) bitmapCacheBytes,
+            (unsigned int) BITMAP_CACHE_BYTES, bitmapCacheHeapLowWater);
+}
+
+
+// Find a bitmap in the cache.  Returns the index, or -1 if it isn't cached
+static int16_t findBitmapInCache(uint16_t bitmapNumber)
+{
+  for (uint8_t i=0; i < bitmapCacheCount; i++)
+    if (bitmapCache[i].bitmapNumber == bitmapNumber)
+      return i;
+  return -1;
+}
+
+
+// Remove a bitmap from the cache, and move the ones after it down to fill the hole
+static void evictBitmapFromCache(uint8_t index)
+{
+  uint16_t pixels = bitmapCache[index].bitmapWidth * bitmapCache[index].bitmapHeight;
+  uint16_t offset = bitmapCache[index].offset;
+
+  memmove(&bitmapCacheData[offset], &bitmapCacheData[offset + pixels], (bitmapCachePixelsUsed - offset - pixels) << 1);
+  bitmapCachePixelsUsed -= pixels;
+
+  for (uint8_t i=index; i < bitmapCacheCount - 1; i++) {
+    bitmapCache[i] = bitmapCache[i + 1];
+    bitmapCache[i].offset -= pixels;
+  }
+  bitmapCacheCount--;
+  bitmapCacheEvictions++;
+}
+
+
+// Evict the least recently used bitmap that isn't pinned.  Returns false if everything is pinned
+static bool evictLeastRecentlyUsedBitmap()
+{
+  int16_t lru = -1;
+
+  for (uint8_t i=0; i < bitmapCacheCount; i++) {
+    if (bitmapCache[i].pinned)
+      continue;
+    if (lru == -1 || bitmapCache[i].lastUsed < bitmapCache[lru].lastUsed)
+      lru = i;
+  }
+  if (lru == -1)
+    return false;
+  evictBitmapFromCache(lru);
+  return true;
+}
+
+
+// Read a bitmap from external flash into the cache.  Returns the index, or -1 if there is no space
+static int16_t loadBitmapIntoCache(uint16_t bitmapNumber, uint16_t largestBitmap)
+{
+  uint16_t bitmapWidth, bitmapHeight, page;
+  uint32_t pixels;
+
+  page = flash.getBitmapInfo(bitmapNumber, &bitmapWidth, &bitmapHeight);
+  if (page > 0xFFF)
+    return -1;
+  pixels = bitmapWidth * bitmapHeight;
+  if ((pixels << 1) > largestBitmap || (pixels << 1) > bitmapCacheBytes)
+    return -1;
+
+  // Make room for the bitmap
+  while (bitmapCacheCount == BITMAP_CACHE_ENTRIES || bitmapCachePixelsUsed + pixels > (bitmapCacheBytes >> 1)) {
+    if (!evictLeastRecentlyUsedBitmap())
+      return -1;
+  }
+
+  // Bitmaps are always added to the end
+  bitmapCacheEntry *entry = &bitmapCache[bitmapCacheCount];
+  entry->bitmapNumber = bitmapNumber;
+  entry->bitmapWidth = bitmapWidth;
+  entry->bitmapHeight = bitmapHeight;
+  entry->offset = bitmapCachePixelsUsed;
+  entry->lastUsed = bitmapCacheClock;
+  entry->pinned = false;
+
+  flash.startRead(page, pixels << 1, (uint8_t *) &bitmapCacheData[bitmapCachePixelsUsed]);
+  flash.endRead();
+
+  bitmapCachePixelsUsed += pixels;
+  return bitmapCacheCount++;
+}
+
+
+// Get a bitmap from the cache, loading it from external flash if necessary
+// Returns 0 if the bitmap can't be cached (it must then be rendered from external flash)
+uint16_t *getCachedBitmap(uint16_t bitmapNumber, uint16_t *bitmapWidth, uint16_t *bitmapHeight)
+{
+  int16_t index = findBitmapInCache(bitmapNumber);
+
+  if (index >= 0)
+    bitmapCacheHits++;
+  else {
+    index = loadBitmapIntoCache(bitmapNumber, BITMAP_CACHE_LARGEST_BITMAP);
+    if (index < 0) {
+      bitmapCacheBypassed++;
+      return 0;
+    }
+    bitmapCacheMisses++;
+  }
+
+  bitmapCache[index].lastUsed = ++bitmapCacheClock;
+  *bitmapWidth = bitmapCache[index].bitmapWidth;
+  *bitmapHeight = bitmapCache[index].bitmapHeight;
+  return &bitmapCacheData[bitmapCache[index].offset];
+}
+
+
+// Load a bitmap into the cache and keep it there.  Returns false if there isn't space
+bool pinBitmapInCache(uint16_t bitmapNumber)
+{
+  int16_t index = findBitmapInCache(bitmapNumber);
+
+  if (index < 0)
+    index = loadBitmapIntoCache(bitmapNumber, BITMAP_CACHE_BYTES);
+  if (index < 0) {
+    printfD("pinBitmapInCache: no space for bitmap %d\n", bitmapNumber);
+    return false;
+  }
+  bitmapCache[index].pinned = true;
+  return true;
+}
+
+
+// Pin the digits, 'F', 'C' and '~' of a fixed-width font (the ones not in microcontroller flash)
+void pinFixedWidthFontInCache(uint8_t font)
+{
+  const char *glyphs = "0123456789FC~";
+  uint16_t bitmapNumber;
+
+  for (; *glyphs; glyphs++) {
+    if (!isSupportedCharacter(font, *glyphs))
+      continue;
+    uint8_t glyphFont = font;
+    bitmapNumber = getBitmapNumberForCharacter(&glyphFont, *glyphs);
+    if (!flashBitmaps[bitmapNumber])
+      pinBitmapInCache(bitmapNumber);
+  }
+}
+
+
+// Allow all pinned bitmaps to be evicted again
+void unpinBitmapsInCache()
+{
+  for (uint8_t i=0; i < bitmapCacheCount; i++)
+    bitmapCache[i].pinned = false;
+}
+
+
+// Empty the cache (needed if the bitmaps in external flash change)
+void flushBitmapCache()
+{
+  bitmapCacheCount = 0;
+  bitmapCachePixelsUsed = 0;
+}
+
+
+// Empty the cache and load the pinned bitmaps again, after the bitmaps in external flash change.
+// The pinned glyphs stay pinned, but are read from the new bitmaps
+void reloadBitmapCache()
+{
+  uint16_t pinned[BITMAP_CACHE_ENTRIES];
+  uint8_t pinnedCount = 0;
+
+  for (uint8_t i=0; i < bitmapCacheCount; i++)
+    if (bitmapCache[i].pinned)
+      pinned[pinnedCount++] = bitmapCache[i].bitmapNumber;
+
+  flushBitmapCache();
+  for (uint8_t i=0; i < pinnedCount; i++)
+    pinBitmapInCache(pinned[i]);
+}
+
+
+// Print the cache statistics on the debug console
+void PrintBitmapCacheStats()
+{
+  uint8_t count, pinned = 0;
+  uint32_t used, hits, misses, evictions, bypassed;
+
+  // Take a copy, so the UI task can't change the cache part way through
+  vTaskSuspendAll();
+  count = bitmapCacheCount;
+  for (uint8_t i=0; i < count; i++)
+    if (bitmapCache[i].pinned)
+      pinned++;
+  used = (uint32_t) bitmapCachePixelsUsed << 1;
+  hits = bitmapCacheHits;
+  misses = bitmapCacheMisses;
+  evictions = bitmapCacheEvictions;
+  bypassed = bitmapCacheBypassed;
+  xTaskResumeAll();
+
+  printfD("  Budget    = %u bytes (%u allocated)\n", (unsigned int) BITMAP_CACHE_BYTES, (unsigned int) bitmapCacheBytes);
+  printfD("  Heap      = %u bytes free at allocation, %u now (low-water mark)\n", (unsigned int) bitmapCacheHeapLowWater,
+          (unsigned int) xPortGetMinimumEverFreeHeapSize());
+  printfD("  Used      = %u bytes\n", (unsigned int) used);
+  printfD("  Bitmaps   = %u (%u pinned)\n", (unsigned int) count, (unsigned int) pinned);
+  printfD("  Hits      = %u\n", (unsigned int) hits);
+  printfD("  Misses    = %u\n", (unsigned int) misses);
+  printfD("  Evictions = %u\n", (unsigned int) evictions);
+  printfD("  Bypassed  = %u\n", (unsigned int) bypassed);
+}
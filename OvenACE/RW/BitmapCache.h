@@ -0,0 +1,72 @@
+// SRAM cache for bitmaps that are only stored in external flash
+//
+// Fixed-width digits (and a few other glyphs) are redrawn every second while the
+// temperature and timers are displayed.  Keeping the ones that aren't in
+// microcontroller flash in RAM avoids reading them from external flash each time.
+#ifndef __BITMAPCACHE_H__
+#define __BITMAPCACHE_H__
+
+#include <stdint.h>
+
+// Most RAM used to hold cached bitmaps (bytes).  The microcontroller only has 32K of RAM.
+// The cache comes out of the FreeRTOS heap (the RAM that .data, .bss and the IRQ stack
+// leave), which also holds the task stacks.  initBitmapCache() is called once every task
+// has been created, and takes BITMAP_CACHE_BYTES or, if the heap's low-water mark so far
+// (xPortGetMinimumEverFreeHeapSize) is lower, what is left of it after
+// BITMAP_CACHE_HEAP_RESERVE.  The 'B' and 'M' debug commands show the size it got and the
+// heap's low-water mark; if the cache is smaller than this, the .bss has grown.
+#ifndef BITMAP_CACHE_BYTES
+#define BITMAP_CACHE_BYTES              6144
+#endif
+
+// Heap left free for allocations after initBitmapCache() (semaphores, for example)
+#ifndef BITMAP_CACHE_HEAP_RESERVE
+#define BITMAP_CACHE_HEAP_RESERVE       1024
+#endif
+
+// Maximum number of bitmaps that can be in the cache at the same time
+#ifndef BITMAP_CACHE_ENTRIES
+#define BITMAP_CACHE_ENTRIES            24
+#endif
+
+// Bitmaps larger than this (bytes) are never cached on first use.  They can still be pinned.
+#ifndef BITMAP_CACHE_LARGEST_BITMAP
+#define BITMAP_CACHE_LARGEST_BITMAP     1024
+#endif
+
+#ifdef __cplusplus
+
+// Allocate the cache from the heap.  Call once all the tasks have been created.  Until
+// then no bitmaps are cached
+void initBitmapCache(void);
+
+// Get a bitmap from the cache, loading it from external flash if necessary
+// Returns 0 if the bitmap can't be cached (it must then be rendered from external flash)
+uint16_t *getCachedBitmap(uint16_t bitmapNumber, uint16_t *bitmapWidth, uint16_t *bitmapHeight);
+
+// Load a bitmap into the cache and keep it there.  Returns false if there isn't space
+bool pinBitmapInCache(uint16_t bitmapNumber);
+
+// Pin the digits, 'F', 'C' and '~' of a fixed-width font (the ones not in microcontroller flash)
+void pinFixedWidthFontInCache(uint8_t font);
+
+// Allow all pinned bitmaps to be evicted again
+void unpinBitmapsInCache(void);
+
+// Empty the cache (needed if the bitmaps in external flash change)
+void flushBitmapCache(void);
+
+// Empty the cache and load the pinned bitmaps again, after the bitmaps in external flash change
+void reloadBitmapCache(void);
+
+extern "C" {
+#endif // __cplusplus
+
+// Print the cache statistics on the debug console
+void PrintBitmapCacheStats(void);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif
@@ -10,7 +10,12 @@
 // as more microcontroller flash spaced is used by new features the bitmaps can be removed
 // to create the necessary space.
 //
-// Bitmaps are in RGB565 format.
+// Bitmaps are in RGB565 format, run-length encoded so more of them fit in microcontroller
+// flash.  The first word is the width and height of the bitmap.  It is followed by tokens:
+//   0x8000 + n   - a run of n pixels of the same color.  The next word is the color
+//   n            - the next n words are n pixels (n is less than 0x8000)
+// Bitmaps are drawn with Controleo3LCD::drawBitmapRLE().  Runs where the high and low
+// bytes of the color are the same (like white and black) only need the write bit toggled.
 //
 // If you want to remove bitmaps from microcontroller flash, just zero the entry from
 // flashBitmaps array at the bottom of this file.  This will free up space in the
@@ -19,5746 +24,3433 @@
 //
 // If you want to add a bitmap, create the bitmap array (e.g. bmp259) and add it to
 // flashBitmaps array at the bottom of this file.  Then add a define just before 
-// "#define BITMAP_LAST_ONE" in ReflowWizard.h file.
+// "#define BITMAP_LAST_ONE" in ReflowWizard.h file.  The bitmap can be added as raw
+// RGB565 pixels; run tools/compress-bitmaps.py to encode it (and regenerate this file).
 #include <stdint.h>
 #include "Bitmaps.h"
 #include "ArduinoDefs.h"
 
-const uint16_t bmp7[169]   = // Bitmap 7
+const uint16_t bmp7[162]   = // Bitmap 7 (RLE, 169 words raw)
 {
     0x0718, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x3c9b,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xdc87,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x01d2,0xdfff,0xffff,
-    0xffff,0xffff,0xb320,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xb320,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x01d2,0xdfff,0xffff,
-    0xffff,0xffff,0xffff,0xdc87,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xffff,0xfff6,0x6000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x3c9b
-};
-
-const uint16_t bmp8[169]   = // Bitmap 8
+    0x8004,0xffff,0x0003,0xfed2,0x3800,0x3c9b,0x8003,0xffff,0x0004,0xfffb,0x91c0,0x000c,0xb7ff,0x8003,0xffff,0x0003,
+    0xdc87,0x0000,0x65bf,0x8003,0xffff,0x0004,0xfed2,0x3800,0x01d2,0xdfff,0x8003,0xffff,0x0003,0xb320,0x0000,0x65bf,
+    0x8003,0xffff,0x0004,0xfff6,0x6000,0x000c,0xb7ff,0x8003,0xffff,0x0003,0xdc87,0x0000,0x0336,0x8003,0xffff,0x0004,
+    0xfffb,0x91c0,0x0000,0x3c9b,0x8003,0xffff,0x0004,0xfff6,0x6000,0x0000,0x65bf,0x8003,0xffff,0x0004,0xfed2,0x3800,
+    0x0007,0x96df,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,
+    0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,
+    0x0004,0xfed2,0x3800,0x0007,0x96df,0x8003,0xffff,0x0004,0xfff6,0x6000,0x0000,0x65bf,0x8003,0xffff,0x0004,0xfffb,
+    0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8003,0xffff,0x0004,0xfff6,0x6000,0x000c,
+    0xb7ff,0x8004,0xffff,0x0003,0xb320,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfed2,0x3800,0x01d2,0xdfff,0x8004,0xffff,
+    0x0003,0xdc87,0x0000,0x65bf,0x8004,0xffff,0x0004,0xfff6,0x6000,0x01d2,0xdfff,0x8004,0xffff,0x0003,0xfed2,0x3800,
+    0x3c9b
+};
+
+const uint16_t bmp8[155]   = // Bitmap 8 (RLE, 169 words raw)
 {
     0x0718, // Width and height
-    0xfed2,0x3800,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x000c,0xb7ff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x3c9b,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x65bf,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x3c9b,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x3c9b,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x65bf,
-    0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x3c9b,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x000c,0xb7ff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x3c9b,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp13[9]   = // Bitmap 13
+    0x0003,0xfed2,0x3800,0x3c9b,0x8005,0xffff,0x0003,0xdc87,0x0000,0x65bf,0x8004,0xffff,0x0004,0xfff6,0x6000,0x01d2,
+    0xdfff,0x8004,0xffff,0x0003,0xdc87,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfff6,0x6000,0x000c,0xb7ff,0x8004,0xffff,
+    0x0003,0xb320,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfdac,0x0000,0x01d2,0xdfff,0x8003,0xffff,0x0004,0xfed2,0x3800,
+    0x0007,0x96df,0x8003,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x65bf,0x8004,0xffff,0x0003,0xb320,0x0000,0x3c9b,0x8004,
+    0xffff,0x0003,0xb320,0x0000,0x0336,0x8004,0xffff,0x0003,0xdc87,0x0000,0x0336,0x8004,0xffff,0x0003,0xdc87,0x0000,
+    0x0336,0x8004,0xffff,0x0003,0xb320,0x0000,0x0336,0x8004,0xffff,0x0003,0xb320,0x0000,0x3c9b,0x8003,0xffff,0x0004,
+    0xfffb,0x91c0,0x0000,0x65bf,0x8003,0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,0x8003,0xffff,0x0004,0xfdac,0x0000,
+    0x01d2,0xdfff,0x8003,0xffff,0x0003,0xb320,0x0000,0x3c9b,0x8003,0xffff,0x0004,0xfff6,0x6000,0x000c,0xb7ff,0x8003,
+    0xffff,0x0003,0xdc87,0x0000,0x3c9b,0x8003,0xffff,0x0004,0xfff6,0x6000,0x000c,0xb7ff,0x8003,0xffff,0x0003,0xdc87,
+    0x0000,0x65bf,0x8003,0xffff,0x0003,0xfed2,0x3800,0x3c9b,0x8004,0xffff
+};
+
+const uint16_t bmp13[10]   = // Bitmap 13 (RLE, 9 words raw)
 {
     0x0402, // Width and height
-    0xb320,0x0000,0x000c,0xb7ff,
-    0xb320,0x0000,0x000c,0xb7ff
+    0x0008,0xb320,0x0000,0x000c,0xb7ff,0xb320,0x0000,0x000c,0xb7ff
 };
 
-const uint16_t bmp15[267]   = // Bitmap 15
+const uint16_t bmp15[216]   = // Bitmap 15 (RLE, 267 words raw)
 {
     0x0e13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,
-    0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,
-    0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp16[153]   = // Bitmap 16
+    0x8004,0xffff,0x0001,0xfdac,0x8004,0x0000,0x0001,0x0336,0x8007,0xffff,0x0001,0xb320,0x8006,0x0000,0x0002,0x000c,
+    0xb7ff,0x8004,0xffff,0x0011,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,
+    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0x8004,0xffff,0x000a,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xfdac,0x0000,
+    0x000c,0xb7ff,0x8005,0xffff,0x0009,0xb320,0x0000,0x0336,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,0x8005,0xffff,
+    0x0008,0xdc87,0x0000,0x000c,0xb7ff,0xfffb,0x91c0,0x0000,0x0336,0x8006,0xffff,0x0008,0xfdac,0x0000,0x0007,0x96df,
+    0xfffb,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0008,0xfed2,0x3800,0x0007,0x96df,0xfff6,0x6000,0x0000,0x3c9b,0x8006,
+    0xffff,0x0008,0xfed2,0x3800,0x0007,0x96df,0xfff6,0x6000,0x0000,0x3c9b,0x8006,0xffff,0x0008,0xfed2,0x3800,0x0000,
+    0x65bf,0xfff6,0x6000,0x0000,0x3c9b,0x8006,0xffff,0x0008,0xfed2,0x3800,0x0007,0x96df,0xfffb,0x91c0,0x0000,0x3c9b,
+    0x8006,0xffff,0x0008,0xfed2,0x3800,0x0007,0x96df,0xfffb,0x91c0,0x0000,0x0336,0x8006,0xffff,0x0009,0xfdac,0x0000,
+    0x000c,0xb7ff,0xffff,0xb320,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0009,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xfdac,
+    0x0000,0x000c,0xb7ff,0x8005,0xffff,0x0009,0xb320,0x0000,0x0336,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0x8004,
+    0xffff,0x0004,0xfed2,0x3800,0x0000,0x65bf,0x8003,0xffff,0x000b,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfed2,
+    0x3800,0x0000,0x01d2,0xdfff,0x8004,0xffff,0x0001,0xb320,0x8006,0x0000,0x0002,0x000c,0xb7ff,0x8006,0xffff,0x0001,
+    0xfdac,0x8004,0x0000,0x0001,0x0336,0x8004,0xffff
+};
+
+const uint16_t bmp16[126]   = // Bitmap 16 (RLE, 153 words raw)
 {
     0x0813, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0336,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0336,
-    0xffff,0xb320,0x0000,0x0000,0x000c,0x6320,0x0000,0x0336,
-    0xfed2,0x3800,0x0000,0x0336,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x380c,0xb7ff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336
-};
-
-const uint16_t bmp17[267]   = // Bitmap 17
+    0x8005,0xffff,0x0003,0xfff6,0x6000,0x0336,0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x0336,0x8003,0xffff,0x0009,
+    0xfffb,0x91c0,0x0000,0x0000,0x0336,0xffff,0xffff,0xfff6,0x6000,0x8003,0x0000,0x0019,0x0336,0xffff,0xb320,0x0000,
+    0x0000,0x000c,0x6320,0x0000,0x0336,0xfed2,0x3800,0x0000,0x0336,0xffff,0xb320,0x0000,0x0336,0xfed2,0x380c,0xb7ff,
+    0xffff,0xffff,0xb320,0x0000,0x0336,0x8005,0xffff,0x0003,0xb320,0x0000,0x0336,0x8005,0xffff,0x0003,0xb320,0x0000,
+    0x0336,0x8005,0xffff,0x0003,0xb320,0x0000,0x0336,0x8005,0xffff,0x0003,0xb320,0x0000,0x0336,0x8005,0xffff,0x0003,
+    0xb320,0x0000,0x0336,0x8005,0xffff,0x0003,0xb320,0x0000,0x0336,0x8005,0xffff,0x0003,0xb320,0x0000,0x0336,0x8005,
+    0xffff,0x0003,0xb320,0x0000,0x0336,0x8005,0xffff,0x0003,0xb320,0x0000,0x0336,0x8005,0xffff,0x0003,0xb320,0x0000,
+    0x0336,0x8005,0xffff,0x0003,0xb320,0x0000,0x0336,0x8005,0xffff,0x0003,0xb320,0x0000,0x0336
+};
+
+const uint16_t bmp17[170]   = // Bitmap 17 (RLE, 267 words raw)
 {
     0x0e13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,
-    0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,
-    0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df
-};
-
-const uint16_t bmp18[248]   = // Bitmap 18
+    0x8004,0xffff,0x0001,0xdc87,0x8004,0x0000,0x0002,0x000c,0xb7ff,0x8005,0xffff,0x0002,0xfff6,0x6000,0x8007,0x0000,
+    0x0001,0x3c9b,0x8003,0xffff,0x0012,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,
+    0x65bf,0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0x8004,0xffff,0x000a,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,
+    0xdc87,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0008,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xb320,0x0000,0x0336,0x8006,
+    0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800a,0xffff,0x0004,0xdc87,0x0000,0x000c,0xb7ff,0x8009,0xffff,0x0004,
+    0xfff6,0x6000,0x0000,0x0336,0x800a,0xffff,0x0004,0xb320,0x0000,0x0007,0x96df,0x8009,0xffff,0x0004,0xb320,0x0000,
+    0x0000,0x3c9b,0x8009,0xffff,0x0004,0xb320,0x0000,0x0000,0x3c9b,0x8008,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x0000,
+    0x3c9b,0x8008,0xffff,0x0005,0xfff6,0x6000,0x0000,0x0000,0x3c9b,0x8008,0xffff,0x0005,0xfed2,0x3800,0x0000,0x0000,
+    0x65bf,0x8008,0xffff,0x0005,0xfff6,0x6000,0x0000,0x0007,0x96df,0x8008,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x0007,
+    0x96df,0x8009,0xffff,0x0004,0xdc87,0x0000,0x0000,0x65bf,0x8009,0xffff,0x0002,0xfff6,0x6000,0x800a,0x0000,0x0004,
+    0x0007,0x96df,0xfed2,0x3800,0x800a,0x0000,0x0002,0x0007,0x96df
+};
+
+const uint16_t bmp18[179]   = // Bitmap 18 (RLE, 248 words raw)
 {
     0x0d13, // Width and height
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0336,0xffff,0xffff,
-    0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x3c9b,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,
-    0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,
-    0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,
-    0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp19[267]   = // Bitmap 19
+    0x8003,0xffff,0x0001,0xb320,0x8004,0x0000,0x0001,0x65bf,0x8005,0xffff,0x0002,0xfed2,0x3800,0x8006,0x0000,0x0015,
+    0x01d2,0xdfff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0336,0xffff,
+    0xffff,0xfdac,0x0000,0x0007,0x96df,0x8004,0xffff,0x0008,0xfdac,0x0000,0x0007,0x96df,0xffff,0xb320,0x0000,0x0336,
+    0x8005,0xffff,0x0004,0xfff6,0x6000,0x0000,0x65bf,0x8009,0xffff,0x0004,0xfff6,0x6000,0x0000,0x65bf,0x8009,0xffff,
+    0x0004,0xfdac,0x0000,0x0007,0x96df,0x8008,0xffff,0x0004,0xb320,0x0000,0x0000,0x3c9b,0x8006,0xffff,0x0002,0xfed2,
+    0x3800,0x8003,0x0000,0x0001,0x3c9b,0x8007,0xffff,0x0001,0xfdac,0x8005,0x0000,0x0001,0x3c9b,0x8009,0xffff,0x0005,
+    0xfffb,0x91c0,0x0000,0x0000,0x3c9b,0x800a,0xffff,0x0004,0xb320,0x0000,0x000c,0xb7ff,0x8009,0xffff,0x0007,0xfed2,
+    0x3800,0x0000,0x65bf,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0008,0xfed2,0x3800,0x0000,0x65bf,0xb320,0x0000,0x01d2,
+    0xdfff,0x8005,0xffff,0x0008,0xfdac,0x0000,0x0007,0x96df,0xfdac,0x0000,0x0000,0x65bf,0x8004,0xffff,0x0015,0xfffb,
+    0x91c0,0x0000,0x01d2,0xdfff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x65bf,
+    0xffff,0xffff,0xfff6,0x6000,0x8007,0x0000,0x0001,0x65bf,0x8005,0xffff,0x0001,0xdc87,0x8004,0x0000,0x0001,0x0336,
+    0x8004,0xffff
+};
+
+const uint16_t bmp19[183]   = // Bitmap 19 (RLE, 267 words raw)
 {
     0x0e13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x632c,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0336,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,
-    0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff
-};
-
-const uint16_t bmp20[248]   = // Bitmap 20
+    0x8008,0xffff,0x0004,0xfed2,0x3800,0x000c,0xb7ff,0x8009,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0x8009,
+    0xffff,0x0005,0xdc87,0x0000,0x0000,0x000c,0xb7ff,0x8008,0xffff,0x0006,0xfed2,0x3800,0x0000,0x0000,0x000c,0xb7ff,
+    0x8007,0xffff,0x0007,0xfffb,0x91c0,0x0000,0x632c,0x0000,0x000c,0xb7ff,0x8007,0xffff,0x0007,0xdc87,0x0000,0x0336,
+    0xfdac,0x0000,0x000c,0xb7ff,0x8006,0xffff,0x0008,0xfed2,0x3800,0x000c,0xb7ff,0xfdac,0x0000,0x000c,0xb7ff,0x8005,
+    0xffff,0x0009,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0x8005,0xffff,0x0009,0xdc87,0x0000,
+    0x0336,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x000a,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,
+    0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x65bf,0x8003,0xffff,0x0004,0xfdac,0x0000,
+    0x000c,0xb7ff,0x8003,0xffff,0x0003,0xdc87,0x0000,0x0336,0x8004,0xffff,0x000a,0xfdac,0x0000,0x000c,0xb7ff,0xffff,
+    0xffff,0xfed2,0x3800,0x000c,0xb7ff,0x8004,0xffff,0x0007,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xdc87,0x800c,
+    0x0000,0x0002,0x65bf,0xdc87,0x800c,0x0000,0x0001,0x65bf,0x8008,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800a,
+    0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800a,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800a,0xffff,0x0006,
+    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff
+};
+
+const uint16_t bmp20[171]   = // Bitmap 20 (RLE, 248 words raw)
 {
     0x0d13, // Width and height
-    0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,
-    0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xfdac,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xb320,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfffb,0x91c0,0x0000,0x65bf,0xb320,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xfed2,0x3800,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,
-    0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,
-    0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,
-    0xb320,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,
-    0xfed2,0x3800,0x0000,0x0007,0x96df,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp21[267]   = // Bitmap 21
+    0x0003,0xffff,0xfffb,0x91c0,0x8008,0x0000,0x0005,0x3c9b,0xffff,0xffff,0xfff6,0x6000,0x8008,0x0000,0x0007,0x3c9b,
+    0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0x8009,0xffff,0x0004,0xfdac,0x0000,0x01d2,0xdfff,0x8009,0xffff,0x0003,
+    0xdc87,0x0000,0x0336,0x800a,0xffff,0x0003,0xb320,0x0000,0x3c9b,0x8009,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x65bf,
+    0xb320,0x8003,0x0000,0x0002,0x000c,0xb7ff,0x8003,0xffff,0x0002,0xfff6,0x6000,0x8008,0x0000,0x0014,0x3c9b,0xffff,
+    0xffff,0xfed2,0x3800,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,0xfdac,0x0000,
+    0x0007,0x96df,0x8004,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0x8009,0xffff,0x0004,0xfdac,0x0000,0x0000,
+    0x65bf,0x8009,0xffff,0x0004,0xfff6,0x6000,0x0000,0x65bf,0x8009,0xffff,0x0004,0xfff6,0x6000,0x0000,0x3c9b,0x8009,
+    0xffff,0x0007,0xfed2,0x3800,0x0000,0x65bf,0x91c0,0x0000,0x0336,0x8006,0xffff,0x0008,0xfdac,0x0000,0x0007,0x96df,
+    0xb320,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0014,0xfff6,0x6000,0x0000,0x0336,0xffff,0xfed2,0x3800,0x0000,0x0007,
+    0x96df,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xfdac,0x8007,0x0000,0x0002,0x0007,0x96df,
+    0x8005,0xffff,0x0001,0xb320,0x8004,0x0000,0x0001,0x0336,0x8004,0xffff
+};
+
+const uint16_t bmp21[217]   = // Bitmap 21 (RLE, 267 words raw)
 {
     0x0e13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xb320,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x65b6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,
-    0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,
-    0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0007,0x96df,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp22[248]   = // Bitmap 22
+    0x8004,0xffff,0x0002,0xfffb,0x91c0,0x8003,0x0000,0x0002,0x0007,0x96df,0x8006,0xffff,0x0001,0xdc87,0x8007,0x0000,
+    0x0001,0x3c9b,0x8004,0xffff,0x0012,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,
+    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0x8003,0xffff,0x000a,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,
+    0xfdac,0x0000,0x0007,0x96df,0x8005,0xffff,0x0009,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
+    0x800a,0xffff,0x0003,0xb320,0x0000,0x3c9b,0x800a,0xffff,0x0006,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xdc87,0x8003,
+    0x0000,0x0002,0x0007,0x96df,0x8003,0xffff,0x0005,0xfff6,0x6000,0x0000,0x65b6,0x6000,0x8006,0x0000,0x0005,0x3c9b,
+    0xffff,0xffff,0xfff6,0x6000,0x8003,0x0000,0x000e,0x65bf,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,
+    0xfff6,0x6000,0x0000,0x0000,0x65bf,0x8005,0xffff,0x0009,0xb320,0x0000,0x01d2,0xdfff,0xfff6,0x6000,0x0000,0x01d2,
+    0xdfff,0x8005,0xffff,0x0008,0xfed2,0x3800,0x0007,0x96df,0xfffb,0x91c0,0x0000,0x0336,0x8006,0xffff,0x0008,0xfff6,
+    0x6000,0x0007,0x96df,0xffff,0xb320,0x0000,0x0336,0x8006,0xffff,0x0009,0xfed2,0x3800,0x0007,0x96df,0xffff,0xdc87,
+    0x0000,0x000c,0xb7ff,0x8005,0xffff,0x0009,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0x8004,
+    0xffff,0x0004,0xfffb,0x91c0,0x0000,0x0336,0x8003,0xffff,0x000b,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfffb,
+    0x91c0,0x0000,0x0007,0x96df,0x8004,0xffff,0x0001,0xb320,0x8007,0x0000,0x0001,0x65bf,0x8006,0xffff,0x0002,0xfff6,
+    0x6000,0x8003,0x0000,0x0002,0x01d2,0xdfff,0x8003,0xffff
+};
+
+const uint16_t bmp22[133]   = // Bitmap 22 (RLE, 248 words raw)
 {
     0x0d13, // Width and height
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp23[267]   = // Bitmap 23
+    0x0001,0x91c0,0x800b,0x0000,0x0002,0x65bf,0x91c0,0x800b,0x0000,0x0001,0x65bf,0x8008,0xffff,0x0004,0xfff6,0x6000,
+    0x0000,0x3c9b,0x8008,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0004,0xdc87,0x0000,0x0007,
+    0x96df,0x8008,0xffff,0x0004,0xfff6,0x6000,0x0000,0x3c9b,0x8009,0xffff,0x0004,0xdc87,0x0000,0x000c,0xb7ff,0x8008,
+    0xffff,0x0004,0xfff6,0x6000,0x0000,0x3c9b,0x8009,0xffff,0x0004,0xdc87,0x0000,0x000c,0xb7ff,0x8008,0xffff,0x0004,
+    0xfffb,0x91c0,0x0000,0x0336,0x8009,0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,0x8009,0xffff,0x0004,0xdc87,0x0000,
+    0x01d2,0xdfff,0x8008,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0004,0xfed2,0x3800,0x0000,0x65bf,
+    0x8009,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8009,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8009,0xffff,
+    0x0003,0xb320,0x0000,0x0336,0x8009,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0004,0xfff6,0x6000,
+    0x0000,0x65bf,0x8007,0xffff
+};
+
+const uint16_t bmp23[223]   = // Bitmap 23 (RLE, 267 words raw)
 {
     0x0e13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,
-    0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,
-    0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,
-    0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x3c9b,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp24[267]   = // Bitmap 24
+    0x8004,0xffff,0x0001,0xfdac,0x8004,0x0000,0x0001,0x0336,0x8006,0xffff,0x0002,0xfffb,0x91c0,0x8006,0x0000,0x0002,
+    0x0007,0x96df,0x8004,0xffff,0x0011,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,
+    0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0x8004,0xffff,0x000a,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xfed2,
+    0x3800,0x0007,0x96df,0x8004,0xffff,0x000a,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
+    0x8004,0xffff,0x000a,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0x8004,0xffff,0x0004,
+    0xfed2,0x3800,0x0000,0x65bf,0x8003,0xffff,0x000b,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfff6,0x6000,0x0000,
+    0x01d2,0xdfff,0x8004,0xffff,0x0001,0xfdac,0x8006,0x0000,0x0001,0x0336,0x8005,0xffff,0x0002,0xfffb,0x91c0,0x8006,
+    0x0000,0x0002,0x0007,0x96df,0x8003,0xffff,0x0012,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xfffb,0x91c0,
+    0x0000,0x0000,0x65bf,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0x8005,0xffff,0x0008,0xb320,0x0000,0x01d2,0xdfff,
+    0xfffb,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0008,0xfed2,0x3800,0x0007,0x96df,0xfff6,0x6000,0x0000,0x3c9b,0x8006,
+    0xffff,0x0008,0xfff6,0x6000,0x0000,0x65bf,0xfffb,0x91c0,0x0000,0x0336,0x8006,0xffff,0x0009,0xfed2,0x3800,0x0007,
+    0x96df,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0x8005,0xffff,0x000a,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xfff6,0x6000,
+    0x0000,0x0007,0x96df,0x8003,0xffff,0x0004,0xb320,0x0000,0x0000,0x3c9b,0x8003,0xffff,0x0002,0xfed2,0x3800,0x8007,
+    0x0000,0x0001,0x3c9b,0x8006,0xffff,0x0001,0xdc87,0x8004,0x0000,0x0002,0x000c,0xb7ff,0x8003,0xffff
+};
+
+const uint16_t bmp24[217]   = // Bitmap 24 (RLE, 267 words raw)
 {
     0x0e13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xdc87,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x65bf,
-    0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,
-    0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x65bf,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96d6,0x6000,0x0000,0x65bf,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xfff6,0x6000,0x0007,0x96df,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp32[362]   = // Bitmap 32
+    0x8004,0xffff,0x0001,0xdc87,0x8004,0x0000,0x0001,0x65bf,0x8006,0xffff,0x0002,0xfed2,0x3800,0x8006,0x0000,0x0002,
+    0x000c,0xb7ff,0x8003,0xffff,0x0012,0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,
+    0xdfff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x65bf,0x8004,0xffff,0x0009,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xfffb,
+    0x91c0,0x0000,0x0336,0x8006,0xffff,0x0008,0xdc87,0x0000,0x01d2,0xdfff,0xfff6,0x6000,0x0000,0x3c9b,0x8006,0xffff,
+    0x0008,0xfdac,0x0000,0x000c,0xb7ff,0xfff6,0x6000,0x0000,0x3c9b,0x8006,0xffff,0x0008,0xfdac,0x0000,0x0007,0x96df,
+    0xfffb,0x91c0,0x0000,0x0336,0x8006,0xffff,0x0009,0xdc87,0x0000,0x0000,0x65bf,0xffff,0xdc87,0x0000,0x0007,0x96df,
+    0x8004,0xffff,0x000f,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,
+    0xfff6,0x6000,0x8003,0x0000,0x0005,0x65bf,0xffff,0xffff,0xfed2,0x3800,0x8005,0x0000,0x0005,0x0007,0x96d6,0x6000,
+    0x0000,0x65bf,0x8003,0xffff,0x0002,0xfffb,0x91c0,0x8003,0x0000,0x0006,0x01d2,0xdfff,0xfff6,0x6000,0x0007,0x96df,
+    0x800a,0xffff,0x0004,0xfed2,0x3800,0x000c,0xb7ff,0x800a,0xffff,0x0008,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xdc87,
+    0x0000,0x0336,0x8005,0xffff,0x000a,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0x8004,
+    0xffff,0x0011,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xdc87,
+    0x0000,0x0000,0x0336,0x8004,0xffff,0x0002,0xfed2,0x3800,0x8006,0x0000,0x0001,0x0336,0x8006,0xffff,0x0002,0xfffb,
+    0x91c0,0x8003,0x0000,0x0002,0x0007,0x96df,0x8004,0xffff
+};
+
+const uint16_t bmp32[224]   = // Bitmap 32 (RLE, 362 words raw)
 {
     0x1313, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x000c,0x6320,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xddac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,
-    0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff
-};
-
-const uint16_t bmp33[286]   = // Bitmap 33
+    0x8007,0xffff,0x0005,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0x800e,0xffff,0x0005,0xb320,0x0000,0x0000,0x0007,0x96df,
+    0x800d,0xffff,0x0006,0xfff6,0x6000,0x000c,0x6320,0x0000,0x3c9b,0x800d,0xffff,0x0007,0xdc87,0x0000,0x01d2,0xddac,
+    0x0000,0x000c,0xb7ff,0x800b,0xffff,0x0008,0xfffb,0x91c0,0x0000,0x3c9b,0xfff6,0x6000,0x0000,0x65bf,0x800b,0xffff,
+    0x0009,0xfed2,0x3800,0x0007,0x96df,0xffff,0xb320,0x0000,0x01d2,0xdfff,0x800a,0xffff,0x0009,0xb320,0x0000,0x01d2,
+    0xdfff,0xffff,0xfdac,0x0000,0x0007,0x96df,0x8009,0xffff,0x000a,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xfff6,
+    0x6000,0x0000,0x0336,0x8009,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xdc87,0x0000,0x000c,
+    0xb7ff,0x8008,0xffff,0x0003,0xb320,0x0000,0x0336,0x8004,0xffff,0x0004,0xfed2,0x3800,0x0000,0x65bf,0x8007,0xffff,
+    0x0004,0xfed2,0x3800,0x0000,0x65bf,0x8004,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0x8006,0xffff,0x0001,
+    0xdc87,0x800a,0x0000,0x0002,0x0007,0x96df,0x8005,0xffff,0x0002,0xfffb,0x91c0,0x800b,0x0000,0x0001,0x0336,0x8005,
+    0xffff,0x0004,0xfdac,0x0000,0x0000,0x65bf,0x8007,0xffff,0x0004,0xb320,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0004,
+    0xb320,0x0000,0x01d2,0xdfff,0x8007,0xffff,0x0004,0xfdac,0x0000,0x0000,0x3c9b,0x8003,0xffff,0x0004,0xfff6,0x6000,
+    0x0000,0x3c9b,0x8008,0xffff,0x000b,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,
+    0x8009,0xffff,0x0009,0xdc87,0x0000,0x0007,0x96df,0xffff,0xfffb,0x91c0,0x0000,0x0336,0x800a,0xffff,0x0009,0xfff6,
+    0x6000,0x0000,0x0336,0xffff,0xfed2,0x3800,0x0000,0x65bf,0x800b,0xffff,0x0004,0xb320,0x0000,0x000c,0xb7ff
+};
+
+const uint16_t bmp33[192]   = // Bitmap 33 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0336,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp34[324]   = // Bitmap 34
+    0x0001,0x91c0,0x8009,0x0000,0x0001,0x65bf,0x8004,0xffff,0x0001,0x91c0,0x800a,0x0000,0x0007,0x01d2,0xdfff,0xffff,
+    0xffff,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0009,0xfdac,0x0000,0x0000,0x0336,0xffff,0xffff,0x91c0,0x0000,0x3c9b,
+    0x8007,0xffff,0x0008,0xfdac,0x0000,0x0007,0x96df,0xffff,0x91c0,0x0000,0x3c9b,0x8007,0xffff,0x0008,0xfff6,0x6000,
+    0x0000,0x65bf,0xffff,0x91c0,0x0000,0x3c9b,0x8007,0xffff,0x0008,0xfff6,0x6000,0x0000,0x65bf,0xffff,0x91c0,0x0000,
+    0x3c9b,0x8007,0xffff,0x0008,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0007,0xfdac,
+    0x0000,0x0000,0x3c9b,0xffff,0xffff,0x91c0,0x800a,0x0000,0x0001,0x3c9b,0x8003,0xffff,0x0001,0x91c0,0x800a,0x0000,
+    0x0007,0x01d2,0xdfff,0xffff,0xffff,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0009,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,
+    0xffff,0x91c0,0x0000,0x3c9b,0x8007,0xffff,0x0008,0xfffb,0x91c0,0x0000,0x0336,0xffff,0x91c0,0x0000,0x3c9b,0x8008,
+    0xffff,0x0007,0xdc87,0x0000,0x01d2,0xdfff,0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0007,0xfdac,0x0000,0x000c,0xb7ff,
+    0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0007,0xdc87,0x0000,0x000c,0xb7ff,0x91c0,0x0000,0x3c9b,0x8007,0xffff,0x0008,
+    0xfffb,0x91c0,0x0000,0x0336,0xffff,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0007,0xfffb,0x91c0,0x0000,0x0007,0x96df,
+    0xffff,0x91c0,0x800b,0x0000,0x0004,0x65bf,0xffff,0xffff,0x91c0,0x8009,0x0000,0x0001,0x0336,0x8004,0xffff
+};
+
+const uint16_t bmp34[195]   = // Bitmap 34 (RLE, 324 words raw)
 {
     0x1113, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xffff,0xfdac,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0336,0xffff,
-    0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0336,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x65bf,0xffff,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,
-    0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,
-    0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0336,0xffff,
-    0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp35[305]   = // Bitmap 35
+    0x8005,0xffff,0x0002,0xfff6,0x6000,0x8004,0x0000,0x0002,0x000c,0xb7ff,0x8007,0xffff,0x0002,0xfff6,0x6000,0x8008,
+    0x0000,0x0002,0x01d2,0xdfff,0x8004,0xffff,0x0005,0xfdac,0x0000,0x0000,0x0007,0x96df,0x8004,0xffff,0x000b,0xdc87,
+    0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0x8007,0xffff,0x000a,0xfed2,0x3800,0x0000,
+    0x0336,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0008,0xdc87,0x0000,0x0007,0x96df,0xfff6,0x6000,
+    0x0000,0x65bf,0x8009,0xffff,0x0008,0xfff6,0x6000,0x0336,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0x800d,0xffff,0x0004,
+    0xdc87,0x0000,0x01d2,0xdfff,0x800d,0xffff,0x0003,0xb320,0x0000,0x0336,0x800e,0xffff,0x0003,0xb320,0x0000,0x0336,
+    0x800e,0xffff,0x0003,0xb320,0x0000,0x0336,0x800e,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x800d,0xffff,0x0004,
+    0xfdac,0x0000,0x000c,0xb7ff,0x800a,0xffff,0x0007,0xdc87,0x65bf,0xffff,0xfff6,0x6000,0x0000,0x65bf,0x8009,0xffff,
+    0x0009,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xb320,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0009,0xfdac,0x0000,0x0000,
+    0x65bf,0xffff,0xfff6,0x6000,0x0000,0x0336,0x8007,0xffff,0x0004,0xfed2,0x3800,0x0000,0x0336,0x8003,0xffff,0x0001,
+    0xfdac,0x8003,0x0000,0x0001,0x65bf,0x8004,0xffff,0x0005,0xb320,0x0000,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0002,
+    0xfed2,0x3800,0x8008,0x0000,0x0002,0x000c,0xb7ff,0x8007,0xffff,0x0001,0xfdac,0x8005,0x0000,0x0002,0x0007,0x96df,
+    0x8004,0xffff
+};
+
+const uint16_t bmp35[193]   = // Bitmap 35 (RLE, 305 words raw)
 {
     0x1013, // Width and height
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x65bf,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x65bf,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp36[286]   = // Bitmap 36
+    0x0001,0x91c0,0x8009,0x0000,0x0001,0x0336,0x8005,0xffff,0x0001,0x91c0,0x800b,0x0000,0x0001,0x65bf,0x8003,0xffff,
+    0x0003,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x000a,0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,0xffff,0x91c0,0x0000,
+    0x3c9b,0x8008,0xffff,0x0008,0xb320,0x0000,0x000c,0xb7ff,0xffff,0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0008,0xfff6,
+    0x6000,0x0000,0x3c9b,0xffff,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0007,0xdc87,0x0000,0x000c,0xb7ff,0x91c0,0x0000,
+    0x3c9b,0x8009,0xffff,0x0007,0xfed2,0x3800,0x0007,0x96df,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0007,0xfff6,0x6000,
+    0x0000,0x65bf,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0007,0xfffb,0x91c0,0x0000,0x65bf,0x91c0,0x0000,0x3c9b,0x8009,
+    0xffff,0x0007,0xfffb,0x91c0,0x0000,0x3c9b,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0007,0xfffb,0x91c0,0x0000,0x65bf,
+    0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0007,0xfff6,0x6000,0x0000,0x65bf,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0007,
+    0xfed2,0x3800,0x0007,0x96df,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0007,0xdc87,0x0000,0x01d2,0xdfff,0x91c0,0x0000,
+    0x3c9b,0x8008,0xffff,0x0008,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0008,0xb320,
+    0x0000,0x000c,0xb7ff,0xffff,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0008,0xfed2,0x3800,0x0000,0x0000,0x65bf,0xffff,
+    0xffff,0x91c0,0x800b,0x0000,0x0001,0x65bf,0x8003,0xffff,0x0001,0x91c0,0x8009,0x0000,0x0001,0x65bf,0x8005,0xffff
+};
+
+const uint16_t bmp36[118]   = // Bitmap 36 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff
-};
-
-const uint16_t bmp37[267]   = // Bitmap 37
+    0x0001,0x91c0,0x800c,0x0000,0x0003,0x3c9b,0xffff,0x91c0,0x800c,0x0000,0x0005,0x3c9b,0xffff,0x91c0,0x0000,0x3c9b,
+    0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,0x0003,0x91c0,
+    0x0000,0x3c9b,0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,
+    0x0001,0x91c0,0x800b,0x0000,0x0004,0x01d2,0xdfff,0xffff,0x91c0,0x800b,0x0000,0x0006,0x01d2,0xdfff,0xffff,0x91c0,
+    0x0000,0x3c9b,0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,
+    0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,
+    0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,0x0001,0x91c0,0x800c,0x0000,0x0003,0x000c,0xb7ff,0x91c0,
+    0x800c,0x0000,0x0002,0x000c,0xb7ff
+};
+
+const uint16_t bmp37[117]   = // Bitmap 37 (RLE, 267 words raw)
 {
     0x0e13, // Width and height
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp38[343]   = // Bitmap 38
+    0x0001,0x91c0,0x800b,0x0000,0x0003,0x01d2,0xdfff,0x91c0,0x800b,0x0000,0x0005,0x01d2,0xdfff,0x91c0,0x0000,0x3c9b,
+    0x800b,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800b,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800b,0xffff,0x0003,0x91c0,
+    0x0000,0x3c9b,0x800b,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800b,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800b,0xffff,
+    0x0001,0x91c0,0x800a,0x0000,0x0004,0x65bf,0xffff,0xffff,0x91c0,0x800a,0x0000,0x0006,0x65bf,0xffff,0xffff,0x91c0,
+    0x0000,0x3c9b,0x800b,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800b,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800b,0xffff,
+    0x0003,0x91c0,0x0000,0x3c9b,0x800b,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800b,0xffff,0x0003,0x91c0,0x0000,0x3c9b,
+    0x800b,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800b,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800b,0xffff,0x0003,0x91c0,
+    0x0000,0x3c9b,0x800b,0xffff
+};
+
+const uint16_t bmp38[206]   = // Bitmap 38 (RLE, 343 words raw)
 {
     0x1213, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,
-    0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x3c9b,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xdc87,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,
-    0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0336,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp39[286]   = // Bitmap 39
+    0x8006,0xffff,0x0001,0xb320,0x8005,0x0000,0x0002,0x000c,0xb7ff,0x8007,0xffff,0x0002,0xfffb,0x91c0,0x8009,0x0000,
+    0x0002,0x000c,0xb7ff,0x8004,0xffff,0x0005,0xfff6,0x6000,0x0000,0x0000,0x0336,0x8005,0xffff,0x000c,0xb320,0x0000,
+    0x0000,0x000c,0xb7ff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0x8007,0xffff,0x000a,0xfff6,0x6000,0x0000,
+    0x0336,0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,0x8009,0xffff,0x0008,0xfdac,0x0000,0x0007,0x96df,0xfffb,0x91c0,
+    0x0000,0x3c9b,0x800a,0xffff,0x0008,0xfffb,0x91c0,0x3c9b,0xffff,0xfed2,0x3800,0x0007,0x96df,0x800e,0xffff,0x0004,
+    0xdc87,0x0000,0x01d2,0xdfff,0x800e,0xffff,0x0003,0xdc87,0x0000,0x0336,0x800f,0xffff,0x0003,0xb320,0x0000,0x0336,
+    0x8006,0xffff,0x0001,0xfdac,0x8007,0x0000,0x0004,0x0336,0xb320,0x0000,0x0336,0x8006,0xffff,0x0001,0xfdac,0x8007,
+    0x0000,0x0005,0x0336,0xdc87,0x0000,0x01d2,0xdfff,0x800b,0xffff,0x0007,0xb320,0x0000,0x0336,0xfdac,0x0000,0x0007,
+    0x96df,0x800b,0xffff,0x0007,0xb320,0x0000,0x0336,0xfff6,0x6000,0x0000,0x3c9b,0x800b,0xffff,0x0008,0xb320,0x0000,
+    0x0336,0xffff,0xdc87,0x0000,0x0007,0x96df,0x800a,0xffff,0x0009,0xb320,0x0000,0x0336,0xffff,0xfffb,0x91c0,0x0000,
+    0x000c,0xb7ff,0x8008,0xffff,0x000c,0xdc87,0x0000,0x0000,0x0336,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x01d2,
+    0xdfff,0x8004,0xffff,0x0001,0xdc87,0x8003,0x0000,0x0002,0x000c,0xb7ff,0x8004,0xffff,0x0001,0xb320,0x800a,0x0000,
+    0x0001,0x3c9b,0x8008,0xffff,0x0001,0xdc87,0x8005,0x0000,0x0002,0x0007,0x96df,0x8004,0xffff
+};
+
+const uint16_t bmp39[165]   = // Bitmap 39 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336
-};
-
-const uint16_t bmp40[58]   = // Bitmap 40
+    0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,
+    0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,
+    0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,
+    0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,
+    0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0004,0xb320,0x0000,0x0336,0x91c0,0x800d,0x0000,0x0002,0x0336,0x91c0,0x800d,
+    0x0000,0x0004,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,
+    0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,
+    0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,
+    0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,
+    0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,
+    0x0003,0xb320,0x0000,0x0336
+};
+
+const uint16_t bmp40[59]   = // Bitmap 40 (RLE, 58 words raw)
 {
     0x0313, // Width and height
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336
-};
-
-const uint16_t bmp41[229]   = // Bitmap 41
+    0x0039,0xb320,0x0000,0x0336,0xb320,0x0000,0x0336,0xb320,0x0000,0x0336,0xb320,0x0000,0x0336,0xb320,0x0000,0x0336,
+    0xb320,0x0000,0x0336,0xb320,0x0000,0x0336,0xb320,0x0000,0x0336,0xb320,0x0000,0x0336,0xb320,0x0000,0x0336,0xb320,
+    0x0000,0x0336,0xb320,0x0000,0x0336,0xb320,0x0000,0x0336,0xb320,0x0000,0x0336,0xb320,0x0000,0x0336,0xb320,0x0000,
+    0x0336,0xb320,0x0000,0x0336,0xb320,0x0000,0x0336,0xb320,0x0000,0x0336
+};
+
+const uint16_t bmp41[155]   = // Bitmap 41 (RLE, 229 words raw)
 {
     0x0c13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,
-    0xffff,0xb320,0x0000,0x0000,0x65bf,0xffff,0xffff,0xdc87,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp42[305]   = // Bitmap 42
+    0x8008,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8008,0xffff,
+    0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0004,0xdc87,
+    0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0004,0xdc87,0x0000,0x01d2,
+    0xdfff,0x8008,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8008,
+    0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0004,
+    0xdc87,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0008,0xdc87,0x0000,0x01d2,0xdfff,0xfed2,0x3800,0x0007,0x96df,0x8004,
+    0xffff,0x0008,0xdc87,0x0000,0x01d2,0xdfff,0xfed2,0x3800,0x0000,0x65bf,0x8004,0xffff,0x0008,0xdc87,0x0000,0x01d2,
+    0xdfff,0xfff6,0x6000,0x0000,0x3c9b,0x8004,0xffff,0x0013,0xb320,0x0000,0x0336,0xffff,0xffff,0xb320,0x0000,0x0000,
+    0x65bf,0xffff,0xffff,0xdc87,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x8006,0x0000,0x0001,0x0336,0x8005,
+    0xffff,0x0001,0xb320,0x8003,0x0000,0x0002,0x0007,0x96df,0x8003,0xffff
+};
+
+const uint16_t bmp42[244]   = // Bitmap 42 (RLE, 305 words raw)
 {
     0x1013, // Width and height
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x3c9b,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xfed2,0x3800,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c92,0x6000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x000c,0x6320,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x000c,0xb7ff,0xfff6,0x6000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0336,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0007,0x96df
-};
-
-const uint16_t bmp43[229]   = // Bitmap 43
+    0x0003,0x91c0,0x0000,0x3c9b,0x8007,0xffff,0x0001,0xfdac,0x8003,0x0000,0x0005,0x3c9b,0xffff,0x91c0,0x0000,0x3c9b,
+    0x8006,0xffff,0x0001,0xfdac,0x8003,0x0000,0x0006,0x3c9b,0xffff,0xffff,0x91c0,0x0000,0x3c9b,0x8005,0xffff,0x0001,
+    0xfdac,0x8003,0x0000,0x0001,0x3c9b,0x8003,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0001,0xfdac,0x8003,
+    0x0000,0x0001,0x65bf,0x8004,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8003,0xffff,0x0005,0xfed2,0x3800,0x0000,0x0000,
+    0x65bf,0x8005,0xffff,0x000a,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x65bf,0x8006,0xffff,
+    0x0009,0x91c0,0x0000,0x3c9b,0xffff,0xfed2,0x3800,0x0000,0x0007,0x96df,0x8007,0xffff,0x0008,0x91c0,0x0000,0x3c9b,
+    0xfff6,0x6000,0x0000,0x0007,0x96df,0x8008,0xffff,0x0004,0x91c0,0x0000,0x3c92,0x6000,0x8003,0x0000,0x0001,0x3c9b,
+    0x8008,0xffff,0x0001,0x91c0,0x8003,0x0000,0x0005,0x000c,0x6320,0x0000,0x0000,0x65bf,0x8007,0xffff,0x000a,0x91c0,
+    0x0000,0x0000,0x000c,0xb7ff,0xfff6,0x6000,0x0000,0x000c,0xb7ff,0x8006,0xffff,0x000b,0x91c0,0x0000,0x000c,0xb7ff,
+    0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0004,
+    0xdc87,0x0000,0x0000,0x0336,0x8005,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0005,0xfffb,0x91c0,0x0000,
+    0x0000,0x65bf,0x8004,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8005,0xffff,0x0005,0xfff6,0x6000,0x0000,0x0007,0x96df,
+    0x8003,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x000a,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,
+    0x91c0,0x0000,0x3c9b,0x8007,0xffff,0x0009,0xb320,0x0000,0x0000,0x0336,0xffff,0xffff,0x91c0,0x0000,0x3c9b,0x8007,
+    0xffff,0x0009,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0005,0xfed2,0x3800,
+    0x0000,0x0007,0x96df
+};
+
+const uint16_t bmp43[114]   = // Bitmap 43 (RLE, 229 words raw)
 {
     0x0c13, // Width and height
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336
-};
-
-const uint16_t bmp44[362]   = // Bitmap 44
+    0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0003,0x91c0,0x0000,0x3c9b,
+    0x8009,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0003,0x91c0,
+    0x0000,0x3c9b,0x8009,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,
+    0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0003,0x91c0,0x0000,0x3c9b,
+    0x8009,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0003,0x91c0,
+    0x0000,0x3c9b,0x8009,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,
+    0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0001,0x91c0,0x800a,0x0000,0x0002,0x0336,0x91c0,0x800a,0x0000,0x0001,
+    0x0336
+};
+
+const uint16_t bmp44[333]   = // Bitmap 44 (RLE, 362 words raw)
 {
     0x1313, // Width and height
-    0xfff6,0x6000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x39c7,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0007,0x39c0,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x6492,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x01d2,0x9320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x3c9b,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0007,0x96df,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x01d2,0xdfff,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x3c9b,0xffff,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xfffb,0x91c0,0x0007,0x96df,0xffff,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,0xfed2,0x3800,0x01d2,0xdfff,0xffff,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,0xdc87,0x0000,0x3c9b,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xdc87,0x0000,0x0336,0xffff,0xfffb,0x91c0,0x0007,0x96df,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xfed2,0x3800,0x01d2,0xdfff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xdc87,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0332,0x91c0,0x0007,0x96df,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336
-};
-
-const uint16_t bmp45[286]   = // Bitmap 45
+    0x0006,0xfff6,0x6000,0x0000,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x000b,0xfffb,0x91c0,0x0000,0x0000,0x0336,0xfff6,
+    0x6000,0x0000,0x0000,0x0007,0x96df,0x8008,0xffff,0x0007,0xfed2,0x3800,0x0000,0x0000,0x0336,0xfff6,0x6000,0x8003,
+    0x0000,0x0001,0x3c9b,0x8008,0xffff,0x0001,0xdc87,0x8003,0x0000,0x0008,0x0336,0xfff6,0x6000,0x0000,0x39c7,0x0000,
+    0x01d2,0xdfff,0x8006,0xffff,0x000d,0xfffb,0x91c0,0x0007,0x39c0,0x0000,0x0336,0xfff6,0x6000,0x0000,0x6492,0x3800,
+    0x0007,0x96df,0x8006,0xffff,0x000d,0xfed2,0x3800,0x01d2,0x9320,0x0000,0x0336,0xfff6,0x6000,0x0000,0x65bb,0x91c0,
+    0x0000,0x3c9b,0x8006,0xffff,0x000e,0xdc87,0x0000,0x3c9b,0xb320,0x0000,0x0336,0xfff6,0x6000,0x0000,0x65bf,0xdc87,
+    0x0000,0x01d2,0xdfff,0x8004,0xffff,0x000f,0xfffb,0x91c0,0x0007,0x96df,0xb320,0x0000,0x0336,0xfff6,0x6000,0x0000,
+    0x65bf,0xfed2,0x3800,0x0007,0x96df,0x8004,0xffff,0x000f,0xfed2,0x3800,0x01d2,0xdfff,0xb320,0x0000,0x0336,0xfff6,
+    0x6000,0x0000,0x65bf,0xfffb,0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0073,0xdc87,0x0000,0x3c9b,0xffff,0xb320,0x0000,
+    0x0336,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xfffb,0x91c0,0x0007,0x96df,
+    0xffff,0xb320,0x0000,0x0336,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,0xfed2,
+    0x3800,0x01d2,0xdfff,0xffff,0xb320,0x0000,0x0336,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xfffb,0x91c0,0x0000,0x65bf,
+    0xffff,0xffff,0xdc87,0x0000,0x3c9b,0xffff,0xffff,0xb320,0x0000,0x0336,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,
+    0xdc87,0x0000,0x0336,0xffff,0xfffb,0x91c0,0x0007,0x96df,0xffff,0xffff,0xb320,0x0000,0x0336,0xfff6,0x6000,0x0000,
+    0x65bf,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xfed2,0x3800,0x01d2,0xdfff,0xffff,0xffff,0xb320,0x0000,0x0336,
+    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xdc87,0x0000,0x3c9b,0x8003,0xffff,0x0007,
+    0xb320,0x0000,0x0336,0xfff6,0x6000,0x0000,0x65bf,0x8003,0xffff,0x0006,0xdc87,0x0000,0x0332,0x91c0,0x0007,0x96df,
+    0x8003,0xffff,0x0007,0xb320,0x0000,0x0336,0xfff6,0x6000,0x0000,0x65bf,0x8003,0xffff,0x0006,0xfed2,0x3800,0x0000,
+    0x0000,0x01d2,0xdfff,0x8003,0xffff,0x0007,0xb320,0x0000,0x0336,0xfff6,0x6000,0x0000,0x65bf,0x8003,0xffff,0x0005,
+    0xfffb,0x91c0,0x0000,0x0000,0x65bf,0x8004,0xffff,0x0007,0xb320,0x0000,0x0336,0xfff6,0x6000,0x0000,0x65bf,0x8004,
+    0xffff,0x0004,0xdc87,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0003,0xb320,0x0000,0x0336
+};
+
+const uint16_t bmp45[240]   = // Bitmap 45 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3b2c,0x3800,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xb320,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xfdac,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xb320,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0007,0x96df,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0x6320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0336
-};
-
-const uint16_t bmp46[362]   = // Bitmap 46
+    0x0004,0x91c0,0x0000,0x000c,0xb7ff,0x8008,0xffff,0x0007,0xb320,0x0000,0x0336,0x91c0,0x0000,0x0000,0x0336,0x8008,
+    0xffff,0x0008,0xb320,0x0000,0x0336,0x91c0,0x0000,0x0000,0x0007,0x96df,0x8007,0xffff,0x0004,0xb320,0x0000,0x0336,
+    0x91c0,0x8003,0x0000,0x0002,0x01d2,0xdfff,0x8006,0xffff,0x0009,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3b2c,0x3800,
+    0x0000,0x3c9b,0x8006,0xffff,0x000a,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0xb320,0x0000,0x0007,0x96df,0x8005,
+    0xffff,0x000b,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0x8004,0xffff,0x000b,
+    0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0xffff,0xfdac,0x0000,0x0000,0x3c9b,0x8004,0xffff,0x000c,0xb320,0x0000,
+    0x0336,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xb320,0x0000,0x0007,0x96df,0x8003,0xffff,0x0015,0xb320,0x0000,0x0336,
+    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xb320,0x0000,0x0336,0x91c0,
+    0x0000,0x3c9b,0x8003,0xffff,0x000c,0xfdac,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xb320,0x0000,0x0336,0x91c0,0x0000,
+    0x3c9b,0x8004,0xffff,0x000b,0xb320,0x0000,0x0007,0x96df,0xffff,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8004,
+    0xffff,0x000b,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8005,0xffff,0x000a,
+    0xfdac,0x0000,0x0000,0x65bf,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0009,0xb320,0x0000,0x000c,
+    0x6320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0002,0xfff6,0x6000,0x8003,0x0000,0x0004,0x0336,0x91c0,
+    0x0000,0x3c9b,0x8007,0xffff,0x0001,0xdc87,0x8003,0x0000,0x0004,0x0336,0x91c0,0x0000,0x3c9b,0x8007,0xffff,0x0008,
+    0xfffb,0x91c0,0x0000,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0004,0xfed2,0x3800,0x0000,0x0336
+};
+
+const uint16_t bmp46[223]   = // Bitmap 46 (RLE, 362 words raw)
 {
     0x1313, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xdc87,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xb320,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0007,0x96df,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,
-    0xffff,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp47[286]   = // Bitmap 47
+    0x8005,0xffff,0x0002,0xfff6,0x6000,0x8005,0x0000,0x0001,0x65bf,0x8009,0xffff,0x0002,0xfff6,0x6000,0x8009,0x0000,
+    0x0001,0x65bf,0x8006,0xffff,0x0005,0xfed2,0x3800,0x0000,0x0000,0x3c9b,0x8004,0xffff,0x0005,0xfff6,0x6000,0x0000,
+    0x0000,0x0336,0x8004,0xffff,0x0005,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0x8007,0xffff,0x0004,0xdc87,0x0000,0x0000,
+    0x3c9b,0x8003,0xffff,0x0004,0xb320,0x0000,0x01d2,0xdfff,0x8009,0xffff,0x0009,0xdc87,0x0000,0x0007,0x96df,0xffff,
+    0xfff6,0x6000,0x0000,0x65bf,0x800a,0xffff,0x0009,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
+    0x800b,0xffff,0x0007,0xdc87,0x0000,0x01d2,0xdfff,0xdc87,0x0000,0x0336,0x800c,0xffff,0x0007,0xfed2,0x3800,0x0007,
+    0x96df,0xb320,0x0000,0x0336,0x800c,0xffff,0x0007,0xfed2,0x3800,0x0007,0x96df,0xb320,0x0000,0x3c9b,0x800c,0xffff,
+    0x0007,0xfff6,0x6000,0x0007,0x96df,0xb320,0x0000,0x0336,0x800c,0xffff,0x0007,0xfed2,0x3800,0x0007,0x96df,0xb320,
+    0x0000,0x0336,0x800c,0xffff,0x0008,0xfed2,0x3800,0x0007,0x96df,0xfdac,0x0000,0x000c,0xb7ff,0x800b,0xffff,0x0008,
+    0xdc87,0x0000,0x01d2,0xdfff,0xfff6,0x6000,0x0000,0x65bf,0x800a,0xffff,0x000a,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,
+    0xffff,0xb320,0x0000,0x000c,0xb7ff,0x8009,0xffff,0x000b,0xdc87,0x0000,0x0007,0x96df,0xffff,0xffff,0xfff6,0x6000,
+    0x0000,0x000c,0xb7ff,0x8007,0xffff,0x0004,0xdc87,0x0000,0x0000,0x3c9b,0x8004,0xffff,0x0005,0xfed2,0x3800,0x0000,
+    0x0000,0x3c9b,0x8004,0xffff,0x0005,0xfff6,0x6000,0x0000,0x0000,0x0336,0x8006,0xffff,0x0002,0xfffb,0x91c0,0x8009,
+    0x0000,0x0001,0x3c9b,0x8009,0xffff,0x0002,0xfffb,0x91c0,0x8005,0x0000,0x0001,0x65bf,0x8006,0xffff
+};
+
+const uint16_t bmp47[153]   = // Bitmap 47 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0336,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x3c9b,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp48[381]   = // Bitmap 48
+    0x0001,0x91c0,0x8009,0x0000,0x0002,0x0007,0x96df,0x8003,0xffff,0x0001,0x91c0,0x800b,0x0000,0x0006,0x01d2,0xdfff,
+    0xffff,0x91c0,0x0000,0x3c9b,0x8007,0xffff,0x0008,0xdc87,0x0000,0x0000,0x0336,0xffff,0x91c0,0x0000,0x3c9b,0x8008,
+    0xffff,0x0007,0xdc87,0x0000,0x000c,0xb7ff,0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0007,0xfff6,0x6000,0x0000,0x65bf,
+    0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0007,0xfff6,0x6000,0x0000,0x65bf,0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0007,
+    0xfff6,0x6000,0x0000,0x65bf,0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0007,0xdc87,0x0000,0x000c,0xb7ff,0x91c0,0x0000,
+    0x3c9b,0x8007,0xffff,0x0006,0xb320,0x0000,0x0000,0x3c9b,0xffff,0x91c0,0x800b,0x0000,0x0004,0x0336,0xffff,0xffff,
+    0x91c0,0x8009,0x0000,0x0002,0x000c,0xb7ff,0x8003,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,0x0003,0x91c0,
+    0x0000,0x3c9b,0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,
+    0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,
+    0x800c,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x800c,0xffff
+};
+
+const uint16_t bmp48[241]   = // Bitmap 48 (RLE, 381 words raw)
 {
     0x1314, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xffff,0xfdac,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,
-    0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,
-    0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xfed2,0x3800,0x0000,0x0336,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdff6,0x6000,0x0000,0x0000,0x0007,0x96df,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x01d2,0xdfff
-};
-
-const uint16_t bmp49[324]   = // Bitmap 49
+    0x8005,0xffff,0x0002,0xfed2,0x3800,0x8004,0x0000,0x0002,0x000c,0xb7ff,0x8009,0xffff,0x0001,0xfdac,0x8009,0x0000,
+    0x0002,0x000c,0xb7ff,0x8006,0xffff,0x0005,0xdc87,0x0000,0x0000,0x0007,0x96df,0x8004,0xffff,0x0005,0xdc87,0x0000,
+    0x0000,0x0007,0x96df,0x8004,0xffff,0x0004,0xfdac,0x0000,0x0000,0x0336,0x8007,0xffff,0x000b,0xfffb,0x91c0,0x0000,
+    0x000c,0xb7ff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0x8009,0xffff,0x000a,0xfffb,0x91c0,0x0000,0x0336,0xffff,
+    0xffff,0xfdac,0x0000,0x000c,0xb7ff,0x800a,0xffff,0x0008,0xfdac,0x0000,0x0007,0x96df,0xffff,0xb320,0x0000,0x0336,
+    0x800b,0xffff,0x0008,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0x91c0,0x0000,0x3c9b,0x800c,0xffff,0x0007,0xb320,0x0000,
+    0x0336,0xffff,0x6000,0x0000,0x65bf,0x800c,0xffff,0x0007,0xdc87,0x0000,0x01d2,0xdfff,0x6000,0x0000,0x65bf,0x800c,
+    0xffff,0x0007,0xdc87,0x0000,0x01d2,0xdfff,0x6000,0x0000,0x65bf,0x800c,0xffff,0x0007,0xdc87,0x0000,0x01d2,0xdfff,
+    0x91c0,0x0000,0x3c9b,0x800c,0xffff,0x0007,0xb320,0x0000,0x0336,0xffff,0xb320,0x0000,0x0336,0x800b,0xffff,0x0009,
+    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xfdac,0x0000,0x0007,0x96df,0x800a,0xffff,0x0009,0xfdac,0x0000,0x0007,0x96df,
+    0xffff,0xfffb,0x91c0,0x0000,0x0336,0x8005,0xffff,0x000f,0xb320,0x0000,0x01d2,0xdfff,0xfffb,0x91c0,0x0000,0x01d2,
+    0xdfff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0336,0x8003,0xffff,0x0002,0xfffb,0x91c0,0x8005,0x0000,0x0002,0x0007,
+    0x96df,0x8004,0xffff,0x0001,0xfdac,0x8003,0x0000,0x0001,0x65bf,0x8004,0xffff,0x0001,0xdc87,0x8003,0x0000,0x0001,
+    0x3c9b,0x8006,0xffff,0x0002,0xfed2,0x3800,0x800b,0x0000,0x0001,0x65bf,0x8007,0xffff,0x0002,0xfed2,0x3800,0x8005,
+    0x0000,0x0007,0x01d2,0xdff6,0x6000,0x0000,0x0000,0x0007,0x96df,0x800f,0xffff,0x0004,0xfed2,0x3800,0x01d2,0xdfff
+};
+
+const uint16_t bmp49[222]   = // Bitmap 49 (RLE, 324 words raw)
 {
     0x1113, // Width and height
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff
-};
-
-const uint16_t bmp50[324]   = // Bitmap 50
+    0x0001,0x91c0,0x800a,0x0000,0x0002,0x01d2,0xdfff,0x8004,0xffff,0x0001,0x91c0,0x800b,0x0000,0x0002,0x0007,0x96df,
+    0x8003,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8007,0xffff,0x000a,0xfdac,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,
+    0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0009,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0x91c0,0x0000,0x3c9b,0x8009,
+    0xffff,0x0008,0xb320,0x0000,0x0336,0xffff,0xffff,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0008,0xb320,0x0000,0x0336,
+    0xffff,0xffff,0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0009,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0x91c0,0x0000,
+    0x3c9b,0x8008,0xffff,0x0009,0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0x91c0,0x0000,0x3c9b,0x8007,0xffff,0x0008,
+    0xdc87,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0x91c0,0x800b,0x0000,0x0002,0x000c,0xb7ff,0x8003,0xffff,0x0001,
+    0x91c0,0x800a,0x0000,0x0001,0x3c9b,0x8005,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xdc87,0x0000,
+    0x0000,0x3c9b,0x8006,0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8005,0xffff,0x0004,0xfdac,0x0000,0x0000,0x0336,0x8005,
+    0xffff,0x0003,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0004,0xb320,0x0000,0x0000,0x3c9b,0x8004,0xffff,0x0003,0x91c0,
+    0x0000,0x3c9b,0x8006,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x0007,0x96df,0x8003,0xffff,0x0003,0x91c0,0x0000,0x3c9b,
+    0x8007,0xffff,0x000a,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,0xffff,0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0009,
+    0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0x91c0,0x0000,0x3c9b,0x8008,0xffff,0x0009,0xfffb,0x91c0,0x0000,0x0007,
+    0x96df,0xffff,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0005,0xfed2,0x3800,0x0000,0x01d2,0xdfff
+};
+
+const uint16_t bmp50[206]   = // Bitmap 50 (RLE, 324 words raw)
 {
     0x1113, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0336,0xffff,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x3c9b,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp51[305]   = // Bitmap 51
+    0x8004,0xffff,0x0002,0xfffb,0x91c0,0x8005,0x0000,0x0001,0x3c9b,0x8008,0xffff,0x0001,0xb320,0x8009,0x0000,0x0001,
+    0x3c9b,0x8005,0xffff,0x0004,0xdc87,0x0000,0x0000,0x0336,0x8004,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x0000,0x65bf,
+    0x8003,0xffff,0x0004,0xfff6,0x6000,0x0000,0x65bf,0x8007,0xffff,0x000a,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xffff,
+    0xfdac,0x0000,0x000c,0xb7ff,0x8007,0xffff,0x000a,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xfdac,0x0000,0x0007,
+    0x96df,0x8007,0xffff,0x000b,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0x800d,
+    0xffff,0x0001,0xdc87,0x8004,0x0000,0x0001,0x65bf,0x800c,0xffff,0x0001,0xb320,0x8007,0x0000,0x0001,0x3c9b,0x800a,
+    0xffff,0x0001,0xb320,0x8007,0x0000,0x0002,0x01d2,0xdfff,0x800a,0xffff,0x0002,0xfffb,0x91c0,0x8004,0x0000,0x0002,
+    0x000c,0xb7ff,0x800d,0xffff,0x0009,0xb320,0x0000,0x0000,0x0336,0xffff,0xfff6,0x6000,0x0000,0x65bf,0x8009,0xffff,
+    0x0008,0xdc87,0x0000,0x01d2,0xdfff,0xfffb,0x91c0,0x0000,0x0336,0x8009,0xffff,0x0009,0xfdac,0x0000,0x000c,0xb7ff,
+    0xffff,0xdc87,0x0000,0x000c,0xb7ff,0x8008,0xffff,0x000a,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xfed2,0x3800,0x0000,
+    0x01d2,0xdfff,0x8006,0xffff,0x0004,0xfed2,0x3800,0x0000,0x3c9b,0x8003,0xffff,0x0001,0xdc87,0x8003,0x0000,0x0001,
+    0x65bf,0x8004,0xffff,0x0005,0xdc87,0x0000,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0001,0xfdac,0x8009,0x0000,0x0002,
+    0x000c,0xb7ff,0x8007,0xffff,0x0001,0xdc87,0x8005,0x0000,0x0002,0x0007,0x96df,0x8004,0xffff
+};
+
+const uint16_t bmp51[135]   = // Bitmap 51 (RLE, 305 words raw)
 {
     0x1013, // Width and height
-    0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,
-    0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp52[286]   = // Bitmap 52
+    0x0001,0xfdac,0x800d,0x0000,0x0003,0x0007,0x96df,0xfdac,0x800d,0x0000,0x0002,0x0007,0x96df,0x8006,0xffff,0x0004,
+    0xfdac,0x0000,0x000c,0xb7ff,0x800c,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800c,0xffff,0x0004,0xfdac,0x0000,
+    0x000c,0xb7ff,0x800c,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800c,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,
+    0x800c,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800c,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800c,0xffff,
+    0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800c,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800c,0xffff,0x0004,0xfdac,
+    0x0000,0x000c,0xb7ff,0x800c,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800c,0xffff,0x0004,0xfdac,0x0000,0x000c,
+    0xb7ff,0x800c,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800c,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800c,
+    0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800c,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800c,0xffff,0x0004,
+    0xfdac,0x0000,0x000c,0xb7ff,0x8006,0xffff
+};
+
+const uint16_t bmp52[184]   = // Bitmap 52 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,
-    0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,
-    0xfed2,0x3800,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,
-    0xffff,0xb320,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp53[343]   = // Bitmap 53
+    0x0003,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,
+    0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,
+    0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,
+    0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,
+    0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,
+    0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,
+    0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0x91c0,0x0000,0x3c9b,
+    0x8009,0xffff,0x0006,0xb320,0x0000,0x0336,0xb320,0x0000,0x0336,0x8008,0xffff,0x0008,0xfffb,0x91c0,0x0000,0x3c9b,
+    0xdc87,0x0000,0x01d2,0xdfff,0x8007,0xffff,0x0008,0xfed2,0x3800,0x0000,0x65bf,0xfed2,0x3800,0x0000,0x3c9b,0x8007,
+    0xffff,0x000a,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xb320,0x0000,0x0000,0x01d2,0xdfff,0x8003,0xffff,0x0005,0xfffb,
+    0x91c0,0x0000,0x0000,0x65bf,0x8003,0xffff,0x0001,0xb320,0x8009,0x0000,0x0001,0x65bf,0x8005,0xffff,0x0002,0xfffb,
+    0x91c0,0x8005,0x0000,0x0001,0x0336,0x8004,0xffff
+};
+
+const uint16_t bmp53[228]   = // Bitmap 53 (RLE, 343 words raw)
 {
     0x1213, // Width and height
-    0xb320,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,
-    0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,
-    0xfff6,0x6000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,
-    0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x3c9b,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x01d2,0xdfff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0007,0x96d6,0x6000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x39c7,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp54[476]   = // Bitmap 54
+    0x0004,0xb320,0x0000,0x000c,0xb7ff,0x800a,0xffff,0x0008,0xdc87,0x0000,0x000c,0xb7ff,0xfdac,0x0000,0x0000,0x65bf,
+    0x8009,0xffff,0x0009,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xfff6,0x6000,0x0000,0x0336,0x8009,0xffff,0x000a,0xfed2,
+    0x3800,0x0007,0x96df,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0x8008,0xffff,0x000a,0xb320,0x0000,0x01d2,0xdfff,
+    0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0x8007,0xffff,0x0004,0xfff6,0x6000,0x0000,0x3c9b,0x8003,0xffff,0x0004,
+    0xfffb,0x91c0,0x0000,0x0336,0x8007,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0004,0xfdac,0x0000,
+    0x0007,0x96df,0x8006,0xffff,0x0003,0xb320,0x0000,0x0336,0x8005,0xffff,0x0004,0xfff6,0x6000,0x0000,0x3c9b,0x8005,
+    0xffff,0x0004,0xfff6,0x6000,0x0000,0x65bf,0x8006,0xffff,0x0004,0xb320,0x0000,0x01d2,0xdfff,0x8004,0xffff,0x0004,
+    0xdc87,0x0000,0x000c,0xb7ff,0x8006,0xffff,0x0004,0xfdac,0x0000,0x0007,0x96df,0x8003,0xffff,0x0004,0xfffb,0x91c0,
+    0x0000,0x3c9b,0x8007,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8003,0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,
+    0x8008,0xffff,0x000a,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0009,
+    0xfed2,0x3800,0x0007,0x96df,0xffff,0xfffb,0x91c0,0x0000,0x65bf,0x800a,0xffff,0x0008,0xb320,0x0000,0x3c9b,0xffff,
+    0xfdac,0x0000,0x000c,0xb7ff,0x800a,0xffff,0x0007,0xfdac,0x0000,0x01d2,0xdfff,0xb320,0x0000,0x0336,0x800b,0xffff,
+    0x0007,0xfff6,0x6000,0x0007,0x96d6,0x6000,0x0007,0x96df,0x800c,0xffff,0x0006,0xb320,0x0000,0x39c7,0x0000,0x01d2,
+    0xdfff,0x800c,0xffff,0x0005,0xfed2,0x3800,0x0000,0x0000,0x3c9b,0x800d,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x000c,
+    0xb7ff,0x8007,0xffff
+};
+
+const uint16_t bmp54[390]   = // Bitmap 54 (RLE, 476 words raw)
 {
     0x1913, // Width and height
-    0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xfdac,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xb320,0x0000,0x39c7,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0007,0x95b2,0x3800,0x01d2,
-    0xdfff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x01d2,0xdff6,0x6000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xdc87,
-    0x0000,0x0336,0xffff,0xb320,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x65bf,0xffff,0xfdac,0x0000,
-    0x0336,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xffff,0xfff6,0x6000,0x000c,0xb7ff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xb320,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xfdac,0x0000,
-    0x01d2,0xdfff,0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xdc87,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xdc87,
-    0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,
-    0x65bf,0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,0xffff,0xfdac,0x0000,0x01d2,0xdfff,0xffff,0xdc87,
-    0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xfed2,0x3800,0x000c,
-    0xb7ff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0007,0x96df,0xffff,0xb320,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x01d2,0xdfff,0xfdac,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xb320,0x0000,0x65bf,0xfffb,0x91c0,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,
-    0x000c,0xb7ff,0xb320,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0336,0xfed2,0x3800,
-    0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x65bb,0x91c0,0x0007,0x96df,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x01d2,0xb487,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x3b2c,0x3800,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfffb,0x91c0,0x000c,0x6320,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,
-    0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x000c,
-    0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp55[324]   = // Bitmap 55
+    0x0004,0xdc87,0x0000,0x000c,0xb7ff,0x8006,0xffff,0x0005,0xfed2,0x3800,0x0000,0x000c,0xb7ff,0x8006,0xffff,0x0008,
+    0xfed2,0x3800,0x0000,0x65bf,0xfdac,0x0000,0x0007,0x96df,0x8006,0xffff,0x0001,0xfdac,0x8003,0x0000,0x0001,0x65bf,
+    0x8006,0xffff,0x0008,0xfdac,0x0000,0x0007,0x96df,0xfff6,0x6000,0x0000,0x3c9b,0x8006,0xffff,0x0005,0xb320,0x0000,
+    0x39c7,0x0000,0x0336,0x8006,0xffff,0x0008,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xb320,0x0000,0x0336,0x8005,0xffff,
+    0x0007,0xfff6,0x6000,0x0007,0x95b2,0x3800,0x01d2,0xdfff,0x8004,0xffff,0x000a,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,
+    0xffff,0xdc87,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0007,0xfed2,0x3800,0x01d2,0xdff6,0x6000,0x0007,0x96df,0x8004,
+    0xffff,0x000a,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0x8004,0xffff,0x0007,0xdc87,
+    0x0000,0x0336,0xffff,0xb320,0x0000,0x3c9b,0x8004,0xffff,0x000a,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xfff6,
+    0x6000,0x0000,0x65bf,0x8004,0xffff,0x0007,0xb320,0x0000,0x65bf,0xffff,0xfdac,0x0000,0x0336,0x8004,0xffff,0x0003,
+    0xdc87,0x0000,0x0336,0x8004,0xffff,0x0003,0xb320,0x0000,0x0336,0x8003,0xffff,0x0009,0xfff6,0x6000,0x000c,0xb7ff,
+    0xffff,0xfed2,0x3800,0x000c,0xb7ff,0x8003,0xffff,0x0003,0xb320,0x0000,0x3c9b,0x8004,0xffff,0x0015,0xfdac,0x0000,
+    0x01d2,0xdfff,0xffff,0xffff,0xfdac,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,0xfff6,
+    0x6000,0x0007,0x96df,0x8004,0xffff,0x0009,0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xdc87,0x0000,0x3c9b,0x8003,
+    0xffff,0x0009,0xdc87,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0x8004,0xffff,0x0009,0xfffb,0x91c0,
+    0x0000,0x65bf,0xffff,0xfffb,0x91c0,0x0000,0x65bf,0x8003,0xffff,0x0008,0xfdac,0x0000,0x01d2,0xdfff,0xffff,0xdc87,
+    0x0000,0x0336,0x8006,0xffff,0x0008,0xb320,0x0000,0x0336,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0x8003,0xffff,0x0008,
+    0xfff6,0x6000,0x0007,0x96df,0xffff,0xb320,0x0000,0x65bf,0x8006,0xffff,0x0007,0xfdac,0x0000,0x01d2,0xdfff,0xfdac,
+    0x0000,0x0336,0x8005,0xffff,0x0007,0xb320,0x0000,0x65bf,0xfffb,0x91c0,0x0007,0x96df,0x8006,0xffff,0x0007,0xfff6,
+    0x6000,0x000c,0xb7ff,0xb320,0x0000,0x3c9b,0x8005,0xffff,0x0007,0xdc87,0x0000,0x0336,0xfed2,0x3800,0x01d2,0xdfff,
+    0x8006,0xffff,0x0007,0xfffb,0x91c0,0x0000,0x65bb,0x91c0,0x0007,0x96df,0x8005,0xffff,0x0006,0xfed2,0x3800,0x01d2,
+    0xb487,0x0000,0x3c9b,0x8008,0xffff,0x0006,0xdc87,0x0000,0x3b2c,0x3800,0x000c,0xb7ff,0x8005,0xffff,0x0006,0xfffb,
+    0x91c0,0x000c,0x6320,0x0000,0x65bf,0x8008,0xffff,0x0001,0xfdac,0x8003,0x0000,0x0001,0x0336,0x8007,0xffff,0x0005,
+    0xb320,0x0000,0x0000,0x000c,0xb7ff,0x8008,0xffff,0x0005,0xfff6,0x6000,0x0000,0x0000,0x65bf,0x8007,0xffff,0x0005,
+    0xfdac,0x0000,0x0000,0x01d2,0xdfff,0x8009,0xffff,0x0004,0xb320,0x0000,0x0007,0x96df,0x8007,0xffff,0x0004,0xfff6,
+    0x6000,0x0000,0x3c9b,0x8005,0xffff
+};
+
+const uint16_t bmp55[235]   = // Bitmap 55 (RLE, 324 words raw)
 {
     0x1113, // Width and height
-    0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,
-    0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0336,0xffff,0xfdac,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0007,0x96d6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0007,0x948c,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x3c9b,0xffff,0xb320,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xfed2,0x3800,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,
-    0xfff6,0x6000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,
-    0xb320,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b
-};
-
-const uint16_t bmp56[324]   = // Bitmap 56
+    0x0005,0xfffb,0x91c0,0x0000,0x0007,0x96df,0x8008,0xffff,0x000a,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xfed2,0x3800,
+    0x0000,0x01d2,0xdfff,0x8006,0xffff,0x0004,0xfdac,0x0000,0x0000,0x65bf,0x8003,0xffff,0x0004,0xdc87,0x0000,0x0000,
+    0x3c9b,0x8005,0xffff,0x0004,0xfed2,0x3800,0x0000,0x0336,0x8005,0xffff,0x0004,0xb320,0x0000,0x0007,0x96df,0x8003,
+    0xffff,0x0005,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0x8005,0xffff,0x000b,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,
+    0xffff,0xdc87,0x0000,0x0007,0x96df,0x8007,0xffff,0x0009,0xfdac,0x0000,0x0000,0x0336,0xffff,0xfdac,0x0000,0x0000,
+    0x3c9b,0x8009,0xffff,0x0008,0xb320,0x0000,0x0007,0x96d6,0x6000,0x0000,0x01d2,0xdfff,0x8009,0xffff,0x0002,0xfff6,
+    0x6000,0x8003,0x0000,0x0002,0x0007,0x96df,0x800b,0xffff,0x0001,0xfdac,0x8003,0x0000,0x0001,0x65bf,0x800c,0xffff,
+    0x0005,0xfed2,0x3800,0x0000,0x0000,0x65bf,0x800b,0xffff,0x0002,0xfffb,0x91c0,0x8003,0x0000,0x0002,0x000c,0xb7ff,
+    0x800a,0xffff,0x0007,0xb320,0x0000,0x0007,0x948c,0x0000,0x0000,0x0336,0x8009,0xffff,0x0009,0xfdac,0x0000,0x0000,
+    0x3c9b,0xffff,0xb320,0x0000,0x0000,0x65bf,0x8007,0xffff,0x000b,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xfffb,
+    0x91c0,0x0000,0x0007,0x96df,0x8005,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x0007,0x96df,0x8003,0xffff,0x0005,0xfed2,
+    0x3800,0x0000,0x01d2,0xdfff,0x8004,0xffff,0x0004,0xdc87,0x0000,0x0000,0x65bf,0x8005,0xffff,0x0004,0xdc87,0x0000,
+    0x0000,0x3c9b,0x8003,0xffff,0x0004,0xfed2,0x3800,0x0000,0x0336,0x8006,0xffff,0x000b,0xfffb,0x91c0,0x0000,0x0007,
+    0x96df,0xffff,0xfff6,0x6000,0x0000,0x000c,0xb7ff,0x8007,0xffff,0x0009,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xb320,
+    0x0000,0x0007,0x96df,0x8009,0xffff,0x0004,0xdc87,0x0000,0x0000,0x3c9b
+};
+
+const uint16_t bmp56[187]   = // Bitmap 56 (RLE, 324 words raw)
 {
     0x1113, // Width and height
-    0xb320,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,
-    0xffff,0xfdac,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xb320,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x632c,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp57[305]   = // Bitmap 57
+    0x0004,0xb320,0x0000,0x0007,0x96df,0x8009,0xffff,0x0009,0xfff6,0x6000,0x0000,0x0336,0xfff6,0x6000,0x0000,0x01d2,
+    0xdfff,0x8008,0xffff,0x0009,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xfdac,0x0000,0x0000,0x3c9b,0x8007,0xffff,0x0004,
+    0xfdac,0x0000,0x0000,0x65bf,0x8003,0xffff,0x0004,0xb320,0x0000,0x0007,0x96df,0x8005,0xffff,0x0004,0xfff6,0x6000,
+    0x0000,0x0336,0x8004,0xffff,0x0004,0xfff6,0x6000,0x0000,0x0336,0x8005,0xffff,0x0004,0xb320,0x0000,0x000c,0xb7ff,
+    0x8005,0xffff,0x0004,0xfdac,0x0000,0x0000,0x65bf,0x8003,0xffff,0x0004,0xfed2,0x3800,0x0000,0x65bf,0x8007,0xffff,
+    0x0009,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xfff6,0x6000,0x0000,0x0336,0x8008,0xffff,0x0009,0xfff6,0x6000,0x0000,
+    0x0336,0xffff,0xb320,0x0000,0x01d2,0xdfff,0x8009,0xffff,0x0007,0xfdac,0x0000,0x0000,0x632c,0x0000,0x0007,0x96df,
+    0x800b,0xffff,0x0001,0xb320,0x8003,0x0000,0x0001,0x3c9b,0x800c,0xffff,0x0005,0xfff6,0x6000,0x0000,0x01d2,0xdfff,
+    0x800c,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x800d,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x800d,0xffff,
+    0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x800d,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x800d,0xffff,0x0004,0xfffb,
+    0x91c0,0x0000,0x3c9b,0x800d,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x800d,0xffff,0x0004,0xfffb,0x91c0,0x0000,
+    0x3c9b,0x800d,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8007,0xffff
+};
+
+const uint16_t bmp57[139]   = // Bitmap 57 (RLE, 305 words raw)
 {
     0x1013, // Width and height
-    0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xb320,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,
-    0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf
-};
-
-const uint16_t bmp64[183]   = // Bitmap 64
+    0x0002,0xffff,0xfdac,0x800c,0x0000,0x0004,0x01d2,0xdfff,0xffff,0xfdac,0x800c,0x0000,0x0002,0x01d2,0xdfff,0x800b,
+    0xffff,0x0004,0xdc87,0x0000,0x0000,0x3c9b,0x800b,0xffff,0x0004,0xfdac,0x0000,0x0000,0x0336,0x800b,0xffff,0x0005,
+    0xfff6,0x6000,0x0000,0x01d2,0xdfff,0x800a,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x0007,0x96df,0x800b,0xffff,0x0004,
+    0xdc87,0x0000,0x0000,0x65bf,0x800b,0xffff,0x0004,0xfdac,0x0000,0x0000,0x3c9b,0x800b,0xffff,0x0005,0xfed2,0x3800,
+    0x0000,0x01d2,0xdfff,0x800a,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0x800b,0xffff,0x0004,0xb320,0x0000,
+    0x0000,0x65bf,0x800b,0xffff,0x0004,0xfdac,0x0000,0x0000,0x3c9b,0x800b,0xffff,0x0004,0xfed2,0x3800,0x0000,0x0336,
+    0x800b,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0x800b,0xffff,0x0004,0xb320,0x0000,0x0007,0x96df,0x800b,
+    0xffff,0x0004,0xdc87,0x0000,0x0000,0x65bf,0x800b,0xffff,0x0004,0xfed2,0x3800,0x0000,0x0336,0x800c,0xffff,0x0001,
+    0xdc87,0x800e,0x0000,0x0002,0x65bf,0xdc87,0x800e,0x0000,0x0001,0x65bf
+};
+
+const uint16_t bmp64[147]   = // Bitmap 64 (RLE, 183 words raw)
 {
     0x0d0e, // Width and height
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,
-    0xfed2,0x3800,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x3c9b,0xffff,
-    0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0336,0xffff,
-    0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,
-    0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xfffb,0x91c0,0x0000,0x0336,0xffff,
-    0xb320,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,
-    0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0336,0xffff,
-    0xb320,0x0000,0x0007,0x96df,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xb487,0x0000,0x01d2,0xdfff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xfed2,0x3800,0x0007,0x96df
-};
-
-const uint16_t bmp65[248]   = // Bitmap 65
+    0x8003,0xffff,0x0001,0xb320,0x8005,0x0000,0x0001,0x3c9b,0x8004,0xffff,0x0001,0xfdac,0x8008,0x0000,0x0007,0x000c,
+    0xb7ff,0xffff,0xfed2,0x3800,0x0000,0x0336,0x8004,0xffff,0x0009,0xb320,0x0000,0x0000,0x3c9b,0xffff,0xdc87,0x0000,
+    0x01d2,0xdfff,0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x0336,0x8009,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x0336,
+    0x8008,0xffff,0x0001,0xb320,0x8003,0x0000,0x0001,0x0336,0x8003,0xffff,0x0001,0xb320,0x8008,0x0000,0x0004,0x0336,
+    0xffff,0xfff6,0x6000,0x8005,0x0000,0x000a,0x3c9b,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xb320,0x0000,0x0007,0x96df,
+    0x8004,0xffff,0x0008,0xfffb,0x91c0,0x0000,0x0336,0xffff,0x91c0,0x0000,0x3c9b,0x8005,0xffff,0x0008,0xfff6,0x6000,
+    0x0000,0x0336,0xffff,0x6000,0x0000,0x3c9b,0x8005,0xffff,0x000d,0xdc87,0x0000,0x0000,0x0336,0xffff,0xb320,0x0000,
+    0x0007,0x96df,0xffff,0xffff,0xfffb,0x91c0,0x8003,0x0000,0x0004,0x01d2,0xdfff,0xfed2,0x3800,0x8006,0x0000,0x0008,
+    0x01d2,0xb487,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0x91c0,0x8003,0x0000,0x0007,0x0007,0x96df,0xffff,0xfed2,0x3800,
+    0x0007,0x96df
+};
+
+const uint16_t bmp65[198]   = // Bitmap 65 (RLE, 248 words raw)
 {
     0x0d13, // Width and height
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xfdac,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0x6320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xfdac,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xb320,0x0000,0x0000,0x65bf,0xffff,
-    0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,
-    0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0xfdac,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,
-    0xfdac,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,
-    0xfdac,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,
-    0xfdac,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,
-    0xfdac,0x0000,0x000c,0x6320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xfdac,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp66[183]   = // Bitmap 66
+    0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8009,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8009,0xffff,0x0004,0xfdac,
+    0x0000,0x000c,0xb7ff,0x8009,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8009,0xffff,0x0004,0xfdac,0x0000,0x000c,
+    0xb7ff,0x8009,0xffff,0x0005,0xfdac,0x0000,0x000c,0xb7ff,0xfdac,0x8003,0x0000,0x0002,0x000c,0xb7ff,0x8003,0xffff,
+    0x0004,0xfdac,0x0000,0x000c,0x6320,0x8006,0x0000,0x0004,0x3c9b,0xffff,0xffff,0xfdac,0x8003,0x0000,0x000e,0x01d2,
+    0xdfff,0xffff,0xffff,0xb320,0x0000,0x0000,0x65bf,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0x8004,0xffff,0x0008,
+    0xb320,0x0000,0x01d2,0xdfff,0xfdac,0x0000,0x0007,0x96df,0x8005,0xffff,0x0008,0xfed2,0x3800,0x0007,0x96df,0xfdac,
+    0x0000,0x000c,0xb7ff,0x8005,0xffff,0x0008,0xfff6,0x6000,0x0000,0x65bf,0xfdac,0x0000,0x01d2,0xdfff,0x8005,0xffff,
+    0x0008,0xfffb,0x91c0,0x0000,0x3c9b,0xfdac,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0008,0xfffb,0x91c0,0x0000,0x3c9b,
+    0xfdac,0x0000,0x000c,0xb7ff,0x8005,0xffff,0x0008,0xfff6,0x6000,0x0000,0x65bf,0xfdac,0x0000,0x0007,0x96df,0x8005,
+    0xffff,0x0008,0xfdac,0x0000,0x0007,0x96df,0xfdac,0x0000,0x0000,0x0336,0x8004,0xffff,0x0006,0xfffb,0x91c0,0x0000,
+    0x01d2,0xdfff,0xfdac,0x8003,0x0000,0x000d,0x0336,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xfdac,
+    0x0000,0x000c,0x6320,0x8006,0x0000,0x0008,0x65bf,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xfdac,0x8003,0x0000,
+    0x0002,0x000c,0xb7ff,0x8003,0xffff
+};
+
+const uint16_t bmp66[137]   = // Bitmap 66 (RLE, 183 words raw)
 {
     0x0d0e, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,
-    0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xfff6,0x6000,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp67[267]   = // Bitmap 67
+    0x8004,0xffff,0x0001,0xfdac,0x8004,0x0000,0x0001,0x0336,0x8005,0xffff,0x0002,0xfff6,0x6000,0x8006,0x0000,0x0015,
+    0x000c,0xb7ff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,
+    0xffff,0xfdac,0x0000,0x0007,0x96df,0x8004,0xffff,0x0008,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xb320,0x0000,0x0336,
+    0x8005,0xffff,0x0008,0xfffb,0x91c0,0x0000,0x3c9b,0xfffb,0x91c0,0x0000,0x3c9b,0x8009,0xffff,0x0004,0xfff6,0x6000,
+    0x0000,0x65bf,0x8009,0xffff,0x0004,0xfff6,0x6000,0x0000,0x65bf,0x8009,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,
+    0x800a,0xffff,0x0003,0xb320,0x0000,0x0336,0x8006,0xffff,0x0008,0xdc87,0x0000,0x01d2,0xffff,0xfdac,0x0000,0x0007,
+    0x96df,0x8004,0xffff,0x0015,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,
+    0xfff6,0x6000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xfff6,0x6000,0x8006,0x0000,0x0002,0x0007,0x96df,0x8005,0xffff,
+    0x0001,0xdc87,0x8004,0x0000,0x0001,0x0336,0x8003,0xffff
+};
+
+const uint16_t bmp67[208]   = // Bitmap 67 (RLE, 267 words raw)
 {
     0x0e13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x6327,0x0000,0x01d2,0xdfff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,
-    0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,
-    0xdfff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0x9487,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xdc87,0x0000,0x01d2,0xdfff
-};
-
-const uint16_t bmp68[197]   = // Bitmap 68
+    0x800a,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x800a,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x800a,0xffff,
+    0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x800a,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x800a,0xffff,0x0004,0xdc87,
+    0x0000,0x01d2,0xdfff,0x8004,0xffff,0x0001,0xb320,0x8003,0x0000,0x000a,0x01d2,0xdfff,0xdc87,0x0000,0x01d2,0xdfff,
+    0xffff,0xffff,0xfed2,0x3800,0x8005,0x0000,0x000e,0x0007,0x6327,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0x91c0,0x0000,
+    0x0007,0x96df,0xffff,0xffff,0xfdac,0x8003,0x0000,0x0007,0x01d2,0xdfff,0xffff,0xfdac,0x0000,0x0007,0x96df,0x8004,
+    0xffff,0x0009,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xb320,0x0000,0x0336,0x8005,0xffff,0x0009,0xfffb,0x91c0,
+    0x0000,0x01d2,0xdfff,0xfffb,0x91c0,0x0000,0x65bf,0x8006,0xffff,0x0008,0xb320,0x0000,0x01d2,0xdfff,0xfff6,0x6000,
+    0x0000,0x65bf,0x8006,0xffff,0x0008,0xdc87,0x0000,0x01d2,0xdfff,0xfff6,0x6000,0x0000,0x65bf,0x8006,0xffff,0x0008,
+    0xdc87,0x0000,0x01d2,0xdfff,0xfffb,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0008,0xb320,0x0000,0x01d2,0xdfff,0xdfff,
+    0xb320,0x0000,0x0336,0x8005,0xffff,0x000a,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,0xfdac,0x0000,0x0007,0x96df,
+    0x8004,0xffff,0x000e,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,
+    0xfdac,0x8003,0x0000,0x0006,0x01d2,0xdfff,0xffff,0xffff,0xfff6,0x6000,0x8005,0x0000,0x0005,0x000c,0x9487,0x0000,
+    0x01d2,0xdfff,0x8004,0xffff,0x0001,0xdc87,0x8003,0x0000,0x0006,0x01d2,0xdfff,0xdc87,0x0000,0x01d2,0xdfff
+};
+
+const uint16_t bmp68[138]   = // Bitmap 68 (RLE, 197 words raw)
 {
     0x0e0e, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,
-    0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,
-    0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0336,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp69[172]   = // Bitmap 69
+    0x8004,0xffff,0x0001,0xfdac,0x8004,0x0000,0x0002,0x01d2,0xdfff,0x8005,0xffff,0x0002,0xfffb,0x91c0,0x8007,0x0000,
+    0x0001,0x65bf,0x8003,0xffff,0x0012,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,
+    0x96df,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0x8005,0xffff,0x0008,0xb320,0x0000,0x0336,0xffff,0xffff,0xb320,
+    0x0000,0x0336,0x8006,0xffff,0x0008,0xfed2,0x3800,0x000c,0xb7ff,0xfffb,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0006,
+    0xfff6,0x6000,0x0000,0x65bf,0xfff6,0x6000,0x800b,0x0000,0x0003,0x65bf,0xfff6,0x6000,0x800b,0x0000,0x0005,0x3c9b,
+    0xfffb,0x91c0,0x0000,0x65bf,0x800b,0xffff,0x0003,0xb320,0x0000,0x0336,0x800b,0xffff,0x0004,0xfdac,0x0000,0x0007,
+    0x96df,0x8005,0xffff,0x000a,0xfed2,0x3800,0x0007,0x96df,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0x8003,0xffff,
+    0x0004,0xfdac,0x0000,0x0000,0x0336,0x8003,0xffff,0x0002,0xfff6,0x6000,0x8007,0x0000,0x0002,0x01d2,0xdfff,0x8005,
+    0xffff,0x0001,0xfdac,0x8005,0x0000,0x0001,0x65bf,0x8003,0xffff
+};
+
+const uint16_t bmp69[149]   = // Bitmap 69 (RLE, 172 words raw)
 {
     0x0913, // Width and height
-    0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x65bf,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0007,0x96df,
-    0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,
-    0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xfffb,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xfff6,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xfff6,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp70[267]   = // Bitmap 70
+    0x8003,0xffff,0x0002,0xfed2,0x3800,0x8003,0x0000,0x0005,0x65bf,0xffff,0xffff,0xfed2,0x3800,0x8003,0x0000,0x0008,
+    0x0007,0x96df,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0x8005,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8005,
+    0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8003,0xffff,0x0001,0xdc87,0x8006,0x0000,0x0003,0x65bf,0xffff,0xdc87,
+    0x8006,0x0000,0x0001,0x65bf,0x8003,0xffff,0x000d,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xfffb,0xffff,0xffff,
+    0xdc87,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0006,0xdc87,0x0000,
+    0x01d2,0xdfff,0xffff,0xfffb,0x8003,0xffff,0x0006,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xfff6,0x8003,0xffff,0x0006,
+    0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xfff6,0x8003,0xffff,0x0006,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0x8003,
+    0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0004,
+    0xdc87,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0004,0xdc87,0x0000,
+    0x01d2,0xdfff,0x8003,0xffff
+};
+
+const uint16_t bmp70[222]   = // Bitmap 70 (RLE, 267 words raw)
 {
     0x0e13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0x9487,0x0000,0x01d2,0xdfff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,
-    0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0x9487,0x0000,0x0336,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xdc87,0x0000,0x0336,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x3c9b,0xffff,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,
-    0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp71[229]   = // Bitmap 71
+    0x8004,0xffff,0x0001,0xb320,0x8003,0x0000,0x000a,0x01d2,0xdfff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xfff6,
+    0x6000,0x8005,0x0000,0x000e,0x000c,0x9487,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,
+    0xffff,0xfdac,0x8003,0x0000,0x0007,0x01d2,0xdfff,0xffff,0xfdac,0x0000,0x0007,0x96df,0x8004,0xffff,0x0009,0xfdac,
+    0x0000,0x0000,0x01d2,0xdfff,0xffff,0xb320,0x0000,0x0336,0x8005,0xffff,0x0009,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,
+    0xfffb,0x91c0,0x0000,0x65bf,0x8006,0xffff,0x0008,0xb320,0x0000,0x01d2,0xdfff,0xfff6,0x6000,0x0000,0x65bf,0x8006,
+    0xffff,0x0008,0xdc87,0x0000,0x01d2,0xdfff,0xfff6,0x6000,0x0000,0x65bf,0x8006,0xffff,0x0008,0xdc87,0x0000,0x01d2,
+    0xdfff,0xfffb,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0008,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xb320,0x0000,0x0336,
+    0x8005,0xffff,0x000a,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,0xfdac,0x0000,0x0007,0x96df,0x8004,0xffff,0x000e,
+    0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xfdac,0x8003,0x0000,
+    0x0006,0x01d2,0xdfff,0xffff,0xffff,0xfff6,0x6000,0x8005,0x0000,0x0004,0x000c,0x9487,0x0000,0x0336,0x8005,0xffff,
+    0x0001,0xb320,0x8003,0x0000,0x0005,0x01d2,0xdfff,0xdc87,0x0000,0x0336,0x800b,0xffff,0x0008,0xb320,0x0000,0x3c9b,
+    0xffff,0xffff,0xb320,0x0000,0x0336,0x8005,0xffff,0x000a,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xdc87,0x0000,
+    0x0000,0x3c9b,0x8003,0xffff,0x0009,0xfff6,0x6000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xfffb,0x91c0,0x8007,0x0000,
+    0x0002,0x0007,0x96df,0x8005,0xffff,0x0001,0xfdac,0x8005,0x0000,0x0001,0x3c9b,0x8004,0xffff
+};
+
+const uint16_t bmp71[181]   = // Bitmap 71 (RLE, 229 words raw)
 {
     0x0c13, // Width and height
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x6327,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,
-    0xfed2,0x3800,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xb320,0x0000,0x0000,0x65bf,
-    0xfed2,0x3800,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,
-    0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336
-};
-
-const uint16_t bmp72[77]   = // Bitmap 72
+    0x0004,0xfed2,0x3800,0x0007,0x96df,0x8008,0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,0x8008,0xffff,0x0004,0xfed2,
+    0x3800,0x0007,0x96df,0x8008,0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,0x8008,0xffff,0x0004,0xfed2,0x3800,0x0007,
+    0x96df,0x8008,0xffff,0x0006,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x8003,0x0000,0x0007,0x3c9b,0xffff,0xffff,
+    0xfed2,0x3800,0x0007,0x6327,0x8006,0x0000,0x0012,0x0336,0xffff,0xfed2,0x3800,0x0000,0x0000,0x01d2,0xdfff,0xffff,
+    0xffff,0xb320,0x0000,0x0000,0x65bf,0xfed2,0x3800,0x0000,0x0336,0x8004,0xffff,0x0008,0xfff6,0x6000,0x0000,0x3c9b,
+    0xfed2,0x3800,0x0000,0x65bf,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,
+    0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,
+    0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,
+    0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,
+    0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,
+    0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,
+    0x0003,0xb320,0x0000,0x0336
+};
+
+const uint16_t bmp72[69]   = // Bitmap 72 (RLE, 77 words raw)
 {
     0x0413, // Width and height
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
+    0x0008,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0x800c,0xffff,0x0038,0xfed2,0x3800,0x0007,0x96df,
+    0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,
+    0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,
+    0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,
     0xfed2,0x3800,0x0007,0x96df
 };
 
-const uint16_t bmp73[169]   = // Bitmap 73
+const uint16_t bmp73[148]   = // Bitmap 73 (RLE, 169 words raw)
 {
     0x0718, // Width and height
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,
-    0xfffb,0x91c0,0x0000,0x0000,0x0000,0x3c9b,0xffff,
-    0xfed2,0x3800,0x0000,0x0000,0x0336,0xffff,0xffff
-};
-
-const uint16_t bmp74[229]   = // Bitmap 74
+    0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8018,0xffff,
+    0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,
+    0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,
+    0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,
+    0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,
+    0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,
+    0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,
+    0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,
+    0x0006,0xb320,0x0000,0x01d2,0xdfff,0xfffb,0x91c0,0x8003,0x0000,0x0009,0x3c9b,0xffff,0xfed2,0x3800,0x0000,0x0000,
+    0x0336,0xffff,0xffff
+};
+
+const uint16_t bmp74[197]   = // Bitmap 74 (RLE, 229 words raw)
 {
     0x0c13, // Width and height
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x000c,0xb7ff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x000c,0xb7ff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7fb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x0007,0x39c0,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x0000,0x000c,0xb7f6,0x6000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x3c9b,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x3c9b
-};
-
-const uint16_t bmp75[77]   = // Bitmap 75
+    0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8008,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8008,0xffff,0x0004,0xfdac,
+    0x0000,0x000c,0xb7ff,0x8008,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8008,0xffff,0x0004,0xfdac,0x0000,0x000c,
+    0xb7ff,0x8008,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0026,0xfff6,0x6000,0x0000,0x000c,0xb7ff,
+    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x000c,0xb7ff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
+    0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xfffb,0x91c0,0x0000,0x000c,
+    0xb7ff,0x8003,0xffff,0x0008,0xfdac,0x0000,0x000c,0xb7fb,0x91c0,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0007,0xfdac,
+    0x0000,0x0007,0x39c0,0x0000,0x0000,0x3c9b,0x8005,0xffff,0x0001,0xfdac,0x8005,0x0000,0x0002,0x000c,0xb7ff,0x8004,
+    0xffff,0x0008,0xfdac,0x0000,0x0000,0x000c,0xb7f6,0x6000,0x0000,0x0336,0x8004,0xffff,0x0009,0xfdac,0x0000,0x000c,
+    0xb7ff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0x8003,0xffff,0x001c,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xfffb,0x91c0,
+    0x0000,0x000c,0xb7ff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x3c9b,0xffff,
+    0xffff,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0009,0xdc87,0x0000,0x0007,0x96df,0xffff,0xfdac,0x0000,0x000c,
+    0xb7ff,0x8003,0xffff,0x0009,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0004,
+    0xfdac,0x0000,0x0000,0x3c9b
+};
+
+const uint16_t bmp75[78]   = // Bitmap 75 (RLE, 77 words raw)
 {
     0x0413, // Width and height
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df
+    0x004c,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,
+    0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,
+    0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,
+    0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,
+    0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df
 };
 
-const uint16_t bmp76[281]   = // Bitmap 76
+const uint16_t bmp76[254]   = // Bitmap 76 (RLE, 281 words raw)
 {
     0x140e, // Width and height
-    0xfdac,0x0000,0x000c,0xb7ff,0xfed2,0x3800,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0x9487,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,
-    0xfdac,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,
-    0xfdac,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,
-    0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff
-};
-
-const uint16_t bmp77[169]   = // Bitmap 77
+    0x000d,0xfdac,0x0000,0x000c,0xb7ff,0xfed2,0x3800,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xfdac,0x8003,0x0000,
+    0x0008,0x0007,0x96df,0xffff,0xffff,0xfdac,0x0000,0x000c,0x9487,0x8006,0x0000,0x0002,0x65bf,0xdc87,0x8006,0x0000,
+    0x0003,0x65bf,0xffff,0xfdac,0x8003,0x0000,0x0005,0x0336,0xffff,0xffff,0xfff6,0x6000,0x8003,0x0000,0x000c,0x3c9b,
+    0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xfdac,0x0000,0x0000,0x0336,0x8004,0xffff,0x0004,0xdc87,0x0000,
+    0x0000,0x0336,0x8004,0xffff,0x0008,0xdc87,0x0000,0x000c,0xb7ff,0xfdac,0x0000,0x0000,0x65bf,0x8004,0xffff,0x0004,
+    0xfdac,0x0000,0x0007,0x96df,0x8004,0xffff,0x0008,0xfdac,0x0000,0x000c,0xb7ff,0xfdac,0x0000,0x0007,0x96df,0x8004,
+    0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0008,0xfdac,0x0000,0x000c,0xb7ff,0xfdac,0x0000,0x000c,
+    0xb7ff,0x8004,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0008,0xfdac,0x0000,0x000c,0xb7ff,0xfdac,
+    0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0008,0xfdac,0x0000,0x000c,
+    0xb7ff,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0008,0xfdac,
+    0x0000,0x000c,0xb7ff,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,
+    0x0008,0xfdac,0x0000,0x000c,0xb7ff,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,
+    0x8004,0xffff,0x0008,0xfdac,0x0000,0x000c,0xb7ff,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0004,0xfdac,0x0000,
+    0x000c,0xb7ff,0x8004,0xffff,0x0008,0xfdac,0x0000,0x000c,0xb7ff,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0004,
+    0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0008,0xfdac,0x0000,0x000c,0xb7ff,0xfdac,0x0000,0x000c,0xb7ff,0x8004,
+    0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff
+};
+
+const uint16_t bmp77[146]   = // Bitmap 77 (RLE, 169 words raw)
 {
     0x0c0e, // Width and height
-    0xfed2,0x3800,0x000c,0xb7ff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xfed2,0x3800,0x000c,0x6320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,
-    0xfed2,0x3800,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x65bf,
-    0xfed2,0x3800,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,
-    0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336
-};
-
-const uint16_t bmp78[183]   = // Bitmap 78
+    0x0006,0xfed2,0x3800,0x000c,0xb7ff,0xfed2,0x3800,0x8003,0x0000,0x0007,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x000c,
+    0x6320,0x8006,0x0000,0x0007,0x0336,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0336,0x8003,0xffff,0x0008,0xb320,0x0000,
+    0x0000,0x65bf,0xfed2,0x3800,0x0000,0x0336,0x8004,0xffff,0x0008,0xfff6,0x6000,0x0000,0x3c9b,0xfed2,0x3800,0x0000,
+    0x65bf,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,
+    0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,
+    0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,
+    0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,
+    0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,
+    0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0003,0xb320,0x0000,
+    0x0336
+};
+
+const uint16_t bmp78[149]   = // Bitmap 78 (RLE, 183 words raw)
 {
     0x0d0e, // Width and height
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,
-    0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,
-    0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,
-    0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp79[248]   = // Bitmap 79
+    0x8003,0xffff,0x0001,0xfdac,0x8004,0x0000,0x0002,0x01d2,0xdfff,0x8004,0xffff,0x0002,0xfff6,0x6000,0x8007,0x0000,
+    0x0014,0x65bf,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,
+    0xffff,0xfdac,0x0000,0x0000,0x65bf,0x8004,0xffff,0x0008,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xb320,0x0000,0x0336,
+    0x8006,0xffff,0x0007,0xfdac,0x0000,0x0007,0x96df,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0007,0xfff6,0x6000,0x0000,
+    0x65bf,0x6000,0x0000,0x65bf,0x8006,0xffff,0x0007,0xfff6,0x6000,0x0000,0x65bf,0x6000,0x0000,0x65bf,0x8006,0xffff,
+    0x0007,0xfff6,0x6000,0x0000,0x65bf,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0008,0xfff6,0x6000,0x0000,0x65bf,0xb320,
+    0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0008,0xfdac,0x0000,0x0007,0x96df,0xfdac,0x0000,0x0000,0x65bf,0x8004,0xffff,
+    0x0015,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,
+    0x0007,0x96df,0xffff,0xffff,0xfff6,0x6000,0x8007,0x0000,0x0001,0x65bf,0x8005,0xffff,0x0001,0xfdac,0x8004,0x0000,
+    0x0001,0x0336,0x8004,0xffff
+};
+
+const uint16_t bmp79[198]   = // Bitmap 79 (RLE, 248 words raw)
 {
     0x0d13, // Width and height
-    0xfdac,0x0000,0x000c,0xb7ff,0xfed2,0x3800,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0x9487,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,
-    0xfdac,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xb320,0x0000,0x0000,0x65bf,0xffff,
-    0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,
-    0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x65bf,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,
-    0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,
-    0xfdac,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xb320,0x0000,0x0000,0x65bf,0xffff,
-    0xfdac,0x0000,0x000c,0x6320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xdc87,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp80[248]   = // Bitmap 80
+    0x000a,0xfdac,0x0000,0x000c,0xb7ff,0xfed2,0x3800,0x0000,0x0000,0x0007,0x96df,0x8003,0xffff,0x0004,0xfdac,0x0000,
+    0x000c,0x9487,0x8006,0x0000,0x0004,0x0336,0xffff,0xffff,0xfdac,0x8003,0x0000,0x000e,0x000c,0xb7ff,0xffff,0xffff,
+    0xb320,0x0000,0x0000,0x65bf,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0x8004,0xffff,0x0008,0xb320,0x0000,0x01d2,
+    0xdfff,0xfdac,0x0000,0x0000,0x65bf,0x8005,0xffff,0x0008,0xfed2,0x3800,0x0007,0x96df,0xfdac,0x0000,0x000c,0xb7ff,
+    0x8005,0xffff,0x0008,0xfffb,0x91c0,0x0000,0x65bf,0xfdac,0x0000,0x000c,0xb7ff,0x8005,0xffff,0x0008,0xfffb,0x91c0,
+    0x0000,0x3c9b,0xfdac,0x0000,0x000c,0xb7ff,0x8005,0xffff,0x0008,0xfffb,0x91c0,0x0000,0x3c9b,0xfdac,0x0000,0x000c,
+    0xb7ff,0x8005,0xffff,0x0008,0xfff6,0x6000,0x0000,0x65bf,0xfdac,0x0000,0x0000,0x65bf,0x8005,0xffff,0x0009,0xfed2,
+    0x3800,0x0007,0x96df,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0x8004,0xffff,0x0005,0xb320,0x0000,0x01d2,0xdfff,0xfdac,
+    0x8003,0x0000,0x000d,0x01d2,0xdfff,0xffff,0xffff,0xb320,0x0000,0x0000,0x65bf,0xffff,0xfdac,0x0000,0x000c,0x6320,
+    0x8006,0x0000,0x0008,0x3c9b,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xdc87,0x8003,0x0000,0x0002,0x01d2,0xdfff,
+    0x8003,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8009,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8009,0xffff,
+    0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8009,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8009,0xffff,0x0004,0xfdac,
+    0x0000,0x000c,0xb7ff,0x8009,0xffff
+};
+
+const uint16_t bmp80[196]   = // Bitmap 80 (RLE, 248 words raw)
 {
     0x0d13, // Width and height
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0336,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xb487,0x0000,0x01d2,0xdfff,
-    0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x01d2,0xdfff,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,
-    0x91c0,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,
-    0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,
-    0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xb320,0x0000,0x0007,0x96df,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x6327,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff
-};
-
-const uint16_t bmp81[127]   = // Bitmap 81
+    0x8003,0xffff,0x0001,0xb320,0x8003,0x0000,0x0009,0x0336,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xfed2,0x3800,
+    0x8005,0x0000,0x000d,0x01d2,0xb487,0x0000,0x01d2,0xdfff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xdc87,
+    0x8003,0x0000,0x0006,0x01d2,0xdfff,0xfdac,0x0000,0x0007,0x96df,0x8004,0xffff,0x0008,0xdc87,0x0000,0x0000,0x01d2,
+    0xdfff,0xb320,0x0000,0x0336,0x8005,0xffff,0x0008,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0x91c0,0x0000,0x65bf,0x8006,
+    0xffff,0x0007,0xb320,0x0000,0x01d2,0xdfff,0x6000,0x0000,0x65bf,0x8006,0xffff,0x0007,0xdc87,0x0000,0x01d2,0xdfff,
+    0x6000,0x0000,0x65bf,0x8006,0xffff,0x0007,0xdc87,0x0000,0x01d2,0xdfff,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0007,
+    0xb320,0x0000,0x01d2,0xdfff,0xb320,0x0000,0x0336,0x8005,0xffff,0x0009,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xfdac,
+    0x0000,0x0007,0x96df,0x8004,0xffff,0x000d,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xb320,0x0000,0x0007,0x96df,
+    0xffff,0xffff,0xfdac,0x8003,0x0000,0x0005,0x01d2,0xdfff,0xffff,0xfffb,0x91c0,0x8005,0x0000,0x0005,0x0007,0x6327,
+    0x0000,0x01d2,0xdfff,0x8003,0xffff,0x0001,0xfdac,0x8003,0x0000,0x0006,0x01d2,0xdfff,0xdc87,0x0000,0x01d2,0xdfff,
+    0x8009,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8009,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8009,0xffff,
+    0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8009,0xffff,0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x8009,0xffff,0x0004,0xdc87,
+    0x0000,0x01d2,0xdfff
+};
+
+const uint16_t bmp81[105]   = // Bitmap 81 (RLE, 127 words raw)
 {
     0x090e, // Width and height
-    0xfed2,0x3800,0x01d2,0xdff6,0x6000,0x0000,0x0000,0x000c,0xb7ff,
-    0xfed2,0x3800,0x01cc,0x61c0,0x0000,0x0000,0x0000,0x0336,0xffff,
-    0xfed2,0x3800,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfffb,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp82[169]   = // Bitmap 82
+    0x000d,0xfed2,0x3800,0x01d2,0xdff6,0x6000,0x0000,0x0000,0x000c,0xb7ff,0xfed2,0x3800,0x01cc,0x61c0,0x8003,0x0000,
+    0x0007,0x0336,0xffff,0xfed2,0x3800,0x0000,0x0000,0x65bf,0x8004,0xffff,0x0004,0xfed2,0x3800,0x0000,0x0336,0x8005,
+    0xffff,0x0004,0xfed2,0x3800,0x0000,0x65bf,0x8005,0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0004,
+    0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0004,0xfed2,0x3800,
+    0x0007,0x96df,0x8005,0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,
+    0x8004,0xffff,0x0005,0xfffb,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,0x8005,
+    0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff
+};
+
+const uint16_t bmp82[123]   = // Bitmap 82 (RLE, 169 words raw)
 {
     0x0c0e, // Width and height
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,
-    0xdc87,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,
-    0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xb320,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfdac,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,
-    0xdc87,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x3c9b,0xffff,
-    0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp83[153]   = // Bitmap 83
+    0x0003,0xffff,0xffff,0xdc87,0x8004,0x0000,0x0002,0x0007,0x96df,0x8003,0xffff,0x0002,0xfffb,0x91c0,0x8007,0x0000,
+    0x0007,0x0336,0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,0x8003,0xffff,0x0008,0xfdac,0x0000,0x0007,0x96df,0xffff,
+    0xb320,0x0000,0x0336,0x8009,0xffff,0x0004,0xb320,0x0000,0x000c,0xb7ff,0x8008,0xffff,0x0001,0xfdac,0x8004,0x0000,
+    0x0001,0x3c9b,0x8007,0xffff,0x0001,0xdc87,0x8006,0x0000,0x0001,0x0336,0x8006,0xffff,0x0001,0xfdac,0x8005,0x0000,
+    0x0002,0x0007,0x96df,0x8007,0xffff,0x0006,0xfff6,0x6000,0x0000,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0007,0xfdac,
+    0x0000,0x000c,0xb7ff,0x91c0,0x0000,0x3c9b,0x8005,0xffff,0x0008,0xfdac,0x0000,0x000c,0xb7ff,0xdc87,0x0000,0x0000,
+    0x65bf,0x8003,0xffff,0x0007,0xfed2,0x3800,0x0000,0x3c9b,0xffff,0xfffb,0x91c0,0x8007,0x0000,0x0002,0x01d2,0xdfff,
+    0x8003,0xffff,0x0001,0xfdac,0x8005,0x0000,0x0001,0x65bf,0x8003,0xffff
+};
+
+const uint16_t bmp83[133]   = // Bitmap 83 (RLE, 153 words raw)
 {
     0x0813, // Width and height
-    0xffff,0xffff,0xffff,0xfffb,0xb5bb,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xb320,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x000c,0xb7ff
-};
-
-const uint16_t bmp84[169]   = // Bitmap 84
+    0x8003,0xffff,0x0002,0xfffb,0xb5bb,0x8005,0xffff,0x0003,0xb320,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfffb,0x91c0,
+    0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,
+    0x8003,0xffff,0x0001,0xdc87,0x8005,0x0000,0x0003,0x01d2,0xdfff,0xdc87,0x8005,0x0000,0x0007,0x01d2,0xdfff,0xffff,
+    0xfffb,0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfffb,0x91c0,
+    0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,
+    0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8004,0xffff,
+    0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfffb,
+    0x91c0,0x0000,0x0336,0x8005,0xffff,0x0001,0xb320,0x8003,0x0000,0x000a,0x01d2,0xdfff,0xffff,0xffff,0xfffb,0x91c0,
+    0x0000,0x0000,0x000c,0xb7ff
+};
+
+const uint16_t bmp84[147]   = // Bitmap 84 (RLE, 169 words raw)
 {
     0x0c0e, // Width and height
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0336,
-    0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0336,
-    0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xb320,0x0000,0x0336,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xb320,0x0000,0x0336
-};
-
-const uint16_t bmp85[183]   = // Bitmap 85
+    0x0004,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,
+    0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,
+    0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,
+    0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,
+    0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,
+    0x0336,0xfed2,0x3800,0x0007,0x96df,0x8005,0xffff,0x0007,0xb320,0x0000,0x0336,0xfed2,0x3800,0x0007,0x96df,0x8004,
+    0xffff,0x0008,0xfffb,0x91c0,0x0000,0x0336,0xfff6,0x6000,0x0000,0x65bf,0x8004,0xffff,0x000c,0xfdac,0x0000,0x0000,
+    0x0336,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xfdac,0x8003,0x0000,0x0003,0x0336,0xffff,0xfdac,0x8006,
+    0x0000,0x0008,0x0336,0xb320,0x0000,0x0336,0xffff,0xffff,0xfff6,0x6000,0x8003,0x0000,0x0005,0x3c9b,0xffff,0xb320,
+    0x0000,0x0336
+};
+
+const uint16_t bmp85[151]   = // Bitmap 85 (RLE, 183 words raw)
 {
     0x0d0e, // Width and height
-    0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,
-    0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,
-    0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdc87,0x0000,0x0336,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7f6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x632c,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp86[267]   = // Bitmap 86
+    0x0004,0xdc87,0x0000,0x000c,0xb7ff,0x8005,0xffff,0x0008,0xfffb,0x91c0,0x0000,0x3c9b,0xfed2,0x3800,0x0000,0x65bf,
+    0x8005,0xffff,0x0008,0xfed2,0x3800,0x0007,0x96df,0xfffb,0x91c0,0x0000,0x0336,0x8005,0xffff,0x0009,0xdc87,0x0000,
+    0x01d2,0xdfff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x000a,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,
+    0xfff6,0x6000,0x0000,0x65bf,0x8003,0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,0x8003,0xffff,0x0003,0xb320,0x0000,
+    0x0336,0x8003,0xffff,0x0003,0xdc87,0x0000,0x0336,0x8004,0xffff,0x0009,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xfff6,
+    0x6000,0x0000,0x65bf,0x8004,0xffff,0x0009,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0x8005,
+    0xffff,0x0007,0xdc87,0x0000,0x0336,0xffff,0xb320,0x0000,0x0336,0x8006,0xffff,0x0007,0xfed2,0x3800,0x000c,0xb7f6,
+    0x6000,0x0000,0x65bf,0x8006,0xffff,0x0007,0xfffb,0x91c0,0x0000,0x632c,0x0000,0x01d2,0xdfff,0x8007,0xffff,0x0001,
+    0xdc87,0x8003,0x0000,0x0001,0x3c9b,0x8008,0xffff,0x0005,0xfed2,0x3800,0x0000,0x0007,0x96df,0x8009,0xffff,0x0004,
+    0xb320,0x0000,0x01d2,0xdfff,0x8004,0xffff
+};
+
+const uint16_t bmp86[250]   = // Bitmap 86 (RLE, 267 words raw)
 {
     0x130e, // Width and height
-    0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,
-    0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0007,0x96df,
-    0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xfdac,0x0000,0x01d2,0xdfff,
-    0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,0xffff,0xb320,0x0007,0x39c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xb320,0x0000,0x3c9b,0xffff,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xfff6,0x6000,0x000c,0xb5ac,0x0000,0x0336,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,
-    0xffff,0xfdac,0x0000,0x01d2,0xdfff,0xffff,0xfed2,0x3800,0x0336,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xffff,
-    0xffff,0xfff6,0x6000,0x0007,0x96df,0xffff,0xdc87,0x0000,0x3c9b,0xfff6,0x6000,0x0007,0x96df,0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xffff,0xb320,0x0000,0x3c9b,0xffff,0xb320,0x0007,0x96df,0xffff,0xb320,0x0000,0x3c9b,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0336,0xfff6,0x6000,0x000c,0xb7ff,0xffff,0xfdac,0x0000,0x0336,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x000c,0xb6d2,0x3800,0x0336,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb5ac,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xffff,0xfffb,0x91c0,0x0007,0x6327,0x0000,0x3c9b,0xffff,0xffff,0xfffb,0x91c0,0x0007,0x39c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp87[183]   = // Bitmap 87
+    0x0003,0x91c0,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x0336,0x8004,0xffff,0x0008,0xfffb,0x91c0,
+    0x0000,0x3c9b,0xdc87,0x0000,0x01d2,0xdfff,0x8003,0xffff,0x0005,0xfed2,0x3800,0x0000,0x000c,0xb7ff,0x8003,0xffff,
+    0x0008,0xfff6,0x6000,0x0007,0x96df,0xfed2,0x3800,0x0007,0x96df,0x8003,0xffff,0x0005,0xdc87,0x0000,0x0000,0x0007,
+    0x96df,0x8003,0xffff,0x0008,0xfdac,0x0000,0x01d2,0xdfff,0xfffb,0x91c0,0x0000,0x65bf,0x8003,0xffff,0x0005,0xb320,
+    0x0007,0x39c0,0x0000,0x3c9b,0x8003,0xffff,0x003b,0xb320,0x0000,0x3c9b,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,
+    0xffff,0xfff6,0x6000,0x000c,0xb5ac,0x0000,0x0336,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xfdac,
+    0x0000,0x01d2,0xdfff,0xffff,0xfed2,0x3800,0x0336,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,
+    0xffff,0xffff,0xfff6,0x6000,0x0007,0x96df,0xffff,0xdc87,0x0000,0x3c9b,0xfff6,0x6000,0x0007,0x96df,0xffff,0xdc87,
+    0x0000,0x0336,0x8004,0xffff,0x000f,0xb320,0x0000,0x3c9b,0xffff,0xb320,0x0007,0x96df,0xffff,0xb320,0x0000,0x3c9b,
+    0xfffb,0x91c0,0x0000,0x65bf,0x8004,0xffff,0x000f,0xdc87,0x0000,0x0336,0xfff6,0x6000,0x000c,0xb7ff,0xffff,0xfdac,
+    0x0000,0x0336,0xfed2,0x3800,0x000c,0xb7ff,0x8004,0xffff,0x000f,0xfed2,0x3800,0x000c,0xb6d2,0x3800,0x0336,0xffff,
+    0xffff,0xfed2,0x3800,0x000c,0xb5ac,0x0000,0x01d2,0xdfff,0x8004,0xffff,0x000e,0xfffb,0x91c0,0x0007,0x6327,0x0000,
+    0x3c9b,0xffff,0xffff,0xfffb,0x91c0,0x0007,0x39c0,0x0000,0x3c9b,0x8006,0xffff,0x0005,0xdc87,0x0000,0x0000,0x0007,
+    0x96df,0x8003,0xffff,0x0005,0xb320,0x0000,0x0000,0x0007,0x96df,0x8006,0xffff,0x0005,0xfdac,0x0000,0x0000,0x000c,
+    0xb7ff,0x8003,0xffff,0x0005,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0x8006,0xffff,0x0004,0xfff6,0x6000,0x0000,0x0336,
+    0x8004,0xffff,0x0004,0xfed2,0x3800,0x0000,0x3c9b,0x8004,0xffff
+};
+
+const uint16_t bmp87[156]   = // Bitmap 87 (RLE, 183 words raw)
 {
     0x0d0e, // Width and height
-    0xfed2,0x3800,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0007,0x96df,
-    0xffff,0xdc87,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x948c,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,0xfed2,0x3800,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xfed2,0x3800,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xb320,0x0000,0x0007,0x96df,0xffff,
-    0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,
-    0xdc87,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x3c9b
-};
-
-const uint16_t bmp88[248]   = // Bitmap 88
+    0x0004,0xfed2,0x3800,0x0000,0x0336,0x8005,0xffff,0x0009,0xb320,0x0000,0x0007,0x96df,0xffff,0xdc87,0x0000,0x0000,
+    0x65bf,0x8003,0xffff,0x0004,0xfdac,0x0000,0x0000,0x65bf,0x8003,0xffff,0x0009,0xb320,0x0000,0x000c,0xb7ff,0xffff,
+    0xfff6,0x6000,0x0000,0x0336,0x8004,0xffff,0x0009,0xfff6,0x6000,0x0000,0x0336,0xffff,0xb320,0x0000,0x000c,0xb7ff,
+    0x8005,0xffff,0x0007,0xfdac,0x0000,0x0007,0x948c,0x0000,0x0000,0x65bf,0x8007,0xffff,0x0001,0xb320,0x8003,0x0000,
+    0x0001,0x3c9b,0x8008,0xffff,0x0005,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0001,0xdc87,0x8003,0x0000,
+    0x0001,0x65bf,0x8007,0xffff,0x0002,0xfed2,0x3800,0x8003,0x0000,0x0002,0x0007,0x96df,0x8005,0xffff,0x0009,0xfffb,
+    0x91c0,0x0000,0x01d2,0xdffb,0x91c0,0x0000,0x01d2,0xdfff,0x8004,0xffff,0x0009,0xdc87,0x0000,0x0007,0x96df,0xffff,
+    0xfed2,0x3800,0x0000,0x3c9b,0x8003,0xffff,0x0004,0xfed2,0x3800,0x0000,0x3c9b,0x8003,0xffff,0x000a,0xb320,0x0000,
+    0x0007,0x96df,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0x8003,0xffff,0x0009,0xfff6,0x6000,0x0000,0x01d2,0xdfff,
+    0xdc87,0x0000,0x0000,0x65bf,0x8005,0xffff,0x0004,0xfdac,0x0000,0x0000,0x3c9b
+};
+
+const uint16_t bmp88[187]   = // Bitmap 88 (RLE, 248 words raw)
 {
     0x0d13, // Width and height
-    0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,
-    0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0007,0x96df,
-    0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x01d2,0xdfff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfff6,0x6000,0x0007,0x96d6,0x6000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x3b2c,0x3800,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp89[183]   = // Bitmap 89
+    0x0004,0xdc87,0x0000,0x000c,0xb7ff,0x8006,0xffff,0x0007,0xb320,0x0000,0x0336,0xfff6,0x6000,0x0000,0x65bf,0x8005,
+    0xffff,0x0009,0xfff6,0x6000,0x0007,0x96df,0xffff,0xb320,0x0000,0x01d2,0xdfff,0x8004,0xffff,0x0009,0xdc87,0x0000,
+    0x01d2,0xdfff,0xffff,0xfdac,0x0000,0x0007,0x96df,0x8003,0xffff,0x000a,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,
+    0xfffb,0x91c0,0x0000,0x3c9b,0x8003,0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,0x8003,0xffff,0x0009,0xdc87,0x0000,
+    0x01d2,0xdfff,0xffff,0xffff,0xdc87,0x0000,0x0336,0x8004,0xffff,0x0009,0xfed2,0x3800,0x0007,0x96df,0xffff,0xfffb,
+    0x91c0,0x0000,0x65bf,0x8004,0xffff,0x0009,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0x8005,
+    0xffff,0x0007,0xfdac,0x0000,0x01d2,0xdfff,0xb320,0x0000,0x0336,0x8006,0xffff,0x0007,0xfff6,0x6000,0x0007,0x96d6,
+    0x6000,0x0007,0x96df,0x8007,0xffff,0x0006,0xb320,0x0000,0x3b2c,0x3800,0x01d2,0xdfff,0x8007,0xffff,0x0005,0xfed2,
+    0x3800,0x0000,0x0000,0x3c9b,0x8008,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x0007,0x96df,0x8009,0xffff,0x0003,0xdc87,
+    0x0000,0x0336,0x8009,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x65bf,0x8009,0xffff,0x0004,0xfed2,0x3800,0x000c,0xb7ff,
+    0x8008,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8007,0xffff,0x0001,0xdc87,0x8003,0x0000,0x0002,0x000c,0xb7ff,
+    0x8007,0xffff,0x0005,0xdc87,0x0000,0x0000,0x01d2,0xdfff,0x8007,0xffff
+};
+
+const uint16_t bmp89[102]   = // Bitmap 89 (RLE, 183 words raw)
 {
     0x0d0e, // Width and height
-    0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xfed2,0x3800,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,
-    0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df
-};
-
-const uint16_t bmp93[57]   = // Bitmap 93
+    0x0002,0xfffb,0x91c0,0x8009,0x0000,0x0004,0x01d2,0xdfff,0xfffb,0x91c0,0x8009,0x0000,0x0002,0x01d2,0xdfff,0x8008,
+    0xffff,0x0004,0xdc87,0x0000,0x0007,0x96df,0x8008,0xffff,0x0004,0xfdac,0x0000,0x0000,0x65bf,0x8008,0xffff,0x0004,
+    0xfed2,0x3800,0x0000,0x3c9b,0x8008,0xffff,0x0004,0xfff6,0x6000,0x0000,0x0336,0x8008,0xffff,0x0005,0xfffb,0x91c0,
+    0x0000,0x01d2,0xdfff,0x8008,0xffff,0x0004,0xb320,0x0000,0x000c,0xb7ff,0x8008,0xffff,0x0004,0xdc87,0x0000,0x0007,
+    0x96df,0x8008,0xffff,0x0004,0xfdac,0x0000,0x0000,0x65bf,0x8008,0xffff,0x0004,0xfed2,0x3800,0x0000,0x3c9b,0x8008,
+    0xffff,0x0004,0xfff6,0x6000,0x0000,0x0336,0x8009,0xffff,0x0001,0xdc87,0x800a,0x0000,0x0003,0x0007,0x96df,0xdc87,
+    0x800a,0x0000,0x0002,0x0007,0x96df
+};
+
+const uint16_t bmp93[58]   = // Bitmap 93 (RLE, 57 words raw)
 {
     0x0807, // Width and height
-    0xffff,0xffff,0xb320,0x0000,0x0000,0x000c,0xb7ff,0xffff,
-    0xfffb,0x91c0,0x01d2,0xdfff,0xffff,0xdc87,0x000c,0xb7ff,
-    0xfed2,0x3807,0x96df,0xffff,0xffff,0xfffb,0x91c0,0x3c9b,
-    0xfdac,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xb320,0x0336,
-    0xfed2,0x3807,0x96df,0xffff,0xffff,0xfffb,0x91c0,0x3c9b,
-    0xffff,0xb320,0x01d2,0xdfff,0xffff,0xdc87,0x000c,0xb7ff,
-    0xffff,0xffff,0xb320,0x0000,0x0000,0x000c,0xb7ff,0xffff
+    0x001b,0xffff,0xffff,0xb320,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xfffb,0x91c0,0x01d2,0xdfff,0xffff,0xdc87,0x000c,
+    0xb7ff,0xfed2,0x3807,0x96df,0xffff,0xffff,0xfffb,0x91c0,0x3c9b,0xfdac,0x000c,0xb7ff,0x8003,0xffff,0x001a,0xb320,
+    0x0336,0xfed2,0x3807,0x96df,0xffff,0xffff,0xfffb,0x91c0,0x3c9b,0xffff,0xb320,0x01d2,0xdfff,0xffff,0xdc87,0x000c,
+    0xb7ff,0xffff,0xffff,0xb320,0x0000,0x0000,0x000c,0xb7ff,0xffff
 };
 
-const uint16_t bmp107[26]   = // Bitmap 107
+const uint16_t bmp107[3]   = // Bitmap 107 (RLE, 26 words raw)
 {
     0x0505, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000
+    0x8019,0x0000
 };
 
-const uint16_t bmp109[401]   = // Bitmap 109
+const uint16_t bmp109[245]   = // Bitmap 109 (RLE, 401 words raw)
 {
     0x1019, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xe71c,0xa534,0x6b4d,0x0000,0x0000,0x6b4d,0xa534,0xe71c,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,
-    0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,
-    0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,
-    0xf79e,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xf79e,
-    0xd69a,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0xa534,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0xb596,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0xa534,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0xb596,
-    0xc638,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0xef5d,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xf79e,
-    0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,
-    0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,
-    0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xf79e,0xa534,0x6b4d,0x0000,0x0000,0x6b4d,0xa534,0xe71c,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp110[276]   = // Bitmap 110
+    0x8004,0xffff,0x0008,0xe71c,0xa534,0x6b4d,0x0000,0x0000,0x6b4d,0xa534,0xe71c,0x8007,0xffff,0x0001,0xb596,0x8008,
+    0x0000,0x0001,0xb596,0x8005,0xffff,0x0001,0xb596,0x800a,0x0000,0x0001,0xb596,0x8003,0xffff,0x0001,0xe71c,0x800c,
+    0x0000,0x0004,0xe71c,0xffff,0xffff,0x8c71,0x8004,0x0000,0x0004,0xa534,0xffff,0xffff,0xa534,0x8004,0x0000,0x0003,
+    0x8c71,0xffff,0xf79e,0x8004,0x0000,0x0001,0x7bef,0x8004,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0002,0xf79e,0xd69a,
+    0x8004,0x0000,0x0001,0xbdf7,0x8004,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0002,0xd69a,0xa534,0x8004,0x0000,0x0001,
+    0xe71c,0x8004,0xffff,0x0001,0xe71c,0x8004,0x0000,0x0002,0xb596,0x8c71,0x8004,0x0000,0x0001,0xef5d,0x8004,0xffff,
+    0x0001,0xef5d,0x8004,0x0000,0x0002,0x8c71,0x6b4d,0x8004,0x0000,0x8006,0xffff,0x8004,0x0000,0x0001,0x6b4d,0x8005,
+    0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,
+    0x0000,0x8006,0xffff,0x8005,0x0000,0x0001,0x6b4d,0x8004,0x0000,0x8006,0xffff,0x8004,0x0000,0x0002,0x6b4d,0x8c71,
+    0x8004,0x0000,0x0001,0xef5d,0x8004,0xffff,0x0001,0xef5d,0x8004,0x0000,0x0002,0x8c71,0xa534,0x8004,0x0000,0x0001,
+    0xe71c,0x8004,0xffff,0x0001,0xe71c,0x8004,0x0000,0x0002,0xb596,0xc638,0x8004,0x0000,0x0001,0xc638,0x8004,0xffff,
+    0x0001,0xbdf7,0x8004,0x0000,0x0002,0xd69a,0xef5d,0x8004,0x0000,0x0001,0x6b4d,0x8004,0xffff,0x0001,0x7bef,0x8004,
+    0x0000,0x0003,0xf79e,0xffff,0x7bef,0x8004,0x0000,0x0004,0xa534,0xffff,0xffff,0xa534,0x8004,0x0000,0x0004,0x8c71,
+    0xffff,0xffff,0xdedb,0x800c,0x0000,0x0001,0xe71c,0x8003,0xffff,0x0001,0xa534,0x800a,0x0000,0x0001,0xb596,0x8005,
+    0xffff,0x0001,0xb596,0x8008,0x0000,0x0001,0xb596,0x8007,0xffff,0x0008,0xf79e,0xa534,0x6b4d,0x0000,0x0000,0x6b4d,
+    0xa534,0xe71c,0x8004,0xffff
+};
+
+const uint16_t bmp110[120]   = // Bitmap 110 (RLE, 276 words raw)
 {
     0x0b19, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xef5d,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xf79e,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x7bef,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x4a69,0xbdf7,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6b4d,0xc638,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t bmp111[401]   = // Bitmap 111
+    0x8006,0xffff,0x0001,0xf79e,0x8004,0x0000,0x8006,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x8005,0xffff,0x0001,0xc638,
+    0x8005,0x0000,0x8004,0xffff,0x0001,0xb596,0x8006,0x0000,0x0004,0xffff,0xffff,0xef5d,0x7bef,0x8007,0x0000,0x0002,
+    0xf79e,0xa534,0x800e,0x0000,0x0001,0x4a69,0x8009,0x0000,0x0002,0x7bef,0xef5d,0x8007,0x0000,0x0004,0x4a69,0xbdf7,
+    0xffff,0xffff,0x8005,0x0000,0x0002,0x6b4d,0xc638,0x8004,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,
+    0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,
+    0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,
+    0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,
+    0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000
+};
+
+const uint16_t bmp111[206]   = // Bitmap 111 (RLE, 401 words raw)
 {
     0x1019, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x8c71,0x0000,0x0000,0x0000,0x7bef,0xa534,0xf79e,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdedb,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,
-    0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,
-    0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x4a69,0xe71c,0xffff,0xe71c,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xa534,
-    0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x4a69,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xbdf7,0x9cd3,0x8c71,0x7bef,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x7bef,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xb596,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0xf79e,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t bmp112[401]   = // Bitmap 112
+    0x8005,0xffff,0x0002,0xc638,0x8c71,0x8003,0x0000,0x0003,0x7bef,0xa534,0xf79e,0x8006,0xffff,0x0002,0xdedb,0x4a69,
+    0x8008,0x0000,0x0001,0xb596,0x8004,0xffff,0x0001,0xe71c,0x800b,0x0000,0x0001,0xb596,0x8003,0xffff,0x0001,0x6b4d,
+    0x800c,0x0000,0x0003,0xe71c,0xffff,0xd69a,0x8004,0x0000,0x0005,0x4a69,0xe71c,0xffff,0xe71c,0x6b4d,0x8004,0x0000,
+    0x0003,0xa534,0xffff,0x9cd3,0x8004,0x0000,0x0001,0xbdf7,0x8003,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0003,0x4a69,
+    0xffff,0x6b4d,0x8004,0x0000,0x0001,0xef5d,0x8004,0xffff,0x8005,0x0000,0x0006,0xffff,0xbdf7,0x9cd3,0x8c71,0x7bef,
+    0x0000,0x8005,0xffff,0x8005,0x0000,0x800a,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0001,0x7bef,0x800a,0xffff,0x0001,
+    0xbdf7,0x8004,0x0000,0x0001,0xb596,0x8009,0xffff,0x0002,0xef5d,0x4a69,0x8004,0x0000,0x0001,0xf79e,0x8009,0xffff,
+    0x0001,0x7bef,0x8004,0x0000,0x0001,0xa534,0x8009,0xffff,0x0001,0x7bef,0x8004,0x0000,0x0001,0x4a69,0x8009,0xffff,
+    0x0001,0x7bef,0x8005,0x0000,0x0001,0xef5d,0x8008,0xffff,0x0001,0x7bef,0x8004,0x0000,0x0002,0x4a69,0xd69a,0x8008,
+    0xffff,0x0001,0xa534,0x8004,0x0000,0x0002,0x4a69,0xef5d,0x8008,0xffff,0x0001,0xa534,0x8004,0x0000,0x0002,0x6b4d,
+    0xef5d,0x8008,0xffff,0x0001,0xb596,0x8004,0x0000,0x0001,0x7bef,0x8009,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0001,
+    0x7bef,0x8009,0xffff,0x0002,0xf79e,0x4a69,0x8003,0x0000,0x0002,0x4a69,0xf79e,0x8009,0xffff,0x0001,0xa534,0x800e,
+    0x0000,0x0001,0xf79e,0x800f,0x0000,0x0001,0xc638,0x800f,0x0000,0x0001,0x8c71,0x801f,0x0000
+};
+
+const uint16_t bmp112[239]   = // Bitmap 112 (RLE, 401 words raw)
 {
     0x1019, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xf79e,0xa534,0x7bef,0x0000,0x0000,0x4a69,0x9cd3,0xe71c,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,
-    0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,
-    0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xf79e,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,
-    0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xc638,0xbdf7,0x9cd3,0x8c71,0x0000,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x7bef,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x6b4d,0xe71c,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x4a69,0xa534,0xf79e,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0xffff,0xe71c,0x4a69,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xb596,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xbdf7,0xbdf7,0x8c71,0x8c71,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0xa534,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xa534,
-    0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,
-    0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xe71c,0x9cd3,0x6b4d,0x0000,0x0000,0x6b4d,0xa534,0xe71c,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp113[451]   = // Bitmap 113
+    0x8004,0xffff,0x0008,0xf79e,0xa534,0x7bef,0x0000,0x0000,0x4a69,0x9cd3,0xe71c,0x8007,0xffff,0x0001,0xbdf7,0x8008,
+    0x0000,0x0001,0xa534,0x8005,0xffff,0x0001,0xbdf7,0x800a,0x0000,0x0001,0x9cd3,0x8003,0xffff,0x0001,0xf79e,0x800c,
+    0x0000,0x0004,0xd69a,0xffff,0xffff,0xb596,0x8004,0x0000,0x0004,0x6b4d,0xf79e,0xffff,0xa534,0x8004,0x0000,0x0004,
+    0x7bef,0xffff,0xffff,0x7bef,0x8004,0x0000,0x0001,0xdedb,0x8003,0xffff,0x8005,0x0000,0x0007,0xffff,0xffff,0xc638,
+    0xbdf7,0x9cd3,0x8c71,0x0000,0x8004,0xffff,0x8005,0x0000,0x800a,0xffff,0x0001,0xef5d,0x8004,0x0000,0x0001,0x9cd3,
+    0x8009,0xffff,0x0002,0xf79e,0x7bef,0x8004,0x0000,0x0001,0xe71c,0x8008,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,
+    0xd69a,0x8009,0xffff,0x0001,0x8c71,0x8003,0x0000,0x0002,0x6b4d,0xe71c,0x800a,0xffff,0x0001,0x7bef,0x8003,0x0000,
+    0x0003,0x4a69,0xa534,0xf79e,0x8009,0xffff,0x8006,0x0000,0x0002,0x4a69,0xef5d,0x8008,0xffff,0x0004,0xef5d,0xffff,
+    0xe71c,0x4a69,0x8003,0x0000,0x0001,0x4a69,0x800b,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0001,0xb596,0x800a,0xffff,
+    0x0001,0xf79e,0x8004,0x0000,0x0001,0x6b4d,0x800b,0xffff,0x8005,0x0000,0x0005,0xbdf7,0xbdf7,0x8c71,0x8c71,0x0000,
+    0x8006,0xffff,0x8005,0x0000,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xdedb,0x8004,0xffff,0x0001,0xef5d,0x8004,0x0000,
+    0x0002,0x6b4d,0xa534,0x8004,0x0000,0x0001,0x8c71,0x8004,0xffff,0x0001,0xa534,0x8004,0x0000,0x0002,0xa534,0xe71c,
+    0x8005,0x0000,0x0004,0xa534,0xffff,0xffff,0xbdf7,0x8005,0x0000,0x0003,0xe71c,0xffff,0x9cd3,0x800c,0x0000,0x0001,
+    0xa534,0x8003,0xffff,0x0001,0x7bef,0x800a,0x0000,0x0001,0x7bef,0x8005,0xffff,0x0001,0x8c71,0x8008,0x0000,0x0001,
+    0x9cd3,0x8007,0xffff,0x0008,0xe71c,0x9cd3,0x6b4d,0x0000,0x0000,0x6b4d,0xa534,0xe71c,0x8004,0xffff
+};
+
+const uint16_t bmp113[167]   = // Bitmap 113 (RLE, 451 words raw)
 {
     0x1219, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x6b4d,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0x9cd3,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp114[401]   = // Bitmap 114
+    0x800a,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x800c,0xffff,0x0001,0xdedb,0x8005,0x0000,0x800c,0xffff,0x0001,0x4a69,
+    0x8005,0x0000,0x800b,0xffff,0x0001,0x9cd3,0x8006,0x0000,0x800a,0xffff,0x0001,0xdedb,0x8007,0x0000,0x800a,0xffff,
+    0x0001,0x4a69,0x8007,0x0000,0x8009,0xffff,0x0001,0x9cd3,0x8008,0x0000,0x8008,0xffff,0x0001,0xdedb,0x8009,0x0000,
+    0x8008,0xffff,0x0001,0x4a69,0x8003,0x0000,0x0001,0xb596,0x8005,0x0000,0x8007,0xffff,0x0001,0x9cd3,0x8003,0x0000,
+    0x0002,0x6b4d,0xffff,0x8005,0x0000,0x8006,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0002,0xe71c,0xffff,0x8005,0x0000,
+    0x8006,0xffff,0x0001,0x4a69,0x8003,0x0000,0x0003,0xb596,0xffff,0xffff,0x8005,0x0000,0x8005,0xffff,0x0001,0x9cd3,
+    0x8003,0x0000,0x0001,0x6b4d,0x8003,0xffff,0x8005,0x0000,0x8004,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0001,0xe71c,
+    0x8003,0xffff,0x8005,0x0000,0x8004,0xffff,0x0001,0x4a69,0x8003,0x0000,0x0001,0xb596,0x8004,0xffff,0x8005,0x0000,
+    0x8003,0xffff,0x0001,0x9cd3,0x8003,0x0000,0x0001,0x6b4d,0x8005,0xffff,0x8005,0x0000,0x8003,0xffff,0x8048,0x0000,
+    0x800a,0xffff,0x8005,0x0000,0x800d,0xffff,0x8005,0x0000,0x800d,0xffff,0x8005,0x0000,0x800d,0xffff,0x8005,0x0000,
+    0x800d,0xffff,0x8005,0x0000,0x8003,0xffff
+};
+
+const uint16_t bmp114[218]   = // Bitmap 114 (RLE, 401 words raw)
 {
     0x1019, // Width and height
-    0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xbdf7,0x7bef,0x0000,0x0000,0x9cd3,0xe71c,0xffff,0xffff,0xffff,
-    0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,
-    0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xf79e,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0xffff,0xbdf7,0xb596,0x8c71,0x6b4d,0x8c71,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x9cd3,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xbdf7,0xb596,0x8c71,0x8c71,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0xa534,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xc638,
-    0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,
-    0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x4a69,0x0000,0x0000,0x6b4d,0xa534,0xef5d,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp115[401]   = // Bitmap 115
+    0x8003,0xffff,0x0001,0xf79e,0x800b,0x0000,0x8004,0xffff,0x0001,0xdedb,0x800b,0x0000,0x8004,0xffff,0x0001,0xb596,
+    0x800b,0x0000,0x8004,0xffff,0x0001,0x8c71,0x800b,0x0000,0x8004,0xffff,0x800c,0x0000,0x8003,0xffff,0x0001,0xe71c,
+    0x8004,0x0000,0x0001,0x6b4d,0x800a,0xffff,0x0001,0xc638,0x8004,0x0000,0x0001,0xa534,0x800a,0xffff,0x0001,0x9cd3,
+    0x8004,0x0000,0x0001,0xc638,0x800a,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0006,0xbdf7,0x7bef,0x0000,0x0000,0x9cd3,
+    0xe71c,0x8004,0xffff,0x0001,0xf79e,0x800b,0x0000,0x0001,0xd69a,0x8003,0xffff,0x0001,0xd69a,0x800c,0x0000,0x0004,
+    0xdedb,0xffff,0xffff,0xb596,0x800c,0x0000,0x0004,0x4a69,0xffff,0xffff,0x7bef,0x8004,0x0000,0x0004,0x9cd3,0xf79e,
+    0xffff,0xc638,0x8005,0x0000,0x0007,0xd69a,0xffff,0xbdf7,0xb596,0x8c71,0x6b4d,0x8c71,0x8004,0xffff,0x0001,0xbdf7,
+    0x8004,0x0000,0x0001,0x9cd3,0x800a,0xffff,0x0001,0xef5d,0x8004,0x0000,0x0001,0x6b4d,0x800b,0xffff,0x8005,0x0000,
+    0x800b,0xffff,0x8005,0x0000,0x0005,0xbdf7,0xb596,0x8c71,0x8c71,0x0000,0x8006,0xffff,0x8005,0x0000,0x0001,0x6b4d,
+    0x8004,0x0000,0x0001,0xdedb,0x8004,0xffff,0x0001,0xe71c,0x8004,0x0000,0x0002,0x8c71,0xa534,0x8004,0x0000,0x0001,
+    0x8c71,0x8004,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x0002,0xc638,0xe71c,0x8005,0x0000,0x0004,0xa534,0xffff,0xffff,
+    0xbdf7,0x8004,0x0000,0x0004,0x4a69,0xffff,0xffff,0x8c71,0x800c,0x0000,0x0001,0xc638,0x8003,0xffff,0x0001,0x6b4d,
+    0x800a,0x0000,0x0001,0xa534,0x8005,0xffff,0x0001,0x7bef,0x8008,0x0000,0x0001,0xb596,0x8007,0xffff,0x0008,0xd69a,
+    0x9cd3,0x4a69,0x0000,0x0000,0x6b4d,0xa534,0xef5d,0x8004,0xffff
+};
+
+const uint16_t bmp115[261]   = // Bitmap 115 (RLE, 401 words raw)
 {
     0x1019, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x8c71,0x0000,0x0000,0x4a69,0x9cd3,0xe71c,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,
-    0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,
-    0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xf79e,0x7bef,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,
-    0xdedb,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0x0000,0x7bef,0x8c71,0xa534,0xbdf7,0xffff,
-    0xbdf7,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x8c71,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x7bef,0x0000,0x0000,0x0000,0x8c71,0xffff,0xd69a,0x7bef,0x0000,0x0000,0x7bef,0xbdf7,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x7bef,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x9cd3,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x4a69,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xb596,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xd69a,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x9cd3,
-    0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xa534,0xf79e,0xffff,0xd69a,0x4a69,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,
-    0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,
-    0xffff,0xffff,0xffff,0xdedb,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xef5d,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x7bef,0x0000,0x0000,0x4a69,0x9cd3,0xd69a,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp116[401]   = // Bitmap 116
+    0x8005,0xffff,0x0007,0xc638,0x8c71,0x0000,0x0000,0x4a69,0x9cd3,0xe71c,0x8007,0xffff,0x0002,0xef5d,0x4a69,0x8007,
+    0x0000,0x0001,0xa534,0x8005,0xffff,0x0001,0xe71c,0x800a,0x0000,0x0001,0xbdf7,0x8004,0xffff,0x0001,0x4a69,0x800b,
+    0x0000,0x0004,0xf79e,0xffff,0xffff,0xa534,0x8004,0x0000,0x0004,0xc638,0xffff,0xf79e,0x7bef,0x8004,0x0000,0x0004,
+    0xb596,0xffff,0xffff,0x4a69,0x8003,0x0000,0x0001,0xa534,0x8003,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0003,0x7bef,
+    0xffff,0xdedb,0x8004,0x0000,0x0001,0xe71c,0x8004,0xffff,0x0007,0x0000,0x7bef,0x8c71,0xa534,0xbdf7,0xffff,0xbdf7,
+    0x8004,0x0000,0x800b,0xffff,0x0001,0x8c71,0x8003,0x0000,0x0001,0x7bef,0x800b,0xffff,0x0001,0x7bef,0x8003,0x0000,
+    0x0008,0x8c71,0xffff,0xd69a,0x7bef,0x0000,0x0000,0x7bef,0xbdf7,0x8004,0xffff,0x8004,0x0000,0x0002,0x7bef,0x7bef,
+    0x8006,0x0000,0x0004,0x4a69,0xef5d,0xffff,0xffff,0x800d,0x0000,0x0003,0x4a69,0xef5d,0xffff,0x800e,0x0000,0x0002,
+    0x6b4d,0xffff,0x8006,0x0000,0x0004,0xc638,0xffff,0xffff,0xc638,0x8005,0x0000,0x0001,0xd69a,0x8005,0x0000,0x0001,
+    0xbdf7,0x8004,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0002,0x9cd3,0x6b4d,0x8004,0x0000,0x0001,0xf79e,0x8004,0xffff,
+    0x0001,0xef5d,0x8004,0x0000,0x0002,0x4a69,0x8c71,0x8004,0x0000,0x8006,0xffff,0x8005,0x0000,0x0001,0xb596,0x8004,
+    0x0000,0x8006,0xffff,0x8005,0x0000,0x0001,0xd69a,0x8004,0x0000,0x0001,0xe71c,0x8004,0xffff,0x0001,0xf79e,0x8004,
+    0x0000,0x0002,0x6b4d,0xffff,0x8004,0x0000,0x0001,0x9cd3,0x8004,0xffff,0x0001,0xc638,0x8004,0x0000,0x0003,0x9cd3,
+    0xffff,0xa534,0x8004,0x0000,0x0005,0xa534,0xf79e,0xffff,0xd69a,0x4a69,0x8004,0x0000,0x0004,0xd69a,0xffff,0xf79e,
+    0x4a69,0x800b,0x0000,0x0001,0x7bef,0x8003,0xffff,0x0001,0xd69a,0x800a,0x0000,0x0002,0x4a69,0xef5d,0x8004,0xffff,
+    0x0002,0xdedb,0x4a69,0x8007,0x0000,0x0002,0x7bef,0xef5d,0x8007,0xffff,0x0007,0xbdf7,0x7bef,0x0000,0x0000,0x4a69,
+    0x9cd3,0xd69a,0x8004,0xffff
+};
+
+const uint16_t bmp116[156]   = // Bitmap 116 (RLE, 401 words raw)
 {
     0x1019, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x9cd3,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp117[401]   = // Bitmap 117
+    0x804f,0x0000,0x0001,0xa534,0x800a,0xffff,0x0001,0xa534,0x8003,0x0000,0x0001,0x9cd3,0x800a,0xffff,0x0001,0xd69a,
+    0x8003,0x0000,0x0001,0x4a69,0x800a,0xffff,0x0002,0xf79e,0x4a69,0x8003,0x0000,0x0001,0xdedb,0x800a,0xffff,0x0001,
+    0x8c71,0x8003,0x0000,0x0001,0x8c71,0x800a,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0xef5d,0x800a,0xffff,0x0001,
+    0x6b4d,0x8003,0x0000,0x0001,0xa534,0x800a,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0001,0xf79e,0x800a,0xffff,0x0001,
+    0x6b4d,0x8003,0x0000,0x0001,0x8c71,0x800a,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0xdedb,0x800a,0xffff,0x0001,
+    0x7bef,0x8003,0x0000,0x0001,0x4a69,0x800a,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0001,0xa534,0x800a,0xffff,0x0001,
+    0xc638,0x8004,0x0000,0x0001,0xdedb,0x800a,0xffff,0x0001,0x7bef,0x8004,0x0000,0x800b,0xffff,0x8004,0x0000,0x0001,
+    0x7bef,0x800a,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0001,0xb596,0x800a,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0001,
+    0xc638,0x800a,0xffff,0x0001,0x8c71,0x8004,0x0000,0x0001,0xe71c,0x800a,0xffff,0x0001,0x8c71,0x8004,0x0000,0x0001,
+    0xf79e,0x800a,0xffff,0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x8008,0xffff
+};
+
+const uint16_t bmp117[263]   = // Bitmap 117 (RLE, 401 words raw)
 {
     0x1019, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xdedb,0x9cd3,0x4a69,0x0000,0x0000,0x6b4d,0x9cd3,0xe71c,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,
-    0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,
-    0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,
-    0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdedb,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xdedb,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf79e,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xef5d,0xffff,0xffff,
-    0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xdedb,0xffff,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,
-    0xb596,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0xa534,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x7bef,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x7bef,
-    0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,
-    0xffff,0xffff,0xe71c,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xe71c,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x6b4d,0x0000,0x0000,0x4a69,0x8c71,0xc638,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp118[401]   = // Bitmap 118
+    0x8004,0xffff,0x0008,0xdedb,0x9cd3,0x4a69,0x0000,0x0000,0x6b4d,0x9cd3,0xe71c,0x8007,0xffff,0x0001,0x8c71,0x8008,
+    0x0000,0x0001,0x9cd3,0x8005,0xffff,0x0001,0x8c71,0x800a,0x0000,0x0001,0x9cd3,0x8003,0xffff,0x0001,0xd69a,0x800c,
+    0x0000,0x0004,0xd69a,0xffff,0xffff,0x9cd3,0x8004,0x0000,0x0004,0x7bef,0xffff,0xffff,0x7bef,0x8004,0x0000,0x0004,
+    0x9cd3,0xffff,0xffff,0x4a69,0x8004,0x0000,0x0004,0xef5d,0xffff,0xffff,0xef5d,0x8004,0x0000,0x0003,0x4a69,0xffff,
+    0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x0003,0xffff,0xffff,0x4a69,0x8004,0x0000,0x8004,0xffff,0x8004,
+    0x0000,0x0004,0x4a69,0xffff,0xffff,0x9cd3,0x8004,0x0000,0x0004,0xef5d,0xffff,0xffff,0xef5d,0x8004,0x0000,0x0004,
+    0x9cd3,0xffff,0xffff,0xe71c,0x8004,0x0000,0x0004,0x7bef,0xffff,0xffff,0x7bef,0x8004,0x0000,0x0001,0xe71c,0x8003,
+    0xffff,0x0001,0xb596,0x800a,0x0000,0x0001,0xd69a,0x8005,0xffff,0x0002,0xdedb,0x6b4d,0x8006,0x0000,0x0002,0x6b4d,
+    0xdedb,0x8005,0xffff,0x0002,0xf79e,0x8c71,0x8008,0x0000,0x0002,0x8c71,0xef5d,0x8003,0xffff,0x0002,0xef5d,0x4a69,
+    0x800a,0x0000,0x0005,0x4a69,0xdedb,0xffff,0xffff,0x4a69,0x8004,0x0000,0x0004,0xd69a,0xffff,0xffff,0xc638,0x8004,
+    0x0000,0x0003,0x4a69,0xf79e,0xb596,0x8004,0x0000,0x0001,0xbdf7,0x8004,0xffff,0x0001,0xc638,0x8004,0x0000,0x0002,
+    0xa534,0x6b4d,0x8004,0x0000,0x8006,0xffff,0x8004,0x0000,0x0001,0x6b4d,0x8005,0x0000,0x8006,0xffff,0x800a,0x0000,
+    0x0001,0xf79e,0x8004,0xffff,0x0001,0xf79e,0x8005,0x0000,0x0001,0x7bef,0x8004,0x0000,0x0001,0xbdf7,0x8004,0xffff,
+    0x0001,0xbdf7,0x8004,0x0000,0x0002,0x7bef,0xb596,0x8005,0x0000,0x0004,0xc638,0xffff,0xffff,0xc638,0x8005,0x0000,
+    0x0003,0xbdf7,0xffff,0x4a69,0x800c,0x0000,0x0004,0x4a69,0xffff,0xffff,0xdedb,0x800c,0x0000,0x0001,0xdedb,0x8003,
+    0xffff,0x0002,0xe71c,0x6b4d,0x8008,0x0000,0x0002,0x4a69,0xe71c,0x8006,0xffff,0x0008,0xd69a,0x9cd3,0x6b4d,0x0000,
+    0x0000,0x4a69,0x8c71,0xc638,0x8004,0xffff
+};
+
+const uint16_t bmp118[261]   = // Bitmap 118 (RLE, 401 words raw)
 {
     0x1019, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x4a69,0x0000,0x0000,0x7bef,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xef5d,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xdedb,0xffff,0xffff,0xffff,
-    0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,
-    0xd69a,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,0xf79e,0xa534,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0x9cd3,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0xb596,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0x4a69,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0x9cd3,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0x8c71,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xbdf7,0x7bef,0x0000,0x0000,0x7bef,0xd69a,0xffff,0x8c71,0x0000,0x0000,0x0000,0x7bef,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x8c71,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0xbdf7,
-    0xffff,0xbdf7,0xa534,0x8c71,0x7bef,0x0000,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0xdedb,
-    0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x7bef,0xf79e,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,
-    0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x0000,0x0000,0x0000,0x8c71,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp126[576]   = // Bitmap 126
+    0x8004,0xffff,0x0007,0xd69a,0x9cd3,0x4a69,0x0000,0x0000,0x7bef,0xbdf7,0x8007,0xffff,0x0002,0xef5d,0x7bef,0x8007,
+    0x0000,0x0002,0x4a69,0xdedb,0x8004,0xffff,0x0002,0xef5d,0x4a69,0x800a,0x0000,0x0001,0xd69a,0x8003,0xffff,0x0001,
+    0x7bef,0x800b,0x0000,0x0004,0x4a69,0xf79e,0xffff,0xd69a,0x8004,0x0000,0x0005,0x4a69,0xd69a,0xffff,0xf79e,0xa534,
+    0x8004,0x0000,0x0003,0xa534,0xffff,0x9cd3,0x8004,0x0000,0x0001,0xc638,0x8004,0xffff,0x0001,0x9cd3,0x8004,0x0000,
+    0x0002,0xffff,0x6b4d,0x8004,0x0000,0x0001,0xf79e,0x8004,0xffff,0x0001,0xe71c,0x8004,0x0000,0x0001,0xd69a,0x8005,
+    0x0000,0x8006,0xffff,0x8004,0x0000,0x0001,0xb596,0x8005,0x0000,0x8006,0xffff,0x8004,0x0000,0x0002,0x8c71,0x4a69,
+    0x8004,0x0000,0x0001,0xef5d,0x8004,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0002,0x6b4d,0x9cd3,0x8004,0x0000,0x0001,
+    0xbdf7,0x8004,0xffff,0x0001,0xbdf7,0x8005,0x0000,0x0001,0xd69a,0x8005,0x0000,0x0004,0xc638,0xffff,0xffff,0xc638,
+    0x8006,0x0000,0x0002,0xffff,0x6b4d,0x800e,0x0000,0x0003,0xffff,0xef5d,0x4a69,0x800d,0x0000,0x0004,0xffff,0xffff,
+    0xef5d,0x4a69,0x8006,0x0000,0x0002,0x7bef,0x8c71,0x8004,0x0000,0x8004,0xffff,0x0008,0xbdf7,0x7bef,0x0000,0x0000,
+    0x7bef,0xd69a,0xffff,0x8c71,0x8003,0x0000,0x0001,0x7bef,0x800b,0xffff,0x0001,0x7bef,0x8003,0x0000,0x0001,0x8c71,
+    0x800b,0xffff,0x8004,0x0000,0x0007,0xbdf7,0xffff,0xbdf7,0xa534,0x8c71,0x7bef,0x0000,0x8004,0xffff,0x0001,0xe71c,
+    0x8004,0x0000,0x0003,0xdedb,0xffff,0x7bef,0x8004,0x0000,0x0001,0xdedb,0x8003,0xffff,0x0001,0xa534,0x8003,0x0000,
+    0x0004,0x4a69,0xffff,0xffff,0xb596,0x8004,0x0000,0x0004,0x7bef,0xf79e,0xffff,0xc638,0x8004,0x0000,0x0004,0xa534,
+    0xffff,0xffff,0xf79e,0x800b,0x0000,0x0001,0x4a69,0x8004,0xffff,0x0001,0xb596,0x800a,0x0000,0x0001,0xe71c,0x8005,
+    0xffff,0x0001,0xa534,0x8007,0x0000,0x0002,0x4a69,0xef5d,0x8007,0xffff,0x0002,0xd69a,0x9cd3,0x8003,0x0000,0x0002,
+    0x8c71,0xc638,0x8005,0xffff
+};
+
+const uint16_t bmp126[303]   = // Bitmap 126 (RLE, 576 words raw)
 {
     0x1719, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x8c71,0x0000,
-    0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xf79e,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,
-    0x8c71,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xef5d,
-    0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x4a69,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xb596,
-    0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,
-    0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x4a69,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,
-    0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,
-    0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,
-    0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,
-    0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,
-    0x0000,0xb596,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xef5d,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,
-    0x0000,0x0000,0x0000,0xef5d,0xb596,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xb596,0x6b4d,0x0000,0x0000,
-    0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,
-    0x0000,0x0000,0x0000,0x0000,0x6b4d
-};
-
-const uint16_t bmp127[501]   = // Bitmap 127
+    0x8007,0xffff,0x0001,0xf79e,0x8007,0x0000,0x800f,0xffff,0x0001,0xc638,0x8007,0x0000,0x0001,0xd69a,0x800e,0xffff,
+    0x0001,0x7bef,0x8007,0x0000,0x0001,0x9cd3,0x800d,0xffff,0x0001,0xf79e,0x8009,0x0000,0x800d,0xffff,0x0001,0xd69a,
+    0x8004,0x0000,0x0001,0x8c71,0x8004,0x0000,0x0001,0xd69a,0x800c,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x0001,0xf79e,
+    0x8004,0x0000,0x0001,0xa534,0x800c,0xffff,0x8004,0x0000,0x0003,0x8c71,0xffff,0x8c71,0x8003,0x0000,0x0001,0x4a69,
+    0x800b,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0003,0xc638,0xffff,0xc638,0x8004,0x0000,0x0001,0xdedb,0x800a,0xffff,
+    0x0001,0x9cd3,0x8004,0x0000,0x0003,0xef5d,0xffff,0xf79e,0x8004,0x0000,0x0001,0xa534,0x800a,0xffff,0x8004,0x0000,
+    0x0001,0x6b4d,0x8003,0xffff,0x0001,0x6b4d,0x8003,0x0000,0x0001,0x4a69,0x8009,0xffff,0x0001,0xd69a,0x8004,0x0000,
+    0x0001,0xb596,0x8003,0xffff,0x0001,0xb596,0x8004,0x0000,0x0001,0xdedb,0x8008,0xffff,0x0001,0xa534,0x8004,0x0000,
+    0x0001,0xdedb,0x8003,0xffff,0x0001,0xe71c,0x8004,0x0000,0x0001,0xa534,0x8008,0xffff,0x0001,0x4a69,0x8003,0x0000,
+    0x0001,0x4a69,0x8005,0xffff,0x0001,0x4a69,0x8003,0x0000,0x0001,0x4a69,0x8007,0xffff,0x0001,0xdedb,0x8004,0x0000,
+    0x0001,0x9cd3,0x8005,0xffff,0x0001,0xa534,0x8004,0x0000,0x0001,0xdedb,0x8006,0xffff,0x0001,0xa534,0x8004,0x0000,
+    0x0001,0xd69a,0x8005,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0xa534,0x8006,0xffff,0x0001,0x4a69,0x800f,0x0000,
+    0x0001,0x6b4d,0x8005,0xffff,0x0001,0xdedb,0x8011,0x0000,0x0001,0xef5d,0x8004,0xffff,0x0001,0xa534,0x8011,0x0000,
+    0x0001,0xb596,0x8004,0xffff,0x0001,0x6b4d,0x8011,0x0000,0x0001,0x6b4d,0x8003,0xffff,0x0001,0xef5d,0x8004,0x0000,
+    0x0001,0x6b4d,0x8009,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0004,0xef5d,0xffff,0xffff,0xb596,0x8004,0x0000,0x0001,
+    0xa534,0x8009,0xffff,0x0001,0xb596,0x8004,0x0000,0x0004,0xb596,0xffff,0xffff,0x6b4d,0x8004,0x0000,0x0001,0xdedb,
+    0x8009,0xffff,0x0001,0xe71c,0x8004,0x0000,0x0003,0x6b4d,0xffff,0xef5d,0x8005,0x0000,0x800b,0xffff,0x0001,0x4a69,
+    0x8004,0x0000,0x0002,0xef5d,0xb596,0x8004,0x0000,0x0001,0x9cd3,0x800b,0xffff,0x0001,0xa534,0x8004,0x0000,0x0002,
+    0xb596,0x6b4d,0x8004,0x0000,0x0001,0xc638,0x800b,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0x6b4d
+};
+
+const uint16_t bmp127[201]   = // Bitmap 127 (RLE, 501 words raw)
 {
     0x1419, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xa534,0xe71c,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x4a69,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x4a69,0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xdedb,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0xa534,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0x8c71,0xc638,0xf79e,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp128[551]   = // Bitmap 128
+    0x800d,0x0000,0x0003,0x8c71,0xa534,0xe71c,0x8004,0xffff,0x8010,0x0000,0x0001,0xa534,0x8003,0xffff,0x8011,0x0000,
+    0x0003,0xa534,0xffff,0xffff,0x8012,0x0000,0x0002,0xdedb,0xffff,0x8005,0x0000,0x8007,0xffff,0x0002,0xdedb,0x4a69,
+    0x8004,0x0000,0x0002,0x9cd3,0xffff,0x8005,0x0000,0x8008,0xffff,0x0001,0xdedb,0x8005,0x0000,0x0001,0xffff,0x8005,
+    0x0000,0x8009,0xffff,0x8005,0x0000,0x0001,0xffff,0x8005,0x0000,0x8009,0xffff,0x8004,0x0000,0x0002,0x6b4d,0xffff,
+    0x8005,0x0000,0x8008,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0002,0xa534,0xffff,0x8005,0x0000,0x8007,0xffff,0x0002,
+    0xc638,0x4a69,0x8003,0x0000,0x0003,0x4a69,0xf79e,0xffff,0x8010,0x0000,0x0004,0x4a69,0xef5d,0xffff,0xffff,0x800f,
+    0x0000,0x0002,0x4a69,0xf79e,0x8003,0xffff,0x8010,0x0000,0x0004,0x6b4d,0xdedb,0xffff,0xffff,0x8012,0x0000,0x0002,
+    0xd69a,0xffff,0x8005,0x0000,0x8007,0xffff,0x0002,0xe71c,0xa534,0x8005,0x0000,0x0001,0xf79e,0x8005,0x0000,0x8009,
+    0xffff,0x0001,0xb596,0x8004,0x0000,0x0001,0xa534,0x8005,0x0000,0x8009,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0001,
+    0x6b4d,0x8005,0x0000,0x800a,0xffff,0x800a,0x0000,0x800a,0xffff,0x800a,0x0000,0x8009,0xffff,0x0001,0xbdf7,0x8004,
+    0x0000,0x0001,0x8c71,0x8005,0x0000,0x8007,0xffff,0x0002,0xf79e,0xbdf7,0x8005,0x0000,0x0001,0xc638,0x8012,0x0000,
+    0x0002,0x4a69,0xffff,0x8012,0x0000,0x0002,0xd69a,0xffff,0x8010,0x0000,0x0004,0x4a69,0xd69a,0xffff,0xffff,0x800d,
+    0x0000,0x0004,0x6b4d,0x8c71,0xc638,0xf79e,0x8003,0xffff
+};
+
+const uint16_t bmp128[267]   = // Bitmap 128 (RLE, 551 words raw)
 {
     0x1619, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0xa534,0x8c71,0x0000,0x0000,0x0000,0x4a69,0x8c71,
-    0xb596,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x4a69,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xf79e,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x4a69,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xdedb,0xffff,0xffff,0xffff,0xdedb,0x8c71,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0x6b4d,0x0000,
-    0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,
-    0x0000,0x0000,0x0000,0x6b4d,0xef5d,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x4a69,0x8c71,0xbdf7,0xdedb,0xf79e,0xbdf7,0x0000,0x0000,0x0000,
-    0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x7bef,0xd69a,0xffff,0xffff,0xffff,0xdedb,
-    0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xbdf7,0x0000,0x0000,0x4a69,0xa534,0xef5d,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xd69a,
-    0x0000,0x0000,0x0000,0x0000,0x4a69,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xe71c,
-    0xffff,0xffff,0xf79e,0xd69a,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,
-    0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xbdf7,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xf79e,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x6b4d,0x0000,0x0000,
-    0x0000,0x6b4d,0x8c71,0xbdf7,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp129[526]   = // Bitmap 129
+    0x8007,0xffff,0x0003,0xdedb,0xa534,0x8c71,0x8003,0x0000,0x0004,0x4a69,0x8c71,0xb596,0xef5d,0x800a,0xffff,0x0002,
+    0xc638,0x4a69,0x800a,0x0000,0x0002,0x8c71,0xf79e,0x8007,0xffff,0x0001,0x8c71,0x800d,0x0000,0x0002,0x4a69,0xd69a,
+    0x8005,0xffff,0x0001,0x7bef,0x8010,0x0000,0x0001,0xe71c,0x8003,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0002,0x9cd3,
+    0xdedb,0x8003,0xffff,0x0002,0xdedb,0x8c71,0x8005,0x0000,0x0004,0x6b4d,0xffff,0xffff,0xd69a,0x8005,0x0000,0x0001,
+    0xd69a,0x8007,0xffff,0x0001,0xd69a,0x8005,0x0000,0x0003,0xc638,0xffff,0x6b4d,0x8004,0x0000,0x0001,0xc638,0x8009,
+    0xffff,0x0001,0xa534,0x8004,0x0000,0x0002,0x6b4d,0xef5d,0x8004,0x0000,0x0001,0x6b4d,0x800a,0xffff,0x0007,0xf79e,
+    0x4a69,0x8c71,0xbdf7,0xdedb,0xf79e,0xbdf7,0x8004,0x0000,0x0001,0xc638,0x8010,0xffff,0x0001,0x8c71,0x8004,0x0000,
+    0x0001,0xe71c,0x8010,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x8011,0xffff,0x8005,0x0000,0x8011,0xffff,0x8005,0x0000,
+    0x8011,0xffff,0x8005,0x0000,0x8011,0xffff,0x0001,0x4a69,0x8004,0x0000,0x8011,0xffff,0x0001,0x8c71,0x8004,0x0000,
+    0x0001,0xe71c,0x8010,0xffff,0x0001,0xb596,0x8004,0x0000,0x0001,0xbdf7,0x800a,0xffff,0x0003,0xf79e,0x7bef,0xd69a,
+    0x8003,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0001,0x6b4d,0x800a,0xffff,0x0008,0xbdf7,0x0000,0x0000,0x4a69,0xa534,
+    0xef5d,0xffff,0x6b4d,0x8004,0x0000,0x0001,0xc638,0x8009,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0003,0x7bef,0xffff,
+    0xd69a,0x8004,0x0000,0x0002,0x4a69,0xe71c,0x8007,0xffff,0x0001,0x7bef,0x8005,0x0000,0x0004,0xd69a,0xffff,0xffff,
+    0x8c71,0x8005,0x0000,0x0007,0xa534,0xe71c,0xffff,0xffff,0xf79e,0xd69a,0x6b4d,0x8005,0x0000,0x0001,0x6b4d,0x8004,
+    0xffff,0x0001,0x7bef,0x800f,0x0000,0x0002,0x4a69,0xef5d,0x8005,0xffff,0x0001,0x7bef,0x800d,0x0000,0x0002,0x4a69,
+    0xef5d,0x8007,0xffff,0x0002,0xbdf7,0x4a69,0x800a,0x0000,0x0002,0x8c71,0xf79e,0x800a,0xffff,0x0003,0xd69a,0x9cd3,
+    0x6b4d,0x8003,0x0000,0x0004,0x6b4d,0x8c71,0xbdf7,0xf79e,0x8005,0xffff
+};
+
+const uint16_t bmp129[210]   = // Bitmap 129 (RLE, 526 words raw)
 {
     0x1519, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xa534,0xd69a,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xdedb,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0xb596,0x4a69,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x7bef,
-    0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,
-    0x0000,0x0000,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xe71c,0x0000,0x0000,0x0000,0x0000,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x9cd3,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,
-    0x0000,0x0000,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0xd69a,0x6b4d,0x0000,
-    0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x6b4d,0xdedb,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xa534,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp131[401]   = // Bitmap 131
+    0x800c,0x0000,0x0003,0x8c71,0xa534,0xd69a,0x8006,0xffff,0x800f,0x0000,0x0002,0x6b4d,0xdedb,0x8004,0xffff,0x8011,
+    0x0000,0x0001,0xb596,0x8003,0xffff,0x8012,0x0000,0x0003,0xd69a,0xffff,0xffff,0x8005,0x0000,0x8006,0xffff,0x0003,
+    0xe71c,0xb596,0x4a69,0x8004,0x0000,0x0003,0x4a69,0xf79e,0xffff,0x8005,0x0000,0x8008,0xffff,0x0002,0xf79e,0x7bef,
+    0x8004,0x0000,0x0002,0xa534,0xffff,0x8005,0x0000,0x8009,0xffff,0x0001,0xef5d,0x8005,0x0000,0x0001,0xffff,0x8005,
+    0x0000,0x800a,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x0001,0xd69a,0x8005,0x0000,0x800a,0xffff,0x0001,0xd69a,0x8004,
+    0x0000,0x0001,0xa534,0x8005,0x0000,0x800a,0xffff,0x0001,0xe71c,0x8004,0x0000,0x0001,0x8c71,0x8005,0x0000,0x800b,
+    0xffff,0x8004,0x0000,0x0001,0x4a69,0x8005,0x0000,0x800b,0xffff,0x800a,0x0000,0x800b,0xffff,0x800a,0x0000,0x800b,
+    0xffff,0x800a,0x0000,0x800b,0xffff,0x800a,0x0000,0x800a,0xffff,0x0001,0xe71c,0x8004,0x0000,0x0001,0x8c71,0x8005,
+    0x0000,0x800a,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0001,0x9cd3,0x8005,0x0000,0x800a,0xffff,0x0001,0xa534,0x8004,
+    0x0000,0x0001,0xd69a,0x8005,0x0000,0x800a,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0001,0xffff,0x8005,0x0000,0x8009,
+    0xffff,0x0001,0x9cd3,0x8004,0x0000,0x0002,0xa534,0xffff,0x8005,0x0000,0x8006,0xffff,0x0003,0xef5d,0xd69a,0x6b4d,
+    0x8004,0x0000,0x0003,0x4a69,0xf79e,0xffff,0x8012,0x0000,0x0003,0xd69a,0xffff,0xffff,0x8011,0x0000,0x0001,0xb596,
+    0x8003,0xffff,0x800f,0x0000,0x0002,0x6b4d,0xdedb,0x8004,0xffff,0x800c,0x0000,0x0003,0x8c71,0xa534,0xdedb,0x8006,
+    0xffff
+};
+
+const uint16_t bmp131[89]   = // Bitmap 131 (RLE, 401 words raw)
 {
     0x1019, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp137[426]   = // Bitmap 137
+    0x8045,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,
+    0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,0x800e,0x0000,0x0002,0xffff,0xffff,0x800e,0x0000,0x0002,
+    0xffff,0xffff,0x800e,0x0000,0x0002,0xffff,0xffff,0x800e,0x0000,0x0002,0xffff,0xffff,0x8005,0x0000,0x800b,0xffff,
+    0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,
+    0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,
+    0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff
+};
+
+const uint16_t bmp137[87]   = // Bitmap 137 (RLE, 426 words raw)
 {
     0x1119, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t bmp140[601]   = // Bitmap 140
+    0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,
+    0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,
+    0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,
+    0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,
+    0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,
+    0x8005,0x0000,0x800c,0xffff,0x8044,0x0000
+};
+
+const uint16_t bmp140[297]   = // Bitmap 140 (RLE, 601 words raw)
 {
     0x1819, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0xa534,0x7bef,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0xa534,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,
-    0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xd69a,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0xd69a,0xf79e,0xffff,0xffff,0xf79e,0xd69a,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,
-    0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,
-    0x0000,0x6b4d,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xdedb,0xb596,0x0000,0x0000,
-    0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xb596,0x0000,0x0000,0x0000,0x0000,0xb596,0x8c71,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0x4a69,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x4a69,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x8c71,0xb596,0x0000,0x0000,0x0000,0x0000,0xa534,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,
-    0x0000,0x0000,0xb596,0xdedb,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0x6b4d,0x0000,
-    0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,
-    0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,
-    0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xc638,0xf79e,0xffff,0xffff,0xf79e,0xd69a,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xc638,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,
-    0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0xa534,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0x8c71,0xa534,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp141[476]   = // Bitmap 141
+    0x8007,0xffff,0x0003,0xd69a,0xa534,0x7bef,0x8004,0x0000,0x0003,0x8c71,0xa534,0xdedb,0x800c,0xffff,0x0002,0xbdf7,
+    0x4a69,0x800a,0x0000,0x0002,0x6b4d,0xd69a,0x8009,0xffff,0x0001,0x7bef,0x800e,0x0000,0x0001,0x8c71,0x8007,0xffff,
+    0x0001,0x7bef,0x8010,0x0000,0x0001,0x7bef,0x8005,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0008,0x6b4d,0xd69a,0xf79e,
+    0xffff,0xffff,0xf79e,0xd69a,0x6b4d,0x8005,0x0000,0x0001,0x8c71,0x8003,0xffff,0x0001,0xd69a,0x8005,0x0000,0x0001,
+    0xa534,0x8008,0xffff,0x0001,0xbdf7,0x8005,0x0000,0x0004,0xd69a,0xffff,0xffff,0x6b4d,0x8004,0x0000,0x0001,0xa534,
+    0x800a,0xffff,0x0001,0xb596,0x8004,0x0000,0x0003,0x6b4d,0xffff,0xdedb,0x8004,0x0000,0x0001,0x4a69,0x800c,0xffff,
+    0x0001,0x4a69,0x8004,0x0000,0x0002,0xdedb,0xb596,0x8004,0x0000,0x0001,0xb596,0x800c,0xffff,0x0001,0xb596,0x8004,
+    0x0000,0x0002,0xb596,0x8c71,0x8004,0x0000,0x0001,0xdedb,0x800c,0xffff,0x0001,0xe71c,0x8004,0x0000,0x0002,0x8c71,
+    0x4a69,0x8004,0x0000,0x0001,0xf79e,0x800c,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0001,0x4a69,0x8005,0x0000,0x800e,
+    0xffff,0x800a,0x0000,0x800e,0xffff,0x800a,0x0000,0x800e,0xffff,0x8005,0x0000,0x0001,0x4a69,0x8004,0x0000,0x0001,
+    0xf79e,0x800c,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0002,0x4a69,0x8c71,0x8004,0x0000,0x0001,0xdedb,0x800c,0xffff,
+    0x0001,0xdedb,0x8004,0x0000,0x0002,0x8c71,0xb596,0x8004,0x0000,0x0001,0xa534,0x800c,0xffff,0x0001,0xa534,0x8004,
+    0x0000,0x0002,0xb596,0xdedb,0x8004,0x0000,0x0001,0x4a69,0x800c,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0003,0xdedb,
+    0xffff,0x6b4d,0x8004,0x0000,0x0001,0x9cd3,0x800a,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x0004,0x6b4d,0xffff,0xffff,
+    0xd69a,0x8005,0x0000,0x0001,0xa534,0x8008,0xffff,0x0001,0xa534,0x8005,0x0000,0x0001,0xd69a,0x8003,0xffff,0x0001,
+    0x8c71,0x8005,0x0000,0x0008,0x6b4d,0xc638,0xf79e,0xffff,0xffff,0xf79e,0xd69a,0x6b4d,0x8005,0x0000,0x0001,0x8c71,
+    0x8005,0xffff,0x0001,0x7bef,0x8010,0x0000,0x0001,0x7bef,0x8007,0xffff,0x0001,0x8c71,0x800e,0x0000,0x0001,0x8c71,
+    0x8009,0xffff,0x0002,0xc638,0x4a69,0x800a,0x0000,0x0002,0x4a69,0xc638,0x800c,0xffff,0x0003,0xdedb,0xa534,0x8c71,
+    0x8004,0x0000,0x0003,0x8c71,0xa534,0xdedb,0x8007,0xffff
+};
+
+const uint16_t bmp141[160]   = // Bitmap 141 (RLE, 476 words raw)
 {
     0x1319, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0x8c71,0xc638,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xe71c,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x4a69,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x4a69,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x9cd3,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0xdedb,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xf79e,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0x8c71,0xa534,0xdedb,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp143[551]   = // Bitmap 143
+    0x800c,0x0000,0x0003,0x7bef,0x8c71,0xc638,0x8004,0xffff,0x800f,0x0000,0x0004,0x4a69,0xe71c,0xffff,0xffff,0x8011,
+    0x0000,0x0002,0xe71c,0xffff,0x8011,0x0000,0x0002,0x4a69,0xffff,0x8005,0x0000,0x8006,0xffff,0x0002,0xdedb,0x8c71,
+    0x8005,0x0000,0x0001,0xc638,0x8005,0x0000,0x8008,0xffff,0x0001,0x8c71,0x8004,0x0000,0x0001,0x8c71,0x8005,0x0000,
+    0x8008,0xffff,0x0001,0xe71c,0x8004,0x0000,0x0001,0x4a69,0x8005,0x0000,0x8009,0xffff,0x800a,0x0000,0x8009,0xffff,
+    0x800a,0x0000,0x8008,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0001,0x4a69,0x8005,0x0000,0x8008,0xffff,0x0001,0x7bef,
+    0x8004,0x0000,0x0001,0x9cd3,0x8005,0x0000,0x8005,0xffff,0x0003,0xf79e,0xdedb,0x7bef,0x8005,0x0000,0x0001,0xd69a,
+    0x8011,0x0000,0x0002,0x7bef,0xffff,0x8010,0x0000,0x0003,0x4a69,0xef5d,0xffff,0x800f,0x0000,0x0004,0x8c71,0xf79e,
+    0xffff,0xffff,0x800b,0x0000,0x0004,0x4a69,0x8c71,0xa534,0xdedb,0x8004,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,
+    0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,
+    0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff
+};
+
+const uint16_t bmp143[251]   = // Bitmap 143 (RLE, 551 words raw)
 {
     0x1619, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0x8c71,
-    0xbdf7,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0xbdf7,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xb596,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,
-    0x4a69,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xf79e,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x4a69,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xe71c,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,
-    0x0000,0xbdf7,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,
-    0x0000,0x8c71,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,
-    0x0000,0x4a69,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x9cd3
-};
-
-const uint16_t bmp144[501]   = // Bitmap 144
+    0x800d,0x0000,0x0004,0x7bef,0x8c71,0xbdf7,0xf79e,0x8005,0xffff,0x8011,0x0000,0x0001,0xbdf7,0x8004,0xffff,0x8012,
+    0x0000,0x0001,0xbdf7,0x8003,0xffff,0x8013,0x0000,0x0003,0xf79e,0xffff,0xffff,0x8005,0x0000,0x8007,0xffff,0x0002,
+    0xf79e,0xbdf7,0x8005,0x0000,0x0003,0xb596,0xffff,0xffff,0x8005,0x0000,0x8009,0xffff,0x0001,0xbdf7,0x8004,0x0000,
+    0x0003,0x7bef,0xffff,0xffff,0x8005,0x0000,0x800a,0xffff,0x8005,0x0000,0x0002,0xffff,0xffff,0x8005,0x0000,0x800a,
+    0xffff,0x8005,0x0000,0x0002,0xffff,0xffff,0x8005,0x0000,0x8009,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0003,0x4a69,
+    0xffff,0xffff,0x8005,0x0000,0x8009,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0003,0x9cd3,0xffff,0xffff,0x8005,0x0000,
+    0x8007,0xffff,0x0002,0xe71c,0xbdf7,0x8005,0x0000,0x0003,0xd69a,0xffff,0xffff,0x8012,0x0000,0x0001,0x7bef,0x8003,
+    0xffff,0x8011,0x0000,0x0002,0x6b4d,0xf79e,0x8003,0xffff,0x800f,0x0000,0x0002,0x4a69,0xb596,0x8005,0xffff,0x800e,
+    0x0000,0x0001,0xc638,0x8007,0xffff,0x8005,0x0000,0x8003,0xffff,0x0002,0xe71c,0x9cd3,0x8005,0x0000,0x0001,0xd69a,
+    0x8006,0xffff,0x8005,0x0000,0x8005,0xffff,0x0001,0xc638,0x8005,0x0000,0x0001,0xd69a,0x8005,0xffff,0x8005,0x0000,
+    0x8006,0xffff,0x0001,0xa534,0x8005,0x0000,0x0001,0xef5d,0x8004,0xffff,0x8005,0x0000,0x8007,0xffff,0x0001,0x7bef,
+    0x8004,0x0000,0x0001,0x6b4d,0x8004,0xffff,0x8005,0x0000,0x8008,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0001,0xbdf7,
+    0x8003,0xffff,0x8005,0x0000,0x8008,0xffff,0x0001,0xc638,0x8005,0x0000,0x0003,0xf79e,0xffff,0xffff,0x8005,0x0000,
+    0x8009,0xffff,0x0001,0x7bef,0x8004,0x0000,0x0003,0x8c71,0xffff,0xffff,0x8005,0x0000,0x8009,0xffff,0x0001,0xef5d,
+    0x8005,0x0000,0x0002,0xc638,0xffff,0x8005,0x0000,0x800a,0xffff,0x0001,0xb596,0x8004,0x0000,0x0002,0x4a69,0xffff,
+    0x8005,0x0000,0x800b,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0001,0x9cd3
+};
+
+const uint16_t bmp144[273]   = // Bitmap 144 (RLE, 501 words raw)
 {
     0x1419, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0xa534,0x7bef,0x0000,0x0000,0x0000,0x4a69,0x8c71,0xb596,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xe71c,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,
-    0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,
-    0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x4a69,0xbdf7,0xf79e,0xffff,0xffff,0xef5d,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xa534,0xd69a,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xa534,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xbdf7,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xbdf7,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0xa534,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0xb596,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xbdf7,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xe71c,0xffff,0xffff,0xffff,0xdedb,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,
-    0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xf79e,0xffff,
-    0xffff,0xffff,0xffff,0xef5d,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0xb596,0x8c71,0x0000,0x0000,0x0000,0x0000,0x6b4d,0x8c71,0xc638,0xf79e,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp145[476]   = // Bitmap 145
+    0x8005,0xffff,0x0003,0xd69a,0xa534,0x7bef,0x8003,0x0000,0x0004,0x4a69,0x8c71,0xb596,0xf79e,0x8008,0xffff,0x0002,
+    0xe71c,0x6b4d,0x800a,0x0000,0x0001,0x9cd3,0x8006,0xffff,0x0001,0xd69a,0x800d,0x0000,0x0001,0x7bef,0x8004,0xffff,
+    0x0002,0xf79e,0x4a69,0x800e,0x0000,0x0001,0x9cd3,0x8003,0xffff,0x0001,0xa534,0x8004,0x0000,0x0007,0x4a69,0xbdf7,
+    0xf79e,0xffff,0xffff,0xef5d,0x8c71,0x8005,0x0000,0x0004,0xe71c,0xffff,0xffff,0x6b4d,0x8004,0x0000,0x0001,0xe71c,
+    0x8006,0xffff,0x0001,0x7bef,0x8004,0x0000,0x0003,0xa534,0xffff,0xffff,0x8005,0x0000,0x8007,0xffff,0x0001,0xd69a,
+    0x8004,0x0000,0x0003,0x7bef,0xffff,0xffff,0x8005,0x0000,0x0001,0xe71c,0x8007,0xffff,0x8005,0x0000,0x0003,0xffff,
+    0xffff,0x8c71,0x8004,0x0000,0x0002,0x4a69,0xd69a,0x800d,0xffff,0x0001,0xd69a,0x8006,0x0000,0x0004,0x6b4d,0xa534,
+    0xd69a,0xf79e,0x800a,0xffff,0x0001,0x7bef,0x8009,0x0000,0x0003,0x6b4d,0xa534,0xdedb,0x8008,0xffff,0x0001,0x7bef,
+    0x800b,0x0000,0x0002,0x4a69,0xbdf7,0x8007,0xffff,0x0002,0xbdf7,0x4a69,0x800b,0x0000,0x0001,0x7bef,0x8008,0xffff,
+    0x0003,0xdedb,0xa534,0x6b4d,0x8009,0x0000,0x0001,0x7bef,0x800b,0xffff,0x0003,0xdedb,0xb596,0x7bef,0x8006,0x0000,
+    0x0001,0xd69a,0x800d,0xffff,0x0002,0xe71c,0x6b4d,0x8004,0x0000,0x0001,0x8c71,0x8005,0x0000,0x8009,0xffff,0x0001,
+    0xe71c,0x8005,0x0000,0x0001,0x8c71,0x8004,0x0000,0x0001,0xd69a,0x8009,0xffff,0x8005,0x0000,0x0001,0xbdf7,0x8004,
+    0x0000,0x0001,0x8c71,0x8008,0xffff,0x0001,0xf79e,0x8005,0x0000,0x0001,0xf79e,0x8005,0x0000,0x0001,0xc638,0x8007,
+    0xffff,0x0001,0x8c71,0x8004,0x0000,0x0003,0x8c71,0xffff,0x8c71,0x8005,0x0000,0x0002,0x9cd3,0xe71c,0x8003,0xffff,
+    0x0002,0xdedb,0x7bef,0x8005,0x0000,0x0004,0xd69a,0xffff,0xf79e,0x4a69,0x800f,0x0000,0x0001,0x7bef,0x8003,0xffff,
+    0x0002,0xef5d,0x4a69,0x800d,0x0000,0x0002,0x6b4d,0xf79e,0x8004,0xffff,0x0002,0xef5d,0x8c71,0x800b,0x0000,0x0001,
+    0xa534,0x8008,0xffff,0x0003,0xe71c,0xb596,0x8c71,0x8004,0x0000,0x0004,0x6b4d,0x8c71,0xc638,0xf79e,0x8004,0xffff
+};
+
+const uint16_t bmp145[89]   = // Bitmap 145 (RLE, 476 words raw)
 {
     0x1319, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp158[324]   = // Bitmap 158
+    0x804c,0x0000,0x8007,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,
+    0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,
+    0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,
+    0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,
+    0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,
+    0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x8007,0xffff
+};
+
+const uint16_t bmp158[196]   = // Bitmap 158 (RLE, 324 words raw)
 {
     0x1113, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x6b4d,0x0000,0x0000,0x0000,0x4a69,0x8c71,0xb596,0xf79e,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,0xffff,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x7bef,0xe71c,0xffff,0xffff,0xef5d,0x8c71,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,
-    0xffff,0xf79e,0xd69a,0xa534,0x6b4d,0xe71c,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0xbdf7,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xd69a,0xa534,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xb596,0xd69a,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xbdf7,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xf79e,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xf79e,0xffff,0xf79e,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xe71c,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xef5d,0xd69a,0x0000,0x0000,0x0000,0x0000,0xc638,
-    0xffff,0xffff,0xef5d,0xa534,0x6b4d,0x0000,0x0000,0x7bef,0xc638,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x7bef
-};
-
-const uint16_t bmp159[426]   = // Bitmap 159
+    0x8004,0xffff,0x0003,0xd69a,0x9cd3,0x6b4d,0x8003,0x0000,0x0004,0x4a69,0x8c71,0xb596,0xf79e,0x8006,0xffff,0x0001,
+    0x7bef,0x8009,0x0000,0x0002,0x4a69,0xd69a,0x8004,0xffff,0x0001,0x7bef,0x800c,0x0000,0x0004,0xe71c,0xffff,0xffff,
+    0xd69a,0x800d,0x0000,0x0004,0xa534,0xffff,0xffff,0x6b4d,0x8003,0x0000,0x0006,0x7bef,0xe71c,0xffff,0xffff,0xef5d,
+    0x8c71,0x8004,0x0000,0x0008,0x7bef,0xffff,0xffff,0xf79e,0xd69a,0xa534,0x6b4d,0xe71c,0x8004,0xffff,0x0001,0xf79e,
+    0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x8009,0xffff,0x0003,0xe71c,0xbdf7,0x7bef,0x8005,0x0000,0x8005,0xffff,
+    0x0003,0xd69a,0xa534,0x6b4d,0x8009,0x0000,0x8003,0xffff,0x0001,0xa534,0x800d,0x0000,0x0003,0xffff,0xffff,0x7bef,
+    0x8005,0x0000,0x0004,0x7bef,0xb596,0xd69a,0xf79e,0x8005,0x0000,0x0002,0xffff,0xbdf7,0x8004,0x0000,0x0002,0x9cd3,
+    0xf79e,0x8004,0xffff,0x8005,0x0000,0x0002,0xffff,0x6b4d,0x8004,0x0000,0x8006,0xffff,0x8005,0x0000,0x0001,0xffff,
+    0x8005,0x0000,0x0001,0xf79e,0x8004,0xffff,0x0001,0xbdf7,0x8005,0x0000,0x0001,0xffff,0x8005,0x0000,0x0005,0x7bef,
+    0xf79e,0xffff,0xf79e,0xa534,0x8006,0x0000,0x0002,0xffff,0x9cd3,0x800f,0x0000,0x0002,0xffff,0xe71c,0x8009,0x0000,
+    0x0002,0x4a69,0x9cd3,0x8004,0x0000,0x0003,0xe71c,0xffff,0xd69a,0x8007,0x0000,0x0003,0x6b4d,0xef5d,0xd69a,0x8004,
+    0x0000,0x000d,0xc638,0xffff,0xffff,0xef5d,0xa534,0x6b4d,0x0000,0x0000,0x7bef,0xc638,0xffff,0xffff,0xf79e,0x8004,
+    0x0000,0x0001,0x7bef
+};
+
+const uint16_t bmp159[213]   = // Bitmap 159 (RLE, 426 words raw)
 {
     0x1119, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xbdf7,0x7bef,0x0000,0x0000,0x7bef,0xbdf7,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xef5d,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xf79e,0xffff,0xf79e,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xb596,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x4a69,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x9cd3,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xc638,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xe71c,0xffff,0xf79e,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xd69a,0x8c71,0x4a69,0x0000,0x0000,0x9cd3,0xd69a,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp160[324]   = // Bitmap 160
+    0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,
+    0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x0008,0xffff,0xffff,0xbdf7,0x7bef,0x0000,
+    0x0000,0x7bef,0xbdf7,0x8004,0xffff,0x8005,0x0000,0x0002,0xef5d,0x7bef,0x8006,0x0000,0x0004,0x6b4d,0xef5d,0xffff,
+    0xffff,0x8005,0x0000,0x0001,0x6b4d,0x8008,0x0000,0x0003,0x4a69,0xf79e,0xffff,0x800f,0x0000,0x0002,0x8c71,0xffff,
+    0x8006,0x0000,0x0005,0x8c71,0xf79e,0xffff,0xf79e,0x8c71,0x8005,0x0000,0x0001,0xef5d,0x8005,0x0000,0x0001,0x6b4d,
+    0x8005,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xb596,0x8005,0x0000,0x0001,0xd69a,0x8005,0xffff,0x0001,0xd69a,
+    0x8004,0x0000,0x0001,0x8c71,0x8005,0x0000,0x0001,0xf79e,0x8005,0xffff,0x0001,0xef5d,0x8004,0x0000,0x0001,0x4a69,
+    0x8005,0x0000,0x8007,0xffff,0x800a,0x0000,0x8007,0xffff,0x800a,0x0000,0x8007,0xffff,0x800a,0x0000,0x0001,0xe71c,
+    0x8005,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0001,0x6b4d,0x8005,0x0000,0x0001,0xc638,0x8005,0xffff,0x0001,0xd69a,
+    0x8004,0x0000,0x0001,0x9cd3,0x8005,0x0000,0x0001,0x4a69,0x8005,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xc638,
+    0x8006,0x0000,0x0005,0x7bef,0xe71c,0xffff,0xf79e,0x9cd3,0x8005,0x0000,0x0001,0xffff,0x800f,0x0000,0x0002,0xbdf7,
+    0xffff,0x8004,0x0000,0x0001,0x7bef,0x8009,0x0000,0x0003,0x7bef,0xffff,0xffff,0x8004,0x0000,0x0002,0xffff,0x7bef,
+    0x8007,0x0000,0x0001,0x8c71,0x8003,0xffff,0x8004,0x0000,0x0009,0xffff,0xffff,0xd69a,0x8c71,0x4a69,0x0000,0x0000,
+    0x9cd3,0xd69a,0x8004,0xffff
+};
+
+const uint16_t bmp160[188]   = // Bitmap 160 (RLE, 324 words raw)
 {
     0x1113, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x8c71,0x0000,0x0000,0x0000,0x4a69,0x9cd3,0xd69a,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xc638,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xe71c,0xffff,0xffff,
-    0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,
-    0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x8c71,0xef5d,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,
-    0xd69a,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0x9cd3,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x4a69,0x8c71,0xbdf7,0xdedb,0xf79e,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x8c71,0xbdf7,0xdedb,0xf79e,
-    0x9cd3,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0xd69a,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xa534,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x7bef,0xef5d,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,
-    0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,
-    0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xf79e,0xb596,0x8c71,0x0000,0x0000,0x0000,0x6b4d,0xa534,0xe71c,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp161[426]   = // Bitmap 161
+    0x8005,0xffff,0x0002,0xc638,0x8c71,0x8003,0x0000,0x0003,0x4a69,0x9cd3,0xd69a,0x8007,0xffff,0x0002,0xc638,0x4a69,
+    0x8008,0x0000,0x0002,0x4a69,0xe71c,0x8004,0xffff,0x0001,0xa534,0x800c,0x0000,0x0004,0xe71c,0xffff,0xffff,0xc638,
+    0x800d,0x0000,0x0004,0x4a69,0xffff,0xffff,0x4a69,0x8004,0x0000,0x0005,0x8c71,0xef5d,0xffff,0xffff,0xc638,0x8005,
+    0x0000,0x0002,0xc638,0xd69a,0x8004,0x0000,0x0001,0x7bef,0x8005,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0002,0x6b4d,
+    0x9cd3,0x8004,0x0000,0x0001,0xd69a,0x8005,0xffff,0x0007,0xf79e,0x4a69,0x8c71,0xbdf7,0xdedb,0xf79e,0x6b4d,0x8004,
+    0x0000,0x0001,0xf79e,0x800b,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,
+    0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xef5d,0x8006,0xffff,0x0006,0x4a69,0x8c71,0xbdf7,0xdedb,0xf79e,0x9cd3,
+    0x8004,0x0000,0x0001,0xd69a,0x8005,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0002,0x6b4d,0xd69a,0x8004,0x0000,0x0001,
+    0x6b4d,0x8005,0xffff,0x0001,0x8c71,0x8004,0x0000,0x0003,0xa534,0xffff,0x4a69,0x8004,0x0000,0x0005,0x7bef,0xef5d,
+    0xffff,0xffff,0xa534,0x8005,0x0000,0x0003,0xef5d,0xffff,0xc638,0x800d,0x0000,0x0001,0x9cd3,0x8003,0xffff,0x0001,
+    0xa534,0x800b,0x0000,0x0001,0x7bef,0x8005,0xffff,0x0001,0xbdf7,0x8009,0x0000,0x0001,0x8c71,0x8007,0xffff,0x0003,
+    0xf79e,0xb596,0x8c71,0x8003,0x0000,0x0003,0x6b4d,0xa534,0xe71c,0x8004,0xffff
+};
+
+const uint16_t bmp161[213]   = // Bitmap 161 (RLE, 426 words raw)
 {
     0x1119, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xbdf7,0x7bef,0x0000,0x0000,0x7bef,0xbdf7,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xef5d,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xf79e,0xffff,0xf79e,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xb596,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x4a69,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x9cd3,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xc638,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xef5d,0xffff,0xef5d,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xdedb,0x9cd3,0x0000,0x0000,0x4a69,0x8c71,0xd69a,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t bmp162[324]   = // Bitmap 162
+    0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,
+    0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x8004,0xffff,0x0008,0xbdf7,0x7bef,0x0000,0x0000,0x7bef,
+    0xbdf7,0xffff,0xffff,0x8005,0x0000,0x0004,0xffff,0xffff,0xef5d,0x6b4d,0x8006,0x0000,0x0002,0x7bef,0xef5d,0x8005,
+    0x0000,0x0003,0xffff,0xf79e,0x4a69,0x8008,0x0000,0x0001,0x6b4d,0x8005,0x0000,0x0002,0xffff,0x8c71,0x800f,0x0000,
+    0x0001,0xef5d,0x8005,0x0000,0x0005,0x7bef,0xf79e,0xffff,0xf79e,0x8c71,0x8006,0x0000,0x0001,0xb596,0x8004,0x0000,
+    0x0001,0x6b4d,0x8005,0xffff,0x0001,0x6b4d,0x8005,0x0000,0x0001,0x8c71,0x8004,0x0000,0x0001,0xd69a,0x8005,0xffff,
+    0x0001,0xd69a,0x8005,0x0000,0x0001,0x4a69,0x8004,0x0000,0x0001,0xf79e,0x8005,0xffff,0x0001,0xef5d,0x800a,0x0000,
+    0x8007,0xffff,0x800a,0x0000,0x8007,0xffff,0x800a,0x0000,0x8007,0xffff,0x8005,0x0000,0x0001,0x6b4d,0x8004,0x0000,
+    0x0001,0xef5d,0x8005,0xffff,0x0001,0xef5d,0x8005,0x0000,0x0001,0x9cd3,0x8004,0x0000,0x0001,0xd69a,0x8005,0xffff,
+    0x0001,0xd69a,0x8005,0x0000,0x0001,0xc638,0x8004,0x0000,0x0001,0x6b4d,0x8005,0xffff,0x0001,0x6b4d,0x8005,0x0000,
+    0x0001,0xffff,0x8005,0x0000,0x0005,0x7bef,0xef5d,0xffff,0xef5d,0x7bef,0x8006,0x0000,0x0002,0xffff,0xbdf7,0x800f,
+    0x0000,0x0003,0xffff,0xffff,0x7bef,0x8009,0x0000,0x0001,0x7bef,0x8004,0x0000,0x8003,0xffff,0x0001,0x9cd3,0x8007,
+    0x0000,0x0002,0x7bef,0xffff,0x8004,0x0000,0x8004,0xffff,0x0009,0xdedb,0x9cd3,0x0000,0x0000,0x4a69,0x8c71,0xd69a,
+    0xffff,0xffff,0x8004,0x0000
+};
+
+const uint16_t bmp162[169]   = // Bitmap 162 (RLE, 324 words raw)
 {
     0x1113, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xf79e,0xb596,0x7bef,0x0000,0x0000,0x0000,0x8c71,0xbdf7,0xf79e,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xc638,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,
-    0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xf79e,0xffff,0xf79e,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,
-    0xd69a,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xdedb,
-    0x9cd3,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0xb596,
-    0x7bef,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x9cd3,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xd69a,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x8c71,0xe71c,0xffff,0xffff,0xf79e,0xbdf7,0x4a69,0x8c71,0xbdf7,0xdedb,0xf79e,
-    0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xf79e,0xc638,0x8c71,0x4a69,0x0000,0x0000,0x0000,0x8c71,0xb596,0xef5d,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp163[326]   = // Bitmap 163
+    0x8004,0xffff,0x0003,0xf79e,0xb596,0x7bef,0x8003,0x0000,0x0003,0x8c71,0xbdf7,0xf79e,0x8007,0xffff,0x0001,0xc638,
+    0x8008,0x0000,0x0002,0x4a69,0xc638,0x8005,0xffff,0x0001,0xa534,0x800b,0x0000,0x0001,0xa534,0x8003,0xffff,0x0001,
+    0xdedb,0x800d,0x0000,0x0004,0xdedb,0xffff,0xffff,0x4a69,0x8004,0x0000,0x0005,0x9cd3,0xf79e,0xffff,0xf79e,0x9cd3,
+    0x8004,0x0000,0x0003,0x6b4d,0xffff,0xd69a,0x8004,0x0000,0x0001,0x8c71,0x8005,0xffff,0x0001,0x9cd3,0x8004,0x0000,
+    0x0002,0xdedb,0x9cd3,0x8004,0x0000,0x0001,0xdedb,0x8005,0xffff,0x0001,0xef5d,0x8004,0x0000,0x0002,0xb596,0x7bef,
+    0x8004,0x0000,0x8007,0xffff,0x8004,0x0000,0x0001,0x8c71,0x8010,0x0000,0x0001,0x4a69,0x8022,0x0000,0x0001,0x6b4d,
+    0x8004,0x0000,0x800c,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x0001,0xdedb,0x800b,0xffff,0x0001,0xd69a,0x8004,0x0000,
+    0x0001,0x8c71,0x800c,0xffff,0x0001,0x4a69,0x8004,0x0000,0x000d,0x8c71,0xe71c,0xffff,0xffff,0xf79e,0xbdf7,0x4a69,
+    0x8c71,0xbdf7,0xdedb,0xf79e,0xffff,0xc638,0x800e,0x0000,0x0004,0x8c71,0xffff,0xffff,0xa534,0x800c,0x0000,0x0001,
+    0x4a69,0x8004,0xffff,0x0001,0xbdf7,0x800a,0x0000,0x0001,0x8c71,0x8006,0xffff,0x0004,0xf79e,0xc638,0x8c71,0x4a69,
+    0x8003,0x0000,0x0003,0x8c71,0xb596,0xef5d,0x8003,0xffff
+};
+
+const uint16_t bmp163[129]   = // Bitmap 163 (RLE, 326 words raw)
 {
     0x0d19, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x8c71,0x0000,0x0000,0x0000,0x4a69,0x8c71,0xc638,
-    0xffff,0xffff,0xffff,0xf79e,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xf79e,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp164[443]   = // Bitmap 164
+    0x8005,0xffff,0x0002,0xc638,0x8c71,0x8003,0x0000,0x0003,0x4a69,0x8c71,0xc638,0x8003,0xffff,0x0002,0xf79e,0x6b4d,
+    0x8007,0x0000,0x0001,0x6b4d,0x8003,0xffff,0x0001,0x9cd3,0x8008,0x0000,0x0001,0x8c71,0x8003,0xffff,0x0001,0x4a69,
+    0x8008,0x0000,0x0001,0xa534,0x8003,0xffff,0x8005,0x0000,0x0001,0xdedb,0x8003,0xffff,0x0001,0xf79e,0x8003,0xffff,
+    0x8005,0x0000,0x8005,0xffff,0x800c,0x0000,0x0001,0xffff,0x800c,0x0000,0x0001,0xffff,0x800c,0x0000,0x0001,0xffff,
+    0x800c,0x0000,0x8004,0xffff,0x8005,0x0000,0x8008,0xffff,0x8005,0x0000,0x8008,0xffff,0x8005,0x0000,0x8008,0xffff,
+    0x8005,0x0000,0x8008,0xffff,0x8005,0x0000,0x8008,0xffff,0x8005,0x0000,0x8008,0xffff,0x8005,0x0000,0x8008,0xffff,
+    0x8005,0x0000,0x8008,0xffff,0x8005,0x0000,0x8008,0xffff,0x8005,0x0000,0x8008,0xffff,0x8005,0x0000,0x8008,0xffff,
+    0x8005,0x0000,0x8008,0xffff,0x8005,0x0000,0x8008,0xffff,0x8005,0x0000,0x8008,0xffff,0x8005,0x0000,0x8005,0xffff
+};
+
+const uint16_t bmp164[254]   = // Bitmap 164 (RLE, 443 words raw)
 {
     0x111a, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x4a69,0x0000,0x4a69,0x9cd3,0xe71c,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xf79e,0xffff,0xef5d,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xc638,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x9cd3,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xc638,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xf79e,0xffff,0xe71c,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xd69a,0x8c71,0x0000,0x0000,0x0000,0x9cd3,0xdedb,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0xffff,0x4a69,0x8c71,0xbdf7,0xdedb,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xdedb,0x7bef,0x0000,0x0000,0x0000,0x0000,0xc638,
-    0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,
-    0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,
-    0xffff,0xffff,0xef5d,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x7bef,0x0000,0x0000,0x0000,0x0000,0x8c71,0xb596,0xf79e,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp165[401]   = // Bitmap 165
+    0x8004,0xffff,0x0009,0xd69a,0x9cd3,0x4a69,0x0000,0x4a69,0x9cd3,0xe71c,0xffff,0xffff,0x8004,0x0000,0x8003,0xffff,
+    0x0001,0x8c71,0x8007,0x0000,0x0002,0xb596,0xffff,0x8004,0x0000,0x0003,0xffff,0xffff,0x7bef,0x8009,0x0000,0x0001,
+    0xbdf7,0x8004,0x0000,0x0002,0xffff,0xb596,0x800f,0x0000,0x0001,0xf79e,0x8005,0x0000,0x0005,0x8c71,0xf79e,0xffff,
+    0xef5d,0x7bef,0x8006,0x0000,0x0001,0xc638,0x8004,0x0000,0x0001,0x6b4d,0x8005,0xffff,0x0001,0x6b4d,0x8005,0x0000,
+    0x0001,0x8c71,0x8004,0x0000,0x0001,0xd69a,0x8005,0xffff,0x0001,0xc638,0x8005,0x0000,0x0001,0x6b4d,0x8004,0x0000,
+    0x0001,0xef5d,0x8005,0xffff,0x0001,0xef5d,0x800a,0x0000,0x8007,0xffff,0x800a,0x0000,0x8007,0xffff,0x800a,0x0000,
+    0x8007,0xffff,0x8005,0x0000,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xef5d,0x8005,0xffff,0x0001,0xef5d,0x8005,0x0000,
+    0x0001,0x9cd3,0x8004,0x0000,0x0001,0xd69a,0x8005,0xffff,0x0001,0xc638,0x8005,0x0000,0x0001,0xc638,0x8004,0x0000,
+    0x0001,0x6b4d,0x8005,0xffff,0x0001,0x4a69,0x8005,0x0000,0x0001,0xffff,0x8005,0x0000,0x0005,0x8c71,0xf79e,0xffff,
+    0xe71c,0x7bef,0x8006,0x0000,0x0002,0xffff,0xbdf7,0x800f,0x0000,0x0003,0xffff,0xffff,0x7bef,0x800e,0x0000,0x8003,
+    0xffff,0x0001,0x7bef,0x8007,0x0000,0x0001,0xa534,0x8005,0x0000,0x8004,0xffff,0x0002,0xd69a,0x8c71,0x8003,0x0000,
+    0x0003,0x9cd3,0xdedb,0xffff,0x8005,0x0000,0x800c,0xffff,0x8004,0x0000,0x0007,0x6b4d,0xffff,0x4a69,0x8c71,0xbdf7,
+    0xdedb,0xf79e,0x8005,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0003,0x8c71,0xffff,0x4a69,0x8004,0x0000,0x0001,0xc638,
+    0x8003,0xffff,0x0002,0xdedb,0x7bef,0x8004,0x0000,0x0003,0xc638,0xffff,0xa534,0x800e,0x0000,0x0004,0xf79e,0xffff,
+    0xf79e,0x4a69,0x800c,0x0000,0x0001,0xb596,0x8003,0xffff,0x0002,0xef5d,0x6b4d,0x800a,0x0000,0x0001,0xb596,0x8006,
+    0xffff,0x0003,0xd69a,0x9cd3,0x7bef,0x8004,0x0000,0x0003,0x8c71,0xb596,0xf79e,0x8003,0xffff
+};
+
+const uint16_t bmp165[149]   = // Bitmap 165 (RLE, 401 words raw)
 {
     0x1019, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xe71c,0x9cd3,0x0000,0x0000,0x6b4d,0xa534,0xf79e,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xf79e,0xffff,0xe71c,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x4a69,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t bmp166[126]   = // Bitmap 166
+    0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,
+    0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x000b,0xffff,0xffff,0xe71c,0x9cd3,0x0000,
+    0x0000,0x6b4d,0xa534,0xf79e,0xffff,0xffff,0x8005,0x0000,0x0002,0xffff,0xd69a,0x8006,0x0000,0x0003,0x4a69,0xd69a,
+    0xffff,0x8005,0x0000,0x0001,0xd69a,0x8008,0x0000,0x0002,0x4a69,0xf79e,0x8005,0x0000,0x0001,0x4a69,0x8009,0x0000,
+    0x0001,0xbdf7,0x8006,0x0000,0x0005,0x9cd3,0xf79e,0xffff,0xe71c,0x6b4d,0x8004,0x0000,0x0001,0x8c71,0x8005,0x0000,
+    0x0001,0x8c71,0x8004,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0001,0x4a69,0x8005,0x0000,0x0001,0xdedb,0x8005,0xffff,
+    0x800a,0x0000,0x0001,0xf79e,0x8005,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,
+    0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,
+    0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,
+    0x8006,0xffff,0x8005,0x0000
+};
+
+const uint16_t bmp166[7]   = // Bitmap 166 (RLE, 126 words raw)
 {
     0x0519, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t bmp167[289]   = // Bitmap 167
+    0x8014,0x0000,0x800a,0xffff,0x805f,0x0000
+};
+
+const uint16_t bmp167[134]   = // Bitmap 167 (RLE, 289 words raw)
 {
     0x0920, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0x9cd3,0x7bef,0x0000,0x0000,0x0000,0x9cd3,0xdedb,0xffff,0xffff
-};
-
-const uint16_t bmp168[401]   = // Bitmap 168
+    0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,
+    0x8016,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,
+    0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,
+    0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,
+    0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,
+    0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,
+    0x8004,0xffff,0x8005,0x0000,0x8003,0xffff,0x0001,0xa534,0x8004,0x0000,0x0002,0x8c71,0xb596,0x8007,0x0000,0x0002,
+    0xa534,0x8c71,0x8007,0x0000,0x0002,0xe71c,0x6b4d,0x8006,0x0000,0x0004,0xa534,0xffff,0x9cd3,0x7bef,0x8003,0x0000,
+    0x0004,0x9cd3,0xdedb,0xffff,0xffff
+};
+
+const uint16_t bmp168[223]   = // Bitmap 168 (RLE, 401 words raw)
 {
     0x1019, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0x8c71,0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xdedb,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xe71c
-};
-
-const uint16_t bmp169[126]   = // Bitmap 169
+    0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,
+    0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x800b,0xffff,0x8005,0x0000,0x8004,0xffff,0x0001,0x8c71,0x8004,0x0000,
+    0x0002,0x4a69,0xef5d,0x8005,0x0000,0x8003,0xffff,0x0001,0xd69a,0x8005,0x0000,0x0002,0xdedb,0xffff,0x8005,0x0000,
+    0x8003,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0003,0xc638,0xffff,0xffff,0x8005,0x0000,0x0003,0xffff,0xffff,0xbdf7,
+    0x8004,0x0000,0x0001,0xa534,0x8003,0xffff,0x8005,0x0000,0x0002,0xffff,0xf79e,0x8004,0x0000,0x0001,0x7bef,0x8004,
+    0xffff,0x8005,0x0000,0x0002,0xffff,0x8c71,0x8003,0x0000,0x0002,0x4a69,0xf79e,0x8004,0xffff,0x8005,0x0000,0x0001,
+    0xdedb,0x8004,0x0000,0x0001,0xe71c,0x8005,0xffff,0x8005,0x0000,0x0001,0x6b4d,0x8003,0x0000,0x0001,0x7bef,0x8006,
+    0xffff,0x800a,0x0000,0x0001,0xe71c,0x8005,0xffff,0x800a,0x0000,0x0001,0x8c71,0x8005,0xffff,0x800b,0x0000,0x0001,
+    0xe71c,0x8004,0xffff,0x8005,0x0000,0x0002,0x4a69,0xdedb,0x8004,0x0000,0x0001,0x8c71,0x8004,0xffff,0x8005,0x0000,
+    0x0003,0xd69a,0xffff,0xa534,0x8004,0x0000,0x0001,0xe71c,0x8003,0xffff,0x8005,0x0000,0x0003,0xffff,0xffff,0xf79e,
+    0x8004,0x0000,0x0001,0x8c71,0x8003,0xffff,0x8005,0x0000,0x8003,0xffff,0x0001,0xa534,0x8004,0x0000,0x0003,0xe71c,
+    0xffff,0xffff,0x8005,0x0000,0x8003,0xffff,0x0001,0xef5d,0x8004,0x0000,0x0003,0x8c71,0xffff,0xffff,0x8005,0x0000,
+    0x8004,0xffff,0x0001,0x8c71,0x8004,0x0000,0x0002,0xe71c,0xffff,0x8005,0x0000,0x8004,0xffff,0x0001,0xe71c,0x8004,
+    0x0000,0x0002,0x8c71,0xffff,0x8005,0x0000,0x8005,0xffff,0x0001,0x8c71,0x8004,0x0000,0x0001,0xe71c
+};
+
+const uint16_t bmp169[3]   = // Bitmap 169 (RLE, 126 words raw)
 {
     0x0519, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t bmp170[514]   = // Bitmap 170
+    0x807d,0x0000
+};
+
+const uint16_t bmp170[213]   = // Bitmap 170 (RLE, 514 words raw)
 {
     0x1b13, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xe71c,0xa534,0x6b4d,0x0000,0x0000,0x6b4d,0xb596,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xc638,0x7bef,0x0000,0x0000,0x6b4d,0xa534,0xf79e,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x0000,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xef5d,0x6b4d,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,0x0000,0x0000,0x0000,0x0000,0x6b4d,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xe71c,0x4a69,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xf79e,0xffff,0xf79e,0x7bef,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xef5d,0xffff,0xef5d,0x7bef,0x0000,0x0000,0x0000,0x0000,0x7bef,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,
-    0x0000,0x0000,0x0000
-};
-
-const uint16_t bmp171[305]   = // Bitmap 171
+    0x8004,0x0000,0x0009,0xffff,0xffff,0xe71c,0xa534,0x6b4d,0x0000,0x0000,0x6b4d,0xb596,0x8005,0xffff,0x0009,0xc638,
+    0x7bef,0x0000,0x0000,0x6b4d,0xa534,0xf79e,0xffff,0xffff,0x8004,0x0000,0x0002,0xffff,0x8c71,0x8007,0x0000,0x0005,
+    0x4a69,0xef5d,0xffff,0xef5d,0x6b4d,0x8006,0x0000,0x0003,0x4a69,0xd69a,0xffff,0x8004,0x0000,0x0001,0x6b4d,0x8009,
+    0x0000,0x0003,0x4a69,0xe71c,0x4a69,0x8008,0x0000,0x0002,0x4a69,0xf79e,0x801a,0x0000,0x0001,0xa534,0x8006,0x0000,
+    0x0005,0x9cd3,0xf79e,0xffff,0xf79e,0x7bef,0x8006,0x0000,0x0005,0x8c71,0xef5d,0xffff,0xef5d,0x7bef,0x8004,0x0000,
+    0x0001,0x7bef,0x8005,0x0000,0x0001,0x8c71,0x8004,0xffff,0x0001,0xdedb,0x8005,0x0000,0x0001,0x7bef,0x8004,0xffff,
+    0x0001,0xdedb,0x800a,0x0000,0x0001,0xdedb,0x8005,0xffff,0x8005,0x0000,0x0001,0xd69a,0x8005,0xffff,0x800a,0x0000,
+    0x0001,0xf79e,0x8005,0xffff,0x8005,0x0000,0x0001,0xef5d,0x8005,0xffff,0x800a,0x0000,0x8006,0xffff,0x8005,0x0000,
+    0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x8005,0x0000,
+    0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x8005,0x0000,
+    0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x8005,0x0000,
+    0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x8005,0x0000,
+    0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x8005,0x0000,
+    0x8006,0xffff,0x8005,0x0000
+};
+
+const uint16_t bmp171[120]   = // Bitmap 171 (RLE, 305 words raw)
 {
     0x1013, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xe71c,0xa534,0x6b4d,0x0000,0x0000,0x7bef,0xb596,0xf79e,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xf79e,0xffff,0xe71c,0x4a69,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t bmp172[362]   = // Bitmap 172
+    0x8004,0x0000,0x000c,0xffff,0xffff,0xe71c,0xa534,0x6b4d,0x0000,0x0000,0x7bef,0xb596,0xf79e,0xffff,0xffff,0x8004,
+    0x0000,0x0002,0xffff,0x9cd3,0x8007,0x0000,0x0003,0x4a69,0xd69a,0xffff,0x8004,0x0000,0x0001,0x7bef,0x8009,0x0000,
+    0x0002,0x4a69,0xf79e,0x800f,0x0000,0x0001,0xb596,0x8006,0x0000,0x0005,0x9cd3,0xf79e,0xffff,0xe71c,0x4a69,0x8004,
+    0x0000,0x0001,0x8c71,0x8005,0x0000,0x0001,0x8c71,0x8004,0xffff,0x0001,0xd69a,0x800a,0x0000,0x0001,0xdedb,0x8004,
+    0xffff,0x0001,0xf79e,0x800a,0x0000,0x0001,0xef5d,0x8005,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,
+    0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,
+    0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,
+    0xffff,0x800a,0x0000,0x8006,0xffff,0x8005,0x0000
+};
+
+const uint16_t bmp172[208]   = // Bitmap 172 (RLE, 362 words raw)
 {
     0x1313, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0xa534,0x7bef,0x0000,0x0000,0x0000,0x7bef,0xa534,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xef5d,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xf79e,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,
-    0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,
-    0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xf79e,0xffff,0xf79e,0xbdf7,0x4a69,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,
-    0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,
-    0xa534,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xa534,
-    0x7bef,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x7bef,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x7bef,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x7bef,
-    0xa534,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xb596,
-    0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,
-    0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xf79e,0xffff,0xf79e,0xbdf7,0x4a69,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,
-    0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,
-    0xffff,0xffff,0xd69a,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xef5d,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0xb596,0x7bef,0x0000,0x0000,0x0000,0x7bef,0xb596,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp173[443]   = // Bitmap 173
+    0x8005,0xffff,0x0003,0xe71c,0xa534,0x7bef,0x8003,0x0000,0x0003,0x7bef,0xa534,0xe71c,0x8008,0xffff,0x0002,0xef5d,
+    0x8c71,0x8009,0x0000,0x0002,0x8c71,0xf79e,0x8005,0xffff,0x0002,0xef5d,0x4a69,0x800b,0x0000,0x0002,0x4a69,0xef5d,
+    0x8003,0xffff,0x0002,0xf79e,0x4a69,0x800d,0x0000,0x0005,0x4a69,0xf79e,0xffff,0xffff,0x8c71,0x8005,0x0000,0x0006,
+    0xbdf7,0xf79e,0xffff,0xf79e,0xbdf7,0x4a69,0x8004,0x0000,0x0003,0x8c71,0xffff,0xe71c,0x8005,0x0000,0x0001,0xef5d,
+    0x8005,0xffff,0x0001,0xef5d,0x8005,0x0000,0x0002,0xe71c,0xa534,0x8004,0x0000,0x0001,0xa534,0x8007,0xffff,0x0001,
+    0xa534,0x8004,0x0000,0x0002,0xa534,0x7bef,0x8004,0x0000,0x0001,0xe71c,0x8007,0xffff,0x0001,0xe71c,0x8004,0x0000,
+    0x0001,0x7bef,0x8005,0x0000,0x8009,0xffff,0x800a,0x0000,0x8009,0xffff,0x800a,0x0000,0x8009,0xffff,0x8005,0x0000,
+    0x0001,0x7bef,0x8004,0x0000,0x0001,0xe71c,0x8007,0xffff,0x0001,0xe71c,0x8004,0x0000,0x0002,0x7bef,0xa534,0x8004,
+    0x0000,0x0001,0xa534,0x8007,0xffff,0x0001,0xa534,0x8004,0x0000,0x0002,0xb596,0xdedb,0x8005,0x0000,0x0001,0xef5d,
+    0x8005,0xffff,0x0001,0xef5d,0x8005,0x0000,0x0003,0xef5d,0xffff,0x7bef,0x8005,0x0000,0x0006,0xbdf7,0xf79e,0xffff,
+    0xf79e,0xbdf7,0x4a69,0x8004,0x0000,0x0004,0x9cd3,0xffff,0xffff,0xef5d,0x800e,0x0000,0x0001,0x4a69,0x8004,0xffff,
+    0x0002,0xd69a,0x4a69,0x800b,0x0000,0x0002,0x4a69,0xef5d,0x8005,0xffff,0x0002,0xef5d,0x8c71,0x8009,0x0000,0x0001,
+    0x8c71,0x8009,0xffff,0x0003,0xef5d,0xb596,0x7bef,0x8003,0x0000,0x0003,0x7bef,0xb596,0xef5d,0x8005,0xffff
+};
+
+const uint16_t bmp173[216]   = // Bitmap 173 (RLE, 443 words raw)
 {
     0x111a, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xd69a,0x8c71,0x0000,0x0000,0x0000,0x9cd3,0xd69a,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0xef5d,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xef5d,0xffff,0xf79e,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xc638,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xc638,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xe71c,0xffff,0xf79e,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xbdf7,0x7bef,0x0000,0x0000,0x7bef,0xc638,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp174[443]   = // Bitmap 174
+    0x8004,0x0000,0x0004,0xffff,0xffff,0xd69a,0x8c71,0x8003,0x0000,0x0002,0x9cd3,0xd69a,0x8004,0xffff,0x8004,0x0000,
+    0x0002,0xef5d,0x7bef,0x8007,0x0000,0x0001,0x8c71,0x8003,0xffff,0x8004,0x0000,0x0001,0x7bef,0x8009,0x0000,0x0003,
+    0x7bef,0xffff,0xffff,0x800f,0x0000,0x0002,0xb596,0xffff,0x8006,0x0000,0x0005,0x7bef,0xef5d,0xffff,0xf79e,0x7bef,
+    0x8005,0x0000,0x0001,0xf79e,0x8005,0x0000,0x0001,0x6b4d,0x8005,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xc638,
+    0x8005,0x0000,0x0001,0xd69a,0x8005,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0x8c71,0x8005,0x0000,0x0001,0xf79e,
+    0x8005,0xffff,0x0001,0xef5d,0x8004,0x0000,0x0001,0x6b4d,0x8005,0x0000,0x8007,0xffff,0x800a,0x0000,0x8007,0xffff,
+    0x800a,0x0000,0x8007,0xffff,0x800a,0x0000,0x0001,0xe71c,0x8005,0xffff,0x0001,0xef5d,0x8004,0x0000,0x0001,0x6b4d,
+    0x8005,0x0000,0x0001,0xbdf7,0x8005,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0x8c71,0x8005,0x0000,0x0001,0x4a69,
+    0x8005,0xffff,0x0001,0x7bef,0x8004,0x0000,0x0001,0xc638,0x8006,0x0000,0x0005,0x7bef,0xe71c,0xffff,0xf79e,0x9cd3,
+    0x8005,0x0000,0x0001,0xf79e,0x800f,0x0000,0x0002,0xa534,0xffff,0x8005,0x0000,0x0001,0x7bef,0x8008,0x0000,0x0003,
+    0x7bef,0xffff,0xffff,0x8005,0x0000,0x0002,0xffff,0x7bef,0x8006,0x0000,0x0001,0x7bef,0x8003,0xffff,0x8005,0x0000,
+    0x0008,0xffff,0xffff,0xbdf7,0x7bef,0x0000,0x0000,0x7bef,0xc638,0x8004,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,
+    0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,
+    0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff
+};
+
+const uint16_t bmp174[218]   = // Bitmap 174 (RLE, 443 words raw)
 {
     0x111a, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x4a69,0x0000,0x0000,0x7bef,0xbdf7,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xef5d,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xef5d,0xffff,0xf79e,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xc638,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x4a69,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x9cd3,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xc638,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xf79e,0xffff,0xe71c,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xef5d,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xbdf7,0x7bef,0x0000,0x0000,0x7bef,0xc638,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t bmp175[229]   = // Bitmap 175
+    0x8004,0xffff,0x0009,0xd69a,0x9cd3,0x4a69,0x0000,0x0000,0x7bef,0xbdf7,0xffff,0xffff,0x8004,0x0000,0x8003,0xffff,
+    0x0001,0x8c71,0x8007,0x0000,0x0002,0x6b4d,0xef5d,0x8004,0x0000,0x0003,0xffff,0xffff,0x7bef,0x8009,0x0000,0x0001,
+    0x7bef,0x8004,0x0000,0x0002,0xffff,0xb596,0x800f,0x0000,0x0001,0xf79e,0x8005,0x0000,0x0005,0x7bef,0xef5d,0xffff,
+    0xf79e,0x8c71,0x8006,0x0000,0x0001,0xc638,0x8004,0x0000,0x0001,0x6b4d,0x8005,0xffff,0x0001,0x6b4d,0x8005,0x0000,
+    0x0001,0x8c71,0x8004,0x0000,0x0001,0xd69a,0x8005,0xffff,0x0001,0xd69a,0x8005,0x0000,0x0001,0x4a69,0x8004,0x0000,
+    0x0001,0xef5d,0x8005,0xffff,0x0001,0xf79e,0x800a,0x0000,0x8007,0xffff,0x800a,0x0000,0x8007,0xffff,0x800a,0x0000,
+    0x8007,0xffff,0x8005,0x0000,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xf79e,0x8005,0xffff,0x0001,0xe71c,0x8005,0x0000,
+    0x0001,0x9cd3,0x8004,0x0000,0x0001,0xd69a,0x8005,0xffff,0x0001,0xbdf7,0x8005,0x0000,0x0001,0xc638,0x8004,0x0000,
+    0x0001,0x7bef,0x8004,0xffff,0x0002,0xf79e,0x4a69,0x8005,0x0000,0x0001,0xf79e,0x8005,0x0000,0x0005,0x9cd3,0xf79e,
+    0xffff,0xe71c,0x7bef,0x8006,0x0000,0x0002,0xffff,0xb596,0x800f,0x0000,0x0003,0xffff,0xffff,0x6b4d,0x8008,0x0000,
+    0x0001,0x7bef,0x8005,0x0000,0x0004,0xffff,0xffff,0xef5d,0x7bef,0x8006,0x0000,0x0002,0x7bef,0xffff,0x8005,0x0000,
+    0x8004,0xffff,0x0008,0xbdf7,0x7bef,0x0000,0x0000,0x7bef,0xc638,0xffff,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,
+    0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,
+    0x0000,0x800c,0xffff,0x8005,0x0000,0x800c,0xffff,0x8005,0x0000
+};
+
+const uint16_t bmp175[104]   = // Bitmap 175 (RLE, 229 words raw)
 {
     0x0c13, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xef5d,0x9cd3,0x4a69,0x0000,0x4a69,0x9cd3,0xe71c,
-    0x0000,0x0000,0x0000,0x0000,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0x0000,0x0000,0x0000,0x0000,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp176[305]   = // Bitmap 176
+    0x8004,0x0000,0x0008,0xffff,0xef5d,0x9cd3,0x4a69,0x0000,0x4a69,0x9cd3,0xe71c,0x8004,0x0000,0x0002,0xef5d,0x4a69,
+    0x8005,0x0000,0x0001,0x6b4d,0x8004,0x0000,0x0001,0x6b4d,0x8006,0x0000,0x0001,0xc638,0x800b,0x0000,0x0001,0xffff,
+    0x800a,0x0000,0x0002,0x9cd3,0xffff,0x8006,0x0000,0x0001,0xa534,0x8005,0xffff,0x8005,0x0000,0x0001,0x8c71,0x8006,
+    0xffff,0x8005,0x0000,0x0001,0xc638,0x8006,0xffff,0x8005,0x0000,0x0001,0xe71c,0x8006,0xffff,0x8005,0x0000,0x0001,
+    0xf79e,0x8006,0xffff,0x8005,0x0000,0x8007,0xffff,0x8005,0x0000,0x8007,0xffff,0x8005,0x0000,0x8007,0xffff,0x8005,
+    0x0000,0x8007,0xffff,0x8005,0x0000,0x8007,0xffff,0x8005,0x0000,0x8007,0xffff,0x8005,0x0000,0x8007,0xffff,0x8005,
+    0x0000,0x8007,0xffff,0x8005,0x0000,0x8007,0xffff
+};
+
+const uint16_t bmp176[184]   = // Bitmap 176 (RLE, 305 words raw)
 {
     0x1013, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xc638,0x8c71,0x4a69,0x0000,0x0000,0x0000,0x6b4d,0x8c71,0xc638,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,
-    0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,
-    0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xf79e,0x7bef,0x0000,0x0000,0x0000,0x0000,0x7bef,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xf79e,0x4a69,0x8c71,0xbdf7,0xdedb,0xf79e,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xd69a,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xbdf7,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0xb596,0x4a69,0x0000,0x0000,0x0000,0x0000,0x6b4d,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xf79e,0xdedb,0xbdf7,0x8c71,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0x7bef,0xdedb,0xffff,0xffff,0xef5d,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x7bef,
-    0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0xffff,0xffff,0xc638,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xf79e,0xc638,0x8c71,0x4a69,0x0000,0x0000,0x0000,0x8c71,0xb596,0xef5d,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp177[276]   = // Bitmap 177
+    0x8004,0xffff,0x0003,0xc638,0x8c71,0x4a69,0x8003,0x0000,0x0003,0x6b4d,0x8c71,0xc638,0x8005,0xffff,0x0002,0xef5d,
+    0x4a69,0x8009,0x0000,0x0006,0x4a69,0xd69a,0xffff,0xffff,0xf79e,0x4a69,0x800c,0x0000,0x0003,0xe71c,0xffff,0xa534,
+    0x8004,0x0000,0x0005,0xa534,0xffff,0xffff,0xf79e,0x7bef,0x8004,0x0000,0x0003,0x7bef,0xffff,0x4a69,0x8004,0x0000,
+    0x8004,0xffff,0x0007,0xf79e,0x4a69,0x8c71,0xbdf7,0xdedb,0xf79e,0xffff,0x8005,0x0000,0x0001,0xe71c,0x800a,0xffff,
+    0x0001,0x6b4d,0x8005,0x0000,0x0002,0xa534,0xdedb,0x8008,0xffff,0x0001,0xbdf7,0x8008,0x0000,0x0002,0x9cd3,0xd69a,
+    0x8006,0xffff,0x0001,0x7bef,0x8009,0x0000,0x0002,0x4a69,0xbdf7,0x8005,0xffff,0x0001,0xa534,0x800a,0x0000,0x0001,
+    0x7bef,0x8006,0xffff,0x0002,0xc638,0x8c71,0x8008,0x0000,0x0001,0xbdf7,0x8008,0xffff,0x0003,0xdedb,0xb596,0x4a69,
+    0x8004,0x0000,0x0001,0x6b4d,0x800a,0xffff,0x0001,0xf79e,0x8005,0x0000,0x0006,0xf79e,0xdedb,0xbdf7,0x8c71,0x4a69,
+    0xef5d,0x8005,0xffff,0x8005,0x0000,0x0001,0x8c71,0x8004,0x0000,0x0006,0x7bef,0xdedb,0xffff,0xffff,0xef5d,0x9cd3,
+    0x8004,0x0000,0x0002,0x7bef,0xe71c,0x800e,0x0000,0x0003,0xd69a,0xffff,0xbdf7,0x800c,0x0000,0x0001,0xa534,0x8003,
+    0xffff,0x0002,0xc638,0x4a69,0x8009,0x0000,0x0001,0xa534,0x8005,0xffff,0x0004,0xf79e,0xc638,0x8c71,0x4a69,0x8003,
+    0x0000,0x0003,0x8c71,0xb596,0xef5d,0x8003,0xffff
+};
+
+const uint16_t bmp177[117]   = // Bitmap 177 (RLE, 276 words raw)
 {
     0x0b19, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x8c71,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdedb,0x6b4d,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xef5d,0xef5d,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,
-    0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,
-    0xffff,0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,
-    0xffff,0xffff,0xffff,0xffff,0xb596,0x6b4d,0x0000,0x0000,0x4a69,0x8c71,0xc638
-};
-
-const uint16_t bmp178[305]   = // Bitmap 178
+    0x8005,0xffff,0x0002,0xf79e,0x8c71,0x8008,0xffff,0x0003,0xbdf7,0x0000,0x0000,0x8006,0xffff,0x0002,0xdedb,0x6b4d,
+    0x8003,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8004,0xffff,
+    0x802c,0x0000,0x0002,0xffff,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,
+    0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,
+    0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x0007,
+    0xd69a,0xffff,0xef5d,0xef5d,0xffff,0xffff,0x7bef,0x8007,0x0000,0x0004,0xa534,0xffff,0xffff,0xa534,0x8007,0x0000,
+    0x0005,0x8c71,0xffff,0xffff,0xf79e,0x4a69,0x8006,0x0000,0x0001,0x4a69,0x8004,0xffff,0x0007,0xb596,0x6b4d,0x0000,
+    0x0000,0x4a69,0x8c71,0xc638
+};
+
+const uint16_t bmp178[123]   = // Bitmap 178 (RLE, 305 words raw)
 {
     0x1013, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x4a69,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0x4a69,0xe71c,0xffff,0xf79e,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xb596,0x7bef,0x0000,0x0000,0x6b4d,0x9cd3,0xd69a,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t bmp179[362]   = // Bitmap 179
+    0x8005,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,
+    0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,
+    0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8006,0xffff,0x800a,0x0000,0x8005,0xffff,
+    0x0001,0xf79e,0x800a,0x0000,0x0001,0xf79e,0x8004,0xffff,0x0001,0xdedb,0x8005,0x0000,0x0001,0x4a69,0x8004,0x0000,
+    0x0001,0xd69a,0x8004,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,0x8c71,0x8004,0x0000,0x0005,0x4a69,0xe71c,0xffff,
+    0xf79e,0x9cd3,0x8006,0x0000,0x0001,0xc638,0x800f,0x0000,0x0002,0xffff,0x4a69,0x8009,0x0000,0x0001,0x7bef,0x8004,
+    0x0000,0x0003,0xffff,0xef5d,0x4a69,0x8007,0x0000,0x0002,0x7bef,0xffff,0x8004,0x0000,0x8003,0xffff,0x0009,0xb596,
+    0x7bef,0x0000,0x0000,0x6b4d,0x9cd3,0xd69a,0xffff,0xffff,0x8004,0x0000
+};
+
+const uint16_t bmp179[244]   = // Bitmap 179 (RLE, 362 words raw)
 {
     0x1313, // Width and height
-    0xdedb,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xdedb,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,
-    0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,
-    0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,
-    0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0xe71c,0xffff,0xef5d,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0xa534,0xffff,0xb596,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x4a69,0xffff,0x6b4d,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x9cd3,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp180[552]   = // Bitmap 180
+    0x0001,0xdedb,0x8004,0x0000,0x0001,0xa534,0x8007,0xffff,0x0001,0xa534,0x8004,0x0000,0x0003,0xdedb,0xffff,0x4a69,
+    0x8003,0x0000,0x0001,0x6b4d,0x8007,0xffff,0x0001,0x6b4d,0x8003,0x0000,0x0004,0x4a69,0xffff,0xffff,0xa534,0x8004,
+    0x0000,0x0001,0xf79e,0x8005,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0004,0xa534,0xffff,0xffff,0xef5d,0x8004,0x0000,
+    0x0001,0xd69a,0x8005,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0xef5d,0x8003,0xffff,0x0001,0x6b4d,0x8003,0x0000,
+    0x0001,0xa534,0x8005,0xffff,0x0001,0xa534,0x8003,0x0000,0x0001,0x6b4d,0x8004,0xffff,0x0001,0xc638,0x8003,0x0000,
+    0x0001,0x6b4d,0x8005,0xffff,0x0001,0x6b4d,0x8003,0x0000,0x0001,0xbdf7,0x8004,0xffff,0x0001,0xf79e,0x8004,0x0000,
+    0x0001,0xf79e,0x8003,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0001,0xf79e,0x8005,0xffff,0x0001,0x8c71,0x8003,0x0000,
+    0x0001,0xc638,0x8003,0xffff,0x0001,0xc638,0x8003,0x0000,0x0001,0x7bef,0x8006,0xffff,0x0001,0xd69a,0x8003,0x0000,
+    0x0001,0x9cd3,0x8003,0xffff,0x0001,0x9cd3,0x8003,0x0000,0x0001,0xd69a,0x8007,0xffff,0x0004,0x4a69,0x0000,0x0000,
+    0x4a69,0x8003,0xffff,0x0001,0x4a69,0x8003,0x0000,0x8008,0xffff,0x0001,0xa534,0x8003,0x0000,0x0003,0xe71c,0xffff,
+    0xef5d,0x8003,0x0000,0x0001,0x9cd3,0x8008,0xffff,0x0001,0xdedb,0x8003,0x0000,0x0003,0xa534,0xffff,0xb596,0x8003,
+    0x0000,0x0001,0xdedb,0x8009,0xffff,0x0009,0x6b4d,0x0000,0x0000,0x4a69,0xffff,0x6b4d,0x0000,0x0000,0x4a69,0x800a,
+    0xffff,0x0001,0xb596,0x8003,0x0000,0x0001,0x9cd3,0x8003,0x0000,0x0001,0xa534,0x800a,0xffff,0x0001,0xf79e,0x8007,
+    0x0000,0x0001,0xe71c,0x800b,0xffff,0x0001,0x7bef,0x8005,0x0000,0x0001,0x6b4d,0x800c,0xffff,0x0001,0xc638,0x8005,
+    0x0000,0x0001,0xb596,0x800d,0xffff,0x8005,0x0000,0x0001,0xf79e,0x800d,0xffff,0x0001,0x9cd3,0x8003,0x0000,0x0001,
+    0x7bef,0x8007,0xffff
+};
+
+const uint16_t bmp180[373]   = // Bitmap 180 (RLE, 552 words raw)
 {
     0x1d13, // Width and height
-    0x6b4d,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xb596,
-    0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xb596,0xef5d,0x0000,
-    0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0x6b4d,0x0000,
-    0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xb596,0x0000,0x0000,
-    0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,
-    0x0000,0xbdf7,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,
-    0x7bef,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,
-    0xffff,0x7bef,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0xa534,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xffff,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xd69a,0x0000,
-    0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0x9cd3,0x0000,0x0000,0x0000,0x8c71,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xa534,0x0000,0x0000,
-    0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x4a69,0xffff,0x4a69,
-    0x0000,0x0000,0x0000,0xc638,0xffff,0xc638,0x0000,0x0000,0x0000,0x4a69,0xffff,0x4a69,0x0000,0x0000,0x0000,
-    0x9cd3,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xc638,0x0000,0x0000,
-    0x0000,0x0000,0xef5d,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0xc638,0x0000,0x0000,0x0000,0x0000,0xd69a,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6b4d,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,
-    0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,
-    0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp181[362]   = // Bitmap 181
+    0x0001,0x6b4d,0x8004,0x0000,0x8006,0xffff,0x0001,0xef5d,0x8005,0x0000,0x0001,0xe71c,0x8006,0xffff,0x8004,0x0000,
+    0x0002,0x6b4d,0xb596,0x8004,0x0000,0x0001,0xd69a,0x8005,0xffff,0x0001,0xc638,0x8005,0x0000,0x0001,0xb596,0x8005,
+    0xffff,0x0001,0xd69a,0x8004,0x0000,0x0002,0xb596,0xef5d,0x8004,0x0000,0x0001,0xa534,0x8005,0xffff,0x0001,0x9cd3,
+    0x8005,0x0000,0x0001,0x7bef,0x8005,0xffff,0x0001,0xa534,0x8004,0x0000,0x0003,0xef5d,0xffff,0x6b4d,0x8003,0x0000,
+    0x0001,0x4a69,0x8005,0xffff,0x8007,0x0000,0x8005,0xffff,0x0001,0x4a69,0x8003,0x0000,0x0004,0x6b4d,0xffff,0xffff,
+    0xb596,0x8004,0x0000,0x0001,0xef5d,0x8003,0xffff,0x0001,0xdedb,0x8007,0x0000,0x0001,0xd69a,0x8003,0xffff,0x0001,
+    0xef5d,0x8004,0x0000,0x0004,0xb596,0xffff,0xffff,0xe71c,0x8004,0x0000,0x0001,0xbdf7,0x8003,0xffff,0x0001,0xb596,
+    0x8007,0x0000,0x0001,0xa534,0x8003,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0001,0xe71c,0x8003,0xffff,0x0001,0x4a69,
+    0x8003,0x0000,0x0001,0x7bef,0x8003,0xffff,0x0001,0x6b4d,0x8007,0x0000,0x0001,0x6b4d,0x8003,0xffff,0x0001,0x7bef,
+    0x8003,0x0000,0x0001,0x4a69,0x8004,0xffff,0x0001,0xa534,0x8004,0x0000,0x0003,0xffff,0xffff,0xf79e,0x8004,0x0000,
+    0x0001,0xa534,0x8004,0x0000,0x0003,0xf79e,0xffff,0xffff,0x8004,0x0000,0x0001,0xa534,0x8004,0xffff,0x0001,0xdedb,
+    0x8004,0x0000,0x0003,0xd69a,0xffff,0xd69a,0x8004,0x0000,0x0001,0xffff,0x8004,0x0000,0x0003,0xc638,0xffff,0xd69a,
+    0x8004,0x0000,0x0001,0xdedb,0x8005,0xffff,0x0001,0x4a69,0x8003,0x0000,0x0003,0xa534,0xffff,0x9cd3,0x8003,0x0000,
+    0x0003,0x8c71,0xffff,0x9cd3,0x8003,0x0000,0x0003,0x9cd3,0xffff,0xa534,0x8003,0x0000,0x0001,0x4a69,0x8006,0xffff,
+    0x0001,0xa534,0x8003,0x0000,0x0003,0x4a69,0xffff,0x4a69,0x8003,0x0000,0x0003,0xc638,0xffff,0xc638,0x8003,0x0000,
+    0x0003,0x4a69,0xffff,0x4a69,0x8003,0x0000,0x0001,0x9cd3,0x8006,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0xc638,
+    0x8004,0x0000,0x0003,0xef5d,0xffff,0xf79e,0x8004,0x0000,0x0001,0xc638,0x8004,0x0000,0x0001,0xd69a,0x8007,0xffff,
+    0x8008,0x0000,0x0001,0x6b4d,0x8003,0xffff,0x0001,0x6b4d,0x8008,0x0000,0x8008,0xffff,0x0001,0x9cd3,0x8007,0x0000,
+    0x0001,0xa534,0x8003,0xffff,0x0001,0xb596,0x8007,0x0000,0x0001,0x9cd3,0x8008,0xffff,0x0001,0xd69a,0x8007,0x0000,
+    0x0001,0xd69a,0x8003,0xffff,0x0001,0xdedb,0x8007,0x0000,0x0001,0xd69a,0x8009,0xffff,0x8007,0x0000,0x8005,0xffff,
+    0x8007,0x0000,0x800a,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,0x7bef,0x8005,0xffff,0x0001,0x9cd3,0x8005,0x0000,
+    0x0001,0x7bef,0x800a,0xffff,0x0001,0xc638,0x8005,0x0000,0x0001,0xbdf7,0x8005,0xffff,0x0001,0xc638,0x8005,0x0000,
+    0x0001,0xc638,0x800a,0xffff,0x0001,0xf79e,0x8005,0x0000,0x0001,0xe71c,0x8005,0xffff,0x0001,0xf79e,0x8005,0x0000,
+    0x0001,0xf79e,0x8005,0xffff
+};
+
+const uint16_t bmp181[234]   = // Bitmap 181 (RLE, 362 words raw)
 {
     0x1313, // Width and height
-    0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,
-    0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,
-    0xffff,0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x4a69,0xe71c,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x4a69,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,
-    0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,
-    0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,
-    0xef5d,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xef5d
-};
-
-const uint16_t bmp182[495]   = // Bitmap 182
+    0x0002,0xffff,0xe71c,0x8004,0x0000,0x0001,0x6b4d,0x8005,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xe71c,0x8003,
+    0xffff,0x0001,0xa534,0x8004,0x0000,0x0001,0xd69a,0x8003,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0001,0xa534,0x8004,
+    0xffff,0x0002,0xf79e,0x4a69,0x8003,0x0000,0x0001,0x4a69,0x8003,0xffff,0x0001,0x4a69,0x8003,0x0000,0x0001,0x4a69,
+    0x8006,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0003,0xbdf7,0xffff,0xa534,0x8004,0x0000,0x0001,0xc638,0x8007,0xffff,
+    0x0001,0x4a69,0x8003,0x0000,0x0002,0x4a69,0xe71c,0x8004,0x0000,0x0001,0x7bef,0x8008,0xffff,0x0001,0xd69a,0x8004,
+    0x0000,0x0001,0x4a69,0x8004,0x0000,0x0001,0xe71c,0x8009,0xffff,0x0001,0x7bef,0x8007,0x0000,0x0001,0xa534,0x800a,
+    0xffff,0x0001,0xe71c,0x8006,0x0000,0x0001,0x4a69,0x800c,0xffff,0x0001,0x9cd3,0x8005,0x0000,0x0001,0xc638,0x800c,
+    0xffff,0x0001,0xbdf7,0x8005,0x0000,0x0001,0xc638,0x800b,0xffff,0x0002,0xf79e,0x4a69,0x8005,0x0000,0x0002,0x4a69,
+    0xf79e,0x800a,0xffff,0x0001,0x8c71,0x8007,0x0000,0x0001,0x8c71,0x8009,0xffff,0x0001,0xd69a,0x8009,0x0000,0x0001,
+    0xdedb,0x8008,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0001,0xbdf7,0x8004,0x0000,0x0001,0x4a69,0x8007,0xffff,0x0001,
+    0x9cd3,0x8004,0x0000,0x0003,0xbdf7,0xffff,0x9cd3,0x8004,0x0000,0x0001,0xa534,0x8005,0xffff,0x0001,0xe71c,0x8004,
+    0x0000,0x0001,0x7bef,0x8003,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0001,0xe71c,0x8004,0xffff,0x0001,0x6b4d,0x8004,
+    0x0000,0x0001,0xe71c,0x8003,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0001,0x6b4d,0x8003,0xffff,0x0001,0xb596,0x8004,
+    0x0000,0x0001,0xb596,0x8005,0xffff,0x0001,0xa534,0x8004,0x0000,0x0003,0xbdf7,0xffff,0xef5d,0x8004,0x0000,0x0001,
+    0x6b4d,0x8007,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xef5d
+};
+
+const uint16_t bmp182[295]   = // Bitmap 182 (RLE, 495 words raw)
 {
     0x131a, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,
-    0x9cd3,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x9cd3,
-    0xdedb,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0xdedb,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x6b4d,0xffff,
-    0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,
-    0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,
-    0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0xb596,0xffff,0xb596,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x6b4d,0xffff,0x6b4d,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0xd69a,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xf79e,0xffff,0xffff,0xef5d,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x8c71,0x0000,0x0000,0x0000,0x4a69,0x9cd3,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp183[305]   = // Bitmap 183
+    0x8004,0x0000,0x0001,0x6b4d,0x8009,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0001,0x9cd3,0x8004,0x0000,0x0001,0xef5d,
+    0x8007,0xffff,0x0001,0xef5d,0x8004,0x0000,0x0002,0x9cd3,0xdedb,0x8004,0x0000,0x0001,0xb596,0x8007,0xffff,0x0001,
+    0xb596,0x8004,0x0000,0x0003,0xdedb,0xffff,0x4a69,0x8003,0x0000,0x0001,0x6b4d,0x8007,0xffff,0x0001,0x6b4d,0x8003,
+    0x0000,0x0004,0x6b4d,0xffff,0xffff,0xb596,0x8004,0x0000,0x0001,0xef5d,0x8005,0xffff,0x0001,0xef5d,0x8004,0x0000,
+    0x0004,0xb596,0xffff,0xffff,0xf79e,0x8004,0x0000,0x0001,0xb596,0x8005,0xffff,0x0001,0xb596,0x8004,0x0000,0x0001,
+    0xf79e,0x8003,0xffff,0x0001,0x7bef,0x8003,0x0000,0x0001,0x6b4d,0x8005,0xffff,0x0001,0x6b4d,0x8003,0x0000,0x0001,
+    0x8c71,0x8004,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0xef5d,0x8003,0xffff,0x0001,0xef5d,0x8004,0x0000,0x0001,
+    0xd69a,0x8005,0xffff,0x8004,0x0000,0x0001,0xb596,0x8003,0xffff,0x0001,0xb596,0x8003,0x0000,0x0001,0x4a69,0x8006,
+    0xffff,0x0001,0xa534,0x8003,0x0000,0x0001,0x6b4d,0x8003,0xffff,0x0001,0x6b4d,0x8003,0x0000,0x0001,0xa534,0x8006,
+    0xffff,0x0001,0xdedb,0x8004,0x0000,0x0003,0xef5d,0xffff,0xef5d,0x8004,0x0000,0x0001,0xef5d,0x8007,0xffff,0x0001,
+    0x6b4d,0x8003,0x0000,0x0003,0xb596,0xffff,0xb596,0x8003,0x0000,0x0001,0x6b4d,0x8008,0xffff,0x0001,0xb596,0x8003,
+    0x0000,0x0003,0x6b4d,0xffff,0x6b4d,0x8003,0x0000,0x0001,0xc638,0x8008,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0001,
+    0xd69a,0x8004,0x0000,0x800a,0xffff,0x0001,0x8c71,0x8007,0x0000,0x0001,0x9cd3,0x800a,0xffff,0x0001,0xd69a,0x8007,
+    0x0000,0x0001,0xdedb,0x800b,0xffff,0x0001,0x4a69,0x8005,0x0000,0x0001,0x4a69,0x800c,0xffff,0x0001,0xa534,0x8005,
+    0x0000,0x0001,0xb596,0x800c,0xffff,0x0001,0xe71c,0x8005,0x0000,0x0001,0xf79e,0x800c,0xffff,0x0001,0xe71c,0x8004,
+    0x0000,0x0001,0x7bef,0x800d,0xffff,0x0001,0x7bef,0x8004,0x0000,0x0001,0xc638,0x8008,0xffff,0x0005,0xf79e,0xffff,
+    0xffff,0xef5d,0x9cd3,0x8004,0x0000,0x0001,0x4a69,0x8009,0xffff,0x8009,0x0000,0x0001,0xbdf7,0x8009,0xffff,0x8008,
+    0x0000,0x0001,0x6b4d,0x800a,0xffff,0x8007,0x0000,0x0002,0x6b4d,0xef5d,0x800a,0xffff,0x0001,0x8c71,0x8003,0x0000,
+    0x0003,0x4a69,0x9cd3,0xd69a,0x800b,0xffff
+};
+
+const uint16_t bmp183[116]   = // Bitmap 183 (RLE, 305 words raw)
 {
     0x1013, // Width and height
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xa534,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t bmp187[122]   = // Bitmap 187
+    0x0001,0xffff,0x800e,0x0000,0x0002,0xffff,0xffff,0x800e,0x0000,0x0002,0xffff,0xffff,0x800e,0x0000,0x0002,0xffff,
+    0xffff,0x800e,0x0000,0x800a,0xffff,0x0001,0xc638,0x8004,0x0000,0x0001,0xa534,0x8009,0xffff,0x0001,0xd69a,0x8004,
+    0x0000,0x0001,0xa534,0x8009,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0x7bef,0x8009,0xffff,0x0001,0xe71c,0x8004,
+    0x0000,0x0001,0x7bef,0x8009,0xffff,0x0002,0xef5d,0x4a69,0x8003,0x0000,0x0001,0x6b4d,0x8009,0xffff,0x0002,0xef5d,
+    0x4a69,0x8003,0x0000,0x0002,0x4a69,0xef5d,0x8009,0xffff,0x0001,0x7bef,0x8003,0x0000,0x0002,0x4a69,0xef5d,0x8009,
+    0xffff,0x0001,0x7bef,0x8004,0x0000,0x0001,0xd69a,0x8009,0xffff,0x0001,0x8c71,0x8004,0x0000,0x0001,0xd69a,0x8009,
+    0xffff,0x0001,0xa534,0x8004,0x0000,0x0001,0xd69a,0x8009,0xffff,0x0001,0xa534,0x8004,0x0000,0x0001,0xd69a,0x800a,
+    0xffff,0x8040,0x0000
+};
+
+const uint16_t bmp187[107]   = // Bitmap 187 (RLE, 122 words raw)
 {
     0x0b0b, // Width and height
-    0xffff,0xffff,0xf79e,0xa534,0x4a69,0x0000,0x4a69,0xa534,0xf79e,0xffff,0xffff,
-    0xffff,0xd69a,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,
-    0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,
-    0xa534,0x0000,0x0000,0x7bef,0xe71c,0xffff,0xe71c,0x7bef,0x0000,0x0000,0xa534,
-    0x4a69,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x4a69,
-    0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x4a69,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x4a69,
-    0xa534,0x0000,0x0000,0x7bef,0xe71c,0xffff,0xe71c,0x7bef,0x0000,0x0000,0xa534,
-    0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,
-    0xffff,0xd69a,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,
-    0xffff,0xffff,0xf79e,0xa534,0x4a69,0x0000,0x4a69,0xa534,0xf79e,0xffff,0xffff
+    0x0009,0xffff,0xffff,0xf79e,0xa534,0x4a69,0x0000,0x4a69,0xa534,0xf79e,0x8003,0xffff,0x0002,0xd69a,0x4a69,0x8005,
+    0x0000,0x0005,0x4a69,0xd69a,0xffff,0xf79e,0x4a69,0x8007,0x0000,0x0011,0x4a69,0xf79e,0xa534,0x0000,0x0000,0x7bef,
+    0xe71c,0xffff,0xe71c,0x7bef,0x0000,0x0000,0xa534,0x4a69,0x0000,0x0000,0xe71c,0x8003,0xffff,0x0004,0xe71c,0x0000,
+    0x0000,0x4a69,0x8003,0x0000,0x8005,0xffff,0x8003,0x0000,0x0004,0x4a69,0x0000,0x0000,0xe71c,0x8003,0xffff,0x0011,
+    0xe71c,0x0000,0x0000,0x4a69,0xa534,0x0000,0x0000,0x7bef,0xe71c,0xffff,0xe71c,0x7bef,0x0000,0x0000,0xa534,0xf79e,
+    0x4a69,0x8007,0x0000,0x0005,0x4a69,0xf79e,0xffff,0xd69a,0x4a69,0x8005,0x0000,0x0002,0x4a69,0xd69a,0x8003,0xffff,
+    0x0009,0xf79e,0xa534,0x4a69,0x0000,0x4a69,0xa534,0xf79e,0xffff,0xffff
 };
 
-const uint16_t bmp188[286]   = // Bitmap 188
+const uint16_t bmp188[229]   = // Bitmap 188 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp189[286]   = // Bitmap 189
+    0x8004,0xffff,0x0001,0xfdac,0x8004,0x0000,0x0001,0x0336,0x8008,0xffff,0x0001,0xb320,0x8006,0x0000,0x0002,0x000c,
+    0xb7ff,0x8005,0xffff,0x000b,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0x8003,
+    0xffff,0x0004,0xfff6,0x6000,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfed2,0x3800,0x0000,0x65bf,0x8003,0xffff,0x0004,
+    0xfdac,0x0000,0x000c,0xb7ff,0x8005,0xffff,0x0003,0xb320,0x0000,0x0336,0x8003,0xffff,0x0004,0xb320,0x0000,0x01d2,
+    0xdfff,0x8005,0xffff,0x0009,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0x8006,0xffff,0x0009,
+    0xfdac,0x0000,0x0007,0x96df,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0009,0xfed2,0x3800,0x0007,0x96df,
+    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0x8006,0xffff,0x0009,0xfed2,0x3800,0x0007,0x96df,0xffff,0xfff6,0x6000,0x0000,
+    0x3c9b,0x8006,0xffff,0x0009,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0x8006,0xffff,0x0009,
+    0xfed2,0x3800,0x0007,0x96df,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0009,0xfed2,0x3800,0x0007,0x96df,
+    0xffff,0xfffb,0x91c0,0x0000,0x0336,0x8006,0xffff,0x000a,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xb320,0x0000,
+    0x01d2,0xdfff,0x8005,0xffff,0x000a,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0x8005,
+    0xffff,0x0003,0xb320,0x0000,0x0336,0x8003,0xffff,0x0004,0xfff6,0x6000,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfed2,
+    0x3800,0x0000,0x65bf,0x8004,0xffff,0x000b,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,
+    0xdfff,0x8005,0xffff,0x0001,0xb320,0x8006,0x0000,0x0002,0x000c,0xb7ff,0x8007,0xffff,0x0001,0xfdac,0x8004,0x0000,
+    0x0001,0x0336,0x8005,0xffff
+};
+
+const uint16_t bmp189[137]   = // Bitmap 189 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x000c,0x6320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0336,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x380c,0xb7ff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp190[286]   = // Bitmap 190
+    0x8007,0xffff,0x0003,0xfff6,0x6000,0x0336,0x800b,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x0336,0x800a,0xffff,0x0005,
+    0xfffb,0x91c0,0x0000,0x0000,0x0336,0x8009,0xffff,0x0002,0xfff6,0x6000,0x8003,0x0000,0x0001,0x0336,0x8008,0xffff,
+    0x0007,0xb320,0x0000,0x0000,0x000c,0x6320,0x0000,0x0336,0x8007,0xffff,0x0008,0xfed2,0x3800,0x0000,0x0336,0xffff,
+    0xb320,0x0000,0x0336,0x8007,0xffff,0x0008,0xfed2,0x380c,0xb7ff,0xffff,0xffff,0xb320,0x0000,0x0336,0x800c,0xffff,
+    0x0003,0xb320,0x0000,0x0336,0x800c,0xffff,0x0003,0xb320,0x0000,0x0336,0x800c,0xffff,0x0003,0xb320,0x0000,0x0336,
+    0x800c,0xffff,0x0003,0xb320,0x0000,0x0336,0x800c,0xffff,0x0003,0xb320,0x0000,0x0336,0x800c,0xffff,0x0003,0xb320,
+    0x0000,0x0336,0x800c,0xffff,0x0003,0xb320,0x0000,0x0336,0x800c,0xffff,0x0003,0xb320,0x0000,0x0336,0x800c,0xffff,
+    0x0003,0xb320,0x0000,0x0336,0x800c,0xffff,0x0003,0xb320,0x0000,0x0336,0x800c,0xffff,0x0003,0xb320,0x0000,0x0336,
+    0x800c,0xffff,0x0003,0xb320,0x0000,0x0336,0x8005,0xffff
+};
+
+const uint16_t bmp190[175]   = // Bitmap 190 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,
-    0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff
-};
-
-const uint16_t bmp191[286]   = // Bitmap 191
+    0x8004,0xffff,0x0001,0xdc87,0x8004,0x0000,0x0002,0x000c,0xb7ff,0x8006,0xffff,0x0002,0xfff6,0x6000,0x8007,0x0000,
+    0x0001,0x3c9b,0x8004,0xffff,0x000c,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,
+    0x65bf,0x8003,0xffff,0x0004,0xfdac,0x0000,0x0000,0x65bf,0x8004,0xffff,0x000b,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,
+    0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0009,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xb320,
+    0x0000,0x0336,0x8006,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800b,0xffff,0x0004,0xdc87,0x0000,0x000c,0xb7ff,
+    0x800a,0xffff,0x0004,0xfff6,0x6000,0x0000,0x0336,0x800b,0xffff,0x0004,0xb320,0x0000,0x0007,0x96df,0x800a,0xffff,
+    0x0004,0xb320,0x0000,0x0000,0x3c9b,0x800a,0xffff,0x0004,0xb320,0x0000,0x0000,0x3c9b,0x8009,0xffff,0x0005,0xfffb,
+    0x91c0,0x0000,0x0000,0x3c9b,0x8009,0xffff,0x0005,0xfff6,0x6000,0x0000,0x0000,0x3c9b,0x8009,0xffff,0x0005,0xfed2,
+    0x3800,0x0000,0x0000,0x65bf,0x8009,0xffff,0x0005,0xfff6,0x6000,0x0000,0x0007,0x96df,0x8009,0xffff,0x0005,0xfffb,
+    0x91c0,0x0000,0x0007,0x96df,0x800a,0xffff,0x0004,0xdc87,0x0000,0x0000,0x65bf,0x800a,0xffff,0x0002,0xfff6,0x6000,
+    0x800a,0x0000,0x0005,0x0007,0x96df,0xffff,0xfed2,0x3800,0x800a,0x0000,0x0003,0x0007,0x96df,0xffff
+};
+
+const uint16_t bmp191[192]   = // Bitmap 191 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,
-    0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xfdac,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp192[286]   = // Bitmap 192
+    0x8004,0xffff,0x0001,0xb320,0x8004,0x0000,0x0001,0x65bf,0x8007,0xffff,0x0002,0xfed2,0x3800,0x8006,0x0000,0x0002,
+    0x01d2,0xdfff,0x8004,0xffff,0x000b,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0336,
+    0x8004,0xffff,0x0004,0xfdac,0x0000,0x0007,0x96df,0x8004,0xffff,0x0004,0xfdac,0x0000,0x0007,0x96df,0x8003,0xffff,
+    0x0003,0xb320,0x0000,0x0336,0x8005,0xffff,0x0004,0xfff6,0x6000,0x0000,0x65bf,0x800b,0xffff,0x0004,0xfff6,0x6000,
+    0x0000,0x65bf,0x800b,0xffff,0x0004,0xfdac,0x0000,0x0007,0x96df,0x800a,0xffff,0x0004,0xb320,0x0000,0x0000,0x3c9b,
+    0x8008,0xffff,0x0002,0xfed2,0x3800,0x8003,0x0000,0x0001,0x3c9b,0x8009,0xffff,0x0001,0xfdac,0x8005,0x0000,0x0001,
+    0x3c9b,0x800b,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x0000,0x3c9b,0x800c,0xffff,0x0004,0xb320,0x0000,0x000c,0xb7ff,
+    0x800b,0xffff,0x0009,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x000a,0xfed2,
+    0x3800,0x0000,0x65bf,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x000a,0xfdac,0x0000,0x0007,0x96df,
+    0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0x8004,0xffff,0x0013,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,0xffff,
+    0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x65bf,0x8004,0xffff,0x0002,0xfff6,
+    0x6000,0x8007,0x0000,0x0001,0x65bf,0x8007,0xffff,0x0001,0xdc87,0x8004,0x0000,0x0001,0x0336,0x8005,0xffff
+};
+
+const uint16_t bmp192[187]   = // Bitmap 192 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x632c,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0336,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,
-    0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xfffb,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp193[286]   = // Bitmap 193
+    0x8008,0xffff,0x0004,0xfed2,0x3800,0x000c,0xb7ff,0x800a,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0x800a,
+    0xffff,0x0005,0xdc87,0x0000,0x0000,0x000c,0xb7ff,0x8009,0xffff,0x0006,0xfed2,0x3800,0x0000,0x0000,0x000c,0xb7ff,
+    0x8008,0xffff,0x0007,0xfffb,0x91c0,0x0000,0x632c,0x0000,0x000c,0xb7ff,0x8008,0xffff,0x0007,0xdc87,0x0000,0x0336,
+    0xfdac,0x0000,0x000c,0xb7ff,0x8007,0xffff,0x0008,0xfed2,0x3800,0x000c,0xb7ff,0xfdac,0x0000,0x000c,0xb7ff,0x8006,
+    0xffff,0x0009,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0x8006,0xffff,0x0009,0xdc87,0x0000,
+    0x0336,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0x8005,0xffff,0x000a,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,
+    0xfdac,0x0000,0x000c,0xb7ff,0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x65bf,0x8003,0xffff,0x0004,0xfdac,0x0000,
+    0x000c,0xb7ff,0x8004,0xffff,0x0003,0xdc87,0x0000,0x0336,0x8004,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,
+    0xffff,0x0004,0xfed2,0x3800,0x000c,0xb7ff,0x8004,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff,0x0001,
+    0xdc87,0x800c,0x0000,0x0003,0x65bf,0xffff,0xdc87,0x800c,0x0000,0x0002,0x65bf,0xfffb,0x8008,0xffff,0x0004,0xfdac,
+    0x0000,0x000c,0xb7ff,0x800b,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800b,0xffff,0x0004,0xfdac,0x0000,0x000c,
+    0xb7ff,0x800b,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x8003,0xffff
+};
+
+const uint16_t bmp193[184]   = // Bitmap 193 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfdac,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xb320,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x65bf,0xb320,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xfed2,0x3800,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,
-    0xffff,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xfed2,0x3800,0x0000,0x0007,0x96df,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp194[286]   = // Bitmap 194
+    0x0004,0xffff,0xffff,0xfffb,0x91c0,0x8008,0x0000,0x0001,0x3c9b,0x8004,0xffff,0x0002,0xfff6,0x6000,0x8008,0x0000,
+    0x0001,0x3c9b,0x8004,0xffff,0x0004,0xfed2,0x3800,0x000c,0xb7ff,0x800b,0xffff,0x0004,0xfdac,0x0000,0x01d2,0xdfff,
+    0x800b,0xffff,0x0003,0xdc87,0x0000,0x0336,0x800c,0xffff,0x0003,0xb320,0x0000,0x3c9b,0x800b,0xffff,0x0005,0xfffb,
+    0x91c0,0x0000,0x65bf,0xb320,0x8003,0x0000,0x0002,0x000c,0xb7ff,0x8005,0xffff,0x0002,0xfff6,0x6000,0x8008,0x0000,
+    0x0001,0x3c9b,0x8004,0xffff,0x000c,0xfed2,0x3800,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,
+    0x65bf,0x8003,0xffff,0x0004,0xfdac,0x0000,0x0007,0x96df,0x8004,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,
+    0x800b,0xffff,0x0004,0xfdac,0x0000,0x0000,0x65bf,0x800b,0xffff,0x0004,0xfff6,0x6000,0x0000,0x65bf,0x800b,0xffff,
+    0x0004,0xfff6,0x6000,0x0000,0x3c9b,0x800b,0xffff,0x0009,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xfffb,0x91c0,0x0000,
+    0x0336,0x8006,0xffff,0x000a,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,0x8004,0xffff,
+    0x0004,0xfff6,0x6000,0x0000,0x0336,0x8003,0xffff,0x000c,0xfed2,0x3800,0x0000,0x0007,0x96df,0xffff,0xffff,0xfff6,
+    0x6000,0x0000,0x0007,0x96df,0x8004,0xffff,0x0001,0xfdac,0x8007,0x0000,0x0002,0x0007,0x96df,0x8007,0xffff,0x0001,
+    0xb320,0x8004,0x0000,0x0001,0x0336,0x8005,0xffff
+};
+
+const uint16_t bmp194[233]   = // Bitmap 194 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xfffb,
-    0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfffb,
-    0xffff,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xb320,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x65b6,0x6000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,
-    0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0007,0x96df,0xffff,
-    0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,
-    0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp195[286]   = // Bitmap 195
+    0x8004,0xffff,0x0002,0xfffb,0x91c0,0x8003,0x0000,0x0002,0x0007,0x96df,0x8003,0xffff,0x0001,0xfffb,0x8003,0xffff,
+    0x0001,0xdc87,0x8007,0x0000,0x0011,0x3c9b,0xffff,0xffff,0xfffb,0xffff,0xffff,0xfdac,0x0000,0x0000,0x01d2,0xdfff,
+    0xffff,0xfffb,0x91c0,0x0000,0x0007,0x96df,0x8003,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0x8003,0xffff,
+    0x0004,0xfffb,0x91c0,0x0000,0x0336,0x8003,0xffff,0x0004,0xfdac,0x0000,0x0007,0x96df,0x8005,0xffff,0x000a,0xdc87,
+    0x0000,0x01d2,0xdfff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0x800b,0xffff,0x0003,0xb320,0x0000,0x3c9b,0x800b,
+    0xffff,0x0006,0xfffb,0x91c0,0x0000,0x65bf,0xffff,0xdc87,0x8003,0x0000,0x0002,0x0007,0x96df,0x8004,0xffff,0x0005,
+    0xfff6,0x6000,0x0000,0x65b6,0x6000,0x8006,0x0000,0x0001,0x3c9b,0x8003,0xffff,0x0002,0xfff6,0x6000,0x8003,0x0000,
+    0x000f,0x65bf,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x65bf,
+    0x8005,0xffff,0x000a,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0009,
+    0xfed2,0x3800,0x0007,0x96df,0xffff,0xfffb,0x91c0,0x0000,0x0336,0x8006,0xffff,0x0009,0xfff6,0x6000,0x0007,0x96df,
+    0xffff,0xffff,0xb320,0x0000,0x0336,0x8006,0xffff,0x000a,0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xdc87,0x0000,
+    0x000c,0xb7ff,0x8005,0xffff,0x000a,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0x8004,
+    0xffff,0x0004,0xfffb,0x91c0,0x0000,0x0336,0x8004,0xffff,0x000b,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfffb,
+    0x91c0,0x0000,0x0007,0x96df,0x8005,0xffff,0x0001,0xb320,0x8007,0x0000,0x0001,0x65bf,0x8007,0xffff,0x0002,0xfff6,
+    0x6000,0x8003,0x0000,0x0002,0x01d2,0xdfff,0x8004,0xffff
+};
+
+const uint16_t bmp195[136]   = // Bitmap 195 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,
-    0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp196[286]   = // Bitmap 196
+    0x0002,0xfffb,0x91c0,0x800b,0x0000,0x0004,0x65bf,0xffff,0xfffb,0x91c0,0x800b,0x0000,0x0001,0x65bf,0x800a,0xffff,
+    0x0004,0xfff6,0x6000,0x0000,0x3c9b,0x800a,0xffff,0x0005,0xfffb,0x91c0,0x0000,0x01d2,0xdfff,0x800a,0xffff,0x0004,
+    0xdc87,0x0000,0x0007,0x96df,0x800a,0xffff,0x0004,0xfff6,0x6000,0x0000,0x3c9b,0x800b,0xffff,0x0004,0xdc87,0x0000,
+    0x000c,0xb7ff,0x800a,0xffff,0x0004,0xfff6,0x6000,0x0000,0x3c9b,0x800b,0xffff,0x0004,0xdc87,0x0000,0x000c,0xb7ff,
+    0x800a,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x0336,0x800b,0xffff,0x0004,0xfed2,0x3800,0x0007,0x96df,0x800b,0xffff,
+    0x0004,0xdc87,0x0000,0x01d2,0xdfff,0x800a,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x800b,0xffff,0x0004,0xfed2,
+    0x3800,0x0000,0x65bf,0x800b,0xffff,0x0004,0xfdac,0x0000,0x000c,0xb7ff,0x800b,0xffff,0x0004,0xdc87,0x0000,0x01d2,
+    0xdfff,0x800b,0xffff,0x0003,0xb320,0x0000,0x0336,0x800b,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x800b,0xffff,
+    0x0004,0xfff6,0x6000,0x0000,0x65bf,0x8008,0xffff
+};
+
+const uint16_t bmp196[233]   = // Bitmap 196 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xffff,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfdac,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x01d2,0xdfff,0xffff,
-    0xfffb,0x91c0,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x0007,0x96df,0xffff,
-    0xffff,0xdc87,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb320,0x0000,0x000c,0xb7ff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xb320,0x0000,0x0000,0x3c9b,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp197[286]   = // Bitmap 197
+    0x8004,0xffff,0x0001,0xfdac,0x8004,0x0000,0x0001,0x0336,0x8007,0xffff,0x0002,0xfffb,0x91c0,0x8006,0x0000,0x0002,
+    0x0007,0x96df,0x8005,0xffff,0x000b,0xdc87,0x0000,0x0000,0x3c9b,0xffff,0xffff,0xfed2,0x3800,0x0000,0x01d2,0xdfff,
+    0x8003,0xffff,0x0004,0xfff6,0x6000,0x0000,0x3c9b,0x8004,0xffff,0x0004,0xfed2,0x3800,0x0000,0x65bf,0x8003,0xffff,
+    0x0004,0xfed2,0x3800,0x0007,0x96df,0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8003,0xffff,0x0004,0xfed2,
+    0x3800,0x0007,0x96df,0x8004,0xffff,0x0004,0xfffb,0x91c0,0x0000,0x3c9b,0x8003,0xffff,0x0004,0xfff6,0x6000,0x0000,
+    0x3c9b,0x8004,0xffff,0x0004,0xfed2,0x3800,0x0000,0x65bf,0x8004,0xffff,0x000b,0xdc87,0x0000,0x0000,0x3c9b,0xffff,
+    0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0x8005,0xffff,0x0001,0xfdac,0x8006,0x0000,0x0001,0x0336,0x8006,0xffff,
+    0x0002,0xfffb,0x91c0,0x8006,0x0000,0x0002,0x0007,0x96df,0x8004,0xffff,0x000c,0xfff6,0x6000,0x0000,0x0007,0x96df,
+    0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0x8003,0xffff,0x0004,0xdc87,0x0000,0x000c,0xb7ff,0x8005,0xffff,
+    0x0009,0xb320,0x0000,0x01d2,0xdfff,0xffff,0xfffb,0x91c0,0x0000,0x3c9b,0x8006,0xffff,0x0009,0xfed2,0x3800,0x0007,
+    0x96df,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0x8006,0xffff,0x0009,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xfffb,0x91c0,
+    0x0000,0x0336,0x8006,0xffff,0x000a,0xfed2,0x3800,0x0007,0x96df,0xffff,0xffff,0xdc87,0x0000,0x000c,0xb7ff,0x8005,
+    0xffff,0x000b,0xb320,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0x8003,0xffff,0x0004,
+    0xb320,0x0000,0x0000,0x3c9b,0x8004,0xffff,0x0002,0xfed2,0x3800,0x8007,0x0000,0x0001,0x3c9b,0x8007,0xffff,0x0001,
+    0xdc87,0x8004,0x0000,0x0002,0x000c,0xb7ff,0x8004,0xffff
+};
+
+const uint16_t bmp197[228]   = // Bitmap 197 (RLE, 286 words raw)
 {
     0x0f13, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,0xdfff,0xffff,0xffff,
-    0xffff,0xdc87,0x0000,0x0000,0x65bf,0xffff,0xffff,0xffff,0xffff,0xfff6,0x6000,0x0000,0x65bf,0xffff,0xffff,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x000c,0xb7ff,0xffff,
-    0xfff6,0x6000,0x0000,0x3c9b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,
-    0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xdc87,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xfff6,0x6000,0x0000,0x0000,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0007,0x96d6,0x6000,0x0000,0x65bf,0xffff,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x01d2,0xdfff,0xfff6,0x6000,0x0007,0x96df,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfed2,0x3800,0x000c,0xb7ff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdc87,0x0000,0x01d2,0xdfff,0xffff,
-    0xffff,0xdc87,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0336,0xffff,0xffff,
-    0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xfdac,0x0000,0x0007,0x96df,0xffff,0xffff,
-    0xffff,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xfed2,0x3800,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0336,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfffb,0x91c0,0x0000,0x0000,0x0000,0x0007,0x96df,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp199[476]   = // Bitmap 199
+    0x8004,0xffff,0x0001,0xdc87,0x8004,0x0000,0x0001,0x65bf,0x8007,0xffff,0x0002,0xfed2,0x3800,0x8006,0x0000,0x0002,
+    0x000c,0xb7ff,0x8004,0xffff,0x000c,0xfff6,0x6000,0x0000,0x0000,0x65bf,0xffff,0xffff,0xfff6,0x6000,0x0000,0x01d2,
+    0xdfff,0x8003,0xffff,0x0004,0xdc87,0x0000,0x0000,0x65bf,0x8004,0xffff,0x000a,0xfff6,0x6000,0x0000,0x65bf,0xffff,
+    0xffff,0xfffb,0x91c0,0x0000,0x0336,0x8006,0xffff,0x0009,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xfff6,0x6000,0x0000,
+    0x3c9b,0x8006,0xffff,0x0009,0xfdac,0x0000,0x000c,0xb7ff,0xffff,0xfff6,0x6000,0x0000,0x3c9b,0x8006,0xffff,0x0009,
+    0xfdac,0x0000,0x0007,0x96df,0xffff,0xfffb,0x91c0,0x0000,0x0336,0x8006,0xffff,0x000a,0xdc87,0x0000,0x0000,0x65bf,
+    0xffff,0xffff,0xdc87,0x0000,0x0007,0x96df,0x8004,0xffff,0x0010,0xfffb,0x91c0,0x0000,0x0000,0x65bf,0xffff,0xffff,
+    0xfff6,0x6000,0x0000,0x0007,0x96df,0xffff,0xffff,0xfff6,0x6000,0x8003,0x0000,0x0001,0x65bf,0x8003,0xffff,0x0002,
+    0xfed2,0x3800,0x8005,0x0000,0x0005,0x0007,0x96d6,0x6000,0x0000,0x65bf,0x8004,0xffff,0x0002,0xfffb,0x91c0,0x8003,
+    0x0000,0x0006,0x01d2,0xdfff,0xfff6,0x6000,0x0007,0x96df,0x800b,0xffff,0x0004,0xfed2,0x3800,0x000c,0xb7ff,0x800b,
+    0xffff,0x0009,0xdc87,0x0000,0x01d2,0xdfff,0xffff,0xffff,0xdc87,0x0000,0x0336,0x8005,0xffff,0x0004,0xfffb,0x91c0,
+    0x0000,0x0336,0x8003,0xffff,0x0004,0xfdac,0x0000,0x0007,0x96df,0x8004,0xffff,0x0004,0xfdac,0x0000,0x0007,0x96df,
+    0x8003,0xffff,0x000b,0xfffb,0x91c0,0x0000,0x000c,0xb7ff,0xffff,0xffff,0xdc87,0x0000,0x0000,0x0336,0x8005,0xffff,
+    0x0002,0xfed2,0x3800,0x8006,0x0000,0x0001,0x0336,0x8007,0xffff,0x0002,0xfffb,0x91c0,0x8003,0x0000,0x0002,0x0007,
+    0x96df,0x8005,0xffff
+};
+
+const uint16_t bmp199[295]   = // Bitmap 199 (RLE, 476 words raw)
 {
     0x1319, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0xa534,0x6b4d,0x0000,0x0000,0x6b4d,0xa534,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,
-    0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,
-    0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,
-    0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,
-    0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,
-    0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0xa534,0x6b4d,0x0000,0x0000,0x6b4d,0xa534,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp200[476]   = // Bitmap 200
+    0x8005,0xffff,0x0008,0xe71c,0xa534,0x6b4d,0x0000,0x0000,0x6b4d,0xa534,0xe71c,0x800a,0xffff,0x0001,0xb596,0x8008,
+    0x0000,0x0001,0xb596,0x8008,0xffff,0x0001,0xb596,0x800a,0x0000,0x0001,0xb596,0x8006,0xffff,0x0001,0xe71c,0x800c,
+    0x0000,0x0001,0xe71c,0x8005,0xffff,0x0001,0x8c71,0x8004,0x0000,0x0004,0xa534,0xffff,0xffff,0xa534,0x8004,0x0000,
+    0x0001,0x8c71,0x8004,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0001,0x7bef,0x8004,0xffff,0x0001,0x6b4d,0x8004,0x0000,
+    0x0001,0xf79e,0x8003,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0xbdf7,0x8004,0xffff,0x0001,0xbdf7,0x8004,0x0000,
+    0x0001,0xd69a,0x8003,0xffff,0x0001,0xa534,0x8004,0x0000,0x0001,0xe71c,0x8004,0xffff,0x0001,0xe71c,0x8004,0x0000,
+    0x0001,0xb596,0x8003,0xffff,0x0001,0x8c71,0x8004,0x0000,0x0001,0xef5d,0x8004,0xffff,0x0001,0xef5d,0x8004,0x0000,
+    0x0001,0x8c71,0x8003,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x8006,0xffff,0x8004,0x0000,0x0001,0x6b4d,0x8003,0xffff,
+    0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8003,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8003,0xffff,
+    0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8003,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8003,0xffff,
+    0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8003,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x8006,0xffff,0x8004,0x0000,
+    0x0001,0x6b4d,0x8003,0xffff,0x0001,0x8c71,0x8004,0x0000,0x0001,0xef5d,0x8004,0xffff,0x0001,0xef5d,0x8004,0x0000,
+    0x0001,0x8c71,0x8003,0xffff,0x0001,0xa534,0x8004,0x0000,0x0001,0xe71c,0x8004,0xffff,0x0001,0xe71c,0x8004,0x0000,
+    0x0001,0xb596,0x8003,0xffff,0x0001,0xc638,0x8004,0x0000,0x0001,0xc638,0x8004,0xffff,0x0001,0xbdf7,0x8004,0x0000,
+    0x0001,0xd69a,0x8003,0xffff,0x0001,0xef5d,0x8004,0x0000,0x0001,0x6b4d,0x8004,0xffff,0x0001,0x7bef,0x8004,0x0000,
+    0x0001,0xf79e,0x8004,0xffff,0x0001,0x7bef,0x8004,0x0000,0x0004,0xa534,0xffff,0xffff,0xa534,0x8004,0x0000,0x0001,
+    0x8c71,0x8005,0xffff,0x0001,0xdedb,0x800c,0x0000,0x0001,0xe71c,0x8006,0xffff,0x0001,0xa534,0x800a,0x0000,0x0001,
+    0xb596,0x8008,0xffff,0x0001,0xb596,0x8008,0x0000,0x0001,0xb596,0x800a,0xffff,0x0008,0xf79e,0xa534,0x6b4d,0x0000,
+    0x0000,0x6b4d,0xa534,0xe71c,0x8006,0xffff
+};
+
+const uint16_t bmp200[138]   = // Bitmap 200 (RLE, 476 words raw)
 {
     0x1319, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xf79e,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x7bef,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x4a69,0xbdf7,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x6b4d,0xc638,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp201[476]   = // Bitmap 201
+    0x8009,0xffff,0x0001,0xf79e,0x8004,0x0000,0x800e,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x800d,0xffff,0x0001,0xc638,
+    0x8005,0x0000,0x800c,0xffff,0x0001,0xb596,0x8006,0x0000,0x800a,0xffff,0x0002,0xef5d,0x7bef,0x8007,0x0000,0x8008,
+    0xffff,0x0002,0xf79e,0xa534,0x8009,0x0000,0x8008,0xffff,0x8005,0x0000,0x0001,0x4a69,0x8005,0x0000,0x8008,0xffff,
+    0x8004,0x0000,0x0002,0x7bef,0xef5d,0x8005,0x0000,0x8008,0xffff,0x0006,0x0000,0x0000,0x4a69,0xbdf7,0xffff,0xffff,
+    0x8005,0x0000,0x8008,0xffff,0x0002,0x6b4d,0xc638,0x8004,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,
+    0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,
+    0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,
+    0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,
+    0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x8005,0xffff
+};
+
+const uint16_t bmp201[226]   = // Bitmap 201 (RLE, 476 words raw)
 {
     0x1319, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x8c71,0x0000,0x0000,0x0000,0x7bef,0xa534,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdedb,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,
-    0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x4a69,0xe71c,0xffff,0xe71c,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,
-    0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,
-    0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xbdf7,0x9cd3,0x8c71,0x7bef,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff
-};
-
-const uint16_t bmp202[476]   = // Bitmap 202
+    0x8006,0xffff,0x0002,0xc638,0x8c71,0x8003,0x0000,0x0003,0x7bef,0xa534,0xf79e,0x8009,0xffff,0x0002,0xdedb,0x4a69,
+    0x8008,0x0000,0x0001,0xb596,0x8007,0xffff,0x0001,0xe71c,0x800b,0x0000,0x0001,0xb596,0x8006,0xffff,0x0001,0x6b4d,
+    0x800c,0x0000,0x0001,0xe71c,0x8004,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0005,0x4a69,0xe71c,0xffff,0xe71c,0x6b4d,
+    0x8004,0x0000,0x0001,0xa534,0x8004,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x0001,0xbdf7,0x8003,0xffff,0x0001,0xdedb,
+    0x8004,0x0000,0x0001,0x4a69,0x8004,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xef5d,0x8004,0xffff,0x8005,0x0000,
+    0x8004,0xffff,0x0005,0xbdf7,0x9cd3,0x8c71,0x7bef,0x0000,0x8005,0xffff,0x8005,0x0000,0x800d,0xffff,0x0001,0xf79e,
+    0x8004,0x0000,0x0001,0x7bef,0x800d,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0001,0xb596,0x800c,0xffff,0x0002,0xef5d,
+    0x4a69,0x8004,0x0000,0x0001,0xf79e,0x800c,0xffff,0x0001,0x7bef,0x8004,0x0000,0x0001,0xa534,0x800c,0xffff,0x0001,
+    0x7bef,0x8004,0x0000,0x0001,0x4a69,0x800c,0xffff,0x0001,0x7bef,0x8005,0x0000,0x0001,0xef5d,0x800b,0xffff,0x0001,
+    0x7bef,0x8004,0x0000,0x0002,0x4a69,0xd69a,0x800b,0xffff,0x0001,0xa534,0x8004,0x0000,0x0002,0x4a69,0xef5d,0x800b,
+    0xffff,0x0001,0xa534,0x8004,0x0000,0x0002,0x6b4d,0xef5d,0x800b,0xffff,0x0001,0xb596,0x8004,0x0000,0x0001,0x7bef,
+    0x800c,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0001,0x7bef,0x800c,0xffff,0x0002,0xf79e,0x4a69,0x8003,0x0000,0x0002,
+    0x4a69,0xf79e,0x800c,0xffff,0x0001,0xa534,0x800e,0x0000,0x8003,0xffff,0x0001,0xf79e,0x800f,0x0000,0x8003,0xffff,
+    0x0001,0xc638,0x800f,0x0000,0x8003,0xffff,0x0001,0x8c71,0x800f,0x0000,0x8003,0xffff,0x8010,0x0000,0x0002,0xffff,
+    0xffff
+};
+
+const uint16_t bmp202[253]   = // Bitmap 202 (RLE, 476 words raw)
 {
     0x1319, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0xa534,0x7bef,0x0000,0x0000,0x4a69,0x9cd3,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xf79e,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xc638,0xbdf7,0x9cd3,0x8c71,0x0000,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x7bef,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x6b4d,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x4a69,0xa534,0xf79e,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0xffff,0xe71c,0x4a69,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xbdf7,0xbdf7,0x8c71,0x8c71,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,
-    0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,
-    0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,
-    0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x9cd3,0x6b4d,0x0000,0x0000,0x6b4d,0xa534,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp203[476]   = // Bitmap 203
+    0x8005,0xffff,0x0008,0xf79e,0xa534,0x7bef,0x0000,0x0000,0x4a69,0x9cd3,0xe71c,0x800a,0xffff,0x0001,0xbdf7,0x8008,
+    0x0000,0x0001,0xa534,0x8008,0xffff,0x0001,0xbdf7,0x800a,0x0000,0x0001,0x9cd3,0x8006,0xffff,0x0001,0xf79e,0x800c,
+    0x0000,0x0001,0xd69a,0x8005,0xffff,0x0001,0xb596,0x8004,0x0000,0x0004,0x6b4d,0xf79e,0xffff,0xa534,0x8004,0x0000,
+    0x0001,0x7bef,0x8005,0xffff,0x0001,0x7bef,0x8004,0x0000,0x0001,0xdedb,0x8003,0xffff,0x8005,0x0000,0x8005,0xffff,
+    0x0005,0xc638,0xbdf7,0x9cd3,0x8c71,0x0000,0x8004,0xffff,0x8005,0x0000,0x800d,0xffff,0x0001,0xef5d,0x8004,0x0000,
+    0x0001,0x9cd3,0x800c,0xffff,0x0002,0xf79e,0x7bef,0x8004,0x0000,0x0001,0xe71c,0x800b,0xffff,0x0001,0x8c71,0x8005,
+    0x0000,0x0001,0xd69a,0x800c,0xffff,0x0001,0x8c71,0x8003,0x0000,0x0002,0x6b4d,0xe71c,0x800d,0xffff,0x0001,0x7bef,
+    0x8003,0x0000,0x0003,0x4a69,0xa534,0xf79e,0x800c,0xffff,0x8006,0x0000,0x0002,0x4a69,0xef5d,0x800b,0xffff,0x0004,
+    0xef5d,0xffff,0xe71c,0x4a69,0x8003,0x0000,0x0001,0x4a69,0x800e,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0001,0xb596,
+    0x800d,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0001,0x6b4d,0x800e,0xffff,0x8005,0x0000,0x8003,0xffff,0x0005,0xbdf7,
+    0xbdf7,0x8c71,0x8c71,0x0000,0x8006,0xffff,0x8005,0x0000,0x8003,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xdedb,
+    0x8004,0xffff,0x0001,0xef5d,0x8004,0x0000,0x0001,0x6b4d,0x8003,0xffff,0x0001,0xa534,0x8004,0x0000,0x0001,0x8c71,
+    0x8004,0xffff,0x0001,0xa534,0x8004,0x0000,0x0001,0xa534,0x8003,0xffff,0x0001,0xe71c,0x8005,0x0000,0x0004,0xa534,
+    0xffff,0xffff,0xbdf7,0x8005,0x0000,0x0001,0xe71c,0x8004,0xffff,0x0001,0x9cd3,0x800c,0x0000,0x0001,0xa534,0x8006,
+    0xffff,0x0001,0x7bef,0x800a,0x0000,0x0001,0x7bef,0x8008,0xffff,0x0001,0x8c71,0x8008,0x0000,0x0001,0x9cd3,0x800a,
+    0xffff,0x0008,0xe71c,0x9cd3,0x6b4d,0x0000,0x0000,0x6b4d,0xa534,0xe71c,0x8006,0xffff
+};
+
+const uint16_t bmp203[179]   = // Bitmap 203 (RLE, 476 words raw)
 {
     0x1319, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x6b4d,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0x9cd3,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp204[476]   = // Bitmap 204
+    0x800a,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x800d,0xffff,0x0001,0xdedb,0x8005,0x0000,0x800d,0xffff,0x0001,0x4a69,
+    0x8005,0x0000,0x800c,0xffff,0x0001,0x9cd3,0x8006,0x0000,0x800b,0xffff,0x0001,0xdedb,0x8007,0x0000,0x800b,0xffff,
+    0x0001,0x4a69,0x8007,0x0000,0x800a,0xffff,0x0001,0x9cd3,0x8008,0x0000,0x8009,0xffff,0x0001,0xdedb,0x8009,0x0000,
+    0x8009,0xffff,0x0001,0x4a69,0x8003,0x0000,0x0001,0xb596,0x8005,0x0000,0x8008,0xffff,0x0001,0x9cd3,0x8003,0x0000,
+    0x0002,0x6b4d,0xffff,0x8005,0x0000,0x8007,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0002,0xe71c,0xffff,0x8005,0x0000,
+    0x8007,0xffff,0x0001,0x4a69,0x8003,0x0000,0x0003,0xb596,0xffff,0xffff,0x8005,0x0000,0x8006,0xffff,0x0001,0x9cd3,
+    0x8003,0x0000,0x0001,0x6b4d,0x8003,0xffff,0x8005,0x0000,0x8005,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0001,0xe71c,
+    0x8003,0xffff,0x8005,0x0000,0x8005,0xffff,0x0001,0x4a69,0x8003,0x0000,0x0001,0xb596,0x8004,0xffff,0x8005,0x0000,
+    0x8004,0xffff,0x0001,0x9cd3,0x8003,0x0000,0x0001,0x6b4d,0x8005,0xffff,0x8005,0x0000,0x8004,0xffff,0x8012,0x0000,
+    0x0001,0xffff,0x8012,0x0000,0x0001,0xffff,0x8012,0x0000,0x0001,0xffff,0x8012,0x0000,0x800b,0xffff,0x8005,0x0000,
+    0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,
+    0x8004,0xffff
+};
+
+const uint16_t bmp204[233]   = // Bitmap 204 (RLE, 476 words raw)
 {
     0x1319, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xbdf7,0x7bef,0x0000,0x0000,0x9cd3,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xf79e,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0xffff,0xbdf7,0xb596,0x8c71,0x6b4d,0x8c71,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xbdf7,0xb596,0x8c71,0x8c71,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,
-    0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,
-    0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x4a69,0x0000,0x0000,0x6b4d,0xa534,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp205[476]   = // Bitmap 205
+    0x8004,0xffff,0x0001,0xf79e,0x800b,0x0000,0x8007,0xffff,0x0001,0xdedb,0x800b,0x0000,0x8007,0xffff,0x0001,0xb596,
+    0x800b,0x0000,0x8007,0xffff,0x0001,0x8c71,0x800b,0x0000,0x8007,0xffff,0x800c,0x0000,0x8006,0xffff,0x0001,0xe71c,
+    0x8004,0x0000,0x0001,0x6b4d,0x800d,0xffff,0x0001,0xc638,0x8004,0x0000,0x0001,0xa534,0x800d,0xffff,0x0001,0x9cd3,
+    0x8004,0x0000,0x0001,0xc638,0x800d,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0006,0xbdf7,0x7bef,0x0000,0x0000,0x9cd3,
+    0xe71c,0x8007,0xffff,0x0001,0xf79e,0x800b,0x0000,0x0001,0xd69a,0x8006,0xffff,0x0001,0xd69a,0x800c,0x0000,0x0001,
+    0xdedb,0x8005,0xffff,0x0001,0xb596,0x800c,0x0000,0x0001,0x4a69,0x8005,0xffff,0x0001,0x7bef,0x8004,0x0000,0x0004,
+    0x9cd3,0xf79e,0xffff,0xc638,0x8005,0x0000,0x0001,0xd69a,0x8004,0xffff,0x0005,0xbdf7,0xb596,0x8c71,0x6b4d,0x8c71,
+    0x8004,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0001,0x9cd3,0x800d,0xffff,0x0001,0xef5d,0x8004,0x0000,0x0001,0x6b4d,
+    0x800e,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x8003,0xffff,0x0005,0xbdf7,0xb596,0x8c71,0x8c71,0x0000,
+    0x8006,0xffff,0x8005,0x0000,0x8003,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xdedb,0x8004,0xffff,0x0001,0xe71c,
+    0x8004,0x0000,0x0001,0x8c71,0x8003,0xffff,0x0001,0xa534,0x8004,0x0000,0x0001,0x8c71,0x8004,0xffff,0x0001,0x9cd3,
+    0x8004,0x0000,0x0001,0xc638,0x8003,0xffff,0x0001,0xe71c,0x8005,0x0000,0x0004,0xa534,0xffff,0xffff,0xbdf7,0x8004,
+    0x0000,0x0001,0x4a69,0x8005,0xffff,0x0001,0x8c71,0x800c,0x0000,0x0001,0xc638,0x8006,0xffff,0x0001,0x6b4d,0x800a,
+    0x0000,0x0001,0xa534,0x8008,0xffff,0x0001,0x7bef,0x8008,0x0000,0x0001,0xb596,0x800a,0xffff,0x0008,0xd69a,0x9cd3,
+    0x4a69,0x0000,0x0000,0x6b4d,0xa534,0xef5d,0x8006,0xffff
+};
+
+const uint16_t bmp205[286]   = // Bitmap 205 (RLE, 476 words raw)
 {
     0x1319, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x8c71,0x0000,0x0000,0x4a69,0x9cd3,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xf79e,0x7bef,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,
-    0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0x0000,0x7bef,0x8c71,0xa534,0xbdf7,0xffff,0xffff,0xffff,
-    0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x8c71,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x7bef,0x0000,0x0000,0x0000,0x8c71,0xffff,0xd69a,0x7bef,0x0000,0x0000,0x7bef,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x7bef,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,
-    0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,
-    0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0xa534,0xf79e,0xffff,0xd69a,0x4a69,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdedb,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xef5d,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x7bef,0x0000,0x0000,0x4a69,0x9cd3,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp206[476]   = // Bitmap 206
+    0x8006,0xffff,0x0007,0xc638,0x8c71,0x0000,0x0000,0x4a69,0x9cd3,0xe71c,0x800a,0xffff,0x0002,0xef5d,0x4a69,0x8007,
+    0x0000,0x0001,0xa534,0x8008,0xffff,0x0001,0xe71c,0x800a,0x0000,0x0001,0xbdf7,0x8007,0xffff,0x0001,0x4a69,0x800b,
+    0x0000,0x0001,0xf79e,0x8005,0xffff,0x0001,0xa534,0x8004,0x0000,0x0004,0xc638,0xffff,0xf79e,0x7bef,0x8004,0x0000,
+    0x0001,0xb596,0x8005,0xffff,0x0001,0x4a69,0x8003,0x0000,0x0001,0xa534,0x8003,0xffff,0x0001,0xdedb,0x8004,0x0000,
+    0x0001,0x7bef,0x8004,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0001,0xe71c,0x8004,0xffff,0x0005,0x0000,0x7bef,0x8c71,
+    0xa534,0xbdf7,0x8004,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x800e,0xffff,0x0001,0x8c71,0x8003,0x0000,0x0001,0x7bef,
+    0x800e,0xffff,0x0001,0x7bef,0x8003,0x0000,0x0008,0x8c71,0xffff,0xd69a,0x7bef,0x0000,0x0000,0x7bef,0xbdf7,0x8007,
+    0xffff,0x8004,0x0000,0x0002,0x7bef,0x7bef,0x8006,0x0000,0x0002,0x4a69,0xef5d,0x8005,0xffff,0x800d,0x0000,0x0002,
+    0x4a69,0xef5d,0x8004,0xffff,0x800e,0x0000,0x0001,0x6b4d,0x8004,0xffff,0x8006,0x0000,0x0004,0xc638,0xffff,0xffff,
+    0xc638,0x8005,0x0000,0x0001,0xd69a,0x8003,0xffff,0x8005,0x0000,0x0001,0xbdf7,0x8004,0xffff,0x0001,0xbdf7,0x8004,
+    0x0000,0x0001,0x9cd3,0x8003,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xf79e,0x8004,0xffff,0x0001,0xef5d,0x8004,
+    0x0000,0x0001,0x4a69,0x8003,0xffff,0x0001,0x8c71,0x8004,0x0000,0x8006,0xffff,0x8005,0x0000,0x8003,0xffff,0x0001,
+    0xb596,0x8004,0x0000,0x8006,0xffff,0x8005,0x0000,0x8003,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0xe71c,0x8004,
+    0xffff,0x0001,0xf79e,0x8004,0x0000,0x0001,0x6b4d,0x8004,0xffff,0x8004,0x0000,0x0001,0x9cd3,0x8004,0xffff,0x0001,
+    0xc638,0x8004,0x0000,0x0001,0x9cd3,0x8004,0xffff,0x0001,0xa534,0x8004,0x0000,0x0005,0xa534,0xf79e,0xffff,0xd69a,
+    0x4a69,0x8004,0x0000,0x0001,0xd69a,0x8004,0xffff,0x0002,0xf79e,0x4a69,0x800b,0x0000,0x0001,0x7bef,0x8006,0xffff,
+    0x0001,0xd69a,0x800a,0x0000,0x0002,0x4a69,0xef5d,0x8007,0xffff,0x0002,0xdedb,0x4a69,0x8007,0x0000,0x0002,0x7bef,
+    0xef5d,0x800a,0xffff,0x0007,0xbdf7,0x7bef,0x0000,0x0000,0x4a69,0x9cd3,0xd69a,0x8006,0xffff
+};
+
+const uint16_t bmp206[174]   = // Bitmap 206 (RLE, 476 words raw)
 {
     0x1319, // Width and height
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp207[476]   = // Bitmap 207
+    0x0001,0xffff,0x8010,0x0000,0x8003,0xffff,0x8010,0x0000,0x8003,0xffff,0x8010,0x0000,0x8003,0xffff,0x8010,0x0000,
+    0x8003,0xffff,0x800f,0x0000,0x0001,0xa534,0x800d,0xffff,0x0001,0xa534,0x8003,0x0000,0x0001,0x9cd3,0x800d,0xffff,
+    0x0001,0xd69a,0x8003,0x0000,0x0001,0x4a69,0x800d,0xffff,0x0002,0xf79e,0x4a69,0x8003,0x0000,0x0001,0xdedb,0x800d,
+    0xffff,0x0001,0x8c71,0x8003,0x0000,0x0001,0x8c71,0x800d,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0xef5d,0x800d,
+    0xffff,0x0001,0x6b4d,0x8003,0x0000,0x0001,0xa534,0x800d,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0001,0xf79e,0x800d,
+    0xffff,0x0001,0x6b4d,0x8003,0x0000,0x0001,0x8c71,0x800d,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0001,0xdedb,0x800d,
+    0xffff,0x0001,0x7bef,0x8003,0x0000,0x0001,0x4a69,0x800d,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0001,0xa534,0x800d,
+    0xffff,0x0001,0xc638,0x8004,0x0000,0x0001,0xdedb,0x800d,0xffff,0x0001,0x7bef,0x8004,0x0000,0x800e,0xffff,0x8004,
+    0x0000,0x0001,0x7bef,0x800d,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0001,0xb596,0x800d,0xffff,0x0001,0xbdf7,0x8004,
+    0x0000,0x0001,0xc638,0x800d,0xffff,0x0001,0x8c71,0x8004,0x0000,0x0001,0xe71c,0x800d,0xffff,0x0001,0x8c71,0x8004,
+    0x0000,0x0001,0xf79e,0x800d,0xffff,0x8005,0x0000,0x800e,0xffff,0x8005,0x0000,0x800a,0xffff
+};
+
+const uint16_t bmp207[288]   = // Bitmap 207 (RLE, 476 words raw)
 {
     0x1319, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x9cd3,0x4a69,0x0000,0x0000,0x6b4d,0x9cd3,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdedb,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xf79e,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xef5d,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xdedb,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,0xffff,
-    0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,
-    0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,
-    0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xe71c,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xe71c,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x6b4d,0x0000,0x0000,0x4a69,0x8c71,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp208[476]   = // Bitmap 208
+    0x8005,0xffff,0x0008,0xdedb,0x9cd3,0x4a69,0x0000,0x0000,0x6b4d,0x9cd3,0xe71c,0x800a,0xffff,0x0001,0x8c71,0x8008,
+    0x0000,0x0001,0x9cd3,0x8008,0xffff,0x0001,0x8c71,0x800a,0x0000,0x0001,0x9cd3,0x8006,0xffff,0x0001,0xd69a,0x800c,
+    0x0000,0x0001,0xd69a,0x8005,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x0004,0x7bef,0xffff,0xffff,0x7bef,0x8004,0x0000,
+    0x0001,0x9cd3,0x8005,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0004,0xef5d,0xffff,0xffff,0xef5d,0x8004,0x0000,0x0001,
+    0x4a69,0x8005,0xffff,0x8005,0x0000,0x8004,0xffff,0x8005,0x0000,0x8005,0xffff,0x0001,0x4a69,0x8004,0x0000,0x8004,
+    0xffff,0x8004,0x0000,0x0001,0x4a69,0x8005,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x0004,0xef5d,0xffff,0xffff,0xef5d,
+    0x8004,0x0000,0x0001,0x9cd3,0x8005,0xffff,0x0001,0xe71c,0x8004,0x0000,0x0004,0x7bef,0xffff,0xffff,0x7bef,0x8004,
+    0x0000,0x0001,0xe71c,0x8006,0xffff,0x0001,0xb596,0x800a,0x0000,0x0001,0xd69a,0x8008,0xffff,0x0002,0xdedb,0x6b4d,
+    0x8006,0x0000,0x0002,0x6b4d,0xdedb,0x8008,0xffff,0x0002,0xf79e,0x8c71,0x8008,0x0000,0x0002,0x8c71,0xef5d,0x8006,
+    0xffff,0x0002,0xef5d,0x4a69,0x800a,0x0000,0x0002,0x4a69,0xdedb,0x8005,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0004,
+    0xd69a,0xffff,0xffff,0xc638,0x8004,0x0000,0x0002,0x4a69,0xf79e,0x8003,0xffff,0x0001,0xb596,0x8004,0x0000,0x0001,
+    0xbdf7,0x8004,0xffff,0x0001,0xc638,0x8004,0x0000,0x0001,0xa534,0x8003,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x8006,
+    0xffff,0x8004,0x0000,0x0001,0x6b4d,0x8003,0xffff,0x8005,0x0000,0x8006,0xffff,0x8005,0x0000,0x8003,0xffff,0x8005,
+    0x0000,0x0001,0xf79e,0x8004,0xffff,0x0001,0xf79e,0x8005,0x0000,0x8003,0xffff,0x0001,0x7bef,0x8004,0x0000,0x0001,
+    0xbdf7,0x8004,0xffff,0x0001,0xbdf7,0x8004,0x0000,0x0001,0x7bef,0x8003,0xffff,0x0001,0xb596,0x8005,0x0000,0x0004,
+    0xc638,0xffff,0xffff,0xc638,0x8005,0x0000,0x0001,0xbdf7,0x8004,0xffff,0x0001,0x4a69,0x800c,0x0000,0x0001,0x4a69,
+    0x8005,0xffff,0x0001,0xdedb,0x800c,0x0000,0x0001,0xdedb,0x8006,0xffff,0x0002,0xe71c,0x6b4d,0x8008,0x0000,0x0002,
+    0x4a69,0xe71c,0x8009,0xffff,0x0008,0xd69a,0x9cd3,0x6b4d,0x0000,0x0000,0x4a69,0x8c71,0xc638,0x8006,0xffff
+};
+
+const uint16_t bmp208[286]   = // Bitmap 208 (RLE, 476 words raw)
 {
     0x1319, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x4a69,0x0000,0x0000,0x7bef,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xef5d,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,0xffff,0xffff,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,0xf79e,0xa534,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,
-    0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0x8c71,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x7bef,0x0000,0x0000,0x7bef,0xd69a,0xffff,0x8c71,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,
-    0xffff,0xffff,0xbdf7,0xa534,0x8c71,0x7bef,0x0000,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,
-    0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0xdedb,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x7bef,0xf79e,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x0000,0x0000,0x0000,0x8c71,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp210[551]   = // Bitmap 210
+    0x8005,0xffff,0x0007,0xd69a,0x9cd3,0x4a69,0x0000,0x0000,0x7bef,0xbdf7,0x800a,0xffff,0x0002,0xef5d,0x7bef,0x8007,
+    0x0000,0x0002,0x4a69,0xdedb,0x8007,0xffff,0x0002,0xef5d,0x4a69,0x800a,0x0000,0x0001,0xd69a,0x8006,0xffff,0x0001,
+    0x7bef,0x800b,0x0000,0x0002,0x4a69,0xf79e,0x8004,0xffff,0x0001,0xd69a,0x8004,0x0000,0x0005,0x4a69,0xd69a,0xffff,
+    0xf79e,0xa534,0x8004,0x0000,0x0001,0xa534,0x8004,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x0001,0xc638,0x8004,0xffff,
+    0x0001,0x9cd3,0x8004,0x0000,0x8004,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x0001,0xf79e,0x8004,0xffff,0x0001,0xe71c,
+    0x8004,0x0000,0x0001,0xd69a,0x8003,0xffff,0x8005,0x0000,0x8006,0xffff,0x8004,0x0000,0x0001,0xb596,0x8003,0xffff,
+    0x8005,0x0000,0x8006,0xffff,0x8004,0x0000,0x0001,0x8c71,0x8003,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0001,0xef5d,
+    0x8004,0xffff,0x0001,0xf79e,0x8004,0x0000,0x0001,0x6b4d,0x8003,0xffff,0x0001,0x9cd3,0x8004,0x0000,0x0001,0xbdf7,
+    0x8004,0xffff,0x0001,0xbdf7,0x8005,0x0000,0x8003,0xffff,0x0001,0xd69a,0x8005,0x0000,0x0004,0xc638,0xffff,0xffff,
+    0xc638,0x8006,0x0000,0x8004,0xffff,0x0001,0x6b4d,0x800e,0x0000,0x8004,0xffff,0x0002,0xef5d,0x4a69,0x800d,0x0000,
+    0x8005,0xffff,0x0002,0xef5d,0x4a69,0x8006,0x0000,0x0002,0x7bef,0x8c71,0x8004,0x0000,0x8007,0xffff,0x0008,0xbdf7,
+    0x7bef,0x0000,0x0000,0x7bef,0xd69a,0xffff,0x8c71,0x8003,0x0000,0x0001,0x7bef,0x800e,0xffff,0x0001,0x7bef,0x8003,
+    0x0000,0x0001,0x8c71,0x800e,0xffff,0x8004,0x0000,0x0001,0xbdf7,0x8004,0xffff,0x0005,0xbdf7,0xa534,0x8c71,0x7bef,
+    0x0000,0x8004,0xffff,0x0001,0xe71c,0x8004,0x0000,0x0001,0xdedb,0x8004,0xffff,0x0001,0x7bef,0x8004,0x0000,0x0001,
+    0xdedb,0x8003,0xffff,0x0001,0xa534,0x8003,0x0000,0x0001,0x4a69,0x8005,0xffff,0x0001,0xb596,0x8004,0x0000,0x0004,
+    0x7bef,0xf79e,0xffff,0xc638,0x8004,0x0000,0x0001,0xa534,0x8005,0xffff,0x0001,0xf79e,0x800b,0x0000,0x0001,0x4a69,
+    0x8007,0xffff,0x0001,0xb596,0x800a,0x0000,0x0001,0xe71c,0x8008,0xffff,0x0001,0xa534,0x8007,0x0000,0x0002,0x4a69,
+    0xef5d,0x800a,0xffff,0x0002,0xd69a,0x9cd3,0x8003,0x0000,0x0002,0x8c71,0xc638,0x8007,0xffff
+};
+
+const uint16_t bmp210[267]   = // Bitmap 210 (RLE, 551 words raw)
 {
     0x1619, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0xa534,0x8c71,0x0000,0x0000,0x0000,0x4a69,0x8c71,
-    0xb596,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x4a69,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xf79e,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x4a69,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xdedb,0xffff,0xffff,0xffff,0xdedb,0x8c71,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0x6b4d,0x0000,
-    0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,
-    0x0000,0x0000,0x0000,0x6b4d,0xef5d,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x4a69,0x8c71,0xbdf7,0xdedb,0xf79e,0xbdf7,0x0000,0x0000,0x0000,
-    0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x7bef,0xd69a,0xffff,0xffff,0xffff,0xdedb,
-    0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xbdf7,0x0000,0x0000,0x4a69,0xa534,0xef5d,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xd69a,
-    0x0000,0x0000,0x0000,0x0000,0x4a69,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xe71c,
-    0xffff,0xffff,0xf79e,0xd69a,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,
-    0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xbdf7,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xf79e,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x9cd3,0x6b4d,0x0000,0x0000,
-    0x0000,0x6b4d,0x8c71,0xbdf7,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp211[1740]   = // Bitmap 211
+    0x8007,0xffff,0x0003,0xdedb,0xa534,0x8c71,0x8003,0x0000,0x0004,0x4a69,0x8c71,0xb596,0xef5d,0x800a,0xffff,0x0002,
+    0xc638,0x4a69,0x800a,0x0000,0x0002,0x8c71,0xf79e,0x8007,0xffff,0x0001,0x8c71,0x800d,0x0000,0x0002,0x4a69,0xd69a,
+    0x8005,0xffff,0x0001,0x7bef,0x8010,0x0000,0x0001,0xe71c,0x8003,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0002,0x9cd3,
+    0xdedb,0x8003,0xffff,0x0002,0xdedb,0x8c71,0x8005,0x0000,0x0004,0x6b4d,0xffff,0xffff,0xd69a,0x8005,0x0000,0x0001,
+    0xd69a,0x8007,0xffff,0x0001,0xd69a,0x8005,0x0000,0x0003,0xc638,0xffff,0x6b4d,0x8004,0x0000,0x0001,0xc638,0x8009,
+    0xffff,0x0001,0xa534,0x8004,0x0000,0x0002,0x6b4d,0xef5d,0x8004,0x0000,0x0001,0x6b4d,0x800a,0xffff,0x0007,0xf79e,
+    0x4a69,0x8c71,0xbdf7,0xdedb,0xf79e,0xbdf7,0x8004,0x0000,0x0001,0xc638,0x8010,0xffff,0x0001,0x8c71,0x8004,0x0000,
+    0x0001,0xe71c,0x8010,0xffff,0x0001,0x6b4d,0x8004,0x0000,0x8011,0xffff,0x8005,0x0000,0x8011,0xffff,0x8005,0x0000,
+    0x8011,0xffff,0x8005,0x0000,0x8011,0xffff,0x0001,0x4a69,0x8004,0x0000,0x8011,0xffff,0x0001,0x8c71,0x8004,0x0000,
+    0x0001,0xe71c,0x8010,0xffff,0x0001,0xb596,0x8004,0x0000,0x0001,0xbdf7,0x800a,0xffff,0x0003,0xf79e,0x7bef,0xd69a,
+    0x8003,0xffff,0x0001,0xdedb,0x8004,0x0000,0x0001,0x6b4d,0x800a,0xffff,0x0008,0xbdf7,0x0000,0x0000,0x4a69,0xa534,
+    0xef5d,0xffff,0x6b4d,0x8004,0x0000,0x0001,0xc638,0x8009,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0003,0x7bef,0xffff,
+    0xd69a,0x8004,0x0000,0x0002,0x4a69,0xe71c,0x8007,0xffff,0x0001,0x7bef,0x8005,0x0000,0x0004,0xd69a,0xffff,0xffff,
+    0x8c71,0x8005,0x0000,0x0007,0xa534,0xe71c,0xffff,0xffff,0xf79e,0xd69a,0x6b4d,0x8005,0x0000,0x0001,0x6b4d,0x8004,
+    0xffff,0x0001,0x7bef,0x800f,0x0000,0x0002,0x4a69,0xef5d,0x8005,0xffff,0x0001,0x7bef,0x800d,0x0000,0x0002,0x4a69,
+    0xef5d,0x8007,0xffff,0x0002,0xbdf7,0x4a69,0x800a,0x0000,0x0002,0x8c71,0xf79e,0x800a,0xffff,0x0003,0xd69a,0x9cd3,
+    0x6b4d,0x8003,0x0000,0x0004,0x6b4d,0x8c71,0xbdf7,0xf79e,0x8005,0xffff
+};
+
+const uint16_t bmp211[629]   = // Bitmap 211 (RLE, 1740 words raw)
 {
     0x252f, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0xc638,0x9cd3,
-    0x7bef,0x0000,0x0000,0x0000,0x0000,0x8c71,0xa534,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf79e,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xa534,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xc638,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x8c71,0xd69a,0xf79e,0xffff,0xffff,0xf79e,0xd69a,0x6b4d,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,
-    0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x6b4d,0xd69a,0xf79e,0xffff,0xffff,0xf79e,0xd69a,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x9cd3,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xf79e,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xf79e,0xc638,0x9cd3,0x7bef,0x0000,0x0000,0x0000,0x0000,0x7bef,0x9cd3,0xc638,
-    0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp212[1740]   = // Bitmap 212
+    0x800c,0xffff,0x0004,0xf79e,0xc638,0x9cd3,0x7bef,0x8004,0x0000,0x0003,0x8c71,0xa534,0xd69a,0x8018,0xffff,0x0002,
+    0xf79e,0xa534,0x800c,0x0000,0x0002,0xa534,0xf79e,0x8014,0xffff,0x0002,0xd69a,0x4a69,0x800e,0x0000,0x0002,0x4a69,
+    0xc638,0x8012,0xffff,0x0001,0xa534,0x8012,0x0000,0x0001,0xa534,0x8010,0xffff,0x0001,0xc638,0x8014,0x0000,0x0001,
+    0xbdf7,0x800e,0xffff,0x0001,0xef5d,0x8007,0x0000,0x0008,0x8c71,0xd69a,0xf79e,0xffff,0xffff,0xf79e,0xd69a,0x6b4d,
+    0x8007,0x0000,0x0001,0xef5d,0x800d,0xffff,0x0001,0x8c71,0x8006,0x0000,0x0001,0xc638,0x8008,0xffff,0x0001,0xbdf7,
+    0x8006,0x0000,0x0001,0x8c71,0x800c,0xffff,0x0001,0xe71c,0x8006,0x0000,0x0001,0xef5d,0x800a,0xffff,0x0001,0xd69a,
+    0x8006,0x0000,0x0001,0xef5d,0x800b,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,0xbdf7,0x800c,0xffff,0x0001,0xb596,
+    0x8005,0x0000,0x0001,0xa534,0x800a,0xffff,0x0001,0xf79e,0x8005,0x0000,0x0001,0x4a69,0x800e,0xffff,0x0001,0x4a69,
+    0x8004,0x0000,0x0001,0x4a69,0x800a,0xffff,0x0001,0xc638,0x8005,0x0000,0x0001,0xb596,0x800e,0xffff,0x0001,0xb596,
+    0x8005,0x0000,0x0001,0xd69a,0x8009,0xffff,0x0001,0x9cd3,0x8005,0x0000,0x0001,0xe71c,0x800e,0xffff,0x0001,0xef5d,
+    0x8005,0x0000,0x0001,0xa534,0x8009,0xffff,0x0001,0x4a69,0x8005,0x0000,0x8010,0xffff,0x0001,0x4a69,0x8004,0x0000,
+    0x0001,0x4a69,0x8008,0xffff,0x0001,0xef5d,0x8005,0x0000,0x0001,0x8c71,0x8010,0xffff,0x0001,0x8c71,0x8005,0x0000,
+    0x0001,0xef5d,0x8007,0xffff,0x0001,0xdedb,0x8005,0x0000,0x0001,0xb596,0x8010,0xffff,0x0001,0xb596,0x8005,0x0000,
+    0x0001,0xd69a,0x8007,0xffff,0x0001,0xbdf7,0x8005,0x0000,0x0001,0xbdf7,0x8010,0xffff,0x0001,0xbdf7,0x8005,0x0000,
+    0x0001,0xbdf7,0x8007,0xffff,0x0001,0xa534,0x8005,0x0000,0x0001,0xe71c,0x8010,0xffff,0x0001,0xe71c,0x8005,0x0000,
+    0x0001,0x9cd3,0x8007,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,0xe71c,0x8010,0xffff,0x0001,0xe71c,0x8005,0x0000,
+    0x0001,0x8c71,0x8007,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,0xe71c,0x8010,0xffff,0x0001,0xef5d,0x8005,0x0000,
+    0x0001,0x8c71,0x8007,0xffff,0x0001,0x4a69,0x8005,0x0000,0x8012,0xffff,0x8006,0x0000,0x8007,0xffff,0x8006,0x0000,
+    0x8012,0xffff,0x8006,0x0000,0x8007,0xffff,0x8006,0x0000,0x8012,0xffff,0x8006,0x0000,0x8007,0xffff,0x8006,0x0000,
+    0x8012,0xffff,0x8006,0x0000,0x8007,0xffff,0x8006,0x0000,0x8012,0xffff,0x8006,0x0000,0x8007,0xffff,0x8006,0x0000,
+    0x8012,0xffff,0x8006,0x0000,0x8007,0xffff,0x8006,0x0000,0x8012,0xffff,0x8006,0x0000,0x8007,0xffff,0x8006,0x0000,
+    0x8012,0xffff,0x8006,0x0000,0x8007,0xffff,0x0001,0x6b4d,0x8005,0x0000,0x8012,0xffff,0x8005,0x0000,0x0001,0x4a69,
+    0x8007,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,0xef5d,0x8010,0xffff,0x0001,0xef5d,0x8005,0x0000,0x0001,0x8c71,
+    0x8007,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,0xe71c,0x8010,0xffff,0x0001,0xe71c,0x8005,0x0000,0x0001,0x8c71,
+    0x8007,0xffff,0x0001,0xa534,0x8005,0x0000,0x0001,0xe71c,0x8010,0xffff,0x0001,0xe71c,0x8005,0x0000,0x0001,0xa534,
+    0x8007,0xffff,0x0001,0xbdf7,0x8005,0x0000,0x0001,0xc638,0x8010,0xffff,0x0001,0xc638,0x8005,0x0000,0x0001,0xbdf7,
+    0x8007,0xffff,0x0001,0xdedb,0x8005,0x0000,0x0001,0xbdf7,0x8010,0xffff,0x0001,0xbdf7,0x8005,0x0000,0x0001,0xdedb,
+    0x8007,0xffff,0x0001,0xf79e,0x8005,0x0000,0x0001,0x8c71,0x8010,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,0xef5d,
+    0x8008,0xffff,0x0001,0x4a69,0x8004,0x0000,0x0001,0x4a69,0x8010,0xffff,0x0001,0x4a69,0x8005,0x0000,0x8009,0xffff,
+    0x0001,0x9cd3,0x8005,0x0000,0x0001,0xef5d,0x800e,0xffff,0x0001,0xef5d,0x8005,0x0000,0x0001,0x9cd3,0x8009,0xffff,
+    0x0001,0xc638,0x8005,0x0000,0x0001,0xb596,0x800e,0xffff,0x0001,0xb596,0x8005,0x0000,0x0001,0xc638,0x8009,0xffff,
+    0x0001,0xf79e,0x8005,0x0000,0x0001,0x4a69,0x800e,0xffff,0x0001,0x4a69,0x8005,0x0000,0x0001,0xf79e,0x800a,0xffff,
+    0x0001,0x9cd3,0x8005,0x0000,0x0001,0xb596,0x800c,0xffff,0x0001,0xb596,0x8005,0x0000,0x0001,0x8c71,0x800b,0xffff,
+    0x0001,0xdedb,0x8006,0x0000,0x0001,0xd69a,0x800a,0xffff,0x0001,0xd69a,0x8006,0x0000,0x0001,0xe71c,0x800c,0xffff,
+    0x0001,0x6b4d,0x8006,0x0000,0x0001,0xbdf7,0x8008,0xffff,0x0001,0xbdf7,0x8006,0x0000,0x0001,0x8c71,0x800d,0xffff,
+    0x0001,0xe71c,0x8007,0x0000,0x0008,0x6b4d,0xd69a,0xf79e,0xffff,0xffff,0xf79e,0xd69a,0x6b4d,0x8007,0x0000,0x0001,
+    0xef5d,0x800e,0xffff,0x0001,0xa534,0x8014,0x0000,0x0001,0xc638,0x8010,0xffff,0x0001,0xa534,0x8012,0x0000,0x0001,
+    0xa534,0x8012,0xffff,0x0001,0xbdf7,0x800f,0x0000,0x0002,0x4a69,0xd69a,0x8014,0xffff,0x0002,0xef5d,0x9cd3,0x800c,
+    0x0000,0x0002,0xa534,0xf79e,0x8017,0xffff,0x0004,0xf79e,0xc638,0x9cd3,0x7bef,0x8004,0x0000,0x0004,0x7bef,0x9cd3,
+    0xc638,0xf79e,0x800d,0xffff
+};
+
+const uint16_t bmp212[257]   = // Bitmap 212 (RLE, 1740 words raw)
 {
     0x252f, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x4a69,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,
-    0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xe71c,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xe71c,0xffff,0xffff,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xb596,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x8c71,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x6b4d,0xd69a,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x8c71,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp213[1740]   = // Bitmap 213
+    0x8014,0xffff,0x0001,0xf79e,0x8004,0x0000,0x8020,0xffff,0x0001,0x8c71,0x8004,0x0000,0x801f,0xffff,0x0001,0xc638,
+    0x8005,0x0000,0x801e,0xffff,0x0001,0xef5d,0x8006,0x0000,0x801d,0xffff,0x0002,0xef5d,0x4a69,0x8006,0x0000,0x801c,
+    0xffff,0x0002,0xef5d,0x4a69,0x8007,0x0000,0x801b,0xffff,0x0002,0xdedb,0x4a69,0x8008,0x0000,0x801a,0xffff,0x0001,
+    0xc638,0x800a,0x0000,0x8019,0xffff,0x0001,0x8c71,0x800b,0x0000,0x8017,0xffff,0x0002,0xd69a,0x4a69,0x800c,0x0000,
+    0x8015,0xffff,0x0002,0xe71c,0x8c71,0x8007,0x0000,0x0001,0xa534,0x8006,0x0000,0x8014,0xffff,0x0001,0x8c71,0x8008,
+    0x0000,0x0002,0xbdf7,0xffff,0x8006,0x0000,0x8014,0xffff,0x8007,0x0000,0x0004,0x6b4d,0xe71c,0xffff,0xffff,0x8006,
+    0x0000,0x8014,0xffff,0x8006,0x0000,0x0001,0xb596,0x8004,0xffff,0x8006,0x0000,0x8014,0xffff,0x8004,0x0000,0x0002,
+    0x8c71,0xe71c,0x8005,0xffff,0x8006,0x0000,0x8014,0xffff,0x0004,0x0000,0x0000,0x6b4d,0xd69a,0x8007,0xffff,0x8006,
+    0x0000,0x8014,0xffff,0x0002,0x8c71,0xdedb,0x8009,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,
+    0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,
+    0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,
+    0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,
+    0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,
+    0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,
+    0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,
+    0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x8031,0xffff
+};
+
+const uint16_t bmp213[441]   = // Bitmap 213 (RLE, 1740 words raw)
 {
     0x252f, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0xb596,
-    0x8c71,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x7bef,0x9cd3,0xc638,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf79e,0xa534,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x8c71,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xf79e,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x6b4d,0xc638,0xe71c,0xffff,0xffff,0xffff,0xef5d,0xd69a,0x8c71,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0xc638,0xb596,0x8c71,0x4a69,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,
-    0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x4a69,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x4a69,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,
-    0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xef5d,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,
-    0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x7bef,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp216[1740]   = // Bitmap 216
+    0x800d,0xffff,0x0004,0xdedb,0xb596,0x8c71,0x6b4d,0x8004,0x0000,0x0004,0x7bef,0x9cd3,0xc638,0xf79e,0x8016,0xffff,
+    0x0003,0xf79e,0xa534,0x4a69,0x800c,0x0000,0x0002,0x8c71,0xe71c,0x8013,0xffff,0x0001,0xbdf7,0x8011,0x0000,0x0001,
+    0x8c71,0x8011,0xffff,0x0001,0x9cd3,0x8013,0x0000,0x0002,0x4a69,0xef5d,0x800e,0xffff,0x0001,0x9cd3,0x8015,0x0000,
+    0x0002,0x4a69,0xf79e,0x800c,0xffff,0x0001,0xbdf7,0x8007,0x0000,0x0003,0x6b4d,0xc638,0xe71c,0x8003,0xffff,0x0003,
+    0xef5d,0xd69a,0x8c71,0x8007,0x0000,0x0001,0x7bef,0x800b,0xffff,0x0001,0xf79e,0x8007,0x0000,0x0001,0xc638,0x8009,
+    0xffff,0x0002,0xe71c,0x4a69,0x8006,0x0000,0x0001,0xbdf7,0x800a,0xffff,0x0001,0xa534,0x8006,0x0000,0x0001,0xd69a,
+    0x800c,0xffff,0x0001,0x6b4d,0x8005,0x0000,0x0001,0x4a69,0x800a,0xffff,0x8006,0x0000,0x0001,0xbdf7,0x800d,0xffff,
+    0x0001,0xef5d,0x8006,0x0000,0x0001,0xd69a,0x8008,0xffff,0x0001,0xd69a,0x8005,0x0000,0x0001,0x6b4d,0x800f,0xffff,
+    0x0001,0xa534,0x8005,0x0000,0x0001,0xa534,0x8008,0xffff,0x0001,0xa534,0x8005,0x0000,0x0001,0xb596,0x800f,0xffff,
+    0x0001,0xe71c,0x8005,0x0000,0x0001,0x7bef,0x8008,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,0xe71c,0x8010,0xffff,
+    0x8006,0x0000,0x8008,0xffff,0x8006,0x0000,0x8011,0xffff,0x8006,0x0000,0x8009,0xffff,0x0005,0xe71c,0xc638,0xb596,
+    0x8c71,0x4a69,0x8011,0xffff,0x8006,0x0000,0x801e,0xffff,0x0001,0xe71c,0x8005,0x0000,0x0001,0x6b4d,0x801e,0xffff,
+    0x0001,0xb596,0x8005,0x0000,0x0001,0x9cd3,0x801e,0xffff,0x0001,0x4a69,0x8005,0x0000,0x0001,0xd69a,0x801d,0xffff,
+    0x0001,0xb596,0x8006,0x0000,0x801d,0xffff,0x0001,0xe71c,0x8006,0x0000,0x0001,0xa534,0x801c,0xffff,0x0002,0xf79e,
+    0x4a69,0x8006,0x0000,0x0001,0xf79e,0x801c,0xffff,0x0001,0x7bef,0x8006,0x0000,0x0001,0xbdf7,0x801c,0xffff,0x0001,
+    0x7bef,0x8006,0x0000,0x0001,0x7bef,0x801c,0xffff,0x0001,0x7bef,0x8006,0x0000,0x0001,0x4a69,0x801c,0xffff,0x0001,
+    0x7bef,0x8006,0x0000,0x0002,0x4a69,0xef5d,0x801b,0xffff,0x0001,0x7bef,0x8006,0x0000,0x0002,0x4a69,0xef5d,0x801a,
+    0xffff,0x0002,0xef5d,0x4a69,0x8006,0x0000,0x0002,0x4a69,0xef5d,0x801a,0xffff,0x0002,0xef5d,0x4a69,0x8006,0x0000,
+    0x0002,0x4a69,0xef5d,0x801a,0xffff,0x0002,0xd69a,0x4a69,0x8006,0x0000,0x0002,0x4a69,0xef5d,0x801a,0xffff,0x0001,
+    0xd69a,0x8007,0x0000,0x0002,0x4a69,0xef5d,0x801a,0xffff,0x0001,0xa534,0x8007,0x0000,0x0002,0x7bef,0xf79e,0x801a,
+    0xffff,0x0001,0x7bef,0x8007,0x0000,0x0001,0x7bef,0x801a,0xffff,0x0002,0xef5d,0x6b4d,0x8007,0x0000,0x0001,0xa534,
+    0x801a,0xffff,0x0002,0xef5d,0x4a69,0x8007,0x0000,0x0001,0xbdf7,0x801a,0xffff,0x0002,0xef5d,0x4a69,0x8006,0x0000,
+    0x0002,0x4a69,0xd69a,0x801a,0xffff,0x0002,0xef5d,0x4a69,0x8006,0x0000,0x0002,0x4a69,0xef5d,0x801b,0xffff,0x0001,
+    0x7bef,0x8006,0x0000,0x0002,0x7bef,0xef5d,0x801b,0xffff,0x0001,0xa534,0x8006,0x0000,0x0001,0x7bef,0x801c,0xffff,
+    0x0001,0xdedb,0x8006,0x0000,0x0001,0x4a69,0x801d,0xffff,0x0001,0x6b4d,0x8006,0x0000,0x0001,0xef5d,0x801c,0xffff,
+    0x0001,0xd69a,0x8006,0x0000,0x0001,0xbdf7,0x801d,0xffff,0x0001,0x6b4d,0x801c,0x0000,0x8007,0xffff,0x0001,0xdedb,
+    0x801d,0x0000,0x8007,0xffff,0x0001,0xb596,0x801d,0x0000,0x8007,0xffff,0x0001,0x7bef,0x801d,0x0000,0x8007,0xffff,
+    0x801e,0x0000,0x8007,0xffff,0x801e,0x0000,0x8029,0xffff
+};
+
+const uint16_t bmp216[483]   = // Bitmap 216 (RLE, 1740 words raw)
 {
     0x252f, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xef5d,0xb596,0x8c71,0x0000,0x0000,0x0000,0x6b4d,0x8c71,
-    0xc638,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xdedb,0x6b4d,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xf79e,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x7bef,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x4a69,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xb596,0xe71c,0xffff,0xffff,
-    0xffff,0xffff,0xe71c,0xb596,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xe71c,0xc638,0xb596,0x8c71,0x4a69,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xef5d,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xdedb,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf79e,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xef5d,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x7bef,0xc638,0xef5d,0xffff,0xffff,0xffff,0xf79e,0xd69a,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xdedb,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x4a69,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x4a69,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdedb,0xb596,0x8c71,0x4a69,0x0000,0x0000,0x0000,0x4a69,0x8c71,0xb596,0xdedb,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp222[1921]   = // Bitmap 222
+    0x802d,0xffff,0x0001,0xf79e,0x8016,0x0000,0x800e,0xffff,0x0001,0xdedb,0x8016,0x0000,0x800e,0xffff,0x0001,0xbdf7,
+    0x8016,0x0000,0x800e,0xffff,0x0001,0x8c71,0x8016,0x0000,0x800e,0xffff,0x0001,0x4a69,0x8016,0x0000,0x800d,0xffff,
+    0x0001,0xf79e,0x8017,0x0000,0x800d,0xffff,0x0001,0xd69a,0x8005,0x0000,0x0001,0x8c71,0x801e,0xffff,0x0001,0xb596,
+    0x8005,0x0000,0x0001,0xb596,0x801e,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,0xd69a,0x801e,0xffff,0x8006,0x0000,
+    0x0001,0xe71c,0x801d,0xffff,0x0001,0xef5d,0x8006,0x0000,0x801e,0xffff,0x0001,0xd69a,0x8005,0x0000,0x0001,0x7bef,
+    0x801e,0xffff,0x0001,0xa534,0x8005,0x0000,0x0001,0x9cd3,0x801e,0xffff,0x0001,0x7bef,0x8005,0x0000,0x0001,0xbdf7,
+    0x801e,0xffff,0x8006,0x0000,0x0001,0xe71c,0x801d,0xffff,0x0001,0xe71c,0x8006,0x0000,0x0006,0xf79e,0xffff,0xffff,
+    0xef5d,0xb596,0x8c71,0x8003,0x0000,0x0004,0x6b4d,0x8c71,0xc638,0xf79e,0x8011,0xffff,0x0001,0xc638,0x8005,0x0000,
+    0x0004,0x4a69,0xffff,0xdedb,0x6b4d,0x800a,0x0000,0x0002,0xa534,0xf79e,0x800f,0xffff,0x0001,0xa534,0x8005,0x0000,
+    0x0002,0x7bef,0x9cd3,0x800d,0x0000,0x0002,0x4a69,0xd69a,0x800e,0xffff,0x0001,0x6b4d,0x8016,0x0000,0x0001,0xb596,
+    0x800d,0xffff,0x8018,0x0000,0x0001,0xbdf7,0x800b,0xffff,0x0001,0xe71c,0x8008,0x0000,0x0003,0x4a69,0xb596,0xe71c,
+    0x8004,0xffff,0x0003,0xe71c,0xb596,0x6b4d,0x8007,0x0000,0x0001,0xe71c,0x800a,0xffff,0x0001,0xbdf7,0x8007,0x0000,
+    0x0001,0x7bef,0x800a,0xffff,0x0001,0xbdf7,0x8006,0x0000,0x0001,0x6b4d,0x800a,0xffff,0x0001,0x9cd3,0x8006,0x0000,
+    0x0001,0x7bef,0x800c,0xffff,0x0001,0xd69a,0x8006,0x0000,0x0001,0xbdf7,0x8009,0xffff,0x0001,0x6b4d,0x8005,0x0000,
+    0x0001,0x6b4d,0x800e,0xffff,0x0001,0xa534,0x8005,0x0000,0x0001,0x6b4d,0x800a,0xffff,0x0006,0xe71c,0xc638,0xb596,
+    0x8c71,0x4a69,0xe71c,0x800e,0xffff,0x0001,0xf79e,0x8006,0x0000,0x0001,0xe71c,0x801e,0xffff,0x0001,0x9cd3,0x8005,
+    0x0000,0x0001,0xbdf7,0x801e,0xffff,0x0001,0xd69a,0x8005,0x0000,0x0001,0x8c71,0x801e,0xffff,0x0001,0xe71c,0x8005,
+    0x0000,0x0001,0x6b4d,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,0xffff,0x8006,0x0000,0x801f,
+    0xffff,0x8006,0x0000,0x801e,0xffff,0x0001,0xef5d,0x8005,0x0000,0x0001,0x8c71,0x8007,0xffff,0x8006,0x0000,0x8011,
+    0xffff,0x0001,0xdedb,0x8005,0x0000,0x0001,0xa534,0x8007,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,0xdedb,0x8010,
+    0xffff,0x0001,0xb596,0x8005,0x0000,0x0001,0xc638,0x8007,0xffff,0x0001,0xb596,0x8005,0x0000,0x0001,0xa534,0x8010,
+    0xffff,0x0001,0x6b4d,0x8005,0x0000,0x0001,0xf79e,0x8007,0xffff,0x0001,0xdedb,0x8005,0x0000,0x0001,0x4a69,0x800f,
+    0xffff,0x0001,0xd69a,0x8005,0x0000,0x0001,0x8c71,0x8009,0xffff,0x0001,0x4a69,0x8005,0x0000,0x0001,0xbdf7,0x800e,
+    0xffff,0x0001,0x4a69,0x8005,0x0000,0x0001,0xe71c,0x8009,0xffff,0x0001,0xbdf7,0x8006,0x0000,0x0001,0xe71c,0x800c,
+    0xffff,0x0001,0x7bef,0x8005,0x0000,0x0001,0x8c71,0x800b,0xffff,0x0001,0x4a69,0x8005,0x0000,0x0002,0x4a69,0xd69a,
+    0x8009,0xffff,0x0002,0xf79e,0x7bef,0x8005,0x0000,0x0002,0x4a69,0xef5d,0x800b,0xffff,0x0001,0xdedb,0x8007,0x0000,
+    0x0003,0x7bef,0xc638,0xef5d,0x8003,0xffff,0x0003,0xf79e,0xd69a,0xa534,0x8007,0x0000,0x0001,0xd69a,0x800d,0xffff,
+    0x0001,0xd69a,0x8015,0x0000,0x0001,0xa534,0x800f,0xffff,0x0001,0xd69a,0x8013,0x0000,0x0001,0xbdf7,0x8011,0xffff,
+    0x0002,0xdedb,0x4a69,0x800f,0x0000,0x0002,0x4a69,0xdedb,0x8014,0xffff,0x0002,0xbdf7,0x4a69,0x800b,0x0000,0x0002,
+    0x4a69,0xbdf7,0x8018,0xffff,0x0004,0xdedb,0xb596,0x8c71,0x4a69,0x8003,0x0000,0x0004,0x4a69,0x8c71,0xb596,0xdedb,
+    0x800e,0xffff
+};
+
+const uint16_t bmp222[574]   = // Bitmap 222 (RLE, 1921 words raw)
 {
     0x2830, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xdedb,0xbdf7,0x8c71,0x7bef,0x0000,0x0000,0x0000,0x0000,0x4a69,0x8c71,0xa534,0xd69a,0xf79e,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xe71c,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xef5d,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x6b4d,0xb596,0xdedb,0xef5d,0xffff,0xffff,0xffff,0xffff,0xe71c,0xc638,
-    0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xdedb,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x9cd3,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,
-    0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xdedb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x4a69,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x4a69,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,
-    0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,
-    0x0000,0x0000,0x8c71,0xbdf7,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x9cd3,0xc638,0xe71c,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71c,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8c71,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x9cd3,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x7bef,
-    0xb596,0xdedb,0xffff,0xffff,0xffff,0xffff,0x7bef,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,0x7bef,0xb596,
-    0xffff,0xb596,0x0000,0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xef5d,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xc638,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0xe71c,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xf79e,
-    0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x9cd3,0xffff,0xffff,0xffff,0xffff,0x4a69,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb596,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xe71c,0xffff,0xffff,0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xdedb,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,
-    0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5d,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x6b4d,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xe71c,0x8c71,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x4a69,0xa534,0xdedb,0xef5d,0xffff,0xffff,0xffff,0xffff,0xe71c,0xbdf7,0x7bef,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7bef,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0x4a69,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xb596,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6b4d,0xe71c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0xb596,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x8c71,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xef5d,0xc638,0xa534,0x8c71,0x6b4d,0x0000,0x0000,0x0000,0x0000,0x4a69,0x8c71,
-    0xa534,0xd69a,0xf79e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp223[205]   = // Bitmap 223
+    0x800f,0xffff,0x0004,0xdedb,0xbdf7,0x8c71,0x7bef,0x8004,0x0000,0x0005,0x4a69,0x8c71,0xa534,0xd69a,0xf79e,0x8018,
+    0xffff,0x0002,0xe71c,0xa534,0x800e,0x0000,0x0002,0x8c71,0xd69a,0x8014,0xffff,0x0002,0xe71c,0x8c71,0x8012,0x0000,
+    0x0002,0x6b4d,0xe71c,0x8011,0xffff,0x0001,0x9cd3,0x8016,0x0000,0x0001,0xb596,0x800e,0xffff,0x0002,0xef5d,0x4a69,
+    0x8018,0x0000,0x0001,0x8c71,0x800c,0xffff,0x0001,0xd69a,0x8008,0x0000,0x0004,0x6b4d,0xb596,0xdedb,0xef5d,0x8004,
+    0xffff,0x0003,0xe71c,0xc638,0x9cd3,0x8008,0x0000,0x0001,0x7bef,0x800a,0xffff,0x0001,0xdedb,0x8007,0x0000,0x0002,
+    0x7bef,0xdedb,0x800b,0xffff,0x0002,0xf79e,0x9cd3,0x8007,0x0000,0x0001,0xa534,0x8008,0xffff,0x0002,0xef5d,0x4a69,
+    0x8006,0x0000,0x0001,0xc638,0x800f,0xffff,0x0001,0xd69a,0x8007,0x0000,0x0001,0xdedb,0x8007,0xffff,0x0001,0x7bef,
+    0x8005,0x0000,0x0002,0x4a69,0xe71c,0x8011,0xffff,0x0001,0xd69a,0x8006,0x0000,0x0001,0x4a69,0x8006,0xffff,0x0001,
+    0xbdf7,0x8006,0x0000,0x0001,0xe71c,0x8013,0xffff,0x0001,0xbdf7,0x8006,0x0000,0x0001,0xbdf7,0x8005,0xffff,0x0001,
+    0x4a69,0x8005,0x0000,0x0001,0xc638,0x8015,0xffff,0x0001,0x6b4d,0x8005,0x0000,0x0001,0x4a69,0x8004,0xffff,0x0001,
+    0xbdf7,0x8005,0x0000,0x0001,0x8c71,0x8016,0xffff,0x0001,0xe71c,0x8006,0x0000,0x0001,0xd69a,0x8003,0xffff,0x0001,
+    0x4a69,0x8005,0x0000,0x0001,0xe71c,0x8017,0xffff,0x0001,0x6b4d,0x8005,0x0000,0x0004,0x9cd3,0xffff,0xffff,0xd69a,
+    0x8005,0x0000,0x0001,0x7bef,0x8018,0xffff,0x0001,0xc638,0x8004,0x0000,0x0005,0x8c71,0xbdf7,0xffff,0xffff,0x9cd3,
+    0x8005,0x0000,0x0001,0xc638,0x8018,0xffff,0x0004,0xf79e,0x9cd3,0xc638,0xe71c,0x8005,0xffff,0x8006,0x0000,0x0001,
+    0xf79e,0x8020,0xffff,0x0001,0xe71c,0x8005,0x0000,0x0001,0x6b4d,0x8021,0xffff,0x0001,0xbdf7,0x8005,0x0000,0x0001,
+    0xa534,0x8021,0xffff,0x0001,0xa534,0x8005,0x0000,0x0001,0xbdf7,0x8021,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,
+    0xe71c,0x8021,0xffff,0x0001,0x6b4d,0x8005,0x0000,0x0001,0xef5d,0x8021,0xffff,0x8006,0x0000,0x8022,0xffff,0x8006,
+    0x0000,0x8022,0xffff,0x8006,0x0000,0x8022,0xffff,0x8006,0x0000,0x8022,0xffff,0x8006,0x0000,0x8022,0xffff,0x0001,
+    0x4a69,0x8005,0x0000,0x8022,0xffff,0x0001,0x8c71,0x8005,0x0000,0x0001,0xe71c,0x8021,0xffff,0x0001,0x9cd3,0x8005,
+    0x0000,0x0001,0xe71c,0x8021,0xffff,0x0001,0xbdf7,0x8005,0x0000,0x0001,0xbdf7,0x8021,0xffff,0x0001,0xdedb,0x8005,
+    0x0000,0x0001,0x9cd3,0x8021,0xffff,0x0001,0xf79e,0x8005,0x0000,0x0001,0x6b4d,0x801a,0xffff,0x0004,0xf79e,0x7bef,
+    0xb596,0xdedb,0x8004,0xffff,0x0001,0x7bef,0x8005,0x0000,0x0001,0xef5d,0x8019,0xffff,0x0001,0xd69a,0x8004,0x0000,
+    0x0004,0x7bef,0xb596,0xffff,0xb596,0x8005,0x0000,0x0001,0xc638,0x8019,0xffff,0x0001,0xa534,0x8005,0x0000,0x0003,
+    0x8c71,0xffff,0xef5d,0x8005,0x0000,0x0001,0x6b4d,0x8019,0xffff,0x0001,0x4a69,0x8005,0x0000,0x0004,0xc638,0xffff,
+    0xffff,0x6b4d,0x8005,0x0000,0x0001,0xe71c,0x8017,0xffff,0x0001,0xc638,0x8006,0x0000,0x0004,0xf79e,0xffff,0xffff,
+    0xc638,0x8005,0x0000,0x0001,0x7bef,0x8017,0xffff,0x0001,0x4a69,0x8005,0x0000,0x0001,0x9cd3,0x8004,0xffff,0x0001,
+    0x4a69,0x8005,0x0000,0x0001,0xbdf7,0x8015,0xffff,0x0001,0xb596,0x8006,0x0000,0x0001,0xe71c,0x8004,0xffff,0x0001,
+    0xbdf7,0x8006,0x0000,0x0001,0xe71c,0x8013,0xffff,0x0001,0xdedb,0x8006,0x0000,0x0001,0x8c71,0x8006,0xffff,0x0001,
+    0x6b4d,0x8005,0x0000,0x0002,0x4a69,0xdedb,0x8011,0xffff,0x0002,0xef5d,0x4a69,0x8006,0x0000,0x0001,0xef5d,0x8006,
+    0xffff,0x0001,0xef5d,0x8007,0x0000,0x0001,0xbdf7,0x800f,0xffff,0x0001,0xc638,0x8007,0x0000,0x0001,0xb596,0x8008,
+    0xffff,0x0001,0xd69a,0x8007,0x0000,0x0002,0x6b4d,0xd69a,0x800b,0xffff,0x0002,0xe71c,0x8c71,0x8007,0x0000,0x0001,
+    0x7bef,0x800a,0xffff,0x0001,0xa534,0x8008,0x0000,0x0004,0x4a69,0xa534,0xdedb,0xef5d,0x8004,0xffff,0x0003,0xe71c,
+    0xbdf7,0x7bef,0x8008,0x0000,0x0001,0x7bef,0x800c,0xffff,0x0001,0xbdf7,0x8019,0x0000,0x0001,0x7bef,0x800e,0xffff,
+    0x0002,0xdedb,0x4a69,0x8016,0x0000,0x0001,0xb596,0x8011,0xffff,0x0001,0xa534,0x8013,0x0000,0x0002,0x6b4d,0xe71c,
+    0x8013,0xffff,0x0003,0xf79e,0xb596,0x6b4d,0x800e,0x0000,0x0002,0x8c71,0xd69a,0x8018,0xffff,0x0005,0xef5d,0xc638,
+    0xa534,0x8c71,0x6b4d,0x8004,0x0000,0x0005,0x4a69,0x8c71,0xa534,0xd69a,0xf79e,0x800c,0xffff
+};
+
+const uint16_t bmp223[7]   = // Bitmap 223 (RLE, 205 words raw)
 {
     0x0622, // Width and height
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t bmp226[290]   = // Bitmap 226
+    0x8024,0x0000,0x8084,0xffff,0x8024,0x0000
+};
+
+const uint16_t bmp226[179]   = // Bitmap 226 (RLE, 290 words raw)
 {
     0x1111, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x8c71,0x0000,0x0000,0x0000,0x8c71,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xd69a,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xa534,0xffff,0xffff,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x6b4d,0xd69a,0xffff,0xffff,0xffff,0xd69a,0x6b4d,0x0000,0x0000,0x0000,0xd69a,0xffff,
-    0xffff,0x4a69,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x4a69,0xffff,
-    0xc638,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0xc638,
-    0x8c71,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x8c71,
-    0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x0000,0x0000,0x0000,
-    0x8c71,0x0000,0x0000,0xd69a,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd69a,0x0000,0x0000,0x8c71,
-    0xc638,0x0000,0x0000,0x6b4d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x6b4d,0x0000,0x0000,0xc638,
-    0xffff,0x4a69,0x0000,0x0000,0xa534,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa534,0x0000,0x0000,0x4a69,0xffff,
-    0xffff,0xd69a,0x0000,0x0000,0x0000,0x6b4d,0xd69a,0xffff,0xffff,0xffff,0xd69a,0x6b4d,0x0000,0x0000,0x0000,0xd69a,0xffff,
-    0xffff,0xffff,0xbdf7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0xd69a,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xd69a,0x4a69,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4a69,0xd69a,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x8c71,0x0000,0x0000,0x0000,0x8c71,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp227[3589]   = // Bitmap 227
+    0x8005,0xffff,0x0002,0xc638,0x8c71,0x8003,0x0000,0x0002,0x8c71,0xc638,0x8008,0xffff,0x0002,0xd69a,0x4a69,0x8007,
+    0x0000,0x0002,0x4a69,0xd69a,0x8005,0xffff,0x0001,0xbdf7,0x800b,0x0000,0x0001,0xa534,0x8003,0xffff,0x0001,0xd69a,
+    0x8003,0x0000,0x0002,0x6b4d,0xd69a,0x8003,0xffff,0x0002,0xd69a,0x6b4d,0x8003,0x0000,0x0007,0xd69a,0xffff,0xffff,
+    0x4a69,0x0000,0x0000,0xa534,0x8007,0xffff,0x0009,0xa534,0x0000,0x0000,0x4a69,0xffff,0xc638,0x0000,0x0000,0x6b4d,
+    0x8009,0xffff,0x0008,0x6b4d,0x0000,0x0000,0xc638,0x8c71,0x0000,0x0000,0xd69a,0x8009,0xffff,0x0004,0xd69a,0x0000,
+    0x0000,0x8c71,0x8003,0x0000,0x800b,0xffff,0x8006,0x0000,0x800b,0xffff,0x8006,0x0000,0x800b,0xffff,0x8003,0x0000,
+    0x0004,0x8c71,0x0000,0x0000,0xd69a,0x8009,0xffff,0x0008,0xd69a,0x0000,0x0000,0x8c71,0xc638,0x0000,0x0000,0x6b4d,
+    0x8009,0xffff,0x0009,0x6b4d,0x0000,0x0000,0xc638,0xffff,0x4a69,0x0000,0x0000,0xa534,0x8007,0xffff,0x0007,0xa534,
+    0x0000,0x0000,0x4a69,0xffff,0xffff,0xd69a,0x8003,0x0000,0x0002,0x6b4d,0xd69a,0x8003,0xffff,0x0002,0xd69a,0x6b4d,
+    0x8003,0x0000,0x0001,0xd69a,0x8003,0xffff,0x0001,0xbdf7,0x800b,0x0000,0x0001,0xd69a,0x8005,0xffff,0x0002,0xd69a,
+    0x4a69,0x8007,0x0000,0x0002,0x4a69,0xd69a,0x8008,0xffff,0x0002,0xc638,0x8c71,0x8003,0x0000,0x0002,0x8c71,0xc638,
+    0x8005,0xffff
+};
+
+const uint16_t bmp227[1284]   = // Bitmap 227 (RLE, 3589 words raw)
 {
     0x5c27, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf7bf,0xf79f,0xef9f,0xef9f,0xf79f,
-    0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf7bf,0xef5f,0xdeff,0xd67f,0xce7f,
-    0xce7f,0xd69f,0xe73f,0xefbf,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xef7f,0xdedf,0xc63f,0xc61f,
-    0xd69f,0xe6ff,0xdeff,0xce7f,0xc63f,0xd6bf,0xef7f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf79f,0xdf1f,0xce7f,0xc61f,
-    0xd6bf,0xef7f,0xffdf,0xffff,0xffdf,0xf7bf,0xdf1f,0xce5f,0xd69f,0xef7f,0xffdf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xef5f,0xd6bf,0xc61f,
-    0xc63f,0xe75f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5f,0xce3f,0xdedf,0xf7bf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xef7f,0xdeff,0xc63f,
-    0xc61f,0xdedf,0xf79f,0xf7df,0xffff,0xef9f,0xce7f,0xb5bf,0xbddf,0xef5f,0xf7df,0xf7df,0xdedf,0xce5f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf7bf,0xe71f,0xce7f,
-    0xbe1f,0xce9f,0xef7f,0xf7df,0xffdf,0xf7df,0xdeff,0x8c5f,0x529f,0x423f,0x423f,0x8c3f,0xef9f,0xf7df,0xef7f,
-    0xc63f,0xe71f,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xef5f,0xd6bf,
-    0xc61f,0xce5f,0xe73f,0xf7bf,0xffdf,0xffff,0xef9f,0xad7f,0x631f,0x423f,0x425f,0x425f,0x423f,0x527f,0xd6bf,
-    0xffff,0xf7bf,0xc61f,0xd6df,0xf79f,0xffdf,0xf7bf,0xf7df,0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7df,
-    0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7df,0xf7df,0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7df,
-    0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7df,0xf7df,0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7df,0xf7df,
-    0xf7df,0xf7df,0xf7df,0xf7df,0xf7bf,0xf7bf,0xf7df,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf7bf,0xef9f,0xdeff,
-    0xce3f,0xc61f,0xdedf,0xf7bf,0xf7df,0xffdf,0xf7bf,0xce7f,0x7bff,0x4a5f,0x421f,0x425f,0x423f,0x423f,0x423f,
-    0x4a5f,0xc65f,0xffff,0xf7df,0xb5bf,0xbdff,0xd6df,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,
-    0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,
-    0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,
-    0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdf1f,0xe73f,0xef7f,0xf7bf,0xffdf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf79f,0xe73f,
-    0xce9f,0xbe1f,0xce7f,0xef5f,0xf7bf,0xffdf,0xf7bf,0xdeff,0x8c7f,0x52bf,0x421f,0x421f,0x423f,0x423f,0x423f,
-    0x423f,0x423f,0x423f,0xc65f,0xffff,0xffdf,0xbdff,0xb59f,0xc61f,0xc63f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,
-    0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc63f,0xc63f,0xc61f,0xc61f,0xc61f,0xc61f,
-    0xc61f,0xc61f,0xc61f,0xc63f,0xc61f,0xc61f,0xc61f,0xc63f,0xc63f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,
-    0xc61f,0xc63f,0xc63f,0xc63f,0xc61f,0xc61f,0xbe1f,0xbe1f,0xc61f,0xc61f,0xc63f,0xc65f,0xce5f,0xdebf,0xef5f,
-    0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf7bf,0xef7f,
-    0xd6bf,0xc61f,0xc63f,0xdf1f,0xf7bf,0xf7df,0xffff,0xef7f,0xb57f,0x5aff,0x39df,0x421f,0x423f,0x421f,0x3a1f,
-    0x423f,0x423f,0x423f,0x423f,0x423f,0xc65f,0xffff,0xffff,0xf79f,0xef7f,0xef9f,0xef9f,0xef7f,0xef7f,0xef7f,
-    0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,
-    0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,
-    0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef5f,0xef5f,0xe75f,0xe75f,0xef5f,0xef5f,0xef5f,0xe71f,0xce7f,
-    0xc61f,0xc65f,0xdeff,0xef9f,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xef9f,
-    0xdeff,0xc63f,0xc5ff,0xdedf,0xef9f,0xffff,0xffff,0xf7bf,0xce5f,0x7bbf,0x423f,0x39ff,0x3a1f,0x421f,0x421f,
-    0x421f,0x423f,0x421f,0x421f,0x421f,0x421f,0x4a5f,0xce7f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xf7bf,
-    0xf7bf,0xf79f,0xef7f,0xd6bf,0xc63f,0xd6bf,0xef9f,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,
-    0xe75f,0xd69f,0xbe1f,0xce7f,0xe75f,0xf79f,0xf7bf,0xffdf,0xe71f,0x94bf,0x4a7f,0x39ff,0x3a1f,0x3a1f,0x3a1f,
-    0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x425f,0xad9f,0xd6bf,0xdedf,0xd6bf,0xd6bf,0xd6bf,
-    0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,
-    0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,
-    0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd69f,0xd6bf,0xd69f,
-    0xd69f,0xdeff,0xef7f,0xf79f,0xf79f,0xf77f,0xdedf,0xc61f,0xdeff,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xf7bf,0xe73f,0xce5f,0xc63f,0xdf1f,0xf7bf,0xf7bf,0xf7bf,0xe73f,0xad7f,0x631f,0x39ff,0x39ff,0x3a1f,0x3a1f,
-    0x39ff,0x39ff,0x3a1f,0x3a1f,0x421f,0x421f,0x421f,0x3a1f,0x3a1f,0x3a1f,0x39ff,0x425f,0x4a9f,0x529f,0x4a7f,
-    0x4a7f,0x4a7f,0x4a5f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,
-    0x4a7f,0x4a7f,0x4a7f,0x4a5f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,
-    0x4a7f,0x4a5f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a5f,0x4a5f,0x4a7f,0x4a5f,0x4a5f,
-    0x4a5f,0x4a5f,0x4a7f,0x529f,0x739f,0xb59f,0xe75f,0xef7f,0xf79f,0xd6bf,0xce5f,0xe73f,0xffdf,0xffff,0xffff,
-    0xffff,0xffdf,0xef3f,0xce5f,0xce5f,0xef5f,0xf7bf,0xf7bf,0xf7bf,0xc65f,0x739f,0x3a1f,0x31df,0x31df,0x31df,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x3a1f,0x3a1f,0x41ff,0x41ff,0x421f,0x3a1f,0x3a1f,0x3a1f,0x39df,0x39df,0x39df,
-    0x39df,0x31df,0x31df,0x31df,0x31bf,0x31bf,0x31df,0x31df,0x31df,0x31df,0x31df,0x39df,0x31df,0x31df,0x31df,
-    0x31df,0x31df,0x39df,0x39df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x39df,0x39df,0x31df,0x31df,
-    0x39df,0x39df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x39df,0x39df,0x31df,0x31df,0x31bf,0x31df,
-    0x31df,0x31df,0x31df,0x31bf,0x31bf,0x31df,0x31bf,0x3a1f,0x8c9f,0xe75f,0xf7bf,0xe75f,0xc63f,0xd69f,0xf79f,
-    0xffff,0xffff,0xffff,0xef7f,0xd69f,0xce5f,0xef7f,0xf7bf,0xf7bf,0xdf1f,0x94bf,0x4a7f,0x31df,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39df,0x39ff,0x39ff,0x39ff,0x31df,0x39ff,0xa55f,0xf7df,0xef9f,0xd6df,
-    0xc63f,0xe75f,0xffff,0xffff,0xffdf,0xe73f,0xc63f,0xdf1f,0xf7bf,0xf7bf,0xc63f,0x631f,0x39ff,0x39df,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39df,0x31bf,0x31bf,0x631f,0xe73f,
-    0xef9f,0xe75f,0xc63f,0xdeff,0xf7df,0xffff,0xf7df,0xdeff,0xce5f,0xef7f,0xf7bf,0xd6df,0x5adf,0x31bf,0x39ff,
-    0x39df,0x39df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,
-    0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x31df,0x31df,0x31df,0x31df,
-    0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,
-    0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,
-    0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x39df,0x39df,0x39df,0x31df,0x31bf,0x31bf,
-    0x421f,0xc63f,0xf7bf,0xe77f,0xc65f,0xce9f,0xf7bf,0xffff,0xf7bf,0xd6df,0xce7f,0xef9f,0xf7bf,0xbddf,0x31bf,
-    0x31df,0x31df,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31df,0x31df,0x31df,0x31df,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31df,0x31df,0x31df,0x31bf,0x31bf,0x31bf,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31bf,
-    0x31bf,0x31bf,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31bf,0x31bf,0x31bf,
-    0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31bf,0x31bf,0x39df,0x39df,0x39df,0x31df,
-    0x299f,0x31bf,0x39ff,0xbdff,0xf7bf,0xef7f,0xc65f,0xce7f,0xef9f,0xffff,0xf7df,0xdeff,0xc63f,0xef7f,0xf7bf,
-    0xd6df,0x52bf,0x299f,0x31bf,0x319f,0x319f,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x297f,0x319f,0x39df,0xbdff,0xf7bf,0xe77f,0xc65f,0xce9f,0xf79f,0xffff,0xffdf,0xe73f,0xc61f,
-    0xdeff,0xf7bf,0xefbf,0xbdff,0x4a7f,0x319f,0x319f,0x317f,0x319f,0x319f,0x31bf,0x31bf,0x31bf,0x319f,0x319f,
-    0x319f,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x319f,0x31bf,0x31bf,0x31bf,0x297f,0x317f,0x4a5f,0xd6df,0xef9f,0xe75f,0xc65f,0xd6df,0xf7bf,0xffff,0xffff,
-    0xf79f,0xd6bf,0xc65f,0xe77f,0xf79f,0xf79f,0xc63f,0x633f,0x319f,0x297f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x295f,0x297f,0x8c3f,0xf7bf,0xef9f,0xdf1f,0xc63f,0xdf3f,0xf7df,
-    0xffff,0xffff,0xffdf,0xe73f,0xce5f,0xce7f,0xef7f,0xf7bf,0xffdf,0xe73f,0x8c9f,0x421f,0x297f,0x319f,0x319f,
-    0x319f,0x317f,0x317f,0x317f,0x317f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x317f,0x293f,0x5aff,0xdedf,0xffdf,0xef7f,0xce7f,0xce7f,
-    0xef7f,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xe73f,0xce5f,0xce5f,0xe73f,0xf7bf,0xf7bf,0xf79f,0xce5f,0x6b7f,
-    0x319f,0x215f,0x213f,0x297f,0x297f,0x317f,0x317f,0x297f,0x317f,0x317f,0x319f,0x317f,0x317f,0x319f,0x317f,
-    0x295f,0x295f,0x295f,0x297f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,
-    0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,
-    0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,
-    0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x215f,0x295f,0x295f,0x39ff,0x7bff,0xd6bf,0xf79f,0xf79f,0xdeff,
-    0xc61f,0xdeff,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xe73f,0xce5f,0xc61f,0xdeff,0xef9f,0xf79f,
-    0xf7bf,0xe75f,0xa55f,0x4a7f,0x213f,0x297f,0x297f,0x317f,0x295f,0x297f,0x297f,0x297f,0x297f,0x297f,0x295f,
-    0x297f,0x297f,0x295f,0x7bff,0x9cff,0x9cff,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,
-    0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,
-    0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,
-    0x94bf,0x94bf,0x94bf,0x94bf,0x949f,0x94bf,0x94bf,0x949f,0x949f,0x949f,0xa53f,0xc65f,0xef7f,0xef9f,0xef7f,
-    0xe73f,0xc61f,0xd69f,0xef9f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xef5f,0xd69f,0xc61f,
-    0xce5f,0xe73f,0xef9f,0xf7bf,0xf7df,0xd6bf,0x843f,0x39ff,0x295f,0x295f,0x295f,0x295f,0x297f,0x295f,0x295f,
-    0x295f,0x295f,0x295f,0x295f,0x299f,0xc63f,0xffff,0xffff,0xf7df,0xf7bf,0xf7bf,0xf7df,0xf7df,0xf7bf,0xf7bf,
-    0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,
-    0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,
-    0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf79f,0xef9f,0xf7bf,0xef9f,0xef9f,
-    0xef7f,0xdeff,0xc61f,0xce7f,0xef5f,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,
-    0xef9f,0xdeff,0xc63f,0xbdff,0xd69f,0xf79f,0xf7df,0xf7df,0xef9f,0xc65f,0x6b5f,0x295f,0x213f,0x215f,0x217f,
-    0x215f,0x215f,0x295f,0x295f,0x295f,0x293f,0x319f,0xc63f,0xffff,0xffff,0xffdf,0xf7df,0xf7df,0xf7df,0xf7df,
-    0xf7df,0xf7df,0xf7df,0xf7df,0xf7bf,0xf7bf,0xf7df,0xf7df,0xf7df,0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7bf,
-    0xf7df,0xf7df,0xf7df,0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7bf,0xf7df,0xf7df,
-    0xf7df,0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,
-    0xf79f,0xe71f,0xce7f,0xc63f,0xce9f,0xef5f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xf7df,0xef7f,0xd6bf,0xc61f,0xc63f,0xdf1f,0xef9f,0xf7bf,0xf7df,0xe75f,0xa51f,0x4a3f,
-    0x213f,0x213f,0x191f,0x191f,0x213f,0x215f,0x295f,0x213f,0x297f,0xbe1f,0xffdf,0xffdf,0xce7f,0xc63f,0xce5f,
-    0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,
-    0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,
-    0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce5f,
-    0xce5f,0xce5f,0xce5f,0xc61f,0xce5f,0xdeff,0xef7f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xe73f,0xce7f,0xbdff,0xce7f,0xe75f,0xf7bf,0xf7bf,
-    0xef9f,0xd6bf,0x7c1f,0x31bf,0x18ff,0x191f,0x213f,0x213f,0x213f,0x213f,0x295f,0xbe1f,0xffdf,0xf7bf,0xb57f,
-    0xad7f,0xc65f,0xce7f,0xce7f,0xce5f,0xce5f,0xce5f,0xce7f,0xce5f,0xce5f,0xce5f,0xce5f,0xce5f,0xce7f,0xce5f,
-    0xce5f,0xce5f,0xce7f,0xce5f,0xce5f,0xce5f,0xce5f,0xce7f,0xce5f,0xce5f,0xce5f,0xce7f,0xce5f,0xce5f,0xce5f,
-    0xce7f,0xce5f,0xce5f,0xce5f,0xce5f,0xce7f,0xce5f,0xce5f,0xce5f,0xce7f,0xce5f,0xce5f,0xce5f,0xce5f,0xce7f,
-    0xce5f,0xce5f,0xce7f,0xce7f,0xd6bf,0xdeff,0xef7f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xef9f,0xdf1f,0xc63f,0xc61f,
-    0xd6bf,0xef7f,0xef9f,0xf7bf,0xf7bf,0xbe1f,0x5aff,0x215f,0x213f,0x211f,0x211f,0x211f,0x297f,0xc63f,0xffdf,
-    0xf7bf,0xbdff,0xce9f,0xef7f,0xf7bf,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,
-    0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,
-    0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,
-    0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf7bf,0xf7bf,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,
-    0xe75f,0xd6bf,0xc61f,0xc65f,0xdf1f,0xf7bf,0xffdf,0xffff,0xe75f,0x9cdf,0x3a1f,0x211f,0x18ff,0x191f,0x5adf,
-    0xdf1f,0xf7df,0xef7f,0xc63f,0xdf1f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf7df,0xf79f,0xe73f,0xce7f,0xbdff,0xce7f,0xe75f,0xf79f,0xf7bf,0xf7bf,0xce7f,0x8c7f,0x6b7f,
-    0x843f,0xd69f,0xf7bf,0xf79f,0xdeff,0xc63f,0xef5f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xef7f,0xdedf,0xc63f,0xbe1f,0xd6df,0xef9f,0xefbf,0xf7bf,
-    0xf7bf,0xef9f,0xef9f,0xf7bf,0xf7bf,0xe75f,0xc65f,0xd6df,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xe75f,0xd6df,0xbe3f,0xc65f,
-    0xdf1f,0xef7f,0xef9f,0xef9f,0xef9f,0xef7f,0xe71f,0xce5f,0xce7f,0xef5f,0xffdf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xefbf,
-    0xdf1f,0xce7f,0xbe1f,0xce7f,0xdf1f,0xe75f,0xe73f,0xce7f,0xc61f,0xd69f,0xef5f,0xf7bf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf7df,0xef7f,0xdeff,0xce9f,0xc65f,0xc65f,0xc65f,0xce7f,0xdeff,0xef7f,0xf7df,0xffdf,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xef7f,0xe75f,0xe73f,0xe73f,0xef7f,0xf7bf,0xffdf,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffdf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp228[3589]   = // Bitmap 228
+    0x8019,0xffff,0x0001,0xffdf,0x8058,0xffff,0x0007,0xffdf,0xf7bf,0xf79f,0xef9f,0xef9f,0xf79f,0xf7df,0x8053,0xffff,
+    0x000b,0xffdf,0xf7bf,0xef5f,0xdeff,0xd67f,0xce7f,0xce7f,0xd69f,0xe73f,0xefbf,0xf7df,0x8050,0xffff,0x000d,0xf7df,
+    0xef7f,0xdedf,0xc63f,0xc61f,0xd69f,0xe6ff,0xdeff,0xce7f,0xc63f,0xd6bf,0xef7f,0xf7df,0x804d,0xffff,0x0010,0xffdf,
+    0xf79f,0xdf1f,0xce7f,0xc61f,0xd6bf,0xef7f,0xffdf,0xffff,0xffdf,0xf7bf,0xdf1f,0xce5f,0xd69f,0xef7f,0xffdf,0x804b,
+    0xffff,0x0007,0xf7df,0xef5f,0xd6bf,0xc61f,0xc63f,0xe75f,0xf7df,0x8006,0xffff,0x0004,0xef5f,0xce3f,0xdedf,0xf7bf,
+    0x8049,0xffff,0x0013,0xf7df,0xef7f,0xdeff,0xc63f,0xc61f,0xdedf,0xf79f,0xf7df,0xffff,0xef9f,0xce7f,0xb5bf,0xbddf,
+    0xef5f,0xf7df,0xf7df,0xdedf,0xce5f,0xef7f,0x8047,0xffff,0x0016,0xffdf,0xf7bf,0xe71f,0xce7f,0xbe1f,0xce9f,0xef7f,
+    0xf7df,0xffdf,0xf7df,0xdeff,0x8c5f,0x529f,0x423f,0x423f,0x8c3f,0xef9f,0xf7df,0xef7f,0xc63f,0xe71f,0xffdf,0x8045,
+    0xffff,0x001b,0xf7bf,0xef5f,0xd6bf,0xc61f,0xce5f,0xe73f,0xf7bf,0xffdf,0xffff,0xef9f,0xad7f,0x631f,0x423f,0x425f,
+    0x425f,0x423f,0x527f,0xd6bf,0xffff,0xf7bf,0xc61f,0xd6df,0xf79f,0xffdf,0xf7bf,0xf7df,0xf7df,0x8004,0xf7bf,0x0002,
+    0xf7df,0xf7df,0x8005,0xf7bf,0x8004,0xf7df,0x8005,0xf7bf,0x0001,0xf7df,0x8003,0xf7bf,0x8004,0xf7df,0x8005,0xf7bf,
+    0x8007,0xf7df,0x0004,0xf7bf,0xf7bf,0xf7df,0xf7df,0x8012,0xffff,0x0010,0xffdf,0xf7bf,0xef9f,0xdeff,0xce3f,0xc61f,
+    0xdedf,0xf7bf,0xf7df,0xffdf,0xf7bf,0xce7f,0x7bff,0x4a5f,0x421f,0x425f,0x8003,0x423f,0x0007,0x4a5f,0xc65f,0xffff,
+    0xf7df,0xb5bf,0xbdff,0xd6df,0x802e,0xdeff,0x0005,0xdf1f,0xe73f,0xef7f,0xf7bf,0xffdf,0x800e,0xffff,0x000f,0xffdf,
+    0xf79f,0xe73f,0xce9f,0xbe1f,0xce7f,0xef5f,0xf7bf,0xffdf,0xf7bf,0xdeff,0x8c7f,0x52bf,0x421f,0x421f,0x8006,0x423f,
+    0x0007,0xc65f,0xffff,0xffdf,0xbdff,0xb59f,0xc61f,0xc63f,0x800e,0xc61f,0x0002,0xc63f,0xc63f,0x8007,0xc61f,0x0001,
+    0xc63f,0x8003,0xc61f,0x0002,0xc63f,0xc63f,0x8007,0xc61f,0x8003,0xc63f,0x000c,0xc61f,0xc61f,0xbe1f,0xbe1f,0xc61f,
+    0xc61f,0xc63f,0xc65f,0xce5f,0xdebf,0xef5f,0xf7bf,0x800b,0xffff,0x0012,0xffdf,0xf7bf,0xef7f,0xd6bf,0xc61f,0xc63f,
+    0xdf1f,0xf7bf,0xf7df,0xffff,0xef7f,0xb57f,0x5aff,0x39df,0x421f,0x423f,0x421f,0x3a1f,0x8005,0x423f,0x0007,0xc65f,
+    0xffff,0xffff,0xf79f,0xef7f,0xef9f,0xef9f,0x8027,0xef7f,0x0004,0xef5f,0xef5f,0xe75f,0xe75f,0x8003,0xef5f,0x0007,
+    0xe71f,0xce7f,0xc61f,0xc65f,0xdeff,0xef9f,0xffdf,0x8008,0xffff,0x000f,0xffdf,0xef9f,0xdeff,0xc63f,0xc5ff,0xdedf,
+    0xef9f,0xffff,0xffff,0xf7bf,0xce5f,0x7bbf,0x423f,0x39ff,0x3a1f,0x8003,0x421f,0x0001,0x423f,0x8004,0x421f,0x0002,
+    0x4a5f,0xce7f,0x802d,0xffff,0x8006,0xffdf,0x0009,0xf7bf,0xf7bf,0xf79f,0xef7f,0xd6bf,0xc63f,0xd6bf,0xef9f,0xffdf,
+    0x8006,0xffff,0x000d,0xf7df,0xe75f,0xd69f,0xbe1f,0xce7f,0xe75f,0xf79f,0xf7bf,0xffdf,0xe71f,0x94bf,0x4a7f,0x39ff,
+    0x8003,0x3a1f,0x8008,0x421f,0x0004,0x425f,0xad9f,0xd6bf,0xdedf,0x802d,0xd6bf,0x000d,0xd69f,0xd6bf,0xd69f,0xd69f,
+    0xdeff,0xef7f,0xf79f,0xf79f,0xf77f,0xdedf,0xc61f,0xdeff,0xf7bf,0x8005,0xffff,0x0005,0xf7bf,0xe73f,0xce5f,0xc63f,
+    0xdf1f,0x8003,0xf7bf,0x000b,0xe73f,0xad7f,0x631f,0x39ff,0x39ff,0x3a1f,0x3a1f,0x39ff,0x39ff,0x3a1f,0x3a1f,0x8003,
+    0x421f,0x8003,0x3a1f,0x0004,0x39ff,0x425f,0x4a9f,0x529f,0x8003,0x4a7f,0x0001,0x4a5f,0x800f,0x4a7f,0x0001,0x4a5f,
+    0x800c,0x4a7f,0x0001,0x4a5f,0x8008,0x4a7f,0x0003,0x4a5f,0x4a5f,0x4a7f,0x8004,0x4a5f,0x000b,0x4a7f,0x529f,0x739f,
+    0xb59f,0xe75f,0xef7f,0xf79f,0xd6bf,0xce5f,0xe73f,0xffdf,0x8003,0xffff,0x0005,0xffdf,0xef3f,0xce5f,0xce5f,0xef5f,
+    0x8003,0xf7bf,0x0003,0xc65f,0x739f,0x3a1f,0x8003,0x31df,0x8004,0x39ff,0x0005,0x3a1f,0x3a1f,0x41ff,0x41ff,0x421f,
+    0x8003,0x3a1f,0x8004,0x39df,0x8003,0x31df,0x0002,0x31bf,0x31bf,0x8005,0x31df,0x0001,0x39df,0x8005,0x31df,0x0002,
+    0x39df,0x39df,0x8007,0x31df,0x0006,0x39df,0x39df,0x31df,0x31df,0x39df,0x39df,0x8007,0x31df,0x0005,0x39df,0x39df,
+    0x31df,0x31df,0x31bf,0x8004,0x31df,0x000c,0x31bf,0x31bf,0x31df,0x31bf,0x3a1f,0x8c9f,0xe75f,0xf7bf,0xe75f,0xc63f,
+    0xd69f,0xf79f,0x8003,0xffff,0x000a,0xef7f,0xd69f,0xce5f,0xef7f,0xf7bf,0xf7bf,0xdf1f,0x94bf,0x4a7f,0x31df,0x8043,
+    0x39ff,0x0001,0x39df,0x8003,0x39ff,0x0014,0x31df,0x39ff,0xa55f,0xf7df,0xef9f,0xd6df,0xc63f,0xe75f,0xffff,0xffff,
+    0xffdf,0xe73f,0xc63f,0xdf1f,0xf7bf,0xf7bf,0xc63f,0x631f,0x39ff,0x39df,0x8047,0x39ff,0x0016,0x39df,0x31bf,0x31bf,
+    0x631f,0xe73f,0xef9f,0xe75f,0xc63f,0xdeff,0xf7df,0xffff,0xf7df,0xdeff,0xce5f,0xef7f,0xf7bf,0xd6df,0x5adf,0x31bf,
+    0x39ff,0x39df,0x39df,0x8006,0x31df,0x8012,0x39df,0x802b,0x31df,0x8003,0x39df,0x0014,0x31df,0x31bf,0x31bf,0x421f,
+    0xc63f,0xf7bf,0xe77f,0xc65f,0xce9f,0xf7bf,0xffff,0xf7bf,0xd6df,0xce7f,0xef9f,0xf7bf,0xbddf,0x31bf,0x31df,0x31df,
+    0x8006,0x31bf,0x8004,0x31df,0x8004,0x31bf,0x8008,0x31df,0x8008,0x31bf,0x8003,0x31df,0x8003,0x31bf,0x8006,0x31df,
+    0x8003,0x31bf,0x800a,0x31df,0x8003,0x31bf,0x8009,0x31df,0x0002,0x31bf,0x31bf,0x8003,0x39df,0x0016,0x31df,0x299f,
+    0x31bf,0x39ff,0xbdff,0xf7bf,0xef7f,0xc65f,0xce7f,0xef9f,0xffff,0xf7df,0xdeff,0xc63f,0xef7f,0xf7bf,0xd6df,0x52bf,
+    0x299f,0x31bf,0x319f,0x319f,0x8047,0x31bf,0x0017,0x297f,0x319f,0x39df,0xbdff,0xf7bf,0xe77f,0xc65f,0xce9f,0xf79f,
+    0xffff,0xffdf,0xe73f,0xc61f,0xdeff,0xf7bf,0xefbf,0xbdff,0x4a7f,0x319f,0x319f,0x317f,0x319f,0x319f,0x8003,0x31bf,
+    0x8003,0x319f,0x803b,0x31bf,0x0001,0x319f,0x8003,0x31bf,0x0015,0x297f,0x317f,0x4a5f,0xd6df,0xef9f,0xe75f,0xc65f,
+    0xd6df,0xf7bf,0xffff,0xffff,0xf79f,0xd6bf,0xc65f,0xe77f,0xf79f,0xf79f,0xc63f,0x633f,0x319f,0x297f,0x8047,0x319f,
+    0x0016,0x295f,0x297f,0x8c3f,0xf7bf,0xef9f,0xdf1f,0xc63f,0xdf3f,0xf7df,0xffff,0xffff,0xffdf,0xe73f,0xce5f,0xce7f,
+    0xef7f,0xf7bf,0xffdf,0xe73f,0x8c9f,0x421f,0x297f,0x8003,0x319f,0x8004,0x317f,0x803e,0x319f,0x0009,0x317f,0x293f,
+    0x5aff,0xdedf,0xffdf,0xef7f,0xce7f,0xce7f,0xef7f,0x8004,0xffff,0x0019,0xf7bf,0xe73f,0xce5f,0xce5f,0xe73f,0xf7bf,
+    0xf7bf,0xf79f,0xce5f,0x6b7f,0x319f,0x215f,0x213f,0x297f,0x297f,0x317f,0x317f,0x297f,0x317f,0x317f,0x319f,0x317f,
+    0x317f,0x319f,0x317f,0x8003,0x295f,0x0001,0x297f,0x802f,0x295f,0x000c,0x215f,0x295f,0x295f,0x39ff,0x7bff,0xd6bf,
+    0xf79f,0xf79f,0xdeff,0xc61f,0xdeff,0xf7df,0x8005,0xffff,0x0010,0xf7bf,0xe73f,0xce5f,0xc61f,0xdeff,0xef9f,0xf79f,
+    0xf7bf,0xe75f,0xa55f,0x4a7f,0x213f,0x297f,0x297f,0x317f,0x295f,0x8005,0x297f,0x0007,0x295f,0x297f,0x297f,0x295f,
+    0x7bff,0x9cff,0x9cff,0x802b,0x94bf,0x0003,0x949f,0x94bf,0x94bf,0x8003,0x949f,0x0009,0xa53f,0xc65f,0xef7f,0xef9f,
+    0xef7f,0xe73f,0xc61f,0xd69f,0xef9f,0x8007,0xffff,0x000c,0xf7bf,0xef5f,0xd69f,0xc61f,0xce5f,0xe73f,0xef9f,0xf7bf,
+    0xf7df,0xd6bf,0x843f,0x39ff,0x8004,0x295f,0x0001,0x297f,0x8006,0x295f,0x0009,0x299f,0xc63f,0xffff,0xffff,0xf7df,
+    0xf7bf,0xf7bf,0xf7df,0xf7df,0x802a,0xf7bf,0x000b,0xf79f,0xef9f,0xf7bf,0xef9f,0xef9f,0xef7f,0xdeff,0xc61f,0xce7f,
+    0xef5f,0xffdf,0x8008,0xffff,0x0012,0xffdf,0xef9f,0xdeff,0xc63f,0xbdff,0xd69f,0xf79f,0xf7df,0xf7df,0xef9f,0xc65f,
+    0x6b5f,0x295f,0x213f,0x215f,0x217f,0x215f,0x215f,0x8003,0x295f,0x0006,0x293f,0x319f,0xc63f,0xffff,0xffff,0xffdf,
+    0x8008,0xf7df,0x0002,0xf7bf,0xf7bf,0x8004,0xf7df,0x8003,0xf7bf,0x0002,0xf7df,0xf7bf,0x8004,0xf7df,0x8003,0xf7bf,
+    0x0001,0xf7df,0x8003,0xf7bf,0x0002,0xf7df,0xf7bf,0x8004,0xf7df,0x8003,0xf7bf,0x0001,0xf7df,0x8009,0xf7bf,0x0007,
+    0xf79f,0xe71f,0xce7f,0xc63f,0xce9f,0xef5f,0xf7bf,0x800b,0xffff,0x001b,0xf7df,0xef7f,0xd6bf,0xc61f,0xc63f,0xdf1f,
+    0xef9f,0xf7bf,0xf7df,0xe75f,0xa51f,0x4a3f,0x213f,0x213f,0x191f,0x191f,0x213f,0x215f,0x295f,0x213f,0x297f,0xbe1f,
+    0xffdf,0xffdf,0xce7f,0xc63f,0xce5f,0x802c,0xce7f,0x8004,0xce5f,0x0005,0xc61f,0xce5f,0xdeff,0xef7f,0xf7df,0x800e,
+    0xffff,0x000e,0xf7bf,0xe73f,0xce7f,0xbdff,0xce7f,0xe75f,0xf7bf,0xf7bf,0xef9f,0xd6bf,0x7c1f,0x31bf,0x18ff,0x191f,
+    0x8004,0x213f,0x0009,0x295f,0xbe1f,0xffdf,0xf7bf,0xb57f,0xad7f,0xc65f,0xce7f,0xce7f,0x8003,0xce5f,0x0001,0xce7f,
+    0x8005,0xce5f,0x0001,0xce7f,0x8003,0xce5f,0x0001,0xce7f,0x8004,0xce5f,0x0001,0xce7f,0x8003,0xce5f,0x0001,0xce7f,
+    0x8003,0xce5f,0x0001,0xce7f,0x8004,0xce5f,0x0001,0xce7f,0x8003,0xce5f,0x0001,0xce7f,0x8004,0xce5f,0x0009,0xce7f,
+    0xce5f,0xce5f,0xce7f,0xce7f,0xd6bf,0xdeff,0xef7f,0xf7bf,0x8011,0xffff,0x000e,0xf7df,0xef9f,0xdf1f,0xc63f,0xc61f,
+    0xd6bf,0xef7f,0xef9f,0xf7bf,0xf7bf,0xbe1f,0x5aff,0x215f,0x213f,0x8003,0x211f,0x0008,0x297f,0xc63f,0xffdf,0xf7bf,
+    0xbdff,0xce9f,0xef7f,0xf7bf,0x802d,0xf79f,0x0003,0xf7bf,0xf7bf,0xf7df,0x8015,0xffff,0x0015,0xf7bf,0xe75f,0xd6bf,
+    0xc61f,0xc65f,0xdf1f,0xf7bf,0xffdf,0xffff,0xe75f,0x9cdf,0x3a1f,0x211f,0x18ff,0x191f,0x5adf,0xdf1f,0xf7df,0xef7f,
+    0xc63f,0xdf1f,0x8048,0xffff,0x0014,0xf7df,0xf79f,0xe73f,0xce7f,0xbdff,0xce7f,0xe75f,0xf79f,0xf7bf,0xf7bf,0xce7f,
+    0x8c7f,0x6b7f,0x843f,0xd69f,0xf7bf,0xf79f,0xdeff,0xc63f,0xef5f,0x804a,0xffff,0x0012,0xf7df,0xef7f,0xdedf,0xc63f,
+    0xbe1f,0xd6df,0xef9f,0xefbf,0xf7bf,0xf7bf,0xef9f,0xef9f,0xf7bf,0xf7bf,0xe75f,0xc65f,0xd6df,0xf7bf,0x804c,0xffff,
+    0x0007,0xf7bf,0xe75f,0xd6df,0xbe3f,0xc65f,0xdf1f,0xef7f,0x8003,0xef9f,0x0006,0xef7f,0xe71f,0xce5f,0xce7f,0xef5f,
+    0xffdf,0x804d,0xffff,0x000e,0xffdf,0xefbf,0xdf1f,0xce7f,0xbe1f,0xce7f,0xdf1f,0xe75f,0xe73f,0xce7f,0xc61f,0xd69f,
+    0xef5f,0xf7bf,0x8050,0xffff,0x0004,0xf7df,0xef7f,0xdeff,0xce9f,0x8003,0xc65f,0x0005,0xce7f,0xdeff,0xef7f,0xf7df,
+    0xffdf,0x8052,0xffff,0x0008,0xf7bf,0xef7f,0xe75f,0xe73f,0xe73f,0xef7f,0xf7bf,0xffdf,0x8057,0xffff,0x0002,0xffdf,
+    0xffdf,0x8041,0xffff
+};
+
+const uint16_t bmp228[1284]   = // Bitmap 228 (RLE, 3589 words raw)
 {
     0x5c27, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xf79f,0xef9f,0xef9f,0xf79f,0xf7bf,0xffdf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xefbf,0xe73f,0xd69f,0xce7f,0xce7f,0xd67f,0xdeff,0xef5f,0xf7bf,
-    0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xef7f,0xd6bf,0xc63f,0xce7f,0xdeff,0xe6ff,0xd69f,0xc61f,
-    0xc63f,0xdedf,0xef7f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xef7f,0xd69f,0xce5f,0xdf1f,0xf7bf,0xffdf,0xffff,
-    0xffdf,0xef7f,0xd6bf,0xc61f,0xce7f,0xdf1f,0xf79f,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xdedf,0xce3f,0xef5f,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xf7df,0xe75f,0xc63f,0xc61f,0xd6bf,0xef5f,0xf7df,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef7f,0xce5f,0xdedf,0xf7df,
-    0xf7df,0xef5f,0xbddf,0xb5bf,0xce7f,0xef9f,0xffff,0xf7df,0xf79f,0xdedf,0xc61f,0xc63f,0xdeff,0xef7f,0xf7df,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xe71f,0xc63f,
-    0xef7f,0xf7df,0xef9f,0x8c3f,0x423f,0x423f,0x529f,0x8c5f,0xdeff,0xf7df,0xffdf,0xf7df,0xef7f,0xce9f,0xbe1f,
-    0xce7f,0xe71f,0xf7bf,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xf7df,0xf7bf,0xf7bf,
-    0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7df,0xf7df,
-    0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7df,0xf7df,0xf7df,0xf7bf,
-    0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7df,0xf7bf,0xffdf,0xf79f,
-    0xd6df,0xc61f,0xf7bf,0xffff,0xd6bf,0x527f,0x423f,0x425f,0x425f,0x423f,0x631f,0xad7f,0xef9f,0xffff,0xffdf,
-    0xf7bf,0xe73f,0xce5f,0xc61f,0xd6bf,0xef5f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf7bf,0xef7f,0xe73f,0xdf1f,
-    0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,
-    0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,
-    0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,0xdeff,
-    0xdeff,0xd6df,0xbdff,0xb5bf,0xf7df,0xffff,0xc65f,0x4a5f,0x423f,0x423f,0x423f,0x425f,0x421f,0x4a5f,0x7bff,
-    0xce7f,0xf7bf,0xffdf,0xf7df,0xf7bf,0xdedf,0xc61f,0xce3f,0xdeff,0xef9f,0xf7bf,0xffdf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xef5f,0xdebf,0xce5f,
-    0xc65f,0xc63f,0xc61f,0xc61f,0xbe1f,0xbe1f,0xc61f,0xc61f,0xc63f,0xc63f,0xc63f,0xc61f,0xc61f,0xc61f,0xc61f,
-    0xc61f,0xc61f,0xc61f,0xc63f,0xc63f,0xc61f,0xc61f,0xc61f,0xc63f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,
-    0xc61f,0xc63f,0xc63f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,0xc61f,
-    0xc61f,0xc61f,0xc63f,0xc61f,0xb59f,0xbdff,0xffdf,0xffff,0xc65f,0x423f,0x423f,0x423f,0x423f,0x423f,0x423f,
-    0x421f,0x421f,0x52bf,0x8c7f,0xdeff,0xf7bf,0xffdf,0xf7bf,0xef5f,0xce7f,0xbe1f,0xce9f,0xe73f,0xf79f,0xffdf,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xef9f,0xdeff,0xc65f,
-    0xc61f,0xce7f,0xe71f,0xef5f,0xef5f,0xef5f,0xe75f,0xe75f,0xef5f,0xef5f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,
-    0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,
-    0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,0xef7f,
-    0xef7f,0xef7f,0xef7f,0xef7f,0xef9f,0xef9f,0xef7f,0xf79f,0xffff,0xffff,0xc65f,0x423f,0x423f,0x423f,0x423f,
-    0x423f,0x3a1f,0x421f,0x423f,0x421f,0x39df,0x5aff,0xb57f,0xef7f,0xffff,0xf7df,0xf7bf,0xdf1f,0xc63f,0xc61f,
-    0xd6bf,0xef7f,0xf7bf,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xef9f,0xd6bf,
-    0xc63f,0xd6bf,0xef7f,0xf79f,0xf7bf,0xf7bf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xce7f,0x4a5f,0x421f,
-    0x421f,0x421f,0x421f,0x423f,0x421f,0x421f,0x421f,0x3a1f,0x39ff,0x423f,0x7bbf,0xce5f,0xf7bf,0xffff,0xffff,
-    0xef9f,0xdedf,0xc5ff,0xc63f,0xdeff,0xef9f,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,
-    0xdeff,0xc61f,0xdedf,0xf77f,0xf79f,0xf79f,0xef7f,0xdeff,0xd69f,0xd69f,0xd6bf,0xd69f,0xd6bf,0xd6bf,0xd6bf,
-    0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,
-    0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,
-    0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xd6bf,0xdedf,0xd6bf,0xad9f,
-    0x425f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x3a1f,0x3a1f,0x3a1f,0x39ff,0x4a7f,0x94bf,
-    0xe71f,0xffdf,0xf7bf,0xf79f,0xe75f,0xce7f,0xbe1f,0xd69f,0xe75f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffdf,0xe73f,0xce5f,0xd6bf,0xf79f,0xef7f,0xe75f,0xb59f,0x739f,0x529f,0x4a7f,0x4a5f,0x4a5f,0x4a5f,0x4a5f,
-    0x4a7f,0x4a5f,0x4a5f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a5f,0x4a7f,0x4a7f,0x4a7f,
-    0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a5f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,
-    0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a7f,0x4a5f,0x4a7f,0x4a7f,0x4a7f,0x529f,
-    0x4a9f,0x425f,0x39ff,0x3a1f,0x3a1f,0x3a1f,0x421f,0x421f,0x421f,0x3a1f,0x3a1f,0x39ff,0x39ff,0x3a1f,0x3a1f,
-    0x39ff,0x39ff,0x631f,0xad7f,0xe73f,0xf7bf,0xf7bf,0xf7bf,0xdf1f,0xc63f,0xce5f,0xe73f,0xf7bf,0xffff,0xffff,
-    0xffff,0xffff,0xf79f,0xd69f,0xc63f,0xe75f,0xf7bf,0xe75f,0x8c9f,0x3a1f,0x31bf,0x31df,0x31bf,0x31bf,0x31df,
-    0x31df,0x31df,0x31df,0x31bf,0x31df,0x31df,0x39df,0x39df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,
-    0x39df,0x39df,0x31df,0x31df,0x39df,0x39df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x39df,0x39df,
-    0x31df,0x31df,0x31df,0x31df,0x31df,0x39df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31bf,0x31bf,0x31df,0x31df,
-    0x31df,0x39df,0x39df,0x39df,0x39df,0x3a1f,0x3a1f,0x3a1f,0x421f,0x41ff,0x41ff,0x3a1f,0x3a1f,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x31df,0x31df,0x31df,0x3a1f,0x739f,0xc65f,0xf7bf,0xf7bf,0xf7bf,0xef5f,0xce5f,0xce5f,0xef3f,
-    0xffdf,0xffff,0xffff,0xffff,0xe75f,0xc63f,0xd6df,0xef9f,0xf7df,0xa55f,0x39ff,0x31df,0x39ff,0x39ff,0x39ff,
-    0x39df,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x31df,0x4a7f,0x94bf,0xdf1f,0xf7bf,0xf7bf,0xef7f,
-    0xce5f,0xd69f,0xef7f,0xffff,0xffff,0xf7df,0xdeff,0xc63f,0xe75f,0xef9f,0xe73f,0x631f,0x31bf,0x31bf,0x39df,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39df,0x39ff,0x631f,0xc63f,
-    0xf7bf,0xf7bf,0xdf1f,0xc63f,0xe73f,0xffdf,0xffff,0xf7bf,0xce9f,0xc65f,0xe77f,0xf7bf,0xc63f,0x421f,0x31bf,
-    0x31bf,0x31df,0x39df,0x39df,0x39df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,
-    0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,
-    0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,
-    0x31df,0x31df,0x31df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,
-    0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x39df,0x39df,0x39ff,
-    0x31bf,0x5adf,0xd6df,0xf7bf,0xef7f,0xce5f,0xdeff,0xf7df,0xffff,0xef9f,0xce7f,0xc65f,0xef7f,0xf7bf,0xbdff,
-    0x39ff,0x31bf,0x299f,0x31df,0x39df,0x39df,0x39df,0x31bf,0x31bf,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,
-    0x31df,0x31df,0x31df,0x31bf,0x31bf,0x31bf,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,
-    0x31df,0x31bf,0x31bf,0x31bf,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,0x31bf,0x31bf,0x31bf,0x31df,0x31df,
-    0x31df,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31df,0x31df,0x31df,0x31df,0x31df,0x31df,
-    0x31df,0x31df,0x31bf,0x31bf,0x31bf,0x31bf,0x31df,0x31df,0x31df,0x31df,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31df,0x31df,0x31bf,0xbddf,0xf7bf,0xef9f,0xce7f,0xd6df,0xf7bf,0xffff,0xf79f,0xce9f,0xc65f,0xe77f,
-    0xf7bf,0xbdff,0x39df,0x319f,0x297f,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x319f,0x319f,0x31bf,0x299f,0x52bf,0xd6df,0xf7bf,0xef7f,0xc63f,0xdeff,0xf7df,0xffff,0xf7bf,0xd6df,
-    0xc65f,0xe75f,0xef9f,0xd6df,0x4a5f,0x317f,0x297f,0x31bf,0x31bf,0x31bf,0x319f,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x319f,0x319f,0x319f,0x31bf,0x31bf,
-    0x31bf,0x319f,0x319f,0x317f,0x319f,0x319f,0x4a7f,0xbdff,0xefbf,0xf7bf,0xdeff,0xc61f,0xe73f,0xffdf,0xffff,
-    0xf7df,0xdf3f,0xc63f,0xdf1f,0xef9f,0xf7bf,0x8c3f,0x297f,0x295f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x297f,0x319f,0x633f,0xc63f,0xf79f,0xf79f,0xe77f,0xc65f,0xd6bf,0xf79f,
-    0xffff,0xffff,0xffff,0xef7f,0xce7f,0xce7f,0xef7f,0xffdf,0xdedf,0x5aff,0x293f,0x317f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x317f,
-    0x317f,0x317f,0x317f,0x319f,0x319f,0x319f,0x297f,0x421f,0x8c9f,0xe73f,0xffdf,0xf7bf,0xef7f,0xce7f,0xce5f,
-    0xe73f,0xffdf,0xffff,0xffff,0xffff,0xf7df,0xdeff,0xc61f,0xdeff,0xf79f,0xf79f,0xd6bf,0x7bff,0x39ff,0x295f,
-    0x295f,0x215f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,
-    0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,
-    0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,
-    0x295f,0x295f,0x295f,0x295f,0x297f,0x295f,0x295f,0x295f,0x317f,0x319f,0x317f,0x317f,0x319f,0x317f,0x317f,
-    0x297f,0x317f,0x317f,0x297f,0x297f,0x213f,0x215f,0x319f,0x6b7f,0xce5f,0xf79f,0xf7bf,0xf7bf,0xe73f,0xce5f,
-    0xce5f,0xe73f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xef9f,0xd69f,0xc61f,0xe73f,0xef7f,0xef9f,0xef7f,
-    0xc65f,0xa53f,0x949f,0x949f,0x949f,0x94bf,0x94bf,0x949f,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,
-    0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,
-    0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,
-    0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x94bf,0x9cff,0x9cff,0x7bff,0x295f,0x297f,0x297f,0x295f,0x297f,0x297f,
-    0x297f,0x297f,0x297f,0x295f,0x317f,0x297f,0x297f,0x213f,0x4a7f,0xa55f,0xe75f,0xf7bf,0xf79f,0xef9f,0xdeff,
-    0xc61f,0xce5f,0xe73f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xef5f,0xce7f,0xc61f,0xdeff,
-    0xef7f,0xef9f,0xef9f,0xf7bf,0xef9f,0xf79f,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,
-    0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,
-    0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,
-    0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7df,0xf7bf,0xf7bf,0xf7df,0xffff,0xffff,0xc63f,0x299f,0x295f,0x295f,0x295f,
-    0x295f,0x295f,0x295f,0x297f,0x295f,0x295f,0x295f,0x295f,0x39ff,0x843f,0xd6bf,0xf7df,0xf7bf,0xef9f,0xe73f,
-    0xce5f,0xc61f,0xd69f,0xef5f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xef5f,
-    0xce9f,0xc63f,0xce7f,0xe71f,0xf79f,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7bf,0xf7df,
-    0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7df,0xf7df,0xf7df,0xf7bf,0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7bf,0xf7bf,
-    0xf7bf,0xf7df,0xf7df,0xf7df,0xf7df,0xf7bf,0xf7df,0xf7bf,0xf7bf,0xf7bf,0xf7df,0xf7df,0xf7df,0xf7df,0xf7bf,
-    0xf7bf,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xf7df,0xffdf,0xffff,0xffff,0xc63f,0x319f,0x293f,
-    0x295f,0x295f,0x295f,0x215f,0x215f,0x217f,0x215f,0x213f,0x295f,0x6b5f,0xc65f,0xef9f,0xf7df,0xf7df,0xf79f,
-    0xd69f,0xbdff,0xc63f,0xdeff,0xef9f,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xf7df,0xef7f,0xdeff,0xce5f,0xc61f,0xce5f,0xce5f,0xce5f,0xce5f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,
-    0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,
-    0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,
-    0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce7f,0xce5f,0xc63f,0xce7f,0xffdf,0xffdf,0xbe1f,
-    0x297f,0x213f,0x295f,0x215f,0x213f,0x191f,0x191f,0x213f,0x213f,0x4a3f,0xa51f,0xe75f,0xf7df,0xf7bf,0xef9f,
-    0xdf1f,0xc63f,0xc61f,0xd6bf,0xef7f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xef7f,0xdeff,0xd6bf,0xce7f,0xce7f,0xce5f,0xce5f,0xce7f,0xce5f,
-    0xce5f,0xce5f,0xce5f,0xce7f,0xce5f,0xce5f,0xce5f,0xce7f,0xce5f,0xce5f,0xce5f,0xce5f,0xce7f,0xce5f,0xce5f,
-    0xce5f,0xce7f,0xce5f,0xce5f,0xce5f,0xce7f,0xce5f,0xce5f,0xce5f,0xce5f,0xce7f,0xce5f,0xce5f,0xce5f,0xce7f,
-    0xce5f,0xce5f,0xce5f,0xce5f,0xce5f,0xce7f,0xce5f,0xce5f,0xce5f,0xce7f,0xce7f,0xc65f,0xad7f,0xb57f,0xf7bf,
-    0xffdf,0xbe1f,0x295f,0x213f,0x213f,0x213f,0x213f,0x191f,0x18ff,0x31bf,0x7c1f,0xd6bf,0xef9f,0xf7bf,0xf7bf,
-    0xe75f,0xce7f,0xbdff,0xce7f,0xe73f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xf7bf,0xf7bf,0xf79f,0xf79f,0xf79f,
-    0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,
-    0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,
-    0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf79f,0xf7bf,0xef7f,0xce9f,
-    0xbdff,0xf7bf,0xffdf,0xc63f,0x297f,0x211f,0x211f,0x211f,0x213f,0x215f,0x5aff,0xbe1f,0xf7bf,0xf7bf,0xef9f,
-    0xef7f,0xd6bf,0xc61f,0xc63f,0xdf1f,0xef9f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xdf1f,0xc63f,0xef7f,0xf7df,0xdf1f,0x5adf,0x191f,0x18ff,0x211f,0x3a1f,0x9cdf,0xe75f,0xffff,0xffdf,
-    0xf7bf,0xdf1f,0xc65f,0xc61f,0xd6bf,0xe75f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xef5f,0xc63f,0xdeff,0xf79f,0xf7bf,0xd69f,0x843f,0x6b7f,0x8c7f,0xce7f,0xf7bf,0xf7bf,
-    0xf79f,0xe75f,0xce7f,0xbdff,0xce7f,0xe73f,0xf79f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xd6df,0xc65f,0xe75f,0xf7bf,0xf7bf,0xef9f,0xef9f,0xf7bf,0xf7bf,
-    0xefbf,0xef9f,0xd6df,0xbe1f,0xc63f,0xdedf,0xef7f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xef5f,0xce7f,0xce5f,0xe71f,0xef7f,0xef9f,0xef9f,
-    0xef9f,0xef7f,0xdf1f,0xc65f,0xbe3f,0xd6df,0xe75f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xef5f,0xd69f,0xc61f,0xce7f,
-    0xe73f,0xe75f,0xdf1f,0xce7f,0xbe1f,0xce7f,0xdf1f,0xefbf,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf7df,0xef7f,
-    0xdeff,0xce7f,0xc65f,0xc65f,0xc65f,0xce9f,0xdeff,0xef7f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffdf,0xf7bf,0xef7f,0xe73f,0xe73f,0xe75f,0xef7f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp229[1369]   = // Bitmap 229
+    0x8042,0xffff,0x0001,0xffdf,0x8058,0xffff,0x0007,0xf7df,0xf79f,0xef9f,0xef9f,0xf79f,0xf7bf,0xffdf,0x8053,0xffff,
+    0x000b,0xf7df,0xefbf,0xe73f,0xd69f,0xce7f,0xce7f,0xd67f,0xdeff,0xef5f,0xf7bf,0xffdf,0x8050,0xffff,0x000d,0xf7df,
+    0xef7f,0xd6bf,0xc63f,0xce7f,0xdeff,0xe6ff,0xd69f,0xc61f,0xc63f,0xdedf,0xef7f,0xf7df,0x804e,0xffff,0x0010,0xffdf,
+    0xef7f,0xd69f,0xce5f,0xdf1f,0xf7bf,0xffdf,0xffff,0xffdf,0xef7f,0xd6bf,0xc61f,0xce7f,0xdf1f,0xf79f,0xffdf,0x804c,
+    0xffff,0x0004,0xf7bf,0xdedf,0xce3f,0xef5f,0x8006,0xffff,0x0007,0xf7df,0xe75f,0xc63f,0xc61f,0xd6bf,0xef5f,0xf7df,
+    0x804b,0xffff,0x0013,0xef7f,0xce5f,0xdedf,0xf7df,0xf7df,0xef5f,0xbddf,0xb5bf,0xce7f,0xef9f,0xffff,0xf7df,0xf79f,
+    0xdedf,0xc61f,0xc63f,0xdeff,0xef7f,0xf7df,0x8048,0xffff,0x0016,0xffdf,0xe71f,0xc63f,0xef7f,0xf7df,0xef9f,0x8c3f,
+    0x423f,0x423f,0x529f,0x8c5f,0xdeff,0xf7df,0xffdf,0xf7df,0xef7f,0xce9f,0xbe1f,0xce7f,0xe71f,0xf7bf,0xffdf,0x8016,
+    0xffff,0x0004,0xf7df,0xf7df,0xf7bf,0xf7bf,0x8007,0xf7df,0x8005,0xf7bf,0x8004,0xf7df,0x8003,0xf7bf,0x0001,0xf7df,
+    0x8005,0xf7bf,0x8004,0xf7df,0x8005,0xf7bf,0x0002,0xf7df,0xf7df,0x8004,0xf7bf,0x001b,0xf7df,0xf7df,0xf7bf,0xffdf,
+    0xf79f,0xd6df,0xc61f,0xf7bf,0xffff,0xd6bf,0x527f,0x423f,0x425f,0x425f,0x423f,0x631f,0xad7f,0xef9f,0xffff,0xffdf,
+    0xf7bf,0xe73f,0xce5f,0xc61f,0xd6bf,0xef5f,0xf7bf,0x8012,0xffff,0x0005,0xffdf,0xf7bf,0xef7f,0xe73f,0xdf1f,0x802e,
+    0xdeff,0x0007,0xd6df,0xbdff,0xb5bf,0xf7df,0xffff,0xc65f,0x4a5f,0x8003,0x423f,0x0010,0x425f,0x421f,0x4a5f,0x7bff,
+    0xce7f,0xf7bf,0xffdf,0xf7df,0xf7bf,0xdedf,0xc61f,0xce3f,0xdeff,0xef9f,0xf7bf,0xffdf,0x800e,0xffff,0x000c,0xf7bf,
+    0xef5f,0xdebf,0xce5f,0xc65f,0xc63f,0xc61f,0xc61f,0xbe1f,0xbe1f,0xc61f,0xc61f,0x8003,0xc63f,0x8007,0xc61f,0x0002,
+    0xc63f,0xc63f,0x8003,0xc61f,0x0001,0xc63f,0x8007,0xc61f,0x0002,0xc63f,0xc63f,0x800e,0xc61f,0x0007,0xc63f,0xc61f,
+    0xb59f,0xbdff,0xffdf,0xffff,0xc65f,0x8006,0x423f,0x000f,0x421f,0x421f,0x52bf,0x8c7f,0xdeff,0xf7bf,0xffdf,0xf7bf,
+    0xef5f,0xce7f,0xbe1f,0xce9f,0xe73f,0xf79f,0xffdf,0x800b,0xffff,0x0007,0xffdf,0xef9f,0xdeff,0xc65f,0xc61f,0xce7f,
+    0xe71f,0x8003,0xef5f,0x0004,0xe75f,0xe75f,0xef5f,0xef5f,0x8027,0xef7f,0x0007,0xef9f,0xef9f,0xef7f,0xf79f,0xffff,
+    0xffff,0xc65f,0x8005,0x423f,0x0012,0x3a1f,0x421f,0x423f,0x421f,0x39df,0x5aff,0xb57f,0xef7f,0xffff,0xf7df,0xf7bf,
+    0xdf1f,0xc63f,0xc61f,0xd6bf,0xef7f,0xf7bf,0xffdf,0x8008,0xffff,0x0009,0xffdf,0xef9f,0xd6bf,0xc63f,0xd6bf,0xef7f,
+    0xf79f,0xf7bf,0xf7bf,0x8006,0xffdf,0x802d,0xffff,0x0002,0xce7f,0x4a5f,0x8004,0x421f,0x0001,0x423f,0x8003,0x421f,
+    0x000f,0x3a1f,0x39ff,0x423f,0x7bbf,0xce5f,0xf7bf,0xffff,0xffff,0xef9f,0xdedf,0xc5ff,0xc63f,0xdeff,0xef9f,0xffdf,
+    0x8007,0xffff,0x000d,0xf7bf,0xdeff,0xc61f,0xdedf,0xf77f,0xf79f,0xf79f,0xef7f,0xdeff,0xd69f,0xd69f,0xd6bf,0xd69f,
+    0x802d,0xd6bf,0x0004,0xdedf,0xd6bf,0xad9f,0x425f,0x8008,0x421f,0x8003,0x3a1f,0x000d,0x39ff,0x4a7f,0x94bf,0xe71f,
+    0xffdf,0xf7bf,0xf79f,0xe75f,0xce7f,0xbe1f,0xd69f,0xe75f,0xf7df,0x8005,0xffff,0x000b,0xffdf,0xe73f,0xce5f,0xd6bf,
+    0xf79f,0xef7f,0xe75f,0xb59f,0x739f,0x529f,0x4a7f,0x8004,0x4a5f,0x0003,0x4a7f,0x4a5f,0x4a5f,0x8008,0x4a7f,0x0001,
+    0x4a5f,0x800c,0x4a7f,0x0001,0x4a5f,0x800f,0x4a7f,0x0001,0x4a5f,0x8003,0x4a7f,0x0004,0x529f,0x4a9f,0x425f,0x39ff,
+    0x8003,0x3a1f,0x8003,0x421f,0x000b,0x3a1f,0x3a1f,0x39ff,0x39ff,0x3a1f,0x3a1f,0x39ff,0x39ff,0x631f,0xad7f,0xe73f,
+    0x8003,0xf7bf,0x0005,0xdf1f,0xc63f,0xce5f,0xe73f,0xf7bf,0x8004,0xffff,0x000c,0xf79f,0xd69f,0xc63f,0xe75f,0xf7bf,
+    0xe75f,0x8c9f,0x3a1f,0x31bf,0x31df,0x31bf,0x31bf,0x8004,0x31df,0x0005,0x31bf,0x31df,0x31df,0x39df,0x39df,0x8007,
+    0x31df,0x0006,0x39df,0x39df,0x31df,0x31df,0x39df,0x39df,0x8007,0x31df,0x0002,0x39df,0x39df,0x8005,0x31df,0x0001,
+    0x39df,0x8005,0x31df,0x0002,0x31bf,0x31bf,0x8003,0x31df,0x8004,0x39df,0x8003,0x3a1f,0x0005,0x421f,0x41ff,0x41ff,
+    0x3a1f,0x3a1f,0x8004,0x39ff,0x8003,0x31df,0x0003,0x3a1f,0x739f,0xc65f,0x8003,0xf7bf,0x0005,0xef5f,0xce5f,0xce5f,
+    0xef3f,0xffdf,0x8003,0xffff,0x0008,0xe75f,0xc63f,0xd6df,0xef9f,0xf7df,0xa55f,0x39ff,0x31df,0x8003,0x39ff,0x0001,
+    0x39df,0x8043,0x39ff,0x0016,0x31df,0x4a7f,0x94bf,0xdf1f,0xf7bf,0xf7bf,0xef7f,0xce5f,0xd69f,0xef7f,0xffff,0xffff,
+    0xf7df,0xdeff,0xc63f,0xe75f,0xef9f,0xe73f,0x631f,0x31bf,0x31bf,0x39df,0x8047,0x39ff,0x0015,0x39df,0x39ff,0x631f,
+    0xc63f,0xf7bf,0xf7bf,0xdf1f,0xc63f,0xe73f,0xffdf,0xffff,0xf7bf,0xce9f,0xc65f,0xe77f,0xf7bf,0xc63f,0x421f,0x31bf,
+    0x31bf,0x31df,0x8003,0x39df,0x802b,0x31df,0x8012,0x39df,0x8006,0x31df,0x0016,0x39df,0x39df,0x39ff,0x31bf,0x5adf,
+    0xd6df,0xf7bf,0xef7f,0xce5f,0xdeff,0xf7df,0xffff,0xef9f,0xce7f,0xc65f,0xef7f,0xf7bf,0xbdff,0x39ff,0x31bf,0x299f,
+    0x31df,0x8003,0x39df,0x0002,0x31bf,0x31bf,0x8009,0x31df,0x8003,0x31bf,0x800a,0x31df,0x8003,0x31bf,0x8006,0x31df,
+    0x8003,0x31bf,0x8003,0x31df,0x8008,0x31bf,0x8008,0x31df,0x8004,0x31bf,0x8004,0x31df,0x8006,0x31bf,0x0013,0x31df,
+    0x31df,0x31bf,0xbddf,0xf7bf,0xef9f,0xce7f,0xd6df,0xf7bf,0xffff,0xf79f,0xce9f,0xc65f,0xe77f,0xf7bf,0xbdff,0x39df,
+    0x319f,0x297f,0x8047,0x31bf,0x0015,0x319f,0x319f,0x31bf,0x299f,0x52bf,0xd6df,0xf7bf,0xef7f,0xc63f,0xdeff,0xf7df,
+    0xffff,0xf7bf,0xd6df,0xc65f,0xe75f,0xef9f,0xd6df,0x4a5f,0x317f,0x297f,0x8003,0x31bf,0x0001,0x319f,0x803b,0x31bf,
+    0x8003,0x319f,0x8003,0x31bf,0x0017,0x319f,0x319f,0x317f,0x319f,0x319f,0x4a7f,0xbdff,0xefbf,0xf7bf,0xdeff,0xc61f,
+    0xe73f,0xffdf,0xffff,0xf7df,0xdf3f,0xc63f,0xdf1f,0xef9f,0xf7bf,0x8c3f,0x297f,0x295f,0x8047,0x319f,0x000a,0x297f,
+    0x319f,0x633f,0xc63f,0xf79f,0xf79f,0xe77f,0xc65f,0xd6bf,0xf79f,0x8003,0xffff,0x0009,0xef7f,0xce7f,0xce7f,0xef7f,
+    0xffdf,0xdedf,0x5aff,0x293f,0x317f,0x803e,0x319f,0x8004,0x317f,0x8003,0x319f,0x000b,0x297f,0x421f,0x8c9f,0xe73f,
+    0xffdf,0xf7bf,0xef7f,0xce7f,0xce5f,0xe73f,0xffdf,0x8003,0xffff,0x000c,0xf7df,0xdeff,0xc61f,0xdeff,0xf79f,0xf79f,
+    0xd6bf,0x7bff,0x39ff,0x295f,0x295f,0x215f,0x802f,0x295f,0x0001,0x297f,0x8003,0x295f,0x0019,0x317f,0x319f,0x317f,
+    0x317f,0x319f,0x317f,0x317f,0x297f,0x317f,0x317f,0x297f,0x297f,0x213f,0x215f,0x319f,0x6b7f,0xce5f,0xf79f,0xf7bf,
+    0xf7bf,0xe73f,0xce5f,0xce5f,0xe73f,0xf7bf,0x8005,0xffff,0x0009,0xef9f,0xd69f,0xc61f,0xe73f,0xef7f,0xef9f,0xef7f,
+    0xc65f,0xa53f,0x8003,0x949f,0x0003,0x94bf,0x94bf,0x949f,0x802b,0x94bf,0x0007,0x9cff,0x9cff,0x7bff,0x295f,0x297f,
+    0x297f,0x295f,0x8005,0x297f,0x0010,0x295f,0x317f,0x297f,0x297f,0x213f,0x4a7f,0xa55f,0xe75f,0xf7bf,0xf79f,0xef9f,
+    0xdeff,0xc61f,0xce5f,0xe73f,0xf7bf,0x8006,0xffff,0x000b,0xffdf,0xef5f,0xce7f,0xc61f,0xdeff,0xef7f,0xef9f,0xef9f,
+    0xf7bf,0xef9f,0xf79f,0x802a,0xf7bf,0x0009,0xf7df,0xf7df,0xf7bf,0xf7bf,0xf7df,0xffff,0xffff,0xc63f,0x299f,0x8006,
+    0x295f,0x0001,0x297f,0x8004,0x295f,0x000c,0x39ff,0x843f,0xd6bf,0xf7df,0xf7bf,0xef9f,0xe73f,0xce5f,0xc61f,0xd69f,
+    0xef5f,0xf7bf,0x8008,0xffff,0x0007,0xf7bf,0xef5f,0xce9f,0xc63f,0xce7f,0xe71f,0xf79f,0x8009,0xf7bf,0x0001,0xf7df,
+    0x8003,0xf7bf,0x8004,0xf7df,0x0002,0xf7bf,0xf7df,0x8003,0xf7bf,0x0001,0xf7df,0x8003,0xf7bf,0x8004,0xf7df,0x0002,
+    0xf7bf,0xf7df,0x8003,0xf7bf,0x8004,0xf7df,0x0002,0xf7bf,0xf7bf,0x8008,0xf7df,0x0006,0xffdf,0xffff,0xffff,0xc63f,
+    0x319f,0x293f,0x8003,0x295f,0x0012,0x215f,0x215f,0x217f,0x215f,0x213f,0x295f,0x6b5f,0xc65f,0xef9f,0xf7df,0xf7df,
+    0xf79f,0xd69f,0xbdff,0xc63f,0xdeff,0xef9f,0xffdf,0x800a,0xffff,0x0005,0xf7df,0xef7f,0xdeff,0xce5f,0xc61f,0x8004,
+    0xce5f,0x802c,0xce7f,0x001b,0xce5f,0xc63f,0xce7f,0xffdf,0xffdf,0xbe1f,0x297f,0x213f,0x295f,0x215f,0x213f,0x191f,
+    0x191f,0x213f,0x213f,0x4a3f,0xa51f,0xe75f,0xf7df,0xf7bf,0xef9f,0xdf1f,0xc63f,0xc61f,0xd6bf,0xef7f,0xf7df,0x800e,
+    0xffff,0x0009,0xf7bf,0xef7f,0xdeff,0xd6bf,0xce7f,0xce7f,0xce5f,0xce5f,0xce7f,0x8004,0xce5f,0x0001,0xce7f,0x8003,
+    0xce5f,0x0001,0xce7f,0x8004,0xce5f,0x0001,0xce7f,0x8003,0xce5f,0x0001,0xce7f,0x8003,0xce5f,0x0001,0xce7f,0x8004,
+    0xce5f,0x0001,0xce7f,0x8003,0xce5f,0x0001,0xce7f,0x8005,0xce5f,0x0001,0xce7f,0x8003,0xce5f,0x0009,0xce7f,0xce7f,
+    0xc65f,0xad7f,0xb57f,0xf7bf,0xffdf,0xbe1f,0x295f,0x8004,0x213f,0x000e,0x191f,0x18ff,0x31bf,0x7c1f,0xd6bf,0xef9f,
+    0xf7bf,0xf7bf,0xe75f,0xce7f,0xbdff,0xce7f,0xe73f,0xf7bf,0x8012,0xffff,0x0003,0xf7df,0xf7bf,0xf7bf,0x802d,0xf79f,
+    0x0008,0xf7bf,0xef7f,0xce9f,0xbdff,0xf7bf,0xffdf,0xc63f,0x297f,0x8003,0x211f,0x000e,0x213f,0x215f,0x5aff,0xbe1f,
+    0xf7bf,0xf7bf,0xef9f,0xef7f,0xd6bf,0xc61f,0xc63f,0xdf1f,0xef9f,0xf7df,0x8045,0xffff,0x0015,0xdf1f,0xc63f,0xef7f,
+    0xf7df,0xdf1f,0x5adf,0x191f,0x18ff,0x211f,0x3a1f,0x9cdf,0xe75f,0xffff,0xffdf,0xf7bf,0xdf1f,0xc65f,0xc61f,0xd6bf,
+    0xe75f,0xf7bf,0x8047,0xffff,0x0014,0xef5f,0xc63f,0xdeff,0xf79f,0xf7bf,0xd69f,0x843f,0x6b7f,0x8c7f,0xce7f,0xf7bf,
+    0xf7bf,0xf79f,0xe75f,0xce7f,0xbdff,0xce7f,0xe73f,0xf79f,0xf7df,0x8048,0xffff,0x0012,0xf7bf,0xd6df,0xc65f,0xe75f,
+    0xf7bf,0xf7bf,0xef9f,0xef9f,0xf7bf,0xf7bf,0xefbf,0xef9f,0xd6df,0xbe1f,0xc63f,0xdedf,0xef7f,0xf7df,0x804a,0xffff,
+    0x0006,0xffdf,0xef5f,0xce7f,0xce5f,0xe71f,0xef7f,0x8003,0xef9f,0x0007,0xef7f,0xdf1f,0xc65f,0xbe3f,0xd6df,0xe75f,
+    0xf7bf,0x804d,0xffff,0x000e,0xf7bf,0xef5f,0xd69f,0xc61f,0xce7f,0xe73f,0xe75f,0xdf1f,0xce7f,0xbe1f,0xce7f,0xdf1f,
+    0xefbf,0xffdf,0x804e,0xffff,0x0005,0xffdf,0xf7df,0xef7f,0xdeff,0xce7f,0x8003,0xc65f,0x0004,0xce9f,0xdeff,0xef7f,
+    0xf7df,0x8052,0xffff,0x0008,0xffdf,0xf7bf,0xef7f,0xe73f,0xe73f,0xe75f,0xef7f,0xf7bf,0x8057,0xffff,0x0002,0xffdf,
+    0xffdf,0x8019,0xffff
+};
+
+const uint16_t bmp229[904]   = // Bitmap 229 (RLE, 1369 words raw)
 {
     0x2426, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xe75f,0xdeff,0xdedf,0xdeff,0xef7f,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffbf,0xf7bf,0xf7bf,0xffff,0xf7bf,0xdeff,0xd69f,0xe73f,
-    0xef5f,0xdedf,0xd69f,0xe73f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef9f,0xdeff,0xdedf,0xd6bf,
-    0xd6bf,0xd6df,0xce9f,0xd6df,0xf79f,0xf79f,0xe73f,0xef9f,0xef5f,0xd6bf,0xe73f,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xef7f,0xd6bf,0xdeff,0xef5f,0xef7f,0xef7f,0xdeff,0xd6bf,0xf79f,0xd6bf,0x7c1f,0x631f,0x94bf,0xef5f,
-    0xef7f,0xd69f,0xe73f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xd6df,0xe71f,0xef7f,0xd69f,0xc63f,0xce7f,0xef7f,0xffff,
-    0xd6df,0x739f,0x423f,0x421f,0x4a5f,0x949f,0xef7f,0xe73f,0xce9f,0xe75f,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef7f,0xd6bf,0xf79f,
-    0xb5bf,0x5aff,0x4a9f,0x52bf,0xb5bf,0xe73f,0x7bdf,0x423f,0x4a5f,0x4a5f,0x4a5f,0x4a7f,0x9cdf,0xef7f,0xe73f,
-    0xd69f,0xef7f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xef5f,0xdedf,0xf79f,0x8c7f,0x423f,0x423f,0x421f,0x843f,0x843f,0x423f,0x423f,0x4a5f,
-    0x4a5f,0x425f,0x423f,0x4a5f,0xa51f,0xf79f,0xe73f,0xd6bf,0xef7f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe73f,0xd6bf,0xef9f,0x8c5f,0x423f,0x423f,
-    0x423f,0x529f,0x4a5f,0x423f,0x4a3f,0x423f,0x4a3f,0x423f,0x423f,0x423f,0x529f,0xad5f,0xf79f,0xdf1f,0xd69f,
-    0xef7f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xe73f,0xd6df,0xf79f,0x8c5f,0x423f,0x423f,0x423f,0x423f,0x423f,0x423f,0x423f,0x423f,0x423f,0x423f,0x423f,
-    0x423f,0x423f,0x529f,0xad9f,0xf7bf,0xdedf,0xd69f,0xf79f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe75f,0xdedf,0xf79f,0x845f,0x421f,0x423f,0x421f,0x421f,0x423f,
-    0x423f,0x423f,0x423f,0x423f,0x423f,0x421f,0x423f,0x423f,0x3a1f,0x52df,0xc61f,0xf7bf,0xdedf,0xdedf,0xf7bf,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdf1f,0xd6bf,0xef9f,
-    0x843f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,
-    0x421f,0x5aff,0xbe1f,0xf79f,0xd6df,0xd6df,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xef7f,0xce7f,0xdf1f,0xef7f,0x7bff,0x421f,0x421f,0x423f,0x421f,0x421f,0x421f,0x421f,0x421f,
-    0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x3a1f,0x62ff,0xce5f,0xef9f,0xd6bf,0xdedf,0xf7bf,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xd6bf,0xdeff,0xf7df,0xb5bf,0x527f,0x3a1f,0x421f,
-    0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x421f,0x41ff,0x41ff,0x421f,0x421f,0x41ff,0x39ff,
-    0x6b5f,0xd69f,0xef9f,0xd69f,0xdeff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xd6df,0xdedf,
-    0xf7bf,0xbe1f,0x529f,0x39df,0x3a1f,0x39ff,0x41ff,0x39ff,0x39ff,0x39ff,0x41ff,0x39ff,0x39ff,0x41ff,0x39ff,
-    0x41ff,0x41ff,0x421f,0x421f,0x39ff,0x39ff,0x39ff,0x6b7f,0xd6df,0xef7f,0xd69f,0xe71f,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf79f,0xdedf,0xd6bf,0xf79f,0xc63f,0x5adf,0x39ff,0x3a1f,0x3a1f,0x39ff,0x41ff,0x39ff,0x39ff,
-    0x39ff,0x41ff,0x39ff,0x39ff,0x41ff,0x39ff,0x41ff,0x41ff,0x421f,0x41ff,0x39ff,0x3a1f,0x39ff,0x39ff,0x7bbf,
-    0xdeff,0xef5f,0xce9f,0xe71f,0xf7df,0xffff,0xffff,0xffff,0xdf1f,0xd6bf,0xf79f,0xce7f,0x5aff,0x39df,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,0x39ff,
-    0x39ff,0x39ff,0x39ff,0x39ff,0x39df,0x39ff,0x7bff,0xdf1f,0xe75f,0xd69f,0xef7f,0xffff,0xffff,0xf79f,0xd6bf,
-    0xef7f,0xd6bf,0x633f,0x31df,0x39df,0x39df,0x39df,0x39ff,0x39df,0x39df,0x39ff,0x39df,0x39df,0x39df,0x39df,
-    0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x845f,0xef9f,
-    0xdeff,0xdeff,0xffff,0xffff,0xe73f,0xd6df,0xef9f,0x843f,0x31df,0x31df,0x39df,0x39df,0x39df,0x39df,0x39df,
-    0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,
-    0x39df,0x39df,0x39df,0x31bf,0x421f,0xc63f,0xe73f,0xd6bf,0xf7bf,0xffff,0xe73f,0xd6df,0xef9f,0x94bf,0x529f,
-    0x4a7f,0x421f,0x31df,0x31df,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x39df,0x39df,0x39df,0x39df,0x39df,
-    0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x39df,0x31df,0x423f,0x4a7f,0x5adf,0xc63f,0xe73f,0xd6bf,0xffbf,
-    0xffff,0xf79f,0xd6bf,0xef5f,0xef7f,0xd6bf,0xce9f,0x73bf,0x31bf,0x31bf,0x31bf,0x39df,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x94bf,
-    0xd6bf,0xdedf,0xef7f,0xdeff,0xdf1f,0xffff,0xffff,0xffff,0xe73f,0xd6bf,0xdedf,0xe73f,0xf7bf,0x841f,0x319f,
-    0x31bf,0x73bf,0xad5f,0xa53f,0xa53f,0x8c5f,0x39ff,0x319f,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,0x31bf,
-    0x31bf,0x31bf,0x31bf,0x31bf,0x319f,0xad5f,0xf7bf,0xe71f,0xd6df,0xd6bf,0xef9f,0xffff,0xffff,0xffff,0xf7df,
-    0xef7f,0xce7f,0xc63f,0xef7f,0x841f,0x319f,0x39df,0xb5bf,0xffdf,0xef7f,0xf7bf,0xd6bf,0x4a5f,0x317f,0x31bf,
-    0x31bf,0x31bf,0x319f,0x319f,0x319f,0x31bf,0x319f,0x319f,0x31bf,0x319f,0x319f,0xa55f,0xef7f,0xc61f,0xdedf,
-    0xef9f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe75f,0xce9f,0xef9f,0x7c1f,0x297f,0x39bf,0xbddf,0xffdf,
-    0xe71f,0xef9f,0xd6ff,0x4a5f,0x295f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,0x319f,
-    0x299f,0x297f,0xa55f,0xef9f,0xce9f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5f,0xd69f,
-    0xef9f,0x7c1f,0x297f,0x31bf,0xad7f,0xf7bf,0xef7f,0xef9f,0xce7f,0x423f,0x297f,0x317f,0x317f,0x317f,0x317f,
-    0x317f,0x317f,0x319f,0x317f,0x317f,0x319f,0x297f,0x297f,0xa55f,0xef9f,0xd6bf,0xf7bf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xe73f,0xce7f,0xef7f,0x7bff,0x297f,0x319f,0x529f,0x739f,0x6b7f,0x6b7f,0x5aff,
-    0x31bf,0x317f,0x317f,0x317f,0x317f,0x297f,0x297f,0x297f,0x317f,0x317f,0x319f,0x319f,0x299f,0x297f,0xa53f,
-    0xef7f,0xce9f,0xf79f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe75f,0xce9f,0xef7f,0x7bff,0x295f,
-    0x297f,0x293f,0x213f,0x293f,0x213f,0x295f,0x295f,0x297f,0x297f,0x297f,0x39ff,0x5aff,0x6b7f,0x6b7f,0x633f,
-    0x421f,0x295f,0x297f,0x297f,0x295f,0xa53f,0xef9f,0xce9f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xef5f,0xd69f,0xef7f,0x7bff,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,
-    0x39df,0xa53f,0xe73f,0xef7f,0xe75f,0xe75f,0xad9f,0x31bf,0x293f,0x295f,0x295f,0xa53f,0xef9f,0xd6bf,0xf7bf,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe75f,0xce9f,0xef7f,0x7bff,0x293f,0x295f,0x295f,0x295f,
-    0x295f,0x295f,0x295f,0x295f,0x295f,0x215f,0x529f,0xdedf,0xe71f,0xce7f,0xce5f,0xe73f,0xdeff,0x423f,0x293f,
-    0x295f,0x295f,0xa53f,0xef7f,0xce9f,0xf79f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe75f,0xce9f,
-    0xef7f,0x7bff,0x213f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x295f,0x213f,0x5adf,0xdf1f,0xce9f,
-    0xc63f,0xc63f,0xd6df,0xdeff,0x4a5f,0x213f,0x213f,0x213f,0xa53f,0xef7f,0xce9f,0xf7bf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xef5f,0xce9f,0xef7f,0x7bdf,0x211f,0x213f,0x213f,0x213f,0x213f,0x213f,0x213f,
-    0x213f,0x213f,0x213f,0x5adf,0xe73f,0xd6bf,0xdeff,0xdeff,0xdeff,0xdf1f,0x425f,0x211f,0x213f,0x213f,0xa53f,
-    0xef7f,0xd69f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5f,0xce9f,0xef7f,0x73df,0x211f,
-    0x213f,0x213f,0x213f,0x213f,0x211f,0x213f,0x213f,0x213f,0x211f,0x5abf,0xe71f,0xd6df,0xdf1f,0xdeff,0xdeff,
-    0xdeff,0x423f,0x211f,0x211f,0x211f,0xa53f,0xef7f,0xd69f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xef5f,0xce7f,0xef5f,0x7bff,0x211f,0x213f,0x213f,0x213f,0x213f,0x213f,0x213f,0x213f,0x213f,0x211f,
-    0x5adf,0xdf1f,0xd6bf,0xdeff,0xdedf,0xdeff,0xdeff,0x4a5f,0x211f,0x213f,0x293f,0xad5f,0xe75f,0xd69f,0xf7bf,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79f,0xd69f,0xef7f,0xa51f,0x293f,0x18ff,0x18ff,0x18ff,
-    0x18ff,0x18ff,0x18ff,0x18ff,0x18ff,0x18ff,0x739f,0xe75f,0xd6df,0xe73f,0xe71f,0xd6df,0xe73f,0x5aff,0x18df,
-    0x18df,0x39bf,0xc63f,0xe73f,0xd6bf,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd6df,
-    0xdf1f,0xe73f,0x9cdf,0x739f,0x6b7f,0x6b7f,0x6b7f,0x6b7f,0x6b7f,0x6b7f,0x6b9f,0x843f,0xce7f,0xe75f,0xd6bf,
-    0xef9f,0xef7f,0xd69f,0xef7f,0xbdff,0x7bdf,0x7bdf,0xad7f,0xe75f,0xd6df,0xe71f,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xe75f,0xd69f,0xdf1f,0xe75f,0xe75f,0xef7f,0xef7f,0xe75f,0xef7f,0xef7f,
-    0xef7f,0xe75f,0xef7f,0xe75f,0xd6bf,0xdeff,0xffdf,0xf7bf,0xdedf,0xdedf,0xef5f,0xef5f,0xef5f,0xef5f,0xd6df,
-    0xd6bf,0xef9f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5f,0xd6df,0xce9f,
-    0xd6bf,0xd6bf,0xd6bf,0xd69f,0xd69f,0xd6bf,0xd6bf,0xd6bf,0xd69f,0xd6bf,0xdeff,0xf7bf,0xffff,0xffff,0xf79f,
-    0xdeff,0xd69f,0xd6bf,0xd6bf,0xd69f,0xd6df,0xef7f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xef7f,0xe73f,0xe73f,0xe71f,0xdf1f,0xe71f,0xe73f,0xe71f,0xe73f,0xef7f,
-    0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef9f,0xe75f,0xef5f,0xf79f,0xffdf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp230[1027]   = // Bitmap 230
+    0x8033,0xffff,0x0006,0xf7df,0xe75f,0xdeff,0xdedf,0xdeff,0xef7f,0x8019,0xffff,0x000c,0xffbf,0xf7bf,0xf7bf,0xffff,
+    0xf7bf,0xdeff,0xd69f,0xe73f,0xef5f,0xdedf,0xd69f,0xe73f,0x8016,0xffff,0x000f,0xef9f,0xdeff,0xdedf,0xd6bf,0xd6bf,
+    0xd6df,0xce9f,0xd6df,0xf79f,0xf79f,0xe73f,0xef9f,0xef5f,0xd6bf,0xe73f,0x8014,0xffff,0x0011,0xef7f,0xd6bf,0xdeff,
+    0xef5f,0xef7f,0xef7f,0xdeff,0xd6bf,0xf79f,0xd6bf,0x7c1f,0x631f,0x94bf,0xef5f,0xef7f,0xd69f,0xe73f,0x8012,0xffff,
+    0x0013,0xf7bf,0xd6df,0xe71f,0xef7f,0xd69f,0xc63f,0xce7f,0xef7f,0xffff,0xd6df,0x739f,0x423f,0x421f,0x4a5f,0x949f,
+    0xef7f,0xe73f,0xce9f,0xe75f,0x8011,0xffff,0x000b,0xef7f,0xd6bf,0xf79f,0xb5bf,0x5aff,0x4a9f,0x52bf,0xb5bf,0xe73f,
+    0x7bdf,0x423f,0x8003,0x4a5f,0x0006,0x4a7f,0x9cdf,0xef7f,0xe73f,0xd69f,0xef7f,0x8010,0xffff,0x0015,0xef5f,0xdedf,
+    0xf79f,0x8c7f,0x423f,0x423f,0x421f,0x843f,0x843f,0x423f,0x423f,0x4a5f,0x4a5f,0x425f,0x423f,0x4a5f,0xa51f,0xf79f,
+    0xe73f,0xd6bf,0xef7f,0x800f,0xffff,0x0004,0xe73f,0xd6bf,0xef9f,0x8c5f,0x8003,0x423f,0x0006,0x529f,0x4a5f,0x423f,
+    0x4a3f,0x423f,0x4a3f,0x8003,0x423f,0x0006,0x529f,0xad5f,0xf79f,0xdf1f,0xd69f,0xef7f,0x800e,0xffff,0x0004,0xe73f,
+    0xd6df,0xf79f,0x8c5f,0x800d,0x423f,0x0006,0x529f,0xad9f,0xf7bf,0xdedf,0xd69f,0xf79f,0x800d,0xffff,0x0008,0xe75f,
+    0xdedf,0xf79f,0x845f,0x421f,0x423f,0x421f,0x421f,0x8006,0x423f,0x000a,0x421f,0x423f,0x423f,0x3a1f,0x52df,0xc61f,
+    0xf7bf,0xdedf,0xdedf,0xf7bf,0x800c,0xffff,0x0004,0xdf1f,0xd6bf,0xef9f,0x843f,0x800f,0x421f,0x0006,0x5aff,0xbe1f,
+    0xf79f,0xd6df,0xd6df,0xf7bf,0x800a,0xffff,0x0008,0xef7f,0xce7f,0xdf1f,0xef7f,0x7bff,0x421f,0x421f,0x423f,0x800c,
+    0x421f,0x0007,0x3a1f,0x62ff,0xce5f,0xef9f,0xd6bf,0xdedf,0xf7bf,0x8008,0xffff,0x0007,0xf7bf,0xd6bf,0xdeff,0xf7df,
+    0xb5bf,0x527f,0x3a1f,0x800a,0x421f,0x000b,0x41ff,0x41ff,0x421f,0x421f,0x41ff,0x39ff,0x6b5f,0xd69f,0xef9f,0xd69f,
+    0xdeff,0x8007,0xffff,0x000a,0xf7bf,0xd6df,0xdedf,0xf7bf,0xbe1f,0x529f,0x39df,0x3a1f,0x39ff,0x41ff,0x8003,0x39ff,
+    0x0009,0x41ff,0x39ff,0x39ff,0x41ff,0x39ff,0x41ff,0x41ff,0x421f,0x421f,0x8003,0x39ff,0x0005,0x6b7f,0xd6df,0xef7f,
+    0xd69f,0xe71f,0x8005,0xffff,0x000b,0xf79f,0xdedf,0xd6bf,0xf79f,0xc63f,0x5adf,0x39ff,0x3a1f,0x3a1f,0x39ff,0x41ff,
+    0x8003,0x39ff,0x0013,0x41ff,0x39ff,0x39ff,0x41ff,0x39ff,0x41ff,0x41ff,0x421f,0x41ff,0x39ff,0x3a1f,0x39ff,0x39ff,
+    0x7bbf,0xdeff,0xef5f,0xce9f,0xe71f,0xf7df,0x8003,0xffff,0x0006,0xdf1f,0xd6bf,0xf79f,0xce7f,0x5aff,0x39df,0x8014,
+    0x39ff,0x000f,0x39df,0x39ff,0x7bff,0xdf1f,0xe75f,0xd69f,0xef7f,0xffff,0xffff,0xf79f,0xd6bf,0xef7f,0xd6bf,0x633f,
+    0x31df,0x8003,0x39df,0x0004,0x39ff,0x39df,0x39df,0x39ff,0x8011,0x39df,0x000c,0x845f,0xef9f,0xdeff,0xdeff,0xffff,
+    0xffff,0xe73f,0xd6df,0xef9f,0x843f,0x31df,0x31df,0x8017,0x39df,0x0010,0x31bf,0x421f,0xc63f,0xe73f,0xd6bf,0xf7bf,
+    0xffff,0xe73f,0xd6df,0xef9f,0x94bf,0x529f,0x4a7f,0x421f,0x31df,0x31df,0x8006,0x31bf,0x800c,0x39df,0x0010,0x31df,
+    0x423f,0x4a7f,0x5adf,0xc63f,0xe73f,0xd6bf,0xffbf,0xffff,0xf79f,0xd6bf,0xef5f,0xef7f,0xd6bf,0xce9f,0x73bf,0x8003,
+    0x31bf,0x0001,0x39df,0x8011,0x31bf,0x0006,0x94bf,0xd6bf,0xdedf,0xef7f,0xdeff,0xdf1f,0x8003,0xffff,0x000f,0xe73f,
+    0xd6bf,0xdedf,0xe73f,0xf7bf,0x841f,0x319f,0x31bf,0x73bf,0xad5f,0xa53f,0xa53f,0x8c5f,0x39ff,0x319f,0x800b,0x31bf,
+    0x0007,0x319f,0xad5f,0xf7bf,0xe71f,0xd6df,0xd6bf,0xef9f,0x8003,0xffff,0x000f,0xf7df,0xef7f,0xce7f,0xc63f,0xef7f,
+    0x841f,0x319f,0x39df,0xb5bf,0xffdf,0xef7f,0xf7bf,0xd6bf,0x4a5f,0x317f,0x8003,0x31bf,0x8003,0x319f,0x000b,0x31bf,
+    0x319f,0x319f,0x31bf,0x319f,0x319f,0xa55f,0xef7f,0xc61f,0xdedf,0xef9f,0x8006,0xffff,0x000d,0xe75f,0xce9f,0xef9f,
+    0x7c1f,0x297f,0x39bf,0xbddf,0xffdf,0xe71f,0xef9f,0xd6ff,0x4a5f,0x295f,0x800a,0x319f,0x0006,0x299f,0x297f,0xa55f,
+    0xef9f,0xce9f,0xf7bf,0x8007,0xffff,0x000d,0xef5f,0xd69f,0xef9f,0x7c1f,0x297f,0x31bf,0xad7f,0xf7bf,0xef7f,0xef9f,
+    0xce7f,0x423f,0x297f,0x8006,0x317f,0x000a,0x319f,0x317f,0x317f,0x319f,0x297f,0x297f,0xa55f,0xef9f,0xd6bf,0xf7bf,
+    0x8007,0xffff,0x000c,0xe73f,0xce7f,0xef7f,0x7bff,0x297f,0x319f,0x529f,0x739f,0x6b7f,0x6b7f,0x5aff,0x31bf,0x8004,
+    0x317f,0x8003,0x297f,0x000a,0x317f,0x317f,0x319f,0x319f,0x299f,0x297f,0xa53f,0xef7f,0xce9f,0xf79f,0x8007,0xffff,
+    0x000c,0xe75f,0xce9f,0xef7f,0x7bff,0x295f,0x297f,0x293f,0x213f,0x293f,0x213f,0x295f,0x295f,0x8003,0x297f,0x000e,
+    0x39ff,0x5aff,0x6b7f,0x6b7f,0x633f,0x421f,0x295f,0x297f,0x297f,0x295f,0xa53f,0xef9f,0xce9f,0xf7bf,0x8007,0xffff,
+    0x0004,0xef5f,0xd69f,0xef7f,0x7bff,0x800a,0x295f,0x000f,0x39df,0xa53f,0xe73f,0xef7f,0xe75f,0xe75f,0xad9f,0x31bf,
+    0x293f,0x295f,0x295f,0xa53f,0xef9f,0xd6bf,0xf7bf,0x8007,0xffff,0x0005,0xe75f,0xce9f,0xef7f,0x7bff,0x293f,0x8008,
+    0x295f,0x0010,0x215f,0x529f,0xdedf,0xe71f,0xce7f,0xce5f,0xe73f,0xdeff,0x423f,0x293f,0x295f,0x295f,0xa53f,0xef7f,
+    0xce9f,0xf79f,0x8007,0xffff,0x0005,0xe75f,0xce9f,0xef7f,0x7bff,0x213f,0x8008,0x295f,0x0009,0x213f,0x5adf,0xdf1f,
+    0xce9f,0xc63f,0xc63f,0xd6df,0xdeff,0x4a5f,0x8003,0x213f,0x0004,0xa53f,0xef7f,0xce9f,0xf7bf,0x8007,0xffff,0x0005,
+    0xef5f,0xce9f,0xef7f,0x7bdf,0x211f,0x8009,0x213f,0x0003,0x5adf,0xe73f,0xd6bf,0x8003,0xdeff,0x0009,0xdf1f,0x425f,
+    0x211f,0x213f,0x213f,0xa53f,0xef7f,0xd69f,0xf7bf,0x8007,0xffff,0x0005,0xef5f,0xce9f,0xef7f,0x73df,0x211f,0x8004,
+    0x213f,0x0001,0x211f,0x8003,0x213f,0x0005,0x211f,0x5abf,0xe71f,0xd6df,0xdf1f,0x8003,0xdeff,0x0001,0x423f,0x8003,
+    0x211f,0x0004,0xa53f,0xef7f,0xd69f,0xf7bf,0x8007,0xffff,0x0005,0xef5f,0xce7f,0xef5f,0x7bff,0x211f,0x8008,0x213f,
+    0x0010,0x211f,0x5adf,0xdf1f,0xd6bf,0xdeff,0xdedf,0xdeff,0xdeff,0x4a5f,0x211f,0x213f,0x293f,0xad5f,0xe75f,0xd69f,
+    0xf7bf,0x8007,0xffff,0x0005,0xf79f,0xd69f,0xef7f,0xa51f,0x293f,0x8009,0x18ff,0x000f,0x739f,0xe75f,0xd6df,0xe73f,
+    0xe71f,0xd6df,0xe73f,0x5aff,0x18df,0x18df,0x39bf,0xc63f,0xe73f,0xd6bf,0xffdf,0x8008,0xffff,0x0005,0xd6df,0xdf1f,
+    0xe73f,0x9cdf,0x739f,0x8006,0x6b7f,0x0010,0x6b9f,0x843f,0xce7f,0xe75f,0xd6bf,0xef9f,0xef7f,0xd69f,0xef7f,0xbdff,
+    0x7bdf,0x7bdf,0xad7f,0xe75f,0xd6df,0xe71f,0x8009,0xffff,0x0008,0xe75f,0xd69f,0xdf1f,0xe75f,0xe75f,0xef7f,0xef7f,
+    0xe75f,0x8003,0xef7f,0x0009,0xe75f,0xef7f,0xe75f,0xd6bf,0xdeff,0xffdf,0xf7bf,0xdedf,0xdedf,0x8004,0xef5f,0x0003,
+    0xd6df,0xd6bf,0xef9f,0x800a,0xffff,0x0003,0xef5f,0xd6df,0xce9f,0x8003,0xd6bf,0x0002,0xd69f,0xd69f,0x8003,0xd6bf,
+    0x000e,0xd69f,0xd6bf,0xdeff,0xf7bf,0xffff,0xffff,0xf79f,0xdeff,0xd69f,0xd6bf,0xd6bf,0xd69f,0xd6df,0xef7f,0x800d,
+    0xffff,0x000b,0xef7f,0xe73f,0xe73f,0xe71f,0xdf1f,0xe71f,0xe73f,0xe71f,0xe73f,0xef7f,0xf7bf,0x8006,0xffff,0x0005,
+    0xef9f,0xe75f,0xef5f,0xf79f,0xffdf,0x8006,0xffff
+};
+
+const uint16_t bmp230[741]   = // Bitmap 230 (RLE, 1027 words raw)
 {
     0x1b26, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef9f,0xe71f,0xdedf,0xd6bf,0xce9f,0xd69f,0xd69f,
-    0xd6bf,0xdeff,0xe73f,0xef7f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xe75f,0xdedf,0xd6bf,0xd6bf,0xdf1f,0xe75f,0xe75f,0xef7f,0xef7f,0xe73f,0xdeff,0xd6bf,
-    0xd69f,0xdeff,0xef7f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xdf1f,
-    0xd69f,0xe71f,0xf7bf,0xf7bf,0xf79f,0xe73f,0xdedf,0xdeff,0xdeff,0xe73f,0xf7bf,0xf7df,0xef7f,0xdf1f,0xd6bf,
-    0xdeff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5f,0xd6bf,0xd6df,0xef7f,0xf79f,0xd69f,
-    0xa51f,0x7bff,0x6b5f,0x631f,0x5b1f,0x631f,0x6b7f,0x841f,0xad5f,0xd69f,0xf7bf,0xef7f,0xd69f,0xd6df,0xf79f,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xef9f,0xce9f,0xdf1f,0xf7bf,0xd6df,0x8c7f,0x5adf,0x4a5f,0x423f,0x425f,
-    0x4a5f,0x4a5f,0x4a5f,0x425f,0x423f,0x4a5f,0x5aff,0x9cdf,0xdf1f,0xef9f,0xdedf,0xd6bf,0xf79f,0xffff,0xffff,
-    0xffff,0xffff,0xdedf,0xdeff,0xffdf,0xc63f,0x6b7f,0x4a5f,0x423f,0x425f,0x425f,0x425f,0x425f,0x423f,0x425f,
-    0x425f,0x425f,0x423f,0x423f,0x4a5f,0x73bf,0xd69f,0xf7df,0xd6bf,0xdeff,0xffff,0xffff,0xffff,0xdeff,0xd6bf,
-    0xf79f,0xc63f,0x5aff,0x425f,0x4a3f,0x4a5f,0x4a5f,0x425f,0x425f,0x4a7f,0x4a7f,0x4a5f,0x423f,0x4a5f,0x4a5f,
-    0x4a5f,0x4a5f,0x421f,0x739f,0xdeff,0xef5f,0xce7f,0xef7f,0xffff,0xef7f,0xd69f,0xef7f,0xdf1f,0x739f,0x421f,
-    0x423f,0x423f,0x423f,0x423f,0x5aff,0x949f,0xad9f,0xbddf,0xad5f,0x7bff,0x4a7f,0x421f,0x423f,0x4a3f,0x421f,
-    0x423f,0x94bf,0xf79f,0xdedf,0xdeff,0xffff,0xe71f,0xd6df,0xf7df,0xa51f,0x4a5f,0x423f,0x423f,0x423f,0x3a1f,
-    0x633f,0xce7f,0xf7df,0xf7bf,0xf7bf,0xf7df,0xef7f,0xad5f,0x4a7f,0x423f,0x423f,0x423f,0x421f,0x5aff,0xd6bf,
-    0xef5f,0xd6bf,0xf7bf,0xd69f,0xe71f,0xe71f,0x6b5f,0x421f,0x423f,0x423f,0x423f,0x4a7f,0xb5bf,0xf7bf,0xdedf,
-    0xc65f,0xce7f,0xce5f,0xe71f,0xf79f,0x8c5f,0x423f,0x423f,0x423f,0x423f,0x423f,0xad5f,0xef7f,0xd69f,0xef5f,
-    0xce9f,0xef9f,0xce7f,0x4a7f,0x421f,0x423f,0x421f,0x421f,0x7bdf,0xef7f,0xe73f,0xce7f,0xe71f,0xef7f,0xdedf,
-    0xc63f,0xf79f,0xbdff,0x4a5f,0x421f,0x421f,0x423f,0x421f,0x949f,0xf79f,0xd6bf,0xef5f,0xd69f,0xf79f,0xc61f,
-    0x423f,0x421f,0x421f,0x421f,0x4a5f,0xb5bf,0xf7bf,0xd69f,0xe73f,0xffff,0xffff,0xef7f,0xc63f,0xef9f,0xce5f,
-    0x4a7f,0x421f,0x421f,0x421f,0x39ff,0x8c7f,0xf79f,0xd6df,0xef5f,0xd69f,0xef5f,0xce9f,0x52bf,0x39ff,0x39ff,
-    0x39df,0x633f,0xdf1f,0xe73f,0xd69f,0xf79f,0xffdf,0xf79f,0xd6bf,0xd69f,0xf7bf,0xa55f,0x423f,0x421f,0x421f,
-    0x421f,0x421f,0x94df,0xef7f,0xd69f,0xef5f,0xdeff,0xdeff,0xf79f,0xad5f,0x5adf,0x423f,0x52bf,0xb5bf,0xf7df,
-    0xd6bf,0xe71f,0xffff,0xef9f,0xd6df,0xd6bf,0xf79f,0xdedf,0x631f,0x39ff,0x3a1f,0x3a1f,0x39ff,0x4a5f,0xbdff,
-    0xef7f,0xd6bf,0xf79f,0xef7f,0xd6bf,0xef5f,0xf79f,0xdedf,0xc63f,0xd6bf,0xf7bf,0xef3f,0xd6bf,0xf7bf,0xf79f,
-    0xd6bf,0xdedf,0xf7bf,0xd6bf,0x73bf,0x39df,0x39ff,0x3a1f,0x39ff,0x39df,0x73bf,0xe73f,0xe71f,0xdedf,0xffff,
-    0xffff,0xe75f,0xd6bf,0xd6df,0xe75f,0xef9f,0xe75f,0xdedf,0xd6bf,0xe73f,0xef7f,0xd6bf,0xdedf,0xf7bf,0xce7f,
-    0x6b7f,0x3a1f,0x39ff,0x421f,0x3a1f,0x31df,0x529f,0xc63f,0xef7f,0xce7f,0xe73f,0xffff,0xffff,0xffff,0xf79f,
-    0xdeff,0xd6df,0xd6bf,0xd6bf,0xe71f,0xf79f,0xef7f,0xd6bf,0xdeff,0xf79f,0xce5f,0x5aff,0x31bf,0x39ff,0x39ff,
-    0x39ff,0x39df,0x4a5f,0xad5f,0xf7bf,0xdeff,0xd6bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xdedf,0xdeff,0xf7df,0xc61f,0x5adf,0x31bf,0x39df,0x39df,0x39df,0x31bf,0x4a7f,0xad9f,
-    0xef9f,0xe73f,0xd69f,0xef7f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe73f,
-    0xd67f,0xf79f,0xce7f,0x52df,0x31bf,0x39df,0x39ff,0x39ff,0x31bf,0x529f,0xb5df,0xf79f,0xdeff,0xce9f,0xe73f,
-    0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd6df,0xe71f,0xef5f,0x73bf,
-    0x319f,0x31bf,0x31df,0x31bf,0x31bf,0x5adf,0xbdff,0xf7bf,0xe71f,0xce7f,0xef7f,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef7f,0xd6bf,0xef9f,0xb5bf,0x39ff,0x31bf,0x31bf,0x31bf,
-    0x319f,0x52bf,0xc65f,0xf79f,0xdeff,0xd69f,0xef5f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdf1f,0xd6bf,0xe75f,0x7c1f,0x319f,0x39bf,0x31bf,0x31bf,0x423f,0xbddf,0xf7bf,
-    0xd6bf,0xd69f,0xef5f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xdeff,0xdf1f,0xe75f,0x633f,0x299f,0x319f,0x319f,0x319f,0x7bff,0xef9f,0xdeff,0xce7f,0xf79f,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdeff,0xe73f,
-    0xdf1f,0x52df,0x299f,0x319f,0x317f,0x39df,0xad7f,0xef9f,0xce7f,0xe73f,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdeff,0xdeff,0xe73f,0x635f,0x297f,
-    0x297f,0x295f,0x423f,0xce7f,0xe73f,0xce9f,0xef7f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef5f,0xd6df,0xef7f,0xad9f,0x423f,0x297f,0x299f,0x843f,
-    0xef7f,0xdf1f,0xdeff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xf7bf,0xd6bf,0xdedf,0xef9f,0xce5f,0xa53f,0xad9f,0xe75f,0xe75f,0xce7f,0xef5f,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xce9f,0xbe1f,0xef9f,0xf7df,0xef9f,0xef9f,0xf7df,0xdeff,0xc61f,0xe73f,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef7f,0xd69f,
-    0xdf1f,0xe77f,0xad9f,0x7bff,0x7c1f,0xbdff,0xef7f,0xdf1f,0xd6df,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdeff,0xdeff,0xe75f,0x8c7f,0x319f,
-    0x213f,0x211f,0x39ff,0xad5f,0xef9f,0xd6bf,0xe71f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79f,0xd6bf,0xe75f,0xc65f,0x39df,0x213f,0x295f,0x293f,0x213f,
-    0x5adf,0xdeff,0xdeff,0xd6df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xf7bf,0xd6bf,0xef9f,0xb59f,0x295f,0x211f,0x291f,0x291f,0x211f,0x421f,0xd6bf,0xe73f,
-    0xd6df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xf7bf,0xd6bf,0xe75f,0xc63f,0x31bf,0x20ff,0x213f,0x211f,0x211f,0x5adf,0xdeff,0xdeff,0xd6df,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedf,0xdeff,
-    0xe73f,0x843f,0x297f,0x211f,0x211f,0x39ff,0xa55f,0xef5f,0xd6bf,0xe71f,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef7f,0xd6bf,0xe73f,0xe75f,0xad7f,
-    0x7bff,0x843f,0xbdff,0xe75f,0xdf1f,0xd6df,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe73f,0xce9f,0xdeff,0xe75f,0xe73f,0xe77f,0xe75f,
-    0xd6bf,0xd6bf,0xef7f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe73f,0xd6bf,0xd69f,0xd69f,0xd6bf,0xd69f,0xd6df,0xef7f,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf79f,0xe73f,0xef7f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp231[916]   = // Bitmap 231
+    0x8008,0xffff,0x000b,0xef9f,0xe71f,0xdedf,0xd6bf,0xce9f,0xd69f,0xd69f,0xd6bf,0xdeff,0xe73f,0xef7f,0x800e,0xffff,
+    0x000f,0xe75f,0xdedf,0xd6bf,0xd6bf,0xdf1f,0xe75f,0xe75f,0xef7f,0xef7f,0xe73f,0xdeff,0xd6bf,0xd69f,0xdeff,0xef7f,
+    0x800a,0xffff,0x0012,0xf7bf,0xdf1f,0xd69f,0xe71f,0xf7bf,0xf7bf,0xf79f,0xe73f,0xdedf,0xdeff,0xdeff,0xe73f,0xf7bf,
+    0xf7df,0xef7f,0xdf1f,0xd6bf,0xdeff,0x8008,0xffff,0x0015,0xef5f,0xd6bf,0xd6df,0xef7f,0xf79f,0xd69f,0xa51f,0x7bff,
+    0x6b5f,0x631f,0x5b1f,0x631f,0x6b7f,0x841f,0xad5f,0xd69f,0xf7bf,0xef7f,0xd69f,0xd6df,0xf79f,0x8005,0xffff,0x000a,
+    0xef9f,0xce9f,0xdf1f,0xf7bf,0xd6df,0x8c7f,0x5adf,0x4a5f,0x423f,0x425f,0x8003,0x4a5f,0x000a,0x425f,0x423f,0x4a5f,
+    0x5aff,0x9cdf,0xdf1f,0xef9f,0xdedf,0xd6bf,0xf79f,0x8004,0xffff,0x0007,0xdedf,0xdeff,0xffdf,0xc63f,0x6b7f,0x4a5f,
+    0x423f,0x8004,0x425f,0x0001,0x423f,0x8003,0x425f,0x0008,0x423f,0x423f,0x4a5f,0x73bf,0xd69f,0xf7df,0xd6bf,0xdeff,
+    0x8003,0xffff,0x000f,0xdeff,0xd6bf,0xf79f,0xc63f,0x5aff,0x425f,0x4a3f,0x4a5f,0x4a5f,0x425f,0x425f,0x4a7f,0x4a7f,
+    0x4a5f,0x423f,0x8004,0x4a5f,0x000d,0x421f,0x739f,0xdeff,0xef5f,0xce7f,0xef7f,0xffff,0xef7f,0xd69f,0xef7f,0xdf1f,
+    0x739f,0x421f,0x8004,0x423f,0x0016,0x5aff,0x949f,0xad9f,0xbddf,0xad5f,0x7bff,0x4a7f,0x421f,0x423f,0x4a3f,0x421f,
+    0x423f,0x94bf,0xf79f,0xdedf,0xdeff,0xffff,0xe71f,0xd6df,0xf7df,0xa51f,0x4a5f,0x8003,0x423f,0x000a,0x3a1f,0x633f,
+    0xce7f,0xf7df,0xf7bf,0xf7bf,0xf7df,0xef7f,0xad5f,0x4a7f,0x8003,0x423f,0x000b,0x421f,0x5aff,0xd6bf,0xef5f,0xd6bf,
+    0xf7bf,0xd69f,0xe71f,0xe71f,0x6b5f,0x421f,0x8003,0x423f,0x000a,0x4a7f,0xb5bf,0xf7bf,0xdedf,0xc65f,0xce7f,0xce5f,
+    0xe71f,0xf79f,0x8c5f,0x8005,0x423f,0x0023,0xad5f,0xef7f,0xd69f,0xef5f,0xce9f,0xef9f,0xce7f,0x4a7f,0x421f,0x423f,
+    0x421f,0x421f,0x7bdf,0xef7f,0xe73f,0xce7f,0xe71f,0xef7f,0xdedf,0xc63f,0xf79f,0xbdff,0x4a5f,0x421f,0x421f,0x423f,
+    0x421f,0x949f,0xf79f,0xd6bf,0xef5f,0xd69f,0xf79f,0xc61f,0x423f,0x8003,0x421f,0x000c,0x4a5f,0xb5bf,0xf7bf,0xd69f,
+    0xe73f,0xffff,0xffff,0xef7f,0xc63f,0xef9f,0xce5f,0x4a7f,0x8003,0x421f,0x0018,0x39ff,0x8c7f,0xf79f,0xd6df,0xef5f,
+    0xd69f,0xef5f,0xce9f,0x52bf,0x39ff,0x39ff,0x39df,0x633f,0xdf1f,0xe73f,0xd69f,0xf79f,0xffdf,0xf79f,0xd6bf,0xd69f,
+    0xf7bf,0xa55f,0x423f,0x8004,0x421f,0x0054,0x94df,0xef7f,0xd69f,0xef5f,0xdeff,0xdeff,0xf79f,0xad5f,0x5adf,0x423f,
+    0x52bf,0xb5bf,0xf7df,0xd6bf,0xe71f,0xffff,0xef9f,0xd6df,0xd6bf,0xf79f,0xdedf,0x631f,0x39ff,0x3a1f,0x3a1f,0x39ff,
+    0x4a5f,0xbdff,0xef7f,0xd6bf,0xf79f,0xef7f,0xd6bf,0xef5f,0xf79f,0xdedf,0xc63f,0xd6bf,0xf7bf,0xef3f,0xd6bf,0xf7bf,
+    0xf79f,0xd6bf,0xdedf,0xf7bf,0xd6bf,0x73bf,0x39df,0x39ff,0x3a1f,0x39ff,0x39df,0x73bf,0xe73f,0xe71f,0xdedf,0xffff,
+    0xffff,0xe75f,0xd6bf,0xd6df,0xe75f,0xef9f,0xe75f,0xdedf,0xd6bf,0xe73f,0xef7f,0xd6bf,0xdedf,0xf7bf,0xce7f,0x6b7f,
+    0x3a1f,0x39ff,0x421f,0x3a1f,0x31df,0x529f,0xc63f,0xef7f,0xce7f,0xe73f,0x8003,0xffff,0x000e,0xf79f,0xdeff,0xd6df,
+    0xd6bf,0xd6bf,0xe71f,0xf79f,0xef7f,0xd6bf,0xdeff,0xf79f,0xce5f,0x5aff,0x31bf,0x8003,0x39ff,0x0006,0x39df,0x4a5f,
+    0xad5f,0xf7bf,0xdeff,0xd6bf,0x800b,0xffff,0x0006,0xdedf,0xdeff,0xf7df,0xc61f,0x5adf,0x31bf,0x8003,0x39df,0x0007,
+    0x31bf,0x4a7f,0xad9f,0xef9f,0xe73f,0xd69f,0xef7f,0x800a,0xffff,0x0011,0xe73f,0xd67f,0xf79f,0xce7f,0x52df,0x31bf,
+    0x39df,0x39ff,0x39ff,0x31bf,0x529f,0xb5df,0xf79f,0xdeff,0xce9f,0xe73f,0xf7bf,0x800a,0xffff,0x000f,0xd6df,0xe71f,
+    0xef5f,0x73bf,0x319f,0x31bf,0x31df,0x31bf,0x31bf,0x5adf,0xbdff,0xf7bf,0xe71f,0xce7f,0xef7f,0x800b,0xffff,0x0005,
+    0xef7f,0xd6bf,0xef9f,0xb5bf,0x39ff,0x8003,0x31bf,0x0007,0x319f,0x52bf,0xc65f,0xf79f,0xdeff,0xd69f,0xef5f,0x800c,
+    0xffff,0x000e,0xdf1f,0xd6bf,0xe75f,0x7c1f,0x319f,0x39bf,0x31bf,0x31bf,0x423f,0xbddf,0xf7bf,0xd6bf,0xd69f,0xef5f,
+    0x800d,0xffff,0x0005,0xdeff,0xdf1f,0xe75f,0x633f,0x299f,0x8003,0x319f,0x0005,0x7bff,0xef9f,0xdeff,0xce7f,0xf79f,
+    0x800e,0xffff,0x000c,0xdeff,0xe73f,0xdf1f,0x52df,0x299f,0x319f,0x317f,0x39df,0xad7f,0xef9f,0xce7f,0xe73f,0x800f,
+    0xffff,0x000c,0xdeff,0xdeff,0xe73f,0x635f,0x297f,0x297f,0x295f,0x423f,0xce7f,0xe73f,0xce9f,0xef7f,0x800f,0xffff,
+    0x000b,0xef5f,0xd6df,0xef7f,0xad9f,0x423f,0x297f,0x299f,0x843f,0xef7f,0xdf1f,0xdeff,0x8010,0xffff,0x000b,0xf7bf,
+    0xd6bf,0xdedf,0xef9f,0xce5f,0xa53f,0xad9f,0xe75f,0xe75f,0xce7f,0xef5f,0x8011,0xffff,0x000a,0xce9f,0xbe1f,0xef9f,
+    0xf7df,0xef9f,0xef9f,0xf7df,0xdeff,0xc61f,0xe73f,0x8010,0xffff,0x000c,0xef7f,0xd69f,0xdf1f,0xe77f,0xad9f,0x7bff,
+    0x7c1f,0xbdff,0xef7f,0xdf1f,0xd6df,0xf7bf,0x800f,0xffff,0x000c,0xdeff,0xdeff,0xe75f,0x8c7f,0x319f,0x213f,0x211f,
+    0x39ff,0xad5f,0xef9f,0xd6bf,0xe71f,0x800e,0xffff,0x000d,0xf79f,0xd6bf,0xe75f,0xc65f,0x39df,0x213f,0x295f,0x293f,
+    0x213f,0x5adf,0xdeff,0xdeff,0xd6df,0x800e,0xffff,0x000d,0xf7bf,0xd6bf,0xef9f,0xb59f,0x295f,0x211f,0x291f,0x291f,
+    0x211f,0x421f,0xd6bf,0xe73f,0xd6df,0x800e,0xffff,0x000d,0xf7bf,0xd6bf,0xe75f,0xc63f,0x31bf,0x20ff,0x213f,0x211f,
+    0x211f,0x5adf,0xdeff,0xdeff,0xd6df,0x800f,0xffff,0x000c,0xdedf,0xdeff,0xe73f,0x843f,0x297f,0x211f,0x211f,0x39ff,
+    0xa55f,0xef5f,0xd6bf,0xe71f,0x800f,0xffff,0x000c,0xef7f,0xd6bf,0xe73f,0xe75f,0xad7f,0x7bff,0x843f,0xbdff,0xe75f,
+    0xdf1f,0xd6df,0xf7bf,0x8010,0xffff,0x000a,0xe73f,0xce9f,0xdeff,0xe75f,0xe73f,0xe77f,0xe75f,0xd6bf,0xd6bf,0xef7f,
+    0x8012,0xffff,0x0008,0xe73f,0xd6bf,0xd69f,0xd69f,0xd6bf,0xd69f,0xd6df,0xef7f,0x8015,0xffff,0x0004,0xf79f,0xe73f,
+    0xef7f,0xf7bf,0x800c,0xffff
+};
+
+const uint16_t bmp231[839]   = // Bitmap 231 (RLE, 916 words raw)
 {
     0x0f3d, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xf7bf,0xef7f,0xe75f,0xe75f,0xef5f,0xef5f,0xef5f,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xef9f,0xe73f,0xd6bf,0xce7f,0xc63f,0xc61f,0xc61f,0xc61f,0xc61f,
-    0xffff,0xffff,0xffff,0xffff,0xf7df,0xef5f,0xd69f,0xc63f,0xce7f,0xdedf,0xdf1f,0xe71f,0xe71f,0xe71f,0xe71f,
-    0xffff,0xffff,0xffff,0xf7bf,0xe73f,0xce5f,0xc63f,0xdeff,0xef9f,0xf7df,0xf7bf,0xffdf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffdf,0xe75f,0xce5f,0xce7f,0xef7f,0xffff,0xffff,0xffdf,0xf7df,0xffdf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf79f,0xd69f,0xc63f,0xef7f,0xf7df,0xffdf,0xe73f,0xad7f,0x949f,0x949f,0x949f,0x94bf,0x94bf,
-    0xffff,0xf7df,0xe71f,0xc61f,0xdf1f,0xf7bf,0xf7bf,0xce9f,0x739f,0x4a5f,0x421f,0x423f,0x423f,0x423f,0x423f,
-    0xffff,0xef9f,0xce7f,0xce7f,0xf79f,0xf7df,0xdeff,0x6b5f,0x421f,0x423f,0x423f,0x423f,0x423f,0x423f,0x423f,
-    0xffdf,0xe73f,0xc61f,0xe71f,0xffdf,0xefbf,0x949f,0x421f,0x4a5f,0x423f,0x425f,0x421f,0x421f,0x423f,0x421f,
-    0xf7df,0xdedf,0xc61f,0xf79f,0xffff,0xdedf,0x5abf,0x423f,0x425f,0x425f,0x425f,0x423f,0x423f,0x425f,0x4a7f,
-    0xf79f,0xd69f,0xce5f,0xffdf,0xffff,0xb5df,0x421f,0x423f,0x425f,0x425f,0x4a5f,0x423f,0x6b7f,0xad9f,0xce9f,
-    0xf79f,0xce7f,0xce7f,0xffdf,0xffff,0x9cdf,0x39ff,0x423f,0x423f,0x423f,0x423f,0x7bbf,0xdf1f,0xffff,0xffff,
-    0xef9f,0xce5f,0xd69f,0xffdf,0xffff,0x949f,0x39df,0x421f,0x421f,0x423f,0x52bf,0xd69f,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd6bf,0xffff,0xffff,0x8c7f,0x39df,0x41ff,0x421f,0x423f,0x7bdf,0xf7bf,0xffff,0xffff,0xffff,
-    0xef7f,0xc63f,0xd69f,0xffff,0xffff,0x8c7f,0x31bf,0x421f,0x421f,0x423f,0x949f,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc63f,0xd69f,0xffff,0xffff,0x8c7f,0x31bf,0x421f,0x421f,0x423f,0x949f,0xffff,0xffff,0xffff,0xffff,
-    0xef7f,0xc65f,0xd6bf,0xffff,0xffff,0x8c7f,0x39df,0x41ff,0x421f,0x423f,0x7bdf,0xf7bf,0xffff,0xffff,0xffff,
-    0xef9f,0xce5f,0xd69f,0xffdf,0xffff,0x949f,0x39df,0x421f,0x421f,0x423f,0x52bf,0xd69f,0xffff,0xffff,0xffff,
-    0xf79f,0xce7f,0xce7f,0xffdf,0xffff,0x9cdf,0x39ff,0x423f,0x423f,0x423f,0x423f,0x7bbf,0xdf1f,0xffff,0xffff,
-    0xf79f,0xd69f,0xce5f,0xffdf,0xffff,0xb5df,0x421f,0x423f,0x425f,0x425f,0x4a5f,0x423f,0x6b7f,0xad9f,0xce9f,
-    0xf7df,0xdedf,0xc61f,0xf79f,0xffff,0xdedf,0x5abf,0x423f,0x425f,0x425f,0x425f,0x423f,0x423f,0x425f,0x4a7f,
-    0xffdf,0xe73f,0xc61f,0xe71f,0xffdf,0xefbf,0x949f,0x421f,0x4a5f,0x423f,0x425f,0x421f,0x421f,0x423f,0x421f,
-    0xffff,0xef9f,0xce7f,0xce7f,0xf79f,0xf7df,0xdeff,0x6b5f,0x421f,0x423f,0x423f,0x423f,0x423f,0x423f,0x423f,
-    0xffff,0xf7df,0xe71f,0xc61f,0xdf1f,0xf7bf,0xf7bf,0xce9f,0x739f,0x4a5f,0x421f,0x423f,0x423f,0x423f,0x423f,
-    0xffff,0xffff,0xf79f,0xd69f,0xc63f,0xef7f,0xf7df,0xffdf,0xe73f,0xad7f,0x949f,0x949f,0x949f,0x94bf,0x94bf,
-    0xffff,0xffff,0xffdf,0xe75f,0xce5f,0xce7f,0xef7f,0xffff,0xffff,0xffdf,0xf7df,0xffdf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xf7bf,0xe73f,0xce5f,0xc63f,0xdeff,0xef9f,0xf7df,0xf7bf,0xffdf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xf7df,0xef5f,0xd69f,0xc63f,0xce7f,0xdedf,0xdf1f,0xe71f,0xe71f,0xe71f,0xe71f,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xef9f,0xe73f,0xd6bf,0xce7f,0xc63f,0xc61f,0xc61f,0xc61f,0xc61f,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xf7bf,0xef7f,0xe75f,0xe75f,0xef5f,0xef5f,0xef5f
-};
-
-const uint16_t bmp232[916]   = // Bitmap 232
+    0x8007,0xffff,0x0005,0xf7df,0xf7bf,0xef7f,0xe75f,0xe75f,0x8003,0xef5f,0x8005,0xffff,0x0006,0xf7df,0xef9f,0xe73f,
+    0xd6bf,0xce7f,0xc63f,0x8004,0xc61f,0x8004,0xffff,0x0007,0xf7df,0xef5f,0xd69f,0xc63f,0xce7f,0xdedf,0xdf1f,0x8004,
+    0xe71f,0x8003,0xffff,0x0009,0xf7bf,0xe73f,0xce5f,0xc63f,0xdeff,0xef9f,0xf7df,0xf7bf,0xffdf,0x8005,0xffff,0x000a,
+    0xffdf,0xe75f,0xce5f,0xce7f,0xef7f,0xffff,0xffff,0xffdf,0xf7df,0xffdf,0x8005,0xffff,0x0008,0xf79f,0xd69f,0xc63f,
+    0xef7f,0xf7df,0xffdf,0xe73f,0xad7f,0x8003,0x949f,0x000d,0x94bf,0x94bf,0xffff,0xf7df,0xe71f,0xc61f,0xdf1f,0xf7bf,
+    0xf7bf,0xce9f,0x739f,0x4a5f,0x421f,0x8004,0x423f,0x0009,0xffff,0xef9f,0xce7f,0xce7f,0xf79f,0xf7df,0xdeff,0x6b5f,
+    0x421f,0x8006,0x423f,0x0017,0xffdf,0xe73f,0xc61f,0xe71f,0xffdf,0xefbf,0x949f,0x421f,0x4a5f,0x423f,0x425f,0x421f,
+    0x421f,0x423f,0x421f,0xf7df,0xdedf,0xc61f,0xf79f,0xffff,0xdedf,0x5abf,0x423f,0x8003,0x425f,0x001a,0x423f,0x423f,
+    0x425f,0x4a7f,0xf79f,0xd69f,0xce5f,0xffdf,0xffff,0xb5df,0x421f,0x423f,0x425f,0x425f,0x4a5f,0x423f,0x6b7f,0xad9f,
+    0xce9f,0xf79f,0xce7f,0xce7f,0xffdf,0xffff,0x9cdf,0x39ff,0x8004,0x423f,0x0010,0x7bbf,0xdf1f,0xffff,0xffff,0xef9f,
+    0xce5f,0xd69f,0xffdf,0xffff,0x949f,0x39df,0x421f,0x421f,0x423f,0x52bf,0xd69f,0x8003,0xffff,0x000c,0xef7f,0xc65f,
+    0xd6bf,0xffff,0xffff,0x8c7f,0x39df,0x41ff,0x421f,0x423f,0x7bdf,0xf7bf,0x8003,0xffff,0x000b,0xef7f,0xc63f,0xd69f,
+    0xffff,0xffff,0x8c7f,0x31bf,0x421f,0x421f,0x423f,0x949f,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,
+    0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,
+    0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,
+    0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,
+    0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,
+    0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,
+    0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,
+    0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,
+    0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,
+    0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,
+    0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,
+    0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,
+    0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,
+    0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,
+    0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,
+    0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,
+    0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,
+    0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,
+    0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,
+    0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,
+    0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,
+    0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,
+    0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,
+    0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,
+    0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,
+    0x8004,0xffff,0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,
+    0x000b,0xef7f,0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,
+    0xc65f,0xd69f,0xffff,0xffff,0x8c7f,0x31df,0x39ff,0x421f,0x423f,0x94bf,0x8004,0xffff,0x000b,0xef7f,0xc63f,0xd69f,
+    0xffff,0xffff,0x8c7f,0x31bf,0x421f,0x421f,0x423f,0x949f,0x8004,0xffff,0x000c,0xef7f,0xc65f,0xd6bf,0xffff,0xffff,
+    0x8c7f,0x39df,0x41ff,0x421f,0x423f,0x7bdf,0xf7bf,0x8003,0xffff,0x000c,0xef9f,0xce5f,0xd69f,0xffdf,0xffff,0x949f,
+    0x39df,0x421f,0x421f,0x423f,0x52bf,0xd69f,0x8003,0xffff,0x0007,0xf79f,0xce7f,0xce7f,0xffdf,0xffff,0x9cdf,0x39ff,
+    0x8004,0x423f,0x001b,0x7bbf,0xdf1f,0xffff,0xffff,0xf79f,0xd69f,0xce5f,0xffdf,0xffff,0xb5df,0x421f,0x423f,0x425f,
+    0x425f,0x4a5f,0x423f,0x6b7f,0xad9f,0xce9f,0xf7df,0xdedf,0xc61f,0xf79f,0xffff,0xdedf,0x5abf,0x423f,0x8003,0x425f,
+    0x001c,0x423f,0x423f,0x425f,0x4a7f,0xffdf,0xe73f,0xc61f,0xe71f,0xffdf,0xefbf,0x949f,0x421f,0x4a5f,0x423f,0x425f,
+    0x421f,0x421f,0x423f,0x421f,0xffff,0xef9f,0xce7f,0xce7f,0xf79f,0xf7df,0xdeff,0x6b5f,0x421f,0x8006,0x423f,0x000b,
+    0xffff,0xf7df,0xe71f,0xc61f,0xdf1f,0xf7bf,0xf7bf,0xce9f,0x739f,0x4a5f,0x421f,0x8004,0x423f,0x000a,0xffff,0xffff,
+    0xf79f,0xd69f,0xc63f,0xef7f,0xf7df,0xffdf,0xe73f,0xad7f,0x8003,0x949f,0x000e,0x94bf,0x94bf,0xffff,0xffff,0xffdf,
+    0xe75f,0xce5f,0xce7f,0xef7f,0xffff,0xffff,0xffdf,0xf7df,0xffdf,0x8006,0xffff,0x0009,0xf7bf,0xe73f,0xce5f,0xc63f,
+    0xdeff,0xef9f,0xf7df,0xf7bf,0xffdf,0x8007,0xffff,0x0007,0xf7df,0xef5f,0xd69f,0xc63f,0xce7f,0xdedf,0xdf1f,0x8004,
+    0xe71f,0x8005,0xffff,0x0006,0xf7df,0xef9f,0xe73f,0xd6bf,0xce7f,0xc63f,0x8004,0xc61f,0x8007,0xffff,0x0005,0xf7df,
+    0xf7bf,0xef7f,0xe75f,0xe75f,0x8003,0xef5f
+};
+
+const uint16_t bmp232[839]   = // Bitmap 232 (RLE, 916 words raw)
 {
     0x0f3d, // Width and height
-    0xef5f,0xef5f,0xef5f,0xe75f,0xe75f,0xef7f,0xf7bf,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xc61f,0xc61f,0xc61f,0xc61f,0xc63f,0xce7f,0xd6bf,0xe73f,0xef9f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xe71f,0xe71f,0xe71f,0xe71f,0xdf1f,0xdedf,0xce7f,0xc63f,0xd69f,0xef5f,0xf7df,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffdf,0xf7bf,0xf7df,0xef9f,0xdeff,0xc63f,0xce5f,0xe73f,0xf7bf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffdf,0xf7df,0xffdf,0xffff,0xffff,0xef7f,0xce7f,0xce5f,0xe75f,0xffdf,0xffff,0xffff,
-    0x94bf,0x94bf,0x949f,0x949f,0x949f,0xad7f,0xe73f,0xffdf,0xf7df,0xef7f,0xc63f,0xd69f,0xf79f,0xffff,0xffff,
-    0x423f,0x423f,0x423f,0x423f,0x421f,0x4a5f,0x739f,0xce9f,0xf7bf,0xf7bf,0xdf1f,0xc61f,0xe71f,0xf7df,0xffff,
-    0x423f,0x423f,0x423f,0x423f,0x423f,0x423f,0x421f,0x6b5f,0xdeff,0xf7df,0xf79f,0xce7f,0xce7f,0xef9f,0xffff,
-    0x421f,0x423f,0x421f,0x421f,0x425f,0x423f,0x4a5f,0x421f,0x949f,0xefbf,0xffdf,0xe71f,0xc61f,0xe73f,0xffdf,
-    0x4a7f,0x425f,0x423f,0x423f,0x425f,0x425f,0x425f,0x423f,0x5abf,0xdedf,0xffff,0xf79f,0xc61f,0xdedf,0xf7df,
-    0xce9f,0xad9f,0x6b7f,0x423f,0x4a5f,0x425f,0x425f,0x423f,0x421f,0xb5df,0xffff,0xffdf,0xce5f,0xd69f,0xf79f,
-    0xffff,0xffff,0xdf1f,0x7bbf,0x423f,0x423f,0x423f,0x423f,0x39ff,0x9cdf,0xffff,0xffdf,0xce7f,0xce7f,0xf79f,
-    0xffff,0xffff,0xffff,0xd69f,0x52bf,0x423f,0x421f,0x421f,0x39df,0x949f,0xffff,0xffdf,0xd69f,0xce5f,0xef9f,
-    0xffff,0xffff,0xffff,0xf7bf,0x7bdf,0x423f,0x421f,0x41ff,0x39df,0x8c7f,0xffff,0xffff,0xd6bf,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x949f,0x423f,0x421f,0x421f,0x31bf,0x8c7f,0xffff,0xffff,0xd69f,0xc63f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xffff,0x949f,0x423f,0x421f,0x421f,0x31bf,0x8c7f,0xffff,0xffff,0xd69f,0xc63f,0xef7f,
-    0xffff,0xffff,0xffff,0xf7bf,0x7bdf,0x423f,0x421f,0x41ff,0x39df,0x8c7f,0xffff,0xffff,0xd6bf,0xc65f,0xef7f,
-    0xffff,0xffff,0xffff,0xd69f,0x52bf,0x423f,0x421f,0x421f,0x39df,0x949f,0xffff,0xffdf,0xd69f,0xce5f,0xef9f,
-    0xffff,0xffff,0xdf1f,0x7bbf,0x423f,0x423f,0x423f,0x423f,0x39ff,0x9cdf,0xffff,0xffdf,0xce7f,0xce7f,0xf79f,
-    0xce9f,0xad9f,0x6b7f,0x423f,0x4a5f,0x425f,0x425f,0x423f,0x421f,0xb5df,0xffff,0xffdf,0xce5f,0xd69f,0xf79f,
-    0x4a7f,0x425f,0x423f,0x423f,0x425f,0x425f,0x425f,0x423f,0x5abf,0xdedf,0xffff,0xf79f,0xc61f,0xdedf,0xf7df,
-    0x421f,0x423f,0x421f,0x421f,0x425f,0x423f,0x4a5f,0x421f,0x949f,0xefbf,0xffdf,0xe71f,0xc61f,0xe73f,0xffdf,
-    0x423f,0x423f,0x423f,0x423f,0x423f,0x423f,0x421f,0x6b5f,0xdeff,0xf7df,0xf79f,0xce7f,0xce7f,0xef9f,0xffff,
-    0x423f,0x423f,0x423f,0x423f,0x421f,0x4a5f,0x739f,0xce9f,0xf7bf,0xf7bf,0xdf1f,0xc61f,0xe71f,0xf7df,0xffff,
-    0x94bf,0x94bf,0x949f,0x949f,0x949f,0xad7f,0xe73f,0xffdf,0xf7df,0xef7f,0xc63f,0xd69f,0xf79f,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffdf,0xf7df,0xffdf,0xffff,0xffff,0xef7f,0xce7f,0xce5f,0xe75f,0xffdf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffdf,0xf7bf,0xf7df,0xef9f,0xdeff,0xc63f,0xce5f,0xe73f,0xf7bf,0xffff,0xffff,0xffff,
-    0xe71f,0xe71f,0xe71f,0xe71f,0xdf1f,0xdedf,0xce7f,0xc63f,0xd69f,0xef5f,0xf7df,0xffff,0xffff,0xffff,0xffff,
-    0xc61f,0xc61f,0xc61f,0xc61f,0xc63f,0xce7f,0xd6bf,0xe73f,0xef9f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xef5f,0xef5f,0xef5f,0xe75f,0xe75f,0xef7f,0xf7bf,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp233[1518]   = // Bitmap 233
+    0x8003,0xef5f,0x0005,0xe75f,0xe75f,0xef7f,0xf7bf,0xf7df,0x8007,0xffff,0x8004,0xc61f,0x0006,0xc63f,0xce7f,0xd6bf,
+    0xe73f,0xef9f,0xf7df,0x8005,0xffff,0x8004,0xe71f,0x0007,0xdf1f,0xdedf,0xce7f,0xc63f,0xd69f,0xef5f,0xf7df,0x8007,
+    0xffff,0x0009,0xffdf,0xf7bf,0xf7df,0xef9f,0xdeff,0xc63f,0xce5f,0xe73f,0xf7bf,0x8006,0xffff,0x000e,0xffdf,0xf7df,
+    0xffdf,0xffff,0xffff,0xef7f,0xce7f,0xce5f,0xe75f,0xffdf,0xffff,0xffff,0x94bf,0x94bf,0x8003,0x949f,0x000a,0xad7f,
+    0xe73f,0xffdf,0xf7df,0xef7f,0xc63f,0xd69f,0xf79f,0xffff,0xffff,0x8004,0x423f,0x000b,0x421f,0x4a5f,0x739f,0xce9f,
+    0xf7bf,0xf7bf,0xdf1f,0xc61f,0xe71f,0xf7df,0xffff,0x8006,0x423f,0x001c,0x421f,0x6b5f,0xdeff,0xf7df,0xf79f,0xce7f,
+    0xce7f,0xef9f,0xffff,0x421f,0x423f,0x421f,0x421f,0x425f,0x423f,0x4a5f,0x421f,0x949f,0xefbf,0xffdf,0xe71f,0xc61f,
+    0xe73f,0xffdf,0x4a7f,0x425f,0x423f,0x423f,0x8003,0x425f,0x001b,0x423f,0x5abf,0xdedf,0xffff,0xf79f,0xc61f,0xdedf,
+    0xf7df,0xce9f,0xad9f,0x6b7f,0x423f,0x4a5f,0x425f,0x425f,0x423f,0x421f,0xb5df,0xffff,0xffdf,0xce5f,0xd69f,0xf79f,
+    0xffff,0xffff,0xdf1f,0x7bbf,0x8004,0x423f,0x0007,0x39ff,0x9cdf,0xffff,0xffdf,0xce7f,0xce7f,0xf79f,0x8003,0xffff,
+    0x000c,0xd69f,0x52bf,0x423f,0x421f,0x421f,0x39df,0x949f,0xffff,0xffdf,0xd69f,0xce5f,0xef9f,0x8003,0xffff,0x000c,
+    0xf7bf,0x7bdf,0x423f,0x421f,0x41ff,0x39df,0x8c7f,0xffff,0xffff,0xd6bf,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x949f,
+    0x423f,0x421f,0x421f,0x31bf,0x8c7f,0xffff,0xffff,0xd69f,0xc63f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,
+    0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,
+    0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,
+    0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,
+    0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
+    0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,
+    0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,
+    0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,
+    0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,
+    0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,
+    0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,
+    0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
+    0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,
+    0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,
+    0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,
+    0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,
+    0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,
+    0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,
+    0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
+    0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,
+    0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,
+    0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,
+    0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,
+    0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,
+    0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,
+    0xc65f,0xef7f,0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,
+    0x8004,0xffff,0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,
+    0x000b,0x94bf,0x423f,0x421f,0x39ff,0x31df,0x8c7f,0xffff,0xffff,0xd69f,0xc65f,0xef7f,0x8004,0xffff,0x000b,0x949f,
+    0x423f,0x421f,0x421f,0x31bf,0x8c7f,0xffff,0xffff,0xd69f,0xc63f,0xef7f,0x8003,0xffff,0x000c,0xf7bf,0x7bdf,0x423f,
+    0x421f,0x41ff,0x39df,0x8c7f,0xffff,0xffff,0xd6bf,0xc65f,0xef7f,0x8003,0xffff,0x0010,0xd69f,0x52bf,0x423f,0x421f,
+    0x421f,0x39df,0x949f,0xffff,0xffdf,0xd69f,0xce5f,0xef9f,0xffff,0xffff,0xdf1f,0x7bbf,0x8004,0x423f,0x001a,0x39ff,
+    0x9cdf,0xffff,0xffdf,0xce7f,0xce7f,0xf79f,0xce9f,0xad9f,0x6b7f,0x423f,0x4a5f,0x425f,0x425f,0x423f,0x421f,0xb5df,
+    0xffff,0xffdf,0xce5f,0xd69f,0xf79f,0x4a7f,0x425f,0x423f,0x423f,0x8003,0x425f,0x0017,0x423f,0x5abf,0xdedf,0xffff,
+    0xf79f,0xc61f,0xdedf,0xf7df,0x421f,0x423f,0x421f,0x421f,0x425f,0x423f,0x4a5f,0x421f,0x949f,0xefbf,0xffdf,0xe71f,
+    0xc61f,0xe73f,0xffdf,0x8006,0x423f,0x0009,0x421f,0x6b5f,0xdeff,0xf7df,0xf79f,0xce7f,0xce7f,0xef9f,0xffff,0x8004,
+    0x423f,0x000d,0x421f,0x4a5f,0x739f,0xce9f,0xf7bf,0xf7bf,0xdf1f,0xc61f,0xe71f,0xf7df,0xffff,0x94bf,0x94bf,0x8003,
+    0x949f,0x0008,0xad7f,0xe73f,0xffdf,0xf7df,0xef7f,0xc63f,0xd69f,0xf79f,0x8005,0xffff,0x000a,0xffdf,0xf7df,0xffdf,
+    0xffff,0xffff,0xef7f,0xce7f,0xce5f,0xe75f,0xffdf,0x8005,0xffff,0x0009,0xffdf,0xf7bf,0xf7df,0xef9f,0xdeff,0xc63f,
+    0xce5f,0xe73f,0xf7bf,0x8003,0xffff,0x8004,0xe71f,0x0007,0xdf1f,0xdedf,0xce7f,0xc63f,0xd69f,0xef5f,0xf7df,0x8004,
+    0xffff,0x8004,0xc61f,0x0006,0xc63f,0xce7f,0xd6bf,0xe73f,0xef9f,0xf7df,0x8005,0xffff,0x8003,0xef5f,0x0005,0xe75f,
+    0xe75f,0xef7f,0xf7bf,0xf7df,0x8007,0xffff
+};
+
+const uint16_t bmp233[1087]   = // Bitmap 233 (RLE, 1518 words raw)
 {
     0x2925, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xf7bf,0xffdf,
-    0xf7bf,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xef7f,0xdeff,0xd69f,0xd6bf,0xe71f,0xef7f,0xe71f,0xd69f,0xce9f,0xdeff,
-    0xf79f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef7f,
-    0xd6bf,0xce5f,0xce7f,0xdeff,0xef7f,0xd6bf,0xbdff,0xdedf,0xef7f,0xdedf,0xce7f,0xce5f,0xd6df,0xef9f,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe71f,0xc63f,0xd6bf,0xf79f,0xffff,0xffdf,
-    0xffff,0xdedf,0xa51f,0xe73f,0xffff,0xffff,0xffff,0xef9f,0xd69f,0xce5f,0xe73f,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xef9f,0xd6bf,0xef5f,0xffff,0xe73f,0xa51f,0x7bdf,0xdedf,0xffff,0xf79f,0xffff,
-    0xce7f,0x7bdf,0xad7f,0xef5f,0xffff,0xef5f,0xdedf,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79f,
-    0xdeff,0xce5f,0xf79f,0xef7f,0x6b7f,0x31df,0x39df,0x6b7f,0xce5f,0xe71f,0xbdff,0x631f,0x39ff,0x39df,0x7bbf,
-    0xf7bf,0xef9f,0xce5f,0xe71f,0xf79f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdf1f,0xd6df,0xce5f,0x9cff,0xdedf,0xf7df,
-    0x6b5f,0x39ff,0x425f,0x421f,0x4a5f,0x529f,0x423f,0x423f,0x4a7f,0x39ff,0x7bdf,0xffff,0xce7f,0xa4ff,0xce9f,
-    0xdedf,0xe73f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xef7f,0xc63f,0xe75f,0xf79f,0xd6bf,0xf7bf,0xef7f,0x631f,0x421f,0x423f,0x421f,
-    0x3a1f,0x3a1f,0x3a1f,0x421f,0x4a5f,0x421f,0x635f,0xf7df,0xf79f,0xdedf,0xf7df,0xe75f,0xc65f,0xf79f,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xd69f,0xd6bf,0xf7df,0xef7f,0xf7bf,0xef5f,0x843f,0x421f,0x39ff,0x4a5f,0x7bff,0xa55f,0xb5bf,0xa53f,0x7bbf,
-    0x4a3f,0x39ff,0x421f,0x9cbf,0xf79f,0xf7bf,0xf77f,0xffdf,0xce7f,0xdedf,0xf7bf,0xef5f,0xdeff,0xd6bf,0xd6df,
-    0xdf1f,0xef7f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef7f,0xce3f,0xf7bf,0xe71f,0x631f,
-    0x6b5f,0x5adf,0x39ff,0x39ff,0x6b7f,0xce7f,0xffff,0xffff,0xffff,0xffff,0xffff,0xc63f,0x5b1f,0x39ff,0x41ff,
-    0x631f,0x633f,0x739f,0xef7f,0xef7f,0xb5bf,0xc63f,0xc65f,0xce7f,0xdedf,0xd6bf,0xce5f,0xc63f,0xd69f,0xef5f,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdeff,0xce7f,0xffff,0x9d1f,0x319f,0x421f,0x421f,0x39ff,0x6b7f,
-    0xef7f,0xffff,0xdedf,0xc63f,0xc63f,0xc65f,0xe73f,0xffff,0xdeff,0x631f,0x39ff,0x421f,0x3a1f,0x39df,0xad7f,
-    0xffff,0xce7f,0xdeff,0xffdf,0xffff,0xf7bf,0xf7bf,0xffff,0xf79f,0xd6df,0xce5f,0xdedf,0xf7df,0xffff,0xffff,
-    0xffff,0xffff,0xce9f,0xdeff,0xffdf,0x6b7f,0x297f,0x423f,0x421f,0x423f,0xce9f,0xffff,0xce5f,0xc61f,0xdeff,
-    0xe71f,0xdedf,0xc61f,0xd69f,0xffff,0xc61f,0x39ff,0x421f,0x425f,0x319f,0x7bdf,0xffff,0xffff,0xf7bf,0xbe1f,
-    0xc61f,0xffff,0xf7bf,0xb5bf,0xd69f,0xf7bf,0xef5f,0xce5f,0xd6df,0xffff,0xffff,0xffff,0xf79f,0xd6bf,0xe77f,
-    0xffff,0xd69f,0x631f,0x39ff,0x39df,0x7bdf,0xffdf,0xdeff,0xc61f,0xf7bf,0xffff,0xffff,0xffff,0xef7f,0xbe1f,
-    0xe73f,0xffbf,0x631f,0x31df,0x3a1f,0x6b9f,0xd6df,0xf7bf,0xffff,0xce7f,0x39ff,0x4a5f,0x94bf,0x841f,0x31df,
-    0x633f,0xef5f,0xf7bf,0xef7f,0xc65f,0xe73f,0xffff,0xffff,0xf7bf,0xe73f,0xce9f,0xd6df,0xffff,0xc63f,0x421f,
-    0x31bf,0xa51f,0xffff,0xc63f,0xdeff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd6bf,0xce7f,0xffff,0x8c5f,0x319f,
-    0x4a7f,0xd6df,0xffff,0xffdf,0xffff,0xad7f,0x319f,0x39ff,0x4a5f,0x4a3f,0x31bf,0x4a5f,0xd6df,0xffff,0xf7bf,
-    0xdeff,0xce7f,0xf7bf,0xffff,0xffdf,0xef7f,0xbdff,0xa51f,0xef5f,0xe71f,0x4a7f,0x31bf,0xad7f,0xffff,0xc63f,
-    0xe71f,0xffff,0xffff,0xffff,0xffff,0xffff,0xdeff,0xce7f,0xffff,0x9cbf,0x295f,0x5aff,0xf79f,0xffdf,0xa53f,
-    0x7bdf,0x425f,0x631f,0xc61f,0xef5f,0xe73f,0xa53f,0x421f,0x5aff,0x843f,0xc65f,0xf7bf,0xc65f,0xe73f,0xffff,
-    0xf7bf,0xe71f,0xd6bf,0xe71f,0xffff,0xb5df,0x39ff,0x31bf,0x9cdf,0xffff,0xce3f,0xd6df,0xffff,0xffff,0xffff,
-    0xffdf,0xffff,0xd69f,0xd69f,0xffff,0x841f,0x297f,0x423f,0xd67f,0xf7bf,0x423f,0x213f,0x52df,0xe71f,0xffff,
-    0xdf1f,0xef5f,0xffff,0xb5bf,0x39ff,0x295f,0x7bff,0xf7bf,0xd69f,0xd69f,0xffff,0xf79f,0xd69f,0xef5f,0xffff,
-    0xbdff,0x4a7f,0x39df,0x31bf,0x6b5f,0xf7df,0xe71f,0xbe1f,0xef7f,0xffff,0xffff,0xffff,0xe75f,0xbdff,0xef5f,
-    0xf7bf,0x52df,0x31bf,0x31df,0x5aff,0xc65f,0x9cff,0x297f,0x9cff,0xffff,0xce5f,0xb5bf,0xb5bf,0xdeff,0xf7bf,
-    0x633f,0x423f,0xc61f,0xf7bf,0xdf1f,0xce5f,0xffff,0xffff,0xd69f,0xd6df,0xffdf,0x6b5f,0x215f,0x3a1f,0x39ff,
-    0x39bf,0xbdff,0xffff,0xce9f,0xc61f,0xd6bf,0xdeff,0xd69f,0xc5ff,0xd6bf,0xffff,0xad9f,0x319f,0x39ff,0x3a1f,
-    0x215f,0x841f,0xe75f,0x31bf,0xad7f,0xffff,0xb5bf,0xce7f,0xbdff,0xc63f,0xffff,0x739f,0x631f,0xffff,0xf79f,
-    0xe73f,0xce7f,0xf7df,0xffff,0xdf1f,0xce5f,0xffff,0xa53f,0x213f,0x319f,0x31bf,0x297f,0x4a7f,0xdedf,0xffff,
-    0xe73f,0xce7f,0xc65f,0xce7f,0xef5f,0xffff,0xce5f,0x4a5f,0x299f,0x319f,0x297f,0x319f,0xb59f,0x949f,0x213f,
-    0x949f,0xffff,0xce9f,0xb59f,0xb5bf,0xe73f,0xf79f,0x5aff,0x39ff,0xad7f,0xf7bf,0xdeff,0xce7f,0xffff,0xffff,
-    0xf79f,0xc63f,0xef7f,0xe73f,0x6b7f,0x73bf,0x5aff,0x31bf,0x297f,0x4a7f,0xb5bf,0xefbf,0xffff,0xffff,0xffff,
-    0xef9f,0xad5f,0x421f,0x297f,0x39df,0x633f,0x6b7f,0x7bff,0xdf1f,0x423f,0x18df,0x421f,0xd69f,0xffff,0xef9f,
-    0xf7df,0xffff,0xa51f,0x295f,0x18ff,0x7bdf,0xf7df,0xce9f,0xd6bf,0xffff,0xffff,0xffff,0xd6df,0xd67f,0xf7bf,
-    0xf7bf,0xffff,0xf7bf,0x949f,0x31bf,0x297f,0x317f,0x5adf,0x83ff,0x8c5f,0x7bdf,0x52bf,0x317f,0x297f,0x31bf,
-    0xa53f,0xffff,0xffff,0xf7bf,0xf7bf,0xbdff,0x9d1f,0x529f,0x423f,0xa53f,0xce9f,0xce7f,0x845f,0x31bf,0x6b5f,
-    0x9cff,0xd69f,0xef9f,0xc65f,0xe75f,0xffff,0xffff,0xffff,0xef9f,0xce5f,0xe71f,0xe75f,0xce5f,0xef7f,0xf79f,
-    0x52bf,0x297f,0x319f,0x295f,0x211f,0x18ff,0x211f,0x297f,0x31bf,0x215f,0x631f,0xffff,0xdeff,0xa55f,0xe77f,
-    0xffff,0xce7f,0xbe1f,0xa55f,0x215f,0x211f,0x319f,0x297f,0x18ff,0x39ff,0xdf1f,0xffff,0xf7bf,0xd6df,0xce7f,
-    0xf7bf,0xffff,0xffff,0xffff,0xffff,0xe73f,0xdedf,0xc65f,0x9cff,0xd6df,0xf7bf,0x52bf,0x213f,0x31bf,0x319f,
-    0x421f,0x529f,0x39df,0x297f,0x39df,0x211f,0x5aff,0xffff,0x73df,0x213f,0x633f,0x8c7f,0x421f,0x295f,0x845f,
-    0x425f,0x421f,0xa55f,0x8c7f,0x297f,0x62ff,0xef5f,0xef9f,0xdf3f,0xc65f,0xef5f,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf7bf,0xe73f,0xce9f,0xf7bf,0xef7f,0x6b3f,0x211f,0x191f,0x6b7f,0xdedf,0xf7bf,0xd69f,0x5aff,
-    0x211f,0x215f,0x7bff,0xef7f,0x52bf,0x211f,0x39df,0x421f,0x319f,0x18ff,0x8c5f,0xdeff,0xd6bf,0xffff,0xffdf,
-    0xc63f,0xdf1f,0xf79f,0xdf1f,0xc65f,0xdeff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79f,
-    0xd6bf,0xe6ff,0xf7bf,0xef7f,0xad7f,0x7bdf,0xdeff,0xf7ff,0xdeff,0xffff,0xce7f,0x7c1f,0x94df,0x7bdf,0x5adf,
-    0x297f,0x8c7f,0xdf1f,0xef5f,0xce7f,0x6b7f,0x297f,0x635f,0x8c7f,0xef7f,0xf7bf,0xf7df,0xe75f,0xce7f,0xc65f,
-    0xe71f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe73f,0xce5f,0xce7f,0xe73f,
-    0xf7df,0xffdf,0xffdf,0xd69f,0x9cff,0xd6ff,0xf7df,0xffff,0x9d1f,0x18ff,0x20ff,0x94bf,0xffff,0xef7f,0xd6ff,
-    0xf7bf,0xf7bf,0x631f,0x089f,0x215f,0xce9f,0xf7df,0xbdff,0xbe1f,0xdedf,0xef9f,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xdeff,0xce5f,0xc63f,0xd69f,0xe73f,0xd6bf,
-    0xc63f,0xce7f,0xef9f,0xf7bf,0xd6df,0x4a7f,0x39df,0xe73f,0xef5f,0xb5df,0xb5bf,0xbdff,0xffff,0xb5bf,0x18ff,
-    0x73df,0xef9f,0xefbf,0xc61f,0xdeff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0xe73f,0xd6bf,0xd6bf,0xe75f,0xef9f,0xc63f,0xdedf,0xef9f,
-    0xffff,0x7bff,0x421f,0xef9f,0xd6df,0xb5df,0xd6bf,0xb59f,0xf7bf,0xc65f,0x213f,0xb5df,0xffff,0xef9f,0xcebf,
-    0xdf1f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd6bf,0xd6bf,0xf7df,0xc63f,0x39ff,0x319f,0xd6df,
-    0xef9f,0xbddf,0xad9f,0xc63f,0xffff,0xa53f,0x10bf,0x5aff,0xe73f,0xef9f,0xce5f,0xe73f,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xe71f,0xc65f,0xffff,0x9cdf,0x089f,0x109f,0x73df,0xffff,0xffff,0xef9f,0xffff,
-    0xe71f,0x4a5f,0x085f,0x211f,0xce7f,0xef7f,0xc63f,0xf79f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xef9f,0xc63f,0xe75f,0xdf1f,0x9cff,0x73bf,0x213f,0x6b7f,0xbdff,0xce7f,0xad5f,0x4a5f,0x31bf,0x845f,0xa53f,
-    0xf79f,0xd6df,0xce9f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd6bf,0xce9f,0xf7bf,
-    0xffff,0xf7bf,0x4a7f,0x085f,0x18ff,0x211f,0x109f,0x085f,0x8c7f,0xffff,0xf7df,0xef7f,0xc63f,0xe73f,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79f,0xc65f,0xdeff,0xef9f,0xf79f,0x73df,0x18ff,
-    0x73bf,0xad5f,0x4a5f,0x18ff,0xad7f,0xffdf,0xef7f,0xce9f,0xd69f,0xf7bf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xe73f,0xc65f,0xd6df,0xef9f,0xef7f,0xc63f,0xef9f,0xffff,0xd6df,0xc65f,
-    0xef9f,0xef9f,0xce9f,0xce7f,0xef9f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xe73f,0xce7f,0xc65f,0xdf1f,0xef9f,0xef9f,0xef7f,0xf79f,0xef7f,0xd6bf,0xc63f,0xd69f,0xf79f,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,
-    0xdeff,0xce7f,0xc63f,0xce7f,0xd69f,0xce5f,0xce3f,0xd69f,0xe73f,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xef7f,0xe71f,
-    0xdf1f,0xe73f,0xf79f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff
-};
-
-const uint16_t bmp234[1025]   = // Bitmap 234
+    0x800c,0xffff,0x0005,0xf7bf,0xf7bf,0xffdf,0xf7bf,0xf7bf,0x8021,0xffff,0x000b,0xef7f,0xdeff,0xd69f,0xd6bf,0xe71f,
+    0xef7f,0xe71f,0xd69f,0xce9f,0xdeff,0xf79f,0x801c,0xffff,0x000f,0xef7f,0xd6bf,0xce5f,0xce7f,0xdeff,0xef7f,0xd6bf,
+    0xbdff,0xdedf,0xef7f,0xdedf,0xce7f,0xce5f,0xd6df,0xef9f,0x8019,0xffff,0x000a,0xe71f,0xc63f,0xd6bf,0xf79f,0xffff,
+    0xffdf,0xffff,0xdedf,0xa51f,0xe73f,0x8003,0xffff,0x0004,0xef9f,0xd69f,0xce5f,0xe73f,0x8017,0xffff,0x0013,0xef9f,
+    0xd6bf,0xef5f,0xffff,0xe73f,0xa51f,0x7bdf,0xdedf,0xffff,0xf79f,0xffff,0xce7f,0x7bdf,0xad7f,0xef5f,0xffff,0xef5f,
+    0xdedf,0xf7bf,0x8015,0xffff,0x0015,0xf79f,0xdeff,0xce5f,0xf79f,0xef7f,0x6b7f,0x31df,0x39df,0x6b7f,0xce5f,0xe71f,
+    0xbdff,0x631f,0x39ff,0x39df,0x7bbf,0xf7bf,0xef9f,0xce5f,0xe71f,0xf79f,0x8013,0xffff,0x0017,0xdf1f,0xd6df,0xce5f,
+    0x9cff,0xdedf,0xf7df,0x6b5f,0x39ff,0x425f,0x421f,0x4a5f,0x529f,0x423f,0x423f,0x4a7f,0x39ff,0x7bdf,0xffff,0xce7f,
+    0xa4ff,0xce9f,0xdedf,0xe73f,0x8011,0xffff,0x000b,0xef7f,0xc63f,0xe75f,0xf79f,0xd6bf,0xf7bf,0xef7f,0x631f,0x421f,
+    0x423f,0x421f,0x8003,0x3a1f,0x000b,0x421f,0x4a5f,0x421f,0x635f,0xf7df,0xf79f,0xdedf,0xf7df,0xe75f,0xc65f,0xf79f,
+    0x8010,0xffff,0x0021,0xd69f,0xd6bf,0xf7df,0xef7f,0xf7bf,0xef5f,0x843f,0x421f,0x39ff,0x4a5f,0x7bff,0xa55f,0xb5bf,
+    0xa53f,0x7bbf,0x4a3f,0x39ff,0x421f,0x9cbf,0xf79f,0xf7bf,0xf77f,0xffdf,0xce7f,0xdedf,0xf7bf,0xef5f,0xdeff,0xd6bf,
+    0xd6df,0xdf1f,0xef7f,0xf7df,0x8007,0xffff,0x000b,0xef7f,0xce3f,0xf7bf,0xe71f,0x631f,0x6b5f,0x5adf,0x39ff,0x39ff,
+    0x6b7f,0xce7f,0x8005,0xffff,0x0013,0xc63f,0x5b1f,0x39ff,0x41ff,0x631f,0x633f,0x739f,0xef7f,0xef7f,0xb5bf,0xc63f,
+    0xc65f,0xce7f,0xdedf,0xd6bf,0xce5f,0xc63f,0xd69f,0xef5f,0x8006,0xffff,0x0025,0xdeff,0xce7f,0xffff,0x9d1f,0x319f,
+    0x421f,0x421f,0x39ff,0x6b7f,0xef7f,0xffff,0xdedf,0xc63f,0xc63f,0xc65f,0xe73f,0xffff,0xdeff,0x631f,0x39ff,0x421f,
+    0x3a1f,0x39df,0xad7f,0xffff,0xce7f,0xdeff,0xffdf,0xffff,0xf7bf,0xf7bf,0xffff,0xf79f,0xd6df,0xce5f,0xdedf,0xf7df,
+    0x8004,0xffff,0x0025,0xce9f,0xdeff,0xffdf,0x6b7f,0x297f,0x423f,0x421f,0x423f,0xce9f,0xffff,0xce5f,0xc61f,0xdeff,
+    0xe71f,0xdedf,0xc61f,0xd69f,0xffff,0xc61f,0x39ff,0x421f,0x425f,0x319f,0x7bdf,0xffff,0xffff,0xf7bf,0xbe1f,0xc61f,
+    0xffff,0xf7bf,0xb5bf,0xd69f,0xf7bf,0xef5f,0xce5f,0xd6df,0x8003,0xffff,0x000d,0xf79f,0xd6bf,0xe77f,0xffff,0xd69f,
+    0x631f,0x39ff,0x39df,0x7bdf,0xffdf,0xdeff,0xc61f,0xf7bf,0x8003,0xffff,0x0025,0xef7f,0xbe1f,0xe73f,0xffbf,0x631f,
+    0x31df,0x3a1f,0x6b9f,0xd6df,0xf7bf,0xffff,0xce7f,0x39ff,0x4a5f,0x94bf,0x841f,0x31df,0x633f,0xef5f,0xf7bf,0xef7f,
+    0xc65f,0xe73f,0xffff,0xffff,0xf7bf,0xe73f,0xce9f,0xd6df,0xffff,0xc63f,0x421f,0x31bf,0xa51f,0xffff,0xc63f,0xdeff,
+    0x8005,0xffff,0x0024,0xd6bf,0xce7f,0xffff,0x8c5f,0x319f,0x4a7f,0xd6df,0xffff,0xffdf,0xffff,0xad7f,0x319f,0x39ff,
+    0x4a5f,0x4a3f,0x31bf,0x4a5f,0xd6df,0xffff,0xf7bf,0xdeff,0xce7f,0xf7bf,0xffff,0xffdf,0xef7f,0xbdff,0xa51f,0xef5f,
+    0xe71f,0x4a7f,0x31bf,0xad7f,0xffff,0xc63f,0xe71f,0x8005,0xffff,0x0024,0xdeff,0xce7f,0xffff,0x9cbf,0x295f,0x5aff,
+    0xf79f,0xffdf,0xa53f,0x7bdf,0x425f,0x631f,0xc61f,0xef5f,0xe73f,0xa53f,0x421f,0x5aff,0x843f,0xc65f,0xf7bf,0xc65f,
+    0xe73f,0xffff,0xf7bf,0xe71f,0xd6bf,0xe71f,0xffff,0xb5df,0x39ff,0x31bf,0x9cdf,0xffff,0xce3f,0xd6df,0x8003,0xffff,
+    0x0027,0xffdf,0xffff,0xd69f,0xd69f,0xffff,0x841f,0x297f,0x423f,0xd67f,0xf7bf,0x423f,0x213f,0x52df,0xe71f,0xffff,
+    0xdf1f,0xef5f,0xffff,0xb5bf,0x39ff,0x295f,0x7bff,0xf7bf,0xd69f,0xd69f,0xffff,0xf79f,0xd69f,0xef5f,0xffff,0xbdff,
+    0x4a7f,0x39df,0x31bf,0x6b5f,0xf7df,0xe71f,0xbe1f,0xef7f,0x8003,0xffff,0x0078,0xe75f,0xbdff,0xef5f,0xf7bf,0x52df,
+    0x31bf,0x31df,0x5aff,0xc65f,0x9cff,0x297f,0x9cff,0xffff,0xce5f,0xb5bf,0xb5bf,0xdeff,0xf7bf,0x633f,0x423f,0xc61f,
+    0xf7bf,0xdf1f,0xce5f,0xffff,0xffff,0xd69f,0xd6df,0xffdf,0x6b5f,0x215f,0x3a1f,0x39ff,0x39bf,0xbdff,0xffff,0xce9f,
+    0xc61f,0xd6bf,0xdeff,0xd69f,0xc5ff,0xd6bf,0xffff,0xad9f,0x319f,0x39ff,0x3a1f,0x215f,0x841f,0xe75f,0x31bf,0xad7f,
+    0xffff,0xb5bf,0xce7f,0xbdff,0xc63f,0xffff,0x739f,0x631f,0xffff,0xf79f,0xe73f,0xce7f,0xf7df,0xffff,0xdf1f,0xce5f,
+    0xffff,0xa53f,0x213f,0x319f,0x31bf,0x297f,0x4a7f,0xdedf,0xffff,0xe73f,0xce7f,0xc65f,0xce7f,0xef5f,0xffff,0xce5f,
+    0x4a5f,0x299f,0x319f,0x297f,0x319f,0xb59f,0x949f,0x213f,0x949f,0xffff,0xce9f,0xb59f,0xb5bf,0xe73f,0xf79f,0x5aff,
+    0x39ff,0xad7f,0xf7bf,0xdeff,0xce7f,0xffff,0xffff,0xf79f,0xc63f,0xef7f,0xe73f,0x6b7f,0x73bf,0x5aff,0x31bf,0x297f,
+    0x4a7f,0xb5bf,0xefbf,0x8003,0xffff,0x0018,0xef9f,0xad5f,0x421f,0x297f,0x39df,0x633f,0x6b7f,0x7bff,0xdf1f,0x423f,
+    0x18df,0x421f,0xd69f,0xffff,0xef9f,0xf7df,0xffff,0xa51f,0x295f,0x18ff,0x7bdf,0xf7df,0xce9f,0xd6bf,0x8003,0xffff,
+    0x0026,0xd6df,0xd67f,0xf7bf,0xf7bf,0xffff,0xf7bf,0x949f,0x31bf,0x297f,0x317f,0x5adf,0x83ff,0x8c5f,0x7bdf,0x52bf,
+    0x317f,0x297f,0x31bf,0xa53f,0xffff,0xffff,0xf7bf,0xf7bf,0xbdff,0x9d1f,0x529f,0x423f,0xa53f,0xce9f,0xce7f,0x845f,
+    0x31bf,0x6b5f,0x9cff,0xd69f,0xef9f,0xc65f,0xe75f,0x8003,0xffff,0x0026,0xef9f,0xce5f,0xe71f,0xe75f,0xce5f,0xef7f,
+    0xf79f,0x52bf,0x297f,0x319f,0x295f,0x211f,0x18ff,0x211f,0x297f,0x31bf,0x215f,0x631f,0xffff,0xdeff,0xa55f,0xe77f,
+    0xffff,0xce7f,0xbe1f,0xa55f,0x215f,0x211f,0x319f,0x297f,0x18ff,0x39ff,0xdf1f,0xffff,0xf7bf,0xd6df,0xce7f,0xf7bf,
+    0x8004,0xffff,0x0024,0xe73f,0xdedf,0xc65f,0x9cff,0xd6df,0xf7bf,0x52bf,0x213f,0x31bf,0x319f,0x421f,0x529f,0x39df,
+    0x297f,0x39df,0x211f,0x5aff,0xffff,0x73df,0x213f,0x633f,0x8c7f,0x421f,0x295f,0x845f,0x425f,0x421f,0xa55f,0x8c7f,
+    0x297f,0x62ff,0xef5f,0xef9f,0xdf3f,0xc65f,0xef5f,0x8006,0xffff,0x0022,0xf7bf,0xe73f,0xce9f,0xf7bf,0xef7f,0x6b3f,
+    0x211f,0x191f,0x6b7f,0xdedf,0xf7bf,0xd69f,0x5aff,0x211f,0x215f,0x7bff,0xef7f,0x52bf,0x211f,0x39df,0x421f,0x319f,
+    0x18ff,0x8c5f,0xdeff,0xd6bf,0xffff,0xffdf,0xc63f,0xdf1f,0xf79f,0xdf1f,0xc65f,0xdeff,0x8008,0xffff,0x0020,0xf79f,
+    0xd6bf,0xe6ff,0xf7bf,0xef7f,0xad7f,0x7bdf,0xdeff,0xf7ff,0xdeff,0xffff,0xce7f,0x7c1f,0x94df,0x7bdf,0x5adf,0x297f,
+    0x8c7f,0xdf1f,0xef5f,0xce7f,0x6b7f,0x297f,0x635f,0x8c7f,0xef7f,0xf7bf,0xf7df,0xe75f,0xce7f,0xc65f,0xe71f,0x800a,
+    0xffff,0x001e,0xe73f,0xce5f,0xce7f,0xe73f,0xf7df,0xffdf,0xffdf,0xd69f,0x9cff,0xd6ff,0xf7df,0xffff,0x9d1f,0x18ff,
+    0x20ff,0x94bf,0xffff,0xef7f,0xd6ff,0xf7bf,0xf7bf,0x631f,0x089f,0x215f,0xce9f,0xf7df,0xbdff,0xbe1f,0xdedf,0xef9f,
+    0x800c,0xffff,0x001b,0xf7bf,0xdeff,0xce5f,0xc63f,0xd69f,0xe73f,0xd6bf,0xc63f,0xce7f,0xef9f,0xf7bf,0xd6df,0x4a7f,
+    0x39df,0xe73f,0xef5f,0xb5df,0xb5bf,0xbdff,0xffff,0xb5bf,0x18ff,0x73df,0xef9f,0xefbf,0xc61f,0xdeff,0x8010,0xffff,
+    0x0019,0xf7bf,0xe73f,0xd6bf,0xd6bf,0xe75f,0xef9f,0xc63f,0xdedf,0xef9f,0xffff,0x7bff,0x421f,0xef9f,0xd6df,0xb5df,
+    0xd6bf,0xb59f,0xf7bf,0xc65f,0x213f,0xb5df,0xffff,0xef9f,0xcebf,0xdf1f,0x8016,0xffff,0x0013,0xd6bf,0xd6bf,0xf7df,
+    0xc63f,0x39ff,0x319f,0xd6df,0xef9f,0xbddf,0xad9f,0xc63f,0xffff,0xa53f,0x10bf,0x5aff,0xe73f,0xef9f,0xce5f,0xe73f,
+    0x8016,0xffff,0x0013,0xe71f,0xc65f,0xffff,0x9cdf,0x089f,0x109f,0x73df,0xffff,0xffff,0xef9f,0xffff,0xe71f,0x4a5f,
+    0x085f,0x211f,0xce7f,0xef7f,0xc63f,0xf79f,0x8016,0xffff,0x0012,0xef9f,0xc63f,0xe75f,0xdf1f,0x9cff,0x73bf,0x213f,
+    0x6b7f,0xbdff,0xce7f,0xad5f,0x4a5f,0x31bf,0x845f,0xa53f,0xf79f,0xd6df,0xce9f,0x8018,0xffff,0x0011,0xd6bf,0xce9f,
+    0xf7bf,0xffff,0xf7bf,0x4a7f,0x085f,0x18ff,0x211f,0x109f,0x085f,0x8c7f,0xffff,0xf7df,0xef7f,0xc63f,0xe73f,0x8018,
+    0xffff,0x0011,0xf79f,0xc65f,0xdeff,0xef9f,0xf79f,0x73df,0x18ff,0x73bf,0xad5f,0x4a5f,0x18ff,0xad7f,0xffdf,0xef7f,
+    0xce9f,0xd69f,0xf7bf,0x8019,0xffff,0x000f,0xe73f,0xc65f,0xd6df,0xef9f,0xef7f,0xc63f,0xef9f,0xffff,0xd6df,0xc65f,
+    0xef9f,0xef9f,0xce9f,0xce7f,0xef9f,0x801b,0xffff,0x000d,0xe73f,0xce7f,0xc65f,0xdf1f,0xef9f,0xef9f,0xef7f,0xf79f,
+    0xef7f,0xd6bf,0xc63f,0xd69f,0xf79f,0x801d,0xffff,0x000b,0xf7bf,0xdeff,0xce7f,0xc63f,0xce7f,0xd69f,0xce5f,0xce3f,
+    0xd69f,0xe73f,0xf7df,0x8020,0xffff,0x0006,0xf7df,0xef7f,0xe71f,0xdf1f,0xe73f,0xf79f,0x800e,0xffff
+};
+
+const uint16_t bmp234[398]   = // Bitmap 234 (RLE, 1025 words raw)
 {
     0x2020, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7be,0xf7be,0xffdf,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xdefb,0xc638,0xbdf7,0xbdf7,0xbdf7,0xbdf7,
-    0xce59,0xe73c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xdefb,0xc638,0xc618,0xce59,0xce79,0xce79,
-    0xce59,0xc618,0xb596,0xa534,0xb596,0xdefb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xc638,0xbdf7,0xd69a,0xd6ba,0xd6ba,
-    0xd69a,0xce79,0xce59,0xc638,0xc618,0xb5b6,0x9cd3,0x8c51,0xc638,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xce59,0xbdf7,0xd6ba,0xd6ba,
-    0xdedb,0xdedb,0xdedb,0xd69a,0xce59,0xc618,0xb5b6,0xb596,0xa514,0x9492,0x8c51,0xdefb,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdedb,0xb596,0xd69a,
-    0xd69a,0xd6ba,0xdedb,0xdedb,0xd6ba,0xd69a,0xc638,0xbdd7,0xb596,0xad75,0xa534,0x94b2,0x8c51,0x94b2,0xf7be,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xb5b6,
-    0xc618,0xce59,0xce59,0xce79,0xd69a,0xd69a,0xd69a,0xce79,0xc638,0xbdf7,0xb596,0xad75,0xa534,0x94b2,0x9492,
-    0x8410,0xbdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xd69a,0xad55,0xc618,0xbdf7,0xc618,0xce59,0xd69a,0xd69a,0xce79,0xce59,0xc638,0xbdd7,0xb596,0xad55,0xa514,
-    0x94b2,0x9492,0x8c51,0x8c71,0xef7d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xad75,0xa534,0xbdd7,0xbdd7,0xc618,0xc638,0xce59,0xce59,0xce59,0xc638,0xbdf7,0xb5b6,0xad75,
-    0xa534,0x9cf3,0x94b2,0x8c71,0x8c71,0x7bef,0xce79,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffdf,0xa514,0x9cf3,0xb5b6,0xb5b6,0xbdd7,0xbdf7,0xc618,0xc618,0xc618,0xbdf7,0xbdd7,
-    0xad75,0xad55,0xa514,0x9cd3,0x9492,0x8c71,0x8c71,0x7bef,0xc618,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x9cd3,0x94b2,0xad75,0xb596,0xb596,0xb5b6,0xbdd7,0xbdd7,0xbdd7,
-    0xb5b6,0xad75,0xa534,0xa514,0x9cf3,0x94b2,0x9492,0x8c71,0x8c51,0x7bef,0xbdd7,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf79e,0x9cd3,0x9492,0xa514,0xad75,0xad75,0xad75,0xad75,
-    0xad75,0xad75,0xad55,0xa534,0xa514,0x9cf3,0x9cd3,0x94b2,0x9492,0x8c71,0x8c51,0x7bef,0xb5b6,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa514,0x8c71,0x94b2,0x9cf3,0xa534,
-    0xad55,0xad55,0xa534,0xa534,0xa514,0xa514,0x9cf3,0x9cd3,0x94b2,0x9492,0x8c71,0x8c51,0x8c51,0x8410,0xbdd7,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbdd7,0x8c51,0x94b2,
-    0x94b2,0x9cd3,0x9cf3,0x9cf3,0x9cf3,0x9cf3,0x9cf3,0x9cf3,0x9cd3,0x94b2,0x9492,0x8c71,0x8c71,0x8430,0x8c51,
-    0x8410,0xc618,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdefb,
-    0x8c51,0x9492,0x9492,0x94b2,0x94b2,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x9cd3,0x94b2,0x9492,0x8c71,0x8c71,0x8c51,
-    0x8430,0x8c71,0x8c71,0xe73c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffdf,0x9cf3,0x8c51,0x9492,0x9492,0x9492,0x9492,0x94b2,0x94b2,0x9492,0x9492,0x9492,0x8c71,0x8c71,
-    0x8c51,0x8430,0x8c71,0x8c51,0xbdd7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xdedb,0x8410,0x8c71,0x8c71,0x8c71,0x8c71,0x8c71,0x8c71,0x8c71,0x8c71,0x8c71,
-    0x8c51,0x8c51,0x8430,0x8c51,0x9492,0xa534,0xf7be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc618,0x7bef,0x8c51,0x8c51,0x8c51,0x8c51,0x8c51,0x8c51,
-    0x8c51,0x8c51,0x8430,0x8430,0x8c71,0x94b2,0x9492,0xef5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xc638,0x8410,0x8410,0x8c51,0x8c51,
-    0x8c51,0x8430,0x8430,0x8430,0x8c51,0x9492,0x9492,0x94b2,0xdefb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdefb,0x9cd3,
-    0x7bef,0x7bef,0x8410,0x8430,0x8c51,0x8c51,0x8c71,0x9492,0xad55,0xef7d,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffdf,0xd6ba,0xbdd7,0xad55,0xa514,0xa534,0xb596,0xce59,0xe73c,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp235[1025]   = // Bitmap 235
+    0x80ae,0xffff,0x0003,0xf7be,0xf7be,0xffdf,0x801a,0xffff,0x0003,0xffdf,0xdefb,0xc638,0x8004,0xbdf7,0x0002,0xce59,
+    0xe73c,0x8015,0xffff,0x000d,0xffdf,0xdefb,0xc638,0xc618,0xce59,0xce79,0xce79,0xce59,0xc618,0xb596,0xa534,0xb596,
+    0xdefb,0x8012,0xffff,0x000f,0xffdf,0xc638,0xbdf7,0xd69a,0xd6ba,0xd6ba,0xd69a,0xce79,0xce59,0xc638,0xc618,0xb5b6,
+    0x9cd3,0x8c51,0xc638,0x8011,0xffff,0x0004,0xce59,0xbdf7,0xd6ba,0xd6ba,0x8003,0xdedb,0x0009,0xd69a,0xce59,0xc618,
+    0xb5b6,0xb596,0xa514,0x9492,0x8c51,0xdefb,0x800f,0xffff,0x0012,0xdedb,0xb596,0xd69a,0xd69a,0xd6ba,0xdedb,0xdedb,
+    0xd6ba,0xd69a,0xc638,0xbdd7,0xb596,0xad75,0xa534,0x94b2,0x8c51,0x94b2,0xf7be,0x800d,0xffff,0x0006,0xffdf,0xb5b6,
+    0xc618,0xce59,0xce59,0xce79,0x8003,0xd69a,0x000a,0xce79,0xc638,0xbdf7,0xb596,0xad75,0xa534,0x94b2,0x9492,0x8410,
+    0xbdf7,0x800d,0xffff,0x0014,0xd69a,0xad55,0xc618,0xbdf7,0xc618,0xce59,0xd69a,0xd69a,0xce79,0xce59,0xc638,0xbdd7,
+    0xb596,0xad55,0xa514,0x94b2,0x9492,0x8c51,0x8c71,0xef7d,0x800c,0xffff,0x0006,0xad75,0xa534,0xbdd7,0xbdd7,0xc618,
+    0xc638,0x8003,0xce59,0x000d,0xc638,0xbdf7,0xb5b6,0xad75,0xa534,0x9cf3,0x94b2,0x8c71,0x8c71,0x7bef,0xce79,0xffff,
+    0xffdf,0x8009,0xffff,0x0007,0xffdf,0xa514,0x9cf3,0xb5b6,0xb5b6,0xbdd7,0xbdf7,0x8003,0xc618,0x000d,0xbdf7,0xbdd7,
+    0xad75,0xad55,0xa514,0x9cd3,0x9492,0x8c71,0x8c71,0x7bef,0xc618,0xffff,0xffdf,0x8009,0xffff,0x0007,0xf79e,0x9cd3,
+    0x94b2,0xad75,0xb596,0xb596,0xb5b6,0x8003,0xbdd7,0x000b,0xb5b6,0xad75,0xa534,0xa514,0x9cf3,0x94b2,0x9492,0x8c71,
+    0x8c51,0x7bef,0xbdd7,0x800b,0xffff,0x0004,0xf79e,0x9cd3,0x9492,0xa514,0x8006,0xad75,0x000b,0xad55,0xa534,0xa514,
+    0x9cf3,0x9cd3,0x94b2,0x9492,0x8c71,0x8c51,0x7bef,0xb5b6,0x800c,0xffff,0x0014,0xa514,0x8c71,0x94b2,0x9cf3,0xa534,
+    0xad55,0xad55,0xa534,0xa534,0xa514,0xa514,0x9cf3,0x9cd3,0x94b2,0x9492,0x8c71,0x8c51,0x8c51,0x8410,0xbdd7,0x800c,
+    0xffff,0x0005,0xbdd7,0x8c51,0x94b2,0x94b2,0x9cd3,0x8006,0x9cf3,0x000b,0x9cd3,0x94b2,0x9492,0x8c71,0x8c71,0x8430,
+    0x8c51,0x8410,0xc618,0xffff,0xffdf,0x800a,0xffff,0x0006,0xdefb,0x8c51,0x9492,0x9492,0x94b2,0x94b2,0x8005,0x9cd3,
+    0x0009,0x94b2,0x9492,0x8c71,0x8c71,0x8c51,0x8430,0x8c71,0x8c71,0xe73c,0x800c,0xffff,0x0003,0xffdf,0x9cf3,0x8c51,
+    0x8004,0x9492,0x0002,0x94b2,0x94b2,0x8003,0x9492,0x0007,0x8c71,0x8c71,0x8c51,0x8430,0x8c71,0x8c51,0xbdd7,0x800e,
+    0xffff,0x0002,0xdedb,0x8410,0x8009,0x8c71,0x0007,0x8c51,0x8c51,0x8430,0x8c51,0x9492,0xa534,0xf7be,0x800f,0xffff,
+    0x0002,0xc618,0x7bef,0x8008,0x8c51,0x0006,0x8430,0x8430,0x8c71,0x94b2,0x9492,0xef5d,0x8011,0xffff,0x0003,0xc638,
+    0x8410,0x8410,0x8003,0x8c51,0x8003,0x8430,0x0005,0x8c51,0x9492,0x9492,0x94b2,0xdefb,0x8013,0xffff,0x000c,0xdefb,
+    0x9cd3,0x7bef,0x7bef,0x8410,0x8430,0x8c51,0x8c51,0x8c71,0x9492,0xad55,0xef7d,0x8015,0xffff,0x0009,0xffdf,0xd6ba,
+    0xbdd7,0xad55,0xa514,0xa534,0xb596,0xce59,0xe73c,0x8039,0xffff,0x0001,0xffdf,0x8092,0xffff
+};
+
+const uint16_t bmp235[750]   = // Bitmap 235 (RLE, 1025 words raw)
 {
     0x2020, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffdd,0xffdd,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffe,
-    0xff9a,0xffdc,0xfffe,0xffff,0xff57,0xff57,0xfffe,0xfffe,0xffdd,0xff7a,0xfffe,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xff15,0xff35,0xffdd,0xffdd,0xfef2,0xfef2,0xffdd,0xffdd,0xff36,0xfef4,0xfffe,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xff7a,0xffbb,0xffde,0xffdd,0xff55,0xfe8c,0xff58,0xff37,0xfecf,0xfece,0xff37,0xff58,0xfe6d,0xff14,0xffdd,
-    0xffde,0xffbb,0xff59,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xff99,0xfe8f,0xff99,0xff37,0xff35,0xfe89,0xfecf,0xfe8e,0xfeab,0xfeab,0xfe8f,0xfed0,0xfe49,
-    0xff15,0xff17,0xff99,0xfe4f,0xff79,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffde,0xffdd,0xfed0,0xfe6c,0xfef2,0xfe8d,0xfeaa,0xfe8b,0xfe8c,0xfe8c,0xfe6b,0xf62a,
-    0xf629,0xfe4a,0xfe6e,0xfef2,0xfe2c,0xfe6f,0xfffd,0xffde,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xff7a,0xff9a,0xffdd,0xff38,0xff15,0xfe8a,0xfe8a,0xfe8c,0xfed0,0xff12,0xff12,0xff12,
-    0xfed1,0xfeaf,0xf64c,0xf5c8,0xf5c8,0xfe2a,0xfe0a,0xff14,0xff38,0xfffd,0xff9a,0xff59,0xfffe,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xff9a,0xfe6f,0xfeb1,0xff15,0xfe6e,0xfe8c,0xfece,0xff33,0xff54,0xff53,
-    0xff33,0xff11,0xfef0,0xfecf,0xfeae,0xf62b,0xf586,0xf504,0xf60a,0xfe4e,0xff14,0xfe91,0xf5ee,0xff7a,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdd,0xff98,0xfe2b,0xfe4a,0xfe6b,0xfeae,0xff33,0xff53,
-    0xff54,0xff75,0xff54,0xff53,0xff10,0xfecd,0xfe8b,0xf64a,0xf5c7,0xf523,0xecc2,0xf5ea,0xfdeb,0xf5ab,0xff78,
-    0xffdd,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffe,0xffff,0xffdd,0xff17,0xfed2,0xfe49,0xf68b,0xff12,
-    0xff32,0xff53,0xff74,0xff73,0xff72,0xff71,0xff2e,0xfeeb,0xfe89,0xf648,0xf5e7,0xf544,0xf4e3,0xeca3,0xf5ca,
-    0xfed2,0xff17,0xffdd,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xff7a,0xfef5,0xff36,0xff15,0xfe4d,0xf629,
-    0xfecf,0xff10,0xff2f,0xff50,0xff71,0xff91,0xff90,0xff6f,0xff4d,0xff0b,0xfea8,0xf668,0xf607,0xf564,0xf503,
-    0xec83,0xf526,0xfe4d,0xfef5,0xff16,0xfeb4,0xff39,0xfffe,0xffff,0xffff,0xffff,0xffbc,0xfef4,0xfe0c,0xfdea,
-    0xf609,0xf628,0xfece,0xfecc,0xff0d,0xff6f,0xff90,0xff90,0xff8f,0xff8e,0xff4c,0xff0a,0xfea8,0xfe67,0xf606,
-    0xf563,0xf503,0xeca3,0xec63,0xf5aa,0xf54a,0xf56b,0xfe94,0xffbc,0xffff,0xffff,0xffff,0xffff,0xfffe,0xffdd,
-    0xff57,0xfe8f,0xf5c6,0xf608,0xfe8b,0xfecb,0xff0c,0xff4d,0xff6e,0xff8e,0xff8d,0xff6c,0xff4a,0xff08,0xfea6,
-    0xf646,0xf5e5,0xf563,0xf503,0xeca3,0xec43,0xf507,0xfe4f,0xff37,0xffdd,0xffde,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffdd,0xff16,0xfe6f,0xf5a5,0xf5e5,0xfe6a,0xfeaa,0xfeea,0xff2b,0xff6c,0xff6c,0xff6b,0xff4a,0xff28,
-    0xfee6,0xfe85,0xf625,0xf5c3,0xf543,0xf503,0xeca3,0xec23,0xf507,0xfe4f,0xfef6,0xffdd,0xffff,0xffff,0xffff,
-    0xffff,0xffbd,0xff17,0xfe93,0xfe4f,0xfdec,0xf563,0xf5a4,0xf648,0xfe89,0xfec8,0xfee9,0xff29,0xff29,0xff28,
-    0xff27,0xfee6,0xfea5,0xf664,0xf603,0xf5a3,0xf543,0xf4e3,0xec83,0xec23,0xf4a5,0xf5ac,0xf5ee,0xfe52,0xfef7,
-    0xffbc,0xffff,0xffff,0xffbd,0xfef6,0xfe51,0xfe0e,0xfdcb,0xf544,0xf563,0xf5e5,0xf648,0xfe87,0xfea7,0xfec7,
-    0xfee6,0xfee6,0xfec5,0xfea4,0xfe64,0xf623,0xf5e3,0xf583,0xf503,0xecc3,0xec63,0xec23,0xf4a5,0xf56b,0xf5ad,
-    0xf610,0xfed6,0xffbc,0xffff,0xffff,0xffff,0xfffe,0xffdd,0xff16,0xfe4f,0xf545,0xf543,0xf583,0xf5e5,0xf646,
-    0xfe66,0xfe85,0xfe85,0xfe84,0xfe64,0xf663,0xf623,0xf5e3,0xf5a3,0xf543,0xf4e3,0xeca3,0xec64,0xec24,0xf507,
-    0xfe2e,0xfef6,0xffdd,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffe,0xffdd,0xff57,0xfe70,0xf526,0xf503,0xf543,
-    0xf583,0xf5c3,0xf604,0xf624,0xf624,0xf623,0xf623,0xf603,0xf5e3,0xf5a3,0xf543,0xf503,0xecc3,0xec63,0xec44,
-    0xec44,0xf4e7,0xfe2f,0xff37,0xffdd,0xffde,0xffff,0xffff,0xffff,0xffff,0xffdd,0xfed5,0xf58c,0xf509,0xf548,
-    0xecc3,0xf503,0xf543,0xf563,0xf583,0xf5c3,0xf5c3,0xf5e3,0xf5c3,0xf5a3,0xf583,0xf543,0xf503,0xecc3,0xec83,
-    0xec43,0xec66,0xec85,0xf509,0xf488,0xf50b,0xfeb5,0xffbc,0xffff,0xffff,0xffff,0xffff,0xff39,0xfe73,0xfeb4,
-    0xfef4,0xf60d,0xf4e5,0xf4c3,0xf503,0xf523,0xf543,0xf543,0xf563,0xf563,0xf563,0xf543,0xf503,0xf4e3,0xeca3,
-    0xec83,0xec23,0xec65,0xeca6,0xf506,0xf5ed,0xfed4,0xfe94,0xf633,0xff39,0xffff,0xffff,0xffff,0xffff,0xfffe,
-    0xfffe,0xfffd,0xfef7,0xfeb2,0xf549,0xec42,0xf4c3,0xf4c3,0xf4e3,0xf503,0xf503,0xf503,0xf4e3,0xf4e3,0xf4c3,
-    0xeca3,0xec63,0xec23,0xec44,0xecc7,0xec44,0xf509,0xfe91,0xfed6,0xfffd,0xffff,0xfffe,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffdf,0xffdd,0xffb9,0xf54b,0xf4c9,0xf548,0xec22,0xec83,0xeca3,0xeca3,0xeca3,0xeca3,0xeca3,
-    0xec83,0xec63,0xec43,0xec23,0xec65,0xece7,0xeca4,0xf569,0xf468,0xf4ca,0xff99,0xffdd,0xffdf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xff9b,0xf56e,0xf5ae,0xfef4,0xf5cd,0xf529,0xec03,0xec23,0xec43,0xec43,
-    0xec43,0xec43,0xec23,0xec23,0xec44,0xec86,0xece7,0xec64,0xf569,0xf5ac,0xfef4,0xf58e,0xf52d,0xff9a,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xff19,0xff38,0xfffd,0xfef7,0xfef4,0xf4c9,0xf4c8,0xeca5,
-    0xec23,0xec23,0xec23,0xec44,0xec65,0xec85,0xecc6,0xecc6,0xf506,0xf4c8,0xf448,0xfef4,0xfef7,0xfffd,0xff38,
-    0xff18,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffbe,0xfffd,0xf610,0xf4a9,
-    0xfe92,0xf5cd,0xf4e9,0xf486,0xf4e6,0xec85,0xec86,0xf506,0xf4a6,0xf4a8,0xf5cc,0xfe91,0xf489,0xf5af,0xfffd,
-    0xffbd,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xff79,
-    0xf52d,0xff78,0xfed6,0xfef4,0xf448,0xf5ee,0xf60e,0xf4ea,0xf4ca,0xf60e,0xf5ee,0xf408,0xfed4,0xfed6,0xff78,
-    0xf50d,0xff59,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xff19,0xff79,0xfffd,0xffdd,0xfed5,0xf4aa,0xff36,0xfef5,0xf56d,0xf52d,0xfef5,0xff37,0xf4aa,0xfe94,
-    0xffdd,0xffdd,0xff7a,0xff18,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xfffe,0xffff,0xffde,0xffff,0xfe54,0xfe53,0xffdd,0xfffd,0xf611,0xf5d0,0xfffd,0xffdd,
-    0xfe94,0xf633,0xffff,0xffde,0xffff,0xfffe,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffe,0xff39,0xffbc,0xffde,0xffff,0xfed6,0xfeb6,
-    0xffff,0xffde,0xffbc,0xff18,0xfffe,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfffe,0xffff,0xffff,0xffff,
-    0xffbc,0xff9c,0xffff,0xffff,0xffff,0xfffe,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp236[1025]   = // Bitmap 236
+    0x802f,0xffff,0x0002,0xffdd,0xffdd,0x8019,0xffff,0x000c,0xfffe,0xff9a,0xffdc,0xfffe,0xffff,0xff57,0xff57,0xfffe,
+    0xfffe,0xffdd,0xff7a,0xfffe,0x8015,0xffff,0x000b,0xff15,0xff35,0xffdd,0xffdd,0xfef2,0xfef2,0xffdd,0xffdd,0xff36,
+    0xfef4,0xfffe,0x8011,0xffff,0x0012,0xff7a,0xffbb,0xffde,0xffdd,0xff55,0xfe8c,0xff58,0xff37,0xfecf,0xfece,0xff37,
+    0xff58,0xfe6d,0xff14,0xffdd,0xffde,0xffbb,0xff59,0x800e,0xffff,0x0012,0xff99,0xfe8f,0xff99,0xff37,0xff35,0xfe89,
+    0xfecf,0xfe8e,0xfeab,0xfeab,0xfe8f,0xfed0,0xfe49,0xff15,0xff17,0xff99,0xfe4f,0xff79,0x800d,0xffff,0x0014,0xffde,
+    0xffdd,0xfed0,0xfe6c,0xfef2,0xfe8d,0xfeaa,0xfe8b,0xfe8c,0xfe8c,0xfe6b,0xf62a,0xf629,0xfe4a,0xfe6e,0xfef2,0xfe2c,
+    0xfe6f,0xfffd,0xffde,0x800a,0xffff,0x0009,0xff7a,0xff9a,0xffdd,0xff38,0xff15,0xfe8a,0xfe8a,0xfe8c,0xfed0,0x8003,
+    0xff12,0x000d,0xfed1,0xfeaf,0xf64c,0xf5c8,0xf5c8,0xfe2a,0xfe0a,0xff14,0xff38,0xfffd,0xff9a,0xff59,0xfffe,0x8007,
+    0xffff,0x0018,0xff9a,0xfe6f,0xfeb1,0xff15,0xfe6e,0xfe8c,0xfece,0xff33,0xff54,0xff53,0xff33,0xff11,0xfef0,0xfecf,
+    0xfeae,0xf62b,0xf586,0xf504,0xf60a,0xfe4e,0xff14,0xfe91,0xf5ee,0xff7a,0x8008,0xffff,0x0019,0xffdd,0xff98,0xfe2b,
+    0xfe4a,0xfe6b,0xfeae,0xff33,0xff53,0xff54,0xff75,0xff54,0xff53,0xff10,0xfecd,0xfe8b,0xf64a,0xf5c7,0xf523,0xecc2,
+    0xf5ea,0xfdeb,0xf5ab,0xff78,0xffdd,0xffdf,0x8005,0xffff,0x001a,0xfffe,0xffff,0xffdd,0xff17,0xfed2,0xfe49,0xf68b,
+    0xff12,0xff32,0xff53,0xff74,0xff73,0xff72,0xff71,0xff2e,0xfeeb,0xfe89,0xf648,0xf5e7,0xf544,0xf4e3,0xeca3,0xf5ca,
+    0xfed2,0xff17,0xffdd,0x8006,0xffff,0x001d,0xff7a,0xfef5,0xff36,0xff15,0xfe4d,0xf629,0xfecf,0xff10,0xff2f,0xff50,
+    0xff71,0xff91,0xff90,0xff6f,0xff4d,0xff0b,0xfea8,0xf668,0xf607,0xf564,0xf503,0xec83,0xf526,0xfe4d,0xfef5,0xff16,
+    0xfeb4,0xff39,0xfffe,0x8003,0xffff,0x001c,0xffbc,0xfef4,0xfe0c,0xfdea,0xf609,0xf628,0xfece,0xfecc,0xff0d,0xff6f,
+    0xff90,0xff90,0xff8f,0xff8e,0xff4c,0xff0a,0xfea8,0xfe67,0xf606,0xf563,0xf503,0xeca3,0xec63,0xf5aa,0xf54a,0xf56b,
+    0xfe94,0xffbc,0x8004,0xffff,0x001c,0xfffe,0xffdd,0xff57,0xfe8f,0xf5c6,0xf608,0xfe8b,0xfecb,0xff0c,0xff4d,0xff6e,
+    0xff8e,0xff8d,0xff6c,0xff4a,0xff08,0xfea6,0xf646,0xf5e5,0xf563,0xf503,0xeca3,0xec43,0xf507,0xfe4f,0xff37,0xffdd,
+    0xffde,0x8005,0xffff,0x001a,0xffdd,0xff16,0xfe6f,0xf5a5,0xf5e5,0xfe6a,0xfeaa,0xfeea,0xff2b,0xff6c,0xff6c,0xff6b,
+    0xff4a,0xff28,0xfee6,0xfe85,0xf625,0xf5c3,0xf543,0xf503,0xeca3,0xec23,0xf507,0xfe4f,0xfef6,0xffdd,0x8004,0xffff,
+    0x003e,0xffbd,0xff17,0xfe93,0xfe4f,0xfdec,0xf563,0xf5a4,0xf648,0xfe89,0xfec8,0xfee9,0xff29,0xff29,0xff28,0xff27,
+    0xfee6,0xfea5,0xf664,0xf603,0xf5a3,0xf543,0xf4e3,0xec83,0xec23,0xf4a5,0xf5ac,0xf5ee,0xfe52,0xfef7,0xffbc,0xffff,
+    0xffff,0xffbd,0xfef6,0xfe51,0xfe0e,0xfdcb,0xf544,0xf563,0xf5e5,0xf648,0xfe87,0xfea7,0xfec7,0xfee6,0xfee6,0xfec5,
+    0xfea4,0xfe64,0xf623,0xf5e3,0xf583,0xf503,0xecc3,0xec63,0xec23,0xf4a5,0xf56b,0xf5ad,0xf610,0xfed6,0xffbc,0x8003,
+    0xffff,0x001b,0xfffe,0xffdd,0xff16,0xfe4f,0xf545,0xf543,0xf583,0xf5e5,0xf646,0xfe66,0xfe85,0xfe85,0xfe84,0xfe64,
+    0xf663,0xf623,0xf5e3,0xf5a3,0xf543,0xf4e3,0xeca3,0xec64,0xec24,0xf507,0xfe2e,0xfef6,0xffdd,0x8005,0xffff,0x001c,
+    0xfffe,0xffdd,0xff57,0xfe70,0xf526,0xf503,0xf543,0xf583,0xf5c3,0xf604,0xf624,0xf624,0xf623,0xf623,0xf603,0xf5e3,
+    0xf5a3,0xf543,0xf503,0xecc3,0xec63,0xec44,0xec44,0xf4e7,0xfe2f,0xff37,0xffdd,0xffde,0x8004,0xffff,0x001c,0xffdd,
+    0xfed5,0xf58c,0xf509,0xf548,0xecc3,0xf503,0xf543,0xf563,0xf583,0xf5c3,0xf5c3,0xf5e3,0xf5c3,0xf5a3,0xf583,0xf543,
+    0xf503,0xecc3,0xec83,0xec43,0xec66,0xec85,0xf509,0xf488,0xf50b,0xfeb5,0xffbc,0x8004,0xffff,0x000b,0xff39,0xfe73,
+    0xfeb4,0xfef4,0xf60d,0xf4e5,0xf4c3,0xf503,0xf523,0xf543,0xf543,0x8003,0xf563,0x000e,0xf543,0xf503,0xf4e3,0xeca3,
+    0xec83,0xec23,0xec65,0xeca6,0xf506,0xf5ed,0xfed4,0xfe94,0xf633,0xff39,0x8004,0xffff,0x000a,0xfffe,0xfffe,0xfffd,
+    0xfef7,0xfeb2,0xf549,0xec42,0xf4c3,0xf4c3,0xf4e3,0x8003,0xf503,0x000f,0xf4e3,0xf4e3,0xf4c3,0xeca3,0xec63,0xec23,
+    0xec44,0xecc7,0xec44,0xf509,0xfe91,0xfed6,0xfffd,0xffff,0xfffe,0x8005,0xffff,0x0008,0xffdf,0xffdd,0xffb9,0xf54b,
+    0xf4c9,0xf548,0xec22,0xec83,0x8005,0xeca3,0x000d,0xec83,0xec63,0xec43,0xec23,0xec65,0xece7,0xeca4,0xf569,0xf468,
+    0xf4ca,0xff99,0xffdd,0xffdf,0x8007,0xffff,0x0008,0xff9b,0xf56e,0xf5ae,0xfef4,0xf5cd,0xf529,0xec03,0xec23,0x8004,
+    0xec43,0x000c,0xec23,0xec23,0xec44,0xec86,0xece7,0xec64,0xf569,0xf5ac,0xfef4,0xf58e,0xf52d,0xff9a,0x8008,0xffff,
+    0x0008,0xff19,0xff38,0xfffd,0xfef7,0xfef4,0xf4c9,0xf4c8,0xeca5,0x8003,0xec23,0x000d,0xec44,0xec65,0xec85,0xecc6,
+    0xecc6,0xf506,0xf4c8,0xf448,0xfef4,0xfef7,0xfffd,0xff38,0xff18,0x800a,0xffff,0x0014,0xffbe,0xfffd,0xf610,0xf4a9,
+    0xfe92,0xf5cd,0xf4e9,0xf486,0xf4e6,0xec85,0xec86,0xf506,0xf4a6,0xf4a8,0xf5cc,0xfe91,0xf489,0xf5af,0xfffd,0xffbd,
+    0x800d,0xffff,0x0012,0xff79,0xf52d,0xff78,0xfed6,0xfef4,0xf448,0xf5ee,0xf60e,0xf4ea,0xf4ca,0xf60e,0xf5ee,0xf408,
+    0xfed4,0xfed6,0xff78,0xf50d,0xff59,0x800e,0xffff,0x0012,0xff19,0xff79,0xfffd,0xffdd,0xfed5,0xf4aa,0xff36,0xfef5,
+    0xf56d,0xf52d,0xfef5,0xff37,0xf4aa,0xfe94,0xffdd,0xffdd,0xff7a,0xff18,0x800e,0xffff,0x0012,0xfffe,0xffff,0xffde,
+    0xffff,0xfe54,0xfe53,0xffdd,0xfffd,0xf611,0xf5d0,0xfffd,0xffdd,0xfe94,0xf633,0xffff,0xffde,0xffff,0xfffe,0x8011,
+    0xffff,0x000c,0xfffe,0xff39,0xffbc,0xffde,0xffff,0xfed6,0xfeb6,0xffff,0xffde,0xffbc,0xff18,0xfffe,0x8015,0xffff,
+    0x0001,0xfffe,0x8003,0xffff,0x0002,0xffbc,0xff9c,0x8003,0xffff,0x0001,0xfffe,0x802b,0xffff
+};
+
+const uint16_t bmp236[895]   = // Bitmap 236 (RLE, 1025 words raw)
 {
     0x2020, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xff9e,0xfedb,
-    0xfe79,0xfe79,0xfedb,0xff7d,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xfe9a,0xfc30,0xf208,
-    0xe882,0xd800,0xd800,0xd800,0xe000,0xe082,0xf186,0xfbcf,0xfe38,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfe59,0xf28a,0xd800,
-    0xc800,0xc8e3,0xda49,0xe2eb,0xe38e,0xec92,0xe34d,0xda49,0xd0c3,0xd000,0xd800,0xf1c7,0xfdb6,0xffff,0xffff,
-    0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffbe,0xfb8e,0xd800,
-    0xc800,0xda8a,0xf38e,0xfbcf,0xfb0c,0xfa69,0xf1e7,0xf575,0xffff,0xffff,0xff9e,0xf659,0xe3cf,0xd061,0xd800,
-    0xf28a,0xff1c,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xff1c,0xe9e7,
-    0xc800,0xd1e7,0xfe79,0xfc71,0xf882,0xf800,0xf000,0xf000,0xc800,0xec71,0xffdf,0xffbe,0xffff,0xffbe,0xfe18,
-    0xfe18,0xe36d,0xc800,0xe0e3,0xfe38,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfedb,
-    0xe104,0xc000,0xe3ef,0xffff,0xffdf,0xe082,0xf000,0xf020,0xf020,0xd800,0xd228,0xffff,0xffff,0xffff,0xfc51,
-    0xf8c3,0xf800,0xf0c3,0xfcd3,0xf575,0xc820,0xd841,0xfe59,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xff9e,0xe986,0xc000,0xecb2,0xffff,0xffff,0xf5f7,0xe000,0xf020,0xf020,0xf020,0xd000,0xf596,0xffff,0xff9e,
-    0xf28a,0xf000,0xf000,0xf020,0xf000,0xe800,0xf38e,0xfdf7,0xd0a2,0xd8e3,0xfefb,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xf34d,0xc000,0xec30,0xffdf,0xffdf,0xffff,0xf5f7,0xe000,0xf020,0xf020,0xe800,0xd082,0xff3c,
-    0xffff,0xf30c,0xf000,0xf041,0xf020,0xf000,0xf020,0xf841,0xe800,0xeb2c,0xf5d7,0xc800,0xe1c7,0xffdf,0xffff,
-    0xffff,0xffff,0xffff,0xfdf7,0xc800,0xda49,0xfb8e,0xe145,0xff9e,0xffff,0xf5d7,0xd800,0xf020,0xf020,0xe800,
-    0xd965,0xffff,0xf5f7,0xe800,0xf020,0xf000,0xf000,0xf020,0xe000,0xd000,0xd000,0xc000,0xfe79,0xec71,0xc800,
-    0xf4b2,0xffff,0xffdf,0xffff,0xffff,0xe1c7,0xc861,0xf430,0xe820,0xe000,0xf596,0xffff,0xfedb,0xd841,0xf000,
-    0xf020,0xf000,0xd8e3,0xffff,0xeacb,0xe800,0xf020,0xf000,0xe820,0xc800,0xc861,0xda8a,0xec10,0xf534,0xff7d,
-    0xffdf,0xd945,0xd0c3,0xff9e,0xffff,0xffff,0xfe38,0xc800,0xe34d,0xea49,0xf000,0xe820,0xe208,0xffff,0xffdf,
-    0xd9c7,0xe000,0xf020,0xf000,0xd820,0xf618,0xe124,0xf000,0xf020,0xe800,0xc000,0xdaeb,0xff1c,0xffff,0xffff,
-    0xffff,0xffdf,0xffff,0xf534,0xc800,0xf4f3,0xffff,0xffff,0xeb4d,0xc820,0xf3cf,0xe841,0xf000,0xf020,0xe800,
-    0xec10,0xffff,0xf575,0xd000,0xf020,0xf020,0xf000,0xf145,0xf061,0xf020,0xf020,0xc820,0xe451,0xffff,0xff3c,
-    0xfe59,0xfe79,0xff5d,0xffff,0xffff,0xff9e,0xd0a2,0xd9c7,0xffff,0xffff,0xd904,0xd165,0xeb4d,0xe800,0xf020,
-    0xf000,0xf020,0xe800,0xf3ae,0xffbe,0xe34d,0xd800,0xf020,0xd800,0xd000,0xd000,0xd800,0xe000,0xd904,0xfcb2,
-    0xf9e7,0xf8a2,0xf841,0xf861,0xf904,0xfa69,0xfd96,0xffff,0xe2eb,0xc800,0xff5d,0xff5d,0xc800,0xe3cf,0xec30,
-    0xd800,0xf841,0xf000,0xf000,0xf020,0xf000,0xf965,0xfaeb,0xe861,0xc800,0xd145,0xe34d,0xebcf,0xda28,0xd000,
-    0xf061,0xf800,0xf000,0xf000,0xf000,0xf000,0xf000,0xf000,0xe800,0xec51,0xf555,0xc800,0xf5f7,0xfe79,0xc800,
-    0xecb2,0xff9e,0xd104,0xd800,0xf841,0xf000,0xf000,0xf020,0xf000,0xf800,0xd820,0xd1c7,0xfbcf,0xf9c7,0xf9a6,
-    0xfc10,0xe2cb,0xd800,0xf020,0xf020,0xf020,0xf020,0xf020,0xf020,0xf020,0xf000,0xd8c3,0xf575,0xc800,0xecd3,
-    0xf575,0xc800,0xf575,0xffff,0xfe9a,0xd104,0xd000,0xe800,0xf020,0xf020,0xf041,0xf020,0xd041,0xf451,0xe882,
-    0xf000,0xf000,0xe000,0xebef,0xe0e3,0xe800,0xd800,0xd800,0xe000,0xf020,0xf020,0xf020,0xf000,0xd082,0xf596,
-    0xc800,0xebef,0xf534,0xc800,0xf5b6,0xffff,0xffff,0xff1c,0xe2cb,0xc820,0xc800,0xd000,0xd000,0xe000,0xd8c3,
-    0xec10,0xd800,0xf841,0xf841,0xd820,0xe2cb,0xe9a6,0xc800,0xd208,0xda69,0xd104,0xc800,0xd800,0xf020,0xf000,
-    0xd082,0xfdb6,0xc800,0xe3ae,0xf618,0xc800,0xed14,0xffff,0xffff,0xffff,0xffff,0xfeba,0xecf3,0xe3ef,0xe32c,
-    0xd861,0xd820,0xf492,0xd0c3,0xd800,0xd800,0xc000,0xf451,0xe8e3,0xe800,0xfb0c,0xffbe,0xffff,0xf5d7,0xda08,
-    0xd000,0xe820,0xd124,0xfe59,0xc800,0xec51,0xfeba,0xc800,0xec51,0xf555,0xf2eb,0xfdb6,0xfefb,0xffdf,0xffdf,
-    0xfe59,0xfb0c,0xf820,0xe800,0xe9e7,0xf4f3,0xd228,0xc986,0xebef,0xfa8a,0xf000,0xf020,0xf000,0xe904,0xf618,
-    0xffff,0xffff,0xe34d,0xc000,0xd208,0xfdd7,0xc800,0xf575,0xff9e,0xd041,0xe2aa,0xeb6d,0xe000,0xf820,0xf8c3,
-    0xf924,0xf8e3,0xf800,0xf000,0xf000,0xf020,0xe800,0xf145,0xfbae,0xfb6d,0xf9c7,0xe000,0xe800,0xf000,0xf020,
-    0xf000,0xe061,0xfe79,0xffff,0xffff,0xe36d,0xf575,0xf451,0xc800,0xfe9a,0xffff,0xe249,0xd0a2,0xf4f3,0xd820,
-    0xf020,0xf000,0xf000,0xf000,0xf020,0xf020,0xf000,0xe820,0xc800,0xd000,0xf000,0xf800,0xe000,0xc8e3,0xd082,
-    0xe800,0xf000,0xf020,0xe800,0xe1c7,0xffdf,0xffdf,0xffff,0xffff,0xd9a6,0xd0a2,0xffbe,0xffff,0xf514,0xc800,
-    0xf4d3,0xd9a6,0xe820,0xf020,0xf020,0xf020,0xf020,0xf820,0xe820,0xc000,0xebef,0xeaaa,0xe820,0xf041,0xe000,
-    0xe34d,0xf555,0xd800,0xf020,0xf000,0xf020,0xd800,0xf5d7,0xffff,0xffdf,0xfe79,0xc800,0xe34d,0xffff,0xffff,
-    0xff7d,0xd082,0xe1c7,0xec92,0xd000,0xf041,0xf020,0xf020,0xe800,0xd800,0xc000,0xe38e,0xffff,0xe9a6,0xf000,
-    0xf041,0xe800,0xda08,0xffff,0xd924,0xe800,0xf020,0xf020,0xe000,0xe3ae,0xffff,0xffff,0xeaeb,0xc800,0xfe59,
-    0xffff,0xffdf,0xffff,0xec10,0xc800,0xf492,0xda8a,0xc000,0xc800,0xc800,0xc820,0xd1a6,0xf555,0xffff,0xf596,
-    0xe800,0xf020,0xf020,0xe800,0xd1a6,0xffff,0xe30c,0xe800,0xf020,0xf020,0xe800,0xda08,0xffff,0xfe38,0xd000,
-    0xda8a,0xffff,0xffff,0xffff,0xffff,0xff9e,0xd124,0xd882,0xfe9a,0xf575,0xec10,0xecf3,0xfe59,0xffdf,0xffff,
-    0xff3c,0xe904,0xf000,0xf020,0xf020,0xe000,0xda28,0xffff,0xeb6d,0xe000,0xf020,0xf820,0xe000,0xd1c7,0xffbe,
-    0xe145,0xc841,0xfe9a,0xffff,0xffff,0xffff,0xffff,0xffff,0xf618,0xc800,0xe165,0xffdf,0xffff,0xffff,0xffff,
-    0xffff,0xfe59,0xf165,0xf000,0xf020,0xf000,0xf020,0xd000,0xec30,0xffff,0xeb2c,0xe800,0xf841,0xe000,0xc000,
-    0xebef,0xf2eb,0xc000,0xec92,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xecf3,0xc800,0xe186,0xfefb,
-    0xffff,0xff7d,0xeb4d,0xf841,0xf800,0xf020,0xf000,0xf020,0xe020,0xc882,0xff1c,0xffff,0xe1c7,0xe000,0xc800,
-    0xc8e3,0xf3ef,0xf228,0xc000,0xe30c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xec30,
-    0xc800,0xe0c3,0xfdd7,0xffdf,0xd165,0xc800,0xd800,0xe800,0xf000,0xe820,0xc000,0xec71,0xffff,0xff9e,0xd0e3,
-    0xc0a2,0xe3ae,0xfd14,0xf1c7,0xc000,0xe2eb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffdf,0xffff,0xf575,0xc882,0xd000,0xf2eb,0xfe18,0xecb2,0xd249,0xc8e3,0xc820,0xc000,0xe2cb,0xffff,0xffff,
-    0xffff,0xfefb,0xfdd7,0xfbcf,0xd800,0xc000,0xec10,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffdf,0xffff,0xfefb,0xdacb,0xc800,0xd800,0xf269,0xfc71,0xfcf3,0xfcb2,0xfd96,0xffbe,
-    0xff1c,0xfe59,0xfcd3,0xf28a,0xe020,0xc800,0xd1c7,0xfe18,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xfe38,0xe2eb,0xd061,0xd000,0xd800,0xe061,
-    0xe0e3,0xe0a2,0xe020,0xd800,0xd000,0xc820,0xda69,0xf596,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xff7d,0xf5f7,
-    0xec30,0xe30c,0xda69,0xda69,0xdaeb,0xe3ef,0xf555,0xff3c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp237[1025]   = // Bitmap 237
+    0x800d,0xffff,0x0006,0xff9e,0xfedb,0xfe79,0xfe79,0xfedb,0xff7d,0x8004,0xffff,0x0001,0xffdf,0x800f,0xffff,0x0007,
+    0xffdf,0xffff,0xffff,0xfe9a,0xfc30,0xf208,0xe882,0x8003,0xd800,0x0005,0xe000,0xe082,0xf186,0xfbcf,0xfe38,0x8012,
+    0xffff,0x0013,0xfe59,0xf28a,0xd800,0xc800,0xc8e3,0xda49,0xe2eb,0xe38e,0xec92,0xe34d,0xda49,0xd0c3,0xd000,0xd800,
+    0xf1c7,0xfdb6,0xffff,0xffff,0xffdf,0x800b,0xffff,0x0016,0xffbe,0xfb8e,0xd800,0xc800,0xda8a,0xf38e,0xfbcf,0xfb0c,
+    0xfa69,0xf1e7,0xf575,0xffff,0xffff,0xff9e,0xf659,0xe3cf,0xd061,0xd800,0xf28a,0xff1c,0xffff,0xffdf,0x8009,0xffff,
+    0x0018,0xff1c,0xe9e7,0xc800,0xd1e7,0xfe79,0xfc71,0xf882,0xf800,0xf000,0xf000,0xc800,0xec71,0xffdf,0xffbe,0xffff,
+    0xffbe,0xfe18,0xfe18,0xe36d,0xc800,0xe0e3,0xfe38,0xffff,0xffdf,0x8007,0xffff,0x000c,0xfedb,0xe104,0xc000,0xe3ef,
+    0xffff,0xffdf,0xe082,0xf000,0xf020,0xf020,0xd800,0xd228,0x8003,0xffff,0x000b,0xfc51,0xf8c3,0xf800,0xf0c3,0xfcd3,
+    0xf575,0xc820,0xd841,0xfe59,0xffff,0xffdf,0x8005,0xffff,0x0008,0xff9e,0xe986,0xc000,0xecb2,0xffff,0xffff,0xf5f7,
+    0xe000,0x8003,0xf020,0x000f,0xd000,0xf596,0xffff,0xff9e,0xf28a,0xf000,0xf000,0xf020,0xf000,0xe800,0xf38e,0xfdf7,
+    0xd0a2,0xd8e3,0xfefb,0x8006,0xffff,0x001b,0xf34d,0xc000,0xec30,0xffdf,0xffdf,0xffff,0xf5f7,0xe000,0xf020,0xf020,
+    0xe800,0xd082,0xff3c,0xffff,0xf30c,0xf000,0xf041,0xf020,0xf000,0xf020,0xf841,0xe800,0xeb2c,0xf5d7,0xc800,0xe1c7,
+    0xffdf,0x8004,0xffff,0x0055,0xfdf7,0xc800,0xda49,0xfb8e,0xe145,0xff9e,0xffff,0xf5d7,0xd800,0xf020,0xf020,0xe800,
+    0xd965,0xffff,0xf5f7,0xe800,0xf020,0xf000,0xf000,0xf020,0xe000,0xd000,0xd000,0xc000,0xfe79,0xec71,0xc800,0xf4b2,
+    0xffff,0xffdf,0xffff,0xffff,0xe1c7,0xc861,0xf430,0xe820,0xe000,0xf596,0xffff,0xfedb,0xd841,0xf000,0xf020,0xf000,
+    0xd8e3,0xffff,0xeacb,0xe800,0xf020,0xf000,0xe820,0xc800,0xc861,0xda8a,0xec10,0xf534,0xff7d,0xffdf,0xd945,0xd0c3,
+    0xff9e,0xffff,0xffff,0xfe38,0xc800,0xe34d,0xea49,0xf000,0xe820,0xe208,0xffff,0xffdf,0xd9c7,0xe000,0xf020,0xf000,
+    0xd820,0xf618,0xe124,0xf000,0xf020,0xe800,0xc000,0xdaeb,0xff1c,0x8003,0xffff,0x005b,0xffdf,0xffff,0xf534,0xc800,
+    0xf4f3,0xffff,0xffff,0xeb4d,0xc820,0xf3cf,0xe841,0xf000,0xf020,0xe800,0xec10,0xffff,0xf575,0xd000,0xf020,0xf020,
+    0xf000,0xf145,0xf061,0xf020,0xf020,0xc820,0xe451,0xffff,0xff3c,0xfe59,0xfe79,0xff5d,0xffff,0xffff,0xff9e,0xd0a2,
+    0xd9c7,0xffff,0xffff,0xd904,0xd165,0xeb4d,0xe800,0xf020,0xf000,0xf020,0xe800,0xf3ae,0xffbe,0xe34d,0xd800,0xf020,
+    0xd800,0xd000,0xd000,0xd800,0xe000,0xd904,0xfcb2,0xf9e7,0xf8a2,0xf841,0xf861,0xf904,0xfa69,0xfd96,0xffff,0xe2eb,
+    0xc800,0xff5d,0xff5d,0xc800,0xe3cf,0xec30,0xd800,0xf841,0xf000,0xf000,0xf020,0xf000,0xf965,0xfaeb,0xe861,0xc800,
+    0xd145,0xe34d,0xebcf,0xda28,0xd000,0xf061,0xf800,0x8006,0xf000,0x0019,0xe800,0xec51,0xf555,0xc800,0xf5f7,0xfe79,
+    0xc800,0xecb2,0xff9e,0xd104,0xd800,0xf841,0xf000,0xf000,0xf020,0xf000,0xf800,0xd820,0xd1c7,0xfbcf,0xf9c7,0xf9a6,
+    0xfc10,0xe2cb,0xd800,0x8007,0xf020,0x001d,0xf000,0xd8c3,0xf575,0xc800,0xecd3,0xf575,0xc800,0xf575,0xffff,0xfe9a,
+    0xd104,0xd000,0xe800,0xf020,0xf020,0xf041,0xf020,0xd041,0xf451,0xe882,0xf000,0xf000,0xe000,0xebef,0xe0e3,0xe800,
+    0xd800,0xd800,0xe000,0x8003,0xf020,0x0028,0xf000,0xd082,0xf596,0xc800,0xebef,0xf534,0xc800,0xf5b6,0xffff,0xffff,
+    0xff1c,0xe2cb,0xc820,0xc800,0xd000,0xd000,0xe000,0xd8c3,0xec10,0xd800,0xf841,0xf841,0xd820,0xe2cb,0xe9a6,0xc800,
+    0xd208,0xda69,0xd104,0xc800,0xd800,0xf020,0xf000,0xd082,0xfdb6,0xc800,0xe3ae,0xf618,0xc800,0xed14,0x8004,0xffff,
+    0x005f,0xfeba,0xecf3,0xe3ef,0xe32c,0xd861,0xd820,0xf492,0xd0c3,0xd800,0xd800,0xc000,0xf451,0xe8e3,0xe800,0xfb0c,
+    0xffbe,0xffff,0xf5d7,0xda08,0xd000,0xe820,0xd124,0xfe59,0xc800,0xec51,0xfeba,0xc800,0xec51,0xf555,0xf2eb,0xfdb6,
+    0xfefb,0xffdf,0xffdf,0xfe59,0xfb0c,0xf820,0xe800,0xe9e7,0xf4f3,0xd228,0xc986,0xebef,0xfa8a,0xf000,0xf020,0xf000,
+    0xe904,0xf618,0xffff,0xffff,0xe34d,0xc000,0xd208,0xfdd7,0xc800,0xf575,0xff9e,0xd041,0xe2aa,0xeb6d,0xe000,0xf820,
+    0xf8c3,0xf924,0xf8e3,0xf800,0xf000,0xf000,0xf020,0xe800,0xf145,0xfbae,0xfb6d,0xf9c7,0xe000,0xe800,0xf000,0xf020,
+    0xf000,0xe061,0xfe79,0xffff,0xffff,0xe36d,0xf575,0xf451,0xc800,0xfe9a,0xffff,0xe249,0xd0a2,0xf4f3,0xd820,0xf020,
+    0x8003,0xf000,0x001d,0xf020,0xf020,0xf000,0xe820,0xc800,0xd000,0xf000,0xf800,0xe000,0xc8e3,0xd082,0xe800,0xf000,
+    0xf020,0xe800,0xe1c7,0xffdf,0xffdf,0xffff,0xffff,0xd9a6,0xd0a2,0xffbe,0xffff,0xf514,0xc800,0xf4d3,0xd9a6,0xe820,
+    0x8004,0xf020,0x0054,0xf820,0xe820,0xc000,0xebef,0xeaaa,0xe820,0xf041,0xe000,0xe34d,0xf555,0xd800,0xf020,0xf000,
+    0xf020,0xd800,0xf5d7,0xffff,0xffdf,0xfe79,0xc800,0xe34d,0xffff,0xffff,0xff7d,0xd082,0xe1c7,0xec92,0xd000,0xf041,
+    0xf020,0xf020,0xe800,0xd800,0xc000,0xe38e,0xffff,0xe9a6,0xf000,0xf041,0xe800,0xda08,0xffff,0xd924,0xe800,0xf020,
+    0xf020,0xe000,0xe3ae,0xffff,0xffff,0xeaeb,0xc800,0xfe59,0xffff,0xffdf,0xffff,0xec10,0xc800,0xf492,0xda8a,0xc000,
+    0xc800,0xc800,0xc820,0xd1a6,0xf555,0xffff,0xf596,0xe800,0xf020,0xf020,0xe800,0xd1a6,0xffff,0xe30c,0xe800,0xf020,
+    0xf020,0xe800,0xda08,0xffff,0xfe38,0xd000,0xda8a,0x8004,0xffff,0x001c,0xff9e,0xd124,0xd882,0xfe9a,0xf575,0xec10,
+    0xecf3,0xfe59,0xffdf,0xffff,0xff3c,0xe904,0xf000,0xf020,0xf020,0xe000,0xda28,0xffff,0xeb6d,0xe000,0xf020,0xf820,
+    0xe000,0xd1c7,0xffbe,0xe145,0xc841,0xfe9a,0x8005,0xffff,0x0004,0xf618,0xc800,0xe165,0xffdf,0x8004,0xffff,0x0012,
+    0xfe59,0xf165,0xf000,0xf020,0xf000,0xf020,0xd000,0xec30,0xffff,0xeb2c,0xe800,0xf841,0xe000,0xc000,0xebef,0xf2eb,
+    0xc000,0xec92,0x8005,0xffff,0x001a,0xffdf,0xffff,0xecf3,0xc800,0xe186,0xfefb,0xffff,0xff7d,0xeb4d,0xf841,0xf800,
+    0xf020,0xf000,0xf020,0xe020,0xc882,0xff1c,0xffff,0xe1c7,0xe000,0xc800,0xc8e3,0xf3ef,0xf228,0xc000,0xe30c,0x8009,
+    0xffff,0x0016,0xec30,0xc800,0xe0c3,0xfdd7,0xffdf,0xd165,0xc800,0xd800,0xe800,0xf000,0xe820,0xc000,0xec71,0xffff,
+    0xff9e,0xd0e3,0xc0a2,0xe3ae,0xfd14,0xf1c7,0xc000,0xe2eb,0x8009,0xffff,0x000d,0xffdf,0xffff,0xf575,0xc882,0xd000,
+    0xf2eb,0xfe18,0xecb2,0xd249,0xc8e3,0xc820,0xc000,0xe2cb,0x8003,0xffff,0x0006,0xfefb,0xfdd7,0xfbcf,0xd800,0xc000,
+    0xec10,0x800b,0xffff,0x0014,0xffdf,0xffff,0xfefb,0xdacb,0xc800,0xd800,0xf269,0xfc71,0xfcf3,0xfcb2,0xfd96,0xffbe,
+    0xff1c,0xfe59,0xfcd3,0xf28a,0xe020,0xc800,0xd1c7,0xfe18,0x800d,0xffff,0x0014,0xffdf,0xffff,0xffff,0xfe38,0xe2eb,
+    0xd061,0xd000,0xd800,0xe061,0xe0e3,0xe0a2,0xe020,0xd800,0xd000,0xc820,0xda69,0xf596,0xffff,0xffff,0xffdf,0x8011,
+    0xffff,0x000a,0xff7d,0xf5f7,0xec30,0xe30c,0xda69,0xda69,0xdaeb,0xe3ef,0xf555,0xff3c,0x800b,0xffff
+};
+
+const uint16_t bmp237[928]   = // Bitmap 237 (RLE, 1025 words raw)
 {
     0x2020, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfeba,0xfcb2,0xf2cb,0xf1a6,0xe924,
-    0xe8a2,0xe945,0xf186,0xfacb,0xfcb2,0xfeba,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xfdd7,0xea28,0xd800,0xd000,0xc800,
-    0xd0e3,0xd1a6,0xd1c7,0xd1e7,0xd145,0xc841,0xd000,0xe000,0xfa28,0xfd96,0xffff,0xffff,0xffdf,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xfefb,0xea8a,0xd000,0xc800,0xda69,
-    0xed14,0xfefb,0xfcd3,0xfa8a,0xfaaa,0xfb8e,0xfbcf,0xfc92,0xf4b2,0xda69,0xc800,0xd800,0xfa49,0xfe79,0xffff,
-    0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xfd75,0xd861,0xc000,0xdb2c,
-    0xfe79,0xffff,0xffff,0xf69a,0xe020,0xf000,0xf000,0xf000,0xf800,0xe000,0xe3ae,0xffff,0xfeba,0xdaeb,0xc800,
-    0xe841,0xfd14,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xf4d3,0xd000,0xc8c3,
-    0xf451,0xfe9a,0xffff,0xffdf,0xffdf,0xe228,0xe800,0xf041,0xf020,0xf020,0xd800,0xc882,0xf575,0xffdf,0xffff,
-    0xffff,0xf596,0xc8c3,0xd800,0xfcd3,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xfd55,0xc800,
-    0xd145,0xf471,0xf165,0xe082,0xff5d,0xffff,0xfe9a,0xd820,0xf020,0xf000,0xf020,0xe820,0xc882,0xfe59,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xff3c,0xd1a6,0xd800,0xfcf3,0xffff,0xffdf,0xffff,0xffff,0xffdf,0xffff,0xfe9a,
-    0xd061,0xc904,0xfc92,0xe8c3,0xf000,0xd8a2,0xff3c,0xffff,0xed14,0xe000,0xf020,0xf000,0xf020,0xd000,0xf534,
-    0xffff,0xffff,0xfedb,0xfc10,0xfa08,0xf924,0xfacb,0xfe79,0xd165,0xd820,0xfe59,0xffff,0xffdf,0xffff,0xffdf,
-    0xffdf,0xe1e7,0xc820,0xf471,0xe124,0xf000,0xf020,0xe041,0xfedb,0xffff,0xec10,0xe000,0xf020,0xf020,0xe800,
-    0xd9c7,0xffff,0xffff,0xf430,0xf061,0xf000,0xf000,0xf000,0xf000,0xf208,0xfe18,0xc861,0xe145,0xffbe,0xffff,
-    0xffff,0xffff,0xf555,0xc800,0xeb8e,0xeaeb,0xe800,0xf020,0xf020,0xe800,0xf4d3,0xffff,0xebef,0xd800,0xf020,
-    0xf020,0xe000,0xec10,0xffff,0xeb6d,0xe800,0xf000,0xf020,0xf020,0xf020,0xf041,0xe800,0xf3ef,0xec92,0xc800,
-    0xf4b2,0xffff,0xffdf,0xffdf,0xd965,0xc8a2,0xff3c,0xd104,0xe820,0xf020,0xf020,0xf000,0xe965,0xffff,0xf555,
-    0xd800,0xf020,0xf020,0xd800,0xf5f7,0xf575,0xe000,0xf041,0xf020,0xf000,0xf020,0xf020,0xf020,0xf841,0xe841,
-    0xfdf7,0xd104,0xd8e3,0xffbe,0xffff,0xfe79,0xc800,0xe38e,0xffff,0xda8a,0xd800,0xf020,0xf000,0xf020,0xf000,
-    0xf3cf,0xffbe,0xd0a2,0xe800,0xf020,0xe820,0xf3ae,0xe0e3,0xf020,0xf020,0xf020,0xf020,0xe000,0xd000,0xd000,
-    0xd000,0xd000,0xe34d,0xec92,0xd000,0xf5b6,0xffff,0xebcf,0xc800,0xfe38,0xffff,0xf618,0xc800,0xe820,0xf020,
-    0xf000,0xf020,0xf000,0xfb6d,0xe1e7,0xe020,0xe800,0xe000,0xe800,0xf000,0xf000,0xf000,0xd800,0xc800,0xd124,
-    0xdaaa,0xe32c,0xe30c,0xd165,0xe3cf,0xff1c,0xd000,0xeb0c,0xffff,0xd9a6,0xd0c3,0xffdf,0xffdf,0xffff,0xe36d,
-    0xc800,0xf041,0xf020,0xf000,0xf020,0xf800,0xf041,0xc800,0xc8c3,0xd165,0xc8c3,0xd000,0xf020,0xd800,0xc986,
-    0xf5f7,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xd945,0xd924,0xffff,0xd041,0xda49,0xffff,0xffff,
-    0xffff,0xffbe,0xe2cb,0xc000,0xe000,0xf020,0xf000,0xf020,0xc800,0xe2cb,0xfbef,0xfaeb,0xfc51,0xe2cb,0xd000,
-    0xe041,0xfacb,0xfc10,0xfbae,0xfc30,0xfe18,0xffdf,0xffff,0xffdf,0xffff,0xe2cb,0xd000,0xff7d,0xc800,0xe36d,
-    0xf430,0xf208,0xff1c,0xffff,0xffff,0xec92,0xc8e3,0xc000,0xd820,0xe000,0xda49,0xf3cf,0xe800,0xf800,0xf061,
-    0xfc71,0xd9c7,0xe820,0xf800,0xf000,0xf000,0xf000,0xf841,0xfa08,0xfdf7,0xffff,0xffff,0xec10,0xc800,0xfe9a,
-    0xc800,0xec71,0xe28a,0xe800,0xf924,0xfc92,0xfefb,0xffff,0xffbe,0xf4d3,0xd8a2,0xd800,0xeb8e,0xd904,0xf000,
-    0xf041,0xf000,0xe186,0xebcf,0xd800,0xf841,0xf020,0xf020,0xf020,0xf000,0xf000,0xf820,0xfc71,0xffff,0xec10,
-    0xc800,0xf679,0xc800,0xebae,0xe2cb,0xe020,0xf000,0xf800,0xf8c3,0xf9e7,0xfa49,0xf9c7,0xf861,0xe000,0xf3ae,
-    0xd145,0xe000,0xf841,0xe000,0xd186,0xf3cf,0xd800,0xe000,0xe800,0xf020,0xf020,0xf020,0xf020,0xf020,0xe800,
-    0xf5d7,0xec92,0xc800,0xfe79,0xd000,0xeaeb,0xe30c,0xe000,0xf020,0xf020,0xf000,0xf000,0xf000,0xf000,0xf020,
-    0xf000,0xf228,0xec71,0xc041,0xc800,0xc041,0xf492,0xe9e7,0xd000,0xd165,0xc861,0xc800,0xe800,0xf020,0xf000,
-    0xf041,0xe000,0xe3cf,0xec10,0xc800,0xfefb,0xd0c3,0xe1e7,0xebef,0xd800,0xf820,0xf020,0xf020,0xf020,0xf020,
-    0xf020,0xf020,0xe000,0xe800,0xfb0c,0xfcb2,0xeb4d,0xfc51,0xf269,0xe800,0xf000,0xfbef,0xfefb,0xe30c,0xc800,
-    0xe000,0xf020,0xf020,0xd800,0xec71,0xe28a,0xd041,0xffbe,0xe2aa,0xd061,0xf4f3,0xc800,0xe000,0xf020,0xf020,
-    0xf020,0xf020,0xe800,0xc800,0xc882,0xd0a2,0xe800,0xf904,0xf9a6,0xe882,0xe800,0xf020,0xf020,0xf020,0xf5b6,
-    0xffff,0xf4f3,0xc820,0xe820,0xf000,0xd020,0xfdf7,0xd0c3,0xda08,0xffff,0xf4f3,0xc800,0xf4f3,0xec10,0xc861,
-    0xc800,0xc800,0xc800,0xc800,0xc841,0xdacb,0xfefb,0xe1a6,0xe800,0xf000,0xe800,0xc841,0xd041,0xf000,0xf020,
-    0xf000,0xe8a2,0xff3c,0xffff,0xec30,0xd000,0xe020,0xda28,0xfdd7,0xc800,0xec71,0xffff,0xff3c,0xd041,0xe1c7,
-    0xffff,0xfedb,0xf555,0xec71,0xec51,0xecf3,0xfeba,0xffff,0xf492,0xe800,0xf020,0xf020,0xd820,0xec30,0xe2cb,
-    0xe000,0xf020,0xf020,0xe800,0xf471,0xffff,0xffbe,0xd124,0xb800,0xf5f7,0xe30c,0xc820,0xfefb,0xffff,0xffff,
-    0xe34d,0xd000,0xfdd7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf430,0xe800,0xf020,0xf020,0xf020,0xd000,
-    0xf638,0xecb2,0xe000,0xf020,0xf020,0xe800,0xe249,0xffff,0xffff,0xf596,0xe3cf,0xfe79,0xc800,0xdaaa,0xffff,
-    0xffdf,0xffff,0xfefb,0xc841,0xe165,0xff9e,0xffbe,0xffbe,0xfe79,0xfcd3,0xf1c7,0xf000,0xf020,0xf000,0xf020,
-    0xe800,0xd061,0xff9e,0xecf3,0xe000,0xf020,0xf020,0xe800,0xd986,0xffff,0xffdf,0xffff,0xffff,0xe1c7,0xc820,
-    0xfe9a,0xffff,0xffdf,0xffdf,0xffff,0xec51,0xc800,0xf30c,0xffff,0xe32c,0xe000,0xf800,0xf000,0xf020,0xf000,
-    0xf000,0xf820,0xd000,0xdb0c,0xffff,0xeb8e,0xe000,0xf020,0xf020,0xe800,0xd986,0xffff,0xffdf,0xffff,0xf3ae,
-    0xc000,0xec30,0xffff,0xffdf,0xffff,0xffff,0xffdf,0xffff,0xda8a,0xd000,0xfcb2,0xf575,0xc000,0xd800,0xf041,
-    0xf020,0xf000,0xf820,0xd800,0xc8a2,0xfefb,0xffff,0xe1c7,0xe800,0xf020,0xf020,0xe820,0xd9e7,0xffff,0xffff,
-    0xf471,0xc800,0xda08,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xff7d,0xd9e7,0xd000,0xfbcf,0xfdb6,
-    0xc965,0xc800,0xe000,0xe820,0xd000,0xc8a2,0xfe38,0xffff,0xf5d7,0xe020,0xf841,0xf020,0xe820,0xc800,0xe410,
-    0xffff,0xf3ef,0xc800,0xd1c7,0xff5d,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xff5d,0xda08,
-    0xd000,0xfa49,0xfdf7,0xe3ae,0xc8c3,0xc000,0xd1e7,0xfe79,0xffff,0xff9e,0xd104,0xd000,0xd000,0xc800,0xc041,
-    0xda08,0xfdd7,0xea8a,0xc000,0xd1e7,0xff5d,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,
-    0xffff,0xffdf,0xe3ae,0xc800,0xe000,0xfb6d,0xfd14,0xfe18,0xffff,0xffff,0xffff,0xffff,0xdb8e,0xd208,0xdb0c,
-    0xebef,0xfc30,0xf28a,0xd000,0xc000,0xe36d,0xffbe,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xfe18,0xda08,0xc800,0xd800,0xf1c7,0xfb6d,0xfcd3,0xfd96,0xfd96,0xfdd7,
-    0xfcd3,0xfb6d,0xf1a6,0xd000,0xc000,0xd1c7,0xf5f7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xf5f7,0xe2eb,0xd0c3,0xc800,0xd000,0xd000,
-    0xd000,0xd000,0xd000,0xc800,0xc8a2,0xdacb,0xf5d7,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffbe,0xfe9a,
-    0xf575,0xecd3,0xebef,0xecd3,0xf575,0xfe79,0xff9e,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp238[1025]   = // Bitmap 238
+    0x800a,0xffff,0x000b,0xfeba,0xfcb2,0xf2cb,0xf1a6,0xe924,0xe8a2,0xe945,0xf186,0xfacb,0xfcb2,0xfeba,0x8003,0xffff,
+    0x0001,0xffdf,0x800c,0xffff,0x0015,0xffdf,0xffff,0xffff,0xfdd7,0xea28,0xd800,0xd000,0xc800,0xd0e3,0xd1a6,0xd1c7,
+    0xd1e7,0xd145,0xc841,0xd000,0xe000,0xfa28,0xfd96,0xffff,0xffff,0xffdf,0x800a,0xffff,0x0017,0xffdf,0xffff,0xfefb,
+    0xea8a,0xd000,0xc800,0xda69,0xed14,0xfefb,0xfcd3,0xfa8a,0xfaaa,0xfb8e,0xfbcf,0xfc92,0xf4b2,0xda69,0xc800,0xd800,
+    0xfa49,0xfe79,0xffff,0xffdf,0x8008,0xffff,0x000b,0xffdf,0xffff,0xfd75,0xd861,0xc000,0xdb2c,0xfe79,0xffff,0xffff,
+    0xf69a,0xe020,0x8003,0xf000,0x000b,0xf800,0xe000,0xe3ae,0xffff,0xfeba,0xdaeb,0xc800,0xe841,0xfd14,0xffff,0xffdf,
+    0x8006,0xffff,0x001b,0xffdf,0xffff,0xf4d3,0xd000,0xc8c3,0xf451,0xfe9a,0xffff,0xffdf,0xffdf,0xe228,0xe800,0xf041,
+    0xf020,0xf020,0xd800,0xc882,0xf575,0xffdf,0xffff,0xffff,0xf596,0xc8c3,0xd800,0xfcd3,0xffff,0xffdf,0x8004,0xffff,
+    0x0012,0xffdf,0xffff,0xfd55,0xc800,0xd145,0xf471,0xf165,0xe082,0xff5d,0xffff,0xfe9a,0xd820,0xf020,0xf000,0xf020,
+    0xe820,0xc882,0xfe59,0x8005,0xffff,0x003d,0xff3c,0xd1a6,0xd800,0xfcf3,0xffff,0xffdf,0xffff,0xffff,0xffdf,0xffff,
+    0xfe9a,0xd061,0xc904,0xfc92,0xe8c3,0xf000,0xd8a2,0xff3c,0xffff,0xed14,0xe000,0xf020,0xf000,0xf020,0xd000,0xf534,
+    0xffff,0xffff,0xfedb,0xfc10,0xfa08,0xf924,0xfacb,0xfe79,0xd165,0xd820,0xfe59,0xffff,0xffdf,0xffff,0xffdf,0xffdf,
+    0xe1e7,0xc820,0xf471,0xe124,0xf000,0xf020,0xe041,0xfedb,0xffff,0xec10,0xe000,0xf020,0xf020,0xe800,0xd9c7,0xffff,
+    0xffff,0xf430,0xf061,0x8004,0xf000,0x0005,0xf208,0xfe18,0xc861,0xe145,0xffbe,0x8003,0xffff,0x0014,0xf555,0xc800,
+    0xeb8e,0xeaeb,0xe800,0xf020,0xf020,0xe800,0xf4d3,0xffff,0xebef,0xd800,0xf020,0xf020,0xe000,0xec10,0xffff,0xeb6d,
+    0xe800,0xf000,0x8003,0xf020,0x001e,0xf041,0xe800,0xf3ef,0xec92,0xc800,0xf4b2,0xffff,0xffdf,0xffdf,0xd965,0xc8a2,
+    0xff3c,0xd104,0xe820,0xf020,0xf020,0xf000,0xe965,0xffff,0xf555,0xd800,0xf020,0xf020,0xd800,0xf5f7,0xf575,0xe000,
+    0xf041,0xf020,0xf000,0x8003,0xf020,0x0019,0xf841,0xe841,0xfdf7,0xd104,0xd8e3,0xffbe,0xffff,0xfe79,0xc800,0xe38e,
+    0xffff,0xda8a,0xd800,0xf020,0xf000,0xf020,0xf000,0xf3cf,0xffbe,0xd0a2,0xe800,0xf020,0xe820,0xf3ae,0xe0e3,0x8004,
+    0xf020,0x0001,0xe000,0x8004,0xd000,0x0016,0xe34d,0xec92,0xd000,0xf5b6,0xffff,0xebcf,0xc800,0xfe38,0xffff,0xf618,
+    0xc800,0xe820,0xf020,0xf000,0xf020,0xf000,0xfb6d,0xe1e7,0xe020,0xe800,0xe000,0xe800,0x8003,0xf000,0x0022,0xd800,
+    0xc800,0xd124,0xdaaa,0xe32c,0xe30c,0xd165,0xe3cf,0xff1c,0xd000,0xeb0c,0xffff,0xd9a6,0xd0c3,0xffdf,0xffdf,0xffff,
+    0xe36d,0xc800,0xf041,0xf020,0xf000,0xf020,0xf800,0xf041,0xc800,0xc8c3,0xd165,0xc8c3,0xd000,0xf020,0xd800,0xc986,
+    0xf5f7,0x8004,0xffff,0x0008,0xffdf,0xffff,0xffff,0xd945,0xd924,0xffff,0xd041,0xda49,0x8003,0xffff,0x0030,0xffbe,
+    0xe2cb,0xc000,0xe000,0xf020,0xf000,0xf020,0xc800,0xe2cb,0xfbef,0xfaeb,0xfc51,0xe2cb,0xd000,0xe041,0xfacb,0xfc10,
+    0xfbae,0xfc30,0xfe18,0xffdf,0xffff,0xffdf,0xffff,0xe2cb,0xd000,0xff7d,0xc800,0xe36d,0xf430,0xf208,0xff1c,0xffff,
+    0xffff,0xec92,0xc8e3,0xc000,0xd820,0xe000,0xda49,0xf3cf,0xe800,0xf800,0xf061,0xfc71,0xd9c7,0xe820,0xf800,0x8003,
+    0xf000,0x001d,0xf841,0xfa08,0xfdf7,0xffff,0xffff,0xec10,0xc800,0xfe9a,0xc800,0xec71,0xe28a,0xe800,0xf924,0xfc92,
+    0xfefb,0xffff,0xffbe,0xf4d3,0xd8a2,0xd800,0xeb8e,0xd904,0xf000,0xf041,0xf000,0xe186,0xebcf,0xd800,0xf841,0x8003,
+    0xf020,0x001e,0xf000,0xf000,0xf820,0xfc71,0xffff,0xec10,0xc800,0xf679,0xc800,0xebae,0xe2cb,0xe020,0xf000,0xf800,
+    0xf8c3,0xf9e7,0xfa49,0xf9c7,0xf861,0xe000,0xf3ae,0xd145,0xe000,0xf841,0xe000,0xd186,0xf3cf,0xd800,0xe000,0xe800,
+    0x8005,0xf020,0x000b,0xe800,0xf5d7,0xec92,0xc800,0xfe79,0xd000,0xeaeb,0xe30c,0xe000,0xf020,0xf020,0x8004,0xf000,
+    0x001b,0xf020,0xf000,0xf228,0xec71,0xc041,0xc800,0xc041,0xf492,0xe9e7,0xd000,0xd165,0xc861,0xc800,0xe800,0xf020,
+    0xf000,0xf041,0xe000,0xe3cf,0xec10,0xc800,0xfefb,0xd0c3,0xe1e7,0xebef,0xd800,0xf820,0x8006,0xf020,0x001a,0xe000,
+    0xe800,0xfb0c,0xfcb2,0xeb4d,0xfc51,0xf269,0xe800,0xf000,0xfbef,0xfefb,0xe30c,0xc800,0xe000,0xf020,0xf020,0xd800,
+    0xec71,0xe28a,0xd041,0xffbe,0xe2aa,0xd061,0xf4f3,0xc800,0xe000,0x8004,0xf020,0x0009,0xe800,0xc800,0xc882,0xd0a2,
+    0xe800,0xf904,0xf9a6,0xe882,0xe800,0x8003,0xf020,0x0010,0xf5b6,0xffff,0xf4f3,0xc820,0xe820,0xf000,0xd020,0xfdf7,
+    0xd0c3,0xda08,0xffff,0xf4f3,0xc800,0xf4f3,0xec10,0xc861,0x8004,0xc800,0x003b,0xc841,0xdacb,0xfefb,0xe1a6,0xe800,
+    0xf000,0xe800,0xc841,0xd041,0xf000,0xf020,0xf000,0xe8a2,0xff3c,0xffff,0xec30,0xd000,0xe020,0xda28,0xfdd7,0xc800,
+    0xec71,0xffff,0xff3c,0xd041,0xe1c7,0xffff,0xfedb,0xf555,0xec71,0xec51,0xecf3,0xfeba,0xffff,0xf492,0xe800,0xf020,
+    0xf020,0xd820,0xec30,0xe2cb,0xe000,0xf020,0xf020,0xe800,0xf471,0xffff,0xffbe,0xd124,0xb800,0xf5f7,0xe30c,0xc820,
+    0xfefb,0xffff,0xffff,0xe34d,0xd000,0xfdd7,0x8006,0xffff,0x0002,0xf430,0xe800,0x8003,0xf020,0x006e,0xd000,0xf638,
+    0xecb2,0xe000,0xf020,0xf020,0xe800,0xe249,0xffff,0xffff,0xf596,0xe3cf,0xfe79,0xc800,0xdaaa,0xffff,0xffdf,0xffff,
+    0xfefb,0xc841,0xe165,0xff9e,0xffbe,0xffbe,0xfe79,0xfcd3,0xf1c7,0xf000,0xf020,0xf000,0xf020,0xe800,0xd061,0xff9e,
+    0xecf3,0xe000,0xf020,0xf020,0xe800,0xd986,0xffff,0xffdf,0xffff,0xffff,0xe1c7,0xc820,0xfe9a,0xffff,0xffdf,0xffdf,
+    0xffff,0xec51,0xc800,0xf30c,0xffff,0xe32c,0xe000,0xf800,0xf000,0xf020,0xf000,0xf000,0xf820,0xd000,0xdb0c,0xffff,
+    0xeb8e,0xe000,0xf020,0xf020,0xe800,0xd986,0xffff,0xffdf,0xffff,0xf3ae,0xc000,0xec30,0xffff,0xffdf,0xffff,0xffff,
+    0xffdf,0xffff,0xda8a,0xd000,0xfcb2,0xf575,0xc000,0xd800,0xf041,0xf020,0xf000,0xf820,0xd800,0xc8a2,0xfefb,0xffff,
+    0xe1c7,0xe800,0xf020,0xf020,0xe820,0xd9e7,0xffff,0xffff,0xf471,0xc800,0xda08,0xffdf,0x8006,0xffff,0x0019,0xff7d,
+    0xd9e7,0xd000,0xfbcf,0xfdb6,0xc965,0xc800,0xe000,0xe820,0xd000,0xc8a2,0xfe38,0xffff,0xf5d7,0xe020,0xf841,0xf020,
+    0xe820,0xc800,0xe410,0xffff,0xf3ef,0xc800,0xd1c7,0xff5d,0x8006,0xffff,0x001b,0xffdf,0xffff,0xff5d,0xda08,0xd000,
+    0xfa49,0xfdf7,0xe3ae,0xc8c3,0xc000,0xd1e7,0xfe79,0xffff,0xff9e,0xd104,0xd000,0xd000,0xc800,0xc041,0xda08,0xfdd7,
+    0xea8a,0xc000,0xd1e7,0xff5d,0xffff,0xffdf,0x8006,0xffff,0x0009,0xffdf,0xffff,0xffdf,0xe3ae,0xc800,0xe000,0xfb6d,
+    0xfd14,0xfe18,0x8004,0xffff,0x000c,0xdb8e,0xd208,0xdb0c,0xebef,0xfc30,0xf28a,0xd000,0xc000,0xe36d,0xffbe,0xffff,
+    0xffdf,0x800b,0xffff,0x0011,0xfe18,0xda08,0xc800,0xd800,0xf1c7,0xfb6d,0xfcd3,0xfd96,0xfd96,0xfdd7,0xfcd3,0xfb6d,
+    0xf1a6,0xd000,0xc000,0xd1c7,0xf5f7,0x800e,0xffff,0x0007,0xffdf,0xffff,0xffff,0xf5f7,0xe2eb,0xd0c3,0xc800,0x8005,
+    0xd000,0x0007,0xc800,0xc8a2,0xdacb,0xf5d7,0xffff,0xffff,0xffdf,0x800e,0xffff,0x0001,0xffdf,0x8003,0xffff,0x0009,
+    0xffbe,0xfe9a,0xf575,0xecd3,0xebef,0xecd3,0xf575,0xfe79,0xff9e,0x8003,0xffff,0x0001,0xffdf,0x8008,0xffff
+};
+
+const uint16_t bmp238[890]   = // Bitmap 238 (RLE, 1025 words raw)
 {
     0x2020, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xff1c,0xfd96,0xfc30,0xf2eb,
-    0xf2cb,0xf2aa,0xf34d,0xfcd3,0xfe59,0xffdf,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xfd14,0xf208,0xd800,0xd000,
-    0xd000,0xd020,0xd041,0xd041,0xd000,0xd000,0xd000,0xe0e3,0xf3ae,0xff1c,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xfdb6,0xe965,0xd000,0xc8a2,
-    0xdb2c,0xf534,0xf659,0xff5d,0xff7d,0xffbe,0xfedb,0xf5b6,0xec51,0xd9e7,0xc800,0xd000,0xebcf,0xff9e,0xffff,
-    0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffbe,0xfb4d,0xd000,0xc8a2,
-    0xe410,0xfcd3,0xf34d,0xf618,0xffff,0xffff,0xffff,0xfeba,0xfa28,0xf9c7,0xf34d,0xfdb6,0xf5b6,0xda69,0xc800,
-    0xd924,0xf638,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xff7d,0xf249,0xc800,
-    0xda8a,0xfcd3,0xfa69,0xf861,0xd000,0xdb4d,0xffff,0xffff,0xfeba,0xf0e3,0xf000,0xf000,0xf000,0xe800,0xe9c7,
-    0xf618,0xf534,0xd061,0xd020,0xf575,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffbe,0xf228,
-    0xc000,0xe3ae,0xfb8e,0xf861,0xf000,0xf020,0xc820,0xf5d7,0xffff,0xffbe,0xf1a6,0xf000,0xf020,0xf020,0xf020,
-    0xf041,0xe000,0xb800,0xf6ba,0xfedb,0xd0e3,0xd000,0xf5f7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xf32c,0xc800,0xec51,0xfedb,0xe800,0xf000,0xf020,0xf000,0xd020,0xfe9a,0xffff,0xf4d3,0xf000,0xf020,0xf000,
-    0xf000,0xe820,0xc800,0xc904,0xebcf,0xfefb,0xffff,0xfeba,0xd0e3,0xd0a2,0xfedb,0xffff,0xffff,0xffff,0xffdf,
-    0xffff,0xfd75,0xd000,0xda8a,0xffff,0xf5b6,0xe000,0xf020,0xf020,0xf000,0xd020,0xfe9a,0xffff,0xea08,0xf000,
-    0xf020,0xf000,0xe820,0xc000,0xe30c,0xff5d,0xffff,0xffff,0xffff,0xffff,0xf638,0xc800,0xda08,0xffff,0xffff,
-    0xffff,0xffff,0xffbe,0xe104,0xc8a2,0xff3c,0xffff,0xf6ba,0xe020,0xf000,0xf020,0xf020,0xd000,0xf5f7,0xffdf,
-    0xe0c3,0xf000,0xf020,0xf020,0xc000,0xe36d,0xffff,0xffff,0xffbe,0xff3c,0xff3c,0xff9e,0xffff,0xec30,0xc800,
-    0xf534,0xffff,0xffdf,0xffff,0xf514,0xc800,0xecd3,0xffff,0xffdf,0xffdf,0xd945,0xf000,0xf020,0xf020,0xe000,
-    0xe3ae,0xffff,0xe041,0xf000,0xf020,0xd800,0xd1c7,0xffff,0xfe79,0xfb8e,0xf9c7,0xf8e3,0xf0c3,0xf124,0xe2eb,
-    0xff3c,0xd104,0xd145,0xffff,0xffff,0xffff,0xe1a6,0xc8c3,0xfe9a,0xfedb,0xffff,0xffff,0xe3ef,0xe000,0xf041,
-    0xf020,0xf000,0xd8c3,0xf618,0xe0c3,0xf000,0xf020,0xc800,0xf596,0xfc92,0xf841,0xf000,0xf000,0xf000,0xf000,
-    0xf000,0xe000,0xe34d,0xf492,0xc800,0xf618,0xffff,0xfeba,0xc800,0xe36d,0xf249,0xd8a2,0xff7d,0xffff,0xff3c,
-    0xd0c3,0xe800,0xf020,0xf000,0xe800,0xf0e3,0xf082,0xe800,0xe800,0xd841,0xf9c7,0xf800,0xf000,0xf020,0xf020,
-    0xf020,0xf020,0xf020,0xf020,0xd0c3,0xfe79,0xc820,0xe34d,0xffff,0xf534,0xc800,0xec51,0xe8c3,0xe800,0xe228,
-    0xffbe,0xffff,0xf618,0xd061,0xe000,0xf020,0xf020,0xd800,0xc800,0xd124,0xd0e3,0xd800,0xf000,0xf020,0xf020,
-    0xf020,0xf020,0xf020,0xf020,0xf020,0xf020,0xd000,0xf5d7,0xd9c7,0xd124,0xffff,0xeb4d,0xc841,0xf492,0xe800,
-    0xf020,0xe800,0xe1c7,0xf5f7,0xffff,0xfeba,0xd1a6,0xe000,0xd800,0xc945,0xf451,0xfc51,0xf471,0xeb6d,0xd020,
-    0xf020,0xe000,0xd000,0xc800,0xc800,0xd000,0xd800,0xf020,0xd820,0xe492,0xebef,0xc800,0xff7d,0xe269,0xd0c3,
-    0xf410,0xe800,0xf020,0xf020,0xf000,0xe800,0xf1a6,0xfbef,0xfb2c,0xe820,0xc861,0xfcb2,0xf986,0xf800,0xe000,
-    0xeb4d,0xeb4d,0xd800,0xc8a2,0xe430,0xf5f7,0xf5f7,0xed34,0xe30c,0xd082,0xc000,0xdbae,0xf4b2,0xc800,0xfeba,
-    0xda69,0xd0e3,0xebef,0xe820,0xf020,0xf000,0xf020,0xf020,0xf000,0xf000,0xf800,0xe000,0xda08,0xf32c,0xe800,
-    0xf041,0xf000,0xd020,0xf492,0xe041,0xe882,0xfbcf,0xfdf7,0xffff,0xffff,0xffff,0xfedb,0xdaeb,0xf575,0xf575,
-    0xc800,0xf69a,0xda69,0xd0c3,0xf4b2,0xd000,0xf020,0xf020,0xf020,0xf020,0xf020,0xf020,0xf841,0xe800,0xda49,
-    0xeb0c,0xe000,0xf841,0xe820,0xc020,0xf4d3,0xe841,0xf000,0xf000,0xe800,0xe145,0xf575,0xffff,0xffff,0xffff,
-    0xffff,0xec51,0xc800,0xfe9a,0xe2cb,0xc820,0xff7d,0xe3ae,0xc800,0xd800,0xe800,0xf000,0xf000,0xe800,0xd800,
-    0xd800,0xd882,0xf4f3,0xd145,0xc800,0xc000,0xdb2c,0xfbcf,0xf000,0xf041,0xf020,0xf020,0xf000,0xe000,0xec51,
-    0xffff,0xffbe,0xffff,0xebef,0xc800,0xfedb,0xec51,0xc800,0xfeba,0xffff,0xf5f7,0xda8a,0xd0c3,0xc820,0xc800,
-    0xc861,0xd228,0xd924,0xe800,0xe186,0xf4f3,0xec51,0xf471,0xfbef,0xe841,0xc800,0xd800,0xf020,0xf000,0xf020,
-    0xf020,0xd800,0xf5d7,0xffff,0xffff,0xe269,0xc841,0xff9e,0xf5f7,0xc800,0xed14,0xffdf,0xffff,0xffff,0xff5d,
-    0xfe59,0xfe79,0xff9e,0xfe9a,0xf8e3,0xf020,0xf000,0xe841,0xf9c7,0xf986,0xf800,0xd800,0xda8a,0xe30c,0xd800,
-    0xf020,0xf000,0xf020,0xe800,0xd145,0xffdf,0xffdf,0xd882,0xd1e7,0xffff,0xff7d,0xd041,0xda69,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xff7d,0xfc92,0xf8a2,0xf000,0xf020,0xf020,0xc800,0xd000,0xe800,0xf020,0xe800,0xd9a6,
-    0xffff,0xe2aa,0xe000,0xf020,0xf000,0xf020,0xd000,0xedb6,0xfe79,0xc800,0xec30,0xffff,0xffff,0xe2cb,0xc820,
-    0xff5d,0xf471,0xfa08,0xfaaa,0xfa08,0xf8c3,0xf000,0xf000,0xf020,0xf020,0xd800,0xd1c7,0xf471,0xe000,0xf020,
-    0xf020,0xd000,0xf5b6,0xff7d,0xd882,0xf000,0xf020,0xf820,0xd000,0xe3ef,0xf30c,0xc000,0xfeba,0xffff,0xffff,
-    0xfe59,0xc800,0xe38e,0xebef,0xe000,0xf800,0xf000,0xf000,0xf020,0xf020,0xf000,0xf041,0xc000,0xf5b6,0xf659,
-    0xe800,0xf020,0xf020,0xd800,0xe34d,0xffff,0xe30c,0xe800,0xf841,0xe020,0xc061,0xfc30,0xd020,0xda49,0xffff,
-    0xffff,0xffff,0xffff,0xe28a,0xc800,0xf5b6,0xd9c7,0xe000,0xf041,0xf020,0xf020,0xf020,0xf041,0xc000,0xda69,
-    0xffff,0xf4b2,0xe800,0xf020,0xf020,0xd800,0xdaaa,0xffff,0xecf3,0xe820,0xe841,0xc000,0xec92,0xf249,0xc000,
-    0xfe79,0xffff,0xffff,0xffff,0xffff,0xfefb,0xd082,0xd965,0xfe38,0xd0c3,0xe000,0xf041,0xf020,0xe000,0xc000,
-    0xda28,0xff3c,0xffff,0xea28,0xf000,0xf020,0xf020,0xd800,0xdaaa,0xffff,0xedb6,0xd000,0xc000,0xe410,0xfc10,
-    0xc800,0xe3cf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf596,0xc800,0xe228,0xf5b6,0xd124,0xc800,0xc800,
-    0xc904,0xec51,0xffdf,0xffff,0xfe18,0xf020,0xf020,0xf000,0xf020,0xd000,0xe3ef,0xffff,0xf69a,0xc945,0xecf3,
-    0xfd34,0xd000,0xd1e7,0xffbe,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xec92,0xc800,0xe208,0xfe38,
-    0xed96,0xf5b6,0xff7d,0xffff,0xffff,0xff5d,0xf945,0xf020,0xf020,0xf020,0xf020,0xc000,0xf5f7,0xffdf,0xffff,
-    0xffdf,0xfc51,0xd000,0xd165,0xff1c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xecb2,
-    0xc800,0xd8a2,0xf596,0xffff,0xffff,0xffff,0xffdf,0xd986,0xe000,0xe000,0xe000,0xe000,0xc000,0xd1a6,0xffff,
-    0xffff,0xfeba,0xf249,0xc800,0xd1e7,0xff1c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffdf,0xffff,0xf618,0xd124,0xc800,0xe186,0xf4f3,0xff5d,0xffff,0xe471,0xd208,0xd1a6,0xd1a6,0xd228,0xe34d,
-    0xfe9a,0xfe38,0xfb2c,0xd800,0xc000,0xe36d,0xffbe,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffdf,0xffff,0xff9e,0xec51,0xd0a2,0xc800,0xd820,0xea08,0xfc30,0xfc92,0xfd34,0xfcd3,
-    0xfc30,0xfb6d,0xe965,0xd800,0xc800,0xda28,0xfdf7,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xff7d,0xecf3,0xda49,0xd082,0xd000,0xd000,
-    0xd000,0xd000,0xc800,0xc800,0xd165,0xe38e,0xfe38,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xff9e,
-    0xfeba,0xf5f7,0xf555,0xf596,0xf638,0xff1c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp239[1025]   = // Bitmap 239
+    0x8007,0xffff,0x0001,0xffdf,0x8003,0xffff,0x000d,0xff1c,0xfd96,0xfc30,0xf2eb,0xf2cb,0xf2aa,0xf34d,0xfcd3,0xfe59,
+    0xffdf,0xffff,0xffff,0xffdf,0x8010,0xffff,0x0009,0xffdf,0xfd14,0xf208,0xd800,0xd000,0xd000,0xd020,0xd041,0xd041,
+    0x8003,0xd000,0x0003,0xe0e3,0xf3ae,0xff1c,0x8010,0xffff,0x0014,0xfdb6,0xe965,0xd000,0xc8a2,0xdb2c,0xf534,0xf659,
+    0xff5d,0xff7d,0xffbe,0xfedb,0xf5b6,0xec51,0xd9e7,0xc800,0xd000,0xebcf,0xff9e,0xffff,0xffdf,0x800a,0xffff,0x0008,
+    0xffbe,0xfb4d,0xd000,0xc8a2,0xe410,0xfcd3,0xf34d,0xf618,0x8003,0xffff,0x000c,0xfeba,0xfa28,0xf9c7,0xf34d,0xfdb6,
+    0xf5b6,0xda69,0xc800,0xd924,0xf638,0xffff,0xffdf,0x8008,0xffff,0x000d,0xff7d,0xf249,0xc800,0xda8a,0xfcd3,0xfa69,
+    0xf861,0xd000,0xdb4d,0xffff,0xffff,0xfeba,0xf0e3,0x8003,0xf000,0x0009,0xe800,0xe9c7,0xf618,0xf534,0xd061,0xd020,
+    0xf575,0xffff,0xffdf,0x8006,0xffff,0x000e,0xffbe,0xf228,0xc000,0xe3ae,0xfb8e,0xf861,0xf000,0xf020,0xc820,0xf5d7,
+    0xffff,0xffbe,0xf1a6,0xf000,0x8003,0xf020,0x0008,0xf041,0xe000,0xb800,0xf6ba,0xfedb,0xd0e3,0xd000,0xf5f7,0x8007,
+    0xffff,0x001a,0xf32c,0xc800,0xec51,0xfedb,0xe800,0xf000,0xf020,0xf000,0xd020,0xfe9a,0xffff,0xf4d3,0xf000,0xf020,
+    0xf000,0xf000,0xe820,0xc800,0xc904,0xebcf,0xfefb,0xffff,0xfeba,0xd0e3,0xd0a2,0xfedb,0x8003,0xffff,0x0016,0xffdf,
+    0xffff,0xfd75,0xd000,0xda8a,0xffff,0xf5b6,0xe000,0xf020,0xf020,0xf000,0xd020,0xfe9a,0xffff,0xea08,0xf000,0xf020,
+    0xf000,0xe820,0xc000,0xe30c,0xff5d,0x8004,0xffff,0x0003,0xf638,0xc800,0xda08,0x8004,0xffff,0x003d,0xffbe,0xe104,
+    0xc8a2,0xff3c,0xffff,0xf6ba,0xe020,0xf000,0xf020,0xf020,0xd000,0xf5f7,0xffdf,0xe0c3,0xf000,0xf020,0xf020,0xc000,
+    0xe36d,0xffff,0xffff,0xffbe,0xff3c,0xff3c,0xff9e,0xffff,0xec30,0xc800,0xf534,0xffff,0xffdf,0xffff,0xf514,0xc800,
+    0xecd3,0xffff,0xffdf,0xffdf,0xd945,0xf000,0xf020,0xf020,0xe000,0xe3ae,0xffff,0xe041,0xf000,0xf020,0xd800,0xd1c7,
+    0xffff,0xfe79,0xfb8e,0xf9c7,0xf8e3,0xf0c3,0xf124,0xe2eb,0xff3c,0xd104,0xd145,0x8003,0xffff,0x0014,0xe1a6,0xc8c3,
+    0xfe9a,0xfedb,0xffff,0xffff,0xe3ef,0xe000,0xf041,0xf020,0xf000,0xd8c3,0xf618,0xe0c3,0xf000,0xf020,0xc800,0xf596,
+    0xfc92,0xf841,0x8005,0xf000,0x001b,0xe000,0xe34d,0xf492,0xc800,0xf618,0xffff,0xfeba,0xc800,0xe36d,0xf249,0xd8a2,
+    0xff7d,0xffff,0xff3c,0xd0c3,0xe800,0xf020,0xf000,0xe800,0xf0e3,0xf082,0xe800,0xe800,0xd841,0xf9c7,0xf800,0xf000,
+    0x8006,0xf020,0x0018,0xd0c3,0xfe79,0xc820,0xe34d,0xffff,0xf534,0xc800,0xec51,0xe8c3,0xe800,0xe228,0xffbe,0xffff,
+    0xf618,0xd061,0xe000,0xf020,0xf020,0xd800,0xc800,0xd124,0xd0e3,0xd800,0xf000,0x8008,0xf020,0x005c,0xd000,0xf5d7,
+    0xd9c7,0xd124,0xffff,0xeb4d,0xc841,0xf492,0xe800,0xf020,0xe800,0xe1c7,0xf5f7,0xffff,0xfeba,0xd1a6,0xe000,0xd800,
+    0xc945,0xf451,0xfc51,0xf471,0xeb6d,0xd020,0xf020,0xe000,0xd000,0xc800,0xc800,0xd000,0xd800,0xf020,0xd820,0xe492,
+    0xebef,0xc800,0xff7d,0xe269,0xd0c3,0xf410,0xe800,0xf020,0xf020,0xf000,0xe800,0xf1a6,0xfbef,0xfb2c,0xe820,0xc861,
+    0xfcb2,0xf986,0xf800,0xe000,0xeb4d,0xeb4d,0xd800,0xc8a2,0xe430,0xf5f7,0xf5f7,0xed34,0xe30c,0xd082,0xc000,0xdbae,
+    0xf4b2,0xc800,0xfeba,0xda69,0xd0e3,0xebef,0xe820,0xf020,0xf000,0xf020,0xf020,0xf000,0xf000,0xf800,0xe000,0xda08,
+    0xf32c,0xe800,0xf041,0xf000,0xd020,0xf492,0xe041,0xe882,0xfbcf,0xfdf7,0x8003,0xffff,0x000a,0xfedb,0xdaeb,0xf575,
+    0xf575,0xc800,0xf69a,0xda69,0xd0c3,0xf4b2,0xd000,0x8006,0xf020,0x000f,0xf841,0xe800,0xda49,0xeb0c,0xe000,0xf841,
+    0xe820,0xc020,0xf4d3,0xe841,0xf000,0xf000,0xe800,0xe145,0xf575,0x8004,0xffff,0x0066,0xec51,0xc800,0xfe9a,0xe2cb,
+    0xc820,0xff7d,0xe3ae,0xc800,0xd800,0xe800,0xf000,0xf000,0xe800,0xd800,0xd800,0xd882,0xf4f3,0xd145,0xc800,0xc000,
+    0xdb2c,0xfbcf,0xf000,0xf041,0xf020,0xf020,0xf000,0xe000,0xec51,0xffff,0xffbe,0xffff,0xebef,0xc800,0xfedb,0xec51,
+    0xc800,0xfeba,0xffff,0xf5f7,0xda8a,0xd0c3,0xc820,0xc800,0xc861,0xd228,0xd924,0xe800,0xe186,0xf4f3,0xec51,0xf471,
+    0xfbef,0xe841,0xc800,0xd800,0xf020,0xf000,0xf020,0xf020,0xd800,0xf5d7,0xffff,0xffff,0xe269,0xc841,0xff9e,0xf5f7,
+    0xc800,0xed14,0xffdf,0xffff,0xffff,0xff5d,0xfe59,0xfe79,0xff9e,0xfe9a,0xf8e3,0xf020,0xf000,0xe841,0xf9c7,0xf986,
+    0xf800,0xd800,0xda8a,0xe30c,0xd800,0xf020,0xf000,0xf020,0xe800,0xd145,0xffdf,0xffdf,0xd882,0xd1e7,0xffff,0xff7d,
+    0xd041,0xda69,0x8005,0xffff,0x0056,0xff7d,0xfc92,0xf8a2,0xf000,0xf020,0xf020,0xc800,0xd000,0xe800,0xf020,0xe800,
+    0xd9a6,0xffff,0xe2aa,0xe000,0xf020,0xf000,0xf020,0xd000,0xedb6,0xfe79,0xc800,0xec30,0xffff,0xffff,0xe2cb,0xc820,
+    0xff5d,0xf471,0xfa08,0xfaaa,0xfa08,0xf8c3,0xf000,0xf000,0xf020,0xf020,0xd800,0xd1c7,0xf471,0xe000,0xf020,0xf020,
+    0xd000,0xf5b6,0xff7d,0xd882,0xf000,0xf020,0xf820,0xd000,0xe3ef,0xf30c,0xc000,0xfeba,0xffff,0xffff,0xfe59,0xc800,
+    0xe38e,0xebef,0xe000,0xf800,0xf000,0xf000,0xf020,0xf020,0xf000,0xf041,0xc000,0xf5b6,0xf659,0xe800,0xf020,0xf020,
+    0xd800,0xe34d,0xffff,0xe30c,0xe800,0xf841,0xe020,0xc061,0xfc30,0xd020,0xda49,0x8004,0xffff,0x0006,0xe28a,0xc800,
+    0xf5b6,0xd9c7,0xe000,0xf041,0x8003,0xf020,0x0013,0xf041,0xc000,0xda69,0xffff,0xf4b2,0xe800,0xf020,0xf020,0xd800,
+    0xdaaa,0xffff,0xecf3,0xe820,0xe841,0xc000,0xec92,0xf249,0xc000,0xfe79,0x8004,0xffff,0x001b,0xfefb,0xd082,0xd965,
+    0xfe38,0xd0c3,0xe000,0xf041,0xf020,0xe000,0xc000,0xda28,0xff3c,0xffff,0xea28,0xf000,0xf020,0xf020,0xd800,0xdaaa,
+    0xffff,0xedb6,0xd000,0xc000,0xe410,0xfc10,0xc800,0xe3cf,0x8006,0xffff,0x001a,0xf596,0xc800,0xe228,0xf5b6,0xd124,
+    0xc800,0xc800,0xc904,0xec51,0xffdf,0xffff,0xfe18,0xf020,0xf020,0xf000,0xf020,0xd000,0xe3ef,0xffff,0xf69a,0xc945,
+    0xecf3,0xfd34,0xd000,0xd1e7,0xffbe,0x8005,0xffff,0x000d,0xffdf,0xffff,0xec92,0xc800,0xe208,0xfe38,0xed96,0xf5b6,
+    0xff7d,0xffff,0xffff,0xff5d,0xf945,0x8004,0xf020,0x0009,0xc000,0xf5f7,0xffdf,0xffff,0xffdf,0xfc51,0xd000,0xd165,
+    0xff1c,0x8007,0xffff,0x0006,0xffdf,0xffff,0xecb2,0xc800,0xd8a2,0xf596,0x8003,0xffff,0x0002,0xffdf,0xd986,0x8004,
+    0xe000,0x0009,0xc000,0xd1a6,0xffff,0xffff,0xfeba,0xf249,0xc800,0xd1e7,0xff1c,0x8009,0xffff,0x0016,0xffdf,0xffff,
+    0xf618,0xd124,0xc800,0xe186,0xf4f3,0xff5d,0xffff,0xe471,0xd208,0xd1a6,0xd1a6,0xd228,0xe34d,0xfe9a,0xfe38,0xfb2c,
+    0xd800,0xc000,0xe36d,0xffbe,0x800b,0xffff,0x0013,0xffdf,0xffff,0xff9e,0xec51,0xd0a2,0xc800,0xd820,0xea08,0xfc30,
+    0xfc92,0xfd34,0xfcd3,0xfc30,0xfb6d,0xe965,0xd800,0xc800,0xda28,0xfdf7,0x8011,0xffff,0x0004,0xff7d,0xecf3,0xda49,
+    0xd082,0x8004,0xd000,0x0005,0xc800,0xc800,0xd165,0xe38e,0xfe38,0x8012,0xffff,0x0001,0xffdf,0x8003,0xffff,0x0007,
+    0xff9e,0xfeba,0xf5f7,0xf555,0xf596,0xf638,0xff1c,0x800d,0xffff
+};
+
+const uint16_t bmp239[797]   = // Bitmap 239 (RLE, 1025 words raw)
 {
     0x2020, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xcf5f,0xa6de,0x8e7f,
-    0x7e5f,0x7e5f,0x8e9f,0xaefe,0xd77f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd75f,0x763e,0x2d5e,0x04df,
-    0x04bf,0x047f,0x047f,0x047f,0x049f,0x04bf,0x0cff,0x357e,0x865e,0xdf9f,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe79f,0x65fe,0x0cde,0x049f,
-    0x047f,0x04bf,0x253f,0x459e,0x55de,0x55de,0x3d7e,0x14ff,0x04bf,0x047f,0x049f,0x14fe,0x7e3e,0xefdf,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xaede,0x1cfe,0x049f,
-    0x049f,0x251e,0x865e,0xc73f,0xc71e,0x969e,0x763e,0x7e3e,0xc73e,0xefbf,0xb6ff,0x6e1e,0x1cfe,0x049f,0x049f,
-    0x2d3e,0xc73e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8e7e,0x049e,
-    0x049e,0x14de,0x865e,0xf7df,0xc73e,0x55be,0x0cde,0x049e,0x049e,0x047e,0x049e,0xaede,0xffff,0xffff,0xe79f,
-    0x761e,0x0cbe,0x049e,0x0cbe,0xa6de,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8e7e,
-    0x047e,0x049e,0x353e,0xd75f,0xffff,0x65de,0x047e,0x047e,0x04be,0x04be,0x04be,0x0cde,0x049e,0x457e,0xffff,
-    0xffdf,0xffff,0xffff,0xbf1e,0x24fe,0x049e,0x049e,0xaede,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xb6fe,0x049d,0x047e,0x455d,0xefbf,0xf7df,0x353d,0x045e,0x04be,0x04be,0x04be,0x04be,0x04be,0x04be,0x047e,
-    0x457e,0xffff,0xffff,0xffff,0xffff,0xffff,0xdf9f,0x2d1d,0x047e,0x0cbd,0xcf5e,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xe7be,0x1cdd,0x045e,0x351d,0xefbf,0xffff,0x65dd,0x045e,0x0cbe,0x049e,0x049e,0x049e,0x049e,0x049e,
-    0x049e,0x045e,0x7e3e,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xdf7f,0x1cdd,0x045e,0x353d,0xf7df,0xffff,
-    0xffff,0xffff,0xffff,0x6dfd,0x043d,0x0c9d,0xcf5e,0xffff,0xd75e,0x049d,0x049d,0x049d,0x049d,0x049d,0x049d,
-    0x049d,0x049d,0x049d,0x0c7d,0xd75e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb6fe,0x047d,0x045d,
-    0x967e,0xffff,0xffff,0xffff,0xdf7f,0x0c9d,0x043d,0x7e1d,0xffff,0xffff,0xa6be,0x043d,0x047d,0x047d,0x047d,
-    0x047d,0x047d,0x047d,0x047d,0x043d,0x65dd,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xf7df,0xffff,
-    0x5dbd,0x043d,0x24dd,0xf7df,0xffff,0xffff,0x861d,0x041d,0x1cbc,0xefbf,0xffff,0xffff,0xaebe,0x043d,0x047d,
-    0x047d,0x047d,0x047d,0x047d,0x047d,0x045d,0x149c,0xe79e,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xd75e,0x0c7c,0x043c,0xa6be,0xffff,0xffff,0x351c,0x03fc,0x6ddd,0xffff,0xffdf,0xffff,0xe79f,
-    0x0c7c,0x045c,0x045c,0x045c,0x045c,0x045c,0x047c,0x041c,0x75fd,0xffff,0xffdf,0xffff,0xdf7e,0x7e1d,0x453d,
-    0x3d1c,0x65bd,0xd75e,0xffff,0xffff,0x4d5c,0x03fc,0x557d,0xffff,0xdf7e,0x0c5c,0x041c,0xb6de,0xffff,0xffff,
-    0xffff,0xffff,0x965d,0x03fc,0x043c,0x045c,0x045c,0x045c,0x043c,0x0c5c,0xe77f,0xffff,0xffff,0x8e3d,0x145c,
-    0x03fc,0x041c,0x041c,0x03fc,0x145c,0xbefe,0xffff,0x8e5d,0x03fc,0x24bc,0xf7df,0xb6de,0x03fb,0x0c5c,0xe79e,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x8e3d,0x0c3b,0x03fb,0x041c,0x043c,0x043c,0x145c,0xaebd,0xf7df,0x6ddd,
-    0x03db,0x043c,0x0c3c,0x043c,0x043c,0x0c5c,0x041c,0x249c,0xf7df,0xcf3e,0x041b,0x043c,0xd75e,0x9e5d,0x03bb,
-    0x2cbb,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd75e,0x659c,0x247b,0x041b,0x043b,0x041b,0x03fb,
-    0x2cbb,0x041b,0x043b,0x043b,0x043b,0x043b,0x043b,0x043b,0x043b,0x03db,0xae9d,0xf7df,0x0c3b,0x03fb,0xbedd,
-    0x8e1d,0x039a,0x34db,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xf7df,0xffff,0xffff,0xefbf,0x8e1d,0x03db,
-    0x041b,0x041b,0x03fb,0x043b,0x041b,0x041b,0x041b,0x041b,0x041b,0x041b,0x041b,0x03da,0x657c,0xffff,0x145b,
-    0x03da,0xaebd,0x8e1d,0x039a,0x34bb,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xcf1e,0x03da,0x041b,0x03fb,0x03da,0x03da,0x041b,0x03fb,0x03fb,0x03fb,0x03fb,0x03fb,0x041b,0x03ba,0x4d1b,
-    0xf7df,0x145b,0x03ba,0xaebd,0x9e5d,0x039a,0x247b,0xf7df,0xffff,0xffff,0xffff,0xcf3e,0xb6bd,0xa67d,0xa67d,
-    0xa65d,0x85fc,0x44db,0x03da,0x03fb,0x0bfa,0x7dfc,0x659c,0x039a,0x03fa,0x03fa,0x03fa,0x03fa,0x03fa,0x03fa,
-    0x03ba,0x44fb,0xe79e,0x0c1a,0x03ba,0xbefe,0xbedd,0x039a,0x0bfa,0xdf5e,0xffff,0xae9d,0x2c5a,0x03ba,0x039a,
-    0x0399,0x039a,0x039a,0x0399,0x039a,0x03da,0x039a,0x6d7b,0xffff,0xffff,0x4cfb,0x039a,0x03fa,0x03da,0x03da,
-    0x03da,0x03da,0x0399,0x553b,0xcf1e,0x0399,0x0bfa,0xdf5e,0xe77e,0x0bfa,0x0379,0xb6bd,0xe77e,0x0399,0x0399,
-    0x03da,0x03d9,0x03d9,0x03d9,0x03da,0x03d9,0x03d9,0x03d9,0x0399,0x3c9a,0xffff,0xffff,0xe77e,0x13f9,0x03b9,
-    0x03d9,0x03b9,0x03b9,0x03da,0x0379,0x7dbc,0x9e3c,0x0359,0x2c5a,0xf7df,0xffff,0x44ba,0x0338,0x6d7b,0xb6bd,
-    0x0359,0x0bd9,0x03b9,0x03b9,0x03b9,0x03b9,0x03b9,0x03b9,0x03b9,0x03b9,0x0399,0x13f9,0xef9f,0xffff,0xffff,
-    0x8e1c,0x0358,0x03d9,0x03b9,0x03b9,0x03b9,0x0379,0xa65d,0x4cfb,0x0339,0x653b,0xffff,0xffff,0x961c,0x0338,
-    0x1bf9,0xae9d,0x0bb9,0x03b9,0x03b9,0x03b9,0x03b9,0x03b9,0x03b9,0x03b9,0x03b9,0x03b9,0x0399,0x0bb9,0xdf7e,
-    0xffff,0xffff,0xffdf,0x3c9a,0x0358,0x0bd9,0x03b9,0x0399,0x1bf9,0xa67c,0x0bb9,0x0378,0xb6bd,0xffff,0xffff,
-    0xef9e,0x1bf9,0x0338,0x757b,0x6d5b,0x0338,0x0bb9,0x0399,0x0399,0x0399,0x0399,0x0399,0x0399,0x0399,0x0399,
-    0x13d9,0xe79e,0xffff,0xffff,0xffff,0xdf7e,0x2419,0x0338,0x0378,0x0318,0x961c,0x54fa,0x0338,0x2c59,0xffdf,
-    0xffff,0xffff,0xffff,0x85db,0x0338,0x0b98,0xae9d,0x4cba,0x0318,0x0398,0x0398,0x0398,0x0398,0x0398,0x0398,
-    0x0398,0x0358,0x3459,0xffff,0xffff,0xffff,0xffff,0xffff,0xe77e,0x6d5b,0x4479,0xae7c,0x9e3c,0x0358,0x0338,
-    0xae5c,0xffff,0xffff,0xffff,0xffff,0xf7df,0x2c38,0x0318,0x23f8,0xdf5e,0x653a,0x0317,0x0358,0x0398,0x0398,
-    0x0398,0x0398,0x0b98,0x02f7,0x961c,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd71d,0x0b78,
-    0x0338,0x4cba,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xcf1d,0x0b77,0x0317,0x2bf8,0xe77e,0xae7c,0x23d8,
-    0x0317,0x0317,0x0317,0x0317,0x02f7,0x5cfa,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xbedd,
-    0x1398,0x0317,0x1bd8,0xe77e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xae7c,0x0337,0x0317,0x1b98,
-    0xbebd,0xffff,0xb67c,0x651a,0x54b9,0x64fa,0xae5c,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,
-    0x9e1c,0x0b77,0x0317,0x1377,0xcefd,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xae7c,
-    0x1357,0x02f7,0x0317,0x64fa,0xdf5e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xc6dd,0x4c99,0x0317,0x02f7,0x1bb7,0xc6fd,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffdf,0xffff,0xcf1d,0x3418,0x02f6,0x02d6,0x0337,0x4c79,0x95fb,0xc6fd,0xe77e,0xf7bf,0xf7bf,0xe77e,0xc6dd,
-    0x8ddb,0x4458,0x0337,0x02d6,0x02f7,0x4c78,0xe77e,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffdf,0xffff,0xf7df,0x8dbb,0x23b7,0x02d6,0x02b6,0x02d6,0x0317,0x1377,0x1bb8,0x1bb8,
-    0x1377,0x0316,0x02b6,0x02b6,0x02f6,0x2bf8,0xa61b,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef9f,0x9e1b,0x4c99,0x1b97,0x0316,0x02d6,
-    0x02d6,0x02d6,0x02d6,0x0337,0x23b7,0x5cb9,0xae5c,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xef9e,
-    0xcefd,0xb67c,0xa63c,0xa63c,0xb67c,0xd71d,0xf7bf,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp240[1025]   = // Bitmap 240
+    0x800b,0xffff,0x0009,0xffdf,0xcf5f,0xa6de,0x8e7f,0x7e5f,0x7e5f,0x8e9f,0xaefe,0xd77f,0x8015,0xffff,0x0005,0xd75f,
+    0x763e,0x2d5e,0x04df,0x04bf,0x8003,0x047f,0x0006,0x049f,0x04bf,0x0cff,0x357e,0x865e,0xdf9f,0x8010,0xffff,0x0012,
+    0xe79f,0x65fe,0x0cde,0x049f,0x047f,0x04bf,0x253f,0x459e,0x55de,0x55de,0x3d7e,0x14ff,0x04bf,0x047f,0x049f,0x14fe,
+    0x7e3e,0xefdf,0x800d,0xffff,0x0014,0xaede,0x1cfe,0x049f,0x049f,0x251e,0x865e,0xc73f,0xc71e,0x969e,0x763e,0x7e3e,
+    0xc73e,0xefbf,0xb6ff,0x6e1e,0x1cfe,0x049f,0x049f,0x2d3e,0xc73e,0x800b,0xffff,0x0016,0x8e7e,0x049e,0x049e,0x14de,
+    0x865e,0xf7df,0xc73e,0x55be,0x0cde,0x049e,0x049e,0x047e,0x049e,0xaede,0xffff,0xffff,0xe79f,0x761e,0x0cbe,0x049e,
+    0x0cbe,0xa6de,0x8009,0xffff,0x0009,0x8e7e,0x047e,0x049e,0x353e,0xd75f,0xffff,0x65de,0x047e,0x047e,0x8003,0x04be,
+    0x000c,0x0cde,0x049e,0x457e,0xffff,0xffdf,0xffff,0xffff,0xbf1e,0x24fe,0x049e,0x049e,0xaede,0x8007,0xffff,0x0008,
+    0xb6fe,0x049d,0x047e,0x455d,0xefbf,0xf7df,0x353d,0x045e,0x8006,0x04be,0x0002,0x047e,0x457e,0x8005,0xffff,0x0005,
+    0xdf9f,0x2d1d,0x047e,0x0cbd,0xcf5e,0x8005,0xffff,0x0009,0xe7be,0x1cdd,0x045e,0x351d,0xefbf,0xffff,0x65dd,0x045e,
+    0x0cbe,0x8006,0x049e,0x0002,0x045e,0x7e3e,0x8004,0xffff,0x0007,0xffdf,0xffff,0xdf7f,0x1cdd,0x045e,0x353d,0xf7df,
+    0x8004,0xffff,0x0006,0x6dfd,0x043d,0x0c9d,0xcf5e,0xffff,0xd75e,0x8009,0x049d,0x0002,0x0c7d,0xd75e,0x8007,0xffff,
+    0x0004,0xb6fe,0x047d,0x045d,0x967e,0x8003,0xffff,0x0008,0xdf7f,0x0c9d,0x043d,0x7e1d,0xffff,0xffff,0xa6be,0x043d,
+    0x8007,0x047d,0x0002,0x043d,0x65dd,0x8003,0xffff,0x0001,0xffdf,0x8003,0xffff,0x0010,0xf7df,0xffff,0x5dbd,0x043d,
+    0x24dd,0xf7df,0xffff,0xffff,0x861d,0x041d,0x1cbc,0xefbf,0xffff,0xffff,0xaebe,0x043d,0x8006,0x047d,0x0005,0x045d,
+    0x149c,0xe79e,0xffff,0xffdf,0x8007,0xffff,0x000e,0xd75e,0x0c7c,0x043c,0xa6be,0xffff,0xffff,0x351c,0x03fc,0x6ddd,
+    0xffff,0xffdf,0xffff,0xe79f,0x0c7c,0x8005,0x045c,0x0016,0x047c,0x041c,0x75fd,0xffff,0xffdf,0xffff,0xdf7e,0x7e1d,
+    0x453d,0x3d1c,0x65bd,0xd75e,0xffff,0xffff,0x4d5c,0x03fc,0x557d,0xffff,0xdf7e,0x0c5c,0x041c,0xb6de,0x8004,0xffff,
+    0x0003,0x965d,0x03fc,0x043c,0x8003,0x045c,0x0016,0x043c,0x0c5c,0xe77f,0xffff,0xffff,0x8e3d,0x145c,0x03fc,0x041c,
+    0x041c,0x03fc,0x145c,0xbefe,0xffff,0x8e5d,0x03fc,0x24bc,0xf7df,0xb6de,0x03fb,0x0c5c,0xe79e,0x8005,0xffff,0x001b,
+    0x8e3d,0x0c3b,0x03fb,0x041c,0x043c,0x043c,0x145c,0xaebd,0xf7df,0x6ddd,0x03db,0x043c,0x0c3c,0x043c,0x043c,0x0c5c,
+    0x041c,0x249c,0xf7df,0xcf3e,0x041b,0x043c,0xd75e,0x9e5d,0x03bb,0x2cbb,0xf7df,0x8006,0xffff,0x0009,0xd75e,0x659c,
+    0x247b,0x041b,0x043b,0x041b,0x03fb,0x2cbb,0x041b,0x8007,0x043b,0x0009,0x03db,0xae9d,0xf7df,0x0c3b,0x03fb,0xbedd,
+    0x8e1d,0x039a,0x34db,0x8005,0xffff,0x000b,0xffdf,0xf7df,0xffff,0xffff,0xefbf,0x8e1d,0x03db,0x041b,0x041b,0x03fb,
+    0x043b,0x8007,0x041b,0x0009,0x03da,0x657c,0xffff,0x145b,0x03da,0xaebd,0x8e1d,0x039a,0x34bb,0x800a,0xffff,0x0007,
+    0xcf1e,0x03da,0x041b,0x03fb,0x03da,0x03da,0x041b,0x8005,0x03fb,0x000b,0x041b,0x03ba,0x4d1b,0xf7df,0x145b,0x03ba,
+    0xaebd,0x9e5d,0x039a,0x247b,0xf7df,0x8003,0xffff,0x000d,0xcf3e,0xb6bd,0xa67d,0xa67d,0xa65d,0x85fc,0x44db,0x03da,
+    0x03fb,0x0bfa,0x7dfc,0x659c,0x039a,0x8006,0x03fa,0x001c,0x03ba,0x44fb,0xe79e,0x0c1a,0x03ba,0xbefe,0xbedd,0x039a,
+    0x0bfa,0xdf5e,0xffff,0xae9d,0x2c5a,0x03ba,0x039a,0x0399,0x039a,0x039a,0x0399,0x039a,0x03da,0x039a,0x6d7b,0xffff,
+    0xffff,0x4cfb,0x039a,0x03fa,0x8004,0x03da,0x000e,0x0399,0x553b,0xcf1e,0x0399,0x0bfa,0xdf5e,0xe77e,0x0bfa,0x0379,
+    0xb6bd,0xe77e,0x0399,0x0399,0x03da,0x8003,0x03d9,0x0001,0x03da,0x8003,0x03d9,0x0018,0x0399,0x3c9a,0xffff,0xffff,
+    0xe77e,0x13f9,0x03b9,0x03d9,0x03b9,0x03b9,0x03da,0x0379,0x7dbc,0x9e3c,0x0359,0x2c5a,0xf7df,0xffff,0x44ba,0x0338,
+    0x6d7b,0xb6bd,0x0359,0x0bd9,0x8008,0x03b9,0x0008,0x0399,0x13f9,0xef9f,0xffff,0xffff,0x8e1c,0x0358,0x03d9,0x8003,
+    0x03b9,0x000c,0x0379,0xa65d,0x4cfb,0x0339,0x653b,0xffff,0xffff,0x961c,0x0338,0x1bf9,0xae9d,0x0bb9,0x8009,0x03b9,
+    0x0019,0x0399,0x0bb9,0xdf7e,0xffff,0xffff,0xffdf,0x3c9a,0x0358,0x0bd9,0x03b9,0x0399,0x1bf9,0xa67c,0x0bb9,0x0378,
+    0xb6bd,0xffff,0xffff,0xef9e,0x1bf9,0x0338,0x757b,0x6d5b,0x0338,0x0bb9,0x8008,0x0399,0x0002,0x13d9,0xe79e,0x8003,
+    0xffff,0x000a,0xdf7e,0x2419,0x0338,0x0378,0x0318,0x961c,0x54fa,0x0338,0x2c59,0xffdf,0x8003,0xffff,0x0006,0x85db,
+    0x0338,0x0b98,0xae9d,0x4cba,0x0318,0x8007,0x0398,0x0002,0x0358,0x3459,0x8005,0xffff,0x0008,0xe77e,0x6d5b,0x4479,
+    0xae7c,0x9e3c,0x0358,0x0338,0xae5c,0x8004,0xffff,0x0008,0xf7df,0x2c38,0x0318,0x23f8,0xdf5e,0x653a,0x0317,0x0358,
+    0x8004,0x0398,0x0005,0x0b98,0x02f7,0x961c,0xffff,0xffdf,0x8006,0xffff,0x0004,0xd71d,0x0b78,0x0338,0x4cba,0x8006,
+    0xffff,0x0007,0xcf1d,0x0b77,0x0317,0x2bf8,0xe77e,0xae7c,0x23d8,0x8004,0x0317,0x0002,0x02f7,0x5cfa,0x8006,0xffff,
+    0x0007,0xffdf,0xffff,0xbedd,0x1398,0x0317,0x1bd8,0xe77e,0x8007,0xffff,0x000b,0xae7c,0x0337,0x0317,0x1b98,0xbebd,
+    0xffff,0xb67c,0x651a,0x54b9,0x64fa,0xae5c,0x8004,0xffff,0x0001,0xffdf,0x8003,0xffff,0x0005,0x9e1c,0x0b77,0x0317,
+    0x1377,0xcefd,0x8007,0xffff,0x0008,0xffdf,0xffff,0xae7c,0x1357,0x02f7,0x0317,0x64fa,0xdf5e,0x800a,0xffff,0x0006,
+    0xc6dd,0x4c99,0x0317,0x02f7,0x1bb7,0xc6fd,0x8009,0xffff,0x0018,0xffdf,0xffff,0xcf1d,0x3418,0x02f6,0x02d6,0x0337,
+    0x4c79,0x95fb,0xc6fd,0xe77e,0xf7bf,0xf7bf,0xe77e,0xc6dd,0x8ddb,0x4458,0x0337,0x02d6,0x02f7,0x4c78,0xe77e,0xffff,
+    0xffdf,0x8009,0xffff,0x0013,0xffdf,0xffff,0xf7df,0x8dbb,0x23b7,0x02d6,0x02b6,0x02d6,0x0317,0x1377,0x1bb8,0x1bb8,
+    0x1377,0x0316,0x02b6,0x02b6,0x02f6,0x2bf8,0xa61b,0x8011,0xffff,0x0005,0xef9f,0x9e1b,0x4c99,0x1b97,0x0316,0x8004,
+    0x02d6,0x0005,0x0337,0x23b7,0x5cb9,0xae5c,0xf7df,0x8011,0xffff,0x0001,0xffdf,0x8003,0xffff,0x0008,0xef9e,0xcefd,
+    0xb67c,0xa63c,0xa63c,0xb67c,0xd71d,0xf7bf,0x8003,0xffff,0x0001,0xffdf,0x8008,0xffff
+};
+
+const uint16_t bmp240[841]   = // Bitmap 240 (RLE, 1025 words raw)
 {
     0x2020, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xefbf,0xc73e,0xaede,
-    0x969e,0x969e,0x9ebe,0xbf1e,0xdf9f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xaebe,0x559d,0x1cfd,
-    0x049e,0x047e,0x047e,0x047e,0x047e,0x04be,0x0cfe,0x3d7e,0x865e,0xd77e,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xa69e,0x2cfd,0x045d,
-    0x043d,0x043d,0x049d,0x1cde,0x2d1e,0x2d1e,0x1d1e,0x0cde,0x049e,0x047f,0x049f,0x0cff,0x6e1e,0xe79f,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe79f,0x555c,0x043c,
-    0x041d,0x047d,0x455d,0x967e,0xcf3e,0xe79f,0xffff,0xffff,0xffff,0xefbf,0xc73f,0x7e3e,0x251e,0x049f,0x049f,
-    0x1d1e,0xaeff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd75e,0x249c,
-    0x03fc,0x041c,0x4d5c,0xc71e,0xffff,0xffff,0xffff,0xffff,0xcf3e,0x863e,0x65de,0x6e1e,0x8e7e,0xc73e,0xd77e,
-    0x969e,0x1d1e,0x049f,0x04df,0x867f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdf5e,
-    0x1c5b,0x03fb,0x0c3b,0x965d,0xffff,0xffff,0xffff,0xffdf,0xf7df,0x65bd,0x047d,0x045d,0x045e,0x047e,0x047e,
-    0x047e,0x1cfe,0x7e3e,0xb71e,0x4d9e,0x04bf,0x04bf,0x7e7e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xefbf,0x2c9b,0x03db,0x143b,0xbede,0xffff,0xffff,0xffff,0xffff,0xffff,0x6ddd,0x041d,0x049d,0x049d,0x049e,
-    0x049e,0x04be,0x04be,0x04bf,0x047e,0x1cfe,0xaefe,0x5dde,0x04bf,0x04bf,0xa6de,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x657c,0x03ba,0x0bfa,0xb6de,0xffff,0xffdf,0xffff,0xffff,0xffff,0xe79e,0x0c7c,0x047d,0x047d,
-    0x047d,0x049d,0x049e,0x049e,0x049e,0x04be,0x04de,0x049e,0x14de,0xdf9f,0x459e,0x04bf,0x14ff,0xdf7f,0xffff,
-    0xffff,0xffff,0xffff,0xbefd,0x03ba,0x03ba,0x861c,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xbefe,0x043c,
-    0x045c,0x047d,0x047d,0x047d,0x049d,0x049d,0x049e,0x049e,0x04be,0x04de,0x047e,0xa6be,0xefbf,0x14fe,0x049f,
-    0x55de,0xffff,0xffff,0xffff,0xffff,0x44da,0x0379,0x349a,0xf7df,0xf7df,0xffdf,0xffff,0xffff,0xffff,0xffff,
-    0xc71e,0x043c,0x045c,0x045c,0x045d,0x047d,0x047d,0x049d,0x049d,0x049e,0x04be,0x04be,0x049e,0xbf1e,0xffff,
-    0x969e,0x049f,0x04de,0xcf5e,0xffff,0xffff,0xcf1e,0x03b9,0x0379,0xae7d,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xefbf,0x147c,0x043c,0x045c,0x045c,0x045c,0x047d,0x047d,0x049d,0x049d,0x047e,0x047d,0x865e,
-    0xffff,0xffff,0xf7df,0x2d3e,0x047f,0x6e1e,0xffff,0xffff,0x7dbb,0x0338,0x245a,0xf7df,0x9e3c,0x655b,0x963c,
-    0xefbe,0xffff,0xffff,0xffff,0xffff,0x5d7c,0x03fb,0x045c,0x045c,0x045c,0x047d,0x045d,0x043d,0x047d,0x3d3d,
-    0xb6fe,0xffff,0xffff,0xffff,0xffff,0x865e,0x047e,0x253e,0xf7df,0xffff,0x44ba,0x0318,0x759b,0x8e1c,0x0338,
-    0x0399,0x0379,0x1c1a,0xa67d,0xffff,0xffdf,0xffff,0xd75e,0x0c1b,0x043c,0x043c,0x043c,0x041c,0x1c9c,0x6ddd,
-    0xc71e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xcf3e,0x04be,0x04be,0xc73f,0xefbf,0x1bf9,0x0338,0x961c,
-    0x2439,0x0399,0x0bd9,0x03d9,0x03ba,0x039a,0x75bc,0xffff,0xffff,0xffff,0x965d,0x03fb,0x043c,0x0c5c,0x75dd,
-    0xe79f,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0x251e,0x047e,0x969e,0xdf5e,0x0b78,
-    0x0398,0x961c,0x13d9,0x0399,0x03b9,0x03b9,0x03d9,0x03da,0x039a,0x4cfb,0xdf7e,0xffff,0x8e1d,0x03fb,0x041b,
-    0x1c7b,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x457e,0x045e,0x7e3e,
-    0xcf1d,0x0357,0x0b98,0xa65c,0x0bb8,0x0399,0x03b9,0x0399,0x03b9,0x03b9,0x03da,0x039a,0x141a,0x6d9c,0x141a,
-    0x03fb,0x043b,0x03db,0x75dd,0xbefe,0xaebe,0xbefe,0xdf7e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x4d9e,
-    0x043e,0x6dfe,0xcf1d,0x0357,0x0b78,0xbebd,0x1bf9,0x0378,0x0399,0x03b9,0x0399,0x03b9,0x03b9,0x03da,0x03ba,
-    0x039a,0x03fa,0x03fb,0x041b,0x041b,0x041b,0x03fb,0x03fb,0x041c,0x0c5c,0x4d3d,0xc71e,0xffff,0xffff,0xffff,
-    0xffff,0x4d9e,0x043e,0x6dfe,0xdf3e,0x0b77,0x0337,0xc6fd,0x4cba,0x0338,0x0398,0x0399,0x03b9,0x03b9,0x03b9,
-    0x03b9,0x03d9,0x03da,0x03da,0x03da,0x03da,0x03fb,0x041b,0x043b,0x043b,0x043c,0x043c,0x041c,0x0c3c,0xb6de,
-    0xffff,0xffff,0xffff,0x3d5d,0x043d,0x7e3e,0xefbe,0x1bb8,0x02d6,0xb67c,0x95fc,0x0317,0x0398,0x0398,0x0399,
-    0x03b9,0x03b9,0x03b9,0x03b9,0x03b9,0x1c3a,0xcf1e,0xb6dd,0x143b,0x03fb,0x041b,0x041b,0x043b,0x043c,0x0c5c,
-    0x041c,0x1cbc,0xefbf,0xffff,0xf7df,0x24dd,0x043d,0x9e9e,0xffff,0x4479,0x02b6,0x6d5a,0xef9e,0x0357,0x0378,
-    0x0378,0x0398,0x0398,0x03b9,0x03b9,0x03b9,0x0359,0x85dc,0xffff,0xffff,0x2c9b,0x03da,0x03fb,0x041b,0x041b,
-    0x043b,0x043c,0x043c,0x041c,0xbefe,0xffff,0xc73e,0x045d,0x045d,0xc73e,0xffff,0x7d9b,0x02d6,0x23d8,0xffff,
-    0x755a,0x02f7,0x0b98,0x0378,0x0398,0x0398,0x0bb9,0x0378,0x2c5a,0xf7df,0xffff,0xf7df,0x245a,0x03ba,0x03fa,
-    0x03fb,0x041b,0x041b,0x043b,0x043c,0x041c,0xb6de,0xffff,0x7e1d,0x041c,0x24dd,0xf7df,0xffff,0xcf1d,0x0337,
-    0x02f6,0xae5c,0xffdf,0x3c59,0x02f7,0x0378,0x0378,0x0378,0x0338,0x1bf9,0xd73e,0xffff,0xffff,0xe79e,0x13fa,
-    0x03da,0x03fa,0x03fa,0x03fb,0x03fb,0x041b,0x041b,0x043b,0xdf7e,0xffff,0x24bc,0x03fc,0x6ddd,0xffff,0xffff,
-    0xffff,0x4c79,0x02d6,0x2bf8,0xffdf,0xf7bf,0x6d3a,0x1398,0x0357,0x0b98,0x54da,0xdf7e,0xffff,0xffdf,0xffff,
-    0xc71e,0x0399,0x03da,0x03da,0x03da,0x03fa,0x03fb,0x041b,0x03db,0x3cdb,0xffff,0x8e5d,0x03fc,0x0c5c,0xcf3e,
-    0xffff,0xffff,0xffff,0xc6dd,0x0316,0x02f6,0x7d9b,0xffff,0xffff,0xe77e,0xcefd,0xe77e,0xffff,0xffff,0xffff,
-    0xffdf,0xffff,0xae7d,0x0378,0x03b9,0x03b9,0x03da,0x03da,0x03fa,0x03fb,0x03ba,0xc6fe,0xe79f,0x145b,0x03dc,
-    0x659c,0xffff,0xffff,0xffff,0xffff,0xffff,0x6519,0x02d6,0x0337,0xb67c,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffdf,0xffff,0x9e3c,0x0358,0x03b9,0x03b9,0x03b9,0x03da,0x03fa,0x037a,0x85fc,0xffff,0x34bb,
-    0x03db,0x145b,0xe79f,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0x2bf8,0x02d6,0x0b57,0xb69d,0xffff,0xffdf,
-    0xffdf,0xffff,0xffff,0xffff,0xffdf,0xffff,0xae7c,0x0358,0x03b9,0x03b9,0x03b9,0x03b9,0x0359,0x759c,0xffff,
-    0x44fb,0x03ba,0x03da,0xaebd,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdf3e,0x1b97,0x02d6,0x0b37,
-    0x8ddb,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xe79e,0x13b8,0x0358,0x0379,0x0358,0x0bb9,0x961c,
-    0xdf5e,0x349a,0x039a,0x03ba,0x8e1c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xd73e,
-    0x2bd7,0x02d6,0x02f6,0x4458,0xbebd,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xbebd,0x4479,0x3459,0x653b,
-    0xae7c,0x8dfc,0x0bd9,0x0379,0x03b9,0x8e1c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xef9e,0x54b9,0x02f6,0x02b6,0x0317,0x3c58,0x8ddb,0xc6dd,0xe77e,0xf7bf,0xf7df,0xf7df,0xd73e,
-    0x9e3c,0x6d5b,0x2419,0x0338,0x0359,0x2419,0xb6bd,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xae5c,0x3418,0x02f6,0x02b6,0x02d6,0x0337,0x1398,0x23d8,0x23f8,
-    0x1bb8,0x0b78,0x0338,0x02f8,0x0318,0x13d9,0x759b,0xef9e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xb67c,0x5cd9,0x23b7,0x0337,0x02f7,
-    0x02d7,0x02d6,0x02f7,0x0337,0x13b8,0x4479,0x8ddb,0xe77e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xf7bf,
-    0xcf1d,0xb67c,0xa63c,0x9e1c,0xa65c,0xc6dd,0xe77e,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff
-};
-
-const uint16_t bmp241[1025]   = // Bitmap 241
+    0x800c,0xffff,0x0008,0xefbf,0xc73e,0xaede,0x969e,0x969e,0x9ebe,0xbf1e,0xdf9f,0x8015,0xffff,0x0005,0xf7df,0xaebe,
+    0x559d,0x1cfd,0x049e,0x8004,0x047e,0x0005,0x04be,0x0cfe,0x3d7e,0x865e,0xd77e,0x8011,0xffff,0x0011,0xa69e,0x2cfd,
+    0x045d,0x043d,0x043d,0x049d,0x1cde,0x2d1e,0x2d1e,0x1d1e,0x0cde,0x049e,0x047f,0x049f,0x0cff,0x6e1e,0xe79f,0x800d,
+    0xffff,0x0009,0xe79f,0x555c,0x043c,0x041d,0x047d,0x455d,0x967e,0xcf3e,0xe79f,0x8003,0xffff,0x0008,0xefbf,0xc73f,
+    0x7e3e,0x251e,0x049f,0x049f,0x1d1e,0xaeff,0x800b,0xffff,0x0006,0xd75e,0x249c,0x03fc,0x041c,0x4d5c,0xc71e,0x8004,
+    0xffff,0x000c,0xcf3e,0x863e,0x65de,0x6e1e,0x8e7e,0xc73e,0xd77e,0x969e,0x1d1e,0x049f,0x04df,0x867f,0x8009,0xffff,
+    0x0005,0xdf5e,0x1c5b,0x03fb,0x0c3b,0x965d,0x8003,0xffff,0x0006,0xffdf,0xf7df,0x65bd,0x047d,0x045d,0x045e,0x8003,
+    0x047e,0x0007,0x1cfe,0x7e3e,0xb71e,0x4d9e,0x04bf,0x04bf,0x7e7e,0x8007,0xffff,0x0005,0xefbf,0x2c9b,0x03db,0x143b,
+    0xbede,0x8005,0xffff,0x0010,0x6ddd,0x041d,0x049d,0x049d,0x049e,0x049e,0x04be,0x04be,0x04bf,0x047e,0x1cfe,0xaefe,
+    0x5dde,0x04bf,0x04bf,0xa6de,0x8006,0xffff,0x0006,0x657c,0x03ba,0x0bfa,0xb6de,0xffff,0xffdf,0x8003,0xffff,0x0002,
+    0xe79e,0x0c7c,0x8003,0x047d,0x0001,0x049d,0x8003,0x049e,0x0009,0x04be,0x04de,0x049e,0x14de,0xdf9f,0x459e,0x04bf,
+    0x14ff,0xdf7f,0x8004,0xffff,0x0006,0xbefd,0x03ba,0x03ba,0x861c,0xffff,0xffdf,0x8004,0xffff,0x0003,0xbefe,0x043c,
+    0x045c,0x8003,0x047d,0x000c,0x049d,0x049d,0x049e,0x049e,0x04be,0x04de,0x047e,0xa6be,0xefbf,0x14fe,0x049f,0x55de,
+    0x8004,0xffff,0x0006,0x44da,0x0379,0x349a,0xf7df,0xf7df,0xffdf,0x8004,0xffff,0x0019,0xc71e,0x043c,0x045c,0x045c,
+    0x045d,0x047d,0x047d,0x049d,0x049d,0x049e,0x04be,0x04be,0x049e,0xbf1e,0xffff,0x969e,0x049f,0x04de,0xcf5e,0xffff,
+    0xffff,0xcf1e,0x03b9,0x0379,0xae7d,0x8007,0xffff,0x0003,0xefbf,0x147c,0x043c,0x8003,0x045c,0x0017,0x047d,0x047d,
+    0x049d,0x049d,0x047e,0x047d,0x865e,0xffff,0xffff,0xf7df,0x2d3e,0x047f,0x6e1e,0xffff,0xffff,0x7dbb,0x0338,0x245a,
+    0xf7df,0x9e3c,0x655b,0x963c,0xefbe,0x8004,0xffff,0x0002,0x5d7c,0x03fb,0x8003,0x045c,0x0006,0x047d,0x045d,0x043d,
+    0x047d,0x3d3d,0xb6fe,0x8004,0xffff,0x0013,0x865e,0x047e,0x253e,0xf7df,0xffff,0x44ba,0x0318,0x759b,0x8e1c,0x0338,
+    0x0399,0x0379,0x1c1a,0xa67d,0xffff,0xffdf,0xffff,0xd75e,0x0c1b,0x8003,0x043c,0x0004,0x041c,0x1c9c,0x6ddd,0xc71e,
+    0x8006,0xffff,0x000f,0xcf3e,0x04be,0x04be,0xc73f,0xefbf,0x1bf9,0x0338,0x961c,0x2439,0x0399,0x0bd9,0x03d9,0x03ba,
+    0x039a,0x75bc,0x8003,0xffff,0x0006,0x965d,0x03fb,0x043c,0x0c5c,0x75dd,0xe79f,0x8008,0xffff,0x0017,0xf7df,0x251e,
+    0x047e,0x969e,0xdf5e,0x0b78,0x0398,0x961c,0x13d9,0x0399,0x03b9,0x03b9,0x03d9,0x03da,0x039a,0x4cfb,0xdf7e,0xffff,
+    0x8e1d,0x03fb,0x041b,0x1c7b,0xffdf,0x800a,0xffff,0x001a,0x457e,0x045e,0x7e3e,0xcf1d,0x0357,0x0b98,0xa65c,0x0bb8,
+    0x0399,0x03b9,0x0399,0x03b9,0x03b9,0x03da,0x039a,0x141a,0x6d9c,0x141a,0x03fb,0x043b,0x03db,0x75dd,0xbefe,0xaebe,
+    0xbefe,0xdf7e,0x8006,0xffff,0x0013,0x4d9e,0x043e,0x6dfe,0xcf1d,0x0357,0x0b78,0xbebd,0x1bf9,0x0378,0x0399,0x03b9,
+    0x0399,0x03b9,0x03b9,0x03da,0x03ba,0x039a,0x03fa,0x03fb,0x8003,0x041b,0x0006,0x03fb,0x03fb,0x041c,0x0c5c,0x4d3d,
+    0xc71e,0x8004,0xffff,0x000b,0x4d9e,0x043e,0x6dfe,0xdf3e,0x0b77,0x0337,0xc6fd,0x4cba,0x0338,0x0398,0x0399,0x8004,
+    0x03b9,0x0001,0x03d9,0x8004,0x03da,0x0009,0x03fb,0x041b,0x043b,0x043b,0x043c,0x043c,0x041c,0x0c3c,0xb6de,0x8003,
+    0xffff,0x000c,0x3d5d,0x043d,0x7e3e,0xefbe,0x1bb8,0x02d6,0xb67c,0x95fc,0x0317,0x0398,0x0398,0x0399,0x8005,0x03b9,
+    0x001c,0x1c3a,0xcf1e,0xb6dd,0x143b,0x03fb,0x041b,0x041b,0x043b,0x043c,0x0c5c,0x041c,0x1cbc,0xefbf,0xffff,0xf7df,
+    0x24dd,0x043d,0x9e9e,0xffff,0x4479,0x02b6,0x6d5a,0xef9e,0x0357,0x0378,0x0378,0x0398,0x0398,0x8003,0x03b9,0x003b,
+    0x0359,0x85dc,0xffff,0xffff,0x2c9b,0x03da,0x03fb,0x041b,0x041b,0x043b,0x043c,0x043c,0x041c,0xbefe,0xffff,0xc73e,
+    0x045d,0x045d,0xc73e,0xffff,0x7d9b,0x02d6,0x23d8,0xffff,0x755a,0x02f7,0x0b98,0x0378,0x0398,0x0398,0x0bb9,0x0378,
+    0x2c5a,0xf7df,0xffff,0xf7df,0x245a,0x03ba,0x03fa,0x03fb,0x041b,0x041b,0x043b,0x043c,0x041c,0xb6de,0xffff,0x7e1d,
+    0x041c,0x24dd,0xf7df,0xffff,0xcf1d,0x0337,0x02f6,0xae5c,0xffdf,0x3c59,0x02f7,0x8003,0x0378,0x0014,0x0338,0x1bf9,
+    0xd73e,0xffff,0xffff,0xe79e,0x13fa,0x03da,0x03fa,0x03fa,0x03fb,0x03fb,0x041b,0x041b,0x043b,0xdf7e,0xffff,0x24bc,
+    0x03fc,0x6ddd,0x8003,0xffff,0x0010,0x4c79,0x02d6,0x2bf8,0xffdf,0xf7bf,0x6d3a,0x1398,0x0357,0x0b98,0x54da,0xdf7e,
+    0xffff,0xffdf,0xffff,0xc71e,0x0399,0x8003,0x03da,0x000a,0x03fa,0x03fb,0x041b,0x03db,0x3cdb,0xffff,0x8e5d,0x03fc,
+    0x0c5c,0xcf3e,0x8003,0xffff,0x0009,0xc6dd,0x0316,0x02f6,0x7d9b,0xffff,0xffff,0xe77e,0xcefd,0xe77e,0x8003,0xffff,
+    0x0010,0xffdf,0xffff,0xae7d,0x0378,0x03b9,0x03b9,0x03da,0x03da,0x03fa,0x03fb,0x03ba,0xc6fe,0xe79f,0x145b,0x03dc,
+    0x659c,0x8005,0xffff,0x0004,0x6519,0x02d6,0x0337,0xb67c,0x8007,0xffff,0x0004,0xffdf,0xffff,0x9e3c,0x0358,0x8003,
+    0x03b9,0x0009,0x03da,0x03fa,0x037a,0x85fc,0xffff,0x34bb,0x03db,0x145b,0xe79f,0x8005,0xffff,0x0008,0xf7bf,0x2bf8,
+    0x02d6,0x0b57,0xb69d,0xffff,0xffdf,0xffdf,0x8003,0xffff,0x0004,0xffdf,0xffff,0xae7c,0x0358,0x8004,0x03b9,0x0007,
+    0x0359,0x759c,0xffff,0x44fb,0x03ba,0x03da,0xaebd,0x8007,0xffff,0x0005,0xdf3e,0x1b97,0x02d6,0x0b37,0x8ddb,0x8003,
+    0xffff,0x0001,0xffdf,0x8003,0xffff,0x000c,0xe79e,0x13b8,0x0358,0x0379,0x0358,0x0bb9,0x961c,0xdf5e,0x349a,0x039a,
+    0x03ba,0x8e1c,0x8009,0xffff,0x0006,0xd73e,0x2bd7,0x02d6,0x02f6,0x4458,0xbebd,0x8006,0xffff,0x000a,0xbebd,0x4479,
+    0x3459,0x653b,0xae7c,0x8dfc,0x0bd9,0x0379,0x03b9,0x8e1c,0x800b,0xffff,0x0014,0xef9e,0x54b9,0x02f6,0x02b6,0x0317,
+    0x3c58,0x8ddb,0xc6dd,0xe77e,0xf7bf,0xf7df,0xf7df,0xd73e,0x9e3c,0x6d5b,0x2419,0x0338,0x0359,0x2419,0xb6bd,0x800e,
+    0xffff,0x0011,0xae5c,0x3418,0x02f6,0x02b6,0x02d6,0x0337,0x1398,0x23d8,0x23f8,0x1bb8,0x0b78,0x0338,0x02f8,0x0318,
+    0x13d9,0x759b,0xef9e,0x8011,0xffff,0x000d,0xb67c,0x5cd9,0x23b7,0x0337,0x02f7,0x02d7,0x02d6,0x02f7,0x0337,0x13b8,
+    0x4479,0x8ddb,0xe77e,0x8011,0xffff,0x0001,0xffdf,0x8003,0xffff,0x0008,0xf7bf,0xcf1d,0xb67c,0xa63c,0x9e1c,0xa65c,
+    0xc6dd,0xe77e,0x8003,0xffff,0x0001,0xffdf,0x8008,0xffff
+};
+
+const uint16_t bmp241[827]   = // Bitmap 241 (RLE, 1025 words raw)
 {
     0x2020, // Width and height
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xf7df,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xefbf,0xb6bd,0x75bc,
-    0x4d1b,0x34dc,0x24bc,0x24bc,0x34fc,0x557d,0x863e,0xc71e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xdf7e,0x759b,0x1c3a,
-    0x03ba,0x037a,0x039a,0x03bb,0x03db,0x03db,0x03fc,0x03fc,0x041d,0x047d,0x351d,0x967e,0xf7df,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8dfc,0x13d9,
-    0x0359,0x0379,0x0bfa,0x3cdb,0x6d9c,0x963d,0xa67d,0x9e7d,0x863d,0x5dbd,0x2cfd,0x045d,0x043d,0x045e,0x2d1e,
-    0xb6fe,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xef9f,0x4cb9,
-    0x0358,0x0359,0x1bf9,0x7dbc,0xd73e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7df,0xbefe,0x5dbd,
-    0x049d,0x047e,0x049e,0x761e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe77e,
-    0x3438,0x0338,0x0378,0x6d7b,0xe77e,0xffff,0xffff,0xffff,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffdf,0xffff,
-    0xffff,0xffff,0xc71e,0x353d,0x049e,0x049e,0x5dde,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xf7bf,0x3438,0x0318,0x0b98,0x961c,0x961c,0x3c7a,0x3c9a,0xc6fd,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x5dde,0x049e,0x049f,0x6e1e,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0x5cfa,0x0317,0x0358,0xa65c,0x653a,0x0338,0x0399,0x0379,0x141a,0xe79e,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xefbf,0x863d,0x455d,0x455d,0x761e,0xdf7f,0xffff,0x65fe,0x049f,0x04be,0x9ebe,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xae7c,0x0317,0x0317,0x8dfb,0x8e1c,0x0318,0x0bb9,0x03b9,0x0bd9,0x0379,0x7ddc,0xffff,
-    0xffdf,0xffff,0xffff,0xe79f,0x34dc,0x041c,0x045d,0x045d,0x045d,0x0c9d,0x8e7e,0xffff,0x459e,0x049f,0x14fe,
-    0xdf9f,0xffff,0xffff,0xffff,0xf7df,0x2c18,0x02d7,0x4499,0xdf5e,0x0b78,0x0399,0x03b9,0x03b9,0x03b9,0x039a,
-    0x349b,0xffff,0xffff,0xffff,0xffff,0x555c,0x03fc,0x0c7d,0x047d,0x049d,0x049e,0x049e,0x045e,0x8e7e,0xefdf,
-    0x14fe,0x049f,0x661e,0xffff,0xffff,0xffff,0xae5c,0x02f7,0x0337,0xd71d,0x7d9b,0x0318,0x0399,0x03b9,0x03b9,
-    0x03b9,0x03ba,0x0bfa,0xe79f,0xffff,0xffff,0xc71e,0x041b,0x045c,0x045c,0x047d,0x047d,0x049d,0x049e,0x04be,
-    0x047e,0xbf1e,0x969e,0x049f,0x0d1f,0xdf9f,0xffff,0xffff,0x4c99,0x02b6,0x4c99,0xffdf,0x1bd8,0x0358,0x0398,
-    0x0399,0x03b9,0x03b9,0x03da,0x03ba,0xc6fe,0xffff,0xffff,0x7dfd,0x03fb,0x045c,0x045c,0x047d,0x047d,0x049d,
-    0x049e,0x04be,0x049e,0x1d1e,0xd77f,0x1d1f,0x049f,0x8e9e,0xffff,0xef9e,0x1397,0x02d6,0xae5c,0xcf1e,0x0337,
-    0x0378,0x0398,0x0399,0x03b9,0x03b9,0x03da,0x039a,0x963d,0xffff,0xffff,0x4d3c,0x03fb,0x045c,0x045c,0x047d,
-    0x047d,0x049d,0x049e,0x049e,0x04be,0x047e,0x867e,0x6e1e,0x047f,0x45bf,0xffff,0xbebc,0x02f6,0x0337,0xef9e,
-    0xa65c,0x0317,0x0398,0x0398,0x0399,0x03b9,0x03b9,0x03d9,0x039a,0x44db,0xffff,0xffff,0x34dc,0x03fc,0x045c,
-    0x045c,0x045d,0x047d,0x049d,0x049e,0x049e,0x04be,0x049e,0x2d5e,0x969e,0x049f,0x1d3f,0xefbf,0x95fb,0x02b6,
-    0x23d8,0xffff,0xa63c,0x0317,0x0378,0x0378,0x0399,0x03b9,0x03b9,0x03b9,0x03da,0x0bfa,0x7ddc,0x4d1c,0x0c3b,
-    0x041c,0x043c,0x045c,0x047d,0x047d,0x047d,0x049d,0x049e,0x04be,0x04be,0x0cde,0x9ebe,0x0cff,0x04df,0xd77f,
-    0x7d9a,0x0296,0x3c38,0xffff,0xc6fd,0x0337,0x0378,0x0378,0x0398,0x03b9,0x03b9,0x03b9,0x03da,0x03fa,0x03ba,
-    0x03da,0x041b,0x043b,0x0c5c,0x045c,0x041c,0x043d,0x047d,0x049d,0x049e,0x04be,0x04be,0x04be,0xb6fe,0x1d1e,
-    0x04bf,0xbf3f,0x7d7a,0x0296,0x4479,0xffff,0xffdf,0x3438,0x0317,0x0b98,0x0398,0x03b9,0x03b9,0x03b9,0x03b9,
-    0x039a,0x03fb,0x041b,0x041b,0x041b,0xbede,0xd75e,0x9e7e,0x557d,0x0c9d,0x045d,0x045e,0x047e,0x045e,0x4d9e,
-    0xe7bf,0x151f,0x04bf,0xb71f,0x7d9a,0x0296,0x3c58,0xffff,0xffff,0xd71e,0x23d8,0x0317,0x0358,0x0358,0x0358,
-    0x0379,0x1c1a,0x6d7c,0x0c1a,0x03fb,0x03fb,0x249b,0xffff,0xffff,0xffff,0xffff,0xe79f,0xa69e,0x6dfe,0x5dde,
-    0x865e,0xefbf,0xe79f,0x0cff,0x04bf,0xbf1f,0x9e1b,0x02b6,0x23d8,0xf7df,0xffff,0xffff,0xef9f,0x8ddb,0x54da,
-    0x4cda,0x6d5b,0xa65d,0xef9f,0xffff,0xae9d,0x03fa,0x041b,0x0c3b,0x6d9c,0xf7df,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xc73f,0x04bf,0x04df,0xcf5f,0xbebd,0x02f6,0x0b37,0xd73e,0xffff,0xffdf,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x861c,0x03da,0x041b,0x041b,0x03db,0x3d1c,0xefbf,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xf7df,0xffff,0x9ebe,0x049f,0x1d3e,0xefbf,0xef9e,0x1397,0x02d6,0x9e1c,0xffff,
-    0xffdf,0xffff,0xffdf,0xffff,0xffff,0xffdf,0xf7df,0xffff,0x9e5c,0x03ba,0x03fb,0x041b,0x041b,0x0c3c,0x03fc,
-    0x4d5c,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x5dde,0x047f,0x4dbe,0xffff,0xffff,0x5499,0x02b6,
-    0x4479,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x8dfc,0x0399,0x03da,0x03fa,0x03fb,0x041b,
-    0x043b,0x0c3c,0x041c,0xaebe,0xffff,0xffff,0xffff,0xffff,0xffff,0xe79f,0x14fe,0x049f,0x969e,0xffff,0xffff,
-    0xae7c,0x02f6,0x0317,0xc6dd,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0x759b,0x0358,0x03da,0x03da,0x03fa,
-    0x03fb,0x041b,0x043b,0x043c,0x041c,0x4d5d,0xffff,0xffff,0xffff,0xffff,0xffff,0x7e3e,0x047e,0x14fe,0xe79f,
-    0xffff,0xffff,0xffdf,0x2bf8,0x02d6,0x3c38,0xffff,0xffff,0xffff,0xffff,0xffff,0x8dfb,0x0338,0x03b9,0x03b9,
-    0x03da,0x03fa,0x03fb,0x041b,0x043b,0x043c,0x041c,0x34fc,0xffff,0xffff,0xffff,0xffff,0xdf7f,0x14de,0x047e,
-    0x6e1e,0xffff,0xffff,0xffff,0xffff,0xb67c,0x02f6,0x0317,0x7d9a,0xffff,0xf7df,0xffff,0xdf5e,0x0b98,0x0399,
-    0x03b9,0x03b9,0x03da,0x03fa,0x03fb,0x041b,0x043b,0x043c,0x041c,0x453c,0xffff,0xffff,0xffff,0xffff,0x457d,
-    0x047e,0x14fe,0xe79e,0xffff,0xffff,0xffff,0xffff,0xffff,0x64f9,0x02d6,0x0337,0x9e1c,0xffff,0xffff,0x961c,
-    0x0358,0x03b9,0x0399,0x03b9,0x03da,0x03fa,0x03fb,0x041b,0x043b,0x0c3c,0x03fc,0xa69d,0xffff,0xffff,0xffff,
-    0x65de,0x047e,0x047e,0xa6be,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xf7bf,0x3c38,0x02f7,0x0337,0x8dbb,
-    0xffff,0xc6dd,0x0338,0x0399,0x03b9,0x03d9,0x03da,0x03fa,0x041b,0x041b,0x03fb,0x03db,0x6ddd,0xffff,0xffff,
-    0xf7df,0x5d9d,0x047d,0x045e,0x761e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe79e,0x3418,
-    0x02f7,0x0337,0x54da,0xdf5e,0x8dfb,0x0b98,0x0358,0x0359,0x0379,0x037a,0x039a,0x03da,0x2c9b,0xa67d,0xffff,
-    0xffff,0xbefe,0x34fd,0x045d,0x045d,0x65de,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xefbe,0x54b9,0x0317,0x0317,0x13b8,0x7dbb,0x9e3c,0x8dfc,0x7dbc,0x75bc,0x85fc,0xa67d,0xd75e,0xffff,
-    0xffff,0xbede,0x557d,0x045c,0x041d,0x045d,0x7e1e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0x95fb,0x1bb8,0x0317,0x0318,0x0bb9,0x44ba,0x759c,0x963c,0xae9d,0xa69d,
-    0x8e1d,0x5d5c,0x249b,0x041b,0x03fc,0x041c,0x34fc,0xbefe,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xe77e,0x7d7b,0x23f9,0x0358,0x0318,0x0318,0x0339,
-    0x0359,0x037a,0x037a,0x039a,0x03bb,0x041c,0x3cfc,0x9e7d,0xf7df,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffdf,0xffff,0xffff,0xf7be,0xb6bd,0x7dbb,
-    0x4cfb,0x349a,0x2c7a,0x2c7b,0x3cdb,0x5d5b,0x8e1d,0xcf1e,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
-    0xffff,0xffff,0xffff,0xffff
+    0x8009,0xffff,0x0001,0xffdf,0x8005,0xffff,0x0002,0xf7df,0xf7df,0x8016,0xffff,0x000e,0xffdf,0xffff,0xffff,0xefbf,
+    0xb6bd,0x75bc,0x4d1b,0x34dc,0x24bc,0x24bc,0x34fc,0x557d,0x863e,0xc71e,0x8013,0xffff,0x0010,0xdf7e,0x759b,0x1c3a,
+    0x03ba,0x037a,0x039a,0x03bb,0x03db,0x03db,0x03fc,0x03fc,0x041d,0x047d,0x351d,0x967e,0xf7df,0x800f,0xffff,0x0012,
+    0x8dfc,0x13d9,0x0359,0x0379,0x0bfa,0x3cdb,0x6d9c,0x963d,0xa67d,0x9e7d,0x863d,0x5dbd,0x2cfd,0x045d,0x043d,0x045e,
+    0x2d1e,0xb6fe,0x800c,0xffff,0x0007,0xef9f,0x4cb9,0x0358,0x0359,0x1bf9,0x7dbc,0xd73e,0x8007,0xffff,0x0007,0xf7df,
+    0xbefe,0x5dbd,0x049d,0x047e,0x049e,0x761e,0x800a,0xffff,0x0006,0xe77e,0x3438,0x0338,0x0378,0x6d7b,0xe77e,0x8003,
+    0xffff,0x8006,0xffdf,0x8003,0xffff,0x0005,0xc71e,0x353d,0x049e,0x049e,0x5dde,0x8008,0xffff,0x0009,0xf7bf,0x3438,
+    0x0318,0x0b98,0x961c,0x961c,0x3c7a,0x3c9a,0xc6fd,0x800c,0xffff,0x0004,0x5dde,0x049e,0x049f,0x6e1e,0x8007,0xffff,
+    0x000a,0x5cfa,0x0317,0x0358,0xa65c,0x653a,0x0338,0x0399,0x0379,0x141a,0xe79e,0x8005,0xffff,0x000b,0xefbf,0x863d,
+    0x455d,0x455d,0x761e,0xdf7f,0xffff,0x65fe,0x049f,0x04be,0x9ebe,0x8005,0xffff,0x0012,0xae7c,0x0317,0x0317,0x8dfb,
+    0x8e1c,0x0318,0x0bb9,0x03b9,0x0bd9,0x0379,0x7ddc,0xffff,0xffdf,0xffff,0xffff,0xe79f,0x34dc,0x041c,0x8003,0x045d,
+    0x0007,0x0c9d,0x8e7e,0xffff,0x459e,0x049f,0x14fe,0xdf9f,0x8003,0xffff,0x0007,0xf7df,0x2c18,0x02d7,0x4499,0xdf5e,
+    0x0b78,0x0399,0x8003,0x03b9,0x0002,0x039a,0x349b,0x8004,0xffff,0x000d,0x555c,0x03fc,0x0c7d,0x047d,0x049d,0x049e,
+    0x049e,0x045e,0x8e7e,0xefdf,0x14fe,0x049f,0x661e,0x8003,0xffff,0x0007,0xae5c,0x02f7,0x0337,0xd71d,0x7d9b,0x0318,
+    0x0399,0x8003,0x03b9,0x007e,0x03ba,0x0bfa,0xe79f,0xffff,0xffff,0xc71e,0x041b,0x045c,0x045c,0x047d,0x047d,0x049d,
+    0x049e,0x04be,0x047e,0xbf1e,0x969e,0x049f,0x0d1f,0xdf9f,0xffff,0xffff,0x4c99,0x02b6,0x4c99,0xffdf,0x1bd8,0x0358,
+    0x0398,0x0399,0x03b9,0x03b9,0x03da,0x03ba,0xc6fe,0xffff,0xffff,0x7dfd,0x03fb,0x045c,0x045c,0x047d,0x047d,0x049d,
+    0x049e,0x04be,0x049e,0x1d1e,0xd77f,0x1d1f,0x049f,0x8e9e,0xffff,0xef9e,0x1397,0x02d6,0xae5c,0xcf1e,0x0337,0x0378,
+    0x0398,0x0399,0x03b9,0x03b9,0x03da,0x039a,0x963d,0xffff,0xffff,0x4d3c,0x03fb,0x045c,0x045c,0x047d,0x047d,0x049d,
+    0x049e,0x049e,0x04be,0x047e,0x867e,0x6e1e,0x047f,0x45bf,0xffff,0xbebc,0x02f6,0x0337,0xef9e,0xa65c,0x0317,0x0398,
+    0x0398,0x0399,0x03b9,0x03b9,0x03d9,0x039a,0x44db,0xffff,0xffff,0x34dc,0x03fc,0x045c,0x045c,0x045d,0x047d,0x049d,
+    0x049e,0x049e,0x04be,0x049e,0x2d5e,0x969e,0x049f,0x1d3f,0xefbf,0x95fb,0x02b6,0x23d8,0xffff,0xa63c,0x0317,0x0378,
+    0x0378,0x0399,0x8003,0x03b9,0x0008,0x03da,0x0bfa,0x7ddc,0x4d1c,0x0c3b,0x041c,0x043c,0x045c,0x8003,0x047d,0x0012,
+    0x049d,0x049e,0x04be,0x04be,0x0cde,0x9ebe,0x0cff,0x04df,0xd77f,0x7d9a,0x0296,0x3c38,0xffff,0xc6fd,0x0337,0x0378,
+    0x0378,0x0398,0x8003,0x03b9,0x000d,0x03da,0x03fa,0x03ba,0x03da,0x041b,0x043b,0x0c5c,0x045c,0x041c,0x043d,0x047d,
+    0x049d,0x049e,0x8003,0x04be,0x000d,0xb6fe,0x1d1e,0x04bf,0xbf3f,0x7d7a,0x0296,0x4479,0xffff,0xffdf,0x3438,0x0317,
+    0x0b98,0x0398,0x8004,0x03b9,0x0002,0x039a,0x03fb,0x8003,0x041b,0x0016,0xbede,0xd75e,0x9e7e,0x557d,0x0c9d,0x045d,
+    0x045e,0x047e,0x045e,0x4d9e,0xe7bf,0x151f,0x04bf,0xb71f,0x7d9a,0x0296,0x3c58,0xffff,0xffff,0xd71e,0x23d8,0x0317,
+    0x8003,0x0358,0x0007,0x0379,0x1c1a,0x6d7c,0x0c1a,0x03fb,0x03fb,0x249b,0x8004,0xffff,0x001e,0xe79f,0xa69e,0x6dfe,
+    0x5dde,0x865e,0xefbf,0xe79f,0x0cff,0x04bf,0xbf1f,0x9e1b,0x02b6,0x23d8,0xf7df,0xffff,0xffff,0xef9f,0x8ddb,0x54da,
+    0x4cda,0x6d5b,0xa65d,0xef9f,0xffff,0xae9d,0x03fa,0x041b,0x0c3b,0x6d9c,0xf7df,0x8008,0xffff,0x000a,0xc73f,0x04bf,
+    0x04df,0xcf5f,0xbebd,0x02f6,0x0b37,0xd73e,0xffff,0xffdf,0x8008,0xffff,0x0007,0x861c,0x03da,0x041b,0x041b,0x03db,
+    0x3d1c,0xefbf,0x8005,0xffff,0x001b,0xf7df,0xffff,0x9ebe,0x049f,0x1d3e,0xefbf,0xef9e,0x1397,0x02d6,0x9e1c,0xffff,
+    0xffdf,0xffff,0xffdf,0xffff,0xffff,0xffdf,0xf7df,0xffff,0x9e5c,0x03ba,0x03fb,0x041b,0x041b,0x0c3c,0x03fc,0x4d5c,
+    0x8007,0xffff,0x0008,0x5dde,0x047f,0x4dbe,0xffff,0xffff,0x5499,0x02b6,0x4479,0x8008,0xffff,0x000a,0x8dfc,0x0399,
+    0x03da,0x03fa,0x03fb,0x041b,0x043b,0x0c3c,0x041c,0xaebe,0x8005,0xffff,0x000a,0xe79f,0x14fe,0x049f,0x969e,0xffff,
+    0xffff,0xae7c,0x02f6,0x0317,0xc6dd,0x8006,0xffff,0x000b,0x759b,0x0358,0x03da,0x03da,0x03fa,0x03fb,0x041b,0x043b,
+    0x043c,0x041c,0x4d5d,0x8005,0xffff,0x000a,0x7e3e,0x047e,0x14fe,0xe79f,0xffff,0xffff,0xffdf,0x2bf8,0x02d6,0x3c38,
+    0x8005,0xffff,0x000c,0x8dfb,0x0338,0x03b9,0x03b9,0x03da,0x03fa,0x03fb,0x041b,0x043b,0x043c,0x041c,0x34fc,0x8004,
+    0xffff,0x0004,0xdf7f,0x14de,0x047e,0x6e1e,0x8004,0xffff,0x0014,0xb67c,0x02f6,0x0317,0x7d9a,0xffff,0xf7df,0xffff,
+    0xdf5e,0x0b98,0x0399,0x03b9,0x03b9,0x03da,0x03fa,0x03fb,0x041b,0x043b,0x043c,0x041c,0x453c,0x8004,0xffff,0x0004,
+    0x457d,0x047e,0x14fe,0xe79e,0x8005,0xffff,0x0013,0x64f9,0x02d6,0x0337,0x9e1c,0xffff,0xffff,0x961c,0x0358,0x03b9,
+    0x0399,0x03b9,0x03da,0x03fa,0x03fb,0x041b,0x043b,0x0c3c,0x03fc,0xa69d,0x8003,0xffff,0x0004,0x65de,0x047e,0x047e,
+    0xa6be,0x8006,0xffff,0x0019,0xf7bf,0x3c38,0x02f7,0x0337,0x8dbb,0xffff,0xc6dd,0x0338,0x0399,0x03b9,0x03d9,0x03da,
+    0x03fa,0x041b,0x041b,0x03fb,0x03db,0x6ddd,0xffff,0xffff,0xf7df,0x5d9d,0x047d,0x045e,0x761e,0x8008,0xffff,0x0017,
+    0xe79e,0x3418,0x02f7,0x0337,0x54da,0xdf5e,0x8dfb,0x0b98,0x0358,0x0359,0x0379,0x037a,0x039a,0x03da,0x2c9b,0xa67d,
+    0xffff,0xffff,0xbefe,0x34fd,0x045d,0x045d,0x65de,0x800a,0xffff,0x0015,0xefbe,0x54b9,0x0317,0x0317,0x13b8,0x7dbb,
+    0x9e3c,0x8dfc,0x7dbc,0x75bc,0x85fc,0xa67d,0xd75e,0xffff,0xffff,0xbede,0x557d,0x045c,0x041d,0x045d,0x7e1e,0x800d,
+    0xffff,0x0012,0x95fb,0x1bb8,0x0317,0x0318,0x0bb9,0x44ba,0x759c,0x963c,0xae9d,0xa69d,0x8e1d,0x5d5c,0x249b,0x041b,
+    0x03fc,0x041c,0x34fc,0xbefe,0x800f,0xffff,0x0010,0xe77e,0x7d7b,0x23f9,0x0358,0x0318,0x0318,0x0339,0x0359,0x037a,
+    0x037a,0x039a,0x03bb,0x041c,0x3cfc,0x9e7d,0xf7df,0x800f,0xffff,0x000e,0xffdf,0xffff,0xffff,0xf7be,0xb6bd,0x7dbb,
+    0x4cfb,0x349a,0x2c7a,0x2c7b,0x3cdb,0x5d5b,0x8e1d,0xcf1e,0x800b,0xffff
 };
 
 const uint16_t *flashBitmaps[258]   =
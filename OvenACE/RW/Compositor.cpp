@@ -0,0 +1,300 @@
+// Build part of the screen in RAM and send it to the LCD in one go
+//
+// Each band is filled with the background color, then every recorded primitive that
+// overlaps the band is drawn into it in the order it was recorded.  Bitmaps are read
+// from wherever renderBitmap() would get them: microcontroller flash (run-length
+// encoded), the RAM cache, or external flash.  Only the rows that fall in the band are
+// copied, but the RLE and external flash data before them still has to be stepped over.
+// The bitmaps used in dialogs are small, so this is quick.
+#include <stdint.h>
+#include "Compositor.h"
+#include "Bitmaps.h"
+#include "BitmapCache.h"
+#include "Render.h"
+#include "ReflowWizard.h"
+#include "printf-stdarg.h"
+#include "string.h"
+
+#define PRIMITIVE_RECT                  0
+#define PRIMITIVE_BITMAP                1
+#define PRIMITIVE_TEXT                  2
+
+struct compositorPrimitive {
+  int16_t x, y;
+  int16_t width, height;              // Rectangles only
+  uint16_t value;                     // Color, bitmap number or font
+  uint8_t type;
+  const char *text;
+};
+
+#if COMPOSITOR_BAND_PIXELS > 0
+static bool compositionActive = false;
+static int16_t areaX, areaY, areaWidth, areaHeight;
+static uint16_t areaBackground;
+static compositorPrimitive primitives[COMPOSITOR_MAX_PRIMITIVES];
+static uint8_t primitiveCount;
+static uint16_t band[COMPOSITOR_BAND_PIXELS];
+static int16_t bandY, bandRows;       // Rows of the screen that are in the band
+
+// Copies the part of a bitmap that is in the band, as the bitmap's pixels are produced in order
+struct bandBlit {
+  uint16_t width;                     // Width of the bitmap
+  uint16_t row, column;               // Position (in the bitmap) of the next pixel
+  uint16_t firstRow, lastRow;         // Bitmap rows in the band (lastRow isn't)
+  uint16_t firstColumn, lastColumn;   // Bitmap columns in the band (lastColumn isn't)
+  int32_t offset;                     // Offset into band[] of the bitmap's top-left pixel
+};
+
+
+// Take the next n pixels of the bitmap, either from src or (if src is 0) all the same color
+// Returns false once the last row in the band has been done
+static bool blitPixels(bandBlit *b, const uint16_t *src, uint16_t color, uint32_t n)
+{
+  while (n && b->row < b->lastRow) {
+    uint16_t pixels = b->width - b->column;
+    if (pixels > n)
+      pixels = n;
+    if (b->row >= b->firstRow) {
+      uint16_t first = b->column > b->firstColumn? b->column : b->firstColumn;
+      uint16_t last = b->column + pixels < b->lastColumn? b->column + pixels : b->lastColumn;
+      uint16_t *dest = band + b->offset + (int32_t) b->row * areaWidth + first;
+      for (uint16_t i = first; i < last; i++)
+        *dest++ = src? src[i - b->column] : color;
+    }
+    if (src)
+      src += pixels;
+    n -= pixels;
+    b->column += pixels;
+    if (b->column == b->width) {
+      b->column = 0;
+      b->row++;
+    }
+  }
+  return b->row < b->lastRow;
+}
+
+
+// Draw the part of a bitmap that is in the band
+static void blitBitmap(uint16_t bitmapNumber, int16_t x, int16_t y)
+{
+  uint16_t bitmapWidth, bitmapHeight, page;
+  uint16_t *cached;
+  bandBlit b;
+
+  if (!getBitmapSize(bitmapNumber, &bitmapWidth, &bitmapHeight))
+    return;
+
+  // Which part of the bitmap is in the band?
+  if (y >= bandY + bandRows || y + bitmapHeight <= bandY || x >= areaX + areaWidth || x + bitmapWidth <= areaX)
+    return;
+  b.width = bitmapWidth;
+  b.firstRow = y < bandY? bandY - y : 0;
+  b.lastRow = y + bitmapHeight > bandY + bandRows? bandY + bandRows - y : bitmapHeight;
+  b.firstColumn = x < areaX? areaX - x : 0;
+  b.lastColumn = x + bitmapWidth > areaX + areaWidth? areaX + areaWidth - x : bitmapWidth;
+  b.offset = (int32_t) (y - bandY) * areaWidth + (x - areaX);
+
+  // Microcontroller flash (run-length encoded, see Bitmaps.cpp).  Like drawBitmapRLE(), stop
+  // at a token that is empty or goes past the last pixel, so corrupt data can't run on forever
+  if (flashBitmaps[bitmapNumber]) {
+    const uint16_t *data = flashBitmaps[bitmapNumber] + 1;
+    uint32_t pixelsLeft = (uint32_t) bitmapWidth * bitmapHeight;
+    b.row = b.column = 0;
+    while (pixelsLeft) {
+      uint16_t token = *data++, count = token & 0x7FFF;
+      if (count == 0 || count > pixelsLeft)
+        break;
+      pixelsLeft -= count;
+      if (token & 0x8000) {
+        if (!blitPixels(&b, 0, *data++, count))
+          break;
+      }
+      else {
+        if (!blitPixels(&b, data, 0, count))
+          break;
+        data += count;
+      }
+    }
+    return;
+  }
+
+  // The RAM cache
+  if (bitmapNumber <= BITMAP_LAST_ONE && (cached = getCachedBitmap(bitmapNumber, &bitmapWidth, &bitmapHeight)) != 0) {
+    b.row = b.firstRow;
+    b.column = 0;
+    blitPixels(&b, cached + (uint32_t) b.firstRow * bitmapWidth, 0, (uint32_t) (b.lastRow - b.firstRow) * bitmapWidth);
+    return;
+  }
+
+  // External flash.  Start at the page holding the first row needed
+  uint16_t buf[128];    // 256 bytes (one page)
+  uint32_t pixel = (uint32_t) b.firstRow * bitmapWidth, pixelsLeft;
+  if (bitmapNumber > BITMAP_LAST_ONE || (page = flash.getBitmapInfo(bitmapNumber, &bitmapWidth, &bitmapHeight)) > 0xFFF)
+    return;
+  page += pixel >> 7;
+  pixel &= ~((uint32_t) 127);
+  b.row = pixel / bitmapWidth;
+  b.column = pixel % bitmapWidth;
+  pixelsLeft = (uint32_t) b.lastRow * bitmapWidth - pixel;
+  flash.startRead(page, (pixelsLeft > 128? 128 : pixelsLeft) << 1, (uint8_t *) buf);
+  while (1) {
+    uint16_t pixelsInPage = pixelsLeft > 128? 128 : pixelsLeft;
+    if (!blitPixels(&b, buf, 0, pixelsInPage))
+      break;
+    pixelsLeft -= pixelsInPage;
+    flash.continueRead((pixelsLeft > 128? 128 : pixelsLeft) << 1, (uint8_t *) buf);
+  }
+  flash.endRead();
+}
+
+
+// Draw the part of a string that is in the band (positioned the same way displayString() does)
+static void blitText(int16_t x, int16_t y, uint8_t font, const char *str)
+{
+  for (bool firstChar = true; *str; firstChar = false, str++) {
+    if (!firstChar)
+      x += postCharacterSpace(font, *(str-1)) + preCharacterSpace(font, *str);
+    if (*str != ' ' && isSupportedCharacter(font, *str)) {
+      uint8_t glyphFont = font;
+      uint16_t bitmapNumber = getBitmapNumberForCharacter(&glyphFont, *str);
+      blitBitmap(bitmapNumber, x, y + getYOffsetForCharacter(glyphFont, *str));
+    }
+    x += getCharacterWidth(font, *str);
+  }
+}
+
+
+// Draw the part of a rectangle that is in the band
+static void blitRect(int16_t x, int16_t y, int16_t width, int16_t height, uint16_t color)
+{
+  int16_t left = x > areaX? x : areaX;
+  int16_t right = x + width < areaX + areaWidth? x + width : areaX + areaWidth;
+  int16_t top = y > bandY? y : bandY;
+  int16_t bottom = y + height < bandY + bandRows? y + height : bandY + bandRows;
+
+  for (int16_t row = top; row < bottom; row++) {
+    uint16_t *dest = band + (row - bandY) * areaWidth + (left - areaX);
+    for (int16_t i = left; i < right; i++)
+      *dest++ = color;
+  }
+}
+#endif // COMPOSITOR_BAND_PIXELS
+
+
+// Start recording drawing calls for an area of the screen.  The area starts out as the background color
+void startComposition(int16_t x, int16_t y, int16_t width, int16_t height, uint16_t background)
+{
+  // An empty area has nothing to draw (and endComposition() divides by the width)
+  if (width <= 0 || height <= 0) {
+    printfD("startComposition: area is empty\n");
+    return;
+  }
+#if COMPOSITOR_BAND_PIXELS > 0
+  if (width <= COMPOSITOR_BAND_PIXELS) {
+    areaX = x;
+    areaY = y;
+    areaWidth = width;
+    areaHeight = height;
+    areaBackground = background;
+    primitiveCount = 0;
+    compositionActive = true;
+    return;
+  }
+  printfD("startComposition: area is too wide\n");
+#endif
+  // Draw directly instead
+  tft.fillRect(x, y, width, height, background);
+}
+
+
+// Draw the recorded calls
+void endComposition()
+{
+#if COMPOSITOR_BAND_PIXELS > 0
+  if (!compositionActive)
+    return;
+  compositionActive = false;
+
+  // The whole area is one address window.  The bands are sent one after the other
+  tft.startBitmap(areaX, areaY, areaWidth, areaHeight);
+  for (bandY = areaY; bandY < areaY + areaHeight; bandY += bandRows) {
+    bandRows = COMPOSITOR_BAND_PIXELS / areaWidth;
+    if (bandRows > areaY + areaHeight - bandY)
+      bandRows = areaY + areaHeight - bandY;
+
+    // Fill the band with the background, then draw everything on top
+    for (uint16_t i=0; i < bandRows * areaWidth; i++)
+      band[i] = areaBackground;
+    for (uint8_t i=0; i < primitiveCount; i++) {
+      compositorPrimitive *p = &primitives[i];
+      switch (p->type) {
+        case PRIMITIVE_RECT:
+          blitRect(p->x, p->y, p->width, p->height, p->value);
+          break;
+        case PRIMITIVE_BITMAP:
+          blitBitmap(p->value, p->x, p->y);
+          break;
+        case PRIMITIVE_TEXT:
+          blitText(p->x, p->y, p->value, p->text);
+          break;
+      }
+    }
+    tft.drawBitmap(band, bandRows * areaWidth);
+  }
+  tft.endBitmap();
+#endif
+}
+
+
+// Record a drawing call.  Returns false if it must be drawn directly
+static bool addPrimitive(uint8_t type, int16_t x, int16_t y, int16_t width, int16_t height, uint16_t value, const char *text)
+{
+#if COMPOSITOR_BAND_PIXELS > 0
+  if (!compositionActive)
+    return false;
+  if (primitiveCount == COMPOSITOR_MAX_PRIMITIVES) {
+    // Send what there is so far, and draw the rest directly
+    printfD("Compositor: too many primitives\n");
+    endComposition();
+    return false;
+  }
+
+  compositorPrimitive *p = &primitives[primitiveCount++];
+  p->type = type;
+  p->x = x;
+  p->y = y;
+  p->width = width;
+  p->height = height;
+  p->value = value;
+  p->text = text;
+  return true;
+#else
+  return false;
+#endif
+}
+
+
+// Fill a rectangle
+void composeRect(int16_t x, int16_t y, int16_t width, int16_t height, uint16_t color)
+{
+  if (!addPrimitive(PRIMITIVE_RECT, x, y, width, height, color, 0))
+    tft.fillRect(x, y, width, height, color);
+}
+
+
+// Draw a bitmap
+void composeBitmap(uint16_t bitmapNumber, int16_t x, int16_t y)
+{
+  if (!addPrimitive(PRIMITIVE_BITMAP, x, y, 0, 0, bitmapNumber, 0))
+    renderBitmap(bitmapNumber, x, y);
+}
+
+
+// Draw a string, like displayString().  Returns the width of the string
+// The string isn't copied, so it must not change before endComposition()
+uint16_t composeText(int16_t x, int16_t y, uint8_t font, const char *str)
+{
+  if (!addPrimitive(PRIMITIVE_TEXT, x, y, 0, 0, font, str))
+    return displayString(x, y, font, (char *) str);
+  return measureString(font, str);
+}
@@ -0,0 +1,43 @@
+// Build part of the screen in RAM and send it to the LCD in one go
+//
+// Dialogs are drawn by erasing an area, then drawing borders, text and buttons on top.
+// Drawn directly, every pixel is written two or three times and the layers can be seen
+// appearing.  While a composition is being built the drawing calls below are recorded
+// instead.  endComposition() then renders the area one band of rows at a time into a
+// RAM buffer and streams each band to the LCD, so every pixel is written once.
+//
+// Outside a composition (or if COMPOSITOR_BAND_PIXELS is 0) the calls draw directly.
+#ifndef __COMPOSITOR_H__
+#define __COMPOSITOR_H__
+
+#include <stdint.h>
+
+// Size of the band buffer in pixels (2 bytes each).  Bands are as many rows as fit, so
+// a full-width (480 pixel) composition is drawn 2 rows at a time.  0 disables composition.
+#ifndef COMPOSITOR_BAND_PIXELS
+#define COMPOSITOR_BAND_PIXELS          960
+#endif
+
+// Maximum number of drawing calls in one composition.  Each one costs 16 bytes of RAM.
+// If there are more, the composition is sent and the rest are drawn directly.
+#ifndef COMPOSITOR_MAX_PRIMITIVES
+#define COMPOSITOR_MAX_PRIMITIVES       64
+#endif
+
+// Start recording drawing calls for an area of the screen.  The area starts out as the background color
+void startComposition(int16_t x, int16_t y, int16_t width, int16_t height, uint16_t background);
+
+// Draw the recorded calls
+void endComposition(void);
+
+// Fill a rectangle
+void composeRect(int16_t x, int16_t y, int16_t width, int16_t height, uint16_t color);
+
+// Draw a bitmap
+void composeBitmap(uint16_t bitmapNumber, int16_t x, int16_t y);
+
+// Draw a string, like displayString().  Returns the width of the string
+// The string isn't copied, so it must not change before endComposition()
+uint16_t composeText(int16_t x, int16_t y, uint8_t font, const char *str);
+
+#endif
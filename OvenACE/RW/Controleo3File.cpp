@@ -130,6 +130,13 @@ uint32_t File::size() {
   return _file->fileSize();
 }
 
+// the FAT date (high 16 bits) and time the file was last written
+uint32_t File::modified() {
+  dir_t d;
+  if (! _file || ! _file->dirEntry(&d)) return 0;
+  return ((uint32_t) d.lastWriteDate << 16) | d.lastWriteTime;
+}
+
 void File::close() {
   if (_file) {
     _file->close();
@@ -150,3 +157,20 @@ File::operator bool() {
   return false;
 }
 
+FileReader::FileReader(File *file, uint8_t *buffer, uint16_t size) {
+  _file = file;
+  _buffer = buffer;
+  _size = size;
+  _next = _end = buffer;
+}
+
+// Refill the buffer.  Reads up to the next multiple of the buffer size, so that after
+// the first read the reads are block-aligned.  Returns false at the end of the file
+bool FileReader::fill() {
+  uint16_t n = _size - (_file->position() % _size);
+  int bytesRead = _file->read(_buffer, n);
+
+  _next = _buffer;
+  _end = _buffer + (bytesRead > 0? bytesRead : 0);
+  return _end != _buffer;
+}
@@ -4,10 +4,20 @@
 //
 // Flash controller for W25Q80BV
 
+// FLASH_ASM uses FLASH_READ_QUAD in BitBash.S to read data in quad mode.  It toggles
+// the clock with OUTCLR/OUTSET and reads the data pins through the IOBUS, so it is
+// much faster than the C version.  Comment this out to use the C version (for example,
+// to compare them using the 'F' debug command).  The host tests (tests/host) use the C version.
+#ifndef HOST_TEST
+#define FLASH_ASM
+#endif
+
 #include "Controleo3Flash.h"
+#include "FlashCache.h"
 #include "SimplePIO.h"
 #include "printf-stdarg.h"
 #include "rtos_support.h"
+#include "BitBash.h"
 
 // Pin IO modes
 #define PIN_IO_NORMAL                   0
@@ -29,6 +39,7 @@
 #define STATUS_LB2                      0x10
 #define STATUS_LB3                      0x20
 #define STATUS_CMP                      0x40
+#define STATUS_SUS                      0x80
 
 // Areas of flash to protect
 #define PROTECT_ALL                     0
@@ -55,9 +66,32 @@
 #define CMD_MANUFACTURER_ID             0x90
 #define CMD_JEDEC_ID                    0x9F
 #define CMD_ERASE_BLOCK_64K             0xD8
+#define CMD_ERASE_SUSPEND               0x75
+#define CMD_ERASE_RESUME                0x7A
 
 #define SEND_CMD(x)                     {FLASH_CS_ACTIVE; write8(x); FLASH_CS_IDLE; }
 
+// Operations that leave the flash busy, timed by waitUntilNotBusy()
+#define FLASH_OP_NONE                   0
+#define FLASH_OP_PROGRAM_PAGE           1
+#define FLASH_OP_ERASE_4K               2
+#define FLASH_OP_ERASE_64K              3
+#define FLASH_OP_ERASE_CHIP             4
+#define FLASH_OP_WRITE_STATUS           5
+#define FLASH_OPERATIONS                6
+
+static const char *flashOperationNames[FLASH_OPERATIONS] = {"", "Program page", "Erase 4K", "Erase 64K", "Erase chip", "Write status"};
+
+struct flashBusyStatistics {
+    uint32_t count;
+    uint32_t totalMicros;
+    uint32_t maxMicros;
+    uint32_t timeouts;
+};
+
+static flashBusyStatistics flashBusyStats[FLASH_OPERATIONS];
+static uint32_t eraseSuspends = 0;
+
 
 // Flash storage organization by pages. Pages are 256 bytes in size. The smallest block
 // that can be erased at a time is 16 pages (4K).
@@ -73,6 +107,7 @@
 //     2 bytes for bitmap width
 //     2 bytes for bitmap height
 //   - Entries are stored 42 per page, so maximum 672 bitmaps
+//   - The first FLASH_BITMAP_DIRECTORY_SIZE entries are copied to RAM by begin()
 // 528 to 4095 (892K) - bitmaps
 //   - Bitmaps are saved to page boundaries
 //   - Bitmaps are 16-bit 565RGB color
@@ -84,6 +119,12 @@
 #define FLASH_MAXIMUM_BITMAPS               672
 #define FLASH_ADDRESS_SIZE                  6
 
+// Packed RAM bitmap directory entries (see loadBitmapDirectory).  Page 0 always holds the
+// prefs, so an entry of 0 means there is no bitmap.
+#define DIRECTORY_ENTRY(p, w, h)            ((uint32_t) (p) + ((uint32_t) (w) << 12) + ((uint32_t) (h) << 22))
+#define DIRECTORY_PAGE(e)                   ((e) & 0x0FFF)
+#define DIRECTORY_WIDTH(e)                  (((e) >> 12) & 0x03FF)
+#define DIRECTORY_HEIGHT(e)                 ((e) >> 22)
 
 
 Controleo3Flash::Controleo3Flash()
@@ -92,6 +133,10 @@ Controleo3Flash::Controleo3Flash()
     portAOut   = &PORT_OUT(PA(0));
     portAIn    = &PORT_IN(PA(0));
     portAMode  = &PORT_DIR(PA(0));
+    bitmapDirectoryLoaded = false;
+    pendingOperation = FLASH_OP_NONE;
+    eraseSuspended = false;
+    busMutex = 0;
 }
 
 
@@ -100,12 +145,19 @@ void Controleo3Flash::begin()
     // Set the pin IO states
     setPinIOMode(PIN_IO_NORMAL);
 
+    // IO0-IO3 are sampled continuously so they can be read through the IOBUS
+    // (see FLASH_TO_LCD in BitBash.S)
+    PORT_CTRL(PA(0)) |= 0x000F0000;
+
     // Default pin states
     FLASH_CS_IDLE;
     FLASH_CLK_ACTIVE;
 
     // Protect the flash
     protectFlash(PROTECT_ALL, TEMPORARY_PROTECTION);
+
+    // Keep a copy of the bitmap address table in RAM
+    loadBitmapDirectory();
 }
 
 
@@ -174,16 +226,181 @@ void Controleo3Flash::waitUntilNotBusy(uint16_t timeMillis)
 {
     uint8_t state;
     uint32_t startTime = millis();
-    while (startTime + timeMillis > millis()) {
+
+    // A sector erase started by the flash job task can take up to 400ms
+    if (pendingOperation == FLASH_OP_ERASE_4K && !eraseSuspended && timeMillis < 400)
+        timeMillis = 400;
+
+    // millis() may tick just after the operation started, so wait for one more tick
+    while (startTime + timeMillis >= millis()) {
         FLASH_CS_ACTIVE;
         write8(CMD_READ_STATUS1_REGISTER);
         state = read8();
         FLASH_CS_IDLE;
-        if (!(state & STATUS_BUSY))
+        if (!(state & STATUS_BUSY)) {
+            endOperation(false);
             return;
+        }
         delayMicroseconds(100);
     }
-    printfD("Err:waitUntilNotBusy:Timeout\n");
+    printfD("Err:waitUntilNotBusy:Timeout %s\n", flashOperationNames[pendingOperation]);
+    endOperation(true);
+}
+
+
+// A program, erase or status register write has been sent.  The flash is busy until
+// it has finished, which waitUntilNotBusy() times
+void Controleo3Flash::startOperation(uint8_t operation)
+{
+    pendingOperation = operation;
+    operationStart = CPU_HZ_COUNTER();
+}
+
+
+// Record how long the flash was busy for the last operation
+void Controleo3Flash::endOperation(bool timedOut)
+{
+    if (pendingOperation == FLASH_OP_NONE || eraseSuspended)
+        return;
+
+    flashBusyStatistics *stats = &flashBusyStats[pendingOperation];
+    uint32_t micros = (CPU_HZ_COUNTER() - operationStart) / (configCPU_CLOCK_HZ / 1000000);
+    stats->count++;
+    stats->totalMicros += micros;
+    if (micros > stats->maxMicros)
+        stats->maxMicros = micros;
+    if (timedOut)
+        stats->timeouts++;
+    pendingOperation = FLASH_OP_NONE;
+}
+
+
+// Take the flash.  Once the flash job task is running (see FlashJobs.cpp) the flash is
+// shared between tasks, and each command sequence must finish before another starts.
+// Calls can be nested.
+void Controleo3Flash::lock()
+{
+    if (busMutex)
+        xSemaphoreTakeRecursive(busMutex, portMAX_DELAY);
+}
+
+
+// Let other tasks use the flash
+void Controleo3Flash::unlock()
+{
+    if (busMutex)
+        xSemaphoreGiveRecursive(busMutex);
+}
+
+
+// Start sharing the flash between tasks
+void Controleo3Flash::enableLocking()
+{
+    if (!busMutex)
+        busMutex = xSemaphoreCreateRecursiveMutex();
+}
+
+
+// Start erasing a 4K sector, without waiting for it to finish (see isBusy)
+// The sector must be in the lower 128K (prefs and profiles), which must be writable
+void Controleo3Flash::startErase4K(uint16_t pageNumber)
+{
+    lock();
+
+    // Make sure previous commands have finished executing
+    waitUntilNotBusy(50);
+
+    // Enable writing to flash
+    SEND_CMD(CMD_WRITE_ENABLE);
+
+    // Erase the 4K sector (4K = 16 pages)
+    FLASH_CS_ACTIVE;
+    write8(CMD_ERASE_SECTOR_4K);
+    write8((pageNumber & 0x0F00) >> 8);
+    write8(pageNumber & 0x00F0);
+    write8(0);
+    FLASH_CS_IDLE;
+    startOperation(FLASH_OP_ERASE_4K);
+    invalidateFlashCache(pageNumber & 0xFFF0, 16);
+
+    unlock();
+}
+
+
+// Is the flash still programming or erasing?
+bool Controleo3Flash::isBusy()
+{
+    uint8_t state;
+
+    lock();
+    FLASH_CS_ACTIVE;
+    write8(CMD_READ_STATUS1_REGISTER);
+    state = read8();
+    FLASH_CS_IDLE;
+    if (!(state & STATUS_BUSY))
+        endOperation(false);
+    unlock();
+    return state & STATUS_BUSY;
+}
+
+
+// Suspend a sector erase so the flash can be read.  The suspend takes up to 20us, and
+// can't be sent until 20us after the last resume.  BUSY clears once the erase is
+// suspended - or once it has finished, if that happened before the suspend was accepted
+// (then SUS isn't set, and there is nothing to resume).
+void Controleo3Flash::suspendErase()
+{
+    uint8_t state;
+    uint32_t start;
+
+    while (CPU_HZ_COUNTER() - eraseResumed < 20 * (configCPU_CLOCK_HZ / 1000000))
+        ;
+    SEND_CMD(CMD_ERASE_SUSPEND);
+    start = CPU_HZ_COUNTER();
+    do {
+        // Leave the erase running if it won't suspend; waitUntilNotBusy() waits for it
+        if (CPU_HZ_COUNTER() - start > 100 * (configCPU_CLOCK_HZ / 1000000)) {
+            printfD("Err:suspendErase:Timeout\n");
+            return;
+        }
+        FLASH_CS_ACTIVE;
+        write8(CMD_READ_STATUS1_REGISTER);
+        state = read8();
+        FLASH_CS_IDLE;
+    } while (state & STATUS_BUSY);
+
+    FLASH_CS_ACTIVE;
+    write8(CMD_READ_STATUS2_REGISTER);
+    state = read8();
+    FLASH_CS_IDLE;
+    if (!(state & STATUS_SUS)) {
+        // The erase finished first
+        endOperation(false);
+        return;
+    }
+    eraseSuspended = true;
+    eraseSuspends++;
+}
+
+
+// Carry on with a suspended sector erase
+void Controleo3Flash::resumeErase()
+{
+    SEND_CMD(CMD_ERASE_RESUME);
+    eraseResumed = CPU_HZ_COUNTER();
+    eraseSuspended = false;
+}
+
+
+// Print how long the flash has been busy for each type of operation
+void Controleo3Flash::printBusyTimes()
+{
+    for (uint8_t i=FLASH_OP_PROGRAM_PAGE; i < FLASH_OPERATIONS; i++) {
+        flashBusyStatistics *stats = &flashBusyStats[i];
+        printfD("  %-12s count = %-5u average = %-7u max = %-7u us  timeouts = %u\n", flashOperationNames[i], (unsigned int) stats->count,
+                (unsigned int) (stats->count? stats->totalMicros / stats->count : 0), (unsigned int) stats->maxMicros, (unsigned int) stats->timeouts);
+    }
+    printfD("  Erases suspended to read = %u\n", (unsigned int) eraseSuspends);
 }
 
 
@@ -193,6 +410,8 @@ void Controleo3Flash::waitUntilNotBusy(uint16_t timeMillis)
 // where the prefs are stored.
 void Controleo3Flash::protectFlash(uint8_t flashArea, bool writeToFlash)
 {
+    lock();
+
     // The Status Register has a copy in RAM.  Typically, the register stored in
     // flash should always reflect that the entire flash area is protected. For
     // a lot of operations it is sufficient to temporarily remove protection for
@@ -231,15 +450,20 @@ void Controleo3Flash::protectFlash(uint8_t flashArea, bool writeToFlash)
             break;
     }
     FLASH_CS_IDLE;
+    if (writeToFlash)
+        startOperation(FLASH_OP_WRITE_STATUS);
 
     // wait for the write to complete (flash = 15ms, RAM = instantaneous)
     waitUntilNotBusy(15);
+    unlock();
 }
 
 
 // Erase the entire flash IC
 void Controleo3Flash::eraseFlash()
 {
+    lock();
+
     // Make sure previous commands have finished executing
     waitUntilNotBusy(50);
 
@@ -251,12 +475,19 @@ void Controleo3Flash::eraseFlash()
 
     // Erase the entire flash chip
     SEND_CMD(CMD_ERASE_FLASH);
+    startOperation(FLASH_OP_ERASE_CHIP);
 
     // Wait for the erase to complete
     waitUntilNotBusy(6000);
+    invalidateFlashCache(0, 4096);
+
+    // There are no bitmaps anymore
+    for (uint16_t i=0; i < FLASH_BITMAP_DIRECTORY_SIZE; i++)
+        bitmapDirectory[i] = 0;
 
     // Leave the flash unprotected.  This happens anyway, but the QE bit needs to be set
     protectFlash(PROTECT_NONE, PERMANENT_PROTECTION);
+    unlock();
 }
 
 
@@ -267,6 +498,8 @@ void Controleo3Flash::erasePrefsBlock(uint8_t block)
     if (block > 4)
       return;
 
+    lock();
+
     // Make sure previous commands have finished executing
     waitUntilNotBusy(50);
 
@@ -283,12 +516,15 @@ void Controleo3Flash::erasePrefsBlock(uint8_t block)
     write8(block << 4);
     write8(0);
     FLASH_CS_IDLE;
+    startOperation(FLASH_OP_ERASE_4K);
 
     // Wait for the erase to complete
     waitUntilNotBusy(400);
+    invalidateFlashCache(block << 4, 16);
 
     // Protect the flash again
     protectFlash(PROTECT_ALL, TEMPORARY_PROTECTION);
+    unlock();
 }
 
 
@@ -301,6 +537,8 @@ void Controleo3Flash::eraseProfileBlock(uint16_t block)
         return;
     }
 
+    lock();
+
     // Make sure previous commands have finished executing
     waitUntilNotBusy(50);
 
@@ -317,12 +555,15 @@ void Controleo3Flash::eraseProfileBlock(uint16_t block)
     write8(block & 0x00FF);
     write8(0);
     FLASH_CS_IDLE;
+    startOperation(FLASH_OP_ERASE_4K);
 
     // Wait for the erase to complete
     waitUntilNotBusy(400);
+    invalidateFlashCache(block, 16);
 
     // Protect the flash again
     protectFlash(PROTECT_ALL, TEMPORARY_PROTECTION);
+    unlock();
 }
 
 
@@ -335,9 +576,55 @@ void Controleo3Flash::allowWritingToPrefs(bool allow) {
 }
 
 
+// Convenience function to allow writing to the whole flash (bitmaps and the bitmap address table)
+void Controleo3Flash::allowWritingToBitmaps(bool allow) {
+    if (allow)
+        protectFlash(PROTECT_NONE, TEMPORARY_PROTECTION);
+    else
+        protectFlash(PROTECT_ALL, TEMPORARY_PROTECTION);
+}
+
+
+// Erase a range of pages.  64K blocks (256 pages) are erased in one go where the range
+// covers the whole block; the rest is erased a 4K sector at a time.  The range is rounded
+// out to 4K sectors.  Flash should be unprotected already.  See protectFlash()
+void Controleo3Flash::erasePages(uint16_t firstPage, uint16_t pages)
+{
+    uint16_t page = firstPage & 0xFFF0;
+    uint16_t endPage = (firstPage + pages + 15) & 0x1FF0;
+
+    lock();
+    while (page < endPage) {
+        bool wholeBlock = !(page & 0x00FF) && endPage - page >= 256;
+
+        // Make sure previous commands have finished executing
+        waitUntilNotBusy(50);
+
+        // Enable writing to flash
+        SEND_CMD(CMD_WRITE_ENABLE);
+
+        FLASH_CS_ACTIVE;
+        write8(wholeBlock? CMD_ERASE_BLOCK_64K : CMD_ERASE_SECTOR_4K);
+        write8((page & 0x0F00) >> 8);
+        write8(page & 0x00F0);
+        write8(0);
+        FLASH_CS_IDLE;
+        startOperation(wholeBlock? FLASH_OP_ERASE_64K : FLASH_OP_ERASE_4K);
+
+        // Wait for the erase to complete
+        waitUntilNotBusy(wholeBlock? 1000 : 400);
+        invalidateFlashCache(page, wholeBlock? 256 : 16);
+        page += wholeBlock? 256 : 16;
+    }
+    unlock();
+}
+
+
 // Erase the lowest 128K of the flash, where the user preferences and profiles are stored
 void Controleo3Flash::factoryReset()
 {
+    lock();
+
     // Make sure previous commands have finished executing
     waitUntilNotBusy(50);
 
@@ -355,13 +642,16 @@ void Controleo3Flash::factoryReset()
         write8(i);
         write8(0);
         FLASH_CS_IDLE;
+        startOperation(FLASH_OP_ERASE_64K);
 
         // Wait for the erase to complete
         waitUntilNotBusy(1000);
     }
+    invalidateFlashCache(0, 512);
 
     // Protect the flash again
     protectFlash(PROTECT_ALL, TEMPORARY_PROTECTION);
+    unlock();
 }
 
 
@@ -370,6 +660,14 @@ void Controleo3Flash::factoryReset()
 // address range is 0x000 to 0xFFF.
 void Controleo3Flash::startRead(uint16_t pageNumber, uint16_t bytesToRead, uint8_t *dest)
 {
+    // The flash stays locked until endRead()
+    lock();
+
+    // A sector erase started by the flash job task is suspended while reading, so the
+    // read doesn't wait for the erase to finish
+    if (pendingOperation == FLASH_OP_ERASE_4K && !eraseSuspended && isBusy())
+        suspendErase();
+
     // Make sure previous commands have finished executing
     waitUntilNotBusy(50);
 
@@ -399,11 +697,18 @@ void Controleo3Flash::startRead(uint16_t pageNumber, uint16_t bytesToRead, uint8
     setPinIOMode(PIN_IO_QUAD_READ);
 
     // Read the data
+    continueRead(bytesToRead, dest);
+}
+
+
+// Read data in quad mode, a nibble at a time (C version)
+static void readQuad(PORT_REGISTER *portAOut, PORT_REGISTER *portAIn, uint16_t bytesToRead, uint8_t *dest)
+{
     while (bytesToRead--) {
         FLASH_PULSE_CLK;
-        *dest = ((*portAIn & 0x000F0000) >> 12);
+        *dest = (*portAIn & 0x000F0000) >> 12;
         FLASH_PULSE_CLK;
-        *dest += ((*portAIn & 0x000F0000) >> 16);
+        *dest += (*portAIn & 0x000F0000) >> 16;
         dest++;
     }
 }
@@ -412,14 +717,60 @@ void Controleo3Flash::startRead(uint16_t pageNumber, uint16_t bytesToRead, uint8
 // Continue reading data from flash
 void Controleo3Flash::continueRead(uint16_t bytesToRead, uint8_t *dest)
 {
-    // Read the data
-    while (bytesToRead--) {
-        FLASH_PULSE_CLK;
-        *dest = (*portAIn & 0x000F0000) >> 12;
-        FLASH_PULSE_CLK;
-        *dest += (*portAIn & 0x000F0000) >> 16;
-        dest++;
+    if (!bytesToRead)
+        return;
+#ifdef FLASH_ASM
+    FLASH_READ_QUAD(dest, bytesToRead);
+#else
+    readQuad(portAOut, portAIn, bytesToRead, dest);
+#endif
+}
+
+
+// Time reading 4K from flash with the C and assembly versions of the quad read, and
+// print the results.  Both read the same data, so the results are compared too.
+void Controleo3Flash::benchmarkRead()
+{
+    // The 'F' command runs this in the USB task, which only has a 512-byte stack
+    uint8_t buf[128];
+    uint32_t start, cycles[2], checksum[2];
+    uint16_t i, chunk;
+
+    for (uint8_t version=0; version < 2; version++) {
+        checksum[version] = 0;
+        cycles[version] = 0;
+        startRead(0, 0, 0);
+        for (chunk=0; chunk < 4096 / sizeof(buf); chunk++) {
+            start = CPU_HZ_COUNTER();
+            if (version)
+                FLASH_READ_QUAD(buf, sizeof(buf));
+            else
+                readQuad(portAOut, portAIn, sizeof(buf), buf);
+            cycles[version] += CPU_HZ_COUNTER() - start;
+            for (i=0; i < sizeof(buf); i++)
+                checksum[version] += buf[i];
+        }
+        endRead();
+
+        // Bytes per millisecond is KB/s
+        uint32_t bytesPerMs = (4096 * (configCPU_CLOCK_HZ / 1000)) / cycles[version];
+        printfD("  %-8s 4096 bytes = %7u cycles (%u.%02u cycles/byte, %u.%03u MB/s)\n", version? "Assembly" : "C",
+                (unsigned int) cycles[version], (unsigned int) (cycles[version] >> 12), (unsigned int) (((cycles[version] & 0xFFF) * 100) >> 12),
+                (unsigned int) (bytesPerMs / 1000), (unsigned int) (bytesPerMs % 1000));
     }
+    if (checksum[0] != checksum[1])
+        printfD("  The two versions read different data!\n");
+}
+
+
+// Print the flash read benchmark on the debug console
+void PrintFlashBenchmark()
+{
+    extern Controleo3Flash flash;
+
+    flash.benchmarkRead();
+    printfD("Busy times:\n");
+    flash.printBusyTimes();
 }
 
 
@@ -431,6 +782,10 @@ void Controleo3Flash::endRead()
 
     // Restore the I/O pins to their normal states
     setPinIOMode(PIN_IO_NORMAL);
+
+    if (eraseSuspended)
+        resumeErase();
+    unlock();
 }
 
 
@@ -444,6 +799,9 @@ void Controleo3Flash::write(uint16_t pageNumber, uint16_t bytesToWrite, uint8_t
     if (!bytesToWrite)
         return;
 
+    lock();
+    invalidateFlashCache(pageNumber, 1);
+
     // Make sure previous commands have finished executing
     waitUntilNotBusy(50);
 
@@ -474,9 +832,11 @@ void Controleo3Flash::write(uint16_t pageNumber, uint16_t bytesToWrite, uint8_t
 
     // End the write
     FLASH_CS_IDLE;
+    startOperation(FLASH_OP_PROGRAM_PAGE);
 
     // Restore the I/O pins to their normal states
     setPinIOMode(PIN_IO_NORMAL);
+    unlock();
 }
 
 
@@ -532,6 +892,7 @@ uint16_t Controleo3Flash::getBitmapPage(uint16_t bitmapNumber, uint16_t bitmapWi
 
         // Save the address table in flash
         write(FLASH_BITMAP_ADDRESS_TABLE, FLASH_ADDRESS_SIZE, (uint8_t *) addressTable);
+        setBitmapDirectoryEntry(0, FLASH_FIRST_BITMAP_PAGE, bitmapWidth, bitmapHeight);
 
         // The first bitmap gets saved to page 528
         return FLASH_FIRST_BITMAP_PAGE;
@@ -540,8 +901,7 @@ uint16_t Controleo3Flash::getBitmapPage(uint16_t bitmapNumber, uint16_t bitmapWi
     // Read the previous bitmap entry to determine where this bitmap is saved
     tablePage = FLASH_BITMAP_ADDRESS_TABLE + ((bitmapNumber - 1) / FLASH_ADDRESSES_PER_PAGE);
     pageOffset = ((bitmapNumber - 1) % FLASH_ADDRESSES_PER_PAGE) * (FLASH_ADDRESS_SIZE >> 1);
-    startRead(tablePage, FLASH_C3_PAGE_SIZE, (uint8_t *) addressTable);
-    endRead();
+    readFlash(tablePage, FLASH_C3_PAGE_SIZE, (uint8_t *) addressTable);
 /*    SerialUSB.print("Previous bitmap: tablePage = ");
     SerialUSB.print(tablePage);
     SerialUSB.print("  pageOffset = ");
@@ -570,8 +930,7 @@ uint16_t Controleo3Flash::getBitmapPage(uint16_t bitmapNumber, uint16_t bitmapWi
     // Read in the address table for the current bitmap
     tablePage = FLASH_BITMAP_ADDRESS_TABLE + (bitmapNumber / FLASH_ADDRESSES_PER_PAGE);
     pageOffset = (bitmapNumber % FLASH_ADDRESSES_PER_PAGE) * (FLASH_ADDRESS_SIZE >> 1);
-    startRead(tablePage, FLASH_C3_PAGE_SIZE, (uint8_t *) addressTable);
-    endRead();
+    readFlash(tablePage, FLASH_C3_PAGE_SIZE, (uint8_t *) addressTable);
 /*    SerialUSB.print("This bitmap: tablePage = ");
     SerialUSB.print(tablePage);
     SerialUSB.print("  pageOffset = ");
@@ -588,21 +947,32 @@ uint16_t Controleo3Flash::getBitmapPage(uint16_t bitmapNumber, uint16_t bitmapWi
 
     // Save this address table page
     write(tablePage, FLASH_C3_PAGE_SIZE, (uint8_t *) addressTable);
+    setBitmapDirectoryEntry(bitmapNumber, pageForThisBitmap, bitmapWidth, bitmapHeight);
 
     return pageForThisBitmap;
 }
 
 
+// Get the page, width and height of a bitmap.  Bitmaps in the RAM directory don't touch
+// the flash at all.  Returns 0xFFFF if the bitmap hasn't been saved to flash.
 uint16_t Controleo3Flash::getBitmapInfo(uint16_t bitmapNumber, uint16_t *bitmapWidth, uint16_t *bitmapHeight)
 {
     uint16_t tablePage, pageOffset;
     uint16_t addressTable[FLASH_C3_PAGE_SIZE >> 1]; // 128 16-bit numbers = 256 bytes
 
+    if (bitmapNumber < FLASH_BITMAP_DIRECTORY_SIZE) {
+        if (!bitmapDirectoryLoaded)
+            loadBitmapDirectory();
+        uint32_t entry = bitmapDirectory[bitmapNumber];
+        *bitmapWidth = DIRECTORY_WIDTH(entry);
+        *bitmapHeight = DIRECTORY_HEIGHT(entry);
+        return entry? DIRECTORY_PAGE(entry) : 0xFFFF;
+    }
+
     // Read in the address table for the current bitmap
     tablePage = FLASH_BITMAP_ADDRESS_TABLE + (bitmapNumber / FLASH_ADDRESSES_PER_PAGE);
     pageOffset = (bitmapNumber % FLASH_ADDRESSES_PER_PAGE) * (FLASH_ADDRESS_SIZE >> 1);
-    startRead(tablePage, FLASH_C3_PAGE_SIZE, (uint8_t *) addressTable);
-    endRead();
+    readFlash(tablePage, FLASH_C3_PAGE_SIZE, (uint8_t *) addressTable);
 
     *bitmapWidth = addressTable[pageOffset + 1];
     *bitmapHeight = addressTable[pageOffset + 2];
@@ -610,6 +980,42 @@ uint16_t Controleo3Flash::getBitmapInfo(uint16_t bitmapNumber, uint16_t *bitmapW
 }
 
 
+// Read the bitmap address table into RAM.  The table is only changed during factory
+// initialization (see getBitmapPage) so it only needs to be read once at boot, and
+// rendering a bitmap no longer needs a 256-byte table page read to fetch 6 bytes.
+void Controleo3Flash::loadBitmapDirectory()
+{
+    uint16_t bitmapNumber = 0, tablePage = FLASH_BITMAP_ADDRESS_TABLE;
+    uint16_t addressTable[FLASH_C3_PAGE_SIZE >> 1]; // 128 16-bit numbers = 256 bytes
+
+    while (bitmapNumber < FLASH_BITMAP_DIRECTORY_SIZE) {
+        startRead(tablePage++, FLASH_ADDRESSES_PER_PAGE * FLASH_ADDRESS_SIZE, (uint8_t *) addressTable);
+        endRead();
+
+        uint16_t *entry = addressTable;
+        for (uint8_t i=0; i < FLASH_ADDRESSES_PER_PAGE && bitmapNumber < FLASH_BITMAP_DIRECTORY_SIZE; i++) {
+            setBitmapDirectoryEntry(bitmapNumber++, entry[0], entry[1], entry[2]);
+            entry += FLASH_ADDRESS_SIZE >> 1;
+        }
+    }
+    bitmapDirectoryLoaded = true;
+}
+
+
+// Update one entry in the RAM bitmap directory
+void Controleo3Flash::setBitmapDirectoryEntry(uint16_t bitmapNumber, uint16_t page, uint16_t bitmapWidth, uint16_t bitmapHeight)
+{
+    if (bitmapNumber >= FLASH_BITMAP_DIRECTORY_SIZE)
+        return;
+
+    // Erased table entries are 0xFFFF
+    if (page > 0xFFF || bitmapWidth > 0x3FF || bitmapHeight > 0x3FF)
+        bitmapDirectory[bitmapNumber] = 0;
+    else
+        bitmapDirectory[bitmapNumber] = DIRECTORY_ENTRY(page, bitmapWidth, bitmapHeight);
+}
+
+
 // Write 8 bits to flash
 void Controleo3Flash::write8(uint8_t data)
 {
@@ -644,6 +1050,8 @@ uint8_t Controleo3Flash::read8()
 // One-bit read
 void Controleo3Flash::slowRead(uint16_t pageNumber, uint16_t bytesToRead, uint8_t *dest)
 {
+    lock();
+
     // Make sure previous commands have finished executing
     waitUntilNotBusy(50);
 
@@ -663,12 +1071,17 @@ void Controleo3Flash::slowRead(uint16_t pageNumber, uint16_t bytesToRead, uint8_
     }
     // End the read
     FLASH_CS_IDLE;
+    unlock();
 }
 
 
 // One bit write
 void Controleo3Flash::slowWrite(uint16_t pageNumber, uint16_t bytesToWrite, uint8_t *src)
 {
+    lock();
+
+    invalidateFlashCache(pageNumber, 1);
+
     // Make sure previous commands have finished executing
     waitUntilNotBusy(50);
 
@@ -692,6 +1105,8 @@ void Controleo3Flash::slowWrite(uint16_t pageNumber, uint16_t bytesToWrite, uint
 
     // End the write
     FLASH_CS_IDLE;
+    startOperation(FLASH_OP_PROGRAM_PAGE);
+    unlock();
 }
 
 
@@ -9,6 +9,8 @@
 
 #include <stdint.h>
 #include "bits.h"
+#include "SimplePIO.h"
+#include "rtos_support.h"
 
 // SCK is PA13
 #define FLASH_CLK_ACTIVE      (*portAOut |= SETBIT13)
@@ -37,6 +39,11 @@
 
 #define FLASH_PULSE_CLK       { FLASH_CLK_IDLE; FLASH_CLK_ACTIVE; }
 
+// Number of entries held in the RAM copy of the bitmap address table.  This must be
+// at least BITMAP_LAST_ONE + 1 (see ReflowWizard.h).  Each entry is packed into 32 bits
+// (12-bit page, 10-bit width, 10-bit height) so the whole directory is about 1K of RAM.
+#define FLASH_BITMAP_DIRECTORY_SIZE   258
+
 
 class Controleo3Flash {
     public:
@@ -50,6 +57,13 @@ class Controleo3Flash {
       void startRead(uint16_t pageNumber, uint16_t bytesToRead, uint8_t *dest);
       void continueRead(uint16_t bytesToRead, uint8_t *dest);
       void endRead();
+      void benchmarkRead();
+      void lock();
+      void unlock();
+      void enableLocking();
+      void startErase4K(uint16_t pageNumber);
+      bool isBusy();
+      void printBusyTimes();
       void write(uint16_t pageNumber, uint16_t bytesToWrite, uint8_t *src);
       void slowRead(uint16_t pageNumber, uint16_t bytesToRead, uint8_t *dest);
       void slowWrite(uint16_t pageNumber, uint16_t bytesToWrite, uint8_t *src);
@@ -59,14 +73,38 @@ class Controleo3Flash {
       void erasePrefsBlock(uint8_t block);
       void eraseProfileBlock(uint16_t block);
       void allowWritingToPrefs(bool allow);
+      void allowWritingToBitmaps(bool allow);
+      void erasePages(uint16_t firstPage, uint16_t pages);
       uint16_t getBitmapPage(uint16_t bitmapNumber, uint16_t bitmapWidth, uint16_t bitmapHeight);
       uint16_t getBitmapInfo(uint16_t bitmapNumber, uint16_t *bitmapWidth, uint16_t *bitmapHeight);
+      void loadBitmapDirectory();
 
 private:
-  		volatile uint32_t *portAOut, *portAIn, *portAMode;
+  		PORT_REGISTER *portAOut, *portAIn, *portAMode;
+      uint32_t bitmapDirectory[FLASH_BITMAP_DIRECTORY_SIZE];
+      bool bitmapDirectoryLoaded;
+      uint8_t pendingOperation;
+      uint32_t operationStart;
+      SemaphoreHandle_t busMutex;
+      bool eraseSuspended;
+      uint32_t eraseResumed;
+      void suspendErase();
+      void resumeErase();
+      void startOperation(uint8_t operation);
+      void endOperation(bool timedOut);
+      void setBitmapDirectoryEntry(uint16_t bitmapNumber, uint16_t page, uint16_t bitmapWidth, uint16_t bitmapHeight);
       void setPinIOMode(uint8_t mode);
       void write8(uint8_t data);
       uint8_t read8();
 };
 
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+void PrintFlashBenchmark(void);
+#ifdef __cplusplus
+}
+#endif
+
 #endif // CONTROLEO3FLASH_H_
\ No newline at end of file
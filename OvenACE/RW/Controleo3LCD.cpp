@@ -11,31 +11,145 @@
 // drawing speed.
 //#define LCD_DEBUG
 
+// LCD_STATS counts the commands, bytes and strobes sent to the LCD.  It slows drawing
+// down a little, so it should only be enabled when measuring.
+//#define LCD_STATS
+
+// LCD_DMA uses the DMA controller to do large fills where the high and low bytes of
+// the color are the same (like fillScreen(WHITE)).  fillRect() and fillScreen() return
+// as soon as the fill has started, so the CPU is free to do other things.  The next
+// call that uses the LCD waits for the fill to finish.  Comment this out to always
+// use the CPU.
+#define LCD_DMA
+
+// LCD_ASM uses the assembly routines in BitBash.S to write and read pixels.  They use
+// the single cycle IOBUS, so writes are much faster than the C versions.  Reads follow
+// the ILI9488 read timing.  Comment this out to use the C versions (for example, to
+// compare them using the 'P' debug command).  The host tests (tests/host) use the C versions.
+#ifndef HOST_TEST
+#define LCD_ASM
+#endif
+
 #include "Controleo3LCD.h"
 #include "SimplePIO.h"
+#include "HWPinAssignments.h"
 #include "rtos_support.h"
 #include "ArduinoDefs.h"
+#include "printf-stdarg.h"
+#include "string.h"
+#include "BitBash.h"
+
+#ifdef LCD_STATS
+struct lcdStatistics lcdStats;
+#endif
+
+#ifdef LCD_DMA
+#include <hpl_dma.h>
+
+// The DMA channel is set up in hpl_dmac_config.h (32-bit beats, no address increments)
+#define LCD_DMA_CHANNEL             14
+
+// Smaller fills are quicker using the CPU
+#define LCD_DMA_MINIMUM_PIXELS      4096
+
+// BTCNT is 16 bits.  This must be even so that WR is always high between blocks.
+#define LCD_DMA_MAXIMUM_TOGGLES     65534
+
+// The DMA writes the WR bit to PORTB's OUTTGL register, so each beat is half of a
+// write strobe.  Nothing else on PORTB is touched, so the relays on PB8 and PB9 can
+// safely be switched while a fill is in progress.  Every other PORTB output (the LCD
+// macros, relays, servo and debug LED) uses OUTSET/OUTCLR, so none of them can undo a
+// toggle; the LCD code itself waits for the fill to finish before it starts.
+static const uint32_t lcdDMAToggle = SETBIT13;
+static volatile uint32_t lcdDMATogglesLeft = 0;
+static volatile bool lcdDMABusy = false;
+static SemaphoreHandle_t lcdDMADone = NULL;
+static void (*lcdFillCompleteCallback)(void) = NULL;
+
+
+// Start the next block of the fill
+static void lcdDMAStartBlock()
+{
+    uint32_t toggles = lcdDMATogglesLeft;
+
+    if (toggles > LCD_DMA_MAXIMUM_TOGGLES)
+        toggles = LCD_DMA_MAXIMUM_TOGGLES;
+    lcdDMATogglesLeft -= toggles;
+
+    _dma_set_source_address(LCD_DMA_CHANNEL, &lcdDMAToggle);
+    _dma_set_destination_address(LCD_DMA_CHANNEL, (void *) &PORT_OUTTGL(PB(0)));
+    _dma_set_data_amount(LCD_DMA_CHANNEL, toggles);
+    _dma_enable_transaction(LCD_DMA_CHANNEL, true);
+}
+
+
+// Called (from the DMAC interrupt) when a block has been sent.  On an error the rest of
+// the fill is abandoned; part of the area will be left unfilled.
+static void lcdDMABlockDone(struct _dma_resource *resource)
+{
+    (void) resource;
+
+    if (lcdDMATogglesLeft) {
+        lcdDMAStartBlock();
+        return;
+    }
+
+    // The fill is complete.  Use OUTSET to release CS so no other bits are affected.
+    LCD_STAT(transactions, 1);
+    PORT_OUTSET(PB(0)) = SETBIT15;
+    lcdDMABusy = false;
+    xSemaphoreGiveFromISR(lcdDMADone, NULL);
+    if (lcdFillCompleteCallback)
+        lcdFillCompleteCallback();
+}
+
+
+static void lcdDMAError(struct _dma_resource *resource)
+{
+    lcdDMATogglesLeft = 0;
+    lcdDMABlockDone(resource);
+}
+#endif
 
 // Constructor for the TFT display
 Controleo3LCD::Controleo3LCD(void)
 {
     // Get the addresses of Port B
-    portBOut   = &PORT_OUT(PB(0));
+    portBSet   = &PORT_OUTSET(PB(0));
+    portBClr   = &PORT_OUTCLR(PB(0));
     portBIn    = &PORT_IN(PB(0));
     portBMode  = &PORT_DIR(PB(0));
-    flood8Reg  = ((uint8_t *) portBOut) + 1;
-    bitmapReg  = ((uint16_t *) portBOut);
 }
 
 
 void Controleo3LCD::begin()
 {
+#ifdef LCD_DMA
+    struct _dma_resource *resource;
+
+    if (!lcdDMADone) {
+        lcdDMADone = xSemaphoreCreateBinary();
+        _dma_get_channel_resource(&resource, LCD_DMA_CHANNEL);
+        resource->dma_cb.transfer_done = lcdDMABlockDone;
+        resource->dma_cb.error = lcdDMAError;
+        _dma_set_irq_state(LCD_DMA_CHANNEL, DMA_TRANSFER_COMPLETE_CB, true);
+        _dma_set_irq_state(LCD_DMA_CHANNEL, DMA_TRANSFER_ERROR_CB, true);
+    }
+#endif
+    waitUntilIdle();
+
     // Set RD, WR, CD, CS and data pins to be outputs
     *portBMode |= (SETBIT12 + SETBIT13 + SETBIT14 + SETBIT15 + SETBIT16 + 0xFF);
 
     // Pull RD high so writes work
     LCD_RD_ACTIVE;
 
+#ifdef LCD_ASM
+    // The assembly read routines read the data pins through the IOBUS, which only
+    // works if the pins are sampled continuously
+    PORT_CTRL(PB(0)) |= 0xFF;
+#endif
+
 	// Do a hard reset
     reset(HARD_RESET);
 
@@ -56,15 +170,15 @@ void Controleo3LCD::readMode(bool enable)
     if (enable) {
         // Set data pins to input mode
         for (int i=0; i<8; i++) {
-            PORT->Group[PORTB].PINCFG[i].reg=(uint8_t)(PORT_PINCFG_INEN);
-            PORT->Group[PORTB].DIRCLR.reg = (uint32_t)(1<<i);
+            PORT_PINCFG(PB(i)).reg = (uint8_t)(PORT_PINCFG_INEN);
+            PORT_DIRCLR(PB(0)) = (uint32_t)(1<<i);
         }
     }
     else {
         // Set pin to output mode
         for (int i=0; i<8; i++) {
-            PORT->Group[PORTB].PINCFG[i].reg&=~(uint8_t)(PORT_PINCFG_INEN);
-            PORT->Group[PORTB].DIRSET.reg = (uint32_t)(1<<i);
+            PORT_PINCFG(PB(i)).reg &= ~(uint8_t)(PORT_PINCFG_INEN);
+            PORT_DIRSET(PB(0)) = (uint32_t)(1<<i);
         }
     }
 }
@@ -74,6 +188,7 @@ void Controleo3LCD::readMode(bool enable)
 // type = HARD_RESET or SOFT_RESET
 void Controleo3LCD::reset(uint8_t type)
 {
+    waitUntilIdle();
     if (type == HARD_RESET) {
         LCD_RESET_LOW;
         delayMicroseconds(10);
@@ -94,6 +209,7 @@ uint32_t Controleo3LCD::getLCDVersion()
 {
     uint32_t version = 0;
 
+    waitUntilIdle();
     write8Command(ILI9488_READ_DISPLAY_INFO);
     LCD_WR_ACTIVE;
     readMode(true);
@@ -122,6 +238,8 @@ void Controleo3LCD::setAddrWindow(int x1, int y1, int x2, int y2)
 	checkRange(y1, 0, LCD_MAX_Y, "setAddrWindow:y1");
 	checkRange(y2, 0, LCD_MAX_Y, "setAddrWindow:y2");
 #endif
+    waitUntilIdle();
+    LCD_STAT(windows, 1);
     writeRegister16x2(ILI9488_COLADDRSET, x1, x2);
     writeRegister16x2(ILI9488_PAGEADDRSET, y1, y2);
 }
@@ -129,52 +247,85 @@ void Controleo3LCD::setAddrWindow(int x1, int y1, int x2, int y2)
 
 // Fills the window (set using setAddrWindow) with pixels of the specified color
 // This routine is (fairly) heavily optimized for performance.
-void Controleo3LCD::flood(uint16_t color, uint32_t len)
+// Returns true if the DMA controller is finishing the fill (and will release CS)
+bool Controleo3LCD::flood(uint16_t color, uint32_t len)
 {
     uint8_t high = highByte(color), low = lowByte(color);
 
+    // Nothing to fill (fillRect with a width or height of 0).  The loops below
+    // would otherwise count down from 0
+    if (!len)
+        return false;
+
     write8Command(ILI9488_MEMORYWRITE);
 
+#ifdef LCD_DMA
+    if (high == low && len >= LCD_DMA_MINIMUM_PIXELS && lcdDMADone) {
+        // Write the first pixel to set the color
+        write8Data(high);
+        LCD_WR_IDLE;
+        LCD_WR_ACTIVE;
+        // Two strobes per pixel, two toggles per strobe
+        LCD_STAT(strobes, ((len - 1) << 1) + 1);
+        lcdDMABusy = true;
+        lcdDMATogglesLeft = (len - 1) << 2;
+        lcdDMAStartBlock();
+        return true;
+    }
+#endif
+
+#ifdef LCD_ASM
+    LCD_STAT(bytesWritten, len << 1);
+    LCD_FLOOD(color, len);
+#else
     // Optimize the case where high == low
     if (high == low) {
         // Write the first pixel to set the color
         write8Data(high);
         LCD_WR_IDLE;
         LCD_WR_ACTIVE;
-        len--;
-
-        // Get the current value of the register used for the write bit
-        // This method is dangerous because we'll be ignoring changes in the other
-        // bits for the duration of these writes.  However, the affected pins are
-        // Relays 4 to 6, Touch IRQ and some LCD pins so there is no downside.
-        uint8_t writeIdle = *flood8Reg & 0xDF;
-        uint8_t writeActive = writeIdle | 0x20;
-
-        #define WR_STROBE       {*flood8Reg = writeIdle; *flood8Reg = writeActive;}
-
-        uint32_t setsOf8 = len >> 3;
-        len &= 0x7;
-
-        // Do 16 pixels at a time
-        // Time to clear screen:
-        // 1 at a time = 64ms
-        // 8 at a time = 54ms
-        // 16 at a time = 55ms (yes, longer)
-        while (setsOf8--) {
-            WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;
-            WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;
-        }
-        while (len--) {
-            WR_STROBE;
-            WR_STROBE;
-        }
-        return;
+        LCD_STAT(strobes, 1);
+        strobeRepeat(len - 1);
+        return false;
     }
 
     while (len--) {
         write8Data(high);
         write8Data(low);
     }
+#endif
+    return false;
+}
+
+
+// Repeat the pixel currently on the data lines len times, by toggling just the write bit.
+// The high and low bytes of the pixel must be the same, and already on the data lines.
+void Controleo3LCD::strobeRepeat(uint32_t len)
+{
+    // Only the write bit is changed (through OUTCLR and OUTSET), so the relays on
+    // the same byte of PORTB can be switched while this runs
+    PORT_REGISTER *clr = portBClr, *set = portBSet;
+
+    LCD_STAT(strobes, len << 1);
+
+    #define WR_STROBE       {*clr = SETBIT13; *set = SETBIT13;}
+
+    uint32_t setsOf8 = len >> 3;
+    len &= 0x7;
+
+    // Do 16 pixels at a time
+    // Time to clear screen:
+    // 1 at a time = 64ms
+    // 8 at a time = 54ms
+    // 16 at a time = 55ms (yes, longer)
+    while (setsOf8--) {
+        WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;
+        WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;WR_STROBE;
+    }
+    while (len--) {
+        WR_STROBE;
+        WR_STROBE;
+    }
 }
 
 
@@ -237,8 +388,8 @@ void Controleo3LCD::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_
 #endif
 
     setAddrWindow(x, y, x + w - 1, y + h - 1);
-    flood(fillcolor, (uint32_t) w * (uint32_t) h);
-    LCD_CS_IDLE;
+    if (!flood(fillcolor, (uint32_t) w * (uint32_t) h))
+        LCD_CS_IDLE;
 }
 
 
@@ -246,8 +397,8 @@ void Controleo3LCD::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_
 void Controleo3LCD::fillScreen(uint16_t color) {
 	// The screen takes rotation into account
     setAddrWindow(0, 0, LCD_MAX_X, LCD_MAX_Y);
-    flood(color, (uint32_t) LCD_WIDTH * (uint32_t) LCD_HEIGHT);
-    LCD_CS_IDLE;
+    if (!flood(color, (uint32_t) LCD_WIDTH * (uint32_t) LCD_HEIGHT))
+        LCD_CS_IDLE;
 }
 
 
@@ -276,8 +427,6 @@ void Controleo3LCD::startBitmap(int16_t x, int16_t y, int16_t w, int16_t h)
 
     setAddrWindow(x, y, x + w - 1, y + h - 1);
     write8Command(ILI9488_MEMORYWRITE);
-
-    bitmapRegValue = *bitmapReg & 0xDF00;    // Clear the write bit
 }
 
 
@@ -286,12 +435,108 @@ void Controleo3LCD::startBitmap(int16_t x, int16_t y, int16_t w, int16_t h)
 // bitmap has been rendered to the screen.
 void Controleo3LCD::drawBitmap(uint16_t *data, uint32_t len)
 {
-#define write8DataBitmap(d)  *bitmapReg = (bitmapRegValue + d); LCD_WR_ACTIVE;
+    LCD_STAT(bytesWritten, len << 1);
+#ifdef LCD_ASM
+    LCD_WRITE_BITMAP(data, len);
+#else
+#define write8DataBitmap(d)  { *portBClr = 0x20FF; *portBSet = (d); LCD_WR_ACTIVE; }
 	while(len--) {
     	write8DataBitmap(highByte(*data));
     	write8DataBitmap(lowByte(*data));
         data++;
     }
+#endif
+}
+
+
+// Draw len pixels of the same color as part of a bitmap.  Used to draw run-length
+// encoded bitmaps, between calls to drawBitmap().
+void Controleo3LCD::drawBitmapRun(uint16_t color, uint32_t len)
+{
+    if (!len)
+        return;
+#ifdef LCD_ASM
+    LCD_STAT(bytesWritten, len << 1);
+    LCD_FLOOD(color, len);
+#else
+    uint8_t high = highByte(color), low = lowByte(color);
+
+    LCD_STAT(bytesWritten, 2);
+
+    // Write the first pixel to put the color on the data lines
+    write8DataBitmap(high);
+    write8DataBitmap(low);
+    len--;
+
+    // White and black (and other colors where high == low) just need the write bit
+    // toggled, the same as flood()
+    if (high == low) {
+        strobeRepeat(len);
+        return;
+    }
+
+    LCD_STAT(bytesWritten, len << 1);
+	while(len--) {
+    	write8DataBitmap(high);
+    	write8DataBitmap(low);
+    }
+#endif
+}
+
+
+// Draw part or all of a run-length encoded bitmap (see Bitmaps.cpp for the format)
+// Runs and literal pixels are written in the same bitmap window, so CS stays active
+// and MEMORYWRITE is only sent once by startBitmap().  Returns false if the data is
+// corrupt (a run or literal goes past len pixels).
+bool Controleo3LCD::drawBitmapRLE(const uint16_t *data, uint32_t len)
+{
+#ifdef LCD_ASM
+    LCD_STAT(bytesWritten, len << 1);
+    return LCD_WRITE_RLE(data, len);
+#else
+    uint16_t count;
+
+    while (len) {
+        count = *data & 0x7FFF;
+        if (count == 0 || count > len)
+            return false;
+        if (*data++ & 0x8000)
+            drawBitmapRun(*data++, count);
+        else {
+            drawBitmap((uint16_t *) data, count);
+            data += count;
+        }
+        len -= count;
+    }
+    return true;
+#endif
+}
+
+
+// Draw part or all of a bitmap straight from external flash, without copying it to RAM
+// first.  The flash must be in the middle of a quad read (see Controleo3Flash::startRead)
+// positioned at the next pixel.  Pixels in flash are stored low byte first.
+void Controleo3LCD::drawBitmapFromFlash(uint32_t len)
+{
+    if (!len)
+        return;
+    LCD_STAT(bytesWritten, len << 1);
+#ifdef LCD_ASM
+    FLASH_TO_LCD(len);
+#else
+    uint8_t low, high;
+
+    // Each nibble is clocked out on the falling edge of CLK
+    #define readFlashNibble()  (PORT_OUTCLR(FLASH_CLK) = PBITRAW(FLASH_CLK), PORT_OUTSET(FLASH_CLK) = PBITRAW(FLASH_CLK), (PORT_IN(PA(0)) >> 16) & 0x0F)
+	while(len--) {
+        low = readFlashNibble() << 4;
+        low += readFlashNibble();
+        high = readFlashNibble() << 4;
+        high += readFlashNibble();
+    	write8DataBitmap(high);
+    	write8DataBitmap(low);
+    }
+#endif
 }
 
 
@@ -302,9 +547,40 @@ void Controleo3LCD::endBitmap()
 }
 
 
+// Returns true while a DMA fill is in progress
+bool Controleo3LCD::isBusy()
+{
+#ifdef LCD_DMA
+    return lcdDMABusy;
+#else
+    return false;
+#endif
+}
+
+
+// Wait for a DMA fill to finish.  Other tasks can run while waiting.
+void Controleo3LCD::waitUntilIdle()
+{
+#ifdef LCD_DMA
+    while (lcdDMABusy)
+        xSemaphoreTake(lcdDMADone, pdMS_TO_TICKS(10));
+#endif
+}
+
+
+// Set a function to be called (from the DMA interrupt) when a DMA fill completes
+void Controleo3LCD::setFillCompleteCallback(void (*callback)(void))
+{
+#ifdef LCD_DMA
+    lcdFillCompleteCallback = callback;
+#endif
+}
+
+
 // Allow users to write directly to LCD registers.  See ILI9488.h
 void Controleo3LCD::pokeRegister(uint8_t reg)
 {
+    waitUntilIdle();
     write8Command(reg);
     LCD_CS_IDLE;
 }
@@ -313,6 +589,7 @@ void Controleo3LCD::pokeRegister(uint8_t reg)
 // Allow users to write directly to LCD registers.  See ILI9488.h
 void Controleo3LCD::setRegister8(uint8_t a, uint8_t d)
 {
+    waitUntilIdle();
     writeRegister8(a,d);
     LCD_CS_IDLE;
 }
@@ -339,6 +616,11 @@ void Controleo3LCD::startReadBitmap(int16_t x, int16_t y, int16_t w, int16_t h)
 // Read a bitmap (used for screenshots)
 void Controleo3LCD::readBitmapRGB565(uint16_t *data, uint32_t len)
 {
+#ifdef LCD_ASM
+    LCD_STAT(bytesRead, len * 3);
+    if (len)
+        LCD_READ_RGB565(data, len);
+#else
 	while(len--) {
         // Red
     	*data = (read8Data() & 0xF8) << 8;
@@ -349,6 +631,7 @@ void Controleo3LCD::readBitmapRGB565(uint16_t *data, uint32_t len)
 
         data++;
     }
+#endif
 }
 
 
@@ -357,12 +640,18 @@ void Controleo3LCD::readBitmapRGB565(uint16_t *data, uint32_t len)
 // bitmap has been rendered to the screen.
 void Controleo3LCD::readBitmap24bit(uint8_t *data, uint32_t len)
 {
+#ifdef LCD_ASM
+    LCD_STAT(bytesRead, len * 3);
+    if (len)
+        LCD_READ_24BIT(data, len);
+#else
 	while(len--) {
         *(data+2) = read8Data();
         *(data+1) = read8Data();
         *(data+0) = read8Data();
         data+= 3;
     }
+#endif
 }
 
 
@@ -381,6 +670,7 @@ void Controleo3LCD::endReadBitmap()
 uint8_t Controleo3LCD::read8Data()
 {
     // Toggle the read bit
+    LCD_STAT(bytesRead, 1);
     LCD_RD_ACTIVE;
     LCD_RD_IDLE;
     return *portBIn;
@@ -419,3 +709,73 @@ void Controleo3LCD::checkRange(int val, int low, int high, char *msg)
 }
 #endif
 
+
+
+// Print the LCD bus statistics on the debug console, then reset them.  Reset before
+// drawing a screen and print afterwards to see what the screen cost.
+void PrintLCDStats()
+{
+#ifdef LCD_STATS
+    printfD("  Transactions  = %u\n", (unsigned int) lcdStats.transactions);
+    printfD("  Commands      = %u\n", (unsigned int) lcdStats.commands);
+    printfD("  Windows       = %u\n", (unsigned int) lcdStats.windows);
+    printfD("  Bytes written = %u\n", (unsigned int) lcdStats.bytesWritten);
+    printfD("  Strobes       = %u\n", (unsigned int) lcdStats.strobes);
+    printfD("  Bytes read    = %u\n", (unsigned int) lcdStats.bytesRead);
+    memset(&lcdStats, 0, sizeof(lcdStats));
+#else
+    printfD("  Not enabled (define LCD_STATS in Controleo3LCD.cpp)\n");
+#endif
+}
+
+
+// Time the main drawing routines with the CPU cycle counter (TC4) and print the results.
+// This draws over the screen, so it should only be used when the oven is idle.  Build
+// with and without LCD_ASM and LCD_DMA to compare the different versions.
+void PrintLCDBenchmark()
+{
+    extern Controleo3LCD tft;
+    uint16_t pixels[LCD_WIDTH / 8];
+    uint32_t start, cycles;
+    uint16_t i, row;
+
+    // A gradient, so the bitmap isn't all the same color
+    for (i=0; i < LCD_WIDTH / 8; i++)
+        pixels[i] = i * 0x0421;
+
+    #define PRINT_BENCHMARK(name)  cycles = CPU_HZ_COUNTER() - start; \
+        printfD("  %-24s = %9u cycles (%u ms)\n", name, (unsigned int) cycles, (unsigned int) (cycles / (configCPU_CLOCK_HZ / 1000)));
+
+    start = CPU_HZ_COUNTER();
+    tft.fillScreen(WHITE);
+    tft.waitUntilIdle();
+    PRINT_BENCHMARK("fillScreen(WHITE)");
+
+    start = CPU_HZ_COUNTER();
+    tft.fillScreen(DARK_GREY);
+    PRINT_BENCHMARK("fillScreen(DARK_GREY)");
+
+    start = CPU_HZ_COUNTER();
+    tft.startBitmap(0, 0, LCD_WIDTH, LCD_HEIGHT);
+    for (row=0; row < LCD_HEIGHT; row++)
+        for (i=0; i < 8; i++)
+            tft.drawBitmap(pixels, LCD_WIDTH / 8);
+    tft.endBitmap();
+    PRINT_BENCHMARK("drawBitmap 480x320");
+
+    start = CPU_HZ_COUNTER();
+    tft.startBitmap(0, 0, LCD_WIDTH, LCD_HEIGHT);
+    for (row=0; row < LCD_HEIGHT; row++)
+        for (i=0; i < 8; i++)
+            tft.drawBitmapRun(i & 1? WHITE : DARK_GREY, LCD_WIDTH / 8);
+    tft.endBitmap();
+    PRINT_BENCHMARK("drawBitmapRun 480x320");
+
+    start = CPU_HZ_COUNTER();
+    tft.startReadBitmap(0, 0, LCD_WIDTH, 10);
+    for (row=0; row < 10; row++)
+        for (i=0; i < 8; i++)
+            tft.readBitmapRGB565(pixels, LCD_WIDTH / 8);
+    tft.endReadBitmap();
+    PRINT_BENCHMARK("readBitmapRGB565 480x10");
+}
@@ -9,6 +9,7 @@
 
 #include <stdint.h>
 #include "bits.h"
+#include "SimplePIO.h"
 #include "ILI9488.h"
 
 #define LCD_WIDTH  		480
@@ -17,33 +18,56 @@
 #define LCD_MAX_Y		319
 
 
+// When LCD_STATS is defined (see Controleo3LCD.cpp) the bus activity is counted, so the
+// cost of drawing a screen can be measured.  Use 'L' on the debug console to see them.
+#ifdef LCD_STATS
+struct lcdStatistics {
+    uint32_t transactions;          // Number of times CS went idle
+    uint32_t commands;              // Command bytes written
+    uint32_t windows;               // Calls to setAddrWindow (10 bytes each)
+    uint32_t bytesWritten;          // Data bytes written (data lines set and WR strobed)
+    uint32_t strobes;               // Data bytes repeated by just strobing WR
+    uint32_t bytesRead;             // Data bytes read
+};
+extern struct lcdStatistics lcdStats;
+#define LCD_STAT(counter, n)        (lcdStats.counter += (n))
+#else
+#define LCD_STAT(counter, n)        ((void) 0)
+#endif
+
+
+// The pins are only changed through PORTB's OUTSET and OUTCLR registers, never with a
+// read-modify-write of OUT.  The relays and servo on PORTB are switched from other tasks
+// and interrupts, and the DMA fill toggles WR through OUTTGL.
+
 // RD is PB12
-#define LCD_RD_ACTIVE       (*portBOut |= SETBIT12)
-#define LCD_RD_IDLE			    (*portBOut &= CLEARBIT12)
+#define LCD_RD_ACTIVE       (*portBSet = SETBIT12)
+#define LCD_RD_IDLE			    (*portBClr = SETBIT12)
 
 // WR is PB13
-#define LCD_WR_ACTIVE       (*portBOut |= SETBIT13)
-#define LCD_WR_IDLE			    (*portBOut &= CLEARBIT13)
+#define LCD_WR_ACTIVE       (*portBSet = SETBIT13)
+#define LCD_WR_IDLE			    (*portBClr = SETBIT13)
 
 // CD is PB14
-#define LCD_CD_DATA         (*portBOut |= SETBIT14)
-#define LCD_CD_COMMAND      (*portBOut &= CLEARBIT14)
+#define LCD_CD_DATA         (*portBSet = SETBIT14)
+#define LCD_CD_COMMAND      (*portBClr = SETBIT14)
 
 // CS is PB15
-#define LCD_CS_IDLE         (*portBOut |= SETBIT15)
-#define LCD_CS_ACTIVE       (*portBOut &= CLEARBIT15)
+#define LCD_CS_IDLE         (LCD_STAT(transactions, 1), *portBSet = SETBIT15)
+#define LCD_CS_ACTIVE       (*portBClr = SETBIT15)
 
 // RESET is PB16
-#define LCD_RESET_HIGH      (*portBOut |= SETBIT16)
-#define LCD_RESET_LOW     	(*portBOut &= CLEARBIT16)
+#define LCD_RESET_HIGH      (*portBSet = SETBIT16)
+#define LCD_RESET_LOW     	(*portBClr = SETBIT16)
 
 
 // Command terminator: set WR and CD
-#define LCD_END_COMMAND     (*portBOut |= (SETBIT13 + SETBIT14))
+#define LCD_END_COMMAND     (*portBSet = (SETBIT13 + SETBIT14))
 
 
-#define write8Command(d)            { *portBOut &= 0xFFFF1F00; *portBOut |= (d); LCD_END_COMMAND;}
-#define write8Data(d)               { *portBOut &= 0xFFFFDF00; *portBOut |= (d); LCD_WR_ACTIVE; }
+// Commands clear the data pins, WR, CD and CS (selecting the LCD); data clears the data pins and WR
+#define write8Command(d)            { LCD_STAT(commands, 1); *portBClr = 0xE0FF; *portBSet = (d); LCD_END_COMMAND;}
+#define write8Data(d)               { LCD_STAT(bytesWritten, 1); *portBClr = 0x20FF; *portBSet = (d); LCD_WR_ACTIVE; }
 
 #define writeRegister8(a,d)		    { write8Command(a); write8Data(d);}
 #define writeRegister16(a,d)	    { write8Command(a); write8Data(highByte(d)); write8Data(lowByte(d));}
@@ -90,9 +114,16 @@ class Controleo3LCD
   	void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t c);
   	void fillScreen(uint16_t color);
 
+  	bool isBusy();
+  	void waitUntilIdle();
+  	void setFillCompleteCallback(void (*callback)(void));
+
   	void startBitmap(int16_t x, int16_t y, int16_t w, int16_t h);
   	void endBitmap();
   	void drawBitmap(uint16_t *data, uint32_t len);
+  	void drawBitmapRun(uint16_t color, uint32_t len);
+  	bool drawBitmapRLE(const uint16_t *data, uint32_t len);
+  	void drawBitmapFromFlash(uint32_t len);
 
     void startReadBitmap(int16_t x, int16_t y, int16_t w, int16_t h);
     void readBitmapRGB565(uint16_t *data, uint32_t len);
@@ -107,15 +138,22 @@ class Controleo3LCD
 
 	private:
 		void setAddrWindow(int x1, int y1, int x2, int y2);
-		void flood(uint16_t color, uint32_t len);
+		bool flood(uint16_t color, uint32_t len);
+		void strobeRepeat(uint32_t len);
     	void readMode(bool enable);
     	uint8_t read8Data();
-		volatile uint32_t *portBOut, *portBMode, *portBIn;
-    	volatile uint8_t *flood8Reg;
-    	volatile uint16_t *bitmapReg;
-    	uint16_t bitmapRegValue;
+		PORT_REGISTER *portBSet, *portBClr, *portBMode, *portBIn;
 		void checkRange(int val, int low, int high, char *msg);
 };
 
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+void PrintLCDStats(void);
+void PrintLCDBenchmark(void);
+#ifdef __cplusplus
+}
+#endif
+
 #endif // CONTROLEO3LCD_H_
@@ -638,3 +638,34 @@ void File::rewindDirectory(void) {
 SDClass SD;
 
 };
+
+
+// Print the SD card read benchmark on the debug console.  The card is initialized again
+// first, so don't use this while the controller is using the SD card.
+void PrintSDCardBenchmark()
+{
+  if (!SD.begin())
+    return;
+  SdVolume::sdCard()->benchmarkRead();
+}
+
+
+static volatile bool sdCardBenchmarkRequested = false;
+
+
+// Ask the UI task to run the SD card benchmark, the next time it waits for a tap.  The UI
+// task is the only one that uses the SD card, and the USB task's stack is too small
+void RequestSDCardBenchmark()
+{
+  sdCardBenchmarkRequested = true;
+}
+
+
+// Run the SD card benchmark if RequestSDCardBenchmark() has been called
+void runRequestedSDCardBenchmark()
+{
+  if (!sdCardBenchmarkRequested)
+    return;
+  sdCardBenchmarkRequested = false;
+  PrintSDCardBenchmark();
+}
@@ -18,7 +18,6 @@
 #include <stdint.h>
 
 #include "SdFat.h"
-#include "SdFatUtil.h"
 
 #define FILE_READ O_READ
 #define FILE_WRITE (O_READ | O_WRITE | O_CREAT)
@@ -46,6 +45,7 @@ public:
   bool seek(uint32_t pos);
   uint32_t position();
   uint32_t size();
+  uint32_t modified();
   void close();
   operator bool();
   char * name();
@@ -57,6 +57,28 @@ public:
   //using Print::write;
 };
 
+// Buffered sequential reader, for parsers that read a file one character at a time.
+// File::read() goes through SdFile for every character; this reads the file into the
+// buffer in chunks that end on the file's 512-byte block boundaries, so whole blocks
+// can come straight from the SD card, and getc()/peek() are just a pointer check.
+class FileReader {
+ private:
+  File *_file;
+  uint8_t *_buffer;
+  uint16_t _size;   // Size of the buffer (a multiple of 512 keeps the reads aligned)
+  uint8_t *_next;   // Next character to return
+  uint8_t *_end;    // End of the characters in the buffer
+  bool fill();
+
+public:
+  FileReader(File *file, uint8_t *buffer, uint16_t size);
+  // Returns the next character, or -1 at the end of the file
+  inline int getc() { return (_next < _end || fill())? *_next++ : -1; }
+  // Returns the next character without consuming it, or -1 at the end of the file
+  inline int peek() { return (_next < _end || fill())? *_next : -1; }
+  inline bool available() { return _next < _end || fill(); }
+};
+
 class SDClass {
 
 private:
@@ -123,4 +145,16 @@ typedef SDLib::File    SDFile;
 typedef SDLib::SDClass SDFileSystemClass;
 #define SDFileSystem   SDLib::SD
 
+// Run the SD card benchmark if RequestSDCardBenchmark() has been called.  Only the UI task
+// calls this, so the benchmark doesn't use the card at the same time as the UI
+void runRequestedSDCardBenchmark(void);
+
+extern "C" {
+// Print the SD card read benchmark on the debug console
+void PrintSDCardBenchmark(void);
+
+// Ask the UI task to run the SD card benchmark, the next time it waits for a tap
+void RequestSDCardBenchmark(void);
+}
+
 #endif
@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 #include "bits.h"
+#include "SimplePIO.h"
 #include "ILI9488.h"
 
 #define LCD_WIDTH  		480
@@ -51,7 +52,7 @@ class Controleo3Touch
         bool isPressed();
 
     private:
-  		volatile uint32_t *portAOut, *portAIn, *portAMode, *portBOut, *portBIn, *portBMode;
+  		PORT_REGISTER *portAOut, *portAIn, *portAMode, *portBOut, *portBIn, *portBMode;
         int16_t topLeftX,topRightX,bottomLeftX,bottomRightX,topLeftY,bottomLeftY,topRightY,bottomRightY;
 		void write8(uint8_t data);
 		uint16_t read12();
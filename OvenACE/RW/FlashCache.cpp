@@ -0,0 +1,174 @@
+// SRAM cache for pages of external flash
+//
+// The cache is a handful of whole pages.  A miss loads the whole page (even if only a
+// few bytes were asked for) into the least recently used slot, so the prefs sequence
+// number read by getPrefs() is followed by a hit when the prefs themselves are read.
+#include <stdint.h>
+#include "FlashCache.h"
+#include "FlashJobs.h"
+#include "ReflowWizard.h"
+#include "printf-stdarg.h"
+#include "string.h"
+
+#define EXTERNAL_FLASH_PAGE_SIZE        256
+
+// Regions of the flash, for the statistics (see the layout in Controleo3Flash.cpp)
+#define REGION_PREFS                    0
+#define REGION_PROFILES                 1
+#define REGION_BITMAP_TABLE             2
+#define REGION_BITMAPS                  3
+#define NUMBER_OF_REGIONS               4
+
+static const char *regionNames[NUMBER_OF_REGIONS] = {"Prefs", "Profiles", "Table", "Bitmaps"};
+
+struct flashCacheStatistics {
+  uint32_t hits;                      // Pages copied from the cache
+  uint32_t misses;                    // Pages loaded into the cache
+  uint32_t streamed;                  // Pages of long reads that weren't cached
+};
+
+static flashCacheStatistics flashCacheStats[NUMBER_OF_REGIONS];
+static uint32_t flashCacheInvalidations = 0;
+
+#if FLASH_CACHE_PAGES > 0
+struct flashCacheEntry {
+  uint16_t page;
+  bool     valid;                     // False if the slot is empty
+  uint32_t lastUsed;                  // Value of flashCacheClock when last read
+};
+
+static uint8_t flashCacheData[FLASH_CACHE_PAGES][EXTERNAL_FLASH_PAGE_SIZE];
+static flashCacheEntry flashCache[FLASH_CACHE_PAGES];
+static uint32_t flashCacheClock = 0;
+#endif
+
+
+// Which region of the flash is this page in?
+static uint8_t getRegion(uint16_t page)
+{
+  if (page < 64)
+    return REGION_PREFS;
+  if (page < 512)
+    return REGION_PROFILES;
+  if (page < 528)
+    return REGION_BITMAP_TABLE;
+  return REGION_BITMAPS;
+}
+
+
+#if FLASH_CACHE_PAGES > 0
+// Find a page in the cache.  Returns the slot, or -1 if it isn't cached
+static int8_t findPageInCache(uint16_t page)
+{
+  for (uint8_t i=0; i < FLASH_CACHE_PAGES; i++)
+    if (flashCache[i].valid && flashCache[i].page == page)
+      return i;
+  return -1;
+}
+
+
+// Read a page into the least recently used (or an empty) slot.  Returns the slot
+static uint8_t loadPageIntoCache(uint16_t page)
+{
+  uint8_t lru = 0;
+
+  for (uint8_t i=0; i < FLASH_CACHE_PAGES; i++) {
+    if (!flashCache[i].valid) {
+      lru = i;
+      break;
+    }
+    if (flashCache[i].lastUsed < flashCache[lru].lastUsed)
+      lru = i;
+  }
+
+  flash.startRead(page, EXTERNAL_FLASH_PAGE_SIZE, flashCacheData[lru]);
+  flash.endRead();
+  flashCache[lru].page = page;
+  flashCache[lru].valid = true;
+  return lru;
+}
+#endif
+
+
+// Read from external flash, starting at the beginning of a page
+void readFlash(uint16_t pageNumber, uint16_t bytesToRead, uint8_t *dest)
+{
+  bool streaming = false;
+#if FLASH_CACHE_PAGES > 0
+  bool cacheable = bytesToRead <= EXTERNAL_FLASH_PAGE_SIZE;
+#endif
+
+  // Don't read pages that are about to be erased or written
+  waitForFlashJobs(pageNumber, (bytesToRead + EXTERNAL_FLASH_PAGE_SIZE - 1) / EXTERNAL_FLASH_PAGE_SIZE);
+
+  // Writes and erases invalidate the cache with the flash locked, so keeping it locked
+  // from the lookup to the copy means a page can't be invalidated while it is loaded
+  flash.lock();
+  while (bytesToRead) {
+    uint16_t bytes = bytesToRead > EXTERNAL_FLASH_PAGE_SIZE? EXTERNAL_FLASH_PAGE_SIZE : bytesToRead;
+    flashCacheStatistics *stats = &flashCacheStats[getRegion(pageNumber)];
+
+#if FLASH_CACHE_PAGES > 0
+    int8_t slot = findPageInCache(pageNumber);
+    if (slot < 0 && cacheable) {
+      slot = loadPageIntoCache(pageNumber);
+      stats->misses++;
+    }
+    else if (slot >= 0)
+      stats->hits++;
+
+    if (slot >= 0) {
+      // A cached page ends any read that is streaming
+      if (streaming) {
+        flash.endRead();
+        streaming = false;
+      }
+      memcpy(dest, flashCacheData[slot], bytes);
+      flashCache[slot].lastUsed = ++flashCacheClock;
+    }
+    else
+#endif
+    {
+      // Pages are consecutive in flash, so a read can carry on into the next page
+      if (streaming)
+        flash.continueRead(bytes, dest);
+      else
+        flash.startRead(pageNumber, bytes, dest);
+      streaming = true;
+      stats->streamed++;
+    }
+
+    pageNumber++;
+    dest += bytes;
+    bytesToRead -= bytes;
+  }
+
+  if (streaming)
+    flash.endRead();
+  flash.unlock();
+}
+
+
+// Forget any cached copies of these pages (they are being written or erased)
+void invalidateFlashCache(uint16_t firstPage, uint16_t pages)
+{
+#if FLASH_CACHE_PAGES > 0
+  for (uint8_t i=0; i < FLASH_CACHE_PAGES; i++) {
+    if (!flashCache[i].valid || flashCache[i].page < firstPage || flashCache[i].page - firstPage >= pages)
+      continue;
+    flashCache[i].valid = false;
+    flashCacheInvalidations++;
+  }
+#endif
+}
+
+
+// Print the cache statistics on the debug console
+void PrintFlashCacheStats()
+{
+  printfD("  Pages         = %u (%u bytes)\n", (unsigned int) FLASH_CACHE_PAGES, (unsigned int) FLASH_CACHE_PAGES * EXTERNAL_FLASH_PAGE_SIZE);
+  for (uint8_t i=0; i < NUMBER_OF_REGIONS; i++)
+    printfD("  %-8s hits = %-6u misses = %-6u streamed = %u\n", regionNames[i], (unsigned int) flashCacheStats[i].hits,
+            (unsigned int) flashCacheStats[i].misses, (unsigned int) flashCacheStats[i].streamed);
+  printfD("  Invalidations = %u\n", (unsigned int) flashCacheInvalidations);
+}
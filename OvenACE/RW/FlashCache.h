@@ -0,0 +1,37 @@
+// SRAM cache for pages of external flash
+//
+// The prefs sequence numbers, profile blocks and bitmap address table pages are read
+// from external flash over and over, 256 bytes at a time.  Keeping the most recently
+// used pages in RAM means most of these reads don't touch the flash at all.
+// Controleo3Flash invalidates cached pages whenever they are written or erased.
+#ifndef __FLASHCACHE_H__
+#define __FLASHCACHE_H__
+
+#include <stdint.h>
+
+// Number of 256-byte pages held in the cache.  0 disables the cache.
+#ifndef FLASH_CACHE_PAGES
+#define FLASH_CACHE_PAGES               4
+#endif
+
+#ifdef __cplusplus
+
+// Read from external flash, starting at the beginning of a page.  Reads of a page or
+// less are cached.  Longer reads copy the pages that are already cached and stream the
+// rest straight from flash (without caching them, so big reads don't flush the cache).
+void readFlash(uint16_t pageNumber, uint16_t bytesToRead, uint8_t *dest);
+
+// Forget any cached copies of these pages (they are being written or erased)
+void invalidateFlashCache(uint16_t firstPage, uint16_t pages);
+
+extern "C" {
+#endif // __cplusplus
+
+// Print the cache statistics on the debug console
+void PrintFlashCacheStats(void);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif
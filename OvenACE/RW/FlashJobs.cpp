@@ -0,0 +1,182 @@
+// Erase and program the external flash in the background
+//
+// Jobs are kept in a ring buffer (rather than a FreeRTOS queue) so readFlash() can see
+// which pages the queued jobs will change.  A job stays in the buffer until it is done.
+// The job task only holds the flash lock while it sends commands; while the flash is
+// busy it sleeps a tick at a time and other tasks can use the flash.
+#include <stdint.h>
+#include "FlashJobs.h"
+#include "ReflowWizard.h"
+#include "TaskDefs.h"
+#include "printf-stdarg.h"
+
+#define JOB_ERASE_4K                    0
+#define JOB_WRITE_PAGE                  1
+
+struct flashJob {
+  uint8_t type;
+  uint16_t pageNumber;
+  uint16_t bytesToWrite;
+  const uint8_t *src;
+  TaskHandle_t notify;                // Task to notify when the job is done (or 0)
+};
+
+static flashJob flashJobs[FLASH_JOB_QUEUE_SIZE];
+static volatile uint8_t flashJobHead = 0;         // The job being done (or the next one)
+static volatile uint8_t flashJobCount = 0;
+static TaskHandle_t flashJobTask = 0;
+
+// Statistics
+static uint32_t flashJobsQueued = 0;
+static uint32_t flashJobsDone = 0;
+static uint8_t flashJobsMostQueued = 0;
+static uint32_t flashJobsWaitsForSpace = 0;
+static uint32_t flashJobsReadWaits = 0;
+
+
+// Do a job.  The flash is only locked while commands are being sent
+static void doFlashJob(flashJob *job)
+{
+  flash.lock();
+  flash.allowWritingToPrefs(true);
+  if (job->type == JOB_ERASE_4K)
+    flash.startErase4K(job->pageNumber);
+  else
+    flash.write(job->pageNumber, job->bytesToWrite, (uint8_t *) job->src);
+  flash.unlock();
+
+  // Wait for the flash to finish.  Other tasks can read the flash in the meantime
+  while (flash.isBusy()) {
+    if (flashJobTask)
+      vTaskDelay(1);
+    else
+      delayMicroseconds(100);
+  }
+
+  // Another task may be writing to the flash with the protection off (see writeTokenBufferToFlash)
+  flash.lock();
+  flash.allowWritingToPrefs(false);
+  flash.unlock();
+  flashJobsDone++;
+  if (job->notify)
+    xTaskNotifyGive(job->notify);
+}
+
+
+// Do the queued jobs, in order
+static void FlashJob_task(void *p)
+{
+  (void) p;
+
+  while (1) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    while (flashJobCount) {
+      doFlashJob(&flashJobs[flashJobHead]);
+      taskENTER_CRITICAL();
+      flashJobHead = (flashJobHead + 1) % FLASH_JOB_QUEUE_SIZE;
+      flashJobCount--;
+      taskEXIT_CRITICAL();
+    }
+  }
+}
+
+
+// Start the task that does the jobs.  Until this is called, jobs are done straight away
+void startFlashJobs()
+{
+  if (flashJobTask)
+    return;
+  flash.enableLocking();
+  xTaskCreate(
+      FlashJob_task, FLASHJOBTASK_NAME,
+      FLASHJOBTASK_STACK_SIZE, NULL,
+      FLASHJOBTASK_PRIORITY, &flashJobTask);
+}
+
+
+// Add a job to the end of the queue
+static bool queueFlashJob(uint8_t type, uint16_t pageNumber, uint16_t bytesToWrite, const uint8_t *src, TaskHandle_t notify)
+{
+  // Sanity check
+  if (pageNumber > 511) {
+    printfD("queueFlashJob: page %d is not prefs or profiles\n", pageNumber);
+    return false;
+  }
+
+  flashJob job = {type, pageNumber, bytesToWrite, src, notify};
+  flashJobsQueued++;
+
+  // Do the job now if there is no task to do it
+  if (!flashJobTask) {
+    doFlashJob(&job);
+    return true;
+  }
+
+  // Wait for space in the queue
+  while (flashJobCount == FLASH_JOB_QUEUE_SIZE) {
+    flashJobsWaitsForSpace++;
+    vTaskDelay(1);
+  }
+
+  taskENTER_CRITICAL();
+  flashJobs[(flashJobHead + flashJobCount) % FLASH_JOB_QUEUE_SIZE] = job;
+  flashJobCount++;
+  if (flashJobCount > flashJobsMostQueued)
+    flashJobsMostQueued = flashJobCount;
+  taskEXIT_CRITICAL();
+
+  xTaskNotifyGive(flashJobTask);
+  return true;
+}
+
+
+// Queue an erase of the 4K sector starting at this page
+bool queueFlashErase(uint16_t pageNumber, TaskHandle_t notify)
+{
+  return queueFlashJob(JOB_ERASE_4K, pageNumber & 0xFFF0, 0, 0, notify);
+}
+
+
+// Queue a page program.  The data is not copied, so it must not change until the job is done
+bool queueFlashWrite(uint16_t pageNumber, uint16_t bytesToWrite, const uint8_t *src, TaskHandle_t notify)
+{
+  return queueFlashJob(JOB_WRITE_PAGE, pageNumber, bytesToWrite, src, notify);
+}
+
+
+// Does a queued job change any of these pages?
+static bool isFlashJobQueued(uint16_t firstPage, uint16_t pages)
+{
+  bool queued = false;
+
+  taskENTER_CRITICAL();
+  for (uint8_t i=0; i < flashJobCount && !queued; i++) {
+    flashJob *job = &flashJobs[(flashJobHead + i) % FLASH_JOB_QUEUE_SIZE];
+    uint16_t jobPages = job->type == JOB_ERASE_4K? 16 : 1;
+    queued = job->pageNumber < firstPage + pages && firstPage < job->pageNumber + jobPages;
+  }
+  taskEXIT_CRITICAL();
+  return queued;
+}
+
+
+// Wait until no queued job changes any of these pages
+void waitForFlashJobs(uint16_t firstPage, uint16_t pages)
+{
+  if (!flashJobTask || xTaskGetCurrentTaskHandle() == flashJobTask || !isFlashJobQueued(firstPage, pages))
+    return;
+  flashJobsReadWaits++;
+  while (isFlashJobQueued(firstPage, pages))
+    vTaskDelay(1);
+}
+
+
+// Print the job statistics on the debug console
+void PrintFlashJobStats()
+{
+  printfD("  Queued           = %u\n", (unsigned int) flashJobsQueued);
+  printfD("  Done             = %u\n", (unsigned int) flashJobsDone);
+  printfD("  In queue now     = %u (most %u of %u)\n", (unsigned int) flashJobCount, (unsigned int) flashJobsMostQueued, (unsigned int) FLASH_JOB_QUEUE_SIZE);
+  printfD("  Waits for space  = %u\n", (unsigned int) flashJobsWaitsForSpace);
+  printfD("  Waits to read    = %u\n", (unsigned int) flashJobsReadWaits);
+}
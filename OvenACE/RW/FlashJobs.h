@@ -0,0 +1,46 @@
+// Erase and program the external flash in the background
+//
+// A 4K sector erase keeps the flash busy for tens (sometimes hundreds) of milliseconds.
+// Saving the prefs used to wait for the erase and then each page program, so whatever
+// saved the prefs stopped for that long.  Jobs queued here are done by a low priority
+// task, which sleeps while the flash is busy.  Reads from other tasks suspend an erase
+// that is in progress (see Controleo3Flash::startRead), and readFlash() waits for any
+// queued jobs that change the pages being read.
+#ifndef __FLASHJOBS_H__
+#define __FLASHJOBS_H__
+
+#include <stdint.h>
+#include "rtos_support.h"
+
+// Number of jobs that can be queued.  Saving the prefs is 17 jobs (an erase and 16 pages)
+#ifndef FLASH_JOB_QUEUE_SIZE
+#define FLASH_JOB_QUEUE_SIZE            20
+#endif
+
+#ifdef __cplusplus
+
+// Start the task that does the jobs.  Until this is called, jobs are done straight away
+void startFlashJobs(void);
+
+// Queue an erase of the 4K sector starting at this page.  Only the lower 128K (prefs and
+// profiles, pages 0 to 511) can be changed by jobs.  If notify isn't 0, the task is sent
+// a notification (see ulTaskNotifyTake) when the job is done.
+bool queueFlashErase(uint16_t pageNumber, TaskHandle_t notify);
+
+// Queue a page program.  The data is not copied, so it must not change until the job is done
+bool queueFlashWrite(uint16_t pageNumber, uint16_t bytesToWrite, const uint8_t *src, TaskHandle_t notify);
+
+// Wait until no queued job changes any of these pages
+void waitForFlashJobs(uint16_t firstPage, uint16_t pages);
+
+extern "C" {
+#endif // __cplusplus
+
+// Print the job statistics on the debug console
+void PrintFlashJobStats(void);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif
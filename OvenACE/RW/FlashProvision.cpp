@@ -0,0 +1,243 @@
+// Write the bitmaps to external flash in bulk (factory setup)
+//
+// flash.write() waits for the previous page program to finish before it sends the next
+// page, so reading the next page from the source overlaps with the flash programming the
+// last one.  The flash is locked for the whole of provisioning, so the flash job task
+// can't change the protection part way through.
+#include <stdint.h>
+#include "FlashProvision.h"
+#include "BitmapCache.h"
+#include "Controleo3SD.h"
+#include "FlashCache.h"
+#include "ReflowWizard.h"
+#include "printf-stdarg.h"
+#include "rtos_support.h"
+#include "string.h"
+
+// See the layout in Controleo3Flash.cpp
+#define PROVISION_PAGE_SIZE             256
+#define PROVISION_ADDRESS_TABLE         512
+#define PROVISION_ADDRESS_TABLE_PAGES   16
+#define PROVISION_ADDRESSES_PER_PAGE    42
+#define PROVISION_FIRST_BITMAP_PAGE     528
+#define PROVISION_LAST_PAGE             4095
+#define PROVISION_TAG_OFFSET            252       // The 4 spare bytes at the end of the first table page
+
+static uint8_t provisionBuffer[PROVISION_PAGE_SIZE];
+static uint16_t addressTable[PROVISION_PAGE_SIZE >> 1];   // The address table page being filled
+static uint16_t addressTablePage;
+static uint32_t addressTableCrc;                          // CRC32 of the table pages written so far
+static uint16_t nextBitmap;
+static uint16_t nextBitmapPage;
+static uint32_t provisionTag;
+static bool provisioning = false;
+
+// Statistics for the report at the end
+static uint32_t provisionStart;
+static uint16_t provisionBitmaps;
+static uint32_t provisionEraseMillis;
+static uint32_t provisionPagesWritten;
+static uint32_t provisionBytesWritten;
+static uint32_t provisionVerifyMillis;
+
+// CRC32 a nibble at a time, so the table is small
+static const uint32_t crc32Table[16] = {
+  0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+  0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+
+// CRC32 (IEEE 802.3, as used by zip).  Start with crc = 0, and pass the result back in to carry on
+uint32_t flashCRC32(uint32_t crc, const uint8_t *data, uint16_t length)
+{
+  crc = ~crc;
+  while (length--) {
+    crc ^= *data++;
+    crc = (crc >> 4) ^ crc32Table[crc & 0x0F];
+    crc = (crc >> 4) ^ crc32Table[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+
+// Source that reads from an open file on the SD card (context is the File *)
+uint16_t flashProvisionFileSource(uint8_t *dest, uint16_t bytes, void *context)
+{
+  int bytesRead = ((File *) context)->read(dest, bytes);
+  return bytesRead > 0? bytesRead : 0;
+}
+
+
+// Program consecutive pages from a source, and work out the CRC32 of the data
+bool provisionPages(uint16_t firstPage, uint32_t bytes, flashProvisionSource source, void *context, uint32_t *crc)
+{
+  uint16_t page = firstPage;
+
+  *crc = 0;
+  while (bytes) {
+    uint16_t bytesInPage = bytes > PROVISION_PAGE_SIZE? PROVISION_PAGE_SIZE : bytes;
+    if (page > PROVISION_LAST_PAGE) {
+      printfD("provisionPages: out of flash\n");
+      return false;
+    }
+
+    // The flash is still programming the last page while this one is read
+    if (source(provisionBuffer, bytesInPage, context) != bytesInPage) {
+      printfD("provisionPages: source ended at page %d\n", page);
+      return false;
+    }
+    *crc = flashCRC32(*crc, provisionBuffer, bytesInPage);
+    flash.write(page++, bytesInPage, provisionBuffer);
+
+    provisionPagesWritten++;
+    provisionBytesWritten += bytesInPage;
+    bytes -= bytesInPage;
+  }
+  return true;
+}
+
+
+// Read back consecutive pages and check their CRC32
+bool verifyPages(uint16_t firstPage, uint32_t bytes, uint32_t crc)
+{
+  uint32_t start = millis(), readCrc = 0;
+
+  // Pages are consecutive in flash, so this is one long read
+  flash.startRead(firstPage, 0, 0);
+  while (bytes) {
+    uint16_t bytesToRead = bytes > PROVISION_PAGE_SIZE? PROVISION_PAGE_SIZE : bytes;
+    flash.continueRead(bytesToRead, provisionBuffer);
+    readCrc = flashCRC32(readCrc, provisionBuffer, bytesToRead);
+    bytes -= bytesToRead;
+  }
+  flash.endRead();
+  provisionVerifyMillis += millis() - start;
+
+  if (readCrc != crc) {
+    printfD("verifyPages: CRC of pages from %d is 0x%08lX, not 0x%08lX\n", firstPage, readCrc, crc);
+    return false;
+  }
+  return true;
+}
+
+
+// Write the address table page being filled, and start on the next one
+static void writeAddressTablePage()
+{
+  addressTableCrc = flashCRC32(addressTableCrc, (uint8_t *) addressTable, PROVISION_PAGE_SIZE);
+  flash.write(addressTablePage++, PROVISION_PAGE_SIZE, (uint8_t *) addressTable);
+  memset(addressTable, 0xFF, sizeof(addressTable));
+  provisionPagesWritten++;
+  provisionBytesWritten += PROVISION_PAGE_SIZE;
+}
+
+
+// Get the tag passed to startBitmapProvisioning() when the bitmaps were written
+uint32_t getProvisionedTag()
+{
+  uint32_t tag;
+
+  readFlash(PROVISION_ADDRESS_TABLE, PROVISION_PAGE_SIZE, provisionBuffer);
+  memcpy(&tag, provisionBuffer + PROVISION_TAG_OFFSET, sizeof(tag));
+  return tag;
+}
+
+
+// Start provisioning.  Erases the address table and enough of the bitmap area for
+// bitmapPages pages (0 erases all of it).  The flash is locked until endBitmapProvisioning()
+bool startBitmapProvisioning(uint16_t bitmapPages, uint32_t tag)
+{
+  if (bitmapPages == 0 || bitmapPages > PROVISION_LAST_PAGE + 1 - PROVISION_FIRST_BITMAP_PAGE)
+    bitmapPages = PROVISION_LAST_PAGE + 1 - PROVISION_FIRST_BITMAP_PAGE;
+
+  flash.lock();
+  provisioning = true;
+  provisionStart = millis();
+  provisionBitmaps = 0;
+  provisionPagesWritten = 0;
+  provisionBytesWritten = 0;
+  provisionVerifyMillis = 0;
+
+  // The table and bitmaps are next to each other, starting on a 64K boundary
+  flash.allowWritingToBitmaps(true);
+  flash.erasePages(PROVISION_ADDRESS_TABLE, PROVISION_ADDRESS_TABLE_PAGES + bitmapPages);
+  provisionEraseMillis = millis() - provisionStart;
+
+  memset(addressTable, 0xFF, sizeof(addressTable));
+  addressTablePage = PROVISION_ADDRESS_TABLE;
+  addressTableCrc = 0;
+  provisionTag = tag;
+  nextBitmap = 0;
+  nextBitmapPage = PROVISION_FIRST_BITMAP_PAGE;
+  return true;
+}
+
+
+// Program and verify a bitmap.  Bitmaps must be provisioned in increasing order.  Bitmaps
+// that are skipped are left erased (they aren't in the flash)
+bool provisionBitmap(uint16_t bitmapNumber, uint16_t bitmapWidth, uint16_t bitmapHeight, flashProvisionSource source, void *context)
+{
+  uint32_t bitmapBytes = (uint32_t) bitmapWidth * bitmapHeight * 2;
+  uint32_t crc;
+
+  // Sanity checks
+  if (!provisioning || bitmapNumber < nextBitmap || bitmapNumber >= PROVISION_MAXIMUM_BITMAPS) {
+    printfD("provisionBitmap: bitmap %d is out of order\n", bitmapNumber);
+    return false;
+  }
+  if (bitmapWidth > PROVISION_MAXIMUM_DIMENSION || bitmapHeight > PROVISION_MAXIMUM_DIMENSION) {
+    printfD("provisionBitmap: bitmap %d is too big\n", bitmapNumber);
+    return false;
+  }
+
+  if (!provisionPages(nextBitmapPage, bitmapBytes, source, context, &crc) || !verifyPages(nextBitmapPage, bitmapBytes, crc))
+    return false;
+
+  // Each table page is written once it is full
+  while (addressTablePage < PROVISION_ADDRESS_TABLE + bitmapNumber / PROVISION_ADDRESSES_PER_PAGE)
+    writeAddressTablePage();
+  uint16_t *entry = addressTable + (bitmapNumber % PROVISION_ADDRESSES_PER_PAGE) * 3;
+  entry[0] = nextBitmapPage;
+  entry[1] = bitmapWidth;
+  entry[2] = bitmapHeight;
+
+  nextBitmap = bitmapNumber + 1;
+  provisionBitmaps++;
+  nextBitmapPage += (bitmapBytes + PROVISION_PAGE_SIZE - 1) / PROVISION_PAGE_SIZE;
+  return true;
+}
+
+
+// Write the last address table page, verify the table and print how long it all took.
+// The tag is written last, and only if everything was provisioned (complete is true)
+bool endBitmapProvisioning(bool complete)
+{
+  if (!provisioning)
+    return false;
+
+  // Write the last table page, then check the whole table
+  writeAddressTablePage();
+  bool verified = verifyPages(PROVISION_ADDRESS_TABLE, (uint32_t) (addressTablePage - PROVISION_ADDRESS_TABLE) * PROVISION_PAGE_SIZE, addressTableCrc);
+
+  // The tag bytes are still erased, so they can be programmed now (0xFF leaves the other bytes alone)
+  if (complete && verified) {
+    memset(provisionBuffer, 0xFF, PROVISION_PAGE_SIZE);
+    memcpy(provisionBuffer + PROVISION_TAG_OFFSET, &provisionTag, sizeof(provisionTag));
+    flash.write(PROVISION_ADDRESS_TABLE, PROVISION_PAGE_SIZE, provisionBuffer);
+  }
+
+  flash.allowWritingToBitmaps(false);
+  flash.loadBitmapDirectory();
+  provisioning = false;
+  flash.unlock();
+
+  // The cached bitmaps came from the old bitmaps.  Reloading them waits for the flash
+  // jobs, which need the flash lock, so it is done after the unlock
+  reloadBitmapCache();
+
+  uint32_t totalMillis = millis() - provisionStart;
+  printfD("Provisioned %d bitmaps (%lu pages) in %lu ms%s\n", provisionBitmaps, provisionPagesWritten, totalMillis, verified? "" : " - TABLE VERIFY FAILED");
+  printfD("  Erase %lu ms, verify %lu ms, %lu KB/s overall\n", provisionEraseMillis, provisionVerifyMillis,
+          totalMillis? provisionBytesWritten / totalMillis : 0);
+  return verified;
+}
@@ -0,0 +1,56 @@
+// Write the bitmaps to external flash in bulk (factory setup)
+//
+// Writing the bitmaps one at a time through getBitmapPage() reads two address table pages
+// and writes one for every bitmap, and each sector is erased separately.  Provisioning
+// erases the whole bitmap area up front (64K blocks), programs the pages one after the
+// other while the next page is fetched from the source, writes each address table page
+// once, and checks every bitmap with a CRC32 of what was read back.
+#ifndef __FLASHPROVISION_H__
+#define __FLASHPROVISION_H__
+
+#include <stdint.h>
+
+// Limits of the bitmap area (see the layout in Controleo3Flash.cpp)
+#define PROVISION_MAXIMUM_BITMAPS       672
+#define PROVISION_MAXIMUM_DIMENSION     0x3FF     // Width and height are 10 bits in the RAM directory
+#define PROVISION_BITMAP_PAGES          3568      // Pages 528 to 4095
+
+#ifdef __cplusplus
+
+// Where the data comes from.  Fill dest with the next bytes; returns the number of bytes
+// read (less than asked for means the source ended or failed)
+typedef uint16_t (*flashProvisionSource)(uint8_t *dest, uint16_t bytes, void *context);
+
+// Source that reads from an open file on the SD card (context is the File *)
+uint16_t flashProvisionFileSource(uint8_t *dest, uint16_t bytes, void *context);
+
+// CRC32 (IEEE 802.3, as used by zip).  Start with crc = 0, and pass the result back in to carry on
+uint32_t flashCRC32(uint32_t crc, const uint8_t *data, uint16_t length);
+
+// Program consecutive pages from a source, and work out the CRC32 of the data
+bool provisionPages(uint16_t firstPage, uint32_t bytes, flashProvisionSource source, void *context, uint32_t *crc);
+
+// Read back consecutive pages and check their CRC32
+bool verifyPages(uint16_t firstPage, uint32_t bytes, uint32_t crc);
+
+// Start provisioning.  Erases the address table and enough of the bitmap area for
+// bitmapPages pages (0 erases all of it).  The flash is locked until endBitmapProvisioning().
+// The tag is saved with the address table, to identify what was written (see getProvisionedTag).
+// Until endBitmapProvisioning() has written it, the tag reads as 0xFFFFFFFF
+bool startBitmapProvisioning(uint16_t bitmapPages, uint32_t tag);
+
+// Get the tag passed to startBitmapProvisioning() when the bitmaps were written
+uint32_t getProvisionedTag(void);
+
+// Program and verify a bitmap.  Bitmaps must be provisioned in increasing order.  Bitmaps
+// that are skipped are left erased (they aren't in the flash).
+// If this fails, endBitmapProvisioning() must still be called to unlock the flash
+bool provisionBitmap(uint16_t bitmapNumber, uint16_t bitmapWidth, uint16_t bitmapHeight, flashProvisionSource source, void *context);
+
+// Write the last address table page, verify the table and print how long it all took.
+// The tag is written last, and only if everything was provisioned (complete is true)
+bool endBitmapProvisioning(bool complete);
+
+#endif // __cplusplus
+
+#endif
@@ -7,6 +7,8 @@
 #include "Outputs.h"
 #include "Help.h"
 #include "Render.h"
+#include "TextField.h"
+#include "Compositor.h"
 #include "Touch.h"
 #include "Prefs.h"
 #include "Bake.h"
@@ -40,6 +42,9 @@
 
 #define NO_PERFORMANCE_INDICATOR          101  // Don't draw an indicator on the performance bar
 
+// The overall countdown clock
+static TextField learningTimer(240, 140, FONT_22PT_BLACK_ON_WHITE_FIXED, TEXT_ALIGN_CENTER);
+
 // Stay in this function until learning is done or canceled
 void learn() {
   uint32_t lastLoopTime = millis();
@@ -91,9 +96,12 @@ void learn() {
   // Ug, hate goto's!  But this saves a lot of extraneous code.
 userChangedMindAboutAborting:
 
+  // The countdown clock has been erased
+  learningTimer.invalidate();
+
   // Setup the tap targets on this screen
   clearTouchTargets();
-  drawButton(110, 230, 260, 87, BUTTON_LARGE_FONT, (char *) "STOP");
+  drawButton(110, 230, 260, BUTTON_LARGE_FONT, (char *) "STOP");
   defineTouchArea(20, 150, 440, 170); // Large tap target to stop learning
 
   // Draw the status bar
@@ -512,7 +520,7 @@ userChangedMindAboutAborting:
 
         // Change the STOP button to DONE
         tft.fillRect(150, 242, 180, 36, WHITE);
-        drawButton(110, 230, 260, 93, BUTTON_LARGE_FONT, (char *) "DONE");
+        drawButton(110, 230, 260, BUTTON_LARGE_FONT, (char *) "DONE");
         
         // Cooling should be at least 60 seconds in duration
         coolingDuration = 60;
@@ -605,33 +613,25 @@ void DisplayLearningTime(uint16_t duration, float temperature, int duty, int int
 // Draw the abort dialog on the screen.  The user needs to confirm that they want to exit bake
 void drawLearningAbortDialog()
 {
+  // Build the dialog in RAM so it appears all at once
+  startComposition(0, 110, 480, 210, WHITE);
   drawThickRectangle(0, 110, 480, 210, 8, RED);
-  tft.fillRect(30, 118, 420, 173, WHITE);
-  displayString(124, 126, FONT_12PT_BLACK_ON_WHITE, (char *) "Stop Learning");
-  displayString(62, 165, FONT_9PT_BLACK_ON_WHITE, (char *) "Are you sure you want to stop");
-  displayString(62, 195, FONT_9PT_BLACK_ON_WHITE, (char *) "learning?");
+  composeText(124, 126, FONT_12PT_BLACK_ON_WHITE, "Stop Learning");
+  composeText(62, 165, FONT_9PT_BLACK_ON_WHITE, "Are you sure you want to stop");
+  composeText(62, 195, FONT_9PT_BLACK_ON_WHITE, "learning?");
   clearTouchTargets();
-  drawTouchButton(60, 240, 160, 72, BUTTON_LARGE_FONT, (char *) "Stop");
-  drawTouchButton(260, 240, 160, 105, BUTTON_LARGE_FONT, (char *) "Cancel");
+  drawTouchButton(60, 240, 160, BUTTON_LARGE_FONT, (char *) "Stop");
+  drawTouchButton(260, 240, 160, BUTTON_LARGE_FONT, (char *) "Cancel");
+  endComposition();
 }
 
 
 // Display the countdown timer
 void displaySecondsLeft(uint32_t overallSeconds, uint32_t phaseSeconds)
 {
-  static uint16_t oldOverallWidth = 1, overallTimerX = 130;
-
   // Update the overall seconds remaining clock display
-  uint16_t newWidth = displayString(overallTimerX, 140, FONT_22PT_BLACK_ON_WHITE_FIXED, secondsInClockFormat(buffer100Bytes, overallSeconds));
-  // Keep the timer display centered
-  if (newWidth != oldOverallWidth) {
-    // The width has changed (one less character on the display).  Erase what was there
-    tft.fillRect(overallTimerX, 140, newWidth > oldOverallWidth? newWidth : oldOverallWidth, 48, WHITE);
-    // Redraw the timer
-    oldOverallWidth = newWidth;
-    overallTimerX = 240 - (newWidth >> 1);
-    displayString(overallTimerX, 140, FONT_22PT_BLACK_ON_WHITE_FIXED, buffer100Bytes);
-  }
+  // The timer is kept centered, and only the digits that change are redrawn
+  learningTimer.display(secondsInClockFormat(buffer100Bytes, overallSeconds));
 
   // Update the phase seconds remaining clock display
   displayFixedWidthString(285, 200, secondsInClockFormat(buffer100Bytes, phaseSeconds), 5, FONT_9PT_BLACK_ON_WHITE_FIXED);
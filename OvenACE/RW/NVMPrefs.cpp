@@ -0,0 +1,281 @@
+// Hot prefs in the microcontroller's own flash (NVM)
+//
+// Each record is one 64-byte NVM page: a sequence number, the hot prefs packed one after
+// the other, and a CRC.  Records are written to the pages in turn, wrapping around the rows.
+// A row is erased just before its first page is written, so the row being erased never
+// holds the latest record or the one before it (there are at least 3 rows).  At startup the
+// record with the highest sequence number and a good CRC is used.  If the power goes off
+// while a record is being written, its CRC is wrong and the one before it is used.  If it
+// goes off while a row is being erased, the row is random, and one of its pages could have
+// a good CRC by chance (1 in 65536) and any sequence number.  So a record is only used if
+// the record before it (one less) is there too, or it is the first one.
+#include <stddef.h>
+#include "NVMPrefs.h"
+#include "Prefs.h"
+#include "ReflowWizard.h"
+#include "samd21.h"
+#include "printf-stdarg.h"
+#include "string.h"
+
+#define NVM_PREFS_PAGES                 (NVM_PREFS_ROWS * NVMCTRL_ROW_PAGES)
+#define NVM_PREFS_ADDRESS               (FLASH_SIZE - NVM_PREFS_ROWS * NVMCTRL_ROW_SIZE)
+#define NVM_PREFS_DATA_SIZE             (NVMCTRL_PAGE_SIZE - 6)
+#define NVM_NO_RECORD                   0xFFFF
+
+#if NVM_PREFS_ROWS < 3
+#error "NVM_PREFS_ROWS must be at least 3"
+#endif
+
+// The prefs kept in NVM
+struct nvmPrefsField {
+  uint16_t offset;
+  uint8_t  size;
+};
+
+#define NVM_TOUCH_CALIBRATION_SIZE      (offsetof(Controleo3Prefs, bottomRightY) + 2 - offsetof(Controleo3Prefs, topLeftX))
+#define NVM_OUTPUT_TYPE_SIZE            NUMBER_OF_OUTPUTS
+#define NVM_BAKE_SIZE                   (offsetof(Controleo3Prefs, bakeUseCoolingFan) + 1 - offsetof(Controleo3Prefs, bakeTemperature))
+#define NVM_LAST_PROFILE_SIZE           sizeof(uint16_t)
+
+static const nvmPrefsField nvmPrefsFields[] = {
+  {offsetof(Controleo3Prefs, topLeftX), NVM_TOUCH_CALIBRATION_SIZE},
+  {offsetof(Controleo3Prefs, outputType), NVM_OUTPUT_TYPE_SIZE},
+  {offsetof(Controleo3Prefs, bakeTemperature), NVM_BAKE_SIZE},
+  {offsetof(Controleo3Prefs, lastUsedProfileBlock), NVM_LAST_PROFILE_SIZE},
+};
+
+// The packed fields must fit in a record.  Check this when adding a field or changing Controleo3Prefs
+static_assert(NVM_TOUCH_CALIBRATION_SIZE + NVM_OUTPUT_TYPE_SIZE + NVM_BAKE_SIZE + NVM_LAST_PROFILE_SIZE <= NVM_PREFS_DATA_SIZE,
+              "The NVM prefs fields don't fit in an NVM record");
+
+#define NVM_PREFS_FIELDS                (sizeof(nvmPrefsFields) / sizeof(nvmPrefsField))
+
+// One NVM page
+struct nvmPrefsRecord {
+  uint32_t sequenceNumber;
+  uint8_t  data[NVM_PREFS_DATA_SIZE];           // The fields, one after the other (unused bytes are 0xFF)
+  uint16_t crc;                                 // CRC of the sequence number and data
+};
+
+static_assert(sizeof(nvmPrefsRecord) == NVMCTRL_PAGE_SIZE, "An NVM prefs record must be one NVM page");
+
+
+// Erase a row of the internal NVM
+static void internalEraseRow(uint16_t row)
+{
+  while (!(NVMCTRL->INTFLAG.reg & NVMCTRL_INTFLAG_READY))
+    ;
+  NVMCTRL->STATUS.reg = NVMCTRL_STATUS_MASK;
+  NVMCTRL->ADDR.reg = (NVM_PREFS_ADDRESS + row * NVMCTRL_ROW_SIZE) >> 1;
+  NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_ER;
+  while (!(NVMCTRL->INTFLAG.reg & NVMCTRL_INTFLAG_READY))
+    ;
+  NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_INVALL;
+}
+
+
+// Program a page of the internal NVM.  The page must have been erased
+static void internalWritePage(uint16_t page, const uint32_t *src)
+{
+  volatile uint32_t *dest = (volatile uint32_t *) (NVM_PREFS_ADDRESS + page * NVMCTRL_PAGE_SIZE);
+
+  // Fill the page buffer, then write it
+  NVMCTRL->CTRLB.reg |= NVMCTRL_CTRLB_MANW;
+  while (!(NVMCTRL->INTFLAG.reg & NVMCTRL_INTFLAG_READY))
+    ;
+  NVMCTRL->STATUS.reg = NVMCTRL_STATUS_MASK;
+  NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_PBC;
+  while (!(NVMCTRL->INTFLAG.reg & NVMCTRL_INTFLAG_READY))
+    ;
+  for (uint8_t i=0; i < NVMCTRL_PAGE_SIZE / 4; i++)
+    dest[i] = src[i];
+  NVMCTRL->ADDR.reg = ((uint32_t) dest) >> 1;
+  NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_WP;
+  while (!(NVMCTRL->INTFLAG.reg & NVMCTRL_INTFLAG_READY))
+    ;
+  NVMCTRL->CTRLA.reg = NVMCTRL_CTRLA_CMDEX_KEY | NVMCTRL_CTRLA_CMD_INVALL;
+}
+
+
+static const nvmPrefsStorage internalNVM = {(const uint8_t *) NVM_PREFS_ADDRESS, internalEraseRow, internalWritePage};
+static const nvmPrefsStorage *nvmStorage = &internalNVM;
+
+static bool nvmPrefsScanned = false;            // Has the latest record been found?
+static uint16_t nvmLatestPage = NVM_NO_RECORD;
+static uint32_t nvmLatestSequenceNumber = 0;
+static nvmPrefsRecord nvmRecord;                // Word aligned, for writePage()
+
+// Statistics
+static uint32_t nvmPrefsWrites = 0;
+static uint32_t nvmPrefsUnchanged = 0;
+static uint32_t nvmPrefsRowErases = 0;
+static uint32_t nvmPrefsBadRecords = 0;
+static uint32_t nvmPrefsVerifyFailures = 0;
+
+
+// Use different storage for the records.  This forgets the records that were found
+void setNVMPrefsStorage(const nvmPrefsStorage *storage)
+{
+  nvmStorage = storage? storage : &internalNVM;
+  nvmPrefsScanned = false;
+}
+
+
+// Is this byte of Controleo3Prefs kept in NVM?
+bool isNVMPrefsByte(uint16_t offset)
+{
+  for (uint8_t i=0; i < NVM_PREFS_FIELDS; i++)
+    if (offset >= nvmPrefsFields[i].offset && offset < nvmPrefsFields[i].offset + nvmPrefsFields[i].size)
+      return true;
+  return false;
+}
+
+
+static const nvmPrefsRecord *getRecord(uint16_t page)
+{
+  return (const nvmPrefsRecord *) (nvmStorage->base + page * NVMCTRL_PAGE_SIZE);
+}
+
+
+// Is the whole page erased?
+static bool isPageErased(uint16_t page)
+{
+  const uint8_t *p = nvmStorage->base + page * NVMCTRL_PAGE_SIZE;
+  for (uint8_t i=0; i < NVMCTRL_PAGE_SIZE; i++)
+    if (p[i] != 0xFF)
+      return false;
+  return true;
+}
+
+
+// Find the record with the highest sequence number.  The records are read straight from the memory map
+static void findLatestRecord()
+{
+  uint32_t sequenceNumbers[NVM_PREFS_PAGES];    // Of the records with a good CRC (0 = none)
+
+  for (uint16_t page=0; page < NVM_PREFS_PAGES; page++) {
+    const nvmPrefsRecord *record = getRecord(page);
+    sequenceNumbers[page] = 0;
+    if (record->sequenceNumber == 0xFFFFFFFF || record->sequenceNumber == 0)
+      continue;
+    if (prefsCRC(0xFFFF, (const uint8_t *) record, offsetof(nvmPrefsRecord, crc)) != record->crc) {
+      nvmPrefsBadRecords++;
+      continue;
+    }
+    sequenceNumbers[page] = record->sequenceNumber;
+  }
+
+  nvmLatestPage = NVM_NO_RECORD;
+  nvmLatestSequenceNumber = 0;
+  for (uint16_t page=0; page < NVM_PREFS_PAGES; page++) {
+    if (sequenceNumbers[page] <= nvmLatestSequenceNumber)
+      continue;
+    // Is the record before it there?
+    bool chained = sequenceNumbers[page] == 1;
+    for (uint16_t i=0; i < NVM_PREFS_PAGES && !chained; i++)
+      chained = sequenceNumbers[i] == sequenceNumbers[page] - 1;
+    if (!chained) {
+      nvmPrefsBadRecords++;
+      continue;
+    }
+    nvmLatestPage = page;
+    nvmLatestSequenceNumber = sequenceNumbers[page];
+  }
+  nvmPrefsScanned = true;
+}
+
+
+// Copy the hot prefs from the latest NVM record into the prefs.  Returns false if there isn't one
+bool readNVMPrefs(Controleo3Prefs *p)
+{
+  if (!nvmPrefsScanned)
+    findLatestRecord();
+  if (nvmLatestPage == NVM_NO_RECORD)
+    return false;
+
+  const uint8_t *data = getRecord(nvmLatestPage)->data;
+  for (uint8_t i=0; i < NVM_PREFS_FIELDS; i++) {
+    memcpy((uint8_t *) p + nvmPrefsFields[i].offset, data, nvmPrefsFields[i].size);
+    data += nvmPrefsFields[i].size;
+  }
+  return true;
+}
+
+
+// Write a new NVM record, if the hot prefs have changed
+void writeNVMPrefs(const Controleo3Prefs *p)
+{
+  uint16_t page;
+
+  if (!nvmPrefsScanned)
+    findLatestRecord();
+
+  // Pack the fields into the record
+  memset(&nvmRecord, 0xFF, sizeof(nvmRecord));
+  uint8_t *data = nvmRecord.data;
+  for (uint8_t i=0; i < NVM_PREFS_FIELDS; i++) {
+    memcpy(data, (const uint8_t *) p + nvmPrefsFields[i].offset, nvmPrefsFields[i].size);
+    data += nvmPrefsFields[i].size;
+  }
+  if (nvmLatestPage != NVM_NO_RECORD && memcmp(nvmRecord.data, getRecord(nvmLatestPage)->data, NVM_PREFS_DATA_SIZE) == 0) {
+    nvmPrefsUnchanged++;
+    return;
+  }
+
+  // Use the page after the latest record.  If it isn't erased (a write was cut short) skip to the next row
+  page = nvmLatestPage == NVM_NO_RECORD? 0 : (nvmLatestPage + 1) % NVM_PREFS_PAGES;
+  if (page % NVMCTRL_ROW_PAGES && !isPageErased(page))
+    page = (page / NVMCTRL_ROW_PAGES + 1) * NVMCTRL_ROW_PAGES % NVM_PREFS_PAGES;
+
+  // Erase the row before its first page is written (unless it is already erased)
+  if (page % NVMCTRL_ROW_PAGES == 0) {
+    for (uint8_t i=0; i < NVMCTRL_ROW_PAGES; i++) {
+      if (!isPageErased(page + i)) {
+        nvmStorage->eraseRow(page / NVMCTRL_ROW_PAGES);
+        nvmPrefsRowErases++;
+        break;
+      }
+    }
+  }
+
+  nvmRecord.sequenceNumber = nvmLatestSequenceNumber + 1;
+  nvmRecord.crc = prefsCRC(0xFFFF, (const uint8_t *) &nvmRecord, offsetof(nvmPrefsRecord, crc));
+  nvmStorage->writePage(page, (const uint32_t *) &nvmRecord);
+  nvmPrefsWrites++;
+
+  if (memcmp(&nvmRecord, getRecord(page), sizeof(nvmRecord)) != 0) {
+    // The previous record is still the latest one
+    printfD("writeNVMPrefs: page %d didn't verify\n", page);
+    nvmPrefsVerifyFailures++;
+    return;
+  }
+  nvmLatestPage = page;
+  nvmLatestSequenceNumber = nvmRecord.sequenceNumber;
+}
+
+
+// Erase all the NVM records (factory reset)
+void eraseNVMPrefs()
+{
+  for (uint16_t row=0; row < NVM_PREFS_ROWS; row++) {
+    nvmStorage->eraseRow(row);
+    nvmPrefsRowErases++;
+  }
+  nvmLatestPage = NVM_NO_RECORD;
+  nvmLatestSequenceNumber = 0;
+  nvmPrefsScanned = true;
+}
+
+
+// Print the NVM prefs statistics on the debug console
+void PrintNVMPrefsStats()
+{
+  printfD("  NVM rows          = %u (%u records)\n", (unsigned int) NVM_PREFS_ROWS, (unsigned int) NVM_PREFS_PAGES);
+  if (nvmLatestPage == NVM_NO_RECORD)
+    printfD("  NVM latest record = none\n");
+  else
+    printfD("  NVM latest record = page %u, seq no = %lu\n", (unsigned int) nvmLatestPage, nvmLatestSequenceNumber);
+  printfD("  NVM writes        = %u (%u unchanged)\n", (unsigned int) nvmPrefsWrites, (unsigned int) nvmPrefsUnchanged);
+  printfD("  NVM row erases    = %u\n", (unsigned int) nvmPrefsRowErases);
+  printfD("  NVM bad records   = %u, verify failures = %u\n", (unsigned int) nvmPrefsBadRecords, (unsigned int) nvmPrefsVerifyFailures);
+}
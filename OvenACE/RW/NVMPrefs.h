@@ -0,0 +1,62 @@
+// Hot prefs in the microcontroller's own flash (NVM)
+//
+// The ATSAMD21J18A doesn't have the separate read-while-write EEPROM section of the later
+// SAMD21 parts, but the top 8K of the main NVM isn't used by the firmware (see the rom
+// region in samd21j18a_flash.ld).  The prefs that change most often - the touchscreen
+// calibration, output types, bake settings and last used profile block - are kept in the
+// top rows of it.  They can be read straight from the memory map at startup, and saving
+// them doesn't need an erase of the external flash.  The CPU stalls while a row is being
+// erased or a page is being written (a few milliseconds), because it runs from the same flash.
+//
+// Changes to these prefs aren't written to the external flash.  A snapshot there (see Prefs.cpp)
+// has them as they were when the snapshot was written, which may be much older.  If the NVM
+// copy is lost (a chip erase when the firmware is programmed) getPrefs() falls back to those
+// values and writes them to NVM.
+#ifndef __NVMPREFS_H__
+#define __NVMPREFS_H__
+
+#include <stdint.h>
+
+// Number of 256-byte rows used.  Each row holds 4 records
+#ifndef NVM_PREFS_ROWS
+#define NVM_PREFS_ROWS                  8
+#endif
+
+#ifdef __cplusplus
+
+struct Controleo3Prefs;
+
+// Where the records are kept.  The default is the top of the internal NVM; a host build can
+// pass a RAM model (a buffer and functions that act on it) to setNVMPrefsStorage().
+struct nvmPrefsStorage {
+  const uint8_t *base;                            // The rows, memory-mapped
+  void (*eraseRow)(uint16_t row);                 // Set a row to 0xFF
+  void (*writePage)(uint16_t page, const uint32_t *src);  // Program a 64-byte page
+};
+
+// Use different storage for the records.  This forgets the records that were found
+void setNVMPrefsStorage(const nvmPrefsStorage *storage);
+
+// Is this byte of Controleo3Prefs kept in NVM?
+bool isNVMPrefsByte(uint16_t offset);
+
+// Copy the hot prefs from the latest NVM record into the prefs.  Returns false if there isn't one
+bool readNVMPrefs(Controleo3Prefs *p);
+
+// Write a new NVM record, if the hot prefs have changed
+void writeNVMPrefs(const Controleo3Prefs *p);
+
+// Erase all the NVM records (factory reset)
+void eraseNVMPrefs(void);
+
+extern "C" {
+#endif // __cplusplus
+
+// Print the NVM prefs statistics on the debug console
+void PrintNVMPrefsStats(void);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif
@@ -41,7 +41,7 @@
 #define HEARTBEAT_LED PA(30)  // Used as SWCLK when debugging
 #define OSERROR_LED   PA(31)  // Used as SWDIO when debugging
 
-volatile uint32_t *portAOut, *portBOut;
+PORT_REGISTER *portAOut, *portBOut;
 //*portAMode, *portBOut, *portBMode;
 static bool outputState[NUMBER_OF_OUTPUTS];
 
@@ -119,47 +119,49 @@ void setOutput(uint8_t outputNumber, bool state) {
   // Save the new state
   outputState[outputNumber] = state;
   
+  // Use the set and clear registers.  The LCD's DMA fill toggles the WR pin on PORTB
+  // in the background, and a read-modify-write of PORTB could undo a toggle.
   switch (outputNumber) {
     case 0: 
       if (state == 0)
-        *portAOut &= CLEARBIT15;
+        PORT_OUTPUT_LOW(PBIT(OUTPUT1));
       else
-        *portAOut |= SETBIT15; 
+        PORT_OUTPUT_HIGH(PBIT(OUTPUT1));
       break;
     
     case 1: 
       if (state == 0)
-        *portBOut &= CLEARBIT30;
+        PORT_OUTPUT_LOW(PBIT(OUTPUT2));
       else
-        *portBOut |= SETBIT30; 
+        PORT_OUTPUT_HIGH(PBIT(OUTPUT2));
       break;
     
     case 2: 
       if (state == 0)
-        *portBOut &= CLEARBIT17;
+        PORT_OUTPUT_LOW(PBIT(OUTPUT3));
       else
-        *portBOut |= SETBIT17; 
+        PORT_OUTPUT_HIGH(PBIT(OUTPUT3));
       break;
     
     case 3: 
       if (state == 0)
-        *portBOut &= CLEARBIT09;
+        PORT_OUTPUT_LOW(PBIT(OUTPUT4));
       else
-        *portBOut |= SETBIT09; 
+        PORT_OUTPUT_HIGH(PBIT(OUTPUT4));
       break;
     
     case 4: 
       if (state == 0)
-        *portBOut &= CLEARBIT08;
+        PORT_OUTPUT_LOW(PBIT(OUTPUT5));
       else
-        *portBOut |= SETBIT08; 
+        PORT_OUTPUT_HIGH(PBIT(OUTPUT5));
       break;
     
     case 5: 
       if (state == 0)
-        *portBOut &= CLEARBIT11;
+        PORT_OUTPUT_LOW(PBIT(STATUS_LED));
       else
-        *portBOut |= SETBIT11; 
+        PORT_OUTPUT_HIGH(PBIT(STATUS_LED));
       break;
   }
 }
@@ -2,8 +2,9 @@
 #define __OUTPUTS_H__
 
 #include <stdint.h>
+#include "SimplePIO.h"
 
-extern volatile uint32_t *portAOut, *portAMode, *portBOut, *portBMode;
+extern PORT_REGISTER *portAOut, *portAMode, *portBOut, *portBMode;
 
 // Initialize the registers controlling the outputs, and turn them off.
 void initOutputs(void);
@@ -7,18 +7,363 @@
 // maximize redundancy and minimize write wear.  Blocks have a 32-bit sequence number as the first
 // 4 bytes.  This number is increased after each write to be able to identify the latest prefs.
 // Blocks are initialized to 0xFF after erase, so preferences should be added with this in mind.
+//
+// Each block starts with a snapshot of the whole of the prefs.  Small changes don't need a new
+// snapshot: the parts of the prefs that changed are appended to the block as records, in the pages
+// after the snapshot.  A record is the offset and length of the changed bytes, the bytes, and a
+// CRC.  Records never cross a page boundary.  At boot the snapshot is read and the records are
+// applied in order.  When a block is full, a new snapshot is written to the next block (compaction).
+// So most saves are one partial page program instead of a 4K erase and a program of every page.
+//
+// A save either happens or it doesn't, even if the power goes off part way through it:
+//   - The records of a save are only applied if all of them were written.  All but the last have
+//     PREFS_RECORD_MORE set in their length.
+//   - The first record in a block is the CRC of the snapshot.  A block that was being erased or
+//     written when the power went off doesn't match it, so the previous block is used.
+//
+// To know what changed, a CRC of each 16-byte chunk of the prefs (as they are in flash) is kept.
+//
+// The prefs that change most often are also kept in the microcontroller's NVM (see NVMPrefs.cpp).
+// The NVM copy is the one that is used, so changes to them alone don't write to the external flash.
+// Snapshots still hold them (as they were when the snapshot was written), for when NVM is lost.
 #include "Prefs.h"
+#include "FlashCache.h"
+#include "FlashJobs.h"
+#include "NVMPrefs.h"
 #include "ReflowWizard.h"
 #include "printf-stdarg.h"
 #include "rtos_support.h"
 #include "string.h"
+#include <stddef.h>
 
 #define NO_OF_PREFS_BLOCKS          4
 #define PAGES_PER_PREFS_BLOCK       16
+#define PREFS_PAGE_SIZE             256
+
+#define PREFS_SNAPSHOT_PAGES        ((sizeof(Controleo3Prefs) + PREFS_PAGE_SIZE - 1) / PREFS_PAGE_SIZE)
+// Version 0 prefs ended before the profile sources, so their records start sooner
+#define PREFS_V0_SNAPSHOT_PAGES     ((offsetof(Controleo3Prefs, profileSources) + PREFS_PAGE_SIZE - 1) / PREFS_PAGE_SIZE)
+#define PREFS_CHUNK_SIZE            16
+#define PREFS_CHUNKS                ((sizeof(Controleo3Prefs) + PREFS_CHUNK_SIZE - 1) / PREFS_CHUNK_SIZE)
+#define PREFS_RECORD_HEADER_SIZE    6
+#define PREFS_RECORD_MAX_DATA       240   // Whole chunks that fit in a page, with the header
+#define PREFS_NO_RECORD             0xFFFF
+#define PREFS_SNAPSHOT_CRC          0xFFFE  // The offset of the record with the CRC of the snapshot
+#define PREFS_RECORD_MORE           0x8000  // In the length: more records of the same save follow
+
+// Written before the data of each record
+struct prefsRecordHeader {
+  uint16_t offset;                          // Where the data goes in Controleo3Prefs (0xFFFF = erased)
+  uint16_t length;                          // Bytes of data (and PREFS_RECORD_MORE)
+  uint16_t crc;                             // CRC of the offset, length and data
+};
 
 uint8_t lastPrefsBlock = 0;
 uint32_t timeOfLastSavePrefsRequest = 0;
 
+static uint16_t prefsChunkCRC[PREFS_CHUNKS];  // CRC of each chunk, as it is in flash
+static bool prefsChunkCRCsFromFlash = false;  // Work out the chunk CRCs from the flash before the next save
+static bool prefsNeedCompaction = true;       // The block can't be appended to
+static uint16_t prefsRecordPage;              // Where the next record goes (page in the block)
+static uint16_t prefsRecordOffset;
+static uint8_t prefsPageBuffer[PREFS_PAGE_SIZE];
+
+// Statistics
+static uint32_t prefsSaves = 0;
+static uint32_t prefsRecordsWritten = 0;
+static uint32_t prefsCompactions = 0;
+static uint32_t prefsBytesChanged = 0;
+static uint32_t prefsBytesProgrammed = 0;
+
+
+// CRC-16 (CCITT)
+uint16_t prefsCRC(uint16_t crc, const uint8_t *data, uint16_t length)
+{
+  while (length--) {
+    crc ^= (uint16_t) *data++ << 8;
+    for (uint8_t i=0; i < 8; i++)
+      crc = crc & 0x8000? (crc << 1) ^ 0x1021 : crc << 1;
+  }
+  return crc;
+}
+
+
+// CRC of a chunk of the prefs.  The sequence number isn't included, because it belongs to the block,
+// and neither are the prefs kept in NVM
+static uint16_t getChunkCRC(uint16_t chunk, const uint8_t *data)
+{
+  uint16_t start = chunk * PREFS_CHUNK_SIZE, end = start + PREFS_CHUNK_SIZE;
+  uint16_t crc = 0xFFFF;
+
+  if (start < sizeof(uint32_t))
+    start = sizeof(uint32_t);
+  if (end > sizeof(Controleo3Prefs))
+    end = sizeof(Controleo3Prefs);
+  for (uint16_t i = start; i < end; i++)
+    if (!isNVMPrefsByte(i))
+      crc = prefsCRC(crc, data + i - chunk * PREFS_CHUNK_SIZE, 1);
+  return crc;
+}
+
+
+// Remember what the prefs in RAM look like, because that is what is in flash
+static void setChunkCRCs()
+{
+  for (uint16_t chunk=0; chunk < PREFS_CHUNKS; chunk++)
+    prefsChunkCRC[chunk] = getChunkCRC(chunk, (uint8_t *) &prefs + chunk * PREFS_CHUNK_SIZE);
+}
+
+
+// The CRC of a snapshot covers the offset and length of its record, like other records, then
+// the snapshot.  This is the CRC to start with
+static uint16_t startSnapshotCRC()
+{
+  prefsRecordHeader header = {PREFS_SNAPSHOT_CRC, 0, 0};
+
+  return prefsCRC(0xFFFF, (uint8_t *) &header, 4);
+}
+
+
+// Work out the chunk CRCs from the snapshot in flash.  The snapshot pages are written from
+// the prefs in RAM by the flash job task, so they may hold a later change than the one
+// that was current when the pages were queued.  The snapshot won't match its CRC then, so
+// another snapshot is written.
+static void setChunkCRCsFromFlash()
+{
+  uint16_t page = lastPrefsBlock * PAGES_PER_PREFS_BLOCK;
+  uint16_t snapshotCRC = startSnapshotCRC();
+  prefsRecordHeader header;
+
+  for (uint16_t chunk=0; chunk < PREFS_CHUNKS; chunk++) {
+    if ((chunk * PREFS_CHUNK_SIZE) % PREFS_PAGE_SIZE == 0) {
+      readFlash(page++, PREFS_PAGE_SIZE, prefsPageBuffer);
+      uint16_t bytes = sizeof(Controleo3Prefs) - chunk * PREFS_CHUNK_SIZE;
+      snapshotCRC = prefsCRC(snapshotCRC, prefsPageBuffer, bytes > PREFS_PAGE_SIZE? PREFS_PAGE_SIZE : bytes);
+    }
+    prefsChunkCRC[chunk] = getChunkCRC(chunk, prefsPageBuffer + (chunk * PREFS_CHUNK_SIZE) % PREFS_PAGE_SIZE);
+  }
+  prefsChunkCRCsFromFlash = false;
+
+  readFlash(page, PREFS_RECORD_HEADER_SIZE, (uint8_t *) &header);
+  if (header.crc != snapshotCRC) {
+    printfD("Prefs snapshot changed while it was written\n");
+    prefsNeedCompaction = true;
+  }
+}
+
+
+// Does the snapshot that was just read into the prefs match its CRC?  Snapshots written by
+// older firmware don't have one
+static bool isSnapshotValid()
+{
+  prefsRecordHeader header;
+
+  if (prefs.versionNumber < PREFS_VERSION)
+    return true;
+  readFlash(lastPrefsBlock * PAGES_PER_PREFS_BLOCK + PREFS_SNAPSHOT_PAGES, PREFS_RECORD_HEADER_SIZE, (uint8_t *) &header);
+  return header.offset == PREFS_SNAPSHOT_CRC && header.length == 0 &&
+         header.crc == prefsCRC(startSnapshotCRC(), (uint8_t *) &prefs, sizeof(Controleo3Prefs));
+}
+
+
+// Apply the records after the snapshot, which start at firstPage, and find where the next
+// record goes.  If a record is corrupt, or the records of the last save weren't all written
+// (the power went off while it was being written), the saves before it are applied and the
+// block isn't used for more records; the next save writes a new snapshot.
+static void readPrefsRecords(uint16_t firstPage)
+{
+  uint16_t blockPage = lastPrefsBlock * PAGES_PER_PREFS_BLOCK;
+  prefsRecordHeader header;
+  uint16_t page, offset = 0, length = 0;
+  uint16_t endPage = firstPage, endOffset = 0;      // After the last record
+  uint16_t savedPage = firstPage, savedOffset = 0;  // After the last record of the last complete save
+  bool endFound = false, corrupt = false;
+
+  // Find the end of the records, and of the last complete save
+  prefsNeedCompaction = false;
+  for (page = firstPage; page < PAGES_PER_PREFS_BLOCK && !endFound && !corrupt; page++) {
+    readFlash(blockPage + page, PREFS_PAGE_SIZE, prefsPageBuffer);
+    for (offset = 0; offset + PREFS_RECORD_HEADER_SIZE <= PREFS_PAGE_SIZE; offset += PREFS_RECORD_HEADER_SIZE + length) {
+      memcpy(&header, prefsPageBuffer + offset, PREFS_RECORD_HEADER_SIZE);
+      if (header.offset == PREFS_NO_RECORD && header.length == PREFS_NO_RECORD && header.crc == PREFS_NO_RECORD) {
+        // The rest of this page is empty.  Is there anything in the next page?
+        if (page + 1 == PAGES_PER_PREFS_BLOCK || offset == 0)
+          endFound = true;
+        else {
+          readFlash(blockPage + page + 1, PREFS_RECORD_HEADER_SIZE, (uint8_t *) &header);
+          endFound = header.offset == PREFS_NO_RECORD;
+        }
+        break;
+      }
+      length = header.length & ~PREFS_RECORD_MORE;
+      // The snapshot CRC was checked by getPrefs()
+      bool snapshotCRC = page == firstPage && offset == 0 && header.offset == PREFS_SNAPSHOT_CRC && length == 0;
+      if (!snapshotCRC && (offset + PREFS_RECORD_HEADER_SIZE + length > PREFS_PAGE_SIZE || (uint32_t) header.offset + length > sizeof(Controleo3Prefs) ||
+          prefsCRC(prefsCRC(0xFFFF, (uint8_t *) &header, 4), prefsPageBuffer + offset + PREFS_RECORD_HEADER_SIZE, length) != header.crc)) {
+        printfD("Prefs record at page %d offset %d is corrupt\n", page, offset);
+        corrupt = true;
+        break;
+      }
+      endPage = page;
+      endOffset = offset + PREFS_RECORD_HEADER_SIZE + length;
+      if (!(header.length & PREFS_RECORD_MORE)) {
+        savedPage = endPage;
+        savedOffset = endOffset;
+      }
+    }
+  }
+  prefsRecordPage = page - 1;
+  prefsRecordOffset = offset;
+
+  // Apply the records of the complete saves
+  for (page = firstPage; page <= savedPage; page++) {
+    readFlash(blockPage + page, PREFS_PAGE_SIZE, prefsPageBuffer);
+    for (offset = 0; offset + PREFS_RECORD_HEADER_SIZE <= (page == savedPage? savedOffset : PREFS_PAGE_SIZE); offset += PREFS_RECORD_HEADER_SIZE + length) {
+      memcpy(&header, prefsPageBuffer + offset, PREFS_RECORD_HEADER_SIZE);
+      if (header.offset == PREFS_NO_RECORD)
+        break;
+      length = header.length & ~PREFS_RECORD_MORE;
+      if (header.offset != PREFS_SNAPSHOT_CRC)
+        memcpy((uint8_t *) &prefs + header.offset, prefsPageBuffer + offset + PREFS_RECORD_HEADER_SIZE, length);
+    }
+  }
+
+  if (corrupt || !endFound) {
+    // The block is full, or can't be appended to
+    prefsNeedCompaction = true;
+    return;
+  }
+  if (endPage != savedPage || endOffset != savedOffset) {
+    printfD("Prefs block ends with an incomplete save\n");
+    prefsNeedCompaction = true;
+    return;
+  }
+
+  // Everything after the last record must still be erased, or a new record can't be written there
+  for (page = prefsRecordPage; page < PAGES_PER_PREFS_BLOCK; page++) {
+    readFlash(blockPage + page, PREFS_PAGE_SIZE, prefsPageBuffer);
+    for (offset = page == prefsRecordPage? prefsRecordOffset : 0; offset < PREFS_PAGE_SIZE; offset++) {
+      if (prefsPageBuffer[offset] != 0xFF) {
+        printfD("Prefs block has a partly written record\n");
+        prefsNeedCompaction = true;
+        return;
+      }
+    }
+  }
+}
+
+
+// Queue the page being built in prefsPageBuffer to be written, and return without waiting.
+// The job reads the buffer when it runs, so the buffer can't be changed until then: the
+// next save and getPrefs() wait for the prefs jobs first, and a save that needs another
+// page waits before it starts on it.  Returns the flash page
+static uint16_t writePrefsPageBuffer(uint16_t page, uint16_t bytes)
+{
+  uint16_t flashPage = lastPrefsBlock * PAGES_PER_PREFS_BLOCK + page;
+
+  queueFlashWrite(flashPage, bytes, prefsPageBuffer, 0);
+  prefsBytesProgrammed += bytes - (page == prefsRecordPage? prefsRecordOffset : 0);
+  return flashPage;
+}
+
+
+// Append records for the chunks that have changed.  Returns false (without writing
+// anything) if they don't fit in the block
+static bool appendPrefsRecords(uint16_t *newChunkCRC)
+{
+  uint16_t page, offset, chunk, start, end, records = 0, record = 0;
+  prefsRecordHeader header;
+
+  // The first pass checks the records fit (and counts them), and the second pass writes them
+  for (uint8_t pass=0; pass < 2; pass++) {
+    page = prefsRecordPage;
+    offset = prefsRecordOffset;
+    if (pass)
+      memset(prefsPageBuffer, 0xFF, PREFS_PAGE_SIZE);
+
+    for (chunk=0; chunk < PREFS_CHUNKS; chunk++) {
+      if (newChunkCRC[chunk] == prefsChunkCRC[chunk])
+        continue;
+
+      // Records cover runs of changed chunks
+      start = chunk == 0? sizeof(uint32_t) : chunk * PREFS_CHUNK_SIZE;
+      while (chunk + 1U < PREFS_CHUNKS && newChunkCRC[chunk + 1] != prefsChunkCRC[chunk + 1] && (chunk + 2) * PREFS_CHUNK_SIZE - start <= PREFS_RECORD_MAX_DATA)
+        chunk++;
+      end = (chunk + 1) * PREFS_CHUNK_SIZE;
+      if (end > sizeof(Controleo3Prefs))
+        end = sizeof(Controleo3Prefs);
+
+      // Move to the next page if the record doesn't fit in this one
+      if (offset + PREFS_RECORD_HEADER_SIZE + end - start > PREFS_PAGE_SIZE) {
+        if (pass) {
+          waitForFlashJobs(writePrefsPageBuffer(page, offset), 1);
+          memset(prefsPageBuffer, 0xFF, PREFS_PAGE_SIZE);
+        }
+        page++;
+        offset = 0;
+      }
+      if (page >= PAGES_PER_PREFS_BLOCK)
+        return false;
+
+      if (!pass)
+        records++;
+      else {
+        header.offset = start;
+        header.length = (end - start) | (++record < records? PREFS_RECORD_MORE : 0);
+        header.crc = prefsCRC(prefsCRC(0xFFFF, (uint8_t *) &header, 4), (uint8_t *) &prefs + start, end - start);
+        memcpy(prefsPageBuffer + offset, &header, PREFS_RECORD_HEADER_SIZE);
+        memcpy(prefsPageBuffer + offset + PREFS_RECORD_HEADER_SIZE, (uint8_t *) &prefs + start, end - start);
+        prefsRecordsWritten++;
+        prefsBytesChanged += end - start;
+      }
+      offset += PREFS_RECORD_HEADER_SIZE + end - start;
+    }
+  }
+
+  if (offset > 0)
+    writePrefsPageBuffer(page, offset);
+  prefsRecordPage = page;
+  prefsRecordOffset = offset;
+  return true;
+}
+
+
+// Write a new snapshot of the prefs to the next block
+static void compactPrefs()
+{
+  uint16_t prefsSize = sizeof(Controleo3Prefs);
+  uint8_t *p = (uint8_t *) &prefs;
+
+  // Increase the preference sequence number
+  prefs.sequenceNumber++;
+
+  // Prefs get stored in the next block (not the current one).  This reduces flash wear, and adds some redundancy
+  lastPrefsBlock = (lastPrefsBlock + 1) % NO_OF_PREFS_BLOCKS;
+
+  // Erase the block the prefs will be stored to
+  uint16_t page = lastPrefsBlock * PAGES_PER_PREFS_BLOCK;
+  queueFlashErase(page, 0);
+
+  // The first page has the sequence number, so it is written last.  If the power goes
+  // off part way through, the block still looks erased and the previous block is used.
+  for (uint16_t i=1; i < PREFS_SNAPSHOT_PAGES; i++)
+    queueFlashWrite(page + i, prefsSize - i * PREFS_PAGE_SIZE > PREFS_PAGE_SIZE? PREFS_PAGE_SIZE : prefsSize - i * PREFS_PAGE_SIZE, p + i * PREFS_PAGE_SIZE, 0);
+
+  // The CRC of the snapshot is the first record.  It is written before the first page too
+  prefsRecordHeader header = {PREFS_SNAPSHOT_CRC, 0, prefsCRC(startSnapshotCRC(), p, prefsSize)};
+  memset(prefsPageBuffer, 0xFF, PREFS_PAGE_SIZE);
+  memcpy(prefsPageBuffer, &header, PREFS_RECORD_HEADER_SIZE);
+  queueFlashWrite(page + PREFS_SNAPSHOT_PAGES, PREFS_RECORD_HEADER_SIZE, prefsPageBuffer, 0);
+  queueFlashWrite(page, prefsSize > PREFS_PAGE_SIZE? PREFS_PAGE_SIZE : prefsSize, p, 0);
+
+  prefsCompactions++;
+  prefsBytesProgrammed += prefsSize + PREFS_RECORD_HEADER_SIZE;
+  prefsRecordPage = PREFS_SNAPSHOT_PAGES;
+  prefsRecordOffset = PREFS_RECORD_HEADER_SIZE;
+  prefsNeedCompaction = false;
+  prefsChunkCRCsFromFlash = true;
+}
+
 void getPrefs() 
 {
   // Sanity check on the size of the prefences
@@ -29,26 +374,59 @@ void getPrefs()
     delay(10000);
   }
   
-  // Get the prefs with the highest sequence number
-  uint32_t highestSequenceNumber = 0, seqNo;
-  uint8_t prefsToUse = 0;
-  for (uint8_t i=0; i < NO_OF_PREFS_BLOCKS; i++) {
-      flash.startRead(i * PAGES_PER_PREFS_BLOCK, sizeof(uint32_t), (uint8_t *) &seqNo);
-      flash.endRead();
-      // Skip blocks that are erased
-      if (seqNo == 0xFFFFFFFF)
-        continue;
-      // Is this the highest sequence number?
-      if (seqNo <= highestSequenceNumber)
-        continue;
-      // So far, this is the prefs block to use
-      highestSequenceNumber = seqNo;
-      prefsToUse = i;
+  // Queued record pages are written from prefsPageBuffer, which is about to be reused
+  waitForFlashJobs(0, NO_OF_PREFS_BLOCKS * PAGES_PER_PREFS_BLOCK);
+
+  // Get the prefs with the highest sequence number.  A block that was being erased or written
+  // when the power went off can have any sequence number, so its snapshot must match its CRC.
+  uint8_t prefsToUse, badBlocks = 0;
+  while (true) {
+    uint32_t highestSequenceNumber = 0, seqNo;
+    bool found = false;
+    prefsToUse = 0;
+    for (uint8_t i=0; i < NO_OF_PREFS_BLOCKS; i++) {
+        if (badBlocks & (1 << i))
+          continue;
+        readFlash(i * PAGES_PER_PREFS_BLOCK, sizeof(uint32_t), (uint8_t *) &seqNo);
+        // Skip blocks that are erased
+        if (seqNo == 0xFFFFFFFF)
+          continue;
+        // Is this the highest sequence number?
+        if (seqNo <= highestSequenceNumber)
+          continue;
+        // So far, this is the prefs block to use
+        highestSequenceNumber = seqNo;
+        prefsToUse = i;
+        found = true;
+    }
+
+    // Read all the prefs in now
+    lastPrefsBlock = prefsToUse;
+    if (!found) {
+      // As if the flash was erased
+      memset(&prefs, 0xFF, sizeof(prefs));
+      break;
+    }
+    readFlash(prefsToUse * PAGES_PER_PREFS_BLOCK, sizeof(Controleo3Prefs), (uint8_t *) &prefs);
+    if (isSnapshotValid())
+      break;
+    printfD("Prefs block %d is corrupt\n", prefsToUse);
+    badBlocks |= 1 << prefsToUse;
   }
+  bool olderPrefs = prefs.sequenceNumber != 0xFFFFFFFF && prefs.versionNumber < PREFS_VERSION;
+  if (prefs.sequenceNumber != 0xFFFFFFFF)
+    readPrefsRecords(olderPrefs? PREFS_V0_SNAPSHOT_PAGES : PREFS_SNAPSHOT_PAGES);
+  else
+    prefsNeedCompaction = true;
 
-  // Read all the prefs in now
-  flash.startRead(prefsToUse * PAGES_PER_PREFS_BLOCK, sizeof(Controleo3Prefs), (uint8_t *) &prefs);
-  flash.endRead();
+  // Prefs written by older firmware are smaller.  What was read after them isn't prefs, so
+  // clear it.  The next save writes a snapshot of the new prefs
+  if (olderPrefs) {
+    printfD("Upgrading prefs from version %d\n", prefs.versionNumber);
+    memset(prefs.profileSources, 0, sizeof(prefs.profileSources));
+    prefs.versionNumber = PREFS_VERSION;
+    prefsNeedCompaction = true;
+  }
 
   // If this is the first time the prefs are read in, initialize them
   if (prefs.sequenceNumber == 0xFFFFFFFF) {
@@ -66,9 +444,19 @@ void getPrefs()
     prefs.openDoorAfterBake = BAKE_DOOR_OPEN_CLOSE_COOL;
 
     prefs.lastUsedProfileBlock = FIRST_PROFILE_BLOCK;
+    prefs.versionNumber = PREFS_VERSION;
   }
 
-  printfD("Read prefs from block %d. Seq No = %lu\n", prefsToUse, prefs.sequenceNumber);
+  // The NVM has the latest copy of the hot prefs (read from the memory map).  If it has been
+  // lost, the hot prefs from the snapshot are used.  They may be old, but they are better than
+  // the defaults.  Write them to NVM now, so it has a record again.
+  if (!readNVMPrefs(&prefs)) {
+    printfD("No prefs in NVM - using the older copy in external flash\n");
+    writeNVMPrefs(&prefs);
+  }
+
+  printfD("Read prefs from block %d. Seq No = %lu. Next record at page %d offset %d\n", prefsToUse, prefs.sequenceNumber,
+          prefsRecordPage, prefsRecordOffset);
 
 /* Defaults for oven in build guide
   prefs.learningComplete = true;
@@ -79,9 +467,10 @@ void getPrefs()
   prefs.learnedInertia[1] = 136;
   prefs.learnedInertia[2] = 57;
   prefs.learnedInsulation = 124;*/
-  
-  // Remember which block was last used to save prefs
-  lastPrefsBlock = prefsToUse;
+
+  // The prefs in RAM are now the same as the prefs in flash
+  setChunkCRCs();
+  prefsChunkCRCsFromFlash = false;
 }
 
 
@@ -110,41 +499,51 @@ void checkIfPrefsShouldBeWrittenToFlash()
 
 
 // Flash writes are good for 50,000 cycles - and there are 4 blocks used for prefs = 200,000 cycles.  
+// Only the parts of the prefs that changed are written (as records), and a block is only erased
+// when it is full, so most saves don't use up a cycle at all.
+// The erase and page writes are queued (see FlashJobs.cpp) so the caller doesn't wait for them.
+// A snapshot is written from the prefs in RAM, so a change made while it is being written
+// may only be partly saved.  The change calls savePrefs(), so it is saved properly next time.
 void writePrefsToFlash() 
 {
-  // Increase the preference sequence number
-  prefs.sequenceNumber++;
+  uint32_t start = CPU_HZ_COUNTER();
+  static uint16_t newChunkCRC[PREFS_CHUNKS];
 
-  // Prefs get stored in the next block (not the current one).  This reduces flash wear, and adds some redundancy
-  lastPrefsBlock = (lastPrefsBlock + 1) % NO_OF_PREFS_BLOCKS;
-
-  // Erase the block the prefs will be stored to
-  flash.erasePrefsBlock(lastPrefsBlock);
-
-  // Save the preferences, one page (256 bytes) at a time
-  uint16_t prefsSize = sizeof(Controleo3Prefs);
-
-  // Sanity check on prefs size (maximum is 4K)
-  if (prefsSize > 4096) {
-    printfD("Prefs exceed the 4K maximum!!!\n");
+  // Sanity check on prefs size (maximum is 4K, less a page for records)
+  if (PREFS_SNAPSHOT_PAGES >= PAGES_PER_PREFS_BLOCK) {
+    printfD("Prefs exceed the 3.75K maximum!!!\n");
     return;
   }
 
-  // Allow the prefs to be written to
-  flash.allowWritingToPrefs(true);
+  // The hot prefs go to NVM
+  writeNVMPrefs(&prefs);
 
-  // There are 16 x 256 byte pages in 4K
-  uint16_t page = lastPrefsBlock * PAGES_PER_PREFS_BLOCK;
-  uint8_t *p = (uint8_t *) &prefs;
-  while (prefsSize > 0) {
-    flash.write(page++, prefsSize > 256? 256: prefsSize, p);
-    prefsSize = prefsSize > 256? prefsSize - 256: 0;
-    p += 256;
+  // Let the last save finish first
+  waitForFlashJobs(0, NO_OF_PREFS_BLOCKS * PAGES_PER_PREFS_BLOCK);
+  if (prefsChunkCRCsFromFlash)
+    setChunkCRCsFromFlash();
+  prefsSaves++;
+
+  // Which parts of the prefs have changed?
+  bool changed = false;
+  for (uint16_t chunk=0; chunk < PREFS_CHUNKS; chunk++) {
+    newChunkCRC[chunk] = getChunkCRC(chunk, (uint8_t *) &prefs + chunk * PREFS_CHUNK_SIZE);
+    changed |= newChunkCRC[chunk] != prefsChunkCRC[chunk];
   }
-  // Protect flash again, now that writing is done
-  flash.allowWritingToPrefs(false);
 
-  printfD("Finished writing prefs to block %d. Seq No = %lu", lastPrefsBlock, prefs.sequenceNumber);
+  if (!changed && !prefsNeedCompaction)
+    printfD("No prefs to write to external flash\n");
+  else if (!prefsNeedCompaction && appendPrefsRecords(newChunkCRC)) {
+    memcpy(prefsChunkCRC, newChunkCRC, sizeof(prefsChunkCRC));
+    printfD("Queued prefs records to block %d in %u us. Next record at page %d offset %d\n", lastPrefsBlock,
+            (unsigned int) ((CPU_HZ_COUNTER() - start) / (configCPU_CLOCK_HZ / 1000000)), prefsRecordPage, prefsRecordOffset);
+  }
+  else {
+    compactPrefs();
+    // How long the caller was held up (this was the whole erase and write before the jobs were queued)
+    printfD("Queued prefs write to block %d in %u us. Seq No = %lu\n", lastPrefsBlock,
+            (unsigned int) ((CPU_HZ_COUNTER() - start) / (configCPU_CLOCK_HZ / 1000000)), prefs.sequenceNumber);
+  }
   timeOfLastSavePrefsRequest = 0;
 }
 
@@ -156,7 +555,11 @@ void factoryReset(bool saveTouchCalibrationData)
   
   // Save the touchscreen calibration data
   memcpy(buffer100Bytes, &prefs.topLeftX, 16);
+  // Jobs still in the queue would write old prefs (or profile) pages back after the erase.
+  // Jobs only change the lower 128K, which is what is erased
+  waitForFlashJobs(0, 512);
   flash.factoryReset(); 
+  eraseNVMPrefs();
   // Get the factory-default prefs from flash
   getPrefs();
   // Restore the touchscreen data if touchscreen calibration data should be saved
@@ -164,6 +567,28 @@ void factoryReset(bool saveTouchCalibrationData)
     memcpy(&prefs.topLeftX, buffer100Bytes, 16);
   // Restore sequence number
   prefs.sequenceNumber = sequenceNumber;
+  // Write a whole new snapshot, with the restored sequence number
+  prefsNeedCompaction = true;
   writePrefsToFlash();
 }
 
+
+// Print the prefs statistics on the debug console
+void PrintPrefsStats()
+{
+  printfD("  Prefs size        = %u bytes (%u snapshot pages, %u chunks)\n", (unsigned int) sizeof(Controleo3Prefs),
+          (unsigned int) PREFS_SNAPSHOT_PAGES, (unsigned int) PREFS_CHUNKS);
+  printfD("  Block             = %u, seq no = %lu\n", (unsigned int) lastPrefsBlock, prefs.sequenceNumber);
+  printfD("  Next record       = page %u offset %u%s\n", (unsigned int) prefsRecordPage, (unsigned int) prefsRecordOffset,
+          prefsNeedCompaction? " (needs compaction)" : "");
+  printfD("  Saves             = %u\n", (unsigned int) prefsSaves);
+  printfD("  Records written   = %u\n", (unsigned int) prefsRecordsWritten);
+  printfD("  Compactions       = %u\n", (unsigned int) prefsCompactions);
+  printfD("  Bytes changed     = %u\n", (unsigned int) prefsBytesChanged);
+  printfD("  Bytes programmed  = %u\n", (unsigned int) prefsBytesProgrammed);
+  if (prefsBytesChanged)
+    printfD("  Write amplification = %u.%02u\n", (unsigned int) (prefsBytesProgrammed / prefsBytesChanged),
+            (unsigned int) ((prefsBytesProgrammed % prefsBytesChanged) * 100 / prefsBytesChanged));
+  PrintNVMPrefsStats();
+}
+
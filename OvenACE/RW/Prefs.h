@@ -17,4 +17,10 @@ void writePrefsToFlash(void);
 // This performs a factory reset, erasing preferences and profiles
 void factoryReset(bool saveTouchCalibrationData);
 
+// CRC-16 (CCITT) used by the prefs records.  Start with crc = 0xFFFF
+uint16_t prefsCRC(uint16_t crc, const uint8_t *data, uint16_t length);
+
+// Print the prefs statistics on the debug console
+extern "C" void PrintPrefsStats(void);
+
 #endif
\ No newline at end of file
@@ -3,6 +3,7 @@
 // Build a reflow oven: http://whizoo.com
 //
 #include "ReadProfiles.h"
+#include "FlashCache.h"
 #include "ReflowWizard.h"
 #include "Render.h"
 #include "Prefs.h"
@@ -15,6 +16,10 @@
 #include "ArduinoDefs.h"
 
 uint8_t flashBuffer256Bytes[256];     // Read/write from flash.  This is the size of a flash block
+static uint8_t profileReadBuffer[512];  // Profile files are read a SD card block at a time
+static uint32_t profileBytesRead;
+static uint16_t profileFilesImported;
+static uint16_t profileFilesUnchanged;
 
 // Read all the profiles from the SD card.  The profiles can be in sub-directories
 
@@ -52,11 +57,7 @@ void ReadProfilesFromSDCard()
     return;
   }
   printfD("SD Card initialized\n");
-
-  // Open the root folder to look for files
-  File root = SD.open("/");
-
-  processDirectory(root);
+  importProfilesFromSDCard();
 
   // Profiles are written to flash as part of the factory setup.  Write these immediately
   if (prefs.sequenceNumber < 10)
@@ -64,8 +65,26 @@ void ReadProfilesFromSDCard()
 }
 
 
+// Import the profiles from the SD card, once it has been initialized.  Returns the number
+// of profile files imported
+uint16_t importProfilesFromSDCard()
+{
+  // Open the root folder to look for files
+  File root = SD.open("/");
+
+  uint32_t start = millis();
+  profileBytesRead = 0;
+  profileFilesImported = 0;
+  profileFilesUnchanged = 0;
+  processDirectory(root, PATH_HASH_ROOT);
+  printfD("Imported %d profile files (%lu bytes) and skipped %d unchanged ones in %lu ms\n", profileFilesImported,
+          profileBytesRead, profileFilesUnchanged, millis() - start);
+  return profileFilesImported;
+}
+
+
 // Look for profile files in this directory
-void processDirectory(File dir)
+void processDirectory(File dir, uint32_t pathHash)
 {
   while (true) {
     File entry =  dir.openNextFile();
@@ -75,30 +94,41 @@ void processDirectory(File dir)
       return;
     }
 
-    // If this is a directory then process it (uses recursion)
-    if (entry.isDirectory())
-      processDirectory(entry);
-    else {
-      // Only look at TXT files
-      if (strstr(entry.name(), ".TXT"))
-        processFile(entry);
+    // If this is a directory then process it (uses recursion).  That closes the directory,
+    // and entry is a copy of it, so it mustn't be closed again here
+    if (entry.isDirectory()) {
+      processDirectory(entry, hashPath(pathHash, entry.name()));
+      continue;
     }
+
+    // Only look at TXT files
+    if (strstr(entry.name(), ".TXT"))
+      processFile(entry, hashPath(pathHash, entry.name()));
     entry.close();
   }
 }
 
 
 // Process a file with a TXT extension
-void processFile(File file)
+void processFile(File file, uint32_t pathHash)
 {
   profiles *newProfile = 0;
-  char c;
+  int c;
   uint16_t numbers[4];  // Array used to store numbers read from the file
   uint8_t token;
   
   // Some sanity checks on the file before processing it
   if (file.size() < 100)
     return;
+
+  // Skip the file if it hasn't changed since it was imported
+  profileSource *source = findProfileSource(pathHash);
+  uint32_t modified = file.modified();
+  if (source && source->size == file.size() && source->modified == modified) {
+    profileFilesUnchanged++;
+    return;
+  }
+
   // The file must start with "Controleo3"
   if (file.read(buffer100Bytes, 10) != 10)
     return;
@@ -106,16 +136,31 @@ void processFile(File file)
   if (strcmp(buffer100Bytes, "Controleo3") != 0)
     return;
 
+  // The file may have been copied to the card again without being changed
+  uint16_t crc = getFileCRC(file);
+  if (source && source->size == file.size() && source->crc == crc) {
+    printfD("File has a new date but the same contents: %s\n", file.name());
+    source->modified = modified;
+    savePrefs();
+    profileFilesUnchanged++;
+    return;
+  }
+
   // Looks like this is a valid profile file
   printfD("Processing file: %s\n", file.name());
+  profileFilesImported++;
+  profileBytesRead += file.size();
+  if (!file.seek(10))
+    return;
+  FileReader reader(&file, profileReadBuffer, sizeof(profileReadBuffer));
 
   // Reset the token search
   initTokenPtrs();
 
   // Keep reading characters until the entire file has been processed
-  while (file.available()) {
+  while ((c = reader.getc()) >= 0) {
     // See if this character resulted in a token being found
-    token = hasTokenBeenFound(file.read());
+    token = hasTokenBeenFound(c);
     if (token == NOT_A_TOKEN)
         continue;
 
@@ -131,7 +176,7 @@ void processFile(File file)
           goto tokenError;
         }
         // Get the name of the profile
-        if (!getStringFromFile(file, buffer100Bytes, MAX_PROFILE_NAME_LENGTH)) {
+        if (!getStringFromFile(reader, buffer100Bytes, MAX_PROFILE_NAME_LENGTH)) {
           printfD("Unable to find profile name\n");
           goto tokenError;
         }
@@ -169,8 +214,7 @@ void processFile(File file)
       case TOKEN_COMMENT1:
       case TOKEN_COMMENT2:
         // Discard everything until a new line character
-        while (file.available()) {
-          c = file.read();
+        while ((c = reader.getc()) >= 0) {
           if (c == 0x0A || c == 0x0D)
             break;
         }
@@ -178,7 +222,7 @@ void processFile(File file)
 
       case TOKEN_DISPLAY:
         // This should be followed by a string that should be displayed
-        if (!getStringFromFile(file, buffer100Bytes, MAX_PROFILE_DISPLAY_STR)) {
+        if (!getStringFromFile(reader, buffer100Bytes, MAX_PROFILE_DISPLAY_STR)) {
           printfD("Error getting display string\n");
           goto tokenError;
         }
@@ -191,15 +235,15 @@ void processFile(File file)
       case TOKEN_ELEMENT_DUTY_CYCLES:
       case TOKEN_BIAS:
         // This should be followed by 3 numbers, indicating bottom/top/boost
-        if (!getNumberFromFile(file, &numbers[0])) {
+        if (!getNumberFromFile(reader, &numbers[0])) {
           printfD("Error getting number 1/3\n");
           goto tokenError;
         }
-        if (!getNumberFromFile(file, &numbers[1])) {
+        if (!getNumberFromFile(reader, &numbers[1])) {
           printfD("Error getting number 2/3\n");
           goto tokenError;
         }
-        if (!getNumberFromFile(file, &numbers[2])) {
+        if (!getNumberFromFile(reader, &numbers[2])) {
           printfD("Error getting number 3/3\n");
           goto tokenError;
         }
@@ -212,11 +256,11 @@ void processFile(File file)
       case TOKEN_OVEN_DOOR_PERCENT:
       case TOKEN_MAINTAIN_TEMP:
         // These should be followed by 2 numbers
-        if (!getNumberFromFile(file, &numbers[0])) {
+        if (!getNumberFromFile(reader, &numbers[0])) {
           printfD("Error getting number 1/2\n");
           goto tokenError;
         }
-        if (!getNumberFromFile(file, &numbers[1])) {
+        if (!getNumberFromFile(reader, &numbers[1])) {
           printfD("Error getting number 2/2\n");
           goto tokenError;
         }
@@ -237,7 +281,7 @@ void processFile(File file)
       case TOKEN_WAIT_UNTIL_ABOVE_C:
       case TOKEN_WAIT_UNTIL_BELOW_C:
         // These require 1 parameter
-        if (!getNumberFromFile(file, &numbers[0])) {
+        if (!getNumberFromFile(reader, &numbers[0])) {
           printfD("Error getting number\n");
           goto tokenError;
         }
@@ -268,6 +312,10 @@ void processFile(File file)
   // Save the tokens in the profile to flash.  There might be an error if there were too many tokens in the file
   if (!writeTokenBufferToFlash(true))
     goto tokenError;
+
+  // Remember where the profile came from, so the file is skipped next time if it hasn't changed
+  if (newProfile)
+    saveProfileSource(newProfile->startBlock, pathHash, file.size(), modified, crc);
     
   // Sort the profiles to keep them in alphabetical order.  This also updates prefs.numProfiles
   sortProfiles();
@@ -289,6 +337,72 @@ tokenError:
 }
 
 
+// Add a file or directory name to the hash of the path of its directory
+uint32_t hashPath(uint32_t pathHash, const char *name)
+{
+  pathHash = (pathHash ^ '/') * PATH_HASH_PRIME;
+  while (*name)
+    pathHash = (pathHash ^ (uint8_t) *name++) * PATH_HASH_PRIME;
+  return pathHash;
+}
+
+
+// Get the CRC-16 of the whole file
+uint16_t getFileCRC(File file)
+{
+  uint16_t crc = 0xFFFF;
+  int bytesRead;
+
+  if (!file.seek(0))
+    return 0;
+  while ((bytesRead = file.read(profileReadBuffer, sizeof(profileReadBuffer))) > 0)
+    crc = prefsCRC(crc, profileReadBuffer, bytesRead);
+  return crc;
+}
+
+
+// Find the file a profile was imported from, using the hash of the file's path
+profileSource *findProfileSource(uint32_t pathHash)
+{
+  for (uint8_t i=0; i < MAX_PROFILES; i++) {
+    if (prefs.profileSources[i].startBlock && prefs.profileSources[i].pathHash == pathHash)
+      return &prefs.profileSources[i];
+  }
+  return 0;
+}
+
+
+// Remember the file a profile was imported from.  This replaces anything imported from
+// the same file before
+void saveProfileSource(uint16_t startBlock, uint32_t pathHash, uint32_t size, uint32_t modified, uint16_t crc)
+{
+  profileSource *source = findProfileSource(pathHash);
+
+  // Use a free entry if this file hasn't been imported before
+  for (uint8_t i=0; i < MAX_PROFILES && !source; i++) {
+    if (prefs.profileSources[i].startBlock == 0)
+      source = &prefs.profileSources[i];
+  }
+  if (!source)
+    return;
+  source->pathHash = pathHash;
+  source->size = size;
+  source->modified = modified;
+  source->crc = crc;
+  source->startBlock = startBlock;
+}
+
+
+// Forget the file a profile was imported from (the profile is being deleted)
+void forgetProfileSource(uint16_t startBlock)
+{
+  for (uint8_t i=0; i < MAX_PROFILES; i++) {
+    if (prefs.profileSources[i].startBlock == startBlock)
+      memset(&prefs.profileSources[i], 0, sizeof(profileSource));
+  }
+}
+
+
 // Set the tokens back to the beginning to continue the search for them
 void initTokenPtrs()
 {
@@ -328,16 +442,15 @@ uint8_t hasTokenBeenFound(char c)
 // Return false if the end-of-file is reached before the second double-quote is read.
 // Only save up to the maximum string length, and ignore (discard) any characters over
 // the maximum length
-bool getStringFromFile(File file, char *strBuffer, uint8_t maxLength)
+bool getStringFromFile(FileReader &reader, char *strBuffer, uint8_t maxLength)
 {
   bool doubleQuoteFound = false;
-  char c;
+  int c;
 
   // Empty string so far
   memset(strBuffer, 0, 20);
   
-  while (file.available()) {
-    c = file.read();
+  while ((c = reader.getc()) >= 0) {
     // Is this the first double-quote (the start of the string)?
     if (!doubleQuoteFound) {
       if (c == '"') 
@@ -373,15 +486,14 @@ bool getStringFromFile(File file, char *strBuffer, uint8_t maxLength)
 // reads until it finds a digit, and continues until it finds something that isn't a
 // digit.  This reads uint16_t numbers, so they are limited to 65,536 (2^16).
 // Return false if the end-of-file is reached before the number is found.
-bool getNumberFromFile(File file, uint16_t *num)
+bool getNumberFromFile(FileReader &reader, uint16_t *num)
 {
   bool digitFound = false;
-  char c;
+  int c;
 
   *num = 0;
   
-  while (file.available()) {
-    c = file.read();
+  while ((c = reader.getc()) >= 0) {
       
     if (!digitFound) {
       // Have we come to the end of the line without finding a digit?
@@ -563,12 +675,15 @@ bool writeTokenBufferToFlash(bool endOfProfile)
     flashBuffer256Bytes[offsetIntoBlock] = TOKEN_END_OF_PROFILE;
   
   if (numBlocksUsed < 16) {
-    // Unprotect flash so writing can take place
+    // Unprotect flash so writing can take place.  The flash is locked so a prefs save
+    // finishing in the flash job task can't protect it again part way through
+    flash.lock();
     flash.allowWritingToPrefs(true);
     // Write the 256-byte block of tokens (only have 4K = 16x256 blocks available)
     flash.write(startFlashBlock + numBlocksUsed, 256, flashBuffer256Bytes);
     // Protect flash again
     flash.allowWritingToPrefs(false);
+    flash.unlock();
     printfD("Wrote profile flash block %d size (bytes) = %d", (startFlashBlock + numBlocksUsed), offsetIntoBlock);
   }
 
@@ -608,8 +723,7 @@ uint16_t getNextTokenFromFlash(char *str, uint16_t *num)
 
     // Read the first block from flash into memory
     printfD("getNextTokenFromFlash: Reading first block %d\n", startBlock);
-    flash.startRead(startBlock, 256, flashBuffer256Bytes);
-    flash.endRead();
+    readFlash(startBlock, 256, flashBuffer256Bytes);
 
     // Done for now.  The next time this is called a real token will be returned
     return NOT_A_TOKEN;
@@ -677,8 +791,7 @@ uint16_t getNextTokenFromFlash(char *str, uint16_t *num)
       }
       // Read the next block from flash into memory
 //      printfD("getNextTokenFromFlash: Reading extra block " + String(startBlock+ blocksRead));
-      flash.startRead(startBlock + blocksRead, 256, flashBuffer256Bytes);
-      flash.endRead();
+      readFlash(startBlock + blocksRead, 256, flashBuffer256Bytes);
       offset = 0;
       return getNextTokenFromFlash(str, num);
 
@@ -882,8 +995,10 @@ void deleteProfile(uint8_t num)
   if (num >= MAX_PROFILES)
     return;
   // Firstly, delete the flash blocks used to store the profile
-  if (prefs.profile[num].startBlock)
+  if (prefs.profile[num].startBlock) {
     flash.eraseProfileBlock(prefs.profile[num].startBlock);
+    forgetProfileSource(prefs.profile[num].startBlock);
+  }
   // Set the block to zero in the prefs to indicate "not used"
   prefs.profile[num].startBlock = 0;
   // Profiles need to be sorted to account for the deleted profile
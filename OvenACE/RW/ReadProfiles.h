@@ -3,15 +3,40 @@
 
 #include <stdint.h>
 #include "Controleo3SD.h"
+#include "ReflowWizard.h"
+
+// Paths are hashed (FNV-1a) one name at a time, starting with the root directory
+#define PATH_HASH_ROOT                2166136261UL
+#define PATH_HASH_PRIME               16777619UL
 
 // Scan the SD card, looking for profiles
 void ReadProfilesFromSDCard(void);
 
-// Look for profile files in this directory
-void processDirectory(File dir);
+// Import the profiles from the SD card, once it has been initialized.  Returns the number
+// of profile files imported
+uint16_t importProfilesFromSDCard(void);
+
+// Look for profile files in this directory.  pathHash is the hash of the directory's path
+void processDirectory(File dir, uint32_t pathHash);
+
+// Process a file with a TXT extension, unless it hasn't changed since it was imported
+void processFile(File file, uint32_t pathHash);
+
+// Add a file or directory name to the hash of the path of its directory
+uint32_t hashPath(uint32_t pathHash, const char *name);
+
+// Get the CRC-16 of the whole file
+uint16_t getFileCRC(File file);
+
+// Find the file a profile was imported from, using the hash of the file's path
+profileSource *findProfileSource(uint32_t pathHash);
+
+// Remember the file a profile was imported from.  This replaces anything imported from
+// the same file before
+void saveProfileSource(uint16_t startBlock, uint32_t pathHash, uint32_t size, uint32_t modified, uint16_t crc);
 
-// Process a file with a TXT extension
-void processFile(File file);
+// Forget the file a profile was imported from (the profile is being deleted)
+void forgetProfileSource(uint16_t startBlock);
 
 // Set the tokens back to the beginning to continue the search for them
 void initTokenPtrs(void);
@@ -24,13 +49,13 @@ uint8_t hasTokenBeenFound(char c);
 // Return false if the end-of-file is reached before the second double-quote is read.
 // Only save up to the maximum string length, and ignore (discard) any characters over
 // the maximum length
-bool getStringFromFile(File file, char *strBuffer, uint8_t maxLength);
+bool getStringFromFile(FileReader &reader, char *strBuffer, uint8_t maxLength);
 
 // Read a number from the file.  This method doesn't care what the delimiter is; it just 
 // reads until it finds a digit, and continues until it finds something that isn't a
 // digit.  This reads uint16_t numbers, so they are limited to 65,536 (2^16).
 // Return false if the end-of-file is reached before the number is found.
-bool getNumberFromFile(File file, uint16_t *num);
+bool getNumberFromFile(FileReader &reader, uint16_t *num);
 
 // Convert the token to readable text
 char *tokenToText(char *str, uint8_t token, uint16_t *numbers);
@@ -6,6 +6,8 @@
 #include "ReadProfiles.h"
 #include "ReflowWizard.h"
 #include "Render.h"
+#include "TextField.h"
+#include "Compositor.h"
 #include "Utility.h"
 #include "Touch.h"
 #include "Outputs.h"
@@ -21,6 +23,12 @@
 #include "ArduinoDefs.h"
 #include "string.h"
 #include "stdio.h"
+
+// The status message (the text, then a countdown) and the reflow timer
+static TextField statusText(20, LINE(2), FONT_9PT_BLACK_ON_WHITE, TEXT_ALIGN_LEFT);
+static TextField statusNumber(20, LINE(2), FONT_9PT_BLACK_ON_WHITE_FIXED, TEXT_ALIGN_RIGHT);
+static TextField reflowDuration(240, 160, FONT_22PT_BLACK_ON_WHITE_FIXED, TEXT_ALIGN_CENTER);
+
 // Perform a reflow
 // Stay in this function until the bake is done or canceled
 void reflow(uint8_t profileNo)
@@ -86,9 +94,14 @@ void reflow(uint8_t profileNo)
   // Ug, hate goto's!  But this saves a lot of extraneous code.
 userChangedMindAboutAborting:
 
+  // The status message and timer have been erased
+  statusText.invalidate();
+  statusNumber.invalidate();
+  reflowDuration.invalidate();
+
   // Setup the tap targets on this screen
   clearTouchTargets();
-  drawButton(110, 230, 260, 87, BUTTON_LARGE_FONT, (char *) "STOP");
+  drawButton(110, 230, 260, BUTTON_LARGE_FONT, (char *) "STOP");
   defineTouchArea(20, 150, 440, 170); // Large tap target to stop baking
 
   // Toggle the baking temperature between C/F if the user taps in the top-right corner
@@ -424,7 +437,7 @@ userChangedMindAboutAborting:
             // The end of the profile has been reached.  Reflow is done
             // Change the STOP button to DONE
             tft.fillRect(150, 242, 180, 36, WHITE);
-            drawButton(110, 230, 260, 93, BUTTON_LARGE_FONT, (char *) "DONE");
+            drawButton(110, 230, 260, BUTTON_LARGE_FONT, (char *) "DONE");
             reflowPhase = REFLOW_ALL_DONE;
             // One more reflow completed!
             prefs.numReflows++;
@@ -656,65 +669,75 @@ userChangedMindAboutAborting:
 // Draw the abort dialog on the screen.  The user needs to confirm that they want to exit reflow
 void drawReflowAbortDialog()
 {
+  // Build the dialog in RAM so it appears all at once
+  startComposition(0, 90, 480, 230, WHITE);
   drawThickRectangle(0, 90, 480, 230, 15, RED);
-  tft.fillRect(15, 105, 450, 200, WHITE);
-  displayString(135, 110, FONT_12PT_BLACK_ON_WHITE, (char *) "Stop Reflow");
-  displayString(62, 150, FONT_9PT_BLACK_ON_WHITE, (char *) "Are you sure you want to stop");
-  displayString(62, 180, FONT_9PT_BLACK_ON_WHITE, (char *) "the reflow?");
+  composeText(135, 110, FONT_12PT_BLACK_ON_WHITE, "Stop Reflow");
+  composeText(62, 150, FONT_9PT_BLACK_ON_WHITE, "Are you sure you want to stop");
+  composeText(62, 180, FONT_9PT_BLACK_ON_WHITE, "the reflow?");
   clearTouchTargets();
-  drawTouchButton(60, 230, 160, 72, BUTTON_LARGE_FONT, (char *) "Stop");
-  drawTouchButton(260, 230, 160, 105, BUTTON_LARGE_FONT, (char *) "Cancel");
+  drawTouchButton(60, 230, 160, BUTTON_LARGE_FONT, (char *) "Stop");
+  drawTouchButton(260, 230, 160, BUTTON_LARGE_FONT, (char *) "Cancel");
+  endComposition();
 }
 
 
+// Only the glyphs that have changed since the last call are redrawn, so updating
+// the countdown once a second usually draws a single digit
 void updateStatusMessage(uint16_t token, uint16_t timer, uint16_t temperature)
 {
   uint16_t strLength;
+  bool showTimer = true;
   static uint8_t numberLength = 0;
 
   // Erase the area where the status message is displayed
   if (token == NOT_A_TOKEN) {
     tft.fillRect(20, LINE(2), 459, 24, WHITE);
+    statusText.invalidate();
+    statusNumber.invalidate();
     numberLength = 0;
   }
 
   switch (token) {
     case TOKEN_WAIT_FOR_SECONDS:
-      strLength = displayString(20, LINE(2), FONT_9PT_BLACK_ON_WHITE, (char *) "Waiting... ");
-      sprintf(buffer100Bytes, "%d", timer);
-      if (numberLength == 0)
-        numberLength = strlen(buffer100Bytes);
-      displayFixedWidthString(20+strLength, LINE(2), buffer100Bytes, numberLength, FONT_9PT_BLACK_ON_WHITE_FIXED);
+      strcpy(buffer100Bytes, "Waiting... ");
       break;
 
     case TOKEN_WAIT_UNTIL_ABOVE_C:
       sprintf(buffer100Bytes, "Continue when oven is above %d~C", temperature);
-      displayString(20, LINE(2), FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
+      showTimer = false;
       break;
       
     case TOKEN_WAIT_UNTIL_BELOW_C:
       sprintf(buffer100Bytes, "Continue when oven is below %d~C", temperature);
-      displayString(20, LINE(2), FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
+      showTimer = false;
       break;
 
     case TOKEN_TEMPERATURE_TARGET:
       sprintf(buffer100Bytes, "Ramping oven to %d~C ... ", temperature);
-      strLength = displayString(20, LINE(2), FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
-      sprintf(buffer100Bytes, "%d", timer);
-      if (numberLength == 0)
-        numberLength = strlen(buffer100Bytes);
-      displayFixedWidthString(20+strLength, LINE(2), buffer100Bytes, numberLength, FONT_9PT_BLACK_ON_WHITE_FIXED);
       break;
 
     case TOKEN_MAINTAIN_TEMP:
       sprintf(buffer100Bytes, "Holding temperature at %d~C ... ", temperature);
-      strLength = displayString(20, LINE(2), FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
-      sprintf(buffer100Bytes, "%d", timer);
-      if (numberLength == 0)
-        numberLength = strlen(buffer100Bytes);
-      displayFixedWidthString(20+strLength, LINE(2), buffer100Bytes, numberLength, FONT_9PT_BLACK_ON_WHITE_FIXED);
       break;
+
+    default:
+      return;
   }
+
+  // The number is drawn after the text, so it has to go first if the text changes
+  if (!showTimer || !statusText.isShowing(buffer100Bytes))
+    statusNumber.erase();
+  strLength = statusText.display(buffer100Bytes);
+  if (!showTimer)
+    return;
+
+  // Right-align the number in the space needed for the first number displayed
+  sprintf(buffer100Bytes, "%d", timer);
+  if (numberLength < strlen(buffer100Bytes))
+    numberLength = strlen(buffer100Bytes);
+  statusNumber.moveTo(20 + strLength + numberLength * getCharacterWidth(FONT_9PT_BLACK_ON_WHITE_FIXED, '0'));
+  statusNumber.display(buffer100Bytes);
 }
 
 
@@ -747,21 +770,10 @@ void showReflowError(uint16_t iconsX, char *line1, char *line2)
 
 
 // Display the reflow timer
+// The timer is kept centered, and only the digits that change are redrawn
 void displayReflowDuration(uint32_t seconds)
 {
-  static uint16_t oldWidth = 1, timerX = 130;
-
-  // Update the clock display
-  uint16_t newWidth = displayString(timerX, 160, FONT_22PT_BLACK_ON_WHITE_FIXED, secondsInClockFormat(buffer100Bytes, seconds));
-  // Keep the timer display centered
-  if (newWidth != oldWidth) {
-    // The width has changed (one more character on the display).  Erase what was there
-    tft.fillRect(timerX, 160, newWidth > oldWidth? newWidth : oldWidth, 48, WHITE);
-    // Redraw the timer
-    oldWidth = newWidth;
-    timerX = 240 - (newWidth >> 1);
-    displayString(timerX, 160, FONT_22PT_BLACK_ON_WHITE_FIXED, buffer100Bytes);
-  }
+  reflowDuration.display(secondsInClockFormat(buffer100Bytes, seconds));
 }
 
 
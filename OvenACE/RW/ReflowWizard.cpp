@@ -11,6 +11,10 @@
 #include "Prefs.h"
 #include "Temperature.h"
 #include "Render.h"
+#include "BitmapCache.h"
+#include "AssetPack.h"
+#include "FlashJobs.h"
+#include "ScreenBackgrounds.h"
 #include "Tones.h"
 #include "Touch.h"
 #include "Screens.h"
@@ -57,6 +61,12 @@ void setup(void) {
       getPrefs();
       factoryReset(false);
     }
+
+    // Install new bitmaps into external flash (if this pack isn't already there)
+    if (SD.exists((char *) ASSET_PACK_FILENAME)) {
+      flash.begin();
+      installAssetPack(ASSET_PACK_FILENAME, false);
+    }
   }
 
   // Get the splash screen up as quickly as possible
@@ -77,6 +87,20 @@ void setup(void) {
   // Get the prefs from external flash
   getPrefs();
 
+  // From now on, prefs are saved in the background
+  startFlashJobs();
+
+  // The bitmap cache gets what is left of the heap, now that every task has been created
+  initBitmapCache();
+
+  // Keep the glyphs used to show the temperature in the header in RAM.  The 22-point
+  // digits are too large (3.5K each) to keep them all in RAM.
+  pinFixedWidthFontInCache(FONT_9PT_BLACK_ON_WHITE_FIXED);
+  pinFixedWidthFontInCache(FONT_12PT_BLACK_ON_WHITE_FIXED);
+
+  // Find the screen backgrounds saved in external flash
+  initScreenBackgrounds();
+
   // Initialize the MAX31856's registers
   thermocouple.begin();
   initTemperature();
@@ -65,6 +65,8 @@
 
 // Height of the button in pixels
 #define BUTTON_HEIGHT                  61
+// Space between the text and icon on a button
+#define BUTTON_ICON_GAP                10
 
 #define BUTTON_SMALL_FONT              0
 #define BUTTON_LARGE_FONT              1
@@ -196,6 +198,15 @@ struct profiles {
   uint16_t startBlock;                        // Flash block where this profile is stored
 };
 
+// Where a profile was imported from on the SD card, so files that haven't changed aren't imported again
+struct profileSource {
+  uint32_t pathHash;                          // Hash of the path of the file (see ReadProfiles.cpp)
+  uint32_t size;                              // Size of the file
+  uint32_t modified;                          // FAT date (high 16 bits) and time the file was last written
+  uint16_t crc;                               // CRC-16 of the contents of the file
+  uint16_t startBlock;                        // The profile it was imported to (0 = not used)
+};
+
 #define FIRST_PROFILE_BLOCK            64     // First flash block available to store a profile
 #define PROFILE_SIZE_IN_BLOCKS         16     // Each profile can take 4K (16 x 256 byte blocks)
 #define LAST_PROFILE_BLOCK             (FIRST_PROFILE_BLOCK + (MAX_PROFILES * PROFILE_SIZE_IN_BLOCKS) - 1)
@@ -236,6 +247,7 @@ struct profiles {
 #define MAX_TOKEN_LENGTH           (MAX_PROFILE_DISPLAY_STR + 5)
 
 // Preferences (this can be 4Kb maximum)
+#define PREFS_VERSION                  1      // 1 = profile sources were added
 struct Controleo3Prefs {
   uint32_t  sequenceNumber;                   // Prefs are rotated between 4 blocks in flash, each 4K in size
   uint16_t  versionNumber;                    // Version number of these prefs
@@ -268,6 +280,7 @@ struct Controleo3Prefs {
   uint16_t  lastUsedProfileBlock;             // The last block used to store a profile.  Keep cycling them to reduce flash wear
 
   uint8_t   spare[100];                       // Spare bytes that are initialized to zero.  Aids future expansion
+  profileSource profileSources[MAX_PROFILES]; // The files the profiles were imported from (version 1)
 };
 
 extern Controleo3Prefs prefs;
@@ -7,45 +7,100 @@
 #include <stdint.h>
 #include "Render.h"
 #include "Bitmaps.h"
+#include "BitmapCache.h"
+#include "Compositor.h"
 #include "ReflowWizard.h"
+#include "rtos_support.h"
 #include "printf-stdarg.h"
 #include "string.h"
 
+static_assert(FLASH_BITMAP_DIRECTORY_SIZE > BITMAP_LAST_ONE, "The RAM bitmap directory must hold every bitmap");
+
 // Render a bitmap to the screen
 // All the bitmaps exist in external flash, but some are duplicated in microcontroller flash.
 // Reading from microcontroller flash is 20 times faster than external flash, so it makes sense
 // to keep some of the most used bitmaps there.
+// Bitmaps that are only in external flash are kept in a RAM cache if they are small enough.
 uint16_t renderBitmap(uint16_t bitmapNumber, uint16_t x, uint16_t y) {
+  uint16_t bitmapWidth, bitmapHeight;
+  uint16_t *bitmap;
+
   // Render from microcontroller flash, if the bitmap exists there
   if (flashBitmaps[bitmapNumber])
     return renderBitmapFromMicrocontrollerFlash(bitmapNumber, x, y);
+
+  // Render from the RAM cache, if the bitmap is (or can be) cached
+  if (bitmapNumber <= BITMAP_LAST_ONE && (bitmap = getCachedBitmap(bitmapNumber, &bitmapWidth, &bitmapHeight)) != 0) {
+    tft.startBitmap(x, y, bitmapWidth, bitmapHeight);
+    tft.drawBitmap(bitmap, bitmapWidth * bitmapHeight);
+    tft.endBitmap();
+    return bitmapWidth;
+  }
   return renderBitmapFromExternalFlash(bitmapNumber, x, y);
 }
 
 
-// Render a bitmap from external flash
-// Returns the width of the rendered bitmap (needed when writing text)
-uint16_t renderBitmapFromExternalFlash(uint16_t bitmapNumber, uint16_t x, uint16_t y)
+// Get the flash page where a bitmap is stored (from the RAM copy of the address table)
+// Returns 0xFFFF if the bitmap isn't valid
+static uint16_t getExternalFlashBitmap(uint16_t bitmapNumber, uint16_t *bitmapWidth, uint16_t *bitmapHeight)
 {
-    uint16_t bitmapHeight, bitmapWidth, pageWhereBitmapIsStored, pixelsInPage;
-    uint32_t bitmapPixels;
-    uint16_t buf[128];    // 256 bytes
+    uint16_t pageWhereBitmapIsStored;
 
     // Make sure this is a valid bitmap
     if (bitmapNumber > BITMAP_LAST_ONE) {
       printfD("RenderBitmap: bitmap number is not valid\n");
-      return 0;
+      return 0xFFFF;
     }
 
-    // Get the flash page where this bitmap is stored 
-    pageWhereBitmapIsStored = flash.getBitmapInfo(bitmapNumber, &bitmapWidth, &bitmapHeight);
+    pageWhereBitmapIsStored = flash.getBitmapInfo(bitmapNumber, bitmapWidth, bitmapHeight);
     if (pageWhereBitmapIsStored > 0xFFF) {
       printfD("RenderBitmap: pageWhereBitmapIsStored is too big\n");
-      return 0;
+      return 0xFFFF;
     }
+    return pageWhereBitmapIsStored;
+}
+
+
+// Send pixels from external flash straight to the LCD, which must be in a bitmap
+// window (see tft.startBitmap).  The pixels start at the beginning of the page.
+// The flash is read continuously across page boundaries, so the pixels never
+// pass through RAM.
+void streamFlashToLCD(uint16_t page, uint32_t pixels)
+{
+    flash.startRead(page, 0, 0);
+    tft.drawBitmapFromFlash(pixels);
+    flash.endRead();
+}
 
-    if (0 && bitmapNumber >= BITMAP_LEFT_ARROW)
-      printfD("N=%d H=%d W=%d Center=%d\n",bitmapNumber, bitmapHeight, bitmapWidth, ((480 - bitmapWidth) >> 1));
+
+// Render a bitmap from external flash
+// Returns the width of the rendered bitmap (needed when writing text)
+uint16_t renderBitmapFromExternalFlash(uint16_t bitmapNumber, uint16_t x, uint16_t y)
+{
+    uint16_t bitmapHeight, bitmapWidth, pageWhereBitmapIsStored;
+
+    pageWhereBitmapIsStored = getExternalFlashBitmap(bitmapNumber, &bitmapWidth, &bitmapHeight);
+    if (pageWhereBitmapIsStored > 0xFFF)
+      return 0;
+
+    tft.startBitmap(x, y, bitmapWidth, bitmapHeight);
+    streamFlashToLCD(pageWhereBitmapIsStored, (uint32_t) bitmapWidth * bitmapHeight);
+    tft.endBitmap();
+    return bitmapWidth;
+}
+
+
+// Render a bitmap from external flash one page at a time, through a RAM buffer.  This
+// is how bitmaps were rendered before streamFlashToLCD(), and is kept for the benchmark.
+static uint16_t renderBitmapFromExternalFlashBuffered(uint16_t bitmapNumber, uint16_t x, uint16_t y)
+{
+    uint16_t bitmapHeight, bitmapWidth, pageWhereBitmapIsStored, pixelsInPage;
+    uint32_t bitmapPixels;
+    uint16_t buf[128];    // 256 bytes
+
+    pageWhereBitmapIsStored = getExternalFlashBitmap(bitmapNumber, &bitmapWidth, &bitmapHeight);
+    if (pageWhereBitmapIsStored > 0xFFF)
+      return 0;
 
     // Calculate the number of pixels that need to be rendered
     bitmapPixels = bitmapWidth * bitmapHeight;
@@ -77,25 +132,27 @@ uint16_t renderBitmapFromExternalFlash(uint16_t bitmapNumber, uint16_t x, uint16
 // Render a bitmap from microcontroller flash
 // Returns the width of the rendered bitmap (needed when writing text)
 // The first 2 bytes of the bitmap is the width and height of the bitmap
+// The rest of the bitmap is run-length encoded (see Bitmaps.cpp)
 uint16_t renderBitmapFromMicrocontrollerFlash(uint16_t bitmapNumber, uint16_t x, uint16_t y)
 {
     uint16_t bitmapHeight, bitmapWidth;
     uint32_t bitmapPixels;
-    char *fontBitmap;
+    const uint16_t *bitmap;
     
     // Get a pointer to the bitmap from the bitmap table
-    fontBitmap = (char *) flashBitmaps[bitmapNumber];
+    bitmap = flashBitmaps[bitmapNumber];
 
     // The bitmap width and height are the first 2 bytes
-    bitmapHeight = *(fontBitmap++);
-    bitmapWidth = *(fontBitmap++);
+    bitmapHeight = *bitmap & 0xFF;
+    bitmapWidth = *bitmap++ >> 8;
     bitmapPixels = bitmapWidth * bitmapHeight;
     if (0 && bitmapNumber >= FONT_IMAGES && bitmapNumber < BITMAP_CONVECTION_FAN1 && bitmapNumber > BITMAP_COOLING_FAN3)
       printfD("N=%d H=%d W=%d Center=%d\n", bitmapNumber, bitmapHeight,bitmapWidth, ((480 - bitmapWidth) >> 1));
 
     // Start rendering the bitmap
     tft.startBitmap(x, y, bitmapWidth, bitmapHeight);
-    tft.drawBitmap((uint16_t *) fontBitmap, bitmapPixels);
+    if (!tft.drawBitmapRLE(bitmap, bitmapPixels))
+      printfD("RenderBitmap: bitmap %d is corrupt\n", bitmapNumber);
     tft.endBitmap();
     return bitmapWidth;
 }
@@ -103,14 +160,10 @@ uint16_t renderBitmapFromMicrocontrollerFlash(uint16_t bitmapNumber, uint16_t x,
 
 // Display a string on the screen, using the specified font
 // Only ASCII-printable character are supported
+// Use measureString() to find out how wide a string is without drawing it
 uint16_t displayString(uint16_t x, uint16_t y, uint8_t font, char *str) {
-  bool firstChar = true, printData = true;
+  bool firstChar = true;
   uint16_t start = x;
-  if (true /* strstr(str, "~") > 0 || strstr(str, ":") > 0 */)
-    printData = false;
-  else {
-    printfD("Width of [%s] is ", str);
-  }
   while (*str != 0) {
     if (!firstChar)
       x += preCharacterSpace(font, *str);
@@ -118,19 +171,64 @@ uint16_t displayString(uint16_t x, uint16_t y, uint8_t font, char *str) {
     x += displayCharacter(font, x, y, *str);
     x += postCharacterSpace(font, *str++);
   }
-  if (printData) {
-    printfD("%d. Center = %d\n", 
-      (x - start - postCharacterSpace(font, *(str-1))),
-      ((480 - x + start + postCharacterSpace(font, *(str-1))) / 2));
-  }
   return x - start - postCharacterSpace(font, *(str-1));
 }
 
 
+// Get the width of a string without drawing it (the value displayString() would return)
+// This only needs the bitmap sizes, which are in microcontroller flash or RAM
+uint16_t measureString(uint8_t font, const char *str)
+{
+  uint16_t width = 0;
+
+  for (bool firstChar = true; *str; firstChar = false, str++) {
+    if (!firstChar)
+      width += postCharacterSpace(font, *(str-1)) + preCharacterSpace(font, *str);
+    width += getCharacterWidth(font, *str);
+  }
+  return width;
+}
+
+
+// Display a string centered on x.  Returns the width of the string
+uint16_t displayCenteredString(uint16_t x, uint16_t y, uint8_t font, char *str)
+{
+  return displayString(x - (measureString(font, str) >> 1), y, font, str);
+}
+
+
+// Display a string that ends at x.  Returns the width of the string
+uint16_t displayRightAlignedString(uint16_t x, uint16_t y, uint8_t font, char *str)
+{
+  return displayString(x - measureString(font, str), y, font, str);
+}
+
+
+// Shorten a string (in place) so it is no wider than maxWidth, ending it with "..."
+char *ellipsizeString(uint8_t font, char *str, uint16_t maxWidth)
+{
+  int16_t length = strlen(str);
+
+  if (measureString(font, str) <= maxWidth)
+    return str;
+
+  // Drop characters from the end until it fits
+  for (int16_t i = length - 3; i >= 0; i--) {
+    // Don't leave a space before the "..."
+    if (i && str[i-1] == ' ')
+      continue;
+    strcpy(str + i, "...");
+    if (measureString(font, str) <= maxWidth)
+      break;
+  }
+  return str;
+}
+
+
 // Display a character on the screen, using the specified font
 uint16_t displayCharacter(uint8_t font, uint16_t x, uint16_t y, uint8_t c)
 {
-  uint16_t bitmapNumber = 0;
+  uint16_t bitmapNumber;
 
   // Make sure the character can be printed
   if (!isSupportedCharacter(font, c)) {
@@ -141,16 +239,67 @@ uint16_t displayCharacter(uint8_t font, uint16_t x, uint16_t y, uint8_t c)
   // Special case for space
   if (c == ' ') {
     // Don't display anything.  Just return the width of the space character
-    if (font == FONT_9PT_BLACK_ON_WHITE || font == FONT_9PT_BLACK_ON_WHITE_FIXED)
-      return 10;
-    if (font == FONT_12PT_BLACK_ON_WHITE || font == FONT_12PT_BLACK_ON_WHITE_FIXED)
-      return 16;
-    // Must be the 22-point font
-    return 22;
+    return getSpaceWidth(font);
   }
 
   // Get the bitmap number
-  switch (font) {
+  bitmapNumber = getBitmapNumberForCharacter(&font, c);
+
+  // Display the character
+  return renderBitmap(bitmapNumber, x, y + getYOffsetForCharacter(font, c));
+}
+
+
+// Get the width of a character without drawing it (the value displayCharacter() would return)
+uint16_t getCharacterWidth(uint8_t font, uint8_t c)
+{
+  uint16_t bitmapWidth, bitmapHeight;
+
+  if (!isSupportedCharacter(font, c))
+    return 0;
+  if (c == ' ')
+    return getSpaceWidth(font);
+  if (!getBitmapSize(getBitmapNumberForCharacter(&font, c), &bitmapWidth, &bitmapHeight))
+    return 0;
+  return bitmapWidth;
+}
+
+
+// The space character isn't a bitmap.  It just moves the next character along
+uint16_t getSpaceWidth(uint8_t font)
+{
+  if (font == FONT_9PT_BLACK_ON_WHITE || font == FONT_9PT_BLACK_ON_WHITE_FIXED)
+    return 10;
+  if (font == FONT_12PT_BLACK_ON_WHITE || font == FONT_12PT_BLACK_ON_WHITE_FIXED)
+    return 16;
+  // Must be the 22-point font
+  return 22;
+}
+
+
+// Get the width and height of a bitmap without drawing it.  Returns false if the bitmap isn't valid
+// The size comes from microcontroller flash or the RAM copy of the bitmap directory, so this is quick
+bool getBitmapSize(uint16_t bitmapNumber, uint16_t *bitmapWidth, uint16_t *bitmapHeight)
+{
+  if (flashBitmaps[bitmapNumber]) {
+    *bitmapHeight = *flashBitmaps[bitmapNumber] & 0xFF;
+    *bitmapWidth = *flashBitmaps[bitmapNumber] >> 8;
+    return true;
+  }
+  if (bitmapNumber > BITMAP_LAST_ONE)
+    return false;
+  return flash.getBitmapInfo(bitmapNumber, bitmapWidth, bitmapHeight) <= 0xFFF;
+}
+
+
+// Get the bitmap used to draw a (supported, non-space) character
+// Fixed-width fonts only contain some characters.  The others come from the
+// proportional font of the same size, in which case font is changed to that font.
+uint16_t getBitmapNumberForCharacter(uint8_t *font, uint8_t c)
+{
+  uint16_t bitmapNumber = 0;
+
+  switch (*font) {
     case FONT_9PT_BLACK_ON_WHITE:
       bitmapNumber = FONT_FIRST_9PT_BW + c - 33;
       break;
@@ -167,7 +316,7 @@ uint16_t displayCharacter(uint8_t font, uint16_t x, uint16_t y, uint8_t c)
         bitmapNumber = FONT_FIRST_9PT_BW_FIXED + 10;
       else {
         bitmapNumber = FONT_FIRST_9PT_BW + c - 33;
-        font = FONT_9PT_BLACK_ON_WHITE;
+        *font = FONT_9PT_BLACK_ON_WHITE;
       }
       break;
 
@@ -181,7 +330,7 @@ uint16_t displayCharacter(uint8_t font, uint16_t x, uint16_t y, uint8_t c)
         bitmapNumber = FONT_FIRST_12PT_BW_FIXED + 11;
       else {
         bitmapNumber = FONT_FIRST_12PT_BW + c - 33;
-        font = FONT_12PT_BLACK_ON_WHITE;
+        *font = FONT_12PT_BLACK_ON_WHITE;
       }
       break;
 
@@ -198,9 +347,7 @@ uint16_t displayCharacter(uint8_t font, uint16_t x, uint16_t y, uint8_t c)
       break;
 
   }
-
-  // Display the character
-  return renderBitmap(bitmapNumber, x, y + getYOffsetForCharacter(font, c));
+  return bitmapNumber;
 }
 
 
@@ -372,42 +519,90 @@ void displayFixedWidthString(uint16_t x, uint16_t y, char *str, uint8_t maxChars
 
 
 // Draw a button on the screen
-void drawButton(uint16_t x, uint16_t y, uint16_t width, uint16_t textWidth, bool useLargeFont, char *text) {
+// The text is centered on the button
+// The button is added to the composition, if one is being built (see Compositor.h)
+void drawButton(uint16_t x, uint16_t y, uint16_t width, bool useLargeFont, char *text) {
+  uint8_t font = useLargeFont? FONT_12PT_BLACK_ON_WHITE: FONT_9PT_BLACK_ON_WHITE;
   drawButtonOutline(x, y, width);
-  if (useLargeFont)
-    displayString(x + (width >> 1) - (textWidth >> 1), y+18, FONT_12PT_BLACK_ON_WHITE, text);
-  else
-    displayString(x + (width >> 1) - (textWidth >> 1), y+21, FONT_9PT_BLACK_ON_WHITE, text);
+  composeText(x + (width >> 1) - (measureString(font, text) >> 1), useLargeFont? y+18: y+21, font, text);
 }
 
 
 void drawButtonOutline(uint16_t x, uint16_t y, uint16_t width) {
   uint16_t lineX = x + 15, lineWidth = width - 30;
-  renderBitmap(BITMAP_LEFT_BUTTON_BORDER, x, y);
-  renderBitmap(BITMAP_RIGHT_BUTTON_BORDER, x + width - 15, y);
-
-  tft.drawFastHLine(lineX, y, lineWidth, 0xEF5F);
-  tft.drawFastHLine(lineX, y+1, lineWidth, 0xC61F);
-  tft.drawFastHLine(lineX, y+2, lineWidth, 0xE71F);
-//  tft.drawFastHLine(lineX, y+3, lineWidth, 0xFFFF); No need to draw white lines since the background is already white
-//  tft.drawFastHLine(lineX, y+4, lineWidth, 0xFFFF);
-  tft.drawFastHLine(lineX, y+5, lineWidth, 0x94BF);
-  tft.drawFastHLine(lineX, y+6, lineWidth, 0x423F);
-  tft.drawFastHLine(lineX, y+7, lineWidth, 0x423F);
-  tft.drawFastHLine(lineX, y+8, lineWidth, 0x421F);
-  tft.drawFastHLine(lineX, y+9, lineWidth, 0x4A7F);
-  tft.drawFastHLine(lineX, y+10, lineWidth, 0xCE9F);
+  composeBitmap(BITMAP_LEFT_BUTTON_BORDER, x, y);
+  composeBitmap(BITMAP_RIGHT_BUTTON_BORDER, x + width - 15, y);
+
+  composeRect(lineX, y, lineWidth, 1, 0xEF5F);
+  composeRect(lineX, y+1, lineWidth, 1, 0xC61F);
+  composeRect(lineX, y+2, lineWidth, 1, 0xE71F);
+//  composeRect(lineX, y+3, lineWidth, 1, 0xFFFF); No need to draw white lines since the background is already white
+//  composeRect(lineX, y+4, lineWidth, 1, 0xFFFF);
+  composeRect(lineX, y+5, lineWidth, 1, 0x94BF);
+  composeRect(lineX, y+6, lineWidth, 1, 0x423F);
+  composeRect(lineX, y+7, lineWidth, 1, 0x423F);
+  composeRect(lineX, y+8, lineWidth, 1, 0x421F);
+  composeRect(lineX, y+9, lineWidth, 1, 0x4A7F);
+  composeRect(lineX, y+10, lineWidth, 1, 0xCE9F);
   y+= 50;
-  tft.drawFastHLine(lineX, y, lineWidth, 0xCE9F);
-  tft.drawFastHLine(lineX, y+1, lineWidth, 0x4A7F);
-  tft.drawFastHLine(lineX, y+2, lineWidth, 0x421F);
-  tft.drawFastHLine(lineX, y+3, lineWidth, 0x423F);
-  tft.drawFastHLine(lineX, y+4, lineWidth, 0x423F);
-  tft.drawFastHLine(lineX, y+5, lineWidth, 0x94BF);
-//  tft.drawFastHLine(lineX, y+6, lineWidth, 0xFFFF);
-//  tft.drawFastHLine(lineX, y+7, lineWidth, 0xFFFF);
-  tft.drawFastHLine(lineX, y+8, lineWidth, 0xE71F);
-  tft.drawFastHLine(lineX, y+9, lineWidth, 0xC61F);
-  tft.drawFastHLine(lineX, y+10, lineWidth, 0xEF5F);
+  composeRect(lineX, y, lineWidth, 1, 0xCE9F);
+  composeRect(lineX, y+1, lineWidth, 1, 0x4A7F);
+  composeRect(lineX, y+2, lineWidth, 1, 0x421F);
+  composeRect(lineX, y+3, lineWidth, 1, 0x423F);
+  composeRect(lineX, y+4, lineWidth, 1, 0x423F);
+  composeRect(lineX, y+5, lineWidth, 1, 0x94BF);
+//  composeRect(lineX, y+6, lineWidth, 1, 0xFFFF);
+//  composeRect(lineX, y+7, lineWidth, 1, 0xFFFF);
+  composeRect(lineX, y+8, lineWidth, 1, 0xE71F);
+  composeRect(lineX, y+9, lineWidth, 1, 0xC61F);
+  composeRect(lineX, y+10, lineWidth, 1, 0xEF5F);
 }
 
+
+
+static volatile bool lcdBenchmarkRequested = false;
+
+
+// Ask the UI task to run the LCD and render benchmarks, the next time it waits for a tap.
+// The USB task can't run them itself, because nothing stops the UI task drawing at the same time
+void RequestLCDBenchmark()
+{
+  lcdBenchmarkRequested = true;
+}
+
+
+// Run the LCD and render benchmarks if RequestLCDBenchmark() has been called
+void runRequestedLCDBenchmark()
+{
+  if (!lcdBenchmarkRequested)
+    return;
+  lcdBenchmarkRequested = false;
+  PrintLCDBenchmark();
+  PrintRenderBenchmark();
+}
+
+
+// Time drawing bitmaps from external flash, through a RAM buffer and streamed straight
+// to the LCD, and print the results.  This draws over the screen, so it should only be
+// used when the oven is idle.
+void PrintRenderBenchmark()
+{
+    static const uint16_t bitmaps[] = {BITMAP_CONTROLEO3, BITMAP_WHIZOO};
+    uint16_t bitmapWidth, bitmapHeight;
+    uint32_t start, buffered, streamed;
+
+    printfD("External flash bitmaps (buffered vs streamed):\n");
+    for (uint8_t i=0; i < sizeof(bitmaps) / sizeof(bitmaps[0]); i++) {
+      if (getExternalFlashBitmap(bitmaps[i], &bitmapWidth, &bitmapHeight) > 0xFFF)
+        continue;
+      start = CPU_HZ_COUNTER();
+      renderBitmapFromExternalFlashBuffered(bitmaps[i], 0, 0);
+      buffered = CPU_HZ_COUNTER() - start;
+      start = CPU_HZ_COUNTER();
+      renderBitmapFromExternalFlash(bitmaps[i], 0, 0);
+      streamed = CPU_HZ_COUNTER() - start;
+      printfD("  Bitmap %3u %3ux%-3u = %8u / %8u cycles (%u / %u cycles per pixel)\n", (unsigned int) bitmaps[i],
+              (unsigned int) bitmapWidth, (unsigned int) bitmapHeight, (unsigned int) buffered, (unsigned int) streamed,
+              (unsigned int) (buffered / ((uint32_t) bitmapWidth * bitmapHeight)), (unsigned int) (streamed / ((uint32_t) bitmapWidth * bitmapHeight)));
+    }
+}
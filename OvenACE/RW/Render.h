@@ -9,6 +9,10 @@ uint16_t renderBitmap(uint16_t bitmapNumber, uint16_t x, uint16_t y);
 // Returns the width of the rendered bitmap (needed when writing text)
 uint16_t renderBitmapFromExternalFlash(uint16_t bitmapNumber, uint16_t x, uint16_t y);
 
+// Send pixels from external flash straight to the LCD, which must be in a bitmap window
+// The pixels start at the beginning of the page
+void streamFlashToLCD(uint16_t page, uint32_t pixels);
+
 // Render a bitmap from microcontroller flash
 // Returns the width of the rendered bitmap (needed when writing text)
 // The first 2 bytes of the bitmap is the width and height of the bitmap
@@ -18,9 +22,35 @@ uint16_t renderBitmapFromMicrocontrollerFlash(uint16_t bitmapNumber, uint16_t x,
 // Only ASCII-printable character are supported
 uint16_t displayString(uint16_t x, uint16_t y, uint8_t font, char *str);
 
+// Get the width of a string without drawing it (the value displayString() would return)
+uint16_t measureString(uint8_t font, const char *str);
+
+// Display a string centered on x.  Returns the width of the string
+uint16_t displayCenteredString(uint16_t x, uint16_t y, uint8_t font, char *str);
+
+// Display a string that ends at x.  Returns the width of the string
+uint16_t displayRightAlignedString(uint16_t x, uint16_t y, uint8_t font, char *str);
+
+// Shorten a string (in place) so it is no wider than maxWidth, ending it with "..."
+char *ellipsizeString(uint8_t font, char *str, uint16_t maxWidth);
+
 // Display a character on the screen, using the specified font
 uint16_t displayCharacter(uint8_t font, uint16_t x, uint16_t y, uint8_t c);
 
+// Get the width of a character without drawing it (the value displayCharacter() would return)
+uint16_t getCharacterWidth(uint8_t font, uint8_t c);
+
+// The space character isn't a bitmap.  It just moves the next character along
+uint16_t getSpaceWidth(uint8_t font);
+
+// Get the width and height of a bitmap without drawing it.  Returns false if the bitmap isn't valid
+bool getBitmapSize(uint16_t bitmapNumber, uint16_t *bitmapWidth, uint16_t *bitmapHeight);
+
+// Get the bitmap used to draw a (supported, non-space) character
+// Fixed-width fonts only contain some characters.  The others come from the
+// proportional font of the same size, in which case font is changed to that font.
+uint16_t getBitmapNumberForCharacter(uint8_t *font, uint8_t c);
+
 // The whitespace around each character is not stored as part of the bitmap, to make
 // rendering as fast as possible.  The result is that all characters are not at the same
 // height so an offset is necessary.
@@ -38,9 +68,21 @@ uint16_t postCharacterSpace(uint8_t font, char c) ;
 // Display a fixed-width string (typically a number that keeps getting updated)
 void displayFixedWidthString(uint16_t x, uint16_t y, char *str, uint8_t maxChars, uint8_t font);
 
-// Draw a button on the screen
-void drawButton(uint16_t x, uint16_t y, uint16_t width, uint16_t textWidth, bool useLargeFont, char *text);
+// Draw a button on the screen.  The text is centered on the button
+void drawButton(uint16_t x, uint16_t y, uint16_t width, bool useLargeFont, char *text);
 
 void drawButtonOutline(uint16_t x, uint16_t y, uint16_t width);
 
+// Run the LCD and render benchmarks if RequestLCDBenchmark() has been called.  Only the UI
+// task calls this, so the benchmarks don't draw at the same time as the UI
+void runRequestedLCDBenchmark(void);
+
+extern "C" {
+// Time drawing bitmaps from external flash (buffered and streamed) on the debug console
+void PrintRenderBenchmark(void);
+
+// Ask the UI task to run the LCD and render benchmarks, the next time it waits for a tap
+void RequestLCDBenchmark(void);
+}
+
 #endif
\ No newline at end of file
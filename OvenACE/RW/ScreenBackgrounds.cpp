@@ -0,0 +1,466 @@
+// Saved screen backgrounds in external flash
+//
+// The backgrounds use the flash after the last bitmap, starting on a 4K sector boundary.
+// Each one is a header page followed by the run-length encoded pixels (the same encoding
+// as Bitmaps.cpp), and the next one starts on the next sector.  A sector is erased just
+// before the first page in it is programmed, and the header is programmed last, so a
+// background that wasn't completely saved is never used.  Nothing is ever erased ahead of
+// time: when the key changes, the backgrounds are saved again from the start of the area.
+//
+// A mostly white screen encodes to a few thousand words, so blitting it is mostly LCD
+// floods.  Saving one reads the whole screen back from the LCD, so it takes longer than
+// drawing it - but only once.  The flash is only locked while each page is programmed, so
+// the other tasks can use it while the screen is being read.
+#include <stdint.h>
+#include "ScreenBackgrounds.h"
+#include "FlashCache.h"
+#include "FlashProvision.h"
+#include "ReflowWizard.h"
+#include "Touch.h"
+#include "printf-stdarg.h"
+#include "rtos_support.h"
+#include "string.h"
+
+// See the layout in Controleo3Flash.cpp
+#define BACKGROUND_PAGE_SIZE            256
+#define BACKGROUND_PAGE_WORDS           (BACKGROUND_PAGE_SIZE >> 1)
+#define BACKGROUND_ADDRESS_TABLE        512
+#define BACKGROUND_ADDRESS_TABLE_PAGES  16
+#define BACKGROUND_ADDRESSES_PER_PAGE   42
+#define BACKGROUND_FIRST_BITMAP_PAGE    528
+#define BACKGROUND_LAST_PAGE            4095
+#define BACKGROUND_MINIMUM_PAGES        64        // Don't bother if there is less free flash than this
+
+// Run-length encoding (see tools/compress-bitmaps.py)
+#define BACKGROUND_RUN_FLAG             0x8000
+#define BACKGROUND_MAX_COUNT            0x7FFF
+#define BACKGROUND_MIN_RUN              3         // Runs shorter than this cost more than literal pixels
+#define BACKGROUND_LITERALS             64        // Literal pixels buffered before they are written
+#define BACKGROUND_READ_PIXELS          96        // Pixels read from the LCD at a time
+
+#define BACKGROUND_PIXELS               ((uint32_t) LCD_WIDTH * LCD_HEIGHT)
+#define CYCLES_TO_MICROS(c)             ((c) / (configCPU_CLOCK_HZ / 1000000))
+
+static_assert(sizeof(screenBackgroundHeader) <= BACKGROUND_PAGE_SIZE, "The header must fit in a flash page");
+
+static struct {
+  uint8_t screen;
+  uint16_t page;                        // Header page, or 0 if the slot isn't used
+  uint16_t dataPages;
+  uint32_t drawMicros;                  // Time to draw the static part a piece at a time
+  uint32_t blitMicros;                  // Time of the last blit
+  uint16_t blits;
+  bool slower;                          // The blit took longer than drawing the screen
+} backgroundSlot[SCREEN_BACKGROUND_SLOTS];
+
+static uint16_t backgroundBuffer[BACKGROUND_PAGE_WORDS];
+static uint16_t backgroundFirstPage;    // 0 if saved backgrounds are off
+static uint16_t backgroundNextPage;     // Where the next background is saved
+static uint32_t backgroundKey;
+static bool backgroundFull = false;     // Don't keep trying to save when the flash is full
+static uint32_t backgroundDrawStart;
+
+// The encoder state while a background is being saved
+static uint16_t encodeLiteral[BACKGROUND_LITERALS];
+static uint8_t encodeLiterals;
+static uint16_t encodeRunColor;
+static uint16_t encodeRunLength;
+static uint16_t encodeWords;            // Words in backgroundBuffer
+static uint16_t encodePage;             // The next page to program
+static uint32_t encodeCrc;
+static bool encodeFailed;
+
+// Statistics
+static uint16_t backgroundsSaved;
+static uint32_t backgroundSaveMillis;
+static uint16_t backgroundBlitFailures;
+
+// The firmware image and its build ID (see the linker script), for the key
+extern "C" uint32_t _sfixed, _etext;
+extern "C" uint8_t __build_id_start[], __build_id_end[];
+
+
+// Find a screen's slot.  Returns SCREEN_BACKGROUND_SLOTS if it doesn't have one
+static uint8_t findBackgroundSlot(uint8_t screen)
+{
+  uint8_t i;
+  for (i=0; i < SCREEN_BACKGROUND_SLOTS; i++)
+    if (backgroundSlot[i].page && backgroundSlot[i].screen == screen)
+      break;
+  return i;
+}
+
+
+// Read a header page and check it.  Returns false if it isn't a valid background with the current key
+static bool readBackgroundHeader(uint16_t page, screenBackgroundHeader *header)
+{
+  readFlash(page, sizeof(screenBackgroundHeader), (uint8_t *) header);
+  return header->magic == SCREEN_BACKGROUND_MAGIC && header->key == backgroundKey &&
+         header->headerCrc == flashCRC32(0, (uint8_t *) header, sizeof(screenBackgroundHeader) - sizeof(uint32_t)) &&
+         header->touchAreas <= SCREEN_BACKGROUND_TOUCH_AREAS && page + 1 + header->dataPages <= BACKGROUND_LAST_PAGE + 1;
+}
+
+
+// Add a background to the slots (replacing an older one for the same screen)
+static void addBackgroundSlot(uint8_t screen, uint16_t page, uint16_t dataPages, uint32_t drawMicros)
+{
+  uint8_t i = findBackgroundSlot(screen);
+
+  // Use the first free slot if the screen doesn't already have one
+  if (i == SCREEN_BACKGROUND_SLOTS)
+    for (i=0; i < SCREEN_BACKGROUND_SLOTS && backgroundSlot[i].page; i++)
+      ;
+  if (i == SCREEN_BACKGROUND_SLOTS)
+    return;
+  memset(&backgroundSlot[i], 0, sizeof(backgroundSlot[i]));
+  backgroundSlot[i].screen = screen;
+  backgroundSlot[i].page = page;
+  backgroundSlot[i].dataPages = dataPages;
+  backgroundSlot[i].drawMicros = drawMicros;
+}
+
+
+// Find the saved backgrounds.  Call this once the bitmaps are in external flash
+// The key is a CRC32 of the bitmap address table and the firmware's build ID, so the
+// backgrounds are saved again if the bitmaps or the code that draws the screens change
+void initScreenBackgrounds()
+{
+  screenBackgroundHeader header;
+  uint32_t start = millis(), endOfBitmaps = BACKGROUND_FIRST_BITMAP_PAGE;
+  uint16_t page;
+
+  memset(backgroundSlot, 0, sizeof(backgroundSlot));
+  backgroundFirstPage = 0;
+  backgroundFull = false;
+  if (SCREEN_BACKGROUND_SLOTS == 0)
+    return;
+
+  // Find the end of the bitmaps, and work out the key
+  backgroundKey = 0;
+  for (page = BACKGROUND_ADDRESS_TABLE; page < BACKGROUND_ADDRESS_TABLE + BACKGROUND_ADDRESS_TABLE_PAGES; page++) {
+    readFlash(page, BACKGROUND_PAGE_SIZE, (uint8_t *) backgroundBuffer);
+    backgroundKey = flashCRC32(backgroundKey, (uint8_t *) backgroundBuffer, BACKGROUND_PAGE_SIZE);
+    for (uint8_t i=0; i < BACKGROUND_ADDRESSES_PER_PAGE; i++) {
+      uint16_t *entry = backgroundBuffer + i * 3;
+      if (entry[0] < BACKGROUND_FIRST_BITMAP_PAGE || entry[0] > BACKGROUND_LAST_PAGE)
+        continue;
+      uint32_t end = entry[0] + (((uint32_t) entry[1] * entry[2] * 2 + BACKGROUND_PAGE_SIZE - 1) >> 8);
+      if (end > endOfBitmaps)
+        endOfBitmaps = end;
+    }
+  }
+
+  // The linker's build ID is a hash of the whole image.  A build without one falls back to
+  // a CRC of the image itself, which takes a lot longer
+  if (__build_id_end > __build_id_start)
+    backgroundKey = flashCRC32(backgroundKey, __build_id_start, __build_id_end - __build_id_start);
+  else {
+    for (const uint8_t *p = (const uint8_t *) &_sfixed; p < (const uint8_t *) &_etext; p += 0x8000) {
+      uint32_t length = (const uint8_t *) &_etext - p;
+      backgroundKey = flashCRC32(backgroundKey, p, length > 0x8000? 0x8000 : length);
+    }
+  }
+
+  // The backgrounds start on the next sector
+  endOfBitmaps = (endOfBitmaps + 15) & ~15;
+  if (endOfBitmaps + BACKGROUND_MINIMUM_PAGES > BACKGROUND_LAST_PAGE + 1) {
+    printfD("Screen backgrounds: no room after the bitmaps\n");
+    return;
+  }
+  backgroundFirstPage = endOfBitmaps;
+
+  // Find the backgrounds saved with this key.  The first one that isn't valid is where the next one goes
+  for (page = backgroundFirstPage; page <= BACKGROUND_LAST_PAGE && readBackgroundHeader(page, &header); ) {
+    addBackgroundSlot(header.screen, page, header.dataPages, header.drawMicros);
+    page = (page + 1 + header.dataPages + 15) & ~15;
+  }
+  backgroundNextPage = page;
+  printfD("Screen backgrounds: pages %u-%u, %u used, found in %lu ms\n", backgroundFirstPage, BACKGROUND_LAST_PAGE,
+          backgroundNextPage - backgroundFirstPage, millis() - start);
+}
+
+
+// Returns true if the screen has a saved background that will be drawn (so it doesn't need
+// to be cleared first)
+bool hasScreenBackground(uint8_t screen)
+{
+  uint8_t i = findBackgroundSlot(screen);
+  return i < SCREEN_BACKGROUND_SLOTS && !backgroundSlot[i].slower;
+}
+
+
+// Get the next word of a background.  wordsLeft stops a bad background running past its pages
+static uint16_t readBackgroundWord(uint8_t *wordIndex, uint32_t *wordsLeft)
+{
+  if (*wordsLeft == 0)
+    return 0;
+  if (*wordIndex == BACKGROUND_PAGE_WORDS) {
+    flash.continueRead(BACKGROUND_PAGE_SIZE, (uint8_t *) backgroundBuffer);
+    *wordIndex = 0;
+  }
+  (*wordsLeft)--;
+  return backgroundBuffer[(*wordIndex)++];
+}
+
+
+// Stream a background to the LCD.  Returns false if the data is corrupt
+static bool blitBackground(uint16_t dataPage, uint16_t dataPages)
+{
+  uint32_t pixelsLeft = BACKGROUND_PIXELS, wordsLeft = (uint32_t) dataPages * BACKGROUND_PAGE_WORDS;
+  uint8_t wordIndex = BACKGROUND_PAGE_WORDS;
+  uint16_t token, count, n;
+
+  tft.startBitmap(0, 0, LCD_WIDTH, LCD_HEIGHT);
+  flash.startRead(dataPage, 0, 0);
+  while (pixelsLeft) {
+    token = readBackgroundWord(&wordIndex, &wordsLeft);
+    count = token & BACKGROUND_MAX_COUNT;
+    if (count == 0 || count > pixelsLeft)
+      break;
+    pixelsLeft -= count;
+
+    if (token & BACKGROUND_RUN_FLAG) {
+      tft.drawBitmapRun(readBackgroundWord(&wordIndex, &wordsLeft), count);
+      continue;
+    }
+
+    // Literal pixels are sent straight from the buffer, a page at a time
+    while (count && wordsLeft) {
+      if (wordIndex == BACKGROUND_PAGE_WORDS) {
+        flash.continueRead(BACKGROUND_PAGE_SIZE, (uint8_t *) backgroundBuffer);
+        wordIndex = 0;
+      }
+      n = BACKGROUND_PAGE_WORDS - wordIndex;
+      if (n > count)
+        n = count;
+      tft.drawBitmap(backgroundBuffer + wordIndex, n);
+      wordIndex += n;
+      wordsLeft -= n;
+      count -= n;
+    }
+    if (count)
+      break;
+  }
+  flash.endRead();
+  tft.endBitmap();
+  return pixelsLeft == 0;
+}
+
+
+// Draw the saved background for the screen and define its touch areas.  Returns false
+// if there isn't one, in which case the static part of the screen should be drawn and
+// saveScreenBackground() called
+bool drawScreenBackground(uint8_t screen)
+{
+  screenBackgroundHeader header;
+  uint8_t i = findBackgroundSlot(screen);
+
+  backgroundDrawStart = CPU_HZ_COUNTER();
+  if (i == SCREEN_BACKGROUND_SLOTS || backgroundSlot[i].slower)
+    return false;
+
+  // The header holds the touch areas
+  if (!readBackgroundHeader(backgroundSlot[i].page, &header) || header.screen != screen ||
+      !blitBackground(backgroundSlot[i].page + 1, header.dataPages)) {
+    printfD("Screen background %d is bad\n", screen);
+    backgroundSlot[i].page = 0;
+    backgroundBlitFailures++;
+    tft.fillScreen(WHITE);
+    backgroundDrawStart = CPU_HZ_COUNTER();
+    return false;
+  }
+
+  for (uint8_t t=0; t < header.touchAreas; t++)
+    defineTouchArea(header.touchArea[t][0], header.touchArea[t][1], header.touchArea[t][2], header.touchArea[t][3]);
+
+  backgroundSlot[i].blitMicros = CYCLES_TO_MICROS(CPU_HZ_COUNTER() - backgroundDrawStart);
+  backgroundSlot[i].blits++;
+
+  // A mostly white screen with a few small buttons is quicker to clear and draw than to
+  // stream from flash.  Draw it from now on (the background stays, so it isn't saved again)
+  if (backgroundSlot[i].drawMicros && backgroundSlot[i].blitMicros > backgroundSlot[i].drawMicros) {
+    printfD("Screen background %d: the blit (%lu us) is slower than drawing (%lu us)\n", screen,
+            backgroundSlot[i].blitMicros, backgroundSlot[i].drawMicros);
+    backgroundSlot[i].slower = true;
+  }
+  return true;
+}
+
+
+// Program a page of a background (if bytes isn't 0), erasing its sector first if asked.
+// The flash is locked and the bitmap area unprotected only while this runs
+static void programBackgroundPage(uint16_t page, bool eraseSector, uint16_t bytes, uint8_t *data)
+{
+  flash.lock();
+  flash.allowWritingToBitmaps(true);
+  if (eraseSector)
+    flash.erasePages(page, 16);
+  if (bytes)
+    flash.write(page, bytes, data);
+  flash.allowWritingToBitmaps(false);
+  flash.unlock();
+}
+
+
+// Program the encoded words in backgroundBuffer (padded with 0xFF) to the next page
+static void writeEncodedPage()
+{
+  if (encodePage > BACKGROUND_LAST_PAGE) {
+    encodeFailed = true;
+    return;
+  }
+  while (encodeWords < BACKGROUND_PAGE_WORDS)
+    backgroundBuffer[encodeWords++] = 0xFFFF;
+
+  // Each sector is erased just before its first page is programmed
+  encodeCrc = flashCRC32(encodeCrc, (uint8_t *) backgroundBuffer, BACKGROUND_PAGE_SIZE);
+  programBackgroundPage(encodePage, (encodePage & 15) == 0, BACKGROUND_PAGE_SIZE, (uint8_t *) backgroundBuffer);
+  encodePage++;
+  encodeWords = 0;
+}
+
+
+static void encodeWord(uint16_t word)
+{
+  if (encodeFailed)
+    return;
+  backgroundBuffer[encodeWords++] = word;
+  if (encodeWords == BACKGROUND_PAGE_WORDS)
+    writeEncodedPage();
+}
+
+
+static void encodeFlushLiterals()
+{
+  if (!encodeLiterals)
+    return;
+  encodeWord(encodeLiterals);
+  for (uint8_t i=0; i < encodeLiterals; i++)
+    encodeWord(encodeLiteral[i]);
+  encodeLiterals = 0;
+}
+
+
+// Write the current run, either as a run or (if it is short) as literal pixels
+static void encodeEndRun()
+{
+  if (encodeRunLength >= BACKGROUND_MIN_RUN) {
+    encodeFlushLiterals();
+    encodeWord(BACKGROUND_RUN_FLAG | encodeRunLength);
+    encodeWord(encodeRunColor);
+  }
+  else {
+    while (encodeRunLength--) {
+      if (encodeLiterals == BACKGROUND_LITERALS)
+        encodeFlushLiterals();
+      encodeLiteral[encodeLiterals++] = encodeRunColor;
+    }
+  }
+  encodeRunLength = 0;
+}
+
+
+static void encodePixel(uint16_t pixel)
+{
+  if (encodeRunLength && pixel == encodeRunColor && encodeRunLength < BACKGROUND_MAX_COUNT) {
+    encodeRunLength++;
+    return;
+  }
+  encodeEndRun();
+  encodeRunColor = pixel;
+  encodeRunLength = 1;
+}
+
+
+// Save what is on the screen, and the touch areas defined so far, as the screen's background
+void saveScreenBackground(uint8_t screen)
+{
+  screenBackgroundHeader header;
+  uint16_t pixels[BACKGROUND_READ_PIXELS];
+  uint32_t drawMicros = CYCLES_TO_MICROS(CPU_HZ_COUNTER() - backgroundDrawStart);
+  uint32_t start = millis();
+  uint16_t headerPage = backgroundNextPage;
+
+  if (!backgroundFirstPage || backgroundFull || findBackgroundSlot(screen) < SCREEN_BACKGROUND_SLOTS ||
+      getNumberOfTouchAreas() > SCREEN_BACKGROUND_TOUCH_AREAS)
+    return;
+  if (headerPage + BACKGROUND_MINIMUM_PAGES > BACKGROUND_LAST_PAGE + 1) {
+    backgroundFull = true;
+    return;
+  }
+
+  // Make sure the LCD has finished drawing
+  tft.waitUntilIdle();
+
+  programBackgroundPage(headerPage, true, 0, 0);
+  encodeLiterals = 0;
+  encodeRunLength = 0;
+  encodeWords = 0;
+  encodePage = headerPage + 1;
+  encodeCrc = 0;
+  encodeFailed = false;
+
+  // Read the screen back a band of pixels at a time and encode it.  The flash is programmed
+  // as the pages fill up (the LCD and flash are on different ports, so the LCD read can stay
+  // open), and isn't locked while the LCD is read
+  tft.startReadBitmap(0, 0, LCD_WIDTH, LCD_HEIGHT);
+  for (uint32_t pixelsLeft = BACKGROUND_PIXELS; pixelsLeft && !encodeFailed; pixelsLeft -= BACKGROUND_READ_PIXELS) {
+    tft.readBitmapRGB565(pixels, BACKGROUND_READ_PIXELS);
+    for (uint8_t i=0; i < BACKGROUND_READ_PIXELS; i++)
+      encodePixel(pixels[i]);
+  }
+  tft.endReadBitmap();
+  encodeEndRun();
+  encodeFlushLiterals();
+  if (encodeWords && !encodeFailed)
+    writeEncodedPage();
+
+  // Check the pixels, then program the header to make the background valid
+  uint16_t dataPages = encodePage - headerPage - 1;
+  if (!encodeFailed && verifyPages(headerPage + 1, (uint32_t) dataPages * BACKGROUND_PAGE_SIZE, encodeCrc)) {
+    memset(&header, 0, sizeof(header));
+    header.magic = SCREEN_BACKGROUND_MAGIC;
+    header.key = backgroundKey;
+    header.screen = screen;
+    header.touchAreas = getNumberOfTouchAreas();
+    header.dataPages = dataPages;
+    header.dataCrc = encodeCrc;
+    header.drawMicros = drawMicros;
+    for (uint8_t t=0; t < header.touchAreas; t++)
+      getTouchArea(t, &header.touchArea[t][0], &header.touchArea[t][1], &header.touchArea[t][2], &header.touchArea[t][3]);
+    header.headerCrc = flashCRC32(0, (uint8_t *) &header, sizeof(screenBackgroundHeader) - sizeof(uint32_t));
+    programBackgroundPage(headerPage, false, sizeof(header), (uint8_t *) &header);
+
+    addBackgroundSlot(screen, headerPage, dataPages, drawMicros);
+    backgroundNextPage = (encodePage + 15) & ~15;
+    backgroundsSaved++;
+    backgroundSaveMillis += millis() - start;
+    printfD("Saved the background for screen %d (%u pages) in %lu ms\n", screen, dataPages, millis() - start);
+  }
+  else {
+    // Out of flash.  The header page is still erased, so this background won't be found
+    printfD("Screen background %d wasn't saved\n", screen);
+    backgroundFull = true;
+  }
+}
+
+
+// Print the screen background statistics (and transition times) on the debug console
+void PrintScreenBackgroundStats()
+{
+  if (!backgroundFirstPage) {
+    printfD("  Saved backgrounds are off\n");
+    return;
+  }
+  printfD("  Flash pages %u-%u, next free page %u%s, key 0x%08lX\n", backgroundFirstPage, BACKGROUND_LAST_PAGE,
+          backgroundNextPage, backgroundFull? " (full)" : "", backgroundKey);
+  printfD("  Saved %u (%lu ms), bad blits %u\n", backgroundsSaved, backgroundSaveMillis, backgroundBlitFailures);
+  printfD("  Screen  Pages  Drawn (us)  Blit (us)  Blits\n");
+  for (uint8_t i=0; i < SCREEN_BACKGROUND_SLOTS; i++) {
+    if (!backgroundSlot[i].page)
+      continue;
+    printfD("  %6u  %5u  %10lu  %9lu  %5u%s\n", backgroundSlot[i].screen, backgroundSlot[i].dataPages,
+            backgroundSlot[i].drawMicros, backgroundSlot[i].blitMicros, backgroundSlot[i].blits,
+            backgroundSlot[i].slower? "  (drawn instead)" : "");
+  }
+}
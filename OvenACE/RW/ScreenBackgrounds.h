@@ -0,0 +1,73 @@
+// Saved screen backgrounds in external flash
+//
+// Every screen used to be cleared and then drawn a button, string and bitmap at a time.
+// The static part of a screen (everything except the values that change) is the same
+// every time, so the first time it is drawn it is read back from the LCD, run-length
+// encoded and saved in the free flash after the bitmaps, together with its touch areas.
+// After that the screen is drawn by streaming the saved background to the LCD in one
+// bitmap window, and the dynamic fields are drawn on top as before.  A screen whose blit
+// turns out to be slower than drawing it was goes back to being drawn.
+//
+//   if (!drawScreenBackground(SCREEN_BAKE)) {
+//     ... draw the static part of the screen ...
+//     saveScreenBackground(SCREEN_BAKE);
+//   }
+//   ... draw the dynamic fields ...
+//
+// The saved backgrounds are tied to the bitmaps and the firmware (see initScreenBackgrounds),
+// so they are drawn again and re-saved after either one changes.
+#ifndef __SCREENBACKGROUNDS_H__
+#define __SCREENBACKGROUNDS_H__
+
+#include <stdint.h>
+
+// Number of screens that can have a saved background.  0 turns saved backgrounds off.
+#ifndef SCREEN_BACKGROUND_SLOTS
+#define SCREEN_BACKGROUND_SLOTS         8
+#endif
+
+#define SCREEN_BACKGROUND_MAGIC         0x4E524353    // "SCRN"
+#define SCREEN_BACKGROUND_TOUCH_AREAS   20            // The same as MAX_TAP_TARGETS in Touch.cpp
+
+// The first page of each saved background.  The encoded pixels follow in the next pages.
+// Each background starts on a 4K sector boundary, so it can be erased on its own.
+struct screenBackgroundHeader {
+  uint32_t magic;                       // SCREEN_BACKGROUND_MAGIC
+  uint32_t key;                         // See initScreenBackgrounds()
+  uint8_t  screen;                      // SCREEN_HOME, SCREEN_BAKE, ...
+  uint8_t  touchAreas;
+  uint16_t dataPages;
+  uint32_t dataCrc;                     // CRC32 of the data pages
+  uint32_t drawMicros;                  // Time it took to draw the static part a piece at a time
+  uint16_t touchArea[SCREEN_BACKGROUND_TOUCH_AREAS][4];   // x, y, width and height
+  uint32_t headerCrc;                   // CRC32 of the header before this field
+};
+
+#ifdef __cplusplus
+
+// Find the saved backgrounds.  Call this once the bitmaps are in external flash
+void initScreenBackgrounds(void);
+
+// Returns true if the screen has a saved background that will be drawn (so it doesn't need
+// to be cleared first)
+bool hasScreenBackground(uint8_t screen);
+
+// Draw the saved background for the screen and define its touch areas.  Returns false
+// if there isn't one, in which case the static part of the screen should be drawn and
+// saveScreenBackground() called
+bool drawScreenBackground(uint8_t screen);
+
+// Save what is on the screen, and the touch areas defined so far, as the screen's background
+void saveScreenBackground(uint8_t screen);
+
+extern "C" {
+#endif // __cplusplus
+
+// Print the screen background statistics (and transition times) on the debug console
+void PrintScreenBackgroundStats(void);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#endif
@@ -7,6 +7,7 @@
 #include "Touch.h"
 #include "Bitmaps.h"
 #include "Render.h"
+#include "Compositor.h"
 #include "Bake.h"
 #include "Help.h"
 #include "Utility.h"
@@ -19,6 +20,7 @@
 #include "Controleo3MAX31856.h"
 #include "Temperature.h"
 #include "Learn.h"
+#include "ScreenBackgrounds.h"
 #include <stdio.h>
 #include "samd21.h"
 
@@ -38,8 +40,9 @@ void showScreen(uint8_t screen)
 
   // This is the main loop, changing between the various screens.  Stay here forever ...
   while (1) {
-    // Clear the screen
-    tft.fillScreen(WHITE);
+    // Clear the screen (unless the saved background is about to cover it)
+    if (!hasScreenBackground(screen))
+      tft.fillScreen(WHITE);
 
     // Check the amount of free memory each time the screen is drawn.  Make sure there
     // aren't any memory leaks
@@ -59,11 +62,13 @@ redraw:
     switch (screen) {
       case SCREEN_HOME: 
         // Draw the screen
-        renderBitmap(BITMAP_CONTROLEO3_SMALL, 106, 5);
-        drawTouchButton(110, 80, 260, 116, BUTTON_LARGE_FONT, (char *) "Reflow");
-        drawTouchButton(110, 160, 260, 77, BUTTON_LARGE_FONT, (char *) "Bake");
-        drawTouchButton(110, 240, 260, 182, BUTTON_LARGE_FONT, (char *) "Settings");
-        renderBitmap(BITMAP_SETTINGS, 285, 252);
+        if (!drawScreenBackground(SCREEN_HOME)) {
+          renderBitmap(BITMAP_CONTROLEO3_SMALL, 106, 5);
+          drawTouchButton(110, 80, 260, BUTTON_LARGE_FONT, (char *) "Reflow");
+          drawTouchButton(110, 160, 260, BUTTON_LARGE_FONT, (char *) "Bake");
+          drawTouchButtonWithIcon(110, 240, 260, BUTTON_LARGE_FONT, (char *) "Settings", BITMAP_SETTINGS, 252);
+          saveScreenBackground(SCREEN_HOME);
+        }
 
         // Act on the tap
         switch(getTap(DONT_SHOW_TEMPERATURE)) {
@@ -77,12 +82,14 @@ redraw:
 
       case SCREEN_BAKE:
         // Draw the screen
-        displayHeader((char *) "Bake", false);
         setTouchTemperatureUnitChangeCallback(displayBakeTemperatureAndDuration);
-        drawTouchButton(140, 100, 200, 56, BUTTON_SMALL_FONT, (char *) "Start");
-        drawTouchButton(140, 180, 200, 96, BUTTON_SMALL_FONT, (char *) "Edit");
-        renderBitmap(BITMAP_SETTINGS, 247, 192);
-        drawNavigationButtons(true, true);
+        if (!drawScreenBackground(SCREEN_BAKE)) {
+          displayHeader((char *) "Bake", false);
+          drawTouchButton(140, 100, 200, BUTTON_SMALL_FONT, (char *) "Start");
+          drawTouchButtonWithIcon(140, 180, 200, BUTTON_SMALL_FONT, (char *) "Edit", BITMAP_SETTINGS, 192);
+          drawNavigationButtons(true, true);
+          saveScreenBackground(SCREEN_BAKE);
+        }
 
         // Act on the tap
         switch(getTap(SHOW_TEMPERATURE_IN_HEADER)) {
@@ -97,11 +104,14 @@ redraw:
                 
       case SCREEN_EDIT_BAKE1:
         // Draw the screen
-        displayHeader((char *) "Bake", true);
-        displayString(20, LINE(0), FONT_9PT_BLACK_ON_WHITE, (char *) "Temperature:");
-        displayString(20, LINE(3), FONT_9PT_BLACK_ON_WHITE, (char *) "Duration:");
-        drawIncreaseDecreaseTapTargets(TWO_SETTINGS);
-        drawNavigationButtons(true, true);
+        if (!drawScreenBackground(SCREEN_EDIT_BAKE1)) {
+          displayHeader((char *) "Bake", true);
+          displayString(20, LINE(0), FONT_9PT_BLACK_ON_WHITE, (char *) "Temperature:");
+          displayString(20, LINE(3), FONT_9PT_BLACK_ON_WHITE, (char *) "Duration:");
+          drawIncreaseDecreaseTapTargets(TWO_SETTINGS);
+          drawNavigationButtons(true, true);
+          saveScreenBackground(SCREEN_EDIT_BAKE1);
+        }
 
         while (1) {
           // Show the temperature and duration
@@ -158,9 +168,12 @@ redraw:
                 
       case SCREEN_EDIT_BAKE2:
         // Draw the screen
-        displayHeader((char *) "Bake", true);
-        drawIncreaseDecreaseTapTargets(TWO_SETTINGS);
-        drawNavigationButtons(true, true);
+        if (!drawScreenBackground(SCREEN_EDIT_BAKE2)) {
+          displayHeader((char *) "Bake", true);
+          drawIncreaseDecreaseTapTargets(TWO_SETTINGS);
+          drawNavigationButtons(true, true);
+          saveScreenBackground(SCREEN_EDIT_BAKE2);
+        }
 
         while (1) {
           // Show "open door after bake"
@@ -213,9 +226,9 @@ redraw:
         p = &prefs.profile[prefs.selectedProfile];
         tft.fillRect(20, LINE(0), 434, 24, WHITE);
         sprintf(buffer100Bytes, "#%d: %s", prefs.selectedProfile+1, p->name);
-        displayString(20, LINE(0), FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
-        drawTouchButton(120, 100, 240, 145, BUTTON_SMALL_FONT, (char *) "Start Reflow");
-        drawTouchButton(120, 180, 240, 167, BUTTON_SMALL_FONT, (char *) "Choose Profile");
+        displayString(20, LINE(0), FONT_9PT_BLACK_ON_WHITE, ellipsizeString(FONT_9PT_BLACK_ON_WHITE, buffer100Bytes, 434));
+        drawTouchButton(120, 100, 240, BUTTON_SMALL_FONT, (char *) "Start Reflow");
+        drawTouchButton(120, 180, 240, BUTTON_SMALL_FONT, (char *) "Choose Profile");
         drawNavigationButtons(true, false);
 
         // Act on the tap
@@ -234,16 +247,15 @@ redraw:
         displayHeader((char *) "Reflow Profiles", false);
         if (prefs.numProfiles) {
           drawIncreaseDecreaseTapTargets(ONE_SETTING_TEXT_BUTTON);
-          drawTouchButton(10, 185, 210, 130, BUTTON_SMALL_FONT, (char *) "Delete");
-          renderBitmap(BITMAP_TRASH, 155, 196);
-          drawTouchButton(260, 185, 210, 168, BUTTON_SMALL_FONT, (char *) "Read SD Card");
+          drawTouchButtonWithIcon(10, 185, 210, BUTTON_SMALL_FONT, (char *) "Delete", BITMAP_TRASH, 196);
+          drawTouchButton(260, 185, 210, BUTTON_SMALL_FONT, (char *) "Read SD Card");
         }
         else {
           // Dummy areas for the arrows and delete button
           defineTouchArea(0, 0, 0, 0);
           defineTouchArea(0, 0, 0, 0);
           defineTouchArea(0, 0, 0, 0);
-          drawTouchButton(40, 105, 400, 330, BUTTON_SMALL_FONT, (char *) "Read Profiles from SD Card");
+          drawTouchButton(40, 105, 400, BUTTON_SMALL_FONT, (char *) "Read Profiles from SD Card");
         }
         drawNavigationButtons(true, false);
 
@@ -252,7 +264,7 @@ redraw:
           tft.fillRect(20, LINE(0), 400, 24, WHITE);
           sprintf(buffer100Bytes, "#%d: %s", prefs.selectedProfile+1, p->name);
           if (prefs.numProfiles)
-            displayString(20, LINE(0), FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
+            displayString(20, LINE(0), FONT_9PT_BLACK_ON_WHITE, ellipsizeString(FONT_9PT_BLACK_ON_WHITE, buffer100Bytes, 400));
           tft.fillRect(20, LINE(1), 400, 24, WHITE);
           sprintf(buffer100Bytes, "Peaks at %d~C (%d instructions)", p->peakTemperature, p->noOfTokens);
           if (prefs.numProfiles)
@@ -263,14 +275,15 @@ redraw:
             case 0: prefs.selectedProfile = (prefs.selectedProfile + prefs.numProfiles -1) % prefs.numProfiles; savePrefs(); break;
             case 1: prefs.selectedProfile = (prefs.selectedProfile + 1) % prefs.numProfiles; savePrefs(); break;
             case 2: 
+              startComposition(0, 90, 480, 230, WHITE);
               drawThickRectangle(0, 90, 480, 230, 15, RED);
-              tft.fillRect(15, 105, 450, 200, WHITE);
-              displayString(126, 117, FONT_12PT_BLACK_ON_WHITE, (char *) "Delete Profile?");
-              displayString(40, 150, FONT_9PT_BLACK_ON_WHITE, (char *) "Are you sure you want to delete");
-              displayString(40, 180, FONT_9PT_BLACK_ON_WHITE, (char *) "this profile?");
+              composeText(126, 117, FONT_12PT_BLACK_ON_WHITE, "Delete Profile?");
+              composeText(40, 150, FONT_9PT_BLACK_ON_WHITE, "Are you sure you want to delete");
+              composeText(40, 180, FONT_9PT_BLACK_ON_WHITE, "this profile?");
               clearTouchTargets();
-              drawTouchButton(60, 230, 160, 99, BUTTON_LARGE_FONT, (char *) "Delete");
-              drawTouchButton(260, 230, 160, 105, BUTTON_LARGE_FONT, (char *) "Cancel");
+              drawTouchButton(60, 230, 160, BUTTON_LARGE_FONT, (char *) "Delete");
+              drawTouchButton(260, 230, 160, BUTTON_LARGE_FONT, (char *) "Cancel");
+              endComposition();
               if (getTap(SHOW_TEMPERATURE_IN_HEADER) == 0) {
                 deleteProfile(prefs.selectedProfile);
                 prefs.selectedProfile = 0;
@@ -297,14 +310,17 @@ redraw:
                 
       case SCREEN_SETTINGS:
         // Draw the screen
-        displayHeader((char *) "Settings", true);
-        drawTouchButton(10, 45, 210, 50, BUTTON_SMALL_FONT, (char *) "Test");
-        drawTouchButton(10, 120, 210, 97, BUTTON_SMALL_FONT, (char *) "Learning");
-        drawTouchButton(10, 195, 210, 65, BUTTON_SMALL_FONT, (char *) "Reset");
-        drawTouchButton(260, 45, 210, 67, BUTTON_SMALL_FONT, (char *) "Setup");
-        drawTouchButton(260, 120, 210, 58, BUTTON_SMALL_FONT, (char *) "Stats");
-        drawTouchButton(260, 195, 210, 69, BUTTON_SMALL_FONT, (char *) "About");
-        drawNavigationButtons(false, false);
+        if (!drawScreenBackground(SCREEN_SETTINGS)) {
+          displayHeader((char *) "Settings", true);
+          drawTouchButton(10, 45, 210, BUTTON_SMALL_FONT, (char *) "Test");
+          drawTouchButton(10, 120, 210, BUTTON_SMALL_FONT, (char *) "Learning");
+          drawTouchButton(10, 195, 210, BUTTON_SMALL_FONT, (char *) "Reset");
+          drawTouchButton(260, 45, 210, BUTTON_SMALL_FONT, (char *) "Setup");
+          drawTouchButton(260, 120, 210, BUTTON_SMALL_FONT, (char *) "Stats");
+          drawTouchButton(260, 195, 210, BUTTON_SMALL_FONT, (char *) "About");
+          drawNavigationButtons(false, false);
+          saveScreenBackground(SCREEN_SETTINGS);
+        }
 
         // Act on the tap
         switch(getTap(SHOW_TEMPERATURE_IN_HEADER)) {
@@ -338,9 +354,9 @@ redraw:
           // Update the button text
           tft.fillRect(185, 170, 110, 19, WHITE);
           if (onOff)
-            drawButton(140, 150, 200, 101, BUTTON_SMALL_FONT, (char *) "Turn Off");
+            drawButton(140, 150, 200, BUTTON_SMALL_FONT, (char *) "Turn Off");
           else
-            drawButton(140, 150, 200, 96, BUTTON_SMALL_FONT, (char *) "Turn On");
+            drawButton(140, 150, 200, BUTTON_SMALL_FONT, (char *) "Turn On");
           if (areOutputsConfigured()) {
             tft.fillRect(20, LINE(1), 190, 24, WHITE);
             displayString(20, LINE(1), FONT_9PT_BLACK_ON_WHITE, (char *) outputDescription[prefs.outputType[output]]);
@@ -554,21 +570,22 @@ redraw:
        case SCREEN_RESET:
         // Draw the screen
         displayHeader((char *) "Reset", false);
-        drawTouchButton(100, 80, 280, 161, BUTTON_SMALL_FONT, (char *) "Factory Reset");
-        drawTouchButton(100, 160, 280, 199, BUTTON_SMALL_FONT, (char *) "Touch Calibration");
+        drawTouchButton(100, 80, 280, BUTTON_SMALL_FONT, (char *) "Factory Reset");
+        drawTouchButton(100, 160, 280, BUTTON_SMALL_FONT, (char *) "Touch Calibration");
         drawNavigationButtons(false, true);
 
         // Act on the tap
         switch(getTap(SHOW_TEMPERATURE_IN_HEADER)) {
           case 0:
+              startComposition(0, 90, 480, 230, WHITE);
               drawThickRectangle(0, 90, 480, 230, 15, RED);
-              tft.fillRect(15, 105, 450, 200, WHITE);
-              displayString(126, 110, FONT_12PT_BLACK_ON_WHITE, (char *) "Factory Reset");
-              displayString(54, 150, FONT_9PT_BLACK_ON_WHITE, (char *) "Are you sure you want to erase");
-              displayString(54, 180, FONT_9PT_BLACK_ON_WHITE, (char *) "all settings?");
+              composeText(126, 110, FONT_12PT_BLACK_ON_WHITE, "Factory Reset");
+              composeText(54, 150, FONT_9PT_BLACK_ON_WHITE, "Are you sure you want to erase");
+              composeText(54, 180, FONT_9PT_BLACK_ON_WHITE, "all settings?");
               clearTouchTargets();
-              drawTouchButton(60, 230, 160, 88, BUTTON_LARGE_FONT, (char *) "Erase");
-              drawTouchButton(260, 230, 160, 105, BUTTON_LARGE_FONT, (char *) "Cancel");
+              drawTouchButton(60, 230, 160, BUTTON_LARGE_FONT, (char *) "Erase");
+              drawTouchButton(260, 230, 160, BUTTON_LARGE_FONT, (char *) "Cancel");
+              endComposition();
               if (getTap(SHOW_TEMPERATURE_IN_HEADER) == 0) {
                 factoryReset(true);
                 NVIC_SystemReset();
@@ -582,30 +599,33 @@ redraw:
         break;
                 
        case SCREEN_ABOUT:
-        // Draw the screen
-        renderBitmap(BITMAP_CONTROLEO3_SMALL, 2, 5);
-        renderBitmap(BITMAP_WHIZOO_SMALL, 316, 21);
-        displayString(279, 30, FONT_9PT_BLACK_ON_WHITE, (char *) "by");
-        tft.fillRect(5, 57, 470, 3, LIGHT_GREY);
-
-        // Display information
-        displayString(10, 70, FONT_9PT_BLACK_ON_WHITE, (char *) "Software:");
-        displayString(128, 70, FONT_9PT_BLACK_ON_WHITE, (char *) CONTROLEO3_VERSION);
-        displayString(10, 100, FONT_9PT_BLACK_ON_WHITE, (char *) "Serial Number:");
-        sprintf(buffer100Bytes, "%lX", *((uint32_t *) 0x0080A00C));
-        displayString(192, 100, FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
-        displayString(10, 130, FONT_9PT_BLACK_ON_WHITE, (char *) "Flash ID:");
-        sprintf(buffer100Bytes, "%lX", flash.readUniqueID());
-        displayString(118, 130, FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
-        displayString(10, 160, FONT_9PT_BLACK_ON_WHITE, (char *) "LCD Version:");
-        sprintf(buffer100Bytes, "%lX", tft.getLCDVersion());
-        displayString(169, 160, FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
-        displayString(10, 190, FONT_9PT_BLACK_ON_WHITE, (char *) "Free RAM:");
+        // Draw the screen.  Everything except the free RAM is the same every time
+        if (!drawScreenBackground(SCREEN_ABOUT)) {
+          renderBitmap(BITMAP_CONTROLEO3_SMALL, 2, 5);
+          renderBitmap(BITMAP_WHIZOO_SMALL, 316, 21);
+          displayString(279, 30, FONT_9PT_BLACK_ON_WHITE, (char *) "by");
+          tft.fillRect(5, 57, 470, 3, LIGHT_GREY);
+
+          // Display information
+          displayString(10, 70, FONT_9PT_BLACK_ON_WHITE, (char *) "Software:");
+          displayString(128, 70, FONT_9PT_BLACK_ON_WHITE, (char *) CONTROLEO3_VERSION);
+          displayString(10, 100, FONT_9PT_BLACK_ON_WHITE, (char *) "Serial Number:");
+          sprintf(buffer100Bytes, "%lX", *((uint32_t *) 0x0080A00C));
+          displayString(192, 100, FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
+          displayString(10, 130, FONT_9PT_BLACK_ON_WHITE, (char *) "Flash ID:");
+          sprintf(buffer100Bytes, "%lX", flash.readUniqueID());
+          displayString(118, 130, FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
+          displayString(10, 160, FONT_9PT_BLACK_ON_WHITE, (char *) "LCD Version:");
+          sprintf(buffer100Bytes, "%lX", tft.getLCDVersion());
+          displayString(169, 160, FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
+          displayString(10, 190, FONT_9PT_BLACK_ON_WHITE, (char *) "Free RAM:");
+
+          drawNavigationButtons(false, true);
+          saveScreenBackground(SCREEN_ABOUT);
+        }
         sprintf(buffer100Bytes, "%ld bytes (%ld%% free)", getFreeRAM(), getFreeRAM() / 320); // Has 32KB RAM
         displayString(146, 190, FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
 
-        drawNavigationButtons(false, true);
-
         switch(getTap(DONT_SHOW_TEMPERATURE)) {
           case 0: screen = SCREEN_SETTINGS; break;
           case 1: screen = SCREEN_HOME; break;
@@ -615,16 +635,19 @@ redraw:
  
        case SCREEN_STATS:
         // Draw the screen
-        displayHeader((char *) "Statistics", false);
-        displayString(10, LINE(0), FONT_9PT_BLACK_ON_WHITE, (char *) "Number of reflows: ");
+        if (!drawScreenBackground(SCREEN_STATS)) {
+          displayHeader((char *) "Statistics", false);
+          displayString(10, LINE(0), FONT_9PT_BLACK_ON_WHITE, (char *) "Number of reflows: ");
+          displayString(10, LINE(1), FONT_9PT_BLACK_ON_WHITE, (char *) "Number of bakes: ");
+          // Draw a "Reset" button
+//          drawTouchButton(100, 180, 280, BUTTON_SMALL_FONT, (char *) "Reset");
+          drawNavigationButtons(false, true);
+          saveScreenBackground(SCREEN_STATS);
+        }
         sprintf(buffer100Bytes, "%d", prefs.numReflows);
         displayString(243, LINE(0), FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
-        displayString(10, LINE(1), FONT_9PT_BLACK_ON_WHITE, (char *) "Number of bakes: ");
         sprintf(buffer100Bytes, "%d", prefs.numBakes);
         displayString(225, LINE(1), FONT_9PT_BLACK_ON_WHITE, buffer100Bytes);
-        // Draw a "Reset" button
-//        drawTouchButton(100, 180, 280, 65, BUTTON_SMALL_FONT, (char *) "Reset");
-        drawNavigationButtons(false, true);
 
         // Act on the tap
         switch(getTap(SHOW_TEMPERATURE_IN_HEADER)) {
@@ -647,7 +670,7 @@ redraw:
           displayString(10, LINE(2), FONT_9PT_BLACK_ON_WHITE, (char *) "elements and insulation.  Learning");
           displayString(10, LINE(3), FONT_9PT_BLACK_ON_WHITE, (char *) "will take around 1 hour.");
         }
-        drawTouchButton(100, 180, 280, 164, BUTTON_SMALL_FONT, (char *) "Start Learning");
+        drawTouchButton(100, 180, 280, BUTTON_SMALL_FONT, (char *) "Start Learning");
         drawNavigationButtons(false, true);
 
         // Act on the tap
@@ -667,8 +690,24 @@ redraw:
 }
 
 
-void drawTouchButton(uint16_t x, uint16_t y, uint16_t width, uint16_t textWidth, bool useLargeFont, char *text) {
-  drawButton(x, y, width, textWidth, useLargeFont, text);
+void drawTouchButton(uint16_t x, uint16_t y, uint16_t width, bool useLargeFont, char *text) {
+  drawButton(x, y, width, useLargeFont, text);
+  defineTouchArea(x, y, width, BUTTON_HEIGHT);
+}
+
+
+// Draw a button with an icon after the text.  The text and icon are centered together
+void drawTouchButtonWithIcon(uint16_t x, uint16_t y, uint16_t width, bool useLargeFont, char *text, uint16_t icon, uint16_t iconY)
+{
+  uint8_t font = useLargeFont? FONT_12PT_BLACK_ON_WHITE: FONT_9PT_BLACK_ON_WHITE;
+  uint16_t textWidth = measureString(font, text), iconWidth = 0, iconHeight, textX;
+
+  getBitmapSize(icon, &iconWidth, &iconHeight);
+  textX = x + (width >> 1) - ((textWidth + BUTTON_ICON_GAP + iconWidth) >> 1);
+
+  drawButtonOutline(x, y, width);
+  composeText(textX, useLargeFont? y+18: y+21, font, text);
+  composeBitmap(icon, textX + textWidth + BUTTON_ICON_GAP, iconY);
   defineTouchArea(x, y, width, BUTTON_HEIGHT);
 }
 
@@ -713,16 +752,17 @@ void displayHeader(char *text, bool isSetting)
 }
 
 
+// The rectangle is added to the composition, if one is being built (see Compositor.h)
 void drawThickRectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t thickness, uint16_t color)
 {
   // Top bar
-  tft.fillRect(x, y, width, thickness, color);
+  composeRect(x, y, width, thickness, color);
   // Left bar
-  tft.fillRect(x, y + thickness, thickness, height - thickness, color);
+  composeRect(x, y + thickness, thickness, height - thickness, color);
   // Right bar
-  tft.fillRect(x + width - thickness, y + thickness, thickness, height - thickness, color);
+  composeRect(x + width - thickness, y + thickness, thickness, height - thickness, color);
   // Bottom bar
-  tft.fillRect(x + thickness, y + height - thickness, width - thickness - thickness, thickness, color);
+  composeRect(x + thickness, y + height - thickness, width - thickness - thickness, thickness, color);
 }
 
 
@@ -9,7 +9,10 @@ void setTouchTemperatureUnitChangeCallback(void (*f) (bool));
 // navigates between them.
 void showScreen(uint8_t screen);
 
-void drawTouchButton(uint16_t x, uint16_t y, uint16_t width, uint16_t textWidth, bool useLargeFont, char *text);
+void drawTouchButton(uint16_t x, uint16_t y, uint16_t width, bool useLargeFont, char *text);
+
+// Draw a button with an icon after the text.  The text and icon are centered together
+void drawTouchButtonWithIcon(uint16_t x, uint16_t y, uint16_t width, bool useLargeFont, char *text, uint16_t icon, uint16_t iconY);
 
 // Draw the naviation buttons at the bottom of the screen
 // Use large tap targets if possible
@@ -5,6 +5,15 @@
 // SD card controller
 // Based on Arduino's SD library
 
+// SD_ASM uses TX_SDCARD, RX_SDCARD and RX_SDCARD_BLOCK in BitBash.S to send and receive
+// bytes once the card is initialized.  Until then the card must be clocked slowly, so the
+// C versions are used.  Comment this out to always use the C versions (the 'K' debug
+// command compares them).
+#define SD_ASM
+
+// SD_CRC_CHECK checks the CRC16 of blocks that are read whole.  The card sends the CRC
+// anyway, but checking it costs about a third of the time it takes to read the block.
+//#define SD_CRC_CHECK
 
 #include <stdint.h>
 #include "Sd2Card.h"
@@ -12,9 +21,13 @@
 #include "SimplePIO.h"
 #include "ArduinoDefs.h"
 #include "rtos_support.h"
+#include "string.h"
+#include "BitBash.h"
 
 #define DEBUG_PRINT(x)          printfD("%s\n",x)
 
+struct sdCardStatistics sdStats;
+
 
 // At full speed, a data bit is clocked out every 800ns.  So 1.25MHz, well below the data rate
 // supported by even the oldest SD cards.  No delays are necessary.  Thank-you oscilloscope!
@@ -25,6 +38,11 @@ uint8_t Sd2Card::spiRec(void)
 {
     uint8_t data = 0;
 
+#ifdef SD_ASM
+    if (fastSpi_)
+        return RX_SDCARD();
+#endif
+
     // Set the output pin high
     MOSI_ACTIVE;
 
@@ -42,9 +60,31 @@ uint8_t Sd2Card::spiRec(void)
 }
 
 
+// SPI receive into a buffer
+void Sd2Card::spiRecBlock(uint8_t* dst, uint16_t count)
+{
+    if (!count)
+        return;
+#ifdef SD_ASM
+    if (fastSpi_) {
+        RX_SDCARD_BLOCK(dst, count);
+        return;
+    }
+#endif
+    while (count--)
+        *dst++ = spiRec();
+}
+
+
 // SPI send
 void Sd2Card::spiSend(uint8_t data)
 {
+#ifdef SD_ASM
+    if (fastSpi_) {
+        TX_SDCARD(data);
+        return;
+    }
+#endif
     for (uint8_t i = 0; i < 8; i++) {
         CLK_IDLE;
         if (data & 0x80)
@@ -61,6 +101,8 @@ void Sd2Card::spiSend(uint8_t data)
 // Send command and return error code.  Return zero for OK
 uint8_t Sd2Card::cardCommand(uint8_t cmd, uint32_t arg)
 {
+    sdStats.commands++;
+
     // Select card
     CS_ACTIVE;
 
@@ -77,6 +119,10 @@ uint8_t Sd2Card::cardCommand(uint8_t cmd, uint32_t arg)
     // Send CRC
     spiSend(cmd == CMD0_GO_IDLE_STATE? 0X95: cmd == CMD8_SEND_IF_COND? 0X87: 0xFF);
 
+    // The byte after CMD12 is left over from the data being read, so skip it
+    if (cmd == CMD12_STOP_TRANSMISSION)
+        spiRec();
+
     // Wait for response
     for (uint8_t i = 0; ((status_ = spiRec()) & 0X80) && i != 0XFF; i++)
         ;
@@ -121,6 +167,7 @@ uint8_t Sd2Card::erase(uint32_t firstBlock, uint32_t lastBlock) {
     bool retVal = false;
 
     // See if single block erase is supported
+    stopStream();
     if (!eraseSingleBlockEnable()) {
         DEBUG_PRINT("Sd2Card::erase - Single block erase not supported");
         goto done;
@@ -160,6 +207,11 @@ uint8_t Sd2Card::init()
 {
     bool retVal = false;
     type_ = 0;
+    fastSpi_ = false;
+
+    // CMD0 resets the card, so any transfer that was open is gone
+    stream_ = SD_STREAM_NONE;
+    lastReadBlock_ = lastWriteBlock_ = 0xFFFFFFFE;
 
     // Save the port addresses (https://github.com/arduino/ArduinoCore-samd/blob/master/cores/arduino/wiring_digital.c)
     portAOut   = &PORT_OUT(PA(0));
@@ -170,6 +222,9 @@ uint8_t Sd2Card::init()
     *portAMode |= (SETBIT05 + SETBIT07 + SETBIT06); // Outputs
     pinMode(PIN_A3, INPUT_PULLUP);  // Input for MISO
 
+    // MISO is sampled continuously so it can be read through the IOBUS (see RX_SDCARD in BitBash.S)
+    PORT_CTRL(PA(0)) |= SETBIT04;
+
     // 16-bit init start time allows over a minute
     uint16_t t0 = (uint16_t) millis();
     uint32_t arg;
@@ -229,6 +284,9 @@ next:
             spiRec();
     }
     retVal = true;
+#ifdef SD_ASM
+    fastSpi_ = true;
+#endif
 
 done:
     CS_IDLE;
@@ -243,7 +301,29 @@ uint8_t Sd2Card::readBlock(uint32_t block, uint8_t* dst)
 }
 
 
+#ifdef SD_CRC_CHECK
+// CRC16 (CCITT, as used for SD card data) a nibble at a time, so the table is small
+static const uint16_t crc16Table[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+static uint16_t crc16(const uint8_t* data, uint16_t length)
+{
+    uint16_t crc = 0;
+    while (length--) {
+        crc = (crc << 4) ^ crc16Table[(crc >> 12) ^ (*data >> 4)];
+        crc = (crc << 4) ^ crc16Table[(crc >> 12) ^ (*data++ & 0x0F)];
+    }
+    return crc;
+}
+#endif
+
+
 // Read part of a 512 byte block from an SD card.
+// The second of two consecutive blocks starts a multi-block read (CMD18).  It is kept
+// open while the blocks keep coming in order, so each one only costs a wait for the
+// start token instead of a command.
 uint8_t Sd2Card::readData(uint32_t block, uint16_t offset, uint16_t count, uint8_t* dst)
 {
     bool retVal = false;
@@ -254,13 +334,27 @@ uint8_t Sd2Card::readData(uint32_t block, uint16_t offset, uint16_t count, uint8
     if ((count + offset) > 512)
         return false;
 
-    // Use address if not SDHC card
-    if (type_ != SD_CARD_TYPE_SDHC)
-        block <<= 9;
-    if (cardCommand(CMD17_READ_BLOCK, block)) {
-        DEBUG_PRINT("Sd2Card::readData - read error");
-        goto done;
+    if (stream_ == SD_STREAM_READ && block == streamBlock_)
+        sdStats.streamedReads++;
+    else {
+        stopStream();
+        if (block == lastReadBlock_ + 1) {
+            if (cardCommand(CMD18_READ_MULTIPLE_BLOCK, cardAddress(block))) {
+                DEBUG_PRINT("Sd2Card::readData - multiple block read error");
+                goto done;
+            }
+            stream_ = SD_STREAM_READ;
+            sdStats.multiReads++;
+        }
+        else {
+            if (cardCommand(CMD17_READ_BLOCK, cardAddress(block))) {
+                DEBUG_PRINT("Sd2Card::readData - read error");
+                goto done;
+            }
+            sdStats.singleReads++;
+        }
     }
+    lastReadBlock_ = block;
     if (!waitStartBlock())
         goto done;
 
@@ -269,17 +363,36 @@ uint8_t Sd2Card::readData(uint32_t block, uint16_t offset, uint16_t count, uint8
         spiRec();
 
     // Transfer data
-    for (uint16_t i = 0; i < count; i++)
-        dst[i] = spiRec();
+    spiRecBlock(dst, count);
+    offset_ += count;
+
+#ifdef SD_CRC_CHECK
+    // The CRC can only be checked if the whole block was read
+    if (count == 512) {
+        uint16_t crc = spiRec() << 8;
+        crc |= spiRec();
+        offset_ += 2;
+        if (crc != crc16(dst, 512)) {
+            sdStats.crcErrors++;
+            DEBUG_PRINT("Sd2Card::readData - CRC error");
+            goto done;
+        }
+    }
+#endif
 
     // Read the rest of the block and the CRC
-    offset_ += count;
     while (offset_++ < 514)
         spiRec();
 
+    // Keep CS low for the next block
+    if (stream_ == SD_STREAM_READ) {
+        streamBlock_ = block + 1;
+        return true;
+    }
     retVal = true;
 
 done:
+    stopStream();
     CS_IDLE;
     return retVal;
 }
@@ -290,6 +403,7 @@ uint8_t Sd2Card::readRegister(uint8_t cmd, void* buf)
 {
     bool retVal = false;
     uint8_t* dst = reinterpret_cast<uint8_t*>(buf);
+    stopStream();
     if (cardCommand(cmd, 0)) {
         DEBUG_PRINT("Sd2Card::readRegister - Error reading register");
         goto done;
@@ -297,8 +411,7 @@ uint8_t Sd2Card::readRegister(uint8_t cmd, void* buf)
     if (!waitStartBlock())
         goto done;
     // Transfer data
-    for (uint16_t i = 0; i < 16; i++)
-        dst[i] = spiRec();
+    spiRecBlock(dst, 16);
     spiRec();  // Get crc bytes
     spiRec();
     retVal = true;
@@ -343,7 +456,10 @@ done:
 
 
 // Writes a 512 byte block to an SD card.
-uint8_t Sd2Card::writeBlock(uint32_t blockNumber, const uint8_t* src)
+// Blocks written in sequence go through one multi-block write (CMD25), which starts with
+// the second consecutive block (or the first, if the caller says more are to follow).
+// Each one after that only costs the data token and the wait for the previous block.
+uint8_t Sd2Card::writeBlock(uint32_t blockNumber, const uint8_t* src, uint32_t blocksToFollow)
 {
 //    SerialUSB.print("Sd2Card::writeBlock - writing block ");
 //    SerialUSB.println(blockNumber);
@@ -354,11 +470,34 @@ uint8_t Sd2Card::writeBlock(uint32_t blockNumber, const uint8_t* src)
         goto done;
     }
 
-    // Use address if not SDHC card
-    if (type() != SD_CARD_TYPE_SDHC)
-        blockNumber <<= 9;
+    // Carry on with the open multi-block write if this is the next block
+    if (stream_ == SD_STREAM_WRITE && blockNumber == streamBlock_) {
+        if (!writeData(src)) {
+            stopStream();
+            return false;
+        }
+        sdStats.streamedWrites++;
+        streamBlock_ = blockNumber + 1;
+        lastWriteBlock_ = blockNumber;
+        return true;
+    }
+    stopStream();
+
+    if (blocksToFollow > 1 || blockNumber == lastWriteBlock_ + 1) {
+        if (!writeStart(blockNumber, blocksToFollow))
+            return false;
+        stream_ = SD_STREAM_WRITE;
+        if (!writeData(src)) {
+            stopStream();
+            return false;
+        }
+        streamBlock_ = blockNumber + 1;
+        lastWriteBlock_ = blockNumber;
+        return true;
+    }
+    lastWriteBlock_ = blockNumber;
 
-    if (cardCommand(CMD24_WRITE_BLOCK, blockNumber)) {
+    if (cardCommand(CMD24_WRITE_BLOCK, cardAddress(blockNumber))) {
         DEBUG_PRINT("Sd2Card::writeBlock - Can't write block start");
         goto done;
     }
@@ -377,6 +516,7 @@ uint8_t Sd2Card::writeBlock(uint32_t blockNumber, const uint8_t* src)
         DEBUG_PRINT("Sd2Card::writeBlock - Write error");
         goto done;
     }
+    sdStats.singleWrites++;
     retVal = true;
 
 done:
@@ -418,29 +558,30 @@ uint8_t Sd2Card::writeData(uint8_t token, const uint8_t* src)
 }
 
 
-//  Start a write multiple blocks sequence
+//  Start a write multiple blocks sequence.  eraseCount blocks are pre-erased, which must
+//  not be more than the blocks that will be written (the rest would be left undefined)
 uint8_t Sd2Card::writeStart(uint32_t blockNumber, uint32_t eraseCount)
 {
-    printfD("Sd2Card::writeStart - writing block %lu eraseCount= %lu",
-            blockNumber, eraseCount);
     bool retVal = false;
     // Don't allow write to first block
     if (blockNumber == 0) {
         DEBUG_PRINT("Sd2Card::writeStart - Can't write block 0");
         goto done;
     }
+    stopStream();
     // Send pre-erase count
-    if (cardAcmd(ACMD23_SET_WR_BLK_ERASE_COUNT, eraseCount)) {
-        DEBUG_PRINT("Sd2Card::writeStart - Pre-erase error");
-        goto done;
+    if (eraseCount > 1) {
+        if (cardAcmd(ACMD23_SET_WR_BLK_ERASE_COUNT, eraseCount)) {
+            DEBUG_PRINT("Sd2Card::writeStart - Pre-erase error");
+            goto done;
+        }
+        sdStats.preErasedBlocks += eraseCount;
     }
-    // Use address if not SDHC card
-    if (type() != SD_CARD_TYPE_SDHC)
-        blockNumber <<= 9;
-    if (cardCommand(CMD25_WRITE_MULTIPLE_BLOCK, blockNumber)) {
+    if (cardCommand(CMD25_WRITE_MULTIPLE_BLOCK, cardAddress(blockNumber))) {
         DEBUG_PRINT("Sd2Card::writeStart - error");
         goto done;
     }
+    sdStats.multiWrites++;
     // Keep CS low
     return true;
 
@@ -453,7 +594,6 @@ done:
 // End a write multiple blocks sequence
 uint8_t Sd2Card::writeStop(void)
 {
-    printfD("Sd2Card::writeStop - writing block \n");
     bool retVal = false;
     if (!waitNotBusy(SD_WRITE_TIMEOUT))
         goto done;
@@ -466,3 +606,103 @@ done:
     CS_IDLE;
     return retVal;
 }
+
+
+// End the multi-block read or write, if one is open
+uint8_t Sd2Card::stopStream(void)
+{
+    uint8_t stream = stream_;
+    bool retVal = true;
+
+    stream_ = SD_STREAM_NONE;
+    if (stream == SD_STREAM_READ) {
+        if (cardCommand(CMD12_STOP_TRANSMISSION, 0)) {
+            DEBUG_PRINT("Sd2Card::stopStream - stop read error");
+            retVal = false;
+        }
+        CS_IDLE;
+    }
+    else if (stream == SD_STREAM_WRITE) {
+        CS_ACTIVE;
+        retVal = writeStop();
+    }
+    return retVal;
+}
+
+
+// Time reading the first 64 blocks of the card with the C and assembly versions of the
+// SPI receive, one block at a time (CMD17) and as one multi-block read (CMD18), and print
+// the results.  All three read the same data, so the results are compared too.  The
+// blocks are read into a small buffer (the debug console's stack is small), and only the
+// time spent talking to the card is counted.
+void Sd2Card::benchmarkRead()
+{
+    static const char* names[] = {"C", "Assembly", "Streamed"};
+    uint8_t buf[128];
+    uint32_t start, cycles, checksum[3];
+    uint16_t i, block, chunk;
+    bool fastSpi = fastSpi_;
+
+    stopStream();
+    for (uint8_t version = 0; version < 3; version++) {
+        checksum[version] = 0;
+        cycles = 0;
+        fastSpi_ = version != 0;
+        for (block = 0; block < 64; block++) {
+            start = CPU_HZ_COUNTER();
+            if (version < 2 || block == 0) {
+                if (cardCommand(version < 2? CMD17_READ_BLOCK : CMD18_READ_MULTIPLE_BLOCK, cardAddress(block)))
+                    break;
+                if (version == 2)
+                    stream_ = SD_STREAM_READ;
+            }
+            if (!waitStartBlock())
+                break;
+            for (chunk = 0; chunk < 4; chunk++) {
+                spiRecBlock(buf, sizeof(buf));
+                cycles += CPU_HZ_COUNTER() - start;
+                for (i = 0; i < sizeof(buf); i++)
+                    checksum[version] += buf[i];
+                start = CPU_HZ_COUNTER();
+            }
+            spiRec();  // Get crc bytes
+            spiRec();
+            if (version < 2)
+                CS_IDLE;
+            cycles += CPU_HZ_COUNTER() - start;
+        }
+        start = CPU_HZ_COUNTER();
+        stopStream();
+        cycles += CPU_HZ_COUNTER() - start;
+        if (block < 64) {
+            CS_IDLE;
+            fastSpi_ = fastSpi;
+            printfD("  %-8s read failed at block %u\n", names[version], block);
+            return;
+        }
+
+        // Bytes per millisecond is KB/s
+        uint32_t bytesPerMs = (32768 * (configCPU_CLOCK_HZ / 1000)) / cycles;
+        printfD("  %-8s 64 blocks = %8u cycles (%u cycles/byte, %u KB/s)\n", names[version],
+                (unsigned int) cycles, (unsigned int) (cycles >> 15), (unsigned int) bytesPerMs);
+    }
+    fastSpi_ = fastSpi;
+    lastReadBlock_ = 0xFFFFFFFE;
+    if (checksum[0] != checksum[1] || checksum[0] != checksum[2])
+        printfD("  The versions read different data!\n");
+}
+
+
+// Print the command counts on the debug console (and reset them)
+void PrintSDCardStats()
+{
+    printfD("  Commands            = %lu\n", sdStats.commands);
+    printfD("  Single block reads  = %lu\n", sdStats.singleReads);
+    printfD("  Multi-block reads   = %lu (+%lu blocks streamed)\n", sdStats.multiReads, sdStats.streamedReads);
+    printfD("  Single block writes = %lu\n", sdStats.singleWrites);
+    printfD("  Multi-block writes  = %lu (+%lu blocks streamed, %lu pre-erased)\n", sdStats.multiWrites, sdStats.streamedWrites, sdStats.preErasedBlocks);
+#ifdef SD_CRC_CHECK
+    printfD("  CRC errors          = %lu\n", sdStats.crcErrors);
+#endif
+    memset(&sdStats, 0, sizeof(sdStats));
+}
@@ -11,6 +11,7 @@
 #include <stdint.h>
 #include "SdInfo.h"
 #include "bits.h"
+#include "SimplePIO.h"
 
 
 // SCK is PA5
@@ -41,6 +42,27 @@
 #define SD_CARD_TYPE_SD2                2       // Standard capacity V2 SD card
 #define SD_CARD_TYPE_SDHC               3       // High Capacity SD card
 
+// Multi-block transfers.  Sequential blocks are read with one CMD18 and written with one
+// CMD25, which stay open (with CS low) until a block out of sequence or another command
+// is needed, or stopStream() is called.
+#define SD_STREAM_NONE                  0
+#define SD_STREAM_READ                  1
+#define SD_STREAM_WRITE                 2
+
+// Counts of the commands sent and how the blocks were transferred.  Use 'D' on the debug console to see them.
+struct sdCardStatistics {
+    uint32_t commands;              // Commands sent (including CMD55 before each ACMD)
+    uint32_t singleReads;           // CMD17
+    uint32_t multiReads;            // CMD18
+    uint32_t streamedReads;         // Blocks read from an open CMD18 (after the first one)
+    uint32_t singleWrites;          // CMD24
+    uint32_t multiWrites;           // CMD25
+    uint32_t streamedWrites;        // Blocks written to an open CMD25 (after the first one)
+    uint32_t preErasedBlocks;       // Blocks pre-erased with ACMD23
+    uint32_t crcErrors;             // Blocks read with a bad CRC (only checked with SD_CRC_CHECK)
+};
+extern struct sdCardStatistics sdStats;
+
 
 // Sd2Card class - Raw access to SD and SDHC flash memory cards.
 class Sd2Card {
@@ -58,22 +80,41 @@ public:
     // regarding access to the card's contents.
     uint8_t readCSD(csd_t* csd) { return readRegister(CMD9_SEND_CSD, csd); }
     uint8_t type(void)  { return type_; }
-    uint8_t writeBlock(uint32_t blockNumber, const uint8_t* src);
+    // Write a block.  blocksToFollow is the number of blocks (including this one) that the
+    // caller is certain to write next, in sequence.  They are pre-erased (ACMD23).
+    uint8_t writeBlock(uint32_t blockNumber, const uint8_t* src, uint32_t blocksToFollow = 0);
     uint8_t writeData(const uint8_t* src);
     uint8_t writeData(uint8_t token, const uint8_t* src);
     uint8_t writeStart(uint32_t blockNumber, uint32_t eraseCount);
     uint8_t writeStop(void);
+    // End the multi-block read or write, if one is open
+    uint8_t stopStream(void);
+    // Time reading blocks with the C and assembly versions of the SPI receive
+    void benchmarkRead(void);
 
 private:
-    volatile uint32_t *portAOut, *portAIn, *portAMode;
+    PORT_REGISTER *portAOut, *portAIn, *portAMode;
     uint8_t status_;
     uint8_t type_;
+    bool fastSpi_;                  // Use the assembly SPI routines (after the card is initialized)
+    uint8_t stream_;                // SD_STREAM_NONE, SD_STREAM_READ or SD_STREAM_WRITE
+    uint32_t streamBlock_;          // The next block of the open stream
+    uint32_t lastReadBlock_;
+    uint32_t lastWriteBlock_;
     uint8_t cardAcmd(uint8_t cmd, uint32_t arg) { cardCommand(CMD55_APP_CMD, 0); return cardCommand(cmd, arg); }
+    uint32_t cardAddress(uint32_t block) { return type_ == SD_CARD_TYPE_SDHC? block : block << 9; }
     uint8_t cardCommand(uint8_t cmd, uint32_t arg);
     uint8_t readRegister(uint8_t cmd, void* buf);
     uint8_t waitNotBusy(uint16_t timeoutMillis);
     uint8_t waitStartBlock(void);
     uint8_t spiRec(void);
+    void    spiRecBlock(uint8_t* dst, uint16_t count);
     void    spiSend(uint8_t data);
 };
+
+extern "C" {
+// Print the command counts on the debug console (and reset them)
+void PrintSDCardStats(void);
+}
+
 #endif  // SD2CARD_H_
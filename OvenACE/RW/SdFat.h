@@ -36,6 +36,15 @@
  */
 #define ALLOW_DEPRECATED_FUNCTIONS 1
 //------------------------------------------------------------------------------
+/**
+ * Number of blocks in the SdVolume block cache.  Three blocks keep a FAT
+ * block, a directory block and a file data block cached at the same time.
+ * 1 is the original single block cache.
+ */
+#ifndef SD_CACHE_BLOCKS
+#define SD_CACHE_BLOCKS 3
+#endif
+//------------------------------------------------------------------------------
 // forward declaration since SdVolume is used in SdFile
 class SdVolume;
 //==============================================================================
@@ -424,6 +433,25 @@ union cache_t {
            /** Used to access to a cached FAT boot sector. */
   fbs_t    fbs;
 };
+/**
+ * \brief State of a block in the SdVolume cache
+ */
+struct cacheEntry_t {
+  uint32_t blockNumber;   // Logical number of the block, 0XFFFFFFFF if empty
+  uint32_t mirrorBlock;   // block number for mirror FAT, 0 if none
+  uint32_t lastUsed;      // when the block was last used, for LRU replacement
+  uint8_t dirty;          // cacheFlush() will write block if true
+};
+/**
+ * \brief Counts of how the SdVolume cache is used
+ */
+struct sdCacheStatistics {
+  uint32_t hits;          // blocks found in the cache
+  uint32_t misses;        // blocks read into the cache (or reserved for writing)
+  uint32_t writebacks;    // dirty blocks written to the card
+  uint32_t mirrorWrites;  // blocks written to the second FAT
+};
+extern struct sdCacheStatistics sdCacheStats;
 //------------------------------------------------------------------------------
 /**
  * \class SdVolume
@@ -438,8 +466,8 @@ class SdVolume {
    */
   static uint8_t* cacheClear(void) {
     cacheFlush();
-    cacheBlockNumber_ = 0XFFFFFFFF;
-    return cacheBuffer_.data;
+    cacheInvalidate(cacheBlockNumber_);
+    return cacheBuffer_->data;
   }
   /**
    * Initialize a FAT volume.  Try partition one first then try super
@@ -499,12 +527,18 @@ class SdVolume {
   static uint8_t const CACHE_FOR_READ = 0;
   // value for action argument in cacheRawBlock to indicate cache dirty
   static uint8_t const CACHE_FOR_WRITE = 1;
+  // option for cacheRawBlock to skip reading a block that will be overwritten
+  static uint8_t const CACHE_OPTION_NO_READ = 2;
+  // value for action argument in cacheRawBlock for a new block
+  static uint8_t const CACHE_RESERVE_FOR_WRITE = CACHE_FOR_WRITE | CACHE_OPTION_NO_READ;
 
-  static cache_t cacheBuffer_;        // 512 byte cache for device blocks
-  static uint32_t cacheBlockNumber_;  // Logical number of block in the cache
+  static cache_t cacheBlocks_[SD_CACHE_BLOCKS];       // 512 byte cache for device blocks
+  static cacheEntry_t cacheEntries_[SD_CACHE_BLOCKS]; // state of each cached block
+  static uint32_t cacheUses_;         // cacheRawBlock() calls, the clock for LRU
+  static uint8_t cacheCurrent_;       // entry of the block used last
+  static cache_t* cacheBuffer_;       // block used last
+  static uint32_t cacheBlockNumber_;  // Logical number of block used last
   static Sd2Card* sdCard_;            // Sd2Card object for cache
-  static uint8_t cacheDirty_;         // cacheFlush() will write block if true
-  static uint32_t cacheMirrorBlock_;  // block number for mirror FAT
 //
   uint32_t allocSearchStart_;   // start cluster for alloc search
   uint8_t blocksPerCluster_;    // cluster size in blocks
@@ -525,9 +559,13 @@ class SdVolume {
            return dataStartBlock_ + ((cluster - 2) << clusterSizeShift_);}
   uint32_t blockNumber(uint32_t cluster, uint32_t position) const {
            return clusterStartBlock(cluster) + blockOfCluster(position);}
+  static uint8_t cacheContains(uint32_t blockNumber);
   static uint8_t cacheFlush(void);
+  static void cacheInvalidate(uint32_t blockNumber);
   static uint8_t cacheRawBlock(uint32_t blockNumber, uint8_t action);
-  static void cacheSetDirty(void) {cacheDirty_ |= CACHE_FOR_WRITE;}
+  static void cacheSetDirty(void) {
+    cacheEntries_[cacheCurrent_].dirty = CACHE_FOR_WRITE;}
+  static uint8_t cacheWriteBack(uint8_t entry);
   static uint8_t cacheZeroBlock(uint32_t blockNumber);
   uint8_t chainSize(uint32_t beginCluster, uint32_t* size) const;
   uint8_t fatGet(uint32_t cluster, uint32_t* value) const;
@@ -545,8 +583,15 @@ class SdVolume {
     uint16_t count, uint8_t* dst) {
       return sdCard_->readData(block, offset, count, dst);
   }
-  uint8_t writeBlock(uint32_t block, const uint8_t* dst) {
-    return sdCard_->writeBlock(block, dst);
+  uint8_t writeBlock(uint32_t block, const uint8_t* dst, uint32_t blocksToFollow = 0) {
+    return sdCard_->writeBlock(block, dst, blocksToFollow);
   }
+  // end the card's multi-block read or write (see Sd2Card::readData)
+  static uint8_t stopStream(void) {return sdCard_->stopStream();}
 };
+
+extern "C" {
+// Print the SdVolume cache statistics on the debug console (and reset them)
+void PrintSDCacheStats(void);
+}
 #endif  // SdFat_h
@@ -63,7 +63,7 @@ uint8_t SdFile::addDirCluster(void) {
 // return pointer to cached entry or null for failure
 dir_t* SdFile::cacheDirEntry(uint8_t action) {
   if (!SdVolume::cacheRawBlock(dirBlock_, action)) return NULL;
-  return SdVolume::cacheBuffer_.dir + dirIndex_;
+  return SdVolume::cacheBuffer_->dir + dirIndex_;
 }
 //------------------------------------------------------------------------------
 /**
@@ -322,7 +322,7 @@ uint8_t SdFile::makeDir(SdFile* dir, const char* dirName) {
   if (!SdVolume::cacheRawBlock(block, SdVolume::CACHE_FOR_WRITE)) return false;
 
   // copy '.' to block
-  memcpy(&SdVolume::cacheBuffer_.dir[0], &d, sizeof(d));
+  memcpy(&SdVolume::cacheBuffer_->dir[0], &d, sizeof(d));
 
   // make entry for '..'
   d.name[1] = '.';
@@ -334,7 +334,7 @@ uint8_t SdFile::makeDir(SdFile* dir, const char* dirName) {
     d.firstClusterHigh = dir->firstCluster_ >> 16;
   }
   // copy '..' to block
-  memcpy(&SdVolume::cacheBuffer_.dir[1], &d, sizeof(d));
+  memcpy(&SdVolume::cacheBuffer_->dir[1], &d, sizeof(d));
 
   // set position after '..'
   curPosition_ = 2 * sizeof(d);
@@ -441,7 +441,7 @@ uint8_t SdFile::open(SdFile* dirFile, const char* fileName, uint8_t oflag) {
 
     // use first entry in cluster
     dirIndex_ = 0;
-    p = SdVolume::cacheBuffer_.dir;
+    p = SdVolume::cacheBuffer_->dir;
   }
   // initialize as empty file
   memset(p, 0, sizeof(dir_t));
@@ -519,7 +519,7 @@ uint8_t SdFile::open(SdFile* dirFile, uint16_t index, uint8_t oflag) {
 // open a cached directory entry. Assumes vol_ is initializes
 uint8_t SdFile::openCachedEntry(uint8_t dirIndex, uint8_t oflag) {
   // location of entry in cache
-  dir_t* p = SdVolume::cacheBuffer_.dir + dirIndex;
+  dir_t* p = SdVolume::cacheBuffer_->dir + dirIndex;
 
   // write or truncate is an error for a directory or read-only file
   if (p->attributes & (DIR_ATT_READ_ONLY | DIR_ATT_DIRECTORY)) {
@@ -712,13 +712,13 @@ int16_t SdFile::read(void* buf, uint16_t nbyte) {
 
     // no buffering needed if n == 512 or user requests no buffering
     if ((unbufferedRead() || n == 512) &&
-      block != SdVolume::cacheBlockNumber_) {
+      !SdVolume::cacheContains(block)) {
       if (!vol_->readData(block, offset, n, dst)) return -1;
       dst += n;
     } else {
       // read block to cache and copy data to caller
       if (!SdVolume::cacheRawBlock(block, SdVolume::CACHE_FOR_READ)) return -1;
-      uint8_t* src = SdVolume::cacheBuffer_.data + offset;
+      uint8_t* src = SdVolume::cacheBuffer_->data + offset;
       uint8_t* end = src + n;
       while (src != end) *dst++ = *src++;
     }
@@ -772,7 +772,7 @@ dir_t* SdFile::readDirCache(void) {
   curPosition_ += 31;
 
   // return pointer to entry
-  return (SdVolume::cacheBuffer_.dir + i);
+  return (SdVolume::cacheBuffer_->dir + i);
 }
 //------------------------------------------------------------------------------
 /**
@@ -995,7 +995,8 @@ uint8_t SdFile::sync(void) {
     // clear directory dirty
     flags_ &= ~F_FILE_DIR_DIRTY;
   }
-  return SdVolume::cacheFlush();
+  // the card may still be in a multi-block transfer
+  return SdVolume::cacheFlush() && SdVolume::stopStream();
 }
 //------------------------------------------------------------------------------
 /**
@@ -1190,24 +1191,27 @@ size_t SdFile::write(const void* buf, uint16_t nbyte) {
     if (n == 512) {
       // full block - don't need to use cache
       // invalidate cache if block is in cache
-      if (SdVolume::cacheBlockNumber_ == block) {
-        SdVolume::cacheBlockNumber_ = 0XFFFFFFFF;
+      SdVolume::cacheInvalidate(block);
+      // the rest of the full blocks in this cluster are written next
+      uint32_t blocksToFollow = nToWrite >> 9;
+      if (blocksToFollow > (uint32_t) (vol_->blocksPerCluster_ - blockOfCluster)) {
+        blocksToFollow = vol_->blocksPerCluster_ - blockOfCluster;
       }
-      if (!vol_->writeBlock(block, src)) goto writeErrorReturn;
+      if (!vol_->writeBlock(block, src, blocksToFollow)) goto writeErrorReturn;
       src += 512;
     } else {
       if (blockOffset == 0 && curPosition_ >= fileSize_) {
         // start of new block don't need to read into cache
-        if (!SdVolume::cacheFlush()) goto writeErrorReturn;
-        SdVolume::cacheBlockNumber_ = block;
-        SdVolume::cacheSetDirty();
+        if (!SdVolume::cacheRawBlock(block, SdVolume::CACHE_RESERVE_FOR_WRITE)) {
+          goto writeErrorReturn;
+        }
       } else {
         // rewrite part of block
         if (!SdVolume::cacheRawBlock(block, SdVolume::CACHE_FOR_WRITE)) {
           goto writeErrorReturn;
         }
       }
-      uint8_t* dst = SdVolume::cacheBuffer_.data + blockOffset;
+      uint8_t* dst = SdVolume::cacheBuffer_->data + blockOffset;
       uint8_t* end = dst + n;
       while (dst != end) *dst++ = *src++;
     }
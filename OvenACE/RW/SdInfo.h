@@ -24,8 +24,10 @@
 #define CMD8_SEND_IF_COND               0X08 // Verify SD Memory Card interface operating condition
 #define CMD9_SEND_CSD                   0X09 // Read the Card Specific Data (CSD register)
 #define CMD10_SEND_CID                  0X0A // Read the card identification information (CID register)
+#define CMD12_STOP_TRANSMISSION         0X0C // End a multiple block read
 #define CMD13_SEND_STATUS               0X0D // Read the card status register
 #define CMD17_READ_BLOCK                0X11 // Read a single data block from the card
+#define CMD18_READ_MULTIPLE_BLOCK       0X12 // Read blocks of data until a STOP_TRANSMISSION
 #define CMD24_WRITE_BLOCK               0X18 // Write a single data block to the card
 #define CMD25_WRITE_MULTIPLE_BLOCK      0X19 // Write blocks of data until a STOP_TRANSMISSION
 #define CMD32_ERASE_WR_BLK_START        0x20 // Sets the address of the first block to be erased
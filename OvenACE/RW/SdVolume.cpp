@@ -18,14 +18,24 @@
  * <http://www.gnu.org/licenses/>.
  */
 #include "SdFat.h"
+#include "printf-stdarg.h"
+#include "string.h"
 //------------------------------------------------------------------------------
 // raw block cache
+// The cache holds SD_CACHE_BLOCKS blocks.  cacheBuffer_ and cacheBlockNumber_
+// are the block used last, which is the one SdFile works on.  A block that isn't
+// in the cache replaces the least recently used one, which is written first if
+// it is dirty.  SdFile::sync() writes the dirty blocks; init() empties the
+// cache without writing it, in case the card was changed.
 // init cacheBlockNumber_to invalid SD block number
 uint32_t SdVolume::cacheBlockNumber_ = 0XFFFFFFFF;
-cache_t  SdVolume::cacheBuffer_;     // 512 byte cache for Sd2Card
+cache_t  SdVolume::cacheBlocks_[SD_CACHE_BLOCKS];     // 512 byte cache for Sd2Card
+cacheEntry_t SdVolume::cacheEntries_[SD_CACHE_BLOCKS];
+uint32_t SdVolume::cacheUses_ = 0;
+uint8_t  SdVolume::cacheCurrent_ = 0;
+cache_t* SdVolume::cacheBuffer_ = SdVolume::cacheBlocks_;
 Sd2Card* SdVolume::sdCard_;          // pointer to SD card object
-uint8_t  SdVolume::cacheDirty_ = 0;  // cacheFlush() will write block if true
-uint32_t SdVolume::cacheMirrorBlock_ = 0;  // mirror  block for second FAT
+struct sdCacheStatistics sdCacheStats;
 //------------------------------------------------------------------------------
 // find a contiguous group of clusters
 uint8_t SdVolume::allocContiguous(uint32_t count, uint32_t* curCluster) {
@@ -96,43 +106,99 @@ uint8_t SdVolume::allocContiguous(uint32_t count, uint32_t* curCluster) {
   return true;
 }
 //------------------------------------------------------------------------------
+// return true if the block is in the cache
+uint8_t SdVolume::cacheContains(uint32_t blockNumber) {
+  for (uint8_t i = 0; i < SD_CACHE_BLOCKS; i++) {
+    if (cacheEntries_[i].blockNumber == blockNumber) return true;
+  }
+  return false;
+}
+//------------------------------------------------------------------------------
+// write all dirty blocks
 uint8_t SdVolume::cacheFlush(void) {
-  if (cacheDirty_) {
-    if (!sdCard_->writeBlock(cacheBlockNumber_, cacheBuffer_.data)) {
-      return false;
-    }
-    // mirror FAT tables
-    if (cacheMirrorBlock_) {
-      if (!sdCard_->writeBlock(cacheMirrorBlock_, cacheBuffer_.data)) {
-        return false;
-      }
-      cacheMirrorBlock_ = 0;
-    }
-    cacheDirty_ = 0;
+  for (uint8_t i = 0; i < SD_CACHE_BLOCKS; i++) {
+    if (!cacheWriteBack(i)) return false;
   }
   return true;
 }
 //------------------------------------------------------------------------------
+// remove a block from the cache without writing it, because it is about to be
+// overwritten on the card.  0XFFFFFFFF empties the cache
+void SdVolume::cacheInvalidate(uint32_t blockNumber) {
+  for (uint8_t i = 0; i < SD_CACHE_BLOCKS; i++) {
+    if (blockNumber == 0XFFFFFFFF || cacheEntries_[i].blockNumber == blockNumber) {
+      cacheEntries_[i].blockNumber = 0XFFFFFFFF;
+      cacheEntries_[i].mirrorBlock = 0;
+      cacheEntries_[i].lastUsed = 0;
+      cacheEntries_[i].dirty = 0;
+    }
+  }
+  if (blockNumber == 0XFFFFFFFF || cacheBlockNumber_ == blockNumber) {
+    cacheBlockNumber_ = 0XFFFFFFFF;
+  }
+}
+//------------------------------------------------------------------------------
 uint8_t SdVolume::cacheRawBlock(uint32_t blockNumber, uint8_t action) {
+  uint8_t i = cacheCurrent_;
   if (cacheBlockNumber_ != blockNumber) {
-    if (!cacheFlush()) return false;
-    if (!sdCard_->readBlock(blockNumber, cacheBuffer_.data)) return false;
+    // look for the block, and the least recently used entry in case it isn't there
+    uint8_t lru = 0;
+    for (i = 0; i < SD_CACHE_BLOCKS; i++) {
+      if (cacheEntries_[i].blockNumber == blockNumber) break;
+      if (cacheEntries_[i].lastUsed < cacheEntries_[lru].lastUsed) lru = i;
+    }
+    if (i == SD_CACHE_BLOCKS) {
+      sdCacheStats.misses++;
+      i = lru;
+      if (!cacheWriteBack(i)) return false;
+      if (i == cacheCurrent_) cacheBlockNumber_ = 0XFFFFFFFF;
+      cacheEntries_[i].blockNumber = 0XFFFFFFFF;
+      if (!(action & CACHE_OPTION_NO_READ) &&
+        !sdCard_->readBlock(blockNumber, cacheBlocks_[i].data)) return false;
+      cacheEntries_[i].blockNumber = blockNumber;
+    } else {
+      sdCacheStats.hits++;
+    }
+    cacheCurrent_ = i;
+    cacheBuffer_ = &cacheBlocks_[i];
     cacheBlockNumber_ = blockNumber;
+  } else {
+    sdCacheStats.hits++;
+  }
+  cacheEntries_[i].lastUsed = ++cacheUses_;
+  cacheEntries_[i].dirty |= action & CACHE_FOR_WRITE;
+  return true;
+}
+//------------------------------------------------------------------------------
+// write a cached block if it is dirty
+uint8_t SdVolume::cacheWriteBack(uint8_t entry) {
+  cacheEntry_t* e = &cacheEntries_[entry];
+  if (e->dirty) {
+    if (!sdCard_->writeBlock(e->blockNumber, cacheBlocks_[entry].data)) {
+      return false;
+    }
+    sdCacheStats.writebacks++;
+    // mirror FAT tables
+    if (e->mirrorBlock) {
+      if (!sdCard_->writeBlock(e->mirrorBlock, cacheBlocks_[entry].data)) {
+        return false;
+      }
+      sdCacheStats.mirrorWrites++;
+      e->mirrorBlock = 0;
+    }
+    e->dirty = 0;
   }
-  cacheDirty_ |= action;
   return true;
 }
 //------------------------------------------------------------------------------
 // cache a zero block for blockNumber
 uint8_t SdVolume::cacheZeroBlock(uint32_t blockNumber) {
-  if (!cacheFlush()) return false;
+  if (!cacheRawBlock(blockNumber, CACHE_RESERVE_FOR_WRITE)) return false;
 
-  // loop take less flash than memset(cacheBuffer_.data, 0, 512);
+  // loop take less flash than memset(cacheBuffer_->data, 0, 512);
   for (uint16_t i = 0; i < 512; i++) {
-    cacheBuffer_.data[i] = 0;
+    cacheBuffer_->data[i] = 0;
   }
-  cacheBlockNumber_ = blockNumber;
-  cacheSetDirty();
   return true;
 }
 //------------------------------------------------------------------------------
@@ -156,9 +222,9 @@ uint8_t SdVolume::fatGet(uint32_t cluster, uint32_t* value) const {
     if (!cacheRawBlock(lba, CACHE_FOR_READ)) return false;
   }
   if (fatType_ == 16) {
-    *value = cacheBuffer_.fat16[cluster & 0XFF];
+    *value = cacheBuffer_->fat16[cluster & 0XFF];
   } else {
-    *value = cacheBuffer_.fat32[cluster & 0X7F] & FAT32MASK;
+    *value = cacheBuffer_->fat32[cluster & 0X7F] & FAT32MASK;
   }
   return true;
 }
@@ -180,14 +246,14 @@ uint8_t SdVolume::fatPut(uint32_t cluster, uint32_t value) {
   }
   // store entry
   if (fatType_ == 16) {
-    cacheBuffer_.fat16[cluster & 0XFF] = value;
+    cacheBuffer_->fat16[cluster & 0XFF] = value;
   } else {
-    cacheBuffer_.fat32[cluster & 0X7F] = value;
+    cacheBuffer_->fat32[cluster & 0X7F] = value;
   }
   cacheSetDirty();
 
   // mirror second FAT
-  if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
+  if (fatCount_ > 1) cacheEntries_[cacheCurrent_].mirrorBlock = lba + blocksPerFat_;
   return true;
 }
 //------------------------------------------------------------------------------
@@ -226,13 +292,21 @@ uint8_t SdVolume::freeChain(uint32_t cluster) {
  */
 uint8_t SdVolume::init(Sd2Card* dev, uint8_t part) {
   uint32_t volumeStartBlock = 0;
+  // empty the cache without writing it back: the card may have been changed.
+  // SdFile::sync() and close() write dirty blocks, so there should be none
+  for (uint8_t i = 0; i < SD_CACHE_BLOCKS; i++) {
+    if (cacheEntries_[i].dirty) {
+      printfD("SdVolume::init - dropping dirty block %lu\n", cacheEntries_[i].blockNumber);
+    }
+  }
+  cacheInvalidate(0XFFFFFFFF);
   sdCard_ = dev;
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
   if (part) {
     if (part > 4)return false;
     if (!cacheRawBlock(volumeStartBlock, CACHE_FOR_READ)) return false;
-    part_t* p = &cacheBuffer_.mbr.part[part-1];
+    part_t* p = &cacheBuffer_->mbr.part[part-1];
     if ((p->boot & 0X7F) !=0  ||
       p->totalSectors < 100 ||
       p->firstSector == 0) {
@@ -242,13 +316,13 @@ uint8_t SdVolume::init(Sd2Card* dev, uint8_t part) {
     volumeStartBlock = p->firstSector;
   }
   if (!cacheRawBlock(volumeStartBlock, CACHE_FOR_READ)) return false;
-  bpb_t* bpb = &cacheBuffer_.fbs.bpb;
+  bpb_t* bpb = &cacheBuffer_->fbs.bpb;
   if (bpb->bytesPerSector != 512 ||
     bpb->fatCount == 0 ||
     bpb->reservedSectorCount == 0 ||
     bpb->sectorsPerCluster == 0) {
        // not valid FAT volume
-      cacheBlockNumber_ = -1;
+      cacheInvalidate(cacheBlockNumber_);
       return false;
   }
   fatCount_ = bpb->fatCount;
@@ -294,3 +368,12 @@ uint8_t SdVolume::init(Sd2Card* dev, uint8_t part) {
   }
   return true;
 }
+//------------------------------------------------------------------------------
+// Print the cache statistics on the debug console (and reset them)
+void PrintSDCacheStats(void) {
+  printfD("  Cache blocks        = %d\n", SD_CACHE_BLOCKS);
+  printfD("  Cache hits          = %lu\n", sdCacheStats.hits);
+  printfD("  Cache misses        = %lu\n", sdCacheStats.misses);
+  printfD("  Cache writebacks    = %lu (+%lu to the second FAT)\n", sdCacheStats.writebacks, sdCacheStats.mirrorWrites);
+  memset(&sdCacheStats, 0, sizeof(sdCacheStats));
+}
@@ -55,8 +55,10 @@
 #define MIN_PULSE_COUNTER      ((MIN_PULSE_WIDTH * 3) / 4)   // 600
 #define MAX_PULSE_COUNTER      ((MAX_PULSE_WIDTH * 3) / 4)   // 1650
 
-#define SERVO_PIN_HIGH         *portBOut |= SETBIT31;
-#define SERVO_PIN_LOW          *portBOut &= CLEARBIT31;
+// Use the set and clear registers.  The LCD's DMA fill toggles the WR pin on PORTB
+// in the background, and a read-modify-write of PORTB could undo a toggle.
+#define SERVO_PIN_HIGH         PORT_OUTPUT_HIGH(PBIT(PB(31)));
+#define SERVO_PIN_LOW          PORT_OUTPUT_LOW(PBIT(PB(31)));
  
 // Variables used to control servo movement
 volatile uint16_t servoMovements;          // Number of movements (pulses) to reach the desired position
@@ -0,0 +1,177 @@
+// Text that is redrawn in the same place over and over (timers, status messages)
+//
+// The glyph positions are worked out exactly as displayString() does, but using the
+// bitmap widths (which are in RAM or microcontroller flash) instead of drawing the
+// glyphs.  A glyph is redrawn if it is a different character or it has moved, so
+// changing the width of a centered or right-aligned string redraws all of it.
+#include <stdint.h>
+#include "TextField.h"
+#include "Render.h"
+#include "ReflowWizard.h"
+#include "printf-stdarg.h"
+#include "string.h"
+
+
+TextField::TextField(uint16_t x, uint16_t y, uint8_t font, uint8_t align)
+{
+  _x = x;
+  _y = y;
+  _font = font;
+  _align = align;
+  _length = 0;
+  _text[0] = 0;
+  invalidate();
+}
+
+
+// Work out where each glyph goes, relative to the start of the string.  Returns the width
+static uint16_t layoutString(uint8_t font, const char *str, uint8_t length, uint16_t *glyphX)
+{
+  uint16_t x = 0;
+
+  for (uint8_t i=0; i < length; i++) {
+    if (i)
+      x += postCharacterSpace(font, str[i-1]) + preCharacterSpace(font, str[i]);
+    glyphX[i] = x;
+    x += getCharacterWidth(font, str[i]);
+  }
+  return x;
+}
+
+
+// Get the box a glyph is drawn in: top (relative to y), width and height.  Returns false
+// for characters that aren't drawn (spaces and unsupported characters)
+static bool getGlyphBox(uint8_t font, char c, int16_t *top, uint16_t *width, uint16_t *height)
+{
+  if (c == ' ' || !isSupportedCharacter(font, c))
+    return false;
+  if (!getBitmapSize(getBitmapNumberForCharacter(&font, c), width, height))
+    return false;
+  *top = getYOffsetForCharacter(font, c);
+  return true;
+}
+
+
+// Glyphs are opaque, so a glyph drawn at the same place as an old one hides it if its
+// box covers the old box.  The old one doesn't need to be erased first.
+static bool glyphCovers(uint8_t font, char newChar, char oldChar)
+{
+  uint16_t newWidth, newHeight, oldWidth, oldHeight;
+  int16_t newTop, oldTop;
+
+  if (!getGlyphBox(font, oldChar, &oldTop, &oldWidth, &oldHeight))
+    return true;
+  if (!getGlyphBox(font, newChar, &newTop, &newWidth, &newHeight))
+    return false;
+  return newWidth >= oldWidth && newTop <= oldTop && newTop + newHeight >= oldTop + oldHeight;
+}
+
+
+// Display a string.  Returns the width of the string, like displayString()
+uint16_t TextField::display(const char *str)
+{
+  uint16_t glyphX[TEXT_FIELD_MAX_CHARS];
+  uint16_t width, left, bitmapWidth, bitmapHeight;
+  uint8_t length = strlen(str), i, firstChanged;
+  int16_t top;
+
+  // Sanity check
+  if (length > TEXT_FIELD_MAX_CHARS) {
+    printfD("TextField: too many characters in string %s\n", str);
+    length = TEXT_FIELD_MAX_CHARS;
+  }
+
+  // Where does the string go?
+  width = layoutString(_font, str, length, glyphX);
+  left = _align == TEXT_ALIGN_LEFT? _x : _align == TEXT_ALIGN_CENTER? _x - (width >> 1) : _x - width;
+  for (i=0; i < length; i++)
+    glyphX[i] += left;
+
+  // Erase the glyphs that are changing (unless the new glyph hides them), and any that
+  // are no longer needed.  Neighbouring glyphs are erased together to keep the number of
+  // fillRect's down.
+  if (_valid) {
+    firstChanged = 0xFF;
+    for (i=0; i < _length; i++) {
+      bool unchanged = i < length && _glyphX[i] == glyphX[i] && (_text[i] == str[i] || glyphCovers(_font, str[i], _text[i]));
+      if (!unchanged && firstChanged == 0xFF)
+        firstChanged = i;
+      if (unchanged && firstChanged != 0xFF) {
+        eraseGlyphs(firstChanged, i - 1);
+        firstChanged = 0xFF;
+      }
+    }
+    if (firstChanged != 0xFF)
+      eraseGlyphs(firstChanged, _length - 1);
+  }
+
+  // Draw the glyphs that changed
+  for (i=0; i < length; i++) {
+    if (_valid && i < _length && _text[i] == str[i] && _glyphX[i] == glyphX[i])
+      continue;
+    displayCharacter(_font, glyphX[i], _y, str[i]);
+
+    // Remember how far above and below y the glyphs go, so they can be erased
+    if (!getGlyphBox(_font, str[i], &top, &bitmapWidth, &bitmapHeight))
+      continue;
+    if (top < _top)
+      _top = top;
+    if (top + bitmapHeight > _bottom)
+      _bottom = top + bitmapHeight;
+  }
+
+  // Remember what is on the screen now
+  memcpy(_text, str, length);
+  _text[length] = 0;
+  memcpy(_glyphX, glyphX, length << 1);
+  _length = length;
+  _endX = left + width;
+  _valid = true;
+  return width;
+}
+
+
+// Erase glyphs first to last (inclusive), including the space between them
+void TextField::eraseGlyphs(uint8_t first, uint8_t last)
+{
+  uint16_t endX = last + 1 < _length? _glyphX[last + 1] : _endX;
+
+  if (endX > _glyphX[first] && _bottom > _top)
+    tft.fillRect(_glyphX[first], _y + _top, endX - _glyphX[first], _bottom - _top, WHITE);
+}
+
+
+// Move the field.  The text is erased if it is at a different position
+void TextField::moveTo(uint16_t x)
+{
+  if (x == _x)
+    return;
+  erase();
+  _x = x;
+}
+
+
+// The screen behind the field has been cleared, so the next display() draws everything
+void TextField::invalidate()
+{
+  _valid = false;
+  _top = 0;
+  _bottom = 0;
+}
+
+
+// Erase the text that is on the screen
+void TextField::erase()
+{
+  if (_valid && _length)
+    eraseGlyphs(0, _length - 1);
+  _length = 0;
+  _text[0] = 0;
+}
+
+
+// Is this string what the field is currently showing?
+bool TextField::isShowing(const char *str)
+{
+  return _valid && strcmp(_text, str) == 0;
+}
@@ -0,0 +1,56 @@
+// Text that is redrawn in the same place over and over (timers, status messages)
+//
+// A text field remembers what it last drew and where each glyph is.  When the text
+// changes only the glyphs that are different (or have moved) are redrawn, so a timer
+// going from "1:09" to "1:10" draws two glyphs instead of four.  A glyph is only erased
+// first if the new one doesn't hide it.
+#ifndef __TEXTFIELD_H__
+#define __TEXTFIELD_H__
+
+#include <stdint.h>
+
+// Longest string a text field can hold.  Each character costs 3 bytes of RAM.
+#ifndef TEXT_FIELD_MAX_CHARS
+#define TEXT_FIELD_MAX_CHARS            40
+#endif
+
+// What the x coordinate of a text field refers to
+#define TEXT_ALIGN_LEFT                 0
+#define TEXT_ALIGN_CENTER               1
+#define TEXT_ALIGN_RIGHT                2
+
+class TextField {
+  public:
+    TextField(uint16_t x, uint16_t y, uint8_t font, uint8_t align);
+
+    // Display a string.  Returns the width of the string, like displayString()
+    uint16_t display(const char *str);
+
+    // Move the field.  The text is erased if it is at a different position
+    void moveTo(uint16_t x);
+
+    // The screen behind the field has been cleared, so the next display() draws everything
+    void invalidate(void);
+
+    // Erase the text that is on the screen
+    void erase(void);
+
+    // Is this string what the field is currently showing?
+    bool isShowing(const char *str);
+
+  private:
+    void eraseGlyphs(uint8_t first, uint8_t last);
+
+    uint16_t _x, _y;
+    uint8_t _font;
+    uint8_t _align;
+    bool _valid;                                  // False when the screen doesn't show what is below
+    uint8_t _length;
+    char _text[TEXT_FIELD_MAX_CHARS + 1];
+    uint16_t _glyphX[TEXT_FIELD_MAX_CHARS];       // Where each glyph was drawn
+    uint16_t _endX;                               // Right edge of the last glyph
+    int8_t _top;                                  // Vertical extent of the drawn glyphs, relative to y
+    uint8_t _bottom;
+};
+
+#endif
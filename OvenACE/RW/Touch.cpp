@@ -5,6 +5,7 @@
 #include "Touch.h"
 #include "ReflowWizard.h"
 #include "Render.h"
+#include "Controleo3SD.h"
 #include "Tones.h"
 #include "Screens.h"
 #include "Prefs.h"
@@ -166,8 +167,8 @@ restart:
     // Draw some text and buttons on the screen
     displayString(21, 10, FONT_9PT_BLACK_ON_WHITE, (char *) "Draw on the screen to test calibration");
     clearTouchTargets();
-    drawTouchButton(130, 100, 220, 181, BUTTON_LARGE_FONT, (char *) "Recalibrate");
-    drawTouchButton(130, 180, 220, 82, BUTTON_LARGE_FONT, (char *) "Done");
+    drawTouchButton(130, 100, 220, BUTTON_LARGE_FONT, (char *) "Recalibrate");
+    drawTouchButton(130, 180, 220, BUTTON_LARGE_FONT, (char *) "Done");
     
     // Save the touch calibration settings immediately
     writePrefsToFlash();
@@ -343,6 +344,23 @@ void defineTouchArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 }
 
 
+// Get the number of touch areas defined so far
+uint8_t getNumberOfTouchAreas()
+{
+  return touchNumTargets;
+}
+
+
+// Get a touch area, in the form passed to defineTouchArea()
+void getTouchArea(uint8_t n, uint16_t *x, uint16_t *y, uint16_t *w, uint16_t *h)
+{
+  *x = tapTarget[n].left;
+  *y = tapTarget[n].top;
+  *w = tapTarget[n].right - tapTarget[n].left;
+  *h = tapTarget[n].bottom - tapTarget[n].top;
+}
+
+
 int8_t getTap(uint8_t mode)
 {
   int16_t x, y;
@@ -365,6 +383,12 @@ int8_t getTap(uint8_t mode)
     // See if prefs should be written to flash.  The write is time-delayed to reduce flash write cycles
     checkIfPrefsShouldBeWrittenToFlash();
 
+    // Run the LCD and SD card benchmarks ('P' and 'K' on the debug console) while the screen is waiting for a tap
+    if (mode != CHECK_FOR_TAP_THEN_EXIT) {
+      runRequestedLCDBenchmark();
+      runRequestedSDCardBenchmark();
+    }
+
     // Poll for valid tap reading
     if (!touch.read(&x, &y))  {
       // Exit if this is all the calling function wanted
@@ -32,6 +32,10 @@ void setTouchTemperatureUnitChangeCallback(void (*f) (bool displayInCelsius));
 
 void defineTouchArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 
+// Get the number of touch areas defined so far, and each one (used to save them with a screen background)
+uint8_t getNumberOfTouchAreas(void);
+void getTouchArea(uint8_t n, uint16_t *x, uint16_t *y, uint16_t *w, uint16_t *h);
+
 int8_t getTap(uint8_t mode);
 
 void touchCallback(void);
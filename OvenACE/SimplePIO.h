@@ -31,7 +31,12 @@ extern "C" {
 // Port as a bit mask. (Ignoring Port)
 #define PBITRAW(X) (1 << PRAW(X))
 
-// Port Register Access
+// Port Register Access.  The host tests (tests/host) define these themselves, so the
+// registers drive models of the LCD, flash and SD card.
+#ifndef PORT_REGISTER
+// Type of the registers, for code that keeps pointers to them
+#define PORT_REGISTER  volatile uint32_t
+
 #define PORT_DIR(X)    (PORT->Group[PGRP(X)].DIR.reg)
 #define PORT_DIRCLR(X) (PORT->Group[PGRP(X)].DIRCLR.reg)
 #define PORT_DIRSET(X) (PORT->Group[PGRP(X)].DIRSET.reg)
@@ -50,6 +55,7 @@ extern "C" {
 // Note Port Mux has two bits in a single 8 bit register.
 #define PORT_PMUX(X)   (PORT->Group[PGRP(X)].PMUX[PRAW(X)>>1].reg)
 #define PORT_PINCFG(X) (PORT->Group[PGRP(X)].PINCFG[PRAW(X)])
+#endif
 
 #define PINCFG_INPUT      (PORT_WRCONFIG_WRPINCFG | PORT_WRCONFIG_INEN)
 #define PINCFG_INPUT_PULL (PORT_WRCONFIG_WRPINCFG | PORT_WRCONFIG_PULLEN | PORT_WRCONFIG_INEN)
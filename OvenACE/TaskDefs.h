@@ -17,6 +17,10 @@ extern "C" {
 #define PIEZOTASK_STACK_SIZE (128)
 #define PIEZOTASK_PRIORITY   (tskIDLE_PRIORITY + 1)
 
+#define FLASHJOBTASK_NAME       ("FlashJob")
+#define FLASHJOBTASK_STACK_SIZE (192)
+#define FLASHJOBTASK_PRIORITY   (tskIDLE_PRIORITY + 1)
+
 
 #ifdef __cplusplus
 }
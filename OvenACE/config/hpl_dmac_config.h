@@ -2699,14 +2699,14 @@
 // <e> Channel 14 settings
 // <id> dmac_channel_14_settings
 #ifndef CONF_DMAC_CHANNEL_14_SETTINGS
-#define CONF_DMAC_CHANNEL_14_SETTINGS 0
+#define CONF_DMAC_CHANNEL_14_SETTINGS 1
 #endif
 
 // <q> Channel Enable
 // <i> Indicates whether channel 14 is enabled or not
 // <id> dmac_enable_14
 #ifndef CONF_DMAC_ENABLE_14
-#define CONF_DMAC_ENABLE_14 0
+#define CONF_DMAC_ENABLE_14 1
 #endif
 
 // <o> Trigger action
@@ -2856,7 +2856,7 @@
 // <i> Defines the size of one beat
 // <id> dmac_beatsize_14
 #ifndef CONF_DMAC_BEATSIZE_14
-#define CONF_DMAC_BEATSIZE_14 0
+#define CONF_DMAC_BEATSIZE_14 2
 #endif
 
 // <o> Block Action
@@ -19,7 +19,10 @@ extern "C" {
 
 // Read RAW CPU HZ Counter.
 // AT 48Mhz this will wrap in about 89 Seconds of run time.
+// The host tests (tests/host) count simulated time instead.
+#ifndef CPU_HZ_COUNTER
 #define CPU_HZ_COUNTER() (TC4->COUNT32.COUNT.reg)
+#endif
 
 #define millis() ((xTaskGetTickCount() * 1000)/configTICK_RATE_HZ)
 #define delay(x) vTaskDelay(x/portTICK_PERIOD_MS)
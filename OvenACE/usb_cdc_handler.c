@@ -65,6 +65,19 @@ static uint8_t usb_rx_buffer[CONF_USB_COMPOSITE_CDC_ACM_DATA_BULKIN_MAXPKSZ] __a
 
 static void PrintUSBStats(void);
 
+// Provided by the oven code (RW), which isn't always linked in.
+void PrintBitmapCacheStats(void) __attribute__((weak));
+void PrintFlashCacheStats(void) __attribute__((weak));
+void PrintFlashJobStats(void) __attribute__((weak));
+void PrintPrefsStats(void) __attribute__((weak));
+void PrintLCDStats(void) __attribute__((weak));
+void RequestLCDBenchmark(void) __attribute__((weak));
+void PrintFlashBenchmark(void) __attribute__((weak));
+void PrintScreenBackgroundStats(void) __attribute__((weak));
+void PrintSDCardStats(void) __attribute__((weak));
+void RequestSDCardBenchmark(void) __attribute__((weak));
+void PrintSDCacheStats(void) __attribute__((weak));
+
 static bool cdc_bulk_out(const uint8_t ep,            // The endpoint we are TXing to
                          const enum usb_xfer_code rc, // The status (should be USB_XFER_DONE)
 						 const uint32_t count)        // The number of bytes we just sent.
@@ -203,11 +216,81 @@ static void USB_CDC_RX_Handler_task(void *p)
 				case '?' :
 					printfD("Command List:\n");
 					printfD("  '?' = This Menu\n");
+					printfD("  'B' = Bitmap Cache Statistics\n");
+					printfD("  'C' = Flash Page Cache Statistics\n");
+					printfD("  'D' = SD Card and block cache Statistics (and reset)\n");
+					printfD("  'F' = External Flash Read Benchmark and Busy Times\n");
+					printfD("  'J' = Flash Job Queue Statistics\n");
+					printfD("  'K' = SD Card Read Benchmark (KB/s)\n");
+					printfD("  'L' = LCD Bus Statistics (and reset)\n");
 					printfD("  'M' = Memory Statistics (ram)\n");
 					printfD("  'O' = OS Statistics\n");
+					printfD("  'P' = LCD Performance Benchmark (draws over the screen)\n");
+					printfD("  'R' = Prefs Record Store and NVM Statistics\n");
+					printfD("  'S' = Screen Background Statistics (transition times)\n");
 					printfD("  'U' = USB Statistics\n");
 				break;
 
+				case 'B' :
+				case 'b' :
+					printfD("BITMAP CACHE Statistics:\n");
+					if (PrintBitmapCacheStats) {
+						PrintBitmapCacheStats();
+					}
+				break;
+
+				case 'C' :
+				case 'c' :
+					printfD("FLASH PAGE CACHE Statistics:\n");
+					if (PrintFlashCacheStats) {
+						PrintFlashCacheStats();
+					}
+				break;
+
+				case 'D' :
+				case 'd' :
+					printfD("SD CARD Statistics:\n");
+					if (PrintSDCardStats) {
+						PrintSDCardStats();
+					}
+					if (PrintSDCacheStats) {
+						PrintSDCacheStats();
+					}
+				break;
+
+				case 'F' :
+				case 'f' :
+					printfD("External FLASH Read Benchmark:\n");
+					if (PrintFlashBenchmark) {
+						PrintFlashBenchmark();
+					}
+				break;
+
+				case 'J' :
+				case 'j' :
+					printfD("FLASH JOB QUEUE Statistics:\n");
+					if (PrintFlashJobStats) {
+						PrintFlashJobStats();
+					}
+				break;
+
+				case 'K' :
+				case 'k' :
+					// The UI task uses the SD card, so it runs the benchmark when it is waiting for a tap
+					printfD("SD CARD Read Benchmark (runs when the screen is waiting for a tap):\n");
+					if (RequestSDCardBenchmark) {
+						RequestSDCardBenchmark();
+					}
+				break;
+
+				case 'L' :
+				case 'l' :
+					printfD("LCD BUS Statistics:\n");
+					if (PrintLCDStats) {
+						PrintLCDStats();
+					}
+				break;
+
 				case 'M' :
 				case 'm' :
 					printfD("MEMORY Statistics (ram):\n");
@@ -220,6 +303,31 @@ static void USB_CDC_RX_Handler_task(void *p)
 					vTaskPrintRunTimeStats();
 				break;
 
+				case 'P' :
+				case 'p' :
+					// The benchmark draws on the LCD, so the UI task runs it when it is waiting for a tap
+					printfD("LCD PERFORMANCE Benchmark (runs when the screen is waiting for a tap):\n");
+					if (RequestLCDBenchmark) {
+						RequestLCDBenchmark();
+					}
+				break;
+
+				case 'R' :
+				case 'r' :
+					printfD("PREFS RECORD STORE Statistics:\n");
+					if (PrintPrefsStats) {
+						PrintPrefsStats();
+					}
+				break;
+
+				case 'S' :
+				case 's' :
+					printfD("SCREEN BACKGROUND Statistics:\n");
+					if (PrintScreenBackgroundStats) {
+						PrintScreenBackgroundStats();
+					}
+				break;
+
 				case 'U' :
 				case 'u' :
 					printfD("USB Statistics:\n");
@@ -168,6 +168,7 @@ BUILD={
                     "-T","OvenACE/samd21a/gcc/gcc/samd21j18a_flash.ld",
                     "--relax",
                     "--gc-sections",
+                    "--build-id=sha1",  # Identifies the image (see ScreenBackgrounds.cpp)
                 ],
             }
         },
@@ -0,0 +1,349 @@
+// A FAT16 file system in RAM, to put on the SD card model
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FatImage.h"
+
+#define BLOCK_SIZE                  512
+#define PARTITION_START             2048    // 1MB in, as cards are formatted
+#define RESERVED_BLOCKS             1
+#define BLOCKS_PER_CLUSTER          4
+#define CLUSTER_SIZE                (BLOCKS_PER_CLUSTER * BLOCK_SIZE)
+#define ROOT_ENTRIES                512
+#define ROOT_BLOCKS                 (ROOT_ENTRIES * 32 / BLOCK_SIZE)
+#define ENTRY_SIZE                  32
+
+#define ATTR_DIRECTORY              0x10
+#define ATTR_ARCHIVE                0x20
+#define END_OF_CHAIN                0xFFFF
+#define DELETED                     0xE5
+
+// Directory entry fields
+#define ENTRY_ATTRIBUTES            11
+#define ENTRY_CREATION_TIME         14
+#define ENTRY_CREATION_DATE         16
+#define ENTRY_WRITE_TIME            22
+#define ENTRY_WRITE_DATE            24
+#define ENTRY_FIRST_CLUSTER         26
+#define ENTRY_SIZE_FIELD            28
+
+
+static void put16(uint8_t *p, uint16_t value)
+{
+    p[0] = value;
+    p[1] = value >> 8;
+}
+
+
+static void put32(uint8_t *p, uint32_t value)
+{
+    put16(p, value);
+    put16(p + 2, value >> 16);
+}
+
+
+static uint16_t get16(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+
+// Convert a name to the 11 characters of an 8.3 directory entry
+static void toShortName(const char *name, char *shortName)
+{
+    memset(shortName, ' ', 11);
+    for (int i=0, j=0; name[i] && j < 11; i++) {
+        if (name[i] == '.')
+            j = 8;
+        else
+            shortName[j++] = (name[i] >= 'a' && name[i] <= 'z')? name[i] - 32 : name[i];
+    }
+}
+
+
+static void setEntryTimes(uint8_t *entry, uint16_t date, uint16_t time)
+{
+    put16(entry + ENTRY_CREATION_TIME, time);
+    put16(entry + ENTRY_CREATION_DATE, date);
+    put16(entry + ENTRY_WRITE_TIME, time);
+    put16(entry + ENTRY_WRITE_DATE, date);
+}
+
+
+FatImage::FatImage(uint32_t blocks)
+{
+    totalBlocks = blocks;
+    image = (uint8_t *) calloc(blocks, BLOCK_SIZE);
+    if (!image) {
+        fprintf(stderr, "No memory for a %u block FAT image\n", blocks);
+        exit(1);
+    }
+
+    // The FATs are sized for every cluster the partition could have, which is a few more than it has
+    uint32_t partitionBlocks = blocks - PARTITION_START;
+    uint32_t fatBlocks = ((partitionBlocks / BLOCKS_PER_CLUSTER + 2) * 2 + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    clusters = (partitionBlocks - RESERVED_BLOCKS - 2 * fatBlocks - ROOT_BLOCKS) / BLOCKS_PER_CLUSTER;
+    if (clusters < 4085 || clusters > 65524) {
+        fprintf(stderr, "A %u block image can't be FAT16\n", blocks);
+        exit(1);
+    }
+
+    // MBR with one partition
+    uint8_t *mbr = image;
+    uint8_t *partition = mbr + 446;
+    partition[4] = 0x04;
+    put32(partition + 8, PARTITION_START);
+    put32(partition + 12, partitionBlocks);
+    mbr[510] = 0x55;
+    mbr[511] = 0xAA;
+
+    // Boot sector
+    uint8_t *boot = image + (uint64_t) PARTITION_START * BLOCK_SIZE;
+    memcpy(boot, "\xEB\x3C\x90MSDOS5.0", 11);
+    put16(boot + 11, BLOCK_SIZE);
+    boot[13] = BLOCKS_PER_CLUSTER;
+    put16(boot + 14, RESERVED_BLOCKS);
+    boot[16] = 2;
+    put16(boot + 17, ROOT_ENTRIES);
+    put16(boot + 19, partitionBlocks < 65536? partitionBlocks : 0);
+    boot[21] = 0xF8;
+    put16(boot + 22, fatBlocks);
+    put16(boot + 24, 63);
+    put16(boot + 26, 255);
+    put32(boot + 28, PARTITION_START);
+    put32(boot + 32, partitionBlocks < 65536? 0 : partitionBlocks);
+    boot[38] = 0x29;
+    memcpy(boot + 43, "OVEN TESTS FAT16   ", 19);
+    boot[510] = 0x55;
+    boot[511] = 0xAA;
+
+    fat[0] = boot + RESERVED_BLOCKS * BLOCK_SIZE;
+    fat[1] = fat[0] + fatBlocks * BLOCK_SIZE;
+    rootDirectory = fat[1] + fatBlocks * BLOCK_SIZE;
+    dataStart = rootDirectory + ROOT_BLOCKS * BLOCK_SIZE;
+    setFatEntry(0, 0xFFF8);
+    setFatEntry(1, END_OF_CHAIN);
+    nextFree = 2;
+}
+
+
+FatImage::~FatImage()
+{
+    free(image);
+}
+
+
+uint16_t FatImage::fatEntry(uint16_t n) const
+{
+    return get16(fat[0] + n * 2);
+}
+
+
+// Both FATs are kept the same
+void FatImage::setFatEntry(uint16_t n, uint16_t value)
+{
+    put16(fat[0] + n * 2, value);
+    put16(fat[1] + n * 2, value);
+}
+
+
+// Allocate an empty cluster, and add it to the end of a chain (if previous isn't 0)
+uint16_t FatImage::allocate(uint16_t previous)
+{
+    for (uint32_t i=0; i < clusters; i++) {
+        uint16_t n = 2 + (nextFree - 2 + i) % clusters;
+        if (fatEntry(n))
+            continue;
+        setFatEntry(n, END_OF_CHAIN);
+        if (previous)
+            setFatEntry(previous, n);
+        memset(cluster(n), 0, CLUSTER_SIZE);
+        nextFree = n + 1;
+        return n;
+    }
+    fprintf(stderr, "The FAT image is full\n");
+    exit(1);
+}
+
+
+void FatImage::freeChain(uint16_t first)
+{
+    while (first >= 2 && first < 0xFFF8) {
+        uint16_t next = fatEntry(first);
+        setFatEntry(first, 0);
+        first = next;
+    }
+}
+
+
+// Find a name in a directory (0 is the root).  If it isn't there and create is true, a free
+// entry is returned (the directory grows if it is a sub-directory).
+uint8_t *FatImage::findInDirectory(uint16_t directoryCluster, const char *name, bool create)
+{
+    char shortName[11];
+    uint8_t *freeEntry = 0;
+    uint16_t last = 0;
+
+    toShortName(name, shortName);
+    for (uint16_t n = directoryCluster; ; n = fatEntry(n)) {
+        uint8_t *entries = directoryCluster? cluster(n) : rootDirectory;
+        uint32_t count = directoryCluster? CLUSTER_SIZE / ENTRY_SIZE : ROOT_ENTRIES;
+        for (uint32_t i=0; i < count; i++) {
+            uint8_t *entry = entries + i * ENTRY_SIZE;
+            if (entry[0] == 0) {
+                if (!freeEntry)
+                    freeEntry = entry;
+                return create? freeEntry : 0;
+            }
+            if (entry[0] == DELETED) {
+                if (!freeEntry)
+                    freeEntry = entry;
+                continue;
+            }
+            if (!memcmp(entry, shortName, 11))
+                return entry;
+        }
+        last = n;
+        if (!directoryCluster || fatEntry(n) >= 0xFFF8)
+            break;
+    }
+    if (!create || freeEntry || !directoryCluster)
+        return create? freeEntry : 0;
+    return cluster(allocate(last));
+}
+
+
+// Find the directory entry for a path.  Returns 0 if it (or a directory on the way) isn't
+// there, unless create is true, when an empty entry is returned for the last name.
+uint8_t *FatImage::findEntry(const char *path, bool create, uint16_t *directoryCluster)
+{
+    char name[13];
+    uint16_t directory = 0;
+    uint8_t *entry = 0;
+
+    while (*path) {
+        while (*path == '/')
+            path++;
+        int length = 0;
+        while (path[length] && path[length] != '/' && length < 12) {
+            name[length] = path[length];
+            length++;
+        }
+        name[length] = 0;
+        path += length;
+        bool last = !path[strspn(path, "/")];
+        if (entry && !(entry[ENTRY_ATTRIBUTES] & ATTR_DIRECTORY))
+            return 0;
+        if (entry)
+            directory = get16(entry + ENTRY_FIRST_CLUSTER);
+        entry = findInDirectory(directory, name, create && last);
+        if (!entry)
+            return 0;
+        if (last)
+            break;
+    }
+    if (directoryCluster)
+        *directoryCluster = directory;
+    return entry;
+}
+
+
+bool FatImage::addDirectory(const char *path)
+{
+    uint16_t parent;
+    uint8_t *entry = findEntry(path, true, &parent);
+
+    if (!entry)
+        return false;
+    if (entry[0] && entry[0] != DELETED)
+        return (entry[ENTRY_ATTRIBUTES] & ATTR_DIRECTORY) != 0;
+
+    // The directory starts with "." and ".." (0 is the root)
+    const char *name = strrchr(path, '/')? strrchr(path, '/') + 1 : path;
+    uint16_t first = allocate(0);
+    uint8_t *dot = cluster(first);
+    memset(entry, 0, ENTRY_SIZE);
+    toShortName(name, (char *) entry);
+    entry[ENTRY_ATTRIBUTES] = ATTR_DIRECTORY;
+    setEntryTimes(entry, FAT_DATE(2020, 1, 1), FAT_TIME(12, 0, 0));
+    put16(entry + ENTRY_FIRST_CLUSTER, first);
+    memset(dot, ' ', 11);
+    dot[0] = '.';
+    dot[ENTRY_ATTRIBUTES] = ATTR_DIRECTORY;
+    put16(dot + ENTRY_FIRST_CLUSTER, first);
+    memset(dot + ENTRY_SIZE, ' ', 11);
+    dot[ENTRY_SIZE] = dot[ENTRY_SIZE + 1] = '.';
+    dot[ENTRY_SIZE + ENTRY_ATTRIBUTES] = ATTR_DIRECTORY;
+    put16(dot + ENTRY_SIZE + ENTRY_FIRST_CLUSTER, parent);
+    return true;
+}
+
+
+bool FatImage::writeFile(const char *path, const void *data, uint32_t size, uint16_t date, uint16_t time)
+{
+    uint8_t *entry = findEntry(path, true, 0);
+
+    if (!entry)
+        return false;
+    if (entry[0] && entry[0] != DELETED) {
+        if (entry[ENTRY_ATTRIBUTES] & ATTR_DIRECTORY)
+            return false;
+        freeChain(get16(entry + ENTRY_FIRST_CLUSTER));
+    }
+    else {
+        const char *name = strrchr(path, '/')? strrchr(path, '/') + 1 : path;
+        memset(entry, 0, ENTRY_SIZE);
+        toShortName(name, (char *) entry);
+        entry[ENTRY_ATTRIBUTES] = ATTR_ARCHIVE;
+    }
+
+    // The clusters are allocated in order, so a new file is contiguous
+    uint16_t first = 0, previous = 0;
+    for (uint32_t offset=0; offset < size; offset += CLUSTER_SIZE) {
+        previous = allocate(previous);
+        if (!first)
+            first = previous;
+        memcpy(cluster(previous), (const uint8_t *) data + offset, size - offset < CLUSTER_SIZE? size - offset : CLUSTER_SIZE);
+    }
+    setEntryTimes(entry, date, time);
+    put16(entry + ENTRY_FIRST_CLUSTER, first);
+    put32(entry + ENTRY_SIZE_FIELD, size);
+    return true;
+}
+
+
+bool FatImage::touch(const char *path, uint16_t date, uint16_t time)
+{
+    uint8_t *entry = findEntry(path, false, 0);
+
+    if (!entry)
+        return false;
+    put16(entry + ENTRY_WRITE_TIME, time);
+    put16(entry + ENTRY_WRITE_DATE, date);
+    return true;
+}
+
+
+int32_t FatImage::readFile(const char *path, uint8_t *buffer, uint32_t maxSize)
+{
+    uint8_t *entry = findEntry(path, false, 0);
+
+    if (!entry || (entry[ENTRY_ATTRIBUTES] & ATTR_DIRECTORY))
+        return -1;
+    uint32_t size = get16(entry + ENTRY_SIZE_FIELD) | ((uint32_t) get16(entry + ENTRY_SIZE_FIELD + 2) << 16);
+    uint16_t n = get16(entry + ENTRY_FIRST_CLUSTER);
+    for (uint32_t offset=0; offset < size && offset < maxSize; offset += CLUSTER_SIZE) {
+        if (n < 2 || n >= 0xFFF8)
+            return -1;
+        uint32_t bytes = size - offset < CLUSTER_SIZE? size - offset : CLUSTER_SIZE;
+        memcpy(buffer + offset, cluster(n), bytes < maxSize - offset? bytes : maxSize - offset);
+        n = fatEntry(n);
+    }
+    return size;
+}
+
+
+bool FatImage::fatsMatch() const
+{
+    return !memcmp(fat[0], fat[1], fat[1] - fat[0]);
+}
@@ -0,0 +1,63 @@
+// A FAT16 file system in RAM, to put on the SD card model
+//
+// The image has an MBR with one partition formatted FAT16 (2K clusters, two FATs and a
+// 512-entry root directory), like a small card formatted on a PC.  The tests add files and
+// directories before the firmware sees the card, change them between imports, and read
+// back what the firmware wrote.  Names are 8.3, and paths look like "/PROFILES/SAC305.TXT".
+#ifndef FATIMAGE_H_
+#define FATIMAGE_H_
+
+#include <stdint.h>
+
+#define FAT_IMAGE_BLOCKS            32768   // 16MB
+#define FAT_IMAGE_SIZE(blocks)      ((uint64_t) (blocks) * 512)
+
+// FAT dates and times
+#define FAT_DATE(year, month, day)  ((uint16_t) ((((year) - 1980) << 9) | ((month) << 5) | (day)))
+#define FAT_TIME(hour, minute, sec) ((uint16_t) (((hour) << 11) | ((minute) << 5) | ((sec) / 2)))
+
+
+class FatImage {
+    public:
+        FatImage(uint32_t blocks = FAT_IMAGE_BLOCKS);
+        ~FatImage();
+
+        uint8_t *data() { return image; }
+        uint32_t blocks() const { return totalBlocks; }
+
+        // Add a directory.  Its parent must be there already.
+        bool addDirectory(const char *path);
+
+        // Add a file, or replace the contents of one that is there
+        bool writeFile(const char *path, const void *data, uint32_t size, uint16_t date = FAT_DATE(2020, 1, 1),
+                       uint16_t time = FAT_TIME(12, 0, 0));
+
+        // Change the last write date and time of a file
+        bool touch(const char *path, uint16_t date, uint16_t time);
+
+        // Read a file into buffer (up to maxSize bytes).  Returns the size of the file, or -1
+        // if it isn't there.
+        int32_t readFile(const char *path, uint8_t *buffer, uint32_t maxSize);
+
+        // The two FATs are the same
+        bool fatsMatch() const;
+
+    private:
+        uint8_t *image;
+        uint32_t totalBlocks;
+        uint8_t *fat[2];                    // The FATs
+        uint8_t *rootDirectory;
+        uint8_t *dataStart;                 // Cluster 2
+        uint32_t clusters;
+        uint16_t nextFree;
+
+        uint8_t *cluster(uint16_t n) { return dataStart + (uint32_t) (n - 2) * 2048; }
+        uint16_t fatEntry(uint16_t n) const;
+        void setFatEntry(uint16_t n, uint16_t value);
+        uint16_t allocate(uint16_t previous);
+        void freeChain(uint16_t first);
+        uint8_t *findEntry(const char *path, bool create, uint16_t *directoryCluster);
+        uint8_t *findInDirectory(uint16_t directoryCluster, const char *name, bool create);
+};
+
+#endif // FATIMAGE_H_
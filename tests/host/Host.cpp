@@ -0,0 +1,404 @@
+// Host build of the firmware: simulated time, and stubs for FreeRTOS, the HAL and BitBash.S
+//
+// There is only one thread.  Tasks are never started, so code that checks whether a task
+// is running (startFlashJobs(), for example) does its work straight away.  Mutexes and
+// semaphores are always available.  DMA transfers are done when the firmware waits for
+// them (see hostRunDMA).
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "hpl_dma.h"
+#include "SimplePIO.h"
+#include "bits.h"
+#include "BitBash.h"
+#include "rtos_support.h"
+#include "Host.h"
+#include "HostPort.h"
+
+static uint64_t cycles = 0;
+
+
+uint32_t hostCycles()
+{
+    // Reading TC4's COUNT takes a few cycles
+    cycles += 4;
+    return (uint32_t) cycles;
+}
+
+
+uint64_t hostCycleCount()
+{
+    return cycles;
+}
+
+
+uint64_t hostMicros()
+{
+    return cycles / HOST_CPU_MHZ;
+}
+
+
+void hostAdvanceCycles(uint32_t n)
+{
+    cycles += n;
+}
+
+
+void delayMicroseconds(uint16_t us)
+{
+    cycles += (uint64_t) us * HOST_CPU_MHZ;
+}
+
+
+// printfD() prints to stdout unless hostQuiet is set.  Longs are 32 bits on the SAMD21, so
+// "%lu" is printed as "%u".
+bool hostQuiet = false;
+
+extern "C" int printfD(const char *format, ...)
+{
+    char hostFormat[256];
+    size_t j = 0;
+    bool inSpec = false;
+    va_list args;
+
+    if (hostQuiet)
+        return 0;
+    for (size_t i=0; format[i] && j < sizeof(hostFormat) - 1; i++) {
+        if (inSpec && format[i] == 'l')
+            continue;
+        if (format[i] == '%')
+            inSpec = !inSpec;
+        else if (inSpec && strchr("diouxXcspf", format[i]))
+            inSpec = false;
+        hostFormat[j++] = format[i];
+    }
+    hostFormat[j] = 0;
+
+    va_start(args, format);
+    int n = vprintf(hostFormat, args);
+    va_end(args);
+    return n;
+}
+
+
+// FreeRTOS.  A tick is 1ms.
+
+static uint8_t hostTask;                // Handle of the one task
+
+TickType_t xTaskGetTickCount()
+{
+    return (TickType_t) (cycles / (HOST_CPU_MHZ * 1000));
+}
+
+
+void vTaskDelay(const TickType_t ticks)
+{
+    hostRunDMA();
+    cycles += (uint64_t) ticks * HOST_CPU_MHZ * 1000;
+}
+
+
+void vTaskSuspendAll() {}
+BaseType_t xTaskResumeAll() { return pdFALSE; }
+void vPortEnterCritical() {}
+void vPortExitCritical() {}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    return (TaskHandle_t) &hostTask;
+}
+
+
+// Tasks are never started
+BaseType_t xTaskCreate(TaskFunction_t code, const char * const name, const configSTACK_DEPTH_TYPE stackDepth,
+                       void * const parameters, UBaseType_t priority, TaskHandle_t * const createdTask)
+{
+    (void) code; (void) name; (void) stackDepth; (void) parameters; (void) priority;
+    if (createdTask)
+        *createdTask = 0;
+    return pdFAIL;
+}
+
+
+uint32_t ulTaskNotifyTake(BaseType_t clearCountOnExit, TickType_t ticksToWait)
+{
+    (void) clearCountOnExit; (void) ticksToWait;
+    return 1;
+}
+
+
+BaseType_t xTaskGenericNotify(TaskHandle_t task, uint32_t value, eNotifyAction action, uint32_t *previousValue)
+{
+    (void) task; (void) value; (void) action; (void) previousValue;
+    return pdPASS;
+}
+
+
+// Semaphores and mutexes.  The handles just need to be different from 0.
+static uint8_t hostQueue;
+
+QueueHandle_t xQueueCreateMutex(const uint8_t queueType)
+{
+    (void) queueType;
+    return (QueueHandle_t) &hostQueue;
+}
+
+
+QueueHandle_t xQueueGenericCreate(const UBaseType_t length, const UBaseType_t itemSize, const uint8_t queueType)
+{
+    (void) length; (void) itemSize; (void) queueType;
+    return (QueueHandle_t) &hostQueue;
+}
+
+
+BaseType_t xQueueTakeMutexRecursive(QueueHandle_t mutex, TickType_t ticksToWait)
+{
+    (void) mutex; (void) ticksToWait;
+    return pdPASS;
+}
+
+
+BaseType_t xQueueGiveMutexRecursive(QueueHandle_t mutex)
+{
+    (void) mutex;
+    return pdPASS;
+}
+
+
+// Waiting for a semaphore lets a DMA transfer finish
+BaseType_t xQueueSemaphoreTake(QueueHandle_t queue, TickType_t ticksToWait)
+{
+    (void) queue; (void) ticksToWait;
+    hostRunDMA();
+    return pdPASS;
+}
+
+
+BaseType_t xQueueGenericSend(QueueHandle_t queue, const void * const item, TickType_t ticksToWait, const BaseType_t copyPosition)
+{
+    (void) queue; (void) item; (void) ticksToWait; (void) copyPosition;
+    return pdPASS;
+}
+
+
+BaseType_t xQueueGiveFromISR(QueueHandle_t queue, BaseType_t * const higherPriorityTaskWoken)
+{
+    (void) queue;
+    if (higherPriorityTaskWoken)
+        *higherPriorityTaskWoken = pdFALSE;
+    return pdPASS;
+}
+
+
+// The heap.  Blocks are counted against hostHeapSize so the firmware can size its caches
+// from the free heap, as it does on the board.
+size_t hostHeapSize = 16384;
+static size_t heapUsed = 0, heapMostUsed = 0;
+
+void *pvPortMalloc(size_t size)
+{
+    if (heapUsed + size + sizeof(size_t) > hostHeapSize)
+        return NULL;
+    size_t *block = (size_t *) calloc(1, size + sizeof(size_t));
+    *block = size + sizeof(size_t);
+    heapUsed += *block;
+    if (heapUsed > heapMostUsed)
+        heapMostUsed = heapUsed;
+    return block + 1;
+}
+
+
+void vPortFree(void *p)
+{
+    if (!p)
+        return;
+    size_t *block = (size_t *) p - 1;
+    heapUsed -= *block;
+    free(block);
+}
+
+
+size_t xPortGetFreeHeapSize()
+{
+    return hostHeapSize - heapUsed;
+}
+
+
+size_t xPortGetMinimumEverFreeHeapSize()
+{
+    return hostHeapSize - heapMostUsed;
+}
+
+
+// Symbols from the linker script
+extern "C" {
+int __bss_end;
+int *__brkval;
+uint32_t _sfixed, _etext;
+}
+
+// Servo.cpp uses portBMode, which nothing defines.  The ARM build drops the function with
+// --gc-sections.
+PORT_REGISTER *portBMode = &PORT_DIR(PB(0));
+
+__asm__(".data\n"
+        ".globl __build_id_start\n"
+        ".globl __build_id_end\n"
+        "__build_id_start: .ascii \"host build\"\n"
+        "__build_id_end:\n"
+        ".text\n");
+
+
+// DMA.  A transfer is started by _dma_enable_transaction() and done by hostRunDMA(), which
+// writes each beat to the destination (a PORT register) and then calls the transfer done
+// callback, as the DMAC interrupt would.  Only fixed addresses and 32-bit beats are used.
+
+#define HOST_DMA_CHANNELS           16
+
+struct hostDMAChannel {
+    struct _dma_resource resource;
+    const uint32_t *source;
+    HostPortRegister *destination;
+    uint32_t beats;
+    bool pending;
+};
+
+static hostDMAChannel dmaChannels[HOST_DMA_CHANNELS];
+bool hostDMAWriting = false;
+
+
+int32_t _dma_get_channel_resource(struct _dma_resource **resource, const uint8_t channel)
+{
+    *resource = &dmaChannels[channel].resource;
+    return 0;
+}
+
+
+void _dma_set_irq_state(const uint8_t channel, const enum _dma_callback_type type, const bool state)
+{
+    (void) channel; (void) type; (void) state;
+}
+
+
+int32_t _dma_set_source_address(const uint8_t channel, const void *const src)
+{
+    dmaChannels[channel].source = (const uint32_t *) src;
+    return 0;
+}
+
+
+int32_t _dma_set_destination_address(const uint8_t channel, const void *const dst)
+{
+    dmaChannels[channel].destination = (HostPortRegister *) dst;
+    return 0;
+}
+
+
+int32_t _dma_set_data_amount(const uint8_t channel, const uint32_t amount)
+{
+    dmaChannels[channel].beats = amount;
+    return 0;
+}
+
+
+int32_t _dma_enable_transaction(const uint8_t channel, const bool softwareTrigger)
+{
+    (void) softwareTrigger;
+    dmaChannels[channel].pending = true;
+    return 0;
+}
+
+
+bool hostDMAPending()
+{
+    for (uint8_t i=0; i < HOST_DMA_CHANNELS; i++)
+        if (dmaChannels[i].pending)
+            return true;
+    return false;
+}
+
+
+// Do the pending transfers.  A callback can start another one, which is done too.
+void hostRunDMA()
+{
+    static bool running = false;
+
+    if (running)
+        return;
+    running = true;
+    for (uint8_t i=0; i < HOST_DMA_CHANNELS; i++) {
+        hostDMAChannel *channel = &dmaChannels[i];
+        while (channel->pending) {
+            channel->pending = false;
+            hostDMAWriting = true;
+            for (uint32_t beat=0; beat < channel->beats; beat++)
+                *channel->destination = *channel->source;
+            hostDMAWriting = false;
+            if (channel->resource.dma_cb.transfer_done)
+                channel->resource.dma_cb.transfer_done(&channel->resource);
+        }
+    }
+    running = false;
+}
+
+
+// BitBash.S.  The SD card routines send and receive bytes on the same pins as Sd2Card's C
+// versions, so the SD card model sees them.  The flash read is the same as readQuad() in
+// Controleo3Flash.cpp.  The LCD routines aren't needed because the host build doesn't
+// define LCD_ASM.
+
+#define SD_CLK                      SETBIT05
+#define SD_MOSI                     SETBIT06
+#define SD_MISO                     SETBIT04
+#define FLASH_CLK                   SETBIT13
+
+void TX_SDCARD(uint8_t byte)
+{
+    for (uint8_t i=0; i < 8; i++) {
+        if (byte & 0x80)
+            PORT_OUTSET(PA(0)) = SD_MOSI;
+        else
+            PORT_OUTCLR(PA(0)) = SD_MOSI;
+        byte <<= 1;
+        PORT_OUTSET(PA(0)) = SD_CLK;
+        PORT_OUTCLR(PA(0)) = SD_CLK;
+    }
+}
+
+
+uint8_t RX_SDCARD()
+{
+    uint8_t byte = 0;
+
+    PORT_OUTSET(PA(0)) = SD_MOSI;
+    for (uint8_t i=0; i < 8; i++) {
+        PORT_OUTSET(PA(0)) = SD_CLK;
+        byte = (byte << 1) | ((PORT_IN(PA(0)) & SD_MISO)? 1 : 0);
+        PORT_OUTCLR(PA(0)) = SD_CLK;
+    }
+    return byte;
+}
+
+
+void RX_SDCARD_BLOCK(uint8_t *dest, uint32_t len)
+{
+    while (len--)
+        *dest++ = RX_SDCARD();
+}
+
+
+void FLASH_READ_QUAD(uint8_t *dest, uint32_t len)
+{
+    while (len--) {
+        PORT_OUTCLR(PA(0)) = FLASH_CLK;
+        PORT_OUTSET(PA(0)) = FLASH_CLK;
+        *dest = (PORT_IN(PA(0)) & 0x000F0000) >> 12;
+        PORT_OUTCLR(PA(0)) = FLASH_CLK;
+        PORT_OUTSET(PA(0)) = FLASH_CLK;
+        *dest++ += (PORT_IN(PA(0)) & 0x000F0000) >> 16;
+    }
+}
@@ -0,0 +1,94 @@
+// Host build of the firmware (see README.md)
+//
+// This file is included before every firmware source file (gcc -include).  It replaces
+// the PORT registers with models of the devices on the pins (see HostPort.cpp), and the
+// TC4 cycle counter with simulated time.  Everything else - FreeRTOS, the HAL and the
+// assembly routines in BitBash.S - is stubbed in Host.cpp.
+#ifndef HOST_H_
+#define HOST_H_
+
+#define HOST_TEST
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Simulated time.  The clock runs at 48MHz, the same as the SAMD21.  It only moves
+// when the firmware touches a register, reads the cycle counter, or delays.
+#define HOST_CPU_MHZ        48
+
+uint32_t hostCycles(void);
+uint64_t hostCycleCount(void);
+uint64_t hostMicros(void);
+void hostAdvanceCycles(uint32_t cycles);
+
+// Finish the DMA transfers that have been started (see Host.cpp)
+void hostRunDMA(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define CPU_HZ_COUNTER()    hostCycles()
+
+// The CMSIS intrinsics are Cortex-M instructions.  They are compiled out (NVIC_SystemReset()
+// is in Screens.cpp)
+#define __ASM               if (0) __asm
+
+#ifdef __cplusplus
+
+// A PORT register.  Writes update the pins and tell the devices on them (see HostPort.h);
+// reads of IN return the pins the devices are driving.
+class HostPortRegister {
+    public:
+        HostPortRegister(uint8_t group, uint8_t type) : group(group), type(type) {}
+        void operator=(uint32_t value);
+        void operator|=(uint32_t value);
+        void operator&=(uint32_t value);
+        operator uint32_t() const;
+
+    private:
+        uint8_t group, type;
+        HostPortRegister(const HostPortRegister &);
+        void operator=(const HostPortRegister &);
+};
+
+struct HostPortGroup {
+    HostPortRegister DIR, DIRCLR, DIRSET, DIRTGL, OUT, OUTCLR, OUTSET, OUTTGL, IN;
+    HostPortGroup(uint8_t group);
+};
+
+// The registers that aren't modelled (pin configuration) are plain memory, used as two
+// PortGroups
+extern HostPortGroup hostPort[2];
+extern uint32_t hostPortConfig[];
+
+#define PORT_REGISTER       HostPortRegister
+
+// Other parts of the host build
+extern bool hostQuiet;              // Don't print printfD() output
+extern bool hostDMAWriting;         // The DMA is writing to a register
+extern size_t hostHeapSize;         // Size of the FreeRTOS heap
+bool hostDMAPending(void);
+
+#define PORT_DIR(X)         (hostPort[PGRP(X)].DIR)
+#define PORT_DIRCLR(X)      (hostPort[PGRP(X)].DIRCLR)
+#define PORT_DIRSET(X)      (hostPort[PGRP(X)].DIRSET)
+#define PORT_DIRTGL(X)      (hostPort[PGRP(X)].DIRTGL)
+#define PORT_OUT(X)         (hostPort[PGRP(X)].OUT)
+#define PORT_OUTCLR(X)      (hostPort[PGRP(X)].OUTCLR)
+#define PORT_OUTSET(X)      (hostPort[PGRP(X)].OUTSET)
+#define PORT_OUTTGL(X)      (hostPort[PGRP(X)].OUTTGL)
+#define PORT_IN(X)          (hostPort[PGRP(X)].IN)
+
+#define PORT_CTRL(X)        (((PortGroup *) hostPortConfig)[PGRP(X)].CTRL.reg)
+#define PORT_WRCFG(X)       (((PortGroup *) hostPortConfig)[PGRP(X)].WRCONFIG.reg)
+#define PORT_PMUX(X)        (((PortGroup *) hostPortConfig)[PGRP(X)].PMUX[PRAW(X)>>1].reg)
+#define PORT_PINCFG(X)      (((PortGroup *) hostPortConfig)[PGRP(X)].PINCFG[PRAW(X)])
+
+#endif // __cplusplus
+
+#endif // HOST_H_
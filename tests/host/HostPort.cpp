@@ -0,0 +1,129 @@
+// Models of the PORT peripheral and the devices wired to its pins
+#include "samd21.h"
+#include "HostPort.h"
+#include <vector>
+#include <algorithm>
+
+// Register types
+#define REG_DIR                     0
+#define REG_DIRCLR                  1
+#define REG_DIRSET                  2
+#define REG_DIRTGL                  3
+#define REG_OUT                     4
+#define REG_OUTCLR                  5
+#define REG_OUTSET                  6
+#define REG_OUTTGL                  7
+#define REG_IN                      8
+
+HostPortGroup::HostPortGroup(uint8_t group) :
+    DIR(group, REG_DIR), DIRCLR(group, REG_DIRCLR), DIRSET(group, REG_DIRSET), DIRTGL(group, REG_DIRTGL),
+    OUT(group, REG_OUT), OUTCLR(group, REG_OUTCLR), OUTSET(group, REG_OUTSET), OUTTGL(group, REG_OUTTGL),
+    IN(group, REG_IN)
+{
+}
+
+HostPortGroup hostPort[2] = {{HOST_PORTA}, {HOST_PORTB}};
+uint32_t hostPortConfig[sizeof(PortGroup) * 2 / sizeof(uint32_t)];
+uint32_t hostPortAccesses = 0;
+
+static uint32_t portOut[2], portDir[2];
+static std::vector<HostPortDevice *> devices;
+
+
+void attachPortDevice(HostPortDevice *device)
+{
+    devices.push_back(device);
+}
+
+
+void detachPortDevice(HostPortDevice *device)
+{
+    devices.erase(std::remove(devices.begin(), devices.end(), device), devices.end());
+}
+
+
+uint32_t hostPortOut(uint8_t group)
+{
+    return portOut[group];
+}
+
+
+uint32_t hostPortDir(uint8_t group)
+{
+    return portDir[group];
+}
+
+
+void resetHostPort()
+{
+    portOut[HOST_PORTA] = portOut[HOST_PORTB] = 0;
+    portDir[HOST_PORTA] = portDir[HOST_PORTB] = 0;
+    hostPortAccesses = 0;
+}
+
+
+// Change the outputs of a group, and tell the devices
+static void setOutputs(uint8_t group, uint32_t out)
+{
+    uint32_t changed = portOut[group] ^ out;
+
+    portOut[group] = out;
+    if (!changed)
+        return;
+    // A device may detach itself (or another) when it sees the change
+    std::vector<HostPortDevice *> attached = devices;
+    for (HostPortDevice *device : attached)
+        device->outputsChanged(group, out, changed);
+}
+
+
+void HostPortRegister::operator=(uint32_t value)
+{
+    hostPortAccesses++;
+    hostAdvanceCycles(HOST_PORT_ACCESS_CYCLES);
+    switch (type) {
+        case REG_DIR:       portDir[group] = value; break;
+        case REG_DIRCLR:    portDir[group] &= ~value; break;
+        case REG_DIRSET:    portDir[group] |= value; break;
+        case REG_DIRTGL:    portDir[group] ^= value; break;
+        case REG_OUT:       setOutputs(group, value); break;
+        case REG_OUTCLR:    setOutputs(group, portOut[group] & ~value); break;
+        case REG_OUTSET:    setOutputs(group, portOut[group] | value); break;
+        case REG_OUTTGL:    setOutputs(group, portOut[group] ^ value); break;
+        case REG_IN:        break;  // Read-only
+    }
+}
+
+
+// Read-modify-write (only makes sense for OUT and DIR)
+void HostPortRegister::operator|=(uint32_t value)
+{
+    *this = (uint32_t) *this | value;
+}
+
+
+void HostPortRegister::operator&=(uint32_t value)
+{
+    *this = (uint32_t) *this & value;
+}
+
+
+HostPortRegister::operator uint32_t() const
+{
+    hostPortAccesses++;
+    hostAdvanceCycles(HOST_PORT_ACCESS_CYCLES);
+    switch (type) {
+        case REG_DIR: case REG_DIRCLR: case REG_DIRSET: case REG_DIRTGL:
+            return portDir[group];
+        case REG_IN: {
+            uint32_t in = portOut[group];
+            for (HostPortDevice *device : devices) {
+                uint32_t levels = 0, mask = device->drivenPins(group, &levels);
+                in = (in & ~mask) | (levels & mask);
+            }
+            return in;
+        }
+        default:
+            return portOut[group];
+    }
+}
@@ -0,0 +1,46 @@
+// Models of the PORT peripheral and the devices wired to its pins
+//
+// The firmware writes the pins through HostPortRegister (see Host.h).  Each write updates
+// OUT or DIR and tells the attached devices which outputs changed, so a device sees every
+// edge the real chip would.  Reads of IN return OUT, except for the pins a device is
+// driving.
+#ifndef HOSTPORT_H_
+#define HOSTPORT_H_
+
+#include <stdint.h>
+
+#define HOST_PORTA                  0
+#define HOST_PORTB                  1
+
+// Cycles taken by a PORT register access through the APB bridge (approximate)
+#define HOST_PORT_ACCESS_CYCLES     2
+
+
+class HostPortDevice {
+    public:
+        virtual ~HostPortDevice() {}
+
+        // Some of the outputs of a port group changed
+        virtual void outputsChanged(uint8_t group, uint32_t out, uint32_t changed) = 0;
+
+        // The pins of a port group that this device is driving.  Returns a mask of the
+        // pins, and sets levels to their values.
+        virtual uint32_t drivenPins(uint8_t group, uint32_t *levels) { (void) group; (void) levels; return 0; }
+};
+
+
+// Connect a device to the pins.  Devices are told about changes in the order they were attached
+void attachPortDevice(HostPortDevice *device);
+void detachPortDevice(HostPortDevice *device);
+
+// The current outputs and directions of a port group
+uint32_t hostPortOut(uint8_t group);
+uint32_t hostPortDir(uint8_t group);
+
+// Set all outputs low and all pins to inputs (a reset)
+void resetHostPort(void);
+
+// Number of register accesses since the last reset
+extern uint32_t hostPortAccesses;
+
+#endif // HOSTPORT_H_
@@ -0,0 +1,53 @@
+// Checks for the host tests
+//
+// Each test program runs its checks and returns testResult() from main().  Failed checks
+// are printed with the file and line, and the program carries on.
+#ifndef HOSTTEST_H_
+#define HOSTTEST_H_
+
+#include <stdio.h>
+
+static unsigned int testChecks, testFailures;
+
+#define CHECK(condition)            testCheck((condition), #condition, __FILE__, __LINE__)
+#define CHECK_EQUAL(actual, expected) \
+    testCheckEqual((unsigned long) (actual), (unsigned long) (expected), #actual, __FILE__, __LINE__)
+
+
+static inline bool testCheck(bool passed, const char *condition, const char *file, int line)
+{
+    testChecks++;
+    if (!passed) {
+        testFailures++;
+        printf("%s:%d: FAILED: %s\n", file, line, condition);
+    }
+    return passed;
+}
+
+
+static inline bool testCheckEqual(unsigned long actual, unsigned long expected, const char *name, const char *file, int line)
+{
+    testChecks++;
+    if (actual != expected) {
+        testFailures++;
+        printf("%s:%d: FAILED: %s is %lu, expected %lu\n", file, line, name, actual, expected);
+    }
+    return actual == expected;
+}
+
+
+// Start a group of checks
+static inline void testStart(const char *name)
+{
+    printf("%s\n", name);
+}
+
+
+// Print the summary, and return the exit status for main()
+static inline int testResult(const char *program)
+{
+    printf("%s: %u checks, %u failed\n", program, testChecks, testFailures);
+    return testFailures? 1 : 0;
+}
+
+#endif // HOSTTEST_H_
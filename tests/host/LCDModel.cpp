@@ -0,0 +1,383 @@
+// Model of the ILI9488 LCD controller on its 8-bit 8080 bus
+#include <stdio.h>
+#include <string.h>
+#include "Host.h"
+#include "LCDModel.h"
+
+// Pins on PORTB
+#define PINS_DATA                   0xFFUL
+#define PIN_RD                      (1UL << 12)
+#define PIN_WR                      (1UL << 13)
+#define PIN_CD                      (1UL << 14)
+#define PIN_CS                      (1UL << 15)
+#define PIN_RESET                   (1UL << 16)
+#define PINS_LCD                    (PINS_DATA | PIN_RD | PIN_WR | PIN_CD | PIN_CS | PIN_RESET)
+
+// Commands
+#define CMD_SOFTRESET               0x01
+#define CMD_READ_DISPLAY_INFO       0x04
+#define CMD_SLEEPIN                 0x10
+#define CMD_SLEEPOUT                0x11
+#define CMD_NORMAL                  0x13
+#define CMD_INVERTOFF               0x20
+#define CMD_INVERTON                0x21
+#define CMD_PIXELSOFF               0x22
+#define CMD_PIXELSON                0x23
+#define CMD_DISPLAYOFF              0x28
+#define CMD_DISPLAYON               0x29
+#define CMD_COLADDRSET              0x2A
+#define CMD_PAGEADDRSET             0x2B
+#define CMD_MEMORYWRITE             0x2C
+#define CMD_MEMORYREAD              0x2E
+#define CMD_MADCTL                  0x36
+#define CMD_PIXELFORMAT             0x3A
+
+#define MADCTL_MV                   0x20
+#define PIXELFORMAT_DBI_16BIT       0x05
+#define PIXELFORMAT_DBI_MASK        0x07
+
+// Time needed after a reset or sleep out before the next command
+#define READY_CYCLES                ((uint64_t) 5000 * HOST_CPU_MHZ)
+
+static const uint8_t displayID[] = {0x54, 0x80, 0x66};
+
+
+LCDModel::LCDModel()
+{
+    lastOut = hostPortOut(HOST_PORTB);
+    dataChanged = true;
+    fill(0);
+    reset();
+    readyAt = 0;
+    resetStatistics();
+    attachPortDevice(this);
+}
+
+
+LCDModel::~LCDModel()
+{
+    detachPortDevice(this);
+}
+
+
+void LCDModel::resetStatistics()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+
+uint32_t LCDModel::violations() const
+{
+    return stats.unknownCommands + stats.tooSoon + stats.badWindows + stats.overruns + stats.partialPixels + stats.pixelFormat +
+           stats.dataSetup + stats.busContention + stats.dmaConflicts;
+}
+
+
+void LCDModel::printStatistics()
+{
+    uint32_t commands = 0;
+
+    for (uint16_t i=0; i < 256; i++)
+        commands += stats.commands[i];
+    printf("  Transactions %u, commands %u (windows %u), bytes written %u (strobes %u), pixels %u, bytes read %u\n",
+           stats.transactions, commands, stats.commands[CMD_COLADDRSET], stats.bytesWritten, stats.strobes, stats.pixelsWritten,
+           stats.bytesRead);
+    if (violations())
+        printf("  Violations: unknown=%u tooSoon=%u window=%u overrun=%u partial=%u format=%u setup=%u contention=%u dma=%u\n",
+               stats.unknownCommands, stats.tooSoon, stats.badWindows, stats.overruns, stats.partialPixels, stats.pixelFormat,
+               stats.dataSetup, stats.busContention, stats.dmaConflicts);
+}
+
+
+void LCDModel::fill(uint16_t color)
+{
+    for (uint16_t y=0; y < LCD_MODEL_HEIGHT; y++)
+        for (uint16_t x=0; x < LCD_MODEL_WIDTH; x++)
+            framebuffer[y][x] = color;
+}
+
+
+// CRC32 (IEEE 802.3) of the pixels, low byte first
+uint32_t LCDModel::crc() const
+{
+    const uint8_t *p = (const uint8_t *) framebuffer;
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (size_t i=0; i < sizeof(framebuffer); i++) {
+        crc ^= p[i];
+        for (uint8_t bit=0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+
+bool LCDModel::writePPM(const char *file) const
+{
+    FILE *f = fopen(file, "wb");
+
+    if (!f) {
+        perror(file);
+        return false;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", LCD_MODEL_WIDTH, LCD_MODEL_HEIGHT);
+    for (uint16_t y=0; y < LCD_MODEL_HEIGHT; y++)
+        for (uint16_t x=0; x < LCD_MODEL_WIDTH; x++) {
+            uint16_t p = framebuffer[y][x];
+            uint8_t rgb[3] = {(uint8_t) ((p >> 11) * 255 / 31), (uint8_t) (((p >> 5) & 0x3F) * 255 / 63), (uint8_t) ((p & 0x1F) * 255 / 31)};
+            fwrite(rgb, 1, 3, f);
+        }
+    return fclose(f) == 0;
+}
+
+
+void LCDModel::outputsChanged(uint8_t group, uint32_t out, uint32_t changed)
+{
+    uint32_t previous = lastOut;
+
+    if (group != HOST_PORTB)
+        return;
+    lastOut = out;
+    if ((changed & PINS_LCD) && !hostDMAWriting && hostDMAPending())
+        stats.dmaConflicts++;
+
+    if (changed & PIN_RESET) {
+        if (out & PIN_RESET)
+            readyAt = hostCycleCount() + READY_CYCLES;
+        else
+            reset();
+    }
+    if (changed & PIN_CS) {
+        if (out & PIN_CS) {
+            stats.transactions++;
+            driving = false;
+        }
+    }
+    if ((out & PIN_CS) || !(out & PIN_RESET)) {
+        dataChanged |= (changed & PINS_DATA) != 0;
+        return;
+    }
+
+    // Commands and data are latched when WR rises.  CD only has to be valid until then,
+    // but the data lines have to be set up before.
+    if ((changed & PIN_WR) && (out & PIN_WR)) {
+        uint8_t byte = previous & PINS_DATA;
+        if (changed & PINS_DATA)
+            stats.dataSetup++;
+        if (previous & PIN_CD) {
+            stats.bytesWritten++;
+            if (!dataChanged)
+                stats.strobes++;
+            writeData(byte);
+        }
+        else
+            writeCommand(byte);
+        dataChanged = (changed & PINS_DATA) != 0;
+    }
+    else
+        dataChanged |= (changed & PINS_DATA) != 0;
+
+    // Each read starts when RD falls
+    if ((changed & PIN_RD) && !(out & PIN_RD) && (out & PIN_CD))
+        readNext();
+    else if ((changed & PIN_RD) && (out & PIN_RD))
+        driving = false;
+}
+
+
+uint32_t LCDModel::drivenPins(uint8_t group, uint32_t *levels)
+{
+    if (group != HOST_PORTB || !driving)
+        return 0;
+    if (hostPortDir(HOST_PORTB) & PINS_DATA)
+        stats.busContention++;
+    *levels = drivenByte;
+    return PINS_DATA;
+}
+
+
+// A hardware or software reset.  The framebuffer keeps what was on it.
+void LCDModel::reset()
+{
+    madctl = 0;
+    pixelFormat = 0x66;
+    startColumn = startPage = 0;
+    endColumn = LCD_MODEL_HEIGHT - 1;
+    endPage = LCD_MODEL_WIDTH - 1;
+    command = 0;
+    parameterBytes = 0;
+    column = page = 0;
+    highByteLatched = false;
+    windowFull = false;
+    reading = false;
+    driving = false;
+}
+
+
+void LCDModel::writeCommand(uint8_t byte)
+{
+    if (highByteLatched) {
+        stats.partialPixels++;
+        highByteLatched = false;
+    }
+    if (hostCycleCount() < readyAt)
+        stats.tooSoon++;
+    stats.commands[byte]++;
+    command = byte;
+    parameterBytes = 0;
+    reading = false;
+    driving = false;
+
+    switch (byte) {
+        case CMD_SOFTRESET:
+            reset();
+            readyAt = hostCycleCount() + READY_CYCLES;
+            break;
+        case CMD_SLEEPOUT:
+            readyAt = hostCycleCount() + READY_CYCLES;
+            break;
+        case CMD_MEMORYWRITE:
+            column = startColumn;
+            page = startPage;
+            windowFull = false;
+            break;
+        case CMD_MEMORYREAD:
+        case CMD_READ_DISPLAY_INFO:
+            column = startColumn;
+            page = startPage;
+            windowFull = false;
+            reading = true;
+            readIndex = 0;
+            break;
+        case CMD_SLEEPIN: case CMD_NORMAL: case CMD_INVERTOFF: case CMD_INVERTON: case CMD_PIXELSOFF: case CMD_PIXELSON:
+        case CMD_DISPLAYOFF: case CMD_DISPLAYON: case CMD_COLADDRSET: case CMD_PAGEADDRSET: case CMD_MADCTL: case CMD_PIXELFORMAT:
+            break;
+        default:
+            stats.unknownCommands++;
+            break;
+    }
+}
+
+
+void LCDModel::writeData(uint8_t byte)
+{
+    switch (command) {
+        case CMD_COLADDRSET:
+        case CMD_PAGEADDRSET: {
+            if (parameterBytes >= 4)
+                break;
+            parameters[parameterBytes++] = byte;
+            if (parameterBytes < 4)
+                break;
+            uint16_t start = (parameters[0] << 8) | parameters[1], end = (parameters[2] << 8) | parameters[3];
+            bool columns = command == CMD_COLADDRSET;
+            uint16_t size = (columns == ((madctl & MADCTL_MV) != 0))? LCD_MODEL_WIDTH : LCD_MODEL_HEIGHT;
+            if (start > end || end >= size)
+                stats.badWindows++;
+            if (columns) {
+                startColumn = start;
+                endColumn = end;
+            }
+            else {
+                startPage = start;
+                endPage = end;
+            }
+            break;
+        }
+        case CMD_MADCTL:
+            if (parameterBytes++ == 0)
+                madctl = byte;
+            break;
+        case CMD_PIXELFORMAT:
+            if (parameterBytes++ == 0)
+                pixelFormat = byte;
+            break;
+        case CMD_MEMORYWRITE:
+            if (!highByteLatched) {
+                highByte = byte;
+                highByteLatched = true;
+                break;
+            }
+            highByteLatched = false;
+            writePixel((highByte << 8) | byte);
+            break;
+        default:
+            break;
+    }
+}
+
+
+void LCDModel::writePixel(uint16_t color)
+{
+    if ((pixelFormat & PIXELFORMAT_DBI_MASK) != PIXELFORMAT_DBI_16BIT) {
+        stats.pixelFormat++;
+        return;
+    }
+    if (windowFull)
+        stats.overruns++;
+    uint16_t *p = pixelAt(column, page);
+    if (p)
+        *p = color;
+    stats.pixelsWritten++;
+    nextPixel();
+}
+
+
+// Put the next read byte on the data lines.  The first byte after the command is a dummy
+// byte.  Pixels are read as red, green and blue bytes with 6 bits each.
+void LCDModel::readNext()
+{
+    stats.bytesRead++;
+    if (!reading) {
+        drivenByte = 0;
+        driving = true;
+        return;
+    }
+    uint32_t index = readIndex++;
+    if (index == 0)
+        drivenByte = 0;
+    else if (command == CMD_READ_DISPLAY_INFO)
+        drivenByte = index <= sizeof(displayID)? displayID[index - 1] : 0;
+    else {
+        if ((index - 1) % 3 == 0) {
+            if (windowFull)
+                stats.overruns++;
+            uint16_t *p = pixelAt(column, page), color = p? *p : 0;
+            uint8_t red = color >> 11, green = (color >> 5) & 0x3F, blue = color & 0x1F;
+            readBytes[0] = ((red << 1) | (red >> 4)) << 2;
+            readBytes[1] = green << 2;
+            readBytes[2] = ((blue << 1) | (blue >> 4)) << 2;
+            nextPixel();
+        }
+        drivenByte = readBytes[(index - 1) % 3];
+    }
+    driving = true;
+}
+
+
+// Move to the next pixel in the window.  After the last one it goes back to the first.
+void LCDModel::nextPixel()
+{
+    if (column++ < endColumn)
+        return;
+    column = startColumn;
+    if (page++ < endPage)
+        return;
+    page = startPage;
+    windowFull = true;
+}
+
+
+// Where a pixel is in the framebuffer.  Without MV the columns go down the screen.
+uint16_t *LCDModel::pixelAt(uint16_t column, uint16_t page)
+{
+    uint16_t x = column, y = page;
+
+    if (!(madctl & MADCTL_MV)) {
+        x = page;
+        y = column;
+    }
+    if (x >= LCD_MODEL_WIDTH || y >= LCD_MODEL_HEIGHT)
+        return 0;
+    return &framebuffer[y][x];
+}
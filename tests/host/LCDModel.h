@@ -0,0 +1,103 @@
+// Model of the ILI9488 LCD controller on its 8-bit 8080 bus
+//
+// The model is wired to the LCD pins on PORTB (D0-D7 PB0-PB7, RD PB12, WR PB13, CD PB14,
+// CS PB15, RESET PB16) and decodes what Controleo3LCD sends: commands and data are latched
+// on the rising edge of WR, and reads are driven onto D0-D7 from the falling edge of RD.
+// Pixels written with MEMORYWRITE go into a 480x320 framebuffer through the window set with
+// COLADDRSET and PAGEADDRSET, and MEMORYREAD reads them back (3 bytes a pixel, as the
+// ILI9488 does).  MADCTL's MV bit (row/column exchange) is followed, so the framebuffer is
+// the screen as the firmware sees it once begin() has set MV.
+//
+// Bytes latched with only WR toggled (the data lines haven't changed since the last byte)
+// are counted separately as strobes.  Anything the real controller would ignore or get
+// wrong is counted as a violation: commands too soon after a reset or sleep out, windows
+// off the screen, more pixels than the window holds, half pixels, pixels that aren't
+// 16-bit, data changing at the same time as WR, and the CPU touching the LCD pins while a
+// DMA transfer to them is pending.
+#ifndef LCDMODEL_H_
+#define LCDMODEL_H_
+
+#include <stdint.h>
+#include "HostPort.h"
+
+#define LCD_MODEL_WIDTH             480
+#define LCD_MODEL_HEIGHT            320
+
+
+class LCDModel : public HostPortDevice {
+    public:
+        struct Statistics {
+            uint32_t transactions;          // CS went active, then idle
+            uint32_t commands[256];         // Number of each command
+            uint32_t bytesWritten;          // Data bytes latched, including strobes
+            uint32_t strobes;               // Data bytes latched by just toggling WR
+            uint32_t pixelsWritten;
+            uint32_t bytesRead;             // Data bytes read (including dummy bytes)
+
+            // Violations
+            uint32_t unknownCommands;
+            uint32_t tooSoon;               // Commands within 5ms of a reset or sleep out
+            uint32_t badWindows;            // Start after the end, or off the screen
+            uint32_t overruns;              // Pixels written or read past the end of the window
+            uint32_t partialPixels;         // A command after half a pixel
+            uint32_t pixelFormat;           // Pixels written when the format isn't 16-bit
+            uint32_t dataSetup;             // The data lines changed at the same time as WR rose
+            uint32_t busContention;         // The SAMD21 driving the data lines during a read
+            uint32_t dmaConflicts;          // The CPU changed an LCD pin while a DMA transfer was pending
+        };
+        Statistics stats;
+
+        // A black screen, and attach the LCD to the pins
+        LCDModel();
+        ~LCDModel();
+
+        void resetStatistics();
+        uint32_t violations() const;
+        void printStatistics();
+
+        // The pixels (RGB565), as the firmware addresses them
+        uint16_t pixel(uint16_t x, uint16_t y) const { return framebuffer[y][x]; }
+        void fill(uint16_t color);
+
+        // CRC32 of the framebuffer (for golden images), and the framebuffer as a PPM file
+        uint32_t crc() const;
+        bool writePPM(const char *file) const;
+
+        // HostPortDevice
+        void outputsChanged(uint8_t group, uint32_t out, uint32_t changed);
+        uint32_t drivenPins(uint8_t group, uint32_t *levels);
+
+    private:
+        uint16_t framebuffer[LCD_MODEL_HEIGHT][LCD_MODEL_WIDTH];
+        uint32_t lastOut;
+        bool dataChanged;                   // Since the last byte was latched
+
+        // Registers
+        uint8_t madctl, pixelFormat;
+        uint16_t startColumn, endColumn, startPage, endPage;
+        uint64_t readyAt;                   // Cycle count when commands can be sent again
+
+        // The current command
+        uint8_t command;
+        uint16_t parameterBytes;
+        uint8_t parameters[4];
+        uint16_t column, page;
+        bool windowFull;                    // The last pixel of the window has been written or read
+        bool highByteLatched;
+        uint8_t highByte;
+        bool reading;
+        uint8_t readBytes[3];
+        uint32_t readIndex;
+        bool driving;
+        uint8_t drivenByte;
+
+        void reset();
+        void writeCommand(uint8_t byte);
+        void writeData(uint8_t byte);
+        void writePixel(uint16_t color);
+        void readNext();
+        void nextPixel();
+        uint16_t *pixelAt(uint16_t column, uint16_t page);
+};
+
+#endif // LCDMODEL_H_
@@ -0,0 +1,112 @@
+// Model of the SAMD21 NVM rows used for the hot prefs (see NVMModel.h)
+#include <string.h>
+#include "NVMModel.h"
+
+NVMModel *NVMModel::attached = 0;
+const nvmPrefsStorage NVMModel::storage = {0, NVMModel::eraseRow, NVMModel::writePage};
+
+
+NVMModel::NVMModel()
+{
+    memset(rows, 0xFF, sizeof(rows));
+    operationsUntilPowerCut = 0;
+    powerCutSeed = 1;
+    poweredOff = false;
+    resetStatistics();
+    attach();
+}
+
+
+NVMModel::~NVMModel()
+{
+    if (attached == this) {
+        attached = 0;
+        setNVMPrefsStorage(0);
+    }
+}
+
+
+void NVMModel::resetStatistics()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+
+void NVMModel::attach()
+{
+    static nvmPrefsStorage modelStorage;
+
+    attached = this;
+    modelStorage = storage;
+    modelStorage.base = rows;
+    setNVMPrefsStorage(&modelStorage);
+}
+
+
+void NVMModel::cutPowerAfter(uint32_t operations, uint32_t seed)
+{
+    operationsUntilPowerCut = operations;
+    powerCutSeed = seed? seed : 1;
+}
+
+
+// Does the power go in the middle of this operation?
+bool NVMModel::powerCut()
+{
+    if (!operationsUntilPowerCut || --operationsUntilPowerCut)
+        return false;
+    poweredOff = true;
+    return true;
+}
+
+
+// xorshift32, seeded by cutPowerAfter()
+uint8_t NVMModel::random()
+{
+    powerCutSeed ^= powerCutSeed << 13;
+    powerCutSeed ^= powerCutSeed >> 17;
+    powerCutSeed ^= powerCutSeed << 5;
+    return (uint8_t) powerCutSeed;
+}
+
+
+// Set every bit in the row.  With a power cut, only some bits are set.
+void NVMModel::eraseRow(uint16_t row)
+{
+    NVMModel *nvm = attached;
+    uint8_t *p = nvm->rows + row * NVMCTRL_ROW_SIZE;
+
+    if (nvm->poweredOff)
+        return;
+    if (nvm->powerCut()) {
+        for (uint16_t i=0; i < NVMCTRL_ROW_SIZE; i++)
+            p[i] |= nvm->random();
+        return;
+    }
+    memset(p, 0xFF, NVMCTRL_ROW_SIZE);
+    nvm->stats.rowErases++;
+    nvm->stats.erasesOfRow[row]++;
+}
+
+
+// Clear the bits that are 0 in the data.  With a power cut, only some of them are cleared.
+void NVMModel::writePage(uint16_t page, const uint32_t *src)
+{
+    NVMModel *nvm = attached;
+    uint8_t *p = nvm->rows + page * NVMCTRL_PAGE_SIZE;
+    const uint8_t *data = (const uint8_t *) src;
+
+    if (nvm->poweredOff)
+        return;
+    bool powerCut = nvm->powerCut();
+    for (uint8_t i=0; i < NVMCTRL_PAGE_SIZE; i++) {
+        uint8_t clear = p[i] & ~data[i];
+        if (powerCut)
+            clear &= nvm->random();
+        else
+            nvm->stats.unerasedBits += __builtin_popcount(~p[i] & data[i] & 0xFF);
+        p[i] &= ~clear;
+    }
+    if (!powerCut)
+        nvm->stats.pagesWritten++;
+}
@@ -0,0 +1,60 @@
+// Model of the SAMD21 NVM rows that NVMPrefs.cpp keeps the hot prefs in
+//
+// The rows are in RAM and passed to setNVMPrefsStorage().  Like the real NVM, an erase sets a
+// row to 0xFF and a page write can only clear bits.  Writing a page that isn't erased is
+// counted as a violation.  The power can be cut part way through an erase or a write.
+#ifndef NVMMODEL_H_
+#define NVMMODEL_H_
+
+#include <stdint.h>
+#include "NVMPrefs.h"
+#include "samd21.h"
+
+#define NVM_MODEL_SIZE              (NVM_PREFS_ROWS * NVMCTRL_ROW_SIZE)
+
+
+class NVMModel {
+    public:
+        struct Statistics {
+            uint32_t rowErases;
+            uint32_t erasesOfRow[NVM_PREFS_ROWS];
+            uint32_t pagesWritten;
+
+            // Violations
+            uint32_t unerasedBits;          // Bits written to 1 that were already 0
+        };
+        Statistics stats;
+
+        // Erased rows, used by NVMPrefs.cpp
+        NVMModel();
+        ~NVMModel();
+
+        uint8_t *memory() { return rows; }
+        void resetStatistics();
+
+        // Use these rows again, as at startup: NVMPrefs.cpp forgets the records it found
+        void attach();
+
+        // Cut the power part way through the Nth row erase or page write from now (1 = the
+        // next one).  The row or page is left partly erased or written (chosen with seed), and
+        // later erases and writes do nothing until powerOn().
+        void cutPowerAfter(uint32_t operations, uint32_t seed);
+        bool isPoweredOff() const { return poweredOff; }
+        void powerOn() { poweredOff = false; }
+
+    private:
+        uint8_t rows[NVM_MODEL_SIZE];
+        uint32_t operationsUntilPowerCut;
+        uint32_t powerCutSeed;
+        bool poweredOff;
+
+        bool powerCut();
+        uint8_t random();
+
+        static NVMModel *attached;
+        static void eraseRow(uint16_t row);
+        static void writePage(uint16_t page, const uint32_t *src);
+        static const nvmPrefsStorage storage;
+};
+
+#endif // NVMMODEL_H_
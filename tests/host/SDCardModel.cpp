@@ -0,0 +1,485 @@
+// Model of an SDHC card in SPI mode, holding an image in RAM
+#include <stdio.h>
+#include <string.h>
+#include "Host.h"
+#include "SDCardModel.h"
+
+// Pins on PORTA
+#define PIN_MISO                    (1UL << 4)
+#define PIN_CLK                     (1UL << 5)
+#define PIN_MOSI                    (1UL << 6)
+#define PIN_CS                      (1UL << 7)
+
+// Commands
+#define CMD_GO_IDLE_STATE           0
+#define CMD_SEND_IF_COND            8
+#define CMD_SEND_CSD                9
+#define CMD_SEND_CID                10
+#define CMD_STOP_TRANSMISSION       12
+#define CMD_SEND_STATUS             13
+#define CMD_READ_BLOCK              17
+#define CMD_READ_MULTIPLE_BLOCK     18
+#define CMD_WRITE_BLOCK             24
+#define CMD_WRITE_MULTIPLE_BLOCK    25
+#define CMD_ERASE_WR_BLK_START      32
+#define CMD_ERASE_WR_BLK_END        33
+#define CMD_ERASE                   38
+#define CMD_APP_CMD                 55
+#define CMD_READ_OCR                58
+#define ACMD_SET_WR_BLK_ERASE_COUNT 23
+#define ACMD_SD_SEND_OP_COND        41
+
+// R1 bits
+#define R1_READY                    0x00
+#define R1_IDLE                     0x01
+#define R1_ILLEGAL_COMMAND          0x04
+#define R1_ADDRESS_ERROR            0x20
+
+// Tokens
+#define TOKEN_START_BLOCK           0xFE
+#define TOKEN_WRITE_MULTIPLE        0xFC
+#define TOKEN_STOP_TRAN             0xFD
+#define DATA_ACCEPTED               0x05
+
+#define MICROS_TO_CYCLES(x)         ((uint64_t) (x) * HOST_CPU_MHZ)
+
+//                                                     read   program  erase
+const SDCardModel::Timing SDCardModel::typical =      {250,   500,     2000};
+
+static const uint8_t cid[16] = {0x03, 'S', 'D', 'H', 'O', 'S', 'T', '1', 0x10, 0x12, 0x34, 0x56, 0x78, 0x01, 0x4A, 0x01};
+
+
+// CRC16 (CCITT) of the data in a block, as the card sends it after the data
+static uint16_t crc16(const uint8_t *data, uint32_t length)
+{
+    uint16_t crc = 0;
+
+    while (length--) {
+        crc ^= *data++ << 8;
+        for (uint8_t bit=0; bit < 8; bit++)
+            crc = (crc & 0x8000)? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+
+SDCardModel::SDCardModel(uint8_t *image, uint32_t blocks)
+{
+    this->image = image;
+    this->blocks = blocks;
+    timing = typical;
+    selected = false;
+    inputByte = inputBits = 0;
+    outputByte = 0xFF;
+    commandLength = 0;
+    appCommand = false;
+    initialized = false;
+    responseLength = responsePosition = 0;
+    busyUntil = 0;
+    state = STATE_IDLE;
+    preErased = 0;
+    eraseStart = eraseEnd = 0;
+    resetStatistics();
+    attachPortDevice(this);
+}
+
+
+SDCardModel::~SDCardModel()
+{
+    detachPortDevice(this);
+}
+
+
+void SDCardModel::resetStatistics()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+
+uint32_t SDCardModel::violations() const
+{
+    return stats.unknownCommands + stats.busyCommands + stats.streamCommands + stats.badStops + stats.badTokens + stats.outOfRange +
+           stats.unwrittenBlocks + stats.busContention;
+}
+
+
+uint32_t SDCardModel::commandCount() const
+{
+    uint32_t count = 0;
+
+    for (uint8_t i=0; i < 64; i++)
+        count += stats.commands[i] + stats.appCommands[i];
+    return count;
+}
+
+
+void SDCardModel::printStatistics()
+{
+    printf("  Transactions %u, commands %u (CMD17 %u, CMD18 %u, CMD24 %u, CMD25 %u, CMD12 %u, ACMD23 %u), bytes %u\n",
+           stats.transactions, commandCount(), stats.commands[CMD_READ_BLOCK], stats.commands[CMD_READ_MULTIPLE_BLOCK],
+           stats.commands[CMD_WRITE_BLOCK], stats.commands[CMD_WRITE_MULTIPLE_BLOCK], stats.commands[CMD_STOP_TRANSMISSION],
+           stats.appCommands[ACMD_SET_WR_BLK_ERASE_COUNT], stats.bytes);
+    printf("  Blocks read %u, written %u, pre-erased %u, erased %u\n", stats.blocksRead, stats.blocksWritten, stats.preErasedBlocks,
+           stats.blocksErased);
+    if (violations())
+        printf("  Violations: unknown=%u busy=%u stream=%u badStop=%u token=%u range=%u unwritten=%u contention=%u\n",
+               stats.unknownCommands, stats.busyCommands, stats.streamCommands, stats.badStops, stats.badTokens, stats.outOfRange,
+               stats.unwrittenBlocks, stats.busContention);
+}
+
+
+void SDCardModel::outputsChanged(uint8_t group, uint32_t out, uint32_t changed)
+{
+    if (group != HOST_PORTA)
+        return;
+    if (changed & PIN_CS) {
+        if (out & PIN_CS)
+            deselect();
+        else
+            select();
+    }
+    if (!selected || !(changed & PIN_CLK) || !(out & PIN_CLK))
+        return;
+
+    // SPI mode 0: MOSI is sampled on the rising edge.  The card's output for the whole byte
+    // is chosen when its first bit is clocked, before the byte it is answering is in.
+    if (inputBits == 0)
+        outputByte = nextOutputByte();
+    else
+        outputByte <<= 1;
+    inputByte = (inputByte << 1) | ((out & PIN_MOSI)? 1 : 0);
+    if (++inputBits == 8) {
+        inputBits = 0;
+        stats.bytes++;
+        receiveByte(inputByte);
+    }
+}
+
+
+// MISO has a pull-up, so it is high when the card isn't selected
+uint32_t SDCardModel::drivenPins(uint8_t group, uint32_t *levels)
+{
+    if (group != HOST_PORTA)
+        return 0;
+    if (hostPortDir(HOST_PORTA) & PIN_MISO)
+        stats.busContention++;
+    *levels = (!selected || (outputByte & 0x80))? PIN_MISO : 0;
+    return PIN_MISO;
+}
+
+
+void SDCardModel::select()
+{
+    selected = true;
+    inputByte = inputBits = 0;
+    outputByte = 0xFF;
+}
+
+
+// The card keeps its state (an open multi-block transfer carries on when it is selected
+// again), but a partly clocked byte is lost
+void SDCardModel::deselect()
+{
+    selected = false;
+    stats.transactions++;
+    inputBits = 0;
+    commandLength = 0;
+    outputByte = 0xFF;
+}
+
+
+// The byte the card sends next
+uint8_t SDCardModel::nextOutputByte()
+{
+    uint64_t now = hostCycleCount();
+
+    if (responsePosition < responseLength)
+        return response[responsePosition++];
+    if (now < busyUntil)
+        return 0x00;
+
+    if (state != STATE_READ)
+        return 0xFF;
+    if (dataPosition < 0) {
+        // At least one 0xFF goes before the token, however soon the block is found
+        if (!sentGap || now < readyAt) {
+            sentGap = true;
+            return 0xFF;
+        }
+        dataPosition = 0;
+        stats.blocksRead++;
+        return TOKEN_START_BLOCK;
+    }
+    const uint8_t *data = image + (uint64_t) block * SD_MODEL_BLOCK_SIZE;
+    uint8_t byte;
+    if (dataPosition < SD_MODEL_BLOCK_SIZE)
+        byte = data[dataPosition];
+    else {
+        uint16_t crc = crc16(data, SD_MODEL_BLOCK_SIZE);
+        byte = dataPosition == SD_MODEL_BLOCK_SIZE? crc >> 8 : crc & 0xFF;
+    }
+    if (++dataPosition < SD_MODEL_BLOCK_SIZE + 2)
+        return byte;
+
+    // The next block of a multi-block read follows on its own
+    if (multiBlock && block + 1 < blocks) {
+        block++;
+        dataPosition = -1;
+        sentGap = false;
+        readyAt = now + MICROS_TO_CYCLES(timing.readBlock);
+    }
+    else
+        state = STATE_IDLE;
+    return byte;
+}
+
+
+void SDCardModel::receiveByte(uint8_t byte)
+{
+    // Data for a write
+    if (state == STATE_WRITE && commandLength == 0) {
+        receiveWriteData(byte);
+        return;
+    }
+
+    // Commands start with 01 and are 6 bytes long.  Anything else between them is ignored.
+    if (commandLength == 0 && (byte & 0xC0) != 0x40)
+        return;
+    commandBytes[commandLength++] = byte;
+    if (commandLength == 6) {
+        commandLength = 0;
+        doCommand();
+    }
+}
+
+
+void SDCardModel::receiveWriteData(uint8_t byte)
+{
+    if (dataPosition < 0) {
+        if (byte == 0xFF)
+            return;
+        if (multiBlock && byte == TOKEN_STOP_TRAN) {
+            endWrite();
+            return;
+        }
+        if (byte != (multiBlock? TOKEN_WRITE_MULTIPLE : TOKEN_START_BLOCK)) {
+            // A command byte during a multi-block write
+            if ((byte & 0xC0) == 0x40) {
+                stats.streamCommands++;
+                commandBytes[0] = byte;
+                commandLength = 1;
+                endWrite();
+                return;
+            }
+            stats.badTokens++;
+            return;
+        }
+        dataPosition = 0;
+        return;
+    }
+
+    writeBuffer[dataPosition++] = byte;
+    if (dataPosition < SD_MODEL_BLOCK_SIZE + 2)
+        return;
+
+    // The CRC isn't checked (CRCs are off in SPI mode)
+    memcpy(image + (uint64_t) block * SD_MODEL_BLOCK_SIZE, writeBuffer, SD_MODEL_BLOCK_SIZE);
+    stats.blocksWritten++;
+    if (preErased)
+        preErased--;
+    static const uint8_t accepted[] = {DATA_ACCEPTED};
+    respond(accepted, 1);
+    busyUntil = hostCycleCount() + MICROS_TO_CYCLES(timing.programBlock);
+    dataPosition = -1;
+    if (!multiBlock || ++block == blocks)
+        state = STATE_IDLE;
+}
+
+
+// A multi-block write ends with the stop token (or a command that shouldn't be there)
+void SDCardModel::endWrite()
+{
+    if (preErased) {
+        stats.unwrittenBlocks += preErased;
+        preErased = 0;
+    }
+    state = STATE_IDLE;
+}
+
+
+void SDCardModel::doCommand()
+{
+    uint8_t cmd = commandBytes[0] & 0x3F;
+    uint32_t arg = ((uint32_t) commandBytes[1] << 24) | ((uint32_t) commandBytes[2] << 16) | (commandBytes[3] << 8) | commandBytes[4];
+    bool app = appCommand;
+
+    appCommand = false;
+    if (app)
+        stats.appCommands[cmd]++;
+    else
+        stats.commands[cmd]++;
+    if (hostCycleCount() < busyUntil)
+        stats.busyCommands++;
+
+    // CMD12 stops a read.  The byte after it is a stuff byte, then the response.
+    if (!app && cmd == CMD_STOP_TRANSMISSION) {
+        if (state != STATE_READ || !multiBlock)
+            stats.badStops++;
+        state = STATE_IDLE;
+        static const uint8_t stopped[] = {0xFF, 0xFF, R1_READY};
+        respond(stopped, sizeof(stopped));
+        return;
+    }
+    // Any other command ends a read (a multi-block read should have been stopped first)
+    if (state == STATE_READ) {
+        if (multiBlock)
+            stats.streamCommands++;
+        state = STATE_IDLE;
+    }
+
+    if (app) {
+        switch (cmd) {
+            case ACMD_SD_SEND_OP_COND:
+                // Initialization takes one ACMD41 that says it is still idle
+                respondR1(initialized? R1_READY : R1_IDLE);
+                initialized = true;
+                break;
+            case ACMD_SET_WR_BLK_ERASE_COUNT:
+                preErased = arg & 0x7FFFFF;
+                stats.preErasedBlocks += preErased;
+                respondR1(R1_READY);
+                break;
+            default:
+                stats.unknownCommands++;
+                respondR1(R1_ILLEGAL_COMMAND);
+                break;
+        }
+        return;
+    }
+
+    uint8_t idle = initialized? R1_READY : R1_IDLE;
+    switch (cmd) {
+        case CMD_GO_IDLE_STATE:
+            initialized = false;
+            preErased = 0;
+            respondR1(R1_IDLE);
+            break;
+        case CMD_SEND_IF_COND: {
+            const uint8_t r7[] = {0xFF, R1_IDLE, 0x00, 0x00, (uint8_t) ((arg >> 8) & 0x0F), (uint8_t) arg};
+            respond(r7, sizeof(r7));
+            break;
+        }
+        case CMD_READ_OCR: {
+            // Powered up, and high capacity
+            const uint8_t r3[] = {0xFF, idle, 0xC0, 0xFF, 0x80, 0x00};
+            respond(r3, sizeof(r3));
+            break;
+        }
+        case CMD_SEND_CSD:
+        case CMD_SEND_CID: {
+            // CSD version 2: the size is in 512K units, and single blocks can be erased
+            uint32_t size = blocks / 1024 - 1;
+            uint8_t csd[16] = {0x40, 0x0E, 0x00, 0x32, 0x5B, 0x59, 0x00, (uint8_t) ((size >> 16) & 0x3F), (uint8_t) (size >> 8),
+                               (uint8_t) size, 0x7F, 0x80, 0x0A, 0x40, 0x00, 0x01};
+            uint8_t r[22] = {0xFF, idle, 0xFF, TOKEN_START_BLOCK};
+            memcpy(r + 4, cmd == CMD_SEND_CSD? csd : cid, 16);
+            uint16_t crc = crc16(r + 4, 16);
+            r[20] = crc >> 8;
+            r[21] = crc;
+            respond(r, sizeof(r));
+            break;
+        }
+        case CMD_SEND_STATUS: {
+            const uint8_t r2[] = {0xFF, idle, 0x00};
+            respond(r2, sizeof(r2));
+            break;
+        }
+        case CMD_READ_BLOCK:
+        case CMD_READ_MULTIPLE_BLOCK:
+            if (!validBlock(arg)) {
+                respondR1(R1_ADDRESS_ERROR);
+                break;
+            }
+            respondR1(R1_READY);
+            startRead(arg, cmd == CMD_READ_MULTIPLE_BLOCK);
+            break;
+        case CMD_WRITE_BLOCK:
+        case CMD_WRITE_MULTIPLE_BLOCK:
+            if (!validBlock(arg)) {
+                respondR1(R1_ADDRESS_ERROR);
+                break;
+            }
+            respondR1(R1_READY);
+            state = STATE_WRITE;
+            multiBlock = cmd == CMD_WRITE_MULTIPLE_BLOCK;
+            block = arg;
+            dataPosition = -1;
+            if (!multiBlock)
+                preErased = 0;
+            break;
+        case CMD_ERASE_WR_BLK_START:
+        case CMD_ERASE_WR_BLK_END:
+            if (!validBlock(arg)) {
+                respondR1(R1_ADDRESS_ERROR);
+                break;
+            }
+            if (cmd == CMD_ERASE_WR_BLK_START)
+                eraseStart = arg;
+            else
+                eraseEnd = arg;
+            respondR1(R1_READY);
+            break;
+        case CMD_ERASE:
+            respondR1(R1_READY);
+            if (eraseEnd >= eraseStart) {
+                memset(image + (uint64_t) eraseStart * SD_MODEL_BLOCK_SIZE, 0, (uint64_t) (eraseEnd - eraseStart + 1) * SD_MODEL_BLOCK_SIZE);
+                stats.blocksErased += eraseEnd - eraseStart + 1;
+            }
+            busyUntil = hostCycleCount() + MICROS_TO_CYCLES(timing.eraseBlocks);
+            break;
+        case CMD_APP_CMD:
+            appCommand = true;
+            respondR1(idle);
+            break;
+        default:
+            stats.unknownCommands++;
+            respondR1(R1_ILLEGAL_COMMAND);
+            break;
+    }
+}
+
+
+// Responses come after one byte of 0xFF, which is part of the bytes given
+void SDCardModel::respond(const uint8_t *bytes, uint8_t length)
+{
+    memcpy(response, bytes, length);
+    responseLength = length;
+    responsePosition = 0;
+}
+
+
+void SDCardModel::respondR1(uint8_t r1)
+{
+    const uint8_t r[] = {0xFF, r1};
+    respond(r, sizeof(r));
+}
+
+
+void SDCardModel::startRead(uint32_t address, bool multiple)
+{
+    state = STATE_READ;
+    multiBlock = multiple;
+    block = address;
+    dataPosition = -1;
+    sentGap = false;
+    readyAt = hostCycleCount() + MICROS_TO_CYCLES(timing.readBlock);
+}
+
+
+bool SDCardModel::validBlock(uint32_t address)
+{
+    if (address < blocks)
+        return true;
+    stats.outOfRange++;
+    return false;
+}
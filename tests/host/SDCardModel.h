@@ -0,0 +1,119 @@
+// Model of an SDHC card in SPI mode, holding an image in RAM
+//
+// The model is wired to the SD card pins on PORTA (MISO PA4, CLK PA5, MOSI PA6, CS PA7) and
+// decodes the commands Sd2Card sends, bit by bit (SPI mode 0): going idle, the interface
+// condition, ACMD41, the OCR, CSD and CID, single and multi-block reads and writes, ACMD23
+// pre-erase, CMD12 and the stop token, the status and erases.  Finding a block and
+// programming one take the times in Timing, in simulated time, and the card sends 0xFF
+// (or holds MISO low while busy) until then.  A multi-block read finds each block in the
+// same time as a single block read, so any time it saves comes from the commands.
+//
+// Anything a real card would reject or leave undefined is counted as a violation: unknown
+// commands, commands in the middle of a multi-block transfer or while busy, CMD12 with no
+// read to stop, bad data tokens, blocks past the end of the card, and pre-erased blocks
+// that were never written.
+#ifndef SDCARDMODEL_H_
+#define SDCARDMODEL_H_
+
+#include <stdint.h>
+#include "HostPort.h"
+
+#define SD_MODEL_BLOCK_SIZE         512
+
+
+class SDCardModel : public HostPortDevice {
+    public:
+        // How long the card takes, in microseconds.  The SD specification only gives limits
+        // (100ms to read a block and 250ms to write one for SDHC); these are closer to a
+        // cheap card.
+        struct Timing {
+            uint32_t readBlock;             // From a read command (or the end of the last block of a CMD18) to the data
+            uint32_t programBlock;          // Busy after a block is written
+            uint32_t eraseBlocks;           // Busy after CMD38
+        };
+        static const Timing typical;
+
+        struct Statistics {
+            uint32_t transactions;          // CS went active, then idle
+            uint32_t commands[64];          // Number of each command (CMD55 included)
+            uint32_t appCommands[64];       // Number of each ACMD
+            uint32_t bytes;                 // Bytes clocked with CS active
+            uint32_t blocksRead;            // Blocks sent (including any cut short)
+            uint32_t blocksWritten;
+            uint32_t blocksErased;          // By CMD38
+            uint32_t preErasedBlocks;       // Asked for with ACMD23
+
+            // Violations
+            uint32_t unknownCommands;
+            uint32_t busyCommands;          // Commands while the card is programming or erasing
+            uint32_t streamCommands;        // Commands other than CMD12 or the stop token during a multi-block transfer
+            uint32_t badStops;              // CMD12 with no read open
+            uint32_t badTokens;             // Data tokens that don't match the write command
+            uint32_t outOfRange;            // Blocks past the end of the card
+            uint32_t unwrittenBlocks;       // Pre-erased with ACMD23, but the write stopped before them
+            uint32_t busContention;         // The SAMD21 driving MISO
+        };
+        Statistics stats;
+
+        // The image is blocks * 512 bytes.  It belongs to the caller and is read and written in place.
+        SDCardModel(uint8_t *image, uint32_t blocks);
+        ~SDCardModel();
+
+        void setTiming(const Timing &timing) { this->timing = timing; }
+        void resetStatistics();
+        uint32_t violations() const;
+        // Total commands, including CMD55 before each ACMD
+        uint32_t commandCount() const;
+        void printStatistics();
+
+        // HostPortDevice
+        void outputsChanged(uint8_t group, uint32_t out, uint32_t changed);
+        uint32_t drivenPins(uint8_t group, uint32_t *levels);
+
+    private:
+        // What the card is doing between commands
+        enum State {STATE_IDLE, STATE_READ, STATE_WRITE};
+
+        uint8_t *image;
+        uint32_t blocks;
+        Timing timing;
+
+        // The bus
+        bool selected;
+        uint8_t inputByte, inputBits;
+        uint8_t outputByte;
+
+        // The command being received, and the response to the last one
+        uint8_t commandBytes[6];
+        uint8_t commandLength;
+        bool appCommand;
+        bool initialized;
+        uint8_t response[24];
+        uint8_t responseLength, responsePosition;
+        uint64_t busyUntil;
+
+        // Block transfers
+        State state;
+        bool multiBlock;
+        uint32_t block;                     // Block being read or written
+        int16_t dataPosition;               // -1 waiting for the token, then the data and CRC
+        bool sentGap;                       // At least one 0xFF went before the read token
+        uint64_t readyAt;                   // When the block being read is found
+        uint8_t writeBuffer[SD_MODEL_BLOCK_SIZE + 2];
+        uint32_t preErased;                 // ACMD23 count for the next CMD25
+        uint32_t eraseStart, eraseEnd;
+
+        void select();
+        void deselect();
+        uint8_t nextOutputByte();
+        void receiveByte(uint8_t byte);
+        void receiveWriteData(uint8_t byte);
+        void doCommand();
+        void respond(const uint8_t *bytes, uint8_t length);
+        void respondR1(uint8_t r1);
+        void startRead(uint32_t address, bool multiple);
+        void endWrite();
+        bool validBlock(uint32_t address);
+};
+
+#endif // SDCARDMODEL_H_
@@ -0,0 +1,81 @@
+// Bitmaps for the host tests
+#include "ReflowWizard.h"
+#include "FlashProvision.h"
+#include "TestBitmaps.h"
+#include "Bitmaps.h"
+
+struct testBitmapReader {
+    uint16_t bitmapNumber;
+    uint32_t offset;                    // Bytes supplied so far
+};
+
+
+void getTestBitmapSize(uint16_t bitmapNumber, uint16_t *width, uint16_t *height)
+{
+    static const uint16_t fixedWidthDigits[] = {FONT_FIRST_9PT_BW_FIXED, FONT_FIRST_12PT_BW_FIXED, FONT_FIRST_22PT_BW_FIXED};
+
+    // The digits of a fixed-width font are all the size of the ones in microcontroller flash
+    for (uint16_t first : fixedWidthDigits) {
+        if (bitmapNumber < first || bitmapNumber >= first + 10)
+            continue;
+        *width = 6 + first % 9;
+        *height = 10 + first % 7;
+        for (uint16_t i=first; i < first + 10; i++)
+            if (flashBitmaps[i]) {
+                *width = flashBitmaps[i][0] >> 8;
+                *height = flashBitmaps[i][0] & 0xFF;
+                break;
+            }
+        return;
+    }
+    if (bitmapNumber < FONT_IMAGES) {
+        *width = 6 + bitmapNumber % 9;
+        *height = 10 + bitmapNumber % 7;
+    }
+    else {
+        *width = 40 + (bitmapNumber % 5) * 8;
+        *height = 30 + (bitmapNumber % 3) * 10;
+    }
+}
+
+
+uint16_t getTestBitmapPixel(uint16_t bitmapNumber, uint32_t pixel)
+{
+    uint16_t width, height;
+
+    getTestBitmapSize(bitmapNumber, &width, &height);
+    uint16_t x = pixel % width, y = pixel / width;
+    uint16_t colour = (uint16_t) (bitmapNumber * 0x1357 + 0x0841);
+    if (x == 0 || y == 0 || x == width - 1 || y == height - 1)
+        return colour;
+    if (x - y < 3 && y - x < 3)
+        return ~colour;
+    return 0xFFFF;
+}
+
+
+// Source for provisionBitmap()
+static uint16_t testBitmapSource(uint8_t *dest, uint16_t bytes, void *context)
+{
+    testBitmapReader *source = (testBitmapReader *) context;
+
+    for (uint16_t i=0; i < bytes; i++, source->offset++) {
+        uint16_t pixel = getTestBitmapPixel(source->bitmapNumber, source->offset >> 1);
+        *dest++ = (source->offset & 1)? pixel >> 8 : pixel & 0xFF;
+    }
+    return bytes;
+}
+
+
+bool provisionTestBitmaps(uint16_t bitmapPages)
+{
+    bool ok = startBitmapProvisioning(bitmapPages, TEST_BITMAPS_TAG);
+
+    for (uint16_t i=0; ok && i <= BITMAP_LAST_ONE; i++) {
+        uint16_t width, height;
+        testBitmapReader source = {i, 0};
+        getTestBitmapSize(i, &width, &height);
+        ok = provisionBitmap(i, width, height, testBitmapSource, &source);
+    }
+    return endBitmapProvisioning(ok) && ok;
+}
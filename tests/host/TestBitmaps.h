@@ -0,0 +1,22 @@
+// Bitmaps for the host tests
+//
+// The real bitmaps are provisioned from the SD card, so the tests use made-up ones with
+// the same numbers.  Each is a white rectangle with a coloured frame and a diagonal bar,
+// so it has long runs (for the RLE code) and differs from its neighbours (for the golden
+// images).  Font glyphs are small, except that the digits of a fixed-width font
+// are all the same size; the other bitmaps are icon sized.
+#ifndef TESTBITMAPS_H_
+#define TESTBITMAPS_H_
+
+#include <stdint.h>
+
+void getTestBitmapSize(uint16_t bitmapNumber, uint16_t *width, uint16_t *height);
+uint16_t getTestBitmapPixel(uint16_t bitmapNumber, uint32_t pixel);
+
+// Provision every bitmap (0 to BITMAP_LAST_ONE) into external flash, with the tag
+// TEST_BITMAPS_TAG.  Enough of the bitmap area is erased for bitmapPages pages (0 erases
+// all of it).  Returns true if they were all written and verified
+#define TEST_BITMAPS_TAG            0x7E57B175
+bool provisionTestBitmaps(uint16_t bitmapPages = 0);
+
+#endif // TESTBITMAPS_H_
@@ -0,0 +1,124 @@
+// Profile files for the host tests
+#include <stdio.h>
+#include <string.h>
+#include "ReadProfiles.h"
+#include "TestProfiles.h"
+
+static const char *pastes[] = {"SAC305", "Sn63Pb37", "SnBi58", "SN100C", "Sn96.5Ag3.5", "Sn42Bi57.6Ag0.4"};
+static uint8_t testProfileVendors = 4;
+
+
+void getTestProfileName(char *name, uint16_t n)
+{
+    sprintf(name, "%s profile %u", pastes[n % 6], n);
+}
+
+
+void getTestProfilePath(char *path, uint16_t n)
+{
+    sprintf(path, "/PROFILES/VENDOR%u/PASTE%u/PROF%02u.TXT", n % testProfileVendors, (n / testProfileVendors) % 4, n);
+}
+
+
+uint32_t makeTestProfile(char *buffer, uint16_t n, uint16_t revision)
+{
+    char name[MAX_PROFILE_NAME_LENGTH + 1];
+    uint16_t peak = 220 + (n * 7 + revision * 3) % 40;
+    uint16_t soak = 140 + (n * 11 + revision) % 40;
+    char *p = buffer;
+
+    getTestProfileName(name, n);
+    p += sprintf(p, "Controleo3 Reflow Profile\n\n"
+                    "# This profile is for %s solder paste.  Check the datasheet for the paste\n"
+                    "# and the parts before using it, and watch the first reflow.\n#\n", pastes[n % 6]);
+    // Some have a longer description
+    for (uint16_t i=0; i < 4 + (n + revision) % 12; i++)
+        p += sprintf(p, "# Step %u of the datasheet: keep the board between %u and %uC for %u seconds.\n", i + 1,
+                     soak, soak + 20, 60 + i * 10);
+    p += sprintf(p, "\nname \"%s\"\n\n"
+                    "// Abort if the temperature is too far from the target, or too high\n"
+                    "deviation %u\n"
+                    "maximum temperature %u\n\n"
+                    "// Elements: bottom, top and boost\n"
+                    "maximum duty 100 %u 60\n"
+                    "bias 100 %u 50\n"
+                    "initialize timer 0\n"
+                    "convection fan on\n"
+                    "close door 1\n\n"
+                    "display \"Preheat\"\n"
+                    "element duty cycle 80 %u 40\n"
+                    "wait until above %u\n"
+                    "start timer\n\n"
+                    "display \"Soak\"\n"
+                    "ramp temperature %u 90\n"
+                    "maintain %u 60\n\n"
+                    "display \"Reflow\"\n"
+                    "ramp temperature %u 60\n"
+                    "wait until above %u\n"
+                    "maintain %u 20\n"
+                    "stop timer\n\n"
+                    "display \"Cooling\"\n"
+                    "element duty cycle 0 0 0\n"
+                    "open door 5\n"
+                    "cooling fan on\n"
+                    "wait until below 150\n"
+                    "door percentage 50 5\n"
+                    "wait until below 80\n"
+                    "convection fan off\n"
+                    "cooling fan off\n"
+                    "play tune\n", name, 10 + n % 10, peak + 20, 80 + n % 20, 60 + n % 40, 70 + revision % 30,
+                 soak - 40, soak, soak + 20, peak, peak - 5, peak);
+    return p - buffer;
+}
+
+
+bool addTestProfiles(FatImage &image, uint16_t count, uint8_t vendors, uint8_t otherFiles)
+{
+    static char profile[TEST_PROFILE_MAX_SIZE];
+    static uint8_t other[12 * 1024];
+    char path[64];
+
+    testProfileVendors = vendors;
+    if (!image.addDirectory("/PROFILES"))
+        return false;
+    for (uint8_t v=0; v < vendors; v++) {
+        sprintf(path, "/PROFILES/VENDOR%u", v);
+        if (!image.addDirectory(path))
+            return false;
+        for (uint8_t d=0; d < 4; d++) {
+            sprintf(path, "/PROFILES/VENDOR%u/PASTE%u", v, d);
+            if (!image.addDirectory(path))
+                return false;
+        }
+    }
+
+    // Pictures of boards, notes and logs next to the profiles
+    for (uint32_t i=0; i < sizeof(other); i++)
+        other[i] = i * 131 + (i >> 7);
+    for (uint8_t v=0; v < vendors; v++) {
+        for (uint8_t d=0; d < 4; d++) {
+            for (uint8_t i=0; i < otherFiles; i++) {
+                static const char *extensions[] = {"JPG", "DOC", "CSV"};
+                sprintf(path, "/PROFILES/VENDOR%u/PASTE%u/FILE%u.%s", v, d, i, extensions[i % 3]);
+                if (!image.writeFile(path, other, 1024 + ((v * 4 + d + i) * 1500) % sizeof(other)))
+                    return false;
+            }
+        }
+    }
+
+    for (uint16_t n=0; n < count; n++) {
+        uint32_t size = makeTestProfile(profile, n);
+        getTestProfilePath(path, n);
+        if (!image.writeFile(path, profile, size, FAT_DATE(2020, 1 + n % 12, 1 + n % 28)))
+            return false;
+    }
+    return true;
+}
+
+
+int importTestProfiles()
+{
+    if (!SD.begin())
+        return -1;
+    return importProfilesFromSDCard();
+}
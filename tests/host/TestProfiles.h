@@ -0,0 +1,33 @@
+// Profile files for the host tests
+//
+// Reflow profiles like the ones shipped for the oven: a header, comments, a name and the
+// steps of a reflow, about 1.5K to 3K.  A card has them spread over nested directories,
+// with other files that the import has to walk past (pictures, notes and logs).
+#ifndef TESTPROFILES_H_
+#define TESTPROFILES_H_
+
+#include <stdint.h>
+#include "FatImage.h"
+
+#define TEST_PROFILE_MAX_SIZE       4096
+
+// Write profile number n to buffer.  revision changes the steps (not the name).  Returns
+// the size of the file
+uint32_t makeTestProfile(char *buffer, uint16_t n, uint16_t revision = 0);
+
+// The name inside profile n
+void getTestProfileName(char *name, uint16_t n);
+
+// The path of profile n on a test card, like "/PROFILES/VENDOR2/PASTE1/PROF07.TXT"
+void getTestProfilePath(char *path, uint16_t n);
+
+// Put profiles 0 to count-1 on the card, in directories VENDOR0 to VENDOR(vendors-1),
+// each with PASTE0 to PASTE3, and otherFiles other files in each directory
+bool addTestProfiles(FatImage &image, uint16_t count, uint8_t vendors, uint8_t otherFiles);
+
+// Start the card and import the profiles from it, the way ReadProfilesFromSDCard() does
+// once it has found one (digitalRead() always returns 1, so it never does).  Returns the
+// number of profile files imported, or -1 if the card didn't start
+int importTestProfiles();
+
+#endif // TESTPROFILES_H_
@@ -0,0 +1,690 @@
+// Model of the W25Q80BV 8Mbit (1MB) SPI flash, backed by an image file
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "Host.h"
+#include "W25Q80.h"
+
+// Pins on PORTA
+#define PIN_CLK                     (1UL << 13)
+#define PIN_CS                      (1UL << 14)
+#define PIN_IO0                     (1UL << 16)
+#define PIN_IO1                     (1UL << 17)
+#define PINS_IO                     (0xFUL << 16)
+
+// Status register bits
+#define STATUS_BUSY                 0x01
+#define STATUS_WEL                  0x02
+#define STATUS_BP                   0x1C
+#define STATUS_TB                   0x20
+#define STATUS_SEC                  0x40
+#define STATUS1_WRITABLE            0xFC
+#define STATUS_QE                   0x02
+#define STATUS_CMP                  0x40
+#define STATUS_SUS                  0x80
+#define STATUS2_WRITABLE            0x43
+
+// Commands
+#define CMD_WRITE_STATUS            0x01
+#define CMD_PAGE_PROGRAM            0x02
+#define CMD_READ                    0x03
+#define CMD_WRITE_DISABLE           0x04
+#define CMD_READ_STATUS1            0x05
+#define CMD_WRITE_ENABLE            0x06
+#define CMD_FAST_READ               0x0B
+#define CMD_ERASE_4K                0x20
+#define CMD_QUAD_PAGE_PROGRAM       0x32
+#define CMD_READ_STATUS2            0x35
+#define CMD_READ_UNIQUE_ID          0x4B
+#define CMD_VOLATILE_STATUS         0x50
+#define CMD_ERASE_32K               0x52
+#define CMD_ERASE_CHIP              0x60
+#define CMD_SUSPEND                 0x75
+#define CMD_RESUME                  0x7A
+#define CMD_MANUFACTURER_ID         0x90
+#define CMD_JEDEC_ID                0x9F
+#define CMD_ERASE_CHIP2             0xC7
+#define CMD_ERASE_64K               0xD8
+#define CMD_OCTAL_WORD_READ_QUAD    0xE3
+
+// Minimum time from a resume to the next suspend (tSUS)
+#define SUSPEND_MICROS              20
+
+#define MICROS_TO_CYCLES(x)         ((uint64_t) (x) * HOST_CPU_MHZ)
+
+//                                                 program  4K      32K     64K      chip     status
+const W25Q80::Timing W25Q80::typical =            {700,     30000,  120000, 150000,  2000000, 10000};
+const W25Q80::Timing W25Q80::maximum =            {3000,    400000, 800000, 1000000, 6000000, 15000};
+
+static const uint8_t jedecID[] = {0xEF, 0x40, 0x14};
+static const uint8_t manufacturerID[] = {0xEF, 0x13};
+static const uint8_t uniqueID[] = {0xD2, 0x66, 0x38, 0x44, 0x13, 0x57, 0x2A, 0x2F};
+
+
+W25Q80::W25Q80(const char *imageFile)
+{
+    struct stat st;
+
+    fd = open(imageFile, O_RDWR | O_CREAT, 0644);
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        perror(imageFile);
+        exit(1);
+    }
+    bool created = st.st_size == 0;
+    if (created && ftruncate(fd, W25Q80_SIZE) < 0) {
+        perror(imageFile);
+        exit(1);
+    }
+    else if (!created && st.st_size != W25Q80_SIZE) {
+        fprintf(stderr, "%s: not a 1MB flash image\n", imageFile);
+        exit(1);
+    }
+    image = (uint8_t *) mmap(0, W25Q80_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (image == MAP_FAILED) {
+        perror(imageFile);
+        exit(1);
+    }
+    if (created)
+        memset(image, 0xFF, W25Q80_SIZE);
+
+    // The status registers aren't kept in the image.  They start with nothing protected.
+    nvStatus1 = nvStatus2 = 0;
+    timing = typical;
+    operationsUntilPowerCut = 0;
+    powerCutSeed = 1;
+    lastResume = 0;
+    powerOn();
+    resetStatistics();
+    attachPortDevice(this);
+}
+
+
+W25Q80::~W25Q80()
+{
+    detachPortDevice(this);
+    msync(image, W25Q80_SIZE, MS_SYNC);
+    munmap(image, W25Q80_SIZE);
+    close(fd);
+}
+
+
+void W25Q80::resetStatistics()
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+
+uint32_t W25Q80::violations() const
+{
+    return stats.unknownCommands + stats.busyCommands + stats.notWriteEnabled + stats.protectedWrites + stats.unerasedBits +
+           stats.quadNotEnabled + stats.badAddresses + stats.suspendErrors + stats.suspendedReads + stats.busContention;
+}
+
+
+bool W25Q80::isBusy()
+{
+    update();
+    return operation != OP_NONE && !suspended;
+}
+
+
+void W25Q80::printStatistics()
+{
+    printf("  Transactions %u, reads %u bytes, programs %u pages (%u bytes), erases 4K=%u block=%u chip=%u, status writes %u, suspends %u\n",
+           stats.transactions, stats.bytesRead, stats.pagesProgrammed, stats.bytesProgrammed, stats.sectorErases,
+           stats.blockErases, stats.chipErases, stats.statusWrites, stats.suspends);
+    printf("  Busy for %llu.%03llu ms\n", (unsigned long long) stats.busyMicros / 1000, (unsigned long long) stats.busyMicros % 1000);
+    if (violations())
+        printf("  Violations: unknown=%u busy=%u notWriteEnabled=%u protected=%u unerasedBits=%u quad=%u address=%u suspend=%u suspendedReads=%u contention=%u\n",
+               stats.unknownCommands, stats.busyCommands, stats.notWriteEnabled, stats.protectedWrites, stats.unerasedBits,
+               stats.quadNotEnabled, stats.badAddresses, stats.suspendErrors, stats.suspendedReads, stats.busContention);
+}
+
+
+void W25Q80::cutPowerAfter(uint32_t operations, uint32_t seed)
+{
+    operationsUntilPowerCut = operations;
+    powerCutSeed = seed? seed : 1;
+}
+
+
+void W25Q80::powerOn()
+{
+    poweredOff = false;
+    status1 = nvStatus1;
+    status2 = nvStatus2;
+    volatileStatusEnabled = false;
+    operation = OP_NONE;
+    suspendRequested = suspended = false;
+    selected = false;
+    outputting = false;
+    driveMask = 0;
+}
+
+
+void W25Q80::outputsChanged(uint8_t group, uint32_t out, uint32_t changed)
+{
+    if (group != HOST_PORTA)
+        return;
+    if (changed & PIN_CS) {
+        if (out & PIN_CS)
+            deselect();
+        else
+            select();
+    }
+    if (changed & PIN_CLK) {
+        clockHigh = out & PIN_CLK;
+        if (!selected || poweredOff)
+            return;
+        // SPI mode 3: inputs are sampled on the rising edge, outputs change on the falling edge
+        if (clockHigh)
+            clockIn(out);
+        else
+            clockOut();
+    }
+}
+
+
+uint32_t W25Q80::drivenPins(uint8_t group, uint32_t *levels)
+{
+    if (group != HOST_PORTA || !selected)
+        return 0;
+    if (poweredOff) {
+        *levels = 0;
+        return PINS_IO;
+    }
+    if (driveMask & hostPortDir(HOST_PORTA))
+        stats.busContention++;
+    *levels = driveLevels;
+    return driveMask;
+}
+
+
+void W25Q80::select()
+{
+    selected = true;
+    command = 0;
+    inputByte = inputBits = 0;
+    bytesIn = bytesOut = 0;
+    address = 0;
+    quadIn = quadOut = false;
+    outputting = false;
+    outputBitsLeft = 0;
+    driveMask = 0;
+    ignored = false;
+    if (poweredOff)
+        return;
+    stats.transactions++;
+    update();
+}
+
+
+void W25Q80::deselect()
+{
+    bool wasSelected = selected;
+
+    selected = false;
+    driveMask = 0;
+    if (!wasSelected || poweredOff || ignored)
+        return;
+    // Commands are only carried out if CS goes idle on a byte boundary
+    if (inputBits || !bytesIn)
+        return;
+    endCommand();
+}
+
+
+// Sample IO0, or IO0-IO3 in quad mode
+void W25Q80::clockIn(uint32_t out)
+{
+    if (outputting)
+        return;
+    if (quadIn) {
+        inputByte = (inputByte << 4) | ((out & PINS_IO) >> 16);
+        inputBits += 4;
+    }
+    else {
+        inputByte = (inputByte << 1) | ((out & PIN_IO0)? 1 : 0);
+        inputBits++;
+    }
+    if (inputBits == 8) {
+        inputBits = 0;
+        receiveByte(inputByte);
+    }
+}
+
+
+// Drive the next bit on IO1, or the next nibble on IO0-IO3 in quad mode
+void W25Q80::clockOut()
+{
+    if (!outputting)
+        return;
+    if (!outputBitsLeft) {
+        outputByte = nextOutputByte();
+        outputBitsLeft = 8;
+    }
+    if (quadOut) {
+        outputBitsLeft -= 4;
+        driveMask = PINS_IO;
+        driveLevels = (uint32_t) ((outputByte >> outputBitsLeft) & 0x0F) << 16;
+    }
+    else {
+        outputBitsLeft--;
+        driveMask = PIN_IO1;
+        driveLevels = ((outputByte >> outputBitsLeft) & 1)? PIN_IO1 : 0;
+    }
+}
+
+
+void W25Q80::receiveByte(uint8_t byte)
+{
+    if (bytesIn++ == 0) {
+        command = byte;
+        startCommand();
+        return;
+    }
+    if (ignored)
+        return;
+
+    uint16_t n = bytesIn - 2;       // Bytes after the command, starting at 0
+    switch (command) {
+        case CMD_READ:
+        case CMD_FAST_READ:
+        case CMD_MANUFACTURER_ID:
+        case CMD_READ_UNIQUE_ID:
+        case CMD_OCTAL_WORD_READ_QUAD:
+            // 3 address bytes, then dummy or mode bytes
+            if (n < 3)
+                address = ((address << 8) | byte) & (W25Q80_SIZE - 1);
+            if ((command == CMD_READ && n == 2) || (command == CMD_FAST_READ && n == 3) || (command == CMD_MANUFACTURER_ID && n == 2) ||
+                (command == CMD_READ_UNIQUE_ID && n == 3) || (command == CMD_OCTAL_WORD_READ_QUAD && n == 3)) {
+                if (command == CMD_OCTAL_WORD_READ_QUAD && (address & 0x0F))
+                    stats.badAddresses++;
+                outputting = true;
+            }
+            break;
+
+        case CMD_PAGE_PROGRAM:
+        case CMD_QUAD_PAGE_PROGRAM:
+            if (n < 3) {
+                address = ((address << 8) | byte) & (W25Q80_SIZE - 1);
+                // The data is clocked in on IO0-IO3
+                if (n == 2 && command == CMD_QUAD_PAGE_PROGRAM)
+                    quadIn = true;
+                break;
+            }
+            // Data wraps around within the page
+            pageBuffer[(address + n - 3) & (W25Q80_PAGE_SIZE - 1)] = byte;
+            pageBufferUsed[(address + n - 3) & (W25Q80_PAGE_SIZE - 1)] = true;
+            break;
+
+        case CMD_ERASE_4K:
+        case CMD_ERASE_32K:
+        case CMD_ERASE_64K:
+            if (n < 3)
+                address = ((address << 8) | byte) & (W25Q80_SIZE - 1);
+            break;
+
+        case CMD_WRITE_STATUS:
+            if (n < 2)
+                statusBytes[n] = byte;
+            break;
+    }
+}
+
+
+// The command byte has been received
+void W25Q80::startCommand()
+{
+    bool busy = isBusy();
+
+    stats.commands[command]++;
+    switch (command) {
+        // Allowed at any time
+        case CMD_READ_STATUS1:
+        case CMD_READ_STATUS2:
+            outputting = true;
+            return;
+        case CMD_SUSPEND:
+        case CMD_RESUME:
+            return;
+
+        // Reads are allowed while an erase is suspended
+        case CMD_READ:
+        case CMD_FAST_READ:
+        case CMD_OCTAL_WORD_READ_QUAD:
+        case CMD_JEDEC_ID:
+        case CMD_MANUFACTURER_ID:
+        case CMD_READ_UNIQUE_ID:
+            if (busy)
+                break;
+            if (command == CMD_OCTAL_WORD_READ_QUAD) {
+                if (!(status2 & STATUS_QE)) {
+                    stats.quadNotEnabled++;
+                    ignored = true;
+                    return;
+                }
+                quadIn = quadOut = true;
+            }
+            if (command == CMD_JEDEC_ID)
+                outputting = true;
+            return;
+
+        // Program, erase and status writes aren't allowed while an erase is suspended.  (The
+        // chip allows a page program, but the firmware never does that.)
+        case CMD_WRITE_ENABLE:
+        case CMD_WRITE_DISABLE:
+        case CMD_VOLATILE_STATUS:
+        case CMD_WRITE_STATUS:
+        case CMD_PAGE_PROGRAM:
+        case CMD_QUAD_PAGE_PROGRAM:
+        case CMD_ERASE_4K:
+        case CMD_ERASE_32K:
+        case CMD_ERASE_64K:
+        case CMD_ERASE_CHIP:
+        case CMD_ERASE_CHIP2:
+            if (busy || (suspended && command != CMD_WRITE_ENABLE && command != CMD_WRITE_DISABLE))
+                break;
+            if (command == CMD_QUAD_PAGE_PROGRAM && !(status2 & STATUS_QE)) {
+                stats.quadNotEnabled++;
+                ignored = true;
+                return;
+            }
+            if (command == CMD_PAGE_PROGRAM || command == CMD_QUAD_PAGE_PROGRAM) {
+                memset(pageBuffer, 0xFF, sizeof(pageBuffer));
+                memset(pageBufferUsed, 0, sizeof(pageBufferUsed));
+            }
+            return;
+
+        default:
+            stats.unknownCommands++;
+            ignored = true;
+            return;
+    }
+
+    // The chip is busy
+    stats.busyCommands++;
+    ignored = true;
+}
+
+
+// CS has gone idle after a command that wasn't ignored
+void W25Q80::endCommand()
+{
+    uint16_t dataBytes = bytesIn - 1;
+    uint64_t now = hostCycleCount();
+
+    switch (command) {
+        case CMD_WRITE_ENABLE:
+            status1 |= STATUS_WEL;
+            volatileStatusEnabled = false;
+            break;
+
+        case CMD_WRITE_DISABLE:
+            status1 &= ~STATUS_WEL;
+            break;
+
+        case CMD_VOLATILE_STATUS:
+            volatileStatusEnabled = true;
+            break;
+
+        case CMD_WRITE_STATUS: {
+            if (!dataBytes)
+                break;
+            // With one byte, CMP and QE are cleared
+            uint8_t s1 = statusBytes[0] & STATUS1_WRITABLE;
+            uint8_t s2 = dataBytes > 1? statusBytes[1] & STATUS2_WRITABLE : 0;
+            if (volatileStatusEnabled) {
+                volatileStatusEnabled = false;
+                status1 = (status1 & ~STATUS1_WRITABLE) | s1;
+                status2 = (status2 & ~STATUS2_WRITABLE) | s2;
+                break;
+            }
+            statusBytes[0] = s1;
+            statusBytes[1] = s2;
+            startOperation(OP_WRITE_STATUS, 0, 0, timing.writeStatus);
+            break;
+        }
+
+        case CMD_PAGE_PROGRAM:
+        case CMD_QUAD_PAGE_PROGRAM:
+            if (dataBytes < 4)
+                break;
+            startOperation(OP_PROGRAM, address & ~(W25Q80_PAGE_SIZE - 1), W25Q80_PAGE_SIZE, timing.programPage);
+            break;
+
+        case CMD_ERASE_4K:
+            if (dataBytes >= 3)
+                startOperation(OP_ERASE, address & ~0xFFF, 0x1000, timing.erase4K);
+            break;
+
+        case CMD_ERASE_32K:
+            if (dataBytes >= 3)
+                startOperation(OP_ERASE, address & ~0x7FFF, 0x8000, timing.erase32K);
+            break;
+
+        case CMD_ERASE_64K:
+            if (dataBytes >= 3)
+                startOperation(OP_ERASE, address & ~0xFFFF, 0x10000, timing.erase64K);
+            break;
+
+        case CMD_ERASE_CHIP:
+        case CMD_ERASE_CHIP2:
+            startOperation(OP_ERASE, 0, W25Q80_SIZE, timing.eraseChip);
+            break;
+
+        case CMD_SUSPEND:
+            // Only a program or erase can be suspended.  If it finished already there is
+            // nothing to do.
+            if (operation == OP_WRITE_STATUS || operation == OP_NONE || suspended || suspendRequested)
+                break;
+            if (now - lastResume < MICROS_TO_CYCLES(SUSPEND_MICROS))
+                stats.suspendErrors++;
+            // The chip is still busy until the suspend takes effect
+            suspendRequested = true;
+            suspendAt = now + MICROS_TO_CYCLES(SUSPEND_MICROS);
+            break;
+
+        case CMD_RESUME:
+            if (!suspended) {
+                stats.suspendErrors++;
+                break;
+            }
+            suspended = false;
+            status2 &= ~STATUS_SUS;
+            busyUntil = now + remainingCycles;
+            lastResume = now;
+            break;
+    }
+}
+
+
+uint8_t W25Q80::nextOutputByte()
+{
+    uint16_t n = bytesOut++;
+
+    switch (command) {
+        case CMD_READ_STATUS1:
+            return status1 | (isBusy()? STATUS_BUSY : 0);
+        case CMD_READ_STATUS2:
+            update();
+            return status2;
+        case CMD_JEDEC_ID:
+            return n < sizeof(jedecID)? jedecID[n] : 0xFF;
+        case CMD_MANUFACTURER_ID:
+            return manufacturerID[n & 1];
+        case CMD_READ_UNIQUE_ID:
+            return n < sizeof(uniqueID)? uniqueID[n] : 0xFF;
+        case CMD_READ:
+        case CMD_FAST_READ:
+        case CMD_OCTAL_WORD_READ_QUAD: {
+            // The data in a sector being erased is undefined until the erase has finished
+            if (suspended && operation == OP_ERASE && address >= operationAddress && address < operationAddress + operationSize)
+                stats.suspendedReads++;
+            uint8_t data = image[address];
+            address = (address + 1) & (W25Q80_SIZE - 1);
+            stats.bytesRead++;
+            return data;
+        }
+    }
+    return 0xFF;
+}
+
+
+// Start a program, erase or status write.  Returns false if it isn't allowed.
+bool W25Q80::startOperation(Operation op, uint32_t address, uint32_t size, uint32_t micros)
+{
+    if (!(status1 & STATUS_WEL)) {
+        stats.notWriteEnabled++;
+        return false;
+    }
+    status1 &= ~STATUS_WEL;
+    if (op != OP_WRITE_STATUS && isProtected(address, size)) {
+        stats.protectedWrites++;
+        return false;
+    }
+
+    operation = op;
+    operationAddress = address;
+    operationSize = size;
+    operationMicros = micros;
+    busyUntil = hostCycleCount() + MICROS_TO_CYCLES(micros);
+
+    if (operationsUntilPowerCut && --operationsUntilPowerCut == 0) {
+        // The power goes in the middle of the operation
+        if (op == OP_PROGRAM)
+            program(true);
+        else if (op == OP_ERASE)
+            erase(true);
+        operation = OP_NONE;
+        poweredOff = true;
+        selected = false;
+        driveMask = 0;
+    }
+    return true;
+}
+
+
+// The program, erase or status write has finished
+void W25Q80::finishOperation()
+{
+    switch (operation) {
+        case OP_PROGRAM:
+            program(false);
+            stats.pagesProgrammed++;
+            break;
+        case OP_ERASE:
+            erase(false);
+            if (operationSize == 0x1000)
+                stats.sectorErases++;
+            else if (operationSize == W25Q80_SIZE)
+                stats.chipErases++;
+            else
+                stats.blockErases++;
+            break;
+        case OP_WRITE_STATUS:
+            nvStatus1 = status1 = (status1 & ~STATUS1_WRITABLE) | statusBytes[0];
+            nvStatus2 = status2 = (status2 & ~STATUS2_WRITABLE) | statusBytes[1];
+            stats.statusWrites++;
+            break;
+        case OP_NONE:
+            break;
+    }
+    stats.busyMicros += operationMicros;
+    operation = OP_NONE;
+}
+
+
+// Move the operation in progress on to the current time
+void W25Q80::update()
+{
+    uint64_t now = hostCycleCount();
+
+    if (operation == OP_NONE || suspended || poweredOff)
+        return;
+    if (suspendRequested && now >= suspendAt) {
+        suspendRequested = false;
+        if (busyUntil > suspendAt) {
+            suspended = true;
+            status2 |= STATUS_SUS;
+            remainingCycles = busyUntil - suspendAt;
+            stats.suspends++;
+            return;
+        }
+    }
+    if (now >= busyUntil) {
+        suspendRequested = false;
+        finishOperation();
+    }
+}
+
+
+// Is any part of the area protected by the block protect bits?
+bool W25Q80::isProtected(uint32_t address, uint32_t size) const
+{
+    uint8_t bp = (status1 & STATUS_BP) >> 2;
+    uint32_t protectedStart = 0, protectedSize = 0;
+
+    if (bp) {
+        if (status1 & STATUS_SEC)
+            protectedSize = bp >= 6? W25Q80_SIZE : 0x1000 << (bp >= 4? 3 : bp - 1);
+        else
+            protectedSize = bp >= 5? W25Q80_SIZE : 0x10000 << (bp - 1);
+        protectedStart = (status1 & STATUS_TB)? 0 : W25Q80_SIZE - protectedSize;
+    }
+
+    // CMP protects everything else instead
+    for (uint32_t a = address; a < address + size; a += 0x1000) {
+        bool inside = a >= protectedStart && a < protectedStart + protectedSize;
+        if (inside != ((status2 & STATUS_CMP) != 0))
+            return true;
+    }
+    return false;
+}
+
+
+// Program the page.  Bits can only be cleared.  With a power cut, only some of them are.
+void W25Q80::program(bool powerCut)
+{
+    for (uint16_t i=0; i < W25Q80_PAGE_SIZE; i++) {
+        if (!pageBufferUsed[i])
+            continue;
+        uint8_t *p = image + operationAddress + i;
+        uint8_t clear = *p & ~pageBuffer[i];
+        if (powerCut)
+            clear &= random();
+        else {
+            // 0xFF leaves a byte alone, which the firmware uses to program part of a page
+            if (pageBuffer[i] != 0xFF)
+                stats.unerasedBits += __builtin_popcount(~*p & pageBuffer[i] & 0xFF);
+            stats.bytesProgrammed++;
+        }
+        *p &= ~clear;
+    }
+}
+
+
+// Erase the area (set every bit).  With a power cut, only some bits are set.
+void W25Q80::erase(bool powerCut)
+{
+    if (!powerCut) {
+        memset(image + operationAddress, 0xFF, operationSize);
+        return;
+    }
+    for (uint32_t i=0; i < operationSize; i++)
+        image[operationAddress + i] |= random();
+}
+
+
+// xorshift32, seeded by cutPowerAfter()
+uint8_t W25Q80::random()
+{
+    powerCutSeed ^= powerCutSeed << 13;
+    powerCutSeed ^= powerCutSeed >> 17;
+    powerCutSeed ^= powerCutSeed << 5;
+    return (uint8_t) powerCutSeed;
+}
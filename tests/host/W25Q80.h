@@ -0,0 +1,148 @@
+// Model of the W25Q80BV 8Mbit (1MB) SPI flash, backed by an image file
+//
+// The model is wired to the flash pins on PORTA (CLK PA13, CS PA14, IO0-IO3 PA16-PA19) and
+// decodes the commands Controleo3Flash sends, bit by bit: standard, quad and octal word
+// quad reads, page program and quad page program, the status registers (volatile and
+// non-volatile) with the block protection bits, 4K/32K/64K and chip erase, and erase
+// suspend/resume.  Program and erase leave the flash busy for the times in the datasheet,
+// in simulated time, so waitUntilNotBusy() and the flash job task are exercised.
+//
+// Anything the real chip would ignore or get wrong is counted as a violation: commands
+// while busy, writes without write enable, writes to protected areas, programming bits
+// that aren't erased, reads of a sector whose erase is suspended, and so on.
+#ifndef W25Q80_H_
+#define W25Q80_H_
+
+#include <stdint.h>
+#include "HostPort.h"
+
+#define W25Q80_SIZE                 0x100000
+#define W25Q80_PAGE_SIZE            256
+#define W25Q80_SECTOR_SIZE          4096
+
+
+class W25Q80 : public HostPortDevice {
+    public:
+        // How long the flash is busy, in microseconds
+        struct Timing {
+            uint32_t programPage;
+            uint32_t erase4K;
+            uint32_t erase32K;
+            uint32_t erase64K;
+            uint32_t eraseChip;
+            uint32_t writeStatus;
+        };
+        static const Timing typical;        // Typical times from the datasheet (the default)
+        static const Timing maximum;        // Maximum times
+
+        struct Statistics {
+            uint32_t transactions;          // CS went active, then idle
+            uint32_t commands[256];         // Number of each command
+            uint32_t bytesRead;             // Data bytes read (not status or ID)
+            uint32_t pagesProgrammed;
+            uint32_t bytesProgrammed;
+            uint32_t sectorErases;          // 4K
+            uint32_t blockErases;           // 32K and 64K
+            uint32_t chipErases;
+            uint32_t statusWrites;          // Non-volatile status register writes
+            uint32_t suspends;              // Erases or programs suspended
+            uint64_t busyMicros;            // Total time spent programming and erasing
+
+            // Violations
+            uint32_t unknownCommands;
+            uint32_t busyCommands;          // Commands (other than status reads and suspend) while busy
+            uint32_t notWriteEnabled;       // Program, erase or status write without write enable
+            uint32_t protectedWrites;       // Program or erase of a protected area
+            uint32_t unerasedBits;          // Bits programmed to 1 that were already 0 (except in 0xFF bytes)
+            uint32_t quadNotEnabled;        // Quad command with QE clear
+            uint32_t badAddresses;          // Octal word read not on a 16-byte boundary
+            uint32_t suspendErrors;         // Suspend too soon after a resume, resume with nothing suspended
+            uint32_t suspendedReads;        // Reads of the area whose erase is suspended
+            uint32_t busContention;         // The SAMD21 driving a pin the chip is driving
+        };
+        Statistics stats;
+
+        // Open (or create, erased) a 1MB image file, and attach the flash to the pins
+        W25Q80(const char *imageFile);
+        ~W25Q80();
+
+        uint8_t *memory() { return image; }
+        void setTiming(const Timing &timing) { this->timing = timing; }
+        void resetStatistics();
+        uint32_t violations() const;
+        bool isBusy();
+        void printStatistics();
+
+        // Cut the power part way through the Nth program or erase from now (1 = the next one).
+        // The page or sector is left partly programmed or erased (chosen with seed), and the
+        // chip stops responding.  Reads return 0.
+        void cutPowerAfter(uint32_t operations, uint32_t seed);
+        bool isPoweredOff() const { return poweredOff; }
+
+        // Power the chip up again.  Anything in progress is lost, the status registers are
+        // loaded from their non-volatile copies and write enable is cleared.
+        void powerOn();
+
+        // HostPortDevice
+        void outputsChanged(uint8_t group, uint32_t out, uint32_t changed);
+        uint32_t drivenPins(uint8_t group, uint32_t *levels);
+
+    private:
+        // Operations that leave the chip busy
+        enum Operation {OP_NONE, OP_PROGRAM, OP_ERASE, OP_WRITE_STATUS};
+
+        uint8_t *image;
+        int fd;
+        Timing timing;
+
+        // Status registers
+        uint8_t status1, status2, nvStatus1, nvStatus2;
+        bool volatileStatusEnabled;
+
+        // The current transaction
+        bool selected;
+        bool clockHigh;
+        uint8_t command;
+        uint8_t inputByte, inputBits;       // Byte being shifted in
+        uint16_t bytesIn;                   // Bytes received, including the command
+        uint16_t bytesOut;
+        uint32_t address;
+        bool quadIn, quadOut;               // IO0-IO3 used for input or output
+        bool outputting;
+        uint8_t outputByte, outputBitsLeft;
+        uint32_t driveMask, driveLevels;
+        bool ignored;                       // The command is being ignored
+        uint8_t pageBuffer[W25Q80_PAGE_SIZE];
+        bool pageBufferUsed[W25Q80_PAGE_SIZE];
+        uint8_t statusBytes[2];
+
+        // The operation in progress
+        Operation operation;
+        uint32_t operationAddress, operationSize, operationMicros;
+        uint64_t busyUntil;
+        bool suspendRequested, suspended;
+        uint64_t suspendAt, remainingCycles, lastResume;
+
+        // Power cuts
+        uint32_t operationsUntilPowerCut;
+        uint32_t powerCutSeed;
+        bool poweredOff;
+
+        void select();
+        void deselect();
+        void clockIn(uint32_t out);
+        void clockOut();
+        void receiveByte(uint8_t byte);
+        uint8_t nextOutputByte();
+        void startCommand();
+        void endCommand();
+        bool startOperation(Operation op, uint32_t address, uint32_t size, uint32_t micros);
+        void finishOperation();
+        void update();
+        bool isProtected(uint32_t address, uint32_t size) const;
+        void program(bool powerCut);
+        void erase(bool powerCut);
+        uint8_t random();
+};
+
+#endif // W25Q80_H_
@@ -0,0 +1,270 @@
+// What drawing costs on the LCD bus (Controleo3LCD.cpp, Render.cpp): simulated time and what
+// the ILI9488 model saw for screen fills with the DMA and the CPU, text, bitmaps from
+// microcontroller flash, the RAM cache and external flash, and drawing the home screen.
+// Then the bitmaps in microcontroller flash drawn with drawBitmapRLE(), where runs of white,
+// black and the greys are WR strobes, against drawing their pixels with drawBitmap(), and
+// screen transitions drawn a piece at a time against blitting their saved backgrounds.
+#include <stdio.h>
+#include <unistd.h>
+#include "ReflowWizard.h"
+#include "Render.h"
+#include "Screens.h"
+#include "BitmapCache.h"
+#include "ScreenBackgrounds.h"
+#include "Touch.h"
+#include "LCDModel.h"
+#include "W25Q80.h"
+#include "TestBitmaps.h"
+#include "Bitmaps.h"
+
+#define IMAGE_FILE                  "bench_lcd.img"
+
+
+static void fillWithDMA()           { tft.fillScreen(WHITE); }
+static void fillWithCPU()           { tft.fillScreen(DARK_GREY); }
+static void text9pt()               { displayString(5, 5, FONT_9PT_BLACK_ON_WHITE, (char *) "Temperature 123.4C, 45%"); }
+static void text12pt()              { displayString(5, 40, FONT_12PT_BLACK_ON_WHITE, (char *) "Temperature 123.4C, 45%"); }
+static void text22pt()              { displayString(5, 80, FONT_22PT_BLACK_ON_WHITE_FIXED, (char *) "123.4~C"); }
+static void bitmapFromMCUFlash()    { renderBitmap(BITMAP_SETTINGS, 300, 200); }
+static void bitmapFromRAMCache()    { renderBitmap(BITMAP_CONTROLEO3_SMALL, 106, 5); }
+static void bitmapStreamed()        { renderBitmapFromExternalFlash(BITMAP_CONTROLEO3_SMALL, 106, 5); }
+static void homeScreen()
+{
+    tft.fillScreen(WHITE);
+    renderBitmapFromExternalFlash(BITMAP_CONTROLEO3_SMALL, 106, 5);
+    drawTouchButton(110, 80, 260, BUTTON_LARGE_FONT, (char *) "Reflow");
+    drawTouchButton(110, 160, 260, BUTTON_LARGE_FONT, (char *) "Bake");
+    drawTouchButtonWithIcon(110, 240, 260, BUTTON_LARGE_FONT, (char *) "Settings", BITMAP_SETTINGS, 252);
+}
+
+static const struct {
+    const char *name;
+    void (*draw)();
+} cases[] = {
+    {"fillScreen(WHITE), DMA", fillWithDMA},
+    {"fillScreen(DARK_GREY), CPU", fillWithCPU},
+    {"23 characters, 9pt", text9pt},
+    {"23 characters, 12pt", text12pt},
+    {"7 characters, 22pt", text22pt},
+    {"Bitmap, MCU flash", bitmapFromMCUFlash},
+    {"Bitmap, RAM cache", bitmapFromRAMCache},
+    {"Bitmap, external flash", bitmapStreamed},
+    {"Home screen", homeScreen},
+};
+
+
+// The static part of the screens with saved backgrounds, as Screens.cpp draws them
+static void drawHomeScreen()
+{
+    renderBitmap(BITMAP_CONTROLEO3_SMALL, 106, 5);
+    drawTouchButton(110, 80, 260, BUTTON_LARGE_FONT, (char *) "Reflow");
+    drawTouchButton(110, 160, 260, BUTTON_LARGE_FONT, (char *) "Bake");
+    drawTouchButtonWithIcon(110, 240, 260, BUTTON_LARGE_FONT, (char *) "Settings", BITMAP_SETTINGS, 252);
+}
+
+static void drawSettingsScreen()
+{
+    displayHeader((char *) "Settings", true);
+    drawTouchButton(10, 45, 210, BUTTON_SMALL_FONT, (char *) "Test");
+    drawTouchButton(10, 120, 210, BUTTON_SMALL_FONT, (char *) "Learning");
+    drawTouchButton(10, 195, 210, BUTTON_SMALL_FONT, (char *) "Reset");
+    drawTouchButton(260, 45, 210, BUTTON_SMALL_FONT, (char *) "Setup");
+    drawTouchButton(260, 120, 210, BUTTON_SMALL_FONT, (char *) "Stats");
+    drawTouchButton(260, 195, 210, BUTTON_SMALL_FONT, (char *) "About");
+    drawNavigationButtons(false, false);
+}
+
+static void drawBakeScreen()
+{
+    displayHeader((char *) "Bake", false);
+    drawTouchButton(140, 100, 200, BUTTON_SMALL_FONT, (char *) "Start");
+    drawTouchButtonWithIcon(140, 180, 200, BUTTON_SMALL_FONT, (char *) "Edit", BITMAP_SETTINGS, 192);
+    drawNavigationButtons(true, true);
+}
+
+static void drawEditBakeScreen()
+{
+    displayHeader((char *) "Bake", true);
+    displayString(20, LINE(0), FONT_9PT_BLACK_ON_WHITE, (char *) "Temperature:");
+    displayString(20, LINE(3), FONT_9PT_BLACK_ON_WHITE, (char *) "Duration:");
+    drawIncreaseDecreaseTapTargets(TWO_SETTINGS);
+    drawNavigationButtons(true, true);
+}
+
+static void drawStatsScreen()
+{
+    displayHeader((char *) "Statistics", false);
+    displayString(10, LINE(0), FONT_9PT_BLACK_ON_WHITE, (char *) "Number of reflows: ");
+    displayString(10, LINE(1), FONT_9PT_BLACK_ON_WHITE, (char *) "Number of bakes: ");
+    drawNavigationButtons(false, true);
+}
+
+static const struct {
+    const char *name;
+    uint8_t screen;
+    void (*draw)();
+} screens[] = {
+    {"Home", SCREEN_HOME, drawHomeScreen},
+    {"Settings", SCREEN_SETTINGS, drawSettingsScreen},
+    {"Bake", SCREEN_BAKE, drawBakeScreen},
+    {"Bake (edit)", SCREEN_EDIT_BAKE1, drawEditBakeScreen},
+    {"Statistics", SCREEN_STATS, drawStatsScreen},
+};
+
+
+// Show a screen as showScreen() does, either always a piece at a time or using (and saving)
+// its background.  Returns the simulated time in cycles.
+static uint64_t showScreen(uint8_t screen, void (*draw)(), bool useBackground)
+{
+    uint64_t start = hostCycleCount();
+
+    clearTouchTargets();
+    if (!useBackground || !hasScreenBackground(screen))
+        tft.fillScreen(WHITE);
+    if (!useBackground)
+        draw();
+    else if (!drawScreenBackground(screen)) {
+        draw();
+        saveScreenBackground(screen);
+    }
+    tft.waitUntilIdle();
+    return hostCycleCount() - start;
+}
+
+
+struct busCost {
+    uint64_t cycles;
+    uint32_t bytes, strobes;
+};
+
+
+// Draw every bitmap in microcontroller flash from first to last, either as it is drawn
+// (run-length encoded) or as raw pixels
+static busCost drawMCUBitmaps(LCDModel &lcd, uint16_t first, uint16_t last, bool raw)
+{
+    static uint16_t pixels[LCD_WIDTH * LCD_HEIGHT];
+    busCost cost = {0, 0, 0};
+
+    for (uint16_t i=first; i <= last; i++) {
+        const uint16_t *rle = flashBitmaps[i];
+        if (!rle)
+            continue;
+        uint16_t width = *rle >> 8, height = *rle++ & 0xFF;
+        uint32_t count = (uint32_t) width * height;
+        if (raw) {
+            for (uint32_t p=0; p < count; ) {
+                uint16_t n = *rle & 0x7FFF;
+                if (*rle++ & 0x8000) {
+                    for (uint16_t j=0; j < n; j++)
+                        pixels[p++] = *rle;
+                    rle++;
+                }
+                else
+                    for (uint16_t j=0; j < n; j++)
+                        pixels[p++] = *rle++;
+            }
+        }
+        lcd.resetStatistics();
+        uint64_t start = hostCycleCount();
+        if (raw) {
+            tft.startBitmap(0, 0, width, height);
+            tft.drawBitmap(pixels, count);
+            tft.endBitmap();
+        }
+        else
+            renderBitmapFromMicrocontrollerFlash(i, 0, 0);
+        cost.cycles += hostCycleCount() - start;
+        cost.bytes += lcd.stats.bytesWritten;
+        cost.strobes += lcd.stats.strobes;
+    }
+    return cost;
+}
+
+
+int main()
+{
+    unlink(IMAGE_FILE);
+    W25Q80 chip(IMAGE_FILE);
+    LCDModel lcd;
+    flash.begin();
+    tft.begin();
+    hostQuiet = true;
+    provisionTestBitmaps();
+    hostQuiet = false;
+    initBitmapCache();
+    // The logo is too big to be cached unless it is pinned
+    pinBitmapInCache(BITMAP_CONTROLEO3_SMALL);
+
+    // Load the RAM cache and the glyphs' directory entries
+    for (const auto &c : cases)
+        c.draw();
+    tft.waitUntilIdle();
+
+    printf("%-28s %9s %9s %6s %9s %9s %9s %9s %11s\n", "Drawing", "ms", "Accesses", "CS", "Commands", "Bytes", "Strobes",
+           "Pixels", "Flash bytes");
+    for (const auto &c : cases) {
+        lcd.resetStatistics();
+        chip.resetStatistics();
+        uint64_t start = hostCycleCount();
+        c.draw();
+        tft.waitUntilIdle();
+        uint64_t cycles = hostCycleCount() - start;
+        uint32_t commands = 0;
+        for (uint16_t i=0; i < 256; i++)
+            commands += lcd.stats.commands[i];
+        printf("%-28s %9.3f %9u %6u %9u %9u %9u %9u %11u\n", c.name, cycles / (HOST_CPU_MHZ * 1000.0),
+               (unsigned int) (cycles / 2), (unsigned int) lcd.stats.transactions, (unsigned int) commands,
+               (unsigned int) lcd.stats.bytesWritten, (unsigned int) lcd.stats.strobes, (unsigned int) lcd.stats.pixelsWritten,
+               (unsigned int) chip.stats.bytesRead);
+        if (lcd.violations())
+            lcd.printStatistics();
+    }
+
+    printf("\nBitmaps in microcontroller flash:\n");
+    printf("%-28s %9s %9s %9s %9s %9s %8s\n", "Bitmaps", "Raw ms", "RLE ms", "Saving", "Raw acc.", "RLE acc.", "Strobes");
+    const struct {
+        const char *name;
+        uint16_t first, last;
+    } groups[] = {{"Font glyphs", 0, FONT_IMAGES - 1}, {"Icons and buttons", FONT_IMAGES, BITMAP_LAST_ONE}};
+    for (const auto &g : groups) {
+        busCost raw = drawMCUBitmaps(lcd, g.first, g.last, true);
+        busCost rle = drawMCUBitmaps(lcd, g.first, g.last, false);
+        printf("%-28s %9.3f %9.3f %8.1f%% %9u %9u %7.1f%%\n", g.name, raw.cycles / (HOST_CPU_MHZ * 1000.0),
+               rle.cycles / (HOST_CPU_MHZ * 1000.0), 100.0 * (raw.cycles - rle.cycles) / raw.cycles,
+               (unsigned int) (raw.cycles / 2), (unsigned int) (rle.cycles / 2), 100.0 * rle.strobes / rle.bytes);
+        if (lcd.violations())
+            lcd.printStatistics();
+    }
+
+
+    printf("\nScreen transitions:\n");
+    printf("%-28s %9s %9s %9s %11s %11s %9s\n", "Screen", "Drawn ms", "Save ms", "Blit ms", "Blit pages", "Flash bytes", "Next ms");
+    hostQuiet = true;
+    initScreenBackgrounds();
+    hostQuiet = false;
+    for (const auto &s : screens) {
+        uint64_t drawn = showScreen(s.screen, s.draw, false);
+        hostQuiet = true;
+        uint64_t saved = showScreen(s.screen, s.draw, true) - drawn;
+        hostQuiet = false;
+        chip.resetStatistics();
+        lcd.resetStatistics();
+        hostQuiet = true;
+        uint64_t blit = showScreen(s.screen, s.draw, true);
+        uint32_t bytesRead = chip.stats.bytesRead;
+        uint64_t next = showScreen(s.screen, s.draw, true);
+        hostQuiet = false;
+        printf("%-28s %9.3f %9.1f %9.3f %11u %11u %9.3f%s\n", s.name, drawn / (HOST_CPU_MHZ * 1000.0), saved / (HOST_CPU_MHZ * 1000.0),
+               blit / (HOST_CPU_MHZ * 1000.0), (unsigned int) ((bytesRead + W25Q80_PAGE_SIZE - 1) / W25Q80_PAGE_SIZE),
+               (unsigned int) bytesRead, next / (HOST_CPU_MHZ * 1000.0), hasScreenBackground(s.screen)? "" : " (drawn)");
+        if (lcd.violations())
+            lcd.printStatistics();
+    }
+
+    printf("\n(Simulated time: PORT accesses take 2 cycles, and nothing else takes any time, so Accesses\n"
+           " is the time in PORT accesses.  A DMA fill takes 2 cycles per WR toggle.  Strobes are bytes\n"
+           " latched by toggling WR alone.  Flash bytes are read from the external flash.  Raw is each\n"
+           " bitmap's pixels written with drawBitmap(), as before drawBitmapRLE().  Next is the transition\n"
+           " after the first blit: a screen whose blit was slower than drawing it is drawn from then on.)\n");
+    return 0;
+}
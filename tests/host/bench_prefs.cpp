@@ -0,0 +1,113 @@
+// What saving the prefs costs the external flash (Prefs.cpp): page programs, bytes sent to
+// the chip, 4K erases and busy time per save for different kinds of change, including the
+// snapshots written when a block fills up.  Before the records, every save was a 4K erase
+// and a program of the whole prefs.  Also how long getPrefs() takes as a block fills up.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "ReflowWizard.h"
+#include "FlashCache.h"
+#include "Prefs.h"
+#include "NVMModel.h"
+#include "W25Q80.h"
+
+#define IMAGE_FILE                  "bench_prefs.img"
+#define SAVES                       1000
+
+
+struct prefsChange {
+    const char *name;
+    void (*change)(int i);
+};
+
+static void changeReflows(int)          { prefs.numReflows++; }
+static void changeLearning(int i)       { prefs.learnedPower[i % 4] = i; prefs.learnedInertia[i % 4] = i * 3; prefs.learnedInsulation = i; }
+static void changeProfileName(int i)    { snprintf(prefs.profile[i % MAX_PROFILES].name, MAX_PROFILE_NAME_LENGTH + 1, "Profile %d", i); }
+static void changeBakeTemperature(int i) { prefs.bakeTemperature = 50 + i % 200; }
+static void changeAllProfiles(int i)
+{
+    for (int p=0; p < MAX_PROFILES; p++)
+        snprintf(prefs.profile[p].name, MAX_PROFILE_NAME_LENGTH + 1, "Profile %d-%d", p, i);
+}
+
+static const prefsChange changes[] = {
+    {"Reflow count (2 bytes)", changeReflows},
+    {"Learned values (5 fields)", changeLearning},
+    {"Profile name", changeProfileName},
+    {"Bake temperature (NVM)", changeBakeTemperature},
+    {"Every profile name", changeAllProfiles},
+};
+
+
+static void save()
+{
+    hostQuiet = true;
+    writePrefsToFlash();
+    hostQuiet = false;
+}
+
+
+int main()
+{
+    unlink(IMAGE_FILE);
+    W25Q80 chip(IMAGE_FILE);
+    NVMModel nvm;
+    flash.begin();
+    hostQuiet = true;
+    getPrefs();
+    hostQuiet = false;
+    save();
+
+    // A whole snapshot for every save
+    uint32_t prefsPages = (sizeof(Controleo3Prefs) + W25Q80_PAGE_SIZE - 1) / W25Q80_PAGE_SIZE;
+    printf("%-28s %12s %12s %12s %12s\n", "Change", "Pages/save", "Bytes/save", "Saves/erase", "Busy ms/save");
+    printf("%-28s %12.2f %12.1f %12.1f %12.3f\n", "Before the records (any)", (double) prefsPages, (double) sizeof(Controleo3Prefs),
+           1.0, (W25Q80::typical.erase4K + prefsPages * W25Q80::typical.programPage) / 1000.0);
+
+    for (const prefsChange &c : changes) {
+        chip.resetStatistics();
+        for (int i=0; i < SAVES; i++) {
+            c.change(i);
+            save();
+        }
+        char savesPerErase[16] = "-";
+        if (chip.stats.sectorErases)
+            snprintf(savesPerErase, sizeof(savesPerErase), "%.1f", (double) SAVES / chip.stats.sectorErases);
+        printf("%-28s %12.2f %12.1f %12s %12.3f\n", c.name, (double) chip.stats.pagesProgrammed / SAVES,
+               (double) chip.stats.bytesProgrammed / SAVES, savesPerErase, chip.stats.busyMicros / 1000.0 / SAVES);
+    }
+    printf("(Bytes/save is what is sent to the chip.  A record is programmed from the start of its page, with\n"
+           " 0xFF for the records already there.)\n\n");
+    PrintPrefsStats();
+
+    // Startup, from a new block until the block is full
+    uint32_t erases = chip.stats.sectorErases;
+    while (chip.stats.sectorErases == erases) {
+        changeReflows(0);
+        save();
+    }
+    uint64_t fastest = ~0ULL, slowest = 0;
+    uint32_t saves, mostBytesRead = 0;
+    erases = chip.stats.sectorErases;
+    for (saves=0; chip.stats.sectorErases == erases; saves++) {
+        invalidateFlashCache(0, 4096);
+        uint32_t bytesRead = chip.stats.bytesRead;
+        uint64_t start = hostMicros();
+        hostQuiet = true;
+        getPrefs();
+        hostQuiet = false;
+        uint64_t micros = hostMicros() - start;
+        fastest = micros < fastest? micros : fastest;
+        if (micros > slowest) {
+            slowest = micros;
+            mostBytesRead = chip.stats.bytesRead - bytesRead;
+        }
+        changeReflows(0);
+        save();
+    }
+    printf("\ngetPrefs(): %.2f ms with a new block, %.2f ms (%u bytes read) with %u saves in it\n", fastest / 1000.0,
+           slowest / 1000.0, (unsigned int) mostBytesRead, (unsigned int) saves - 1);
+    printf("(Simulated time: PORT accesses take 2 cycles, and nothing else takes any time)\n");
+    return 0;
+}
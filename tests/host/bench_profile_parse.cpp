@@ -0,0 +1,125 @@
+// What reading a profile file a character at a time costs (ReadProfiles.cpp,
+// Controleo3File.cpp): every profile on a test card is read from the SD card model and
+// fed to the token search, the way processFile() reads it, through File::available() and
+// File::read() for each character as the parser did before, and through FileReader.
+// Simulated time only counts the PORT accesses to the card, so the host's CPU time is
+// given as well; the per-character overhead is CPU time.
+#include <stdio.h>
+#include <time.h>
+#include "ReadProfiles.h"
+#include "SDCardModel.h"
+#include "FatImage.h"
+#include "TestProfiles.h"
+
+#define PROFILES                    20
+#define PASSES                      2000
+
+
+static uint8_t readBuffer[512];
+
+static uint32_t parseByCharacter(File &file)
+{
+    uint32_t tokens = 0;
+    while (file.available())
+        tokens += hasTokenBeenFound(file.read()) != NOT_A_TOKEN;
+    return tokens;
+}
+
+static uint32_t parseWithFileReader(File &file)
+{
+    FileReader reader(&file, readBuffer, sizeof(readBuffer));
+    uint32_t tokens = 0;
+    int c;
+    while ((c = reader.getc()) >= 0)
+        tokens += hasTokenBeenFound(c) != NOT_A_TOKEN;
+    return tokens;
+}
+
+
+struct parser {
+    const char *name;
+    uint32_t (*parse)(File &file);
+};
+
+static const parser parsers[] = {
+    {"File::read() per character", parseByCharacter},
+    {"FileReader (512 bytes)", parseWithFileReader},
+};
+
+
+int main()
+{
+    FatImage image;
+    SDCardModel card(image.data(), image.blocks());
+    char path[64];
+
+    if (!addTestProfiles(image, PROFILES, 4, 2)) {
+        printf("Can't make the card\n");
+        return 1;
+    }
+    hostQuiet = true;
+    SD.begin();
+    hostQuiet = false;
+
+    printf("%-28s %9s %9s %9s %9s %9s %9s %11s\n", "Reading", "Bytes", "Tokens", "Lookups", "Bus ms", "CMD17", "CMD18",
+           "Host MB/s");
+    for (const parser &p : parsers) {
+        uint32_t bytes = 0, tokens = 0, warmBytes = 0, files = 0;
+        uint64_t cycles = 0;
+        clock_t cpu = 0;
+        bool allMatch = true;
+
+        // Every profile, from the card
+        card.resetStatistics();
+        sdCacheStats = {};
+        for (uint16_t n=0; n < PROFILES; n++) {
+            getTestProfilePath(path, n);
+            File file = SD.open(path);
+            // processFile() reads "Controleo3" first
+            file.seek(10);
+            initTokenPtrs();
+            uint64_t start = hostCycleCount();
+            tokens += p.parse(file);
+            cycles += hostCycleCount() - start;
+            bytes += file.size() - 10;
+            file.close();
+        }
+        uint32_t lookups = sdCacheStats.hits + sdCacheStats.misses;
+        printf("%-28s %9u %9u %9u %9.2f %9u %9u", p.name, bytes, tokens, lookups, cycles / (HOST_CPU_MHZ * 1000.0),
+               card.stats.commands[17], card.stats.commands[18]);
+
+        // The profiles that fit in the volume cache, parsed again with nothing to read from the
+        // card.  Reading a character at a time puts every block of the file in the cache, and
+        // FileReader copies whole blocks from there when they are in it
+        for (uint16_t n=0; n < PROFILES; n++) {
+            getTestProfilePath(path, n);
+            File file = SD.open(path);
+            if (file.size() <= SD_CACHE_BLOCKS * 512) {
+                file.seek(10);
+                initTokenPtrs();
+                uint32_t warmTokens = parseByCharacter(file);
+                uint32_t cardBytes = card.stats.bytes;
+                clock_t startCPU = clock();
+                for (int pass=0; pass < PASSES; pass++) {
+                    file.seek(10);
+                    initTokenPtrs();
+                    allMatch &= p.parse(file) == warmTokens;
+                }
+                cpu += clock() - startCPU;
+                allMatch &= card.stats.bytes == cardBytes;
+                warmBytes += (file.size() - 10) * PASSES;
+                files++;
+            }
+            file.close();
+        }
+        printf(" %11.1f\n", warmBytes / 1e6 / ((double) cpu / CLOCKS_PER_SEC));
+        if (!allMatch || card.violations())
+            printf("  The cached passes didn't match, or went to the card.  %u violations\n", card.violations());
+        if (p.parse == parseByCharacter)
+            printf("  (Host MB/s from %u profiles that fit in the cache, parsed %d times each)\n", files, PASSES);
+    }
+    printf("(%d profiles.  Lookups are SdFile::read() calls that went through the volume cache.  Bus ms is\n"
+           "simulated time, which only counts PORT accesses, so the per-character work only shows in the host's\n"
+           "CPU time, measured on this machine for comparing the two.)\n", PROFILES);
+    return 0;
+}
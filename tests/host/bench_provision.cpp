@@ -0,0 +1,116 @@
+// How long writing every bitmap to the external flash takes (FlashProvision.cpp), against
+// the old way: a chip erase, then getBitmapPage() for each bitmap (two address table reads
+// and a table write) followed by its pixel pages.  The test bitmaps are used, with the
+// datasheet's typical and maximum program and erase times.  Provisioning is timed erasing
+// just the pages the bitmaps need, as installing an asset pack does, and erasing the whole
+// bitmap area.
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "ReflowWizard.h"
+#include "FlashProvision.h"
+#include "TestBitmaps.h"
+#include "W25Q80.h"
+
+#define IMAGE_FILE                  "bench_provision.img"
+
+
+// Every bitmap written the old way.  Nothing is read back.
+static void provisionOneAtATime()
+{
+    uint8_t buffer[W25Q80_PAGE_SIZE];
+
+    flash.eraseFlash();
+    flash.allowWritingToBitmaps(true);
+    for (uint16_t i=0; i <= BITMAP_LAST_ONE; i++) {
+        uint16_t width, height;
+        getTestBitmapSize(i, &width, &height);
+        uint16_t page = flash.getBitmapPage(i, width, height);
+        uint32_t bytes = (uint32_t) width * height * 2;
+        for (uint32_t offset=0; offset < bytes; offset += W25Q80_PAGE_SIZE, page++) {
+            uint16_t length = bytes - offset < W25Q80_PAGE_SIZE? bytes - offset : W25Q80_PAGE_SIZE;
+            for (uint16_t b=0; b < length; b++) {
+                uint16_t pixel = getTestBitmapPixel(i, (offset + b) >> 1);
+                buffer[b] = ((offset + b) & 1)? pixel >> 8 : pixel & 0xFF;
+            }
+            flash.write(page, length, buffer);
+        }
+    }
+    flash.allowWritingToBitmaps(false);
+}
+
+
+static uint16_t bitmapPages;
+
+
+static bool provisionInBulk(uint16_t pages)
+{
+    hostQuiet = true;
+    bool ok = provisionTestBitmaps(pages);
+    hostQuiet = false;
+    return ok;
+}
+
+
+static bool provisionWholeArea()
+{
+    return provisionInBulk(0);
+}
+
+
+static bool provisionNeededPages()
+{
+    return provisionInBulk(bitmapPages);
+}
+
+
+static void run(W25Q80 &chip, const char *name, bool (*provision)())
+{
+    flash.begin();
+    chip.resetStatistics();
+    uint64_t start = hostMicros();
+    bool ok = provision();
+    uint64_t micros = hostMicros() - start;
+    printf("%-26s %10.1f %10.1f %8u %8u %8u %10u %10u %9s\n", name, micros / 1000.0, chip.stats.busyMicros / 1000.0,
+           (unsigned int) chip.stats.chipErases, (unsigned int) chip.stats.blockErases, (unsigned int) chip.stats.sectorErases,
+           (unsigned int) chip.stats.pagesProgrammed, (unsigned int) chip.stats.bytesRead, ok? "yes" : "no");
+    if (chip.violations())
+        chip.printStatistics();
+}
+
+
+static bool oneAtATime()
+{
+    provisionOneAtATime();
+    return false;
+}
+
+
+int main()
+{
+    unlink(IMAGE_FILE);
+    W25Q80 chip(IMAGE_FILE);
+    const struct {
+        const char *name;
+        const W25Q80::Timing *timing;
+    } timings[] = {{"typical", &W25Q80::typical}, {"maximum", &W25Q80::maximum}};
+
+    for (uint16_t i=0; i <= BITMAP_LAST_ONE; i++) {
+        uint16_t width, height;
+        getTestBitmapSize(i, &width, &height);
+        bitmapPages += ((uint32_t) width * height * 2 + W25Q80_PAGE_SIZE - 1) / W25Q80_PAGE_SIZE;
+    }
+    printf("%u bitmaps, %u pages\n", (unsigned int) BITMAP_LAST_ONE + 1, (unsigned int) bitmapPages);
+    for (const auto &t : timings) {
+        chip.setTiming(*t.timing);
+        printf("\nWith the %s times:\n", t.name);
+        printf("%-26s %10s %10s %8s %8s %8s %10s %10s %9s\n", "Path", "Total ms", "Busy ms", "Chip", "64K", "4K", "Pages",
+               "Bytes read", "Verified");
+        run(chip, "getBitmapPage()", oneAtATime);
+        run(chip, "provisionBitmap()", provisionNeededPages);
+        run(chip, "  erasing the whole area", provisionWholeArea);
+    }
+    printf("\n(Simulated time: PORT accesses take 2 cycles, and nothing else takes any time.  Bytes read\n"
+           " are the address table reads for getBitmapPage(), and the read back for provisionBitmap().)\n");
+    return 0;
+}
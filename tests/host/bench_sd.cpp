@@ -0,0 +1,88 @@
+// What SD card transfers cost (Sd2Card.cpp): simulated time, commands and bytes clocked to
+// read and write 400 blocks in sequence, where Sd2Card streams them through one CMD18 or
+// CMD25, against the same blocks out of sequence, which is a CMD17 (or a CMD24 and a CMD13)
+// for every block, as every transfer was before the multi-block reads and writes.
+#include <stdio.h>
+#include <string.h>
+#include "SdFat.h"
+#include "SDCardModel.h"
+#include "FatImage.h"
+
+#define FIRST_BLOCK                 4096
+#define BLOCKS                      400
+
+
+static Sd2Card sd;
+static uint8_t data[512];
+
+// Every block in order, or the even ones and then the odd ones
+static uint32_t blockNumber(int i, bool inOrder)
+{
+    if (inOrder)
+        return FIRST_BLOCK + i;
+    return FIRST_BLOCK + (i < BLOCKS / 2? i * 2 : (i - BLOCKS / 2) * 2 + 1);
+}
+
+static void readBlocks(bool inOrder)
+{
+    for (int i=0; i < BLOCKS; i++)
+        sd.readBlock(blockNumber(i, inOrder), data);
+    sd.stopStream();
+}
+
+static void writeBlocks(bool inOrder)
+{
+    for (int i=0; i < BLOCKS; i++)
+        sd.writeBlock(blockNumber(i, inOrder), data);
+    sd.stopStream();
+}
+
+// Sequential, with the count known so the card can pre-erase
+static void writeCounted(bool)
+{
+    for (int i=0; i < BLOCKS; i++)
+        sd.writeBlock(FIRST_BLOCK + i, data, BLOCKS - i);
+    sd.stopStream();
+}
+
+
+struct transfer {
+    const char *name;
+    void (*run)(bool inOrder);
+    bool inOrder;
+};
+
+static const transfer transfers[] = {
+    {"Read, in sequence", readBlocks, true},
+    {"Read, out of sequence", readBlocks, false},
+    {"Write, in sequence", writeBlocks, true},
+    {"Write, count known", writeCounted, true},
+    {"Write, out of sequence", writeBlocks, false},
+};
+
+
+int main()
+{
+    FatImage image(FAT_IMAGE_BLOCKS);
+    SDCardModel card(image.data(), image.blocks());
+    hostQuiet = true;
+    sd.init();
+
+    printf("%-28s %9s %9s %9s %9s %9s %11s\n", "Transfer", "ms", "KB/s", "Commands", "CMD17/24", "CMD18/25", "Bytes");
+    for (const transfer &t : transfers) {
+        card.resetStatistics();
+        uint64_t start = hostCycleCount();
+        t.run(t.inOrder);
+        uint64_t cycles = hostCycleCount() - start;
+        double ms = cycles / (HOST_CPU_MHZ * 1000.0);
+        printf("%-28s %9.1f %9.1f %9u %9u %9u %11u\n", t.name, ms, BLOCKS * 512 / 1.024 / ms, card.commandCount(),
+               card.stats.commands[17] + card.stats.commands[24], card.stats.commands[18] + card.stats.commands[25],
+               card.stats.bytes);
+        if (card.violations())
+            printf("  %u violations\n", card.violations());
+    }
+    printf("\n(%u blocks.  The card model takes %uus to find a block, for a CMD18 as well as a CMD17, and\n"
+           "%uus to program one.  The rest is the bit-banged SPI at 2 cycles per PORT access.)\n", BLOCKS,
+           SDCardModel::typical.readBlock, SDCardModel::typical.programBlock);
+    return 0;
+}
@@ -0,0 +1,91 @@
+// What the SdVolume block cache saves when profiles are imported (SdVolume.cpp,
+// ReadProfiles.cpp): simulated time, cache hits, misses and write-backs, and the blocks and
+// commands the SD card model saw, for the first import of a card with profiles in nested
+// directories among other files, importing it again unchanged, and again after some
+// profiles were edited.  The Makefile builds it twice, with the default cache and with
+// SD_CACHE_BLOCKS=1 (the single block cache SdVolume had before).
+#include <stdio.h>
+#include <unistd.h>
+#include "ReflowWizard.h"
+#include "FlashCache.h"
+#include "Prefs.h"
+#include "SdFat.h"
+#include "NVMModel.h"
+#include "W25Q80.h"
+#include "SDCardModel.h"
+#include "FatImage.h"
+#include "TestProfiles.h"
+
+#define IMAGE_FILE                  "bench_sd_cache.img"
+#define PROFILES                    24
+#define VENDORS                     6
+#define OTHER_FILES                 6
+#define EDITED_PROFILES             4
+
+
+static FatImage *fat;
+
+static void noChange()      {}
+static void editProfiles()
+{
+    static char profile[TEST_PROFILE_MAX_SIZE];
+    char path[64];
+
+    for (int n=0; n < EDITED_PROFILES; n++) {
+        uint32_t size = makeTestProfile(profile, n * 5, 1);
+        getTestProfilePath(path, n * 5);
+        fat->writeFile(path, profile, size, FAT_DATE(2021, 6, 1));
+    }
+}
+
+
+struct import {
+    const char *name;
+    void (*change)();
+};
+
+static const import imports[] = {
+    {"First import", noChange},
+    {"Unchanged", noChange},
+    {"4 profiles edited", editProfiles},
+};
+
+
+int main()
+{
+    unlink(IMAGE_FILE);
+    W25Q80 chip(IMAGE_FILE);
+    NVMModel nvm;
+    FatImage image;
+    SDCardModel card(image.data(), image.blocks());
+    fat = &image;
+    if (!addTestProfiles(image, PROFILES, VENDORS, OTHER_FILES)) {
+        printf("Can't make the card\n");
+        return 1;
+    }
+    flash.begin();
+    hostQuiet = true;
+    getPrefs();
+    hostQuiet = false;
+
+    printf("SD cache of %d block%s, %d profiles in %d directories with %d other files:\n", SD_CACHE_BLOCKS,
+           SD_CACHE_BLOCKS == 1? "" : "s", PROFILES, VENDORS * 4, VENDORS * 4 * OTHER_FILES);
+    printf("%-28s %9s %9s %9s %9s %11s %11s %9s\n", "Import", "ms", "Imported", "Hits", "Misses", "Write-backs",
+           "Blocks read", "Commands");
+    for (const import &i : imports) {
+        i.change();
+        card.resetStatistics();
+        sdCacheStats = {};
+        uint64_t start = hostCycleCount();
+        hostQuiet = true;
+        int imported = importTestProfiles();
+        hostQuiet = false;
+        uint64_t cycles = hostCycleCount() - start;
+        printf("%-28s %9.1f %9d %9u %9u %11u %11u %9u\n", i.name, cycles / (HOST_CPU_MHZ * 1000.0), imported,
+               sdCacheStats.hits, sdCacheStats.misses, sdCacheStats.writebacks, card.stats.blocksRead, card.commandCount());
+        if (imported < 0 || card.violations())
+            printf("  Failed: %s, %u violations\n", imported < 0? "no card" : "imported", card.violations());
+    }
+    printf("(Simulated time includes writing the profiles to the external flash model.)\n\n");
+    return 0;
+}
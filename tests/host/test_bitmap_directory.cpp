@@ -0,0 +1,130 @@
+// The RAM bitmap directory in Controleo3Flash: bitmap sizes and pages come from RAM, so
+// drawing text only reads the glyphs from flash, and not the address table
+#include <string.h>
+#include <unistd.h>
+#include "ReflowWizard.h"
+#include "Bitmaps.h"
+#include "FlashCache.h"
+#include "Render.h"
+#include "W25Q80.h"
+#include "TestBitmaps.h"
+#include "HostTest.h"
+
+#define IMAGE_FILE                  "test_bitmap_directory.img"
+
+
+static void testDirectory(W25Q80 &chip)
+{
+    uint16_t width, height, expectedWidth, expectedHeight;
+    bool allMatch = true;
+
+    testStart("Directory");
+    uint32_t transactions = chip.stats.transactions;
+    for (uint16_t i=0; i <= BITMAP_LAST_ONE; i++) {
+        getTestBitmapSize(i, &expectedWidth, &expectedHeight);
+        uint16_t page = flash.getBitmapInfo(i, &width, &height);
+        allMatch &= page >= 528 && page < 4096 && width == expectedWidth && height == expectedHeight;
+    }
+    CHECK(allMatch);
+    CHECK_EQUAL(chip.stats.transactions - transactions, 0);
+
+    // The directory is loaded again by begin()
+    flash.begin();
+    flash.getBitmapInfo(BITMAP_LAST_ONE, &width, &height);
+    getTestBitmapSize(BITMAP_LAST_ONE, &expectedWidth, &expectedHeight);
+    CHECK_EQUAL(width, expectedWidth);
+    CHECK_EQUAL(height, expectedHeight);
+}
+
+
+static void testDisplayString(W25Q80 &chip)
+{
+    char str[] = "HELLO, WORLD! (2+2=4)";
+    uint8_t font = FONT_12PT_BLACK_ON_WHITE;
+    uint32_t glyphs = 0, glyphBytes = 0;
+
+    testStart("displayString");
+
+    // The glyphs that are read from external flash (the rest are in microcontroller flash)
+    for (char *c = str; *c; c++) {
+        uint8_t glyphFont = font;
+        uint16_t width, height;
+        if (*c == ' ')
+            continue;
+        uint16_t bitmapNumber = getBitmapNumberForCharacter(&glyphFont, *c);
+        if (flashBitmaps[bitmapNumber])
+            continue;
+        getTestBitmapSize(bitmapNumber, &width, &height);
+        glyphs++;
+        glyphBytes += width * height * 2;
+    }
+
+    chip.resetStatistics();
+    displayString(10, 10, font, str);
+    uint32_t transactions = chip.stats.transactions, bytes = chip.stats.bytesRead;
+
+    // Only the glyphs are read
+    CHECK(glyphs > 0);
+    CHECK_EQUAL(bytes, glyphBytes);
+    CHECK_EQUAL(chip.stats.commands[0xE3], glyphs);
+
+    // Getting a bitmap's page from the address table (as getBitmapInfo() did for every
+    // glyph before the directory, and still does for bitmaps after the directory)
+    invalidateFlashCache(0, 4096);
+    chip.resetStatistics();
+    uint16_t width, height;
+    flash.getBitmapInfo(FLASH_BITMAP_DIRECTORY_SIZE, &width, &height);
+    uint32_t tableTransactions = chip.stats.transactions, tableBytes = chip.stats.bytesRead;
+    CHECK_EQUAL(tableBytes, 256);
+
+    printf("  \"%s\": %u glyphs from flash, %u transactions and %u bytes\n", str, glyphs, transactions, bytes);
+    printf("  Reading the address table for each glyph would add %u transactions and %u bytes\n",
+           glyphs * tableTransactions, glyphs * tableBytes);
+}
+
+
+static void testProvisioningUpdatesDirectory(W25Q80 &chip)
+{
+    uint16_t width, height;
+
+    testStart("Writing and erasing bitmaps");
+
+    // Bitmaps written one at a time update the directory
+    flash.eraseFlash();
+    CHECK_EQUAL(flash.getBitmapInfo(5, &width, &height), 0xFFFF);
+    flash.allowWritingToBitmaps(true);
+    CHECK_EQUAL(flash.getBitmapPage(0, 20, 30), 528);
+    CHECK_EQUAL(flash.getBitmapPage(1, 16, 16), 528 + 5);
+    flash.allowWritingToBitmaps(false);
+    CHECK_EQUAL(flash.getBitmapInfo(1, &width, &height), 528 + 5);
+    CHECK_EQUAL(width, 16);
+    CHECK_EQUAL(height, 16);
+
+    // Provisioning replaces the directory
+    CHECK(provisionTestBitmaps());
+    uint16_t expectedWidth, expectedHeight;
+    getTestBitmapSize(1, &expectedWidth, &expectedHeight);
+    flash.getBitmapInfo(1, &width, &height);
+    CHECK_EQUAL(width, expectedWidth);
+    CHECK_EQUAL(height, expectedHeight);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+int main()
+{
+    unlink(IMAGE_FILE);
+    W25Q80 chip(IMAGE_FILE);
+    flash.begin();
+    hostQuiet = true;
+    CHECK(provisionTestBitmaps());
+    hostQuiet = false;
+
+    testDirectory(chip);
+    testDisplayString(chip);
+    hostQuiet = true;
+    testProvisioningUpdatesDirectory(chip);
+    hostQuiet = false;
+    CHECK_EQUAL(chip.violations(), 0);
+    return testResult("test_bitmap_directory");
+}
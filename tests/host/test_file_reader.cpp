@@ -0,0 +1,121 @@
+// FileReader on the SD card model: getc() and peek() give the file's bytes from any
+// starting position and with any buffer size, the end of the file is found, reads after
+// the first are whole blocks that go straight to the card, and profiles parse to the same
+// tokens through it as through File::read().
+#include <string.h>
+#include "ReadProfiles.h"
+#include "SDCardModel.h"
+#include "FatImage.h"
+#include "TestProfiles.h"
+#include "HostTest.h"
+
+#define FILE_SIZE                   5000
+
+
+static uint8_t contents[FILE_SIZE];
+static uint8_t buffer[1024];
+
+
+// Read the file through a FileReader from start, checking every byte
+static bool readsFile(uint32_t start, uint16_t bufferSize)
+{
+    File file = SD.open("/DATA.BIN");
+    bool allMatch = file && file.seek(start);
+    FileReader reader(&file, buffer, bufferSize);
+    uint32_t position = start;
+    int c;
+
+    while (allMatch && reader.available()) {
+        allMatch &= reader.peek() == contents[position];
+        c = reader.getc();
+        allMatch &= c == contents[position++];
+    }
+    allMatch &= position == FILE_SIZE;
+    allMatch &= reader.getc() == -1 && reader.peek() == -1 && !reader.available();
+    file.close();
+    return allMatch;
+}
+
+
+static void testReads()
+{
+    static const uint32_t starts[] = {0, 1, 10, 511, 512, 513, 4999, 5000};
+    static const uint16_t sizes[] = {512, 1024, 100};
+
+    testStart("Reads");
+    for (uint16_t size : sizes)
+        for (uint32_t start : starts)
+            CHECK(readsFile(start, size));
+}
+
+
+static void testAlignedReads(SDCardModel &card)
+{
+    testStart("Aligned reads");
+    // Only the first, partial, block and the FAT (for the next two clusters) go through
+    // the volume cache
+    File file = SD.open("/DATA.BIN");
+    card.resetStatistics();
+    sdCacheStats = {};
+    file.seek(10);
+    FileReader reader(&file, buffer, 512);
+    uint32_t n = 0;
+    while (reader.getc() >= 0)
+        n++;
+    CHECK_EQUAL(n, FILE_SIZE - 10);
+    CHECK_EQUAL(sdCacheStats.hits + sdCacheStats.misses, 3);
+    CHECK_EQUAL(card.stats.commands[17] + card.stats.commands[18], 2);
+    file.close();
+    CHECK_EQUAL(card.violations(), 0);
+}
+
+
+static void testProfiles()
+{
+    char path[64];
+    bool allMatch = true;
+
+    testStart("Profiles");
+    for (uint16_t n=0; n < 8; n++) {
+        uint32_t tokens[2] = {0, 0};
+        getTestProfilePath(path, n);
+        for (int i=0; i < 2; i++) {
+            File file = SD.open(path);
+            file.seek(10);
+            initTokenPtrs();
+            if (i == 0) {
+                while (file.available())
+                    tokens[i] += hasTokenBeenFound(file.read()) != NOT_A_TOKEN;
+            }
+            else {
+                FileReader reader(&file, buffer, 512);
+                int c;
+                while ((c = reader.getc()) >= 0)
+                    tokens[i] += hasTokenBeenFound(c) != NOT_A_TOKEN;
+            }
+            file.close();
+        }
+        allMatch &= tokens[0] > 30 && tokens[0] == tokens[1];
+    }
+    CHECK(allMatch);
+}
+
+
+int main()
+{
+    FatImage image;
+    SDCardModel card(image.data(), image.blocks());
+
+    for (uint32_t i=0; i < FILE_SIZE; i++)
+        contents[i] = i * 37 + (i >> 8);
+    CHECK(image.writeFile("/DATA.BIN", contents, FILE_SIZE));
+    CHECK(addTestProfiles(image, 8, 2, 0));
+    hostQuiet = true;
+    CHECK(SD.begin());
+
+    testReads();
+    testAlignedReads(card);
+    testProfiles();
+    CHECK_EQUAL(card.violations(), 0);
+    return testResult("test_file_reader");
+}
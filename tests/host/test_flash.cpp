@@ -0,0 +1,257 @@
+// Controleo3Flash against the W25Q80 model: protection, program and erase, busy timing,
+// erase suspend, and the flash image surviving a power cycle
+#include <string.h>
+#include <unistd.h>
+#include "ReflowWizard.h"
+#include "W25Q80.h"
+#include "HostTest.h"
+
+#define IMAGE_FILE                  "test_flash.img"
+
+
+static void fillPage(uint8_t *page, uint8_t seed)
+{
+    for (uint16_t i=0; i < 256; i++)
+        page[i] = (uint8_t) (i * 7 + seed);
+}
+
+
+static bool pageIs(W25Q80 &chip, uint16_t page, const uint8_t *data)
+{
+    return memcmp(chip.memory() + page * 256, data, 256) == 0;
+}
+
+
+static bool pageErased(W25Q80 &chip, uint16_t page)
+{
+    for (uint16_t i=0; i < 256; i++)
+        if (chip.memory()[page * 256 + i] != 0xFF)
+            return false;
+    return true;
+}
+
+
+static void testIdentification(W25Q80 &chip)
+{
+    testStart("Identification");
+    CHECK(flash.verifyFlashIC());
+    CHECK_EQUAL(flash.readUniqueID(), 0xD2663844);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+static void testProtection(W25Q80 &chip)
+{
+    uint8_t data[256];
+
+    testStart("Protection");
+    fillPage(data, 1);
+    chip.resetStatistics();
+
+    // begin() protects everything
+    flash.write(0, 256, data);
+    flash.waitUntilNotBusy(50);
+    CHECK_EQUAL(chip.stats.protectedWrites, 1);
+    CHECK(pageErased(chip, 0));
+
+    // The prefs and profiles (the lower 128K) can be written, but not the bitmaps
+    flash.allowWritingToPrefs(true);
+    flash.write(0, 256, data);
+    flash.write(511, 256, data);
+    flash.write(512, 256, data);
+    flash.waitUntilNotBusy(50);
+    CHECK(pageIs(chip, 0, data));
+    CHECK(pageIs(chip, 511, data));
+    CHECK(pageErased(chip, 512));
+    CHECK_EQUAL(chip.stats.protectedWrites, 2);
+
+    flash.allowWritingToBitmaps(true);
+    flash.write(512, 256, data);
+    flash.waitUntilNotBusy(50);
+    CHECK(pageIs(chip, 512, data));
+    flash.allowWritingToBitmaps(false);
+    CHECK_EQUAL(chip.stats.pagesProgrammed, 3);
+    CHECK_EQUAL(chip.stats.notWriteEnabled, 0);
+    CHECK_EQUAL(chip.stats.busyCommands, 0);
+
+    // The protection set by begin() is volatile
+    CHECK_EQUAL(chip.stats.statusWrites, 0);
+}
+
+
+static void testProgramAndErase(W25Q80 &chip)
+{
+    uint8_t data[256], other[256], read[256];
+
+    testStart("Program and erase");
+    fillPage(data, 2);
+    fillPage(other, 3);
+    flash.erasePrefsBlock(1);
+    flash.allowWritingToPrefs(true);
+    chip.resetStatistics();
+
+    // Quad and single-bit reads and writes agree
+    flash.write(16, 256, data);
+    flash.slowWrite(17, 256, data);
+    flash.slowRead(16, 256, read);
+    CHECK(memcmp(read, data, 256) == 0);
+    flash.startRead(17, 256, read);
+    flash.endRead();
+    CHECK(memcmp(read, data, 256) == 0);
+
+    // Programming without erasing can only clear bits
+    flash.write(16, 256, other);
+    flash.waitUntilNotBusy(50);
+    CHECK(chip.stats.unerasedBits > 0);
+    CHECK_EQUAL(chip.memory()[16 * 256 + 5], data[5] & other[5]);
+
+    // Erasing the prefs block erases one 4K sector, and protects the flash again
+    flash.erasePrefsBlock(1);
+    CHECK(pageErased(chip, 16));
+    CHECK(pageErased(chip, 31));
+    CHECK(!pageErased(chip, 0));
+    CHECK_EQUAL(chip.stats.sectorErases, 1);
+
+    // A range starting on a 64K block uses block erases, the rest uses 4K sectors
+    chip.resetStatistics();
+    flash.allowWritingToBitmaps(true);
+    flash.write(1050, 256, data);
+    flash.erasePages(768, 256 + 48);
+    CHECK_EQUAL(chip.stats.blockErases, 1);
+    CHECK_EQUAL(chip.stats.sectorErases, 3);
+    CHECK(pageErased(chip, 1050));
+    flash.allowWritingToBitmaps(false);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+static void testBusyTiming(W25Q80 &chip)
+{
+    uint8_t data[256], read[256];
+
+    testStart("Busy timing");
+    fillPage(data, 4);
+    flash.erasePrefsBlock(2);
+    flash.allowWritingToPrefs(true);
+    chip.resetStatistics();
+
+    // The flash is busy for the page program time, and the next command waits for it
+    uint64_t start = hostMicros();
+    flash.write(32, 256, data);
+    CHECK(chip.isBusy());
+    flash.startRead(32, 256, read);
+    flash.endRead();
+    CHECK(hostMicros() - start >= W25Q80::typical.programPage);
+    CHECK(memcmp(read, data, 256) == 0);
+    CHECK_EQUAL(chip.stats.busyCommands, 0);
+
+    // The driver's timeouts cover the longest times in the datasheet
+    chip.setTiming(W25Q80::maximum);
+    hostQuiet = true;
+    flash.allowWritingToPrefs(true);
+    flash.write(33, 256, data);
+    flash.waitUntilNotBusy(50);
+    flash.erasePrefsBlock(2);
+    flash.eraseProfileBlock(64);
+    flash.allowWritingToBitmaps(true);
+    flash.erasePages(1024, 256);
+    flash.allowWritingToBitmaps(false);
+    flash.eraseFlash();
+    hostQuiet = false;
+    chip.setTiming(W25Q80::typical);
+    CHECK(!chip.isBusy());
+    CHECK(pageErased(chip, 33));
+    CHECK_EQUAL(chip.stats.busyCommands, 0);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+static void testEraseSuspend(W25Q80 &chip)
+{
+    uint8_t data[256], read[256];
+
+    testStart("Erase suspend");
+    fillPage(data, 5);
+    flash.allowWritingToPrefs(true);
+    flash.write(80, 256, data);
+    flash.waitUntilNotBusy(50);
+    chip.resetStatistics();
+
+    // A read during a sector erase suspends it, and the erase carries on afterwards
+    flash.startErase4K(64);
+    CHECK(chip.isBusy());
+    flash.startRead(80, 256, read);
+    CHECK(!chip.isBusy());
+    flash.endRead();
+    CHECK(chip.isBusy());
+    CHECK(memcmp(read, data, 256) == 0);
+    CHECK_EQUAL(chip.stats.suspends, 1);
+
+    // Reads straight after a resume wait 20us before suspending again
+    flash.startRead(80, 256, read);
+    flash.endRead();
+    CHECK_EQUAL(chip.stats.suspends, 2);
+
+    flash.waitUntilNotBusy(400);
+    CHECK(pageErased(chip, 64));
+    CHECK_EQUAL(chip.stats.sectorErases, 1);
+    CHECK_EQUAL(chip.violations(), 0);
+    flash.allowWritingToPrefs(false);
+}
+
+
+static void testChipErase(W25Q80 &chip)
+{
+    testStart("Chip erase");
+    chip.resetStatistics();
+    flash.eraseFlash();
+    CHECK_EQUAL(chip.stats.chipErases, 1);
+    CHECK(pageErased(chip, 0));
+    CHECK(pageErased(chip, 4095));
+
+    // The status register is written once (to leave QE set after a power cycle)
+    CHECK_EQUAL(chip.stats.statusWrites, 1);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+static void testPowerCycle()
+{
+    uint8_t data[256], read[256];
+
+    testStart("Power cycle");
+    fillPage(data, 6);
+    {
+        W25Q80 chip(IMAGE_FILE);
+        flash.allowWritingToPrefs(true);
+        flash.write(48, 256, data);
+        flash.waitUntilNotBusy(50);
+        flash.allowWritingToPrefs(false);
+    }
+
+    // The image is kept in the file
+    W25Q80 chip(IMAGE_FILE);
+    flash.begin();
+    flash.startRead(48, 256, read);
+    flash.endRead();
+    CHECK(memcmp(read, data, 256) == 0);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+int main()
+{
+    unlink(IMAGE_FILE);
+    {
+        W25Q80 chip(IMAGE_FILE);
+        flash.begin();
+        testIdentification(chip);
+        testProtection(chip);
+        testProgramAndErase(chip);
+        testBusyTiming(chip);
+        testEraseSuspend(chip);
+        testChipErase(chip);
+    }
+    testPowerCycle();
+    return testResult("test_flash");
+}
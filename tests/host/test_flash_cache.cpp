@@ -0,0 +1,194 @@
+// The flash page cache (FlashCache.cpp): hits, LRU replacement, streaming long reads, and
+// invalidation by every write and erase in Controleo3Flash
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "ReflowWizard.h"
+#include "FlashCache.h"
+#include "FlashJobs.h"
+#include "W25Q80.h"
+#include "HostTest.h"
+
+#define IMAGE_FILE                  "test_flash_cache.img"
+
+
+// Read through the cache and check the data against the chip.  Returns the bytes read
+// from the chip.
+static uint32_t readAndCheck(W25Q80 &chip, uint16_t page, uint16_t bytes)
+{
+    uint8_t buf[1024];
+    uint32_t before = chip.stats.bytesRead;
+
+    readFlash(page, bytes, buf);
+    if (!CHECK(memcmp(buf, chip.memory() + page * 256, bytes) == 0))
+        printf("  page %u, %u bytes\n", page, bytes);
+    return chip.stats.bytesRead - before;
+}
+
+
+static void writePage(uint16_t page, uint8_t seed)
+{
+    uint8_t data[256];
+
+    for (uint16_t i=0; i < 256; i++)
+        data[i] = (uint8_t) (i * 13 + seed);
+    flash.write(page, 256, data);
+}
+
+
+static void testHits(W25Q80 &chip)
+{
+    testStart("Hits and misses");
+    invalidateFlashCache(0, 4096);
+
+    // A miss loads the whole page, so a short read is followed by hits
+    CHECK_EQUAL(readAndCheck(chip, 600, 4), 256);
+    CHECK_EQUAL(readAndCheck(chip, 600, 256), 0);
+    CHECK_EQUAL(readAndCheck(chip, 600, 10), 0);
+}
+
+
+static void testLRU(W25Q80 &chip)
+{
+    testStart("LRU replacement");
+    invalidateFlashCache(0, 4096);
+
+    for (uint16_t page=0; page < FLASH_CACHE_PAGES; page++)
+        readAndCheck(chip, 700 + page, 256);
+    // Use the first page again, so the second is the least recently used
+    CHECK_EQUAL(readAndCheck(chip, 700, 256), 0);
+    CHECK_EQUAL(readAndCheck(chip, 800, 256), 256);
+    CHECK_EQUAL(readAndCheck(chip, 700, 256), 0);
+    CHECK_EQUAL(readAndCheck(chip, 701, 256), 256);
+
+    // That replaced the third page
+    CHECK_EQUAL(readAndCheck(chip, 800, 256), 0);
+    CHECK_EQUAL(readAndCheck(chip, 703, 256), 0);
+    CHECK_EQUAL(readAndCheck(chip, 702, 256), 256);
+}
+
+
+static void testStreaming(W25Q80 &chip)
+{
+    testStart("Long reads");
+    invalidateFlashCache(0, 4096);
+
+    // Long reads stream the pages that aren't cached, and don't cache them
+    readAndCheck(chip, 901, 20);
+    CHECK_EQUAL(readAndCheck(chip, 900, 3 * 256 + 100), 2 * 256 + 100);
+    CHECK_EQUAL(readAndCheck(chip, 900, 256), 256);
+    CHECK_EQUAL(readAndCheck(chip, 903, 100), 256);
+    CHECK_EQUAL(readAndCheck(chip, 900, 4 * 256), 256);
+}
+
+
+static void testInvalidation(W25Q80 &chip)
+{
+    testStart("Invalidation");
+
+    // Page writes, through the driver and the flash jobs (which protect the flash again)
+    readAndCheck(chip, 10, 256);
+    flash.allowWritingToPrefs(true);
+    writePage(10, 1);
+    CHECK_EQUAL(readAndCheck(chip, 10, 256), 256);
+    uint8_t data[256];
+    memset(data, 0x5A, sizeof(data));
+    readAndCheck(chip, 11, 256);
+    queueFlashWrite(11, 256, data, 0);
+    CHECK_EQUAL(readAndCheck(chip, 11, 256), 256);
+    readAndCheck(chip, 12, 256);
+    flash.allowWritingToPrefs(true);
+    flash.slowWrite(12, 256, data);
+    CHECK_EQUAL(readAndCheck(chip, 12, 256), 256);
+
+    // Erases
+    readAndCheck(chip, 12, 256);
+    flash.erasePrefsBlock(0);
+    CHECK_EQUAL(readAndCheck(chip, 12, 256), 256);
+
+    flash.allowWritingToPrefs(true);
+    writePage(70, 2);
+    readAndCheck(chip, 70, 256);
+    flash.eraseProfileBlock(64);
+    CHECK_EQUAL(readAndCheck(chip, 70, 256), 256);
+
+    flash.allowWritingToPrefs(true);
+    writePage(90, 3);
+    readAndCheck(chip, 90, 256);
+    queueFlashErase(80, 0);
+    CHECK_EQUAL(readAndCheck(chip, 90, 256), 256);
+
+    flash.allowWritingToPrefs(true);
+    writePage(300, 4);
+    readAndCheck(chip, 300, 256);
+    flash.factoryReset();
+    CHECK_EQUAL(readAndCheck(chip, 300, 256), 256);
+
+    flash.allowWritingToBitmaps(true);
+    writePage(2000, 5);
+    readAndCheck(chip, 2000, 256);
+    flash.erasePages(2000, 1);
+    CHECK_EQUAL(readAndCheck(chip, 2000, 256), 256);
+
+    writePage(3000, 6);
+    readAndCheck(chip, 3000, 256);
+    flash.eraseFlash();
+    CHECK_EQUAL(readAndCheck(chip, 3000, 256), 256);
+    flash.allowWritingToBitmaps(false);
+}
+
+
+// Random reads, writes and erases.  Every read must match the chip.
+static void testRandom(W25Q80 &chip)
+{
+    testStart("Random reads, writes and erases");
+    srand(1);
+    unsigned int failuresBefore = testFailures;
+
+    flash.allowWritingToBitmaps(true);
+    for (int i=0; i < 3000; i++) {
+        // Keep to a few sectors, so pages are cached, written and erased often
+        uint16_t page = 1024 + rand() % 48;
+        switch (rand() % 10) {
+            case 0:
+                // Pages are only written once after they are erased
+                if (chip.memory()[page * 256] == 0xFF)
+                    writePage(page, rand());
+                break;
+            case 1:
+                flash.erasePages(page, 1);
+                break;
+            default:
+                readAndCheck(chip, page, rand() % 2? 1 + rand() % 256 : 1 + rand() % 1000);
+                break;
+        }
+    }
+    flash.allowWritingToBitmaps(false);
+    CHECK_EQUAL(testFailures, failuresBefore);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+int main()
+{
+    unlink(IMAGE_FILE);
+    W25Q80 chip(IMAGE_FILE);
+    flash.begin();
+
+    // Put something in the bitmap area to read
+    flash.allowWritingToBitmaps(true);
+    for (uint16_t page=600; page < 1100; page++)
+        writePage(page, page);
+    flash.allowWritingToBitmaps(false);
+    chip.resetStatistics();
+
+    testHits(chip);
+    testLRU(chip);
+    testStreaming(chip);
+    testInvalidation(chip);
+    testRandom(chip);
+    CHECK_EQUAL(chip.violations(), 0);
+    chip.printStatistics();
+    PrintFlashCacheStats();
+    return testResult("test_flash_cache");
+}
@@ -0,0 +1,411 @@
+// Controleo3LCD and the drawing code on the ILI9488 model: setup, fills and lines (with the
+// DMA fill), bitmaps (raw, runs, run-length encoded, from both flashes), reading pixels
+// back, golden images of text and screens, and the CPU keeping off the bus during a DMA fill
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "ReflowWizard.h"
+#include "Bitmaps.h"
+#include "Render.h"
+#include "Screens.h"
+#include "BitmapCache.h"
+#include "LCDModel.h"
+#include "W25Q80.h"
+#include "TestBitmaps.h"
+#include "HostTest.h"
+
+#define IMAGE_FILE                  "test_lcd.img"
+
+// Golden images: CRC32 of the framebuffer (see LCDModel::crc).  When one doesn't match,
+// the framebuffer is written to <name>.ppm so it can be looked at.
+#define GOLDEN_TEXT                 0x2B4E793C
+#define GOLDEN_HOME_SCREEN          0xA2D80705
+#define GOLDEN_SETTINGS_SCREEN      0x860001FE
+
+
+static LCDModel *lcd;
+static uint16_t expected[LCD_MODEL_HEIGHT][LCD_MODEL_WIDTH];
+
+
+static void expectRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    for (int16_t row=y; row < y + h; row++)
+        for (int16_t col=x; col < x + w; col++)
+            expected[row][col] = color;
+}
+
+
+static void expectScreen(uint16_t color)
+{
+    expectRect(0, 0, LCD_MODEL_WIDTH, LCD_MODEL_HEIGHT, color);
+}
+
+
+// Does the framebuffer match what was expected?  The first difference is printed.
+static bool matchesExpected()
+{
+    for (uint16_t y=0; y < LCD_MODEL_HEIGHT; y++)
+        for (uint16_t x=0; x < LCD_MODEL_WIDTH; x++)
+            if (lcd->pixel(x, y) != expected[y][x]) {
+                printf("  pixel (%u, %u) is 0x%04X, expected 0x%04X\n", x, y, lcd->pixel(x, y), expected[y][x]);
+                return false;
+            }
+    return true;
+}
+
+
+// The pixels of a bitmap, as they should appear on the screen
+static void getBitmapPixels(uint16_t bitmapNumber, uint16_t *pixels, uint16_t *width, uint16_t *height)
+{
+    const uint16_t *rle = flashBitmaps[bitmapNumber];
+
+    if (!rle) {
+        getTestBitmapSize(bitmapNumber, width, height);
+        for (uint32_t i=0; i < (uint32_t) *width * *height; i++)
+            pixels[i] = getTestBitmapPixel(bitmapNumber, i);
+        return;
+    }
+
+    // Bitmaps in microcontroller flash are run-length encoded (see Bitmaps.cpp)
+    *width = *rle >> 8;
+    *height = *rle++ & 0xFF;
+    for (uint32_t i=0; i < (uint32_t) *width * *height; ) {
+        uint16_t count = *rle & 0x7FFF;
+        if (*rle++ & 0x8000) {
+            for (uint16_t j=0; j < count; j++)
+                pixels[i++] = *rle;
+            rle++;
+        }
+        else
+            for (uint16_t j=0; j < count; j++)
+                pixels[i++] = *rle++;
+    }
+}
+
+
+static void checkGolden(const char *name, uint32_t golden)
+{
+    uint32_t crc = lcd->crc();
+
+    if (!CHECK_EQUAL(crc, golden)) {
+        char file[64];
+        snprintf(file, sizeof(file), "%s.ppm", name);
+        lcd->writePPM(file);
+        printf("  %s: CRC is 0x%08X, written to %s\n", name, crc, file);
+    }
+}
+
+
+static void testBegin()
+{
+    testStart("Setup");
+    tft.begin();
+    CHECK_EQUAL(lcd->stats.commands[ILI9488_MADCTL], 1);
+    CHECK_EQUAL(lcd->stats.commands[ILI9488_PIXELFORMAT], 1);
+    CHECK_EQUAL(lcd->stats.commands[ILI9488_SLEEPOUT], 1);
+    CHECK_EQUAL(tft.getLCDVersion(), 0x548066);
+    CHECK_EQUAL(lcd->stats.bytesRead, 4);
+
+    // The data lines are outputs again, and writes work
+    tft.fillRect(0, 0, 2, 2, RED);
+    CHECK_EQUAL(lcd->pixel(1, 1), RED);
+    CHECK_EQUAL(lcd->violations(), 0);
+}
+
+
+static int fillsCompleted;
+
+static void fillComplete()
+{
+    fillsCompleted++;
+}
+
+
+static void testFills()
+{
+    testStart("Fills and lines");
+
+    // White fills the screen with WR strobes, using the DMA.  fillScreen() returns once
+    // the CPU has written the first pixel and started the DMA, and the fill takes several
+    // blocks.
+    lcd->resetStatistics();
+    tft.setFillCompleteCallback(fillComplete);
+    uint64_t start = hostCycleCount();
+    tft.fillScreen(WHITE);
+    CHECK(hostCycleCount() - start < 1000);
+    CHECK(tft.isBusy());
+    CHECK_EQUAL(lcd->stats.pixelsWritten, 1);
+    tft.waitUntilIdle();
+    CHECK(!tft.isBusy());
+    CHECK_EQUAL(fillsCompleted, 1);
+    expectScreen(WHITE);
+    CHECK(matchesExpected());
+    CHECK_EQUAL(lcd->stats.pixelsWritten, LCD_WIDTH * LCD_HEIGHT);
+    CHECK(lcd->stats.strobes >= LCD_WIDTH * LCD_HEIGHT * 2 - 1);
+    CHECK_EQUAL(lcd->stats.transactions, 1);
+
+    // Small fills are done by the CPU, still with strobes
+    lcd->resetStatistics();
+    tft.fillRect(10, 10, 60, 60, BLACK);
+    CHECK(!tft.isBusy());
+    CHECK_EQUAL(lcd->stats.pixelsWritten, 60 * 60);
+    CHECK(lcd->stats.strobes >= 60 * 60 * 2 - 1);
+    tft.setFillCompleteCallback(0);
+    CHECK_EQUAL(fillsCompleted, 1);
+    expectRect(10, 10, 60, 60, BLACK);
+    CHECK(matchesExpected());
+
+    // Other colors have both bytes written for every pixel
+    lcd->resetStatistics();
+    tft.fillScreen(DARK_GREY);
+    expectScreen(DARK_GREY);
+    CHECK(matchesExpected());
+    CHECK(lcd->stats.strobes < 8);
+
+    // Random rectangles, lines and pixels
+    srand(1);
+    for (int i=0; i < 400; i++) {
+        int16_t x = rand() % LCD_WIDTH, y = rand() % LCD_HEIGHT;
+        int16_t w = 1 + rand() % (LCD_WIDTH - x), h = 1 + rand() % (LCD_HEIGHT - y);
+        uint16_t colors[] = {WHITE, BLACK, (uint16_t) rand(), (uint16_t) ((rand() & 0xFF) * 0x0101)};
+        uint16_t color = colors[rand() % 4];
+        switch (rand() % 5) {
+            case 0:
+                tft.fillRect(x, y, w, h, color);
+                expectRect(x, y, w, h, color);
+                break;
+            case 1:
+                tft.drawRect(x, y, w, h, color);
+                expectRect(x, y, w, 1, color);
+                expectRect(x, y + h - 1, w, 1, color);
+                expectRect(x, y, 1, h, color);
+                expectRect(x + w - 1, y, 1, h, color);
+                break;
+            case 2:
+                tft.drawFastHLine(x, y, w, color);
+                expectRect(x, y, w, 1, color);
+                break;
+            case 3:
+                tft.drawFastVLine(x, y, h, color);
+                expectRect(x, y, 1, h, color);
+                break;
+            default:
+                tft.drawPixel(x, y, color);
+                expectRect(x, y, 1, 1, color);
+                break;
+        }
+    }
+    tft.waitUntilIdle();
+    CHECK(matchesExpected());
+    CHECK_EQUAL(lcd->violations(), 0);
+}
+
+
+static void testBitmaps()
+{
+    uint16_t pixels[40 * 30];
+
+    testStart("Bitmaps");
+    tft.fillScreen(WHITE);
+    expectScreen(WHITE);
+
+    // Pixels, in pieces
+    for (int i=0; i < 40 * 30; i++)
+        pixels[i] = i * 0x0107;
+    tft.startBitmap(100, 50, 40, 30);
+    for (int i=0; i < 40 * 30; i += 7)
+        tft.drawBitmap(pixels + i, 40 * 30 - i < 7? 40 * 30 - i : 7);
+    tft.endBitmap();
+    for (int i=0; i < 40 * 30; i++)
+        expected[50 + i / 40][100 + i % 40] = pixels[i];
+
+    // Runs and pixels in the same window.  Black and white runs are WR strobes.
+    lcd->resetStatistics();
+    tft.startBitmap(200, 100, 50, 4);
+    tft.drawBitmapRun(BLACK, 60);
+    tft.drawBitmap(pixels, 20);
+    tft.drawBitmapRun(RED, 70);
+    tft.drawBitmapRun(WHITE, 50);
+    tft.endBitmap();
+    CHECK_EQUAL(lcd->stats.transactions, 1);
+    CHECK_EQUAL(lcd->stats.commands[ILI9488_MEMORYWRITE], 1);
+    CHECK_EQUAL(lcd->stats.pixelsWritten, 200);
+    CHECK(lcd->stats.strobes >= 60 * 2 - 1 + 50 * 2 - 1);
+    expectRect(200, 100, 50, 1, BLACK);
+    expectRect(200, 101, 10, 1, BLACK);
+    for (int i=0; i < 20; i++)
+        expected[101][210 + i] = pixels[i];
+    expectRect(230, 101, 20, 1, RED);
+    expectRect(200, 102, 50, 1, RED);
+    expectRect(200, 103, 50, 1, WHITE);
+
+    // Run-length encoded
+    const uint16_t rle[] = {0x8005, WHITE, 0x0003, RED, GREEN, BLUE, 0x8004, 0x1234, 0x8003, BLACK};
+    tft.startBitmap(300, 200, 5, 3);
+    CHECK(tft.drawBitmapRLE(rle, 15));
+    tft.endBitmap();
+    expectRect(300, 200, 5, 1, WHITE);
+    expected[201][300] = RED;
+    expected[201][301] = GREEN;
+    expected[201][302] = BLUE;
+    expectRect(303, 201, 2, 1, 0x1234);
+    expectRect(300, 202, 2, 1, 0x1234);
+    expectRect(302, 202, 3, 1, BLACK);
+    CHECK(matchesExpected());
+
+    // A run past the end of the bitmap is corrupt
+    tft.startBitmap(300, 200, 5, 3);
+    CHECK(!tft.drawBitmapRLE(rle, 4));
+    tft.endBitmap();
+    tft.fillScreen(WHITE);
+    CHECK_EQUAL(lcd->violations(), 0);
+}
+
+
+// Every bitmap, from microcontroller flash, the RAM cache or streamed from external flash
+static void testFlashBitmaps(W25Q80 &chip)
+{
+    static uint16_t pixels[LCD_WIDTH * LCD_HEIGHT];
+    bool allMatch = true;
+
+    testStart("Bitmaps from flash");
+    hostQuiet = true;
+    CHECK(provisionTestBitmaps());
+    hostQuiet = false;
+    lcd->resetStatistics();
+    for (uint16_t i=0; i <= BITMAP_LAST_ONE; i++) {
+        uint16_t width, height;
+        getBitmapPixels(i, pixels, &width, &height);
+        uint16_t x = (i * 37) % (LCD_WIDTH - width), y = (i * 11) % (LCD_HEIGHT - height);
+        bool streamed = !flashBitmaps[i] && (i & 1);
+        uint16_t drawnWidth = streamed? renderBitmapFromExternalFlash(i, x, y) : renderBitmap(i, x, y);
+        allMatch &= drawnWidth == width;
+        for (uint32_t p=0; p < (uint32_t) width * height; p++)
+            allMatch &= lcd->pixel(x + p % width, y + p / width) == pixels[p];
+    }
+    CHECK(allMatch);
+    CHECK_EQUAL(lcd->violations(), 0);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+static void testReadBack()
+{
+    uint16_t pixels[60 * 20], read[60 * 20];
+    uint8_t read24[60 * 3];
+
+    testStart("Read back");
+    for (int i=0; i < 60 * 20; i++)
+        pixels[i] = (uint16_t) (i * 0x3B1D);
+    tft.startBitmap(10, 280, 60, 20);
+    tft.drawBitmap(pixels, 60 * 20);
+    tft.endBitmap();
+
+    lcd->resetStatistics();
+    tft.startReadBitmap(10, 280, 60, 20);
+    tft.readBitmapRGB565(read, 60 * 20);
+    tft.endReadBitmap();
+    CHECK(memcmp(pixels, read, sizeof(pixels)) == 0);
+    CHECK_EQUAL(lcd->stats.bytesRead, 1 + 60 * 20 * 3);
+
+    // 24-bit pixels are blue, green, red (as in a .bmp file)
+    tft.startReadBitmap(10, 280, 60, 1);
+    tft.readBitmap24bit(read24, 60);
+    tft.endReadBitmap();
+    bool allMatch = true;
+    for (int i=0; i < 60; i++)
+        allMatch &= tft.convertTo16Bit((read24[i * 3 + 2] << 16) | (read24[i * 3 + 1] << 8) | read24[i * 3]) == pixels[i];
+    CHECK(allMatch);
+
+    // Writing works afterwards
+    tft.drawPixel(0, 0, BLUE);
+    CHECK_EQUAL(lcd->pixel(0, 0), BLUE);
+    CHECK_EQUAL(lcd->violations(), 0);
+}
+
+
+static void testGoldenImages()
+{
+    testStart("Golden images");
+
+    // Every character in each font
+    char str[100];
+    tft.fillScreen(WHITE);
+    for (uint8_t font=FONT_9PT_BLACK_ON_WHITE; font <= FONT_12PT_BLACK_ON_WHITE; font++)
+        for (int line=0; line < 4; line++) {
+            int j = 0;
+            for (int c='!' + line * 24; c <= '~' && c < '!' + (line + 1) * 24; c++)
+                str[j++] = c;
+            str[j] = 0;
+            displayString(5, 5 + font * 105 + line * (font? 30 : 25), font, str);
+        }
+    displayString(5, 250, FONT_22PT_BLACK_ON_WHITE_FIXED, (char *) "12:34.5~C");
+    displayFixedWidthString(300, 250, (char *) "89%", 5, FONT_22PT_BLACK_ON_WHITE_FIXED);
+    checkGolden("text", GOLDEN_TEXT);
+
+    // The home screen, as Screens.cpp draws it
+    tft.fillScreen(WHITE);
+    renderBitmap(BITMAP_CONTROLEO3_SMALL, 106, 5);
+    drawTouchButton(110, 80, 260, BUTTON_LARGE_FONT, (char *) "Reflow");
+    drawTouchButton(110, 160, 260, BUTTON_LARGE_FONT, (char *) "Bake");
+    drawTouchButtonWithIcon(110, 240, 260, BUTTON_LARGE_FONT, (char *) "Settings", BITMAP_SETTINGS, 252);
+    checkGolden("home_screen", GOLDEN_HOME_SCREEN);
+
+    // A settings screen
+    tft.fillScreen(WHITE);
+    displayHeader((char *) "Settings", false);
+    drawTouchButton(20, 100, 200, BUTTON_SMALL_FONT, (char *) "Oven setup");
+    drawTouchButton(260, 100, 200, BUTTON_SMALL_FONT, (char *) "Learning");
+    drawIncreaseDecreaseTapTargets(TWO_SETTINGS);
+    drawNavigationButtons(true, true);
+    checkGolden("settings_screen", GOLDEN_SETTINGS_SCREEN);
+    CHECK_EQUAL(lcd->violations(), 0);
+}
+
+
+// The CPU must not touch the LCD pins while the DMA is filling.  The relays on the same
+// port can be switched.
+static void testDMAConflicts()
+{
+    testStart("DMA conflicts");
+    lcd->resetStatistics();
+    tft.fillScreen(WHITE);
+    CHECK(hostDMAPending());
+    PORT_OUTSET(PB(0)) = SETBIT08;
+    PORT_OUTCLR(PB(0)) = SETBIT08;
+    CHECK_EQUAL(lcd->stats.dmaConflicts, 0);
+
+    // Anything that draws waits for the fill first
+    tft.drawPixel(5, 5, RED);
+    CHECK_EQUAL(lcd->stats.dmaConflicts, 0);
+    CHECK_EQUAL(lcd->pixel(5, 5), RED);
+    CHECK_EQUAL(lcd->pixel(6, 5), WHITE);
+
+    // The model catches a write that doesn't wait
+    tft.fillScreen(WHITE);
+    PORT_OUTCLR(PB(0)) = SETBIT12;
+    PORT_OUTSET(PB(0)) = SETBIT12;
+    CHECK_EQUAL(lcd->stats.dmaConflicts, 2);
+    tft.waitUntilIdle();
+    lcd->resetStatistics();
+}
+
+
+int main()
+{
+    unlink(IMAGE_FILE);
+    W25Q80 chip(IMAGE_FILE);
+    LCDModel model;
+    lcd = &model;
+    flash.begin();
+    initBitmapCache();
+
+    testBegin();
+    testFills();
+    testBitmaps();
+    testFlashBitmaps(chip);
+    testReadBack();
+    testGoldenImages();
+    testDMAConflicts();
+    return testResult("test_lcd");
+}
@@ -0,0 +1,277 @@
+// The hot prefs in the SAMD21's NVM (NVMPrefs.cpp), on the RAM model of the NVM rows:
+// records, wear levelling across the rows, ignoring random records, reading them without the
+// external flash, power cuts during a row erase or page write, and falling back to the
+// external flash when the NVM is lost
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "ReflowWizard.h"
+#include "FlashCache.h"
+#include "NVMPrefs.h"
+#include "Prefs.h"
+#include "NVMModel.h"
+#include "W25Q80.h"
+#include "HostTest.h"
+
+#define IMAGE_FILE                  "test_nvm_prefs.img"
+#define POWER_CUTS                  2000
+
+
+// Copy the prefs that are kept in NVM
+static void copyHotPrefs(Controleo3Prefs *to, const Controleo3Prefs *from)
+{
+    for (uint16_t i=0; i < sizeof(Controleo3Prefs); i++)
+        if (isNVMPrefsByte(i))
+            ((uint8_t *) to)[i] = ((const uint8_t *) from)[i];
+}
+
+
+static bool sameHotPrefs(const Controleo3Prefs *a, const Controleo3Prefs *b)
+{
+    for (uint16_t i=0; i < sizeof(Controleo3Prefs); i++)
+        if (isNVMPrefsByte(i) && ((const uint8_t *) a)[i] != ((const uint8_t *) b)[i])
+            return false;
+    return true;
+}
+
+
+static void changeHotPrefs(Controleo3Prefs *p)
+{
+    switch (rand() % 4) {
+        case 0:
+            p->topLeftX = rand();
+            p->bottomRightY = rand();
+            break;
+        case 1:
+            p->outputType[rand() % NUMBER_OF_OUTPUTS] = rand();
+            break;
+        case 2:
+            p->bakeTemperature = rand();
+            p->bakeUseCoolingFan = rand();
+            break;
+        default:
+            p->lastUsedProfileBlock = rand();
+            break;
+    }
+}
+
+
+// Read the hot prefs as at startup
+static bool readBack(NVMModel &nvm, Controleo3Prefs *p)
+{
+    nvm.attach();
+    memset(p, 0, sizeof(Controleo3Prefs));
+    return readNVMPrefs(p);
+}
+
+
+static void testRecords(NVMModel &nvm)
+{
+    Controleo3Prefs p, read;
+
+    testStart("Records");
+    memset(&p, 0, sizeof(p));
+    CHECK(!readBack(nvm, &read));
+
+    // Only the hot prefs are kept
+    CHECK(isNVMPrefsByte(offsetof(Controleo3Prefs, topLeftX)));
+    CHECK(isNVMPrefsByte(offsetof(Controleo3Prefs, outputType) + NUMBER_OF_OUTPUTS - 1));
+    CHECK(isNVMPrefsByte(offsetof(Controleo3Prefs, lastUsedProfileBlock) + 1));
+    CHECK(!isNVMPrefsByte(offsetof(Controleo3Prefs, sequenceNumber)));
+    CHECK(!isNVMPrefsByte(offsetof(Controleo3Prefs, numReflows)));
+
+    p.topLeftX = 100;
+    p.outputType[2] = 3;
+    p.bakeTemperature = 120;
+    p.lastUsedProfileBlock = 77;
+    p.numReflows = 5;
+    writeNVMPrefs(&p);
+    CHECK_EQUAL(nvm.stats.pagesWritten, 1);
+    CHECK(readBack(nvm, &read));
+    CHECK(sameHotPrefs(&read, &p));
+    CHECK_EQUAL(read.numReflows, 0);
+
+    // A record is only written when the hot prefs change
+    writeNVMPrefs(&p);
+    p.numReflows++;
+    writeNVMPrefs(&p);
+    CHECK_EQUAL(nvm.stats.pagesWritten, 1);
+    p.bakeTemperature++;
+    writeNVMPrefs(&p);
+    CHECK_EQUAL(nvm.stats.pagesWritten, 2);
+    CHECK(readBack(nvm, &read));
+    CHECK_EQUAL(read.bakeTemperature, 121);
+    CHECK_EQUAL(nvm.stats.unerasedBits, 0);
+}
+
+
+// The records go round the rows, so the rows are erased the same number of times
+static void testWearLevelling(NVMModel &nvm)
+{
+    Controleo3Prefs p, read;
+
+    testStart("Wear levelling");
+    memset(&p, 0, sizeof(p));
+    nvm.resetStatistics();
+    uint32_t writes = NVM_PREFS_ROWS * NVMCTRL_ROW_PAGES * 20;
+    for (uint32_t i=0; i < writes; i++) {
+        p.lastUsedProfileBlock = i;
+        writeNVMPrefs(&p);
+    }
+    CHECK_EQUAL(nvm.stats.pagesWritten, writes);
+    // Rows that are already erased aren't erased again
+    uint32_t fewest = ~0U, most = 0;
+    for (uint16_t row=0; row < NVM_PREFS_ROWS; row++) {
+        fewest = nvm.stats.erasesOfRow[row] < fewest? nvm.stats.erasesOfRow[row] : fewest;
+        most = nvm.stats.erasesOfRow[row] > most? nvm.stats.erasesOfRow[row] : most;
+    }
+    CHECK(fewest >= 19 && most <= 20);
+    CHECK(readBack(nvm, &read));
+    CHECK_EQUAL(read.lastUsedProfileBlock, writes - 1);
+    CHECK_EQUAL(nvm.stats.unerasedBits, 0);
+}
+
+
+// A row that was being erased when the power went off can have a page with a good CRC by
+// chance.  It isn't used, because the record before it isn't there.
+static void testRandomRecord(NVMModel &nvm)
+{
+    Controleo3Prefs p, read;
+
+    testStart("Random record");
+    memset(&p, 0, sizeof(p));
+    p.topLeftX = 1;
+    writeNVMPrefs(&p);
+    CHECK(readBack(nvm, &read));
+    uint32_t *latest = 0;
+    for (uint16_t page=0; page < NVM_MODEL_SIZE / NVMCTRL_PAGE_SIZE; page++)
+        if (*(uint32_t *) (nvm.memory() + page * NVMCTRL_PAGE_SIZE) != 0xFFFFFFFF)
+            latest = (uint32_t *) (nvm.memory() + page * NVMCTRL_PAGE_SIZE);
+
+    // Put a copy with a high sequence number and other prefs in the next row
+    uint8_t *page = nvm.memory() + ((uint8_t *) latest - nvm.memory() + NVMCTRL_ROW_SIZE) % NVM_MODEL_SIZE;
+    memcpy(page, latest, NVMCTRL_PAGE_SIZE);
+    *(uint32_t *) page = 0x80001234;
+    page[4] = 2;
+    *(uint16_t *) (page + NVMCTRL_PAGE_SIZE - 2) = prefsCRC(0xFFFF, page, NVMCTRL_PAGE_SIZE - 2);
+    CHECK(readBack(nvm, &read));
+    CHECK_EQUAL(read.topLeftX, 1);
+    memset(page, 0xFF, NVMCTRL_PAGE_SIZE);
+}
+
+
+// Reading the hot prefs doesn't touch the external flash
+static void testNoExternalFlash(NVMModel &nvm, W25Q80 &chip)
+{
+    Controleo3Prefs read;
+
+    testStart("Read from the memory map");
+    chip.resetStatistics();
+    uint64_t start = hostMicros();
+    CHECK(readBack(nvm, &read));
+    CHECK_EQUAL(chip.stats.transactions, 0);
+    CHECK_EQUAL(hostMicros() - start, 0);
+}
+
+
+// Cut the power during row erases and page writes.  The hot prefs must be the old or the
+// new ones, and writing them must work afterwards.
+static void testPowerCuts(NVMModel &nvm)
+{
+    Controleo3Prefs p, before, read;
+    unsigned int cuts = 0, oldPrefs = 0;
+
+    testStart("Power cuts");
+    srand(1);
+    memset(&p, 0, sizeof(p));
+    writeNVMPrefs(&p);
+    nvm.resetStatistics();
+    for (uint32_t i=1; i <= POWER_CUTS; i++) {
+        before = p;
+        changeHotPrefs(&p);
+
+        // A write is a page write, after a row erase for the first page in a row
+        nvm.cutPowerAfter(1 + rand() % 2, i);
+        hostQuiet = true;
+        writeNVMPrefs(&p);
+        hostQuiet = false;
+        if (!nvm.isPoweredOff()) {
+            nvm.cutPowerAfter(0, 0);
+            continue;
+        }
+        cuts++;
+        nvm.powerOn();
+        CHECK(readBack(nvm, &read));
+        if (sameHotPrefs(&read, &before))
+            oldPrefs++;
+        else if (!CHECK(sameHotPrefs(&read, &p)))
+            printf("  power cut %u: the hot prefs are neither the old nor the new ones\n", (unsigned int) i);
+
+        // Carry on from what was read
+        copyHotPrefs(&p, &read);
+        changeHotPrefs(&p);
+        writeNVMPrefs(&p);
+        CHECK(readBack(nvm, &read));
+        CHECK(sameHotPrefs(&read, &p));
+    }
+    printf("  %u power cuts: %u left the old hot prefs\n", cuts, oldPrefs);
+    CHECK(cuts > POWER_CUTS / 2);
+    // A page that was partly written isn't written again
+    CHECK_EQUAL(nvm.stats.unerasedBits, 0);
+}
+
+
+// The NVM is erased when the firmware is programmed.  The hot prefs then come from the
+// snapshot in the external flash, as they were when it was written.
+static void testLostNVM(NVMModel &nvm, W25Q80 &chip)
+{
+    testStart("NVM lost");
+    flash.factoryReset();
+    nvm.attach();
+    eraseNVMPrefs();
+    hostQuiet = true;
+    getPrefs();
+    prefs.topLeftX = 123;
+    writePrefsToFlash();
+
+    // Changes to the hot prefs alone only go to NVM
+    chip.resetStatistics();
+    prefs.topLeftX = 456;
+    writePrefsToFlash();
+    CHECK_EQUAL(chip.stats.pagesProgrammed, 0);
+    invalidateFlashCache(0, 4096);
+    nvm.attach();
+    getPrefs();
+    CHECK_EQUAL(prefs.topLeftX, 456);
+
+    memset(nvm.memory(), 0xFF, NVM_MODEL_SIZE);
+    invalidateFlashCache(0, 4096);
+    nvm.attach();
+    getPrefs();
+    hostQuiet = false;
+    CHECK_EQUAL(prefs.topLeftX, 123);
+
+    // It was written back to NVM
+    Controleo3Prefs read;
+    CHECK(readBack(nvm, &read));
+    CHECK_EQUAL(read.topLeftX, 123);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+int main()
+{
+    unlink(IMAGE_FILE);
+    W25Q80 chip(IMAGE_FILE);
+    NVMModel nvm;
+    flash.begin();
+
+    testRecords(nvm);
+    testWearLevelling(nvm);
+    testRandomRecord(nvm);
+    testNoExternalFlash(nvm, chip);
+    testPowerCuts(nvm);
+    testLostNVM(nvm, chip);
+    PrintNVMPrefsStats();
+    return testResult("test_nvm_prefs");
+}
@@ -0,0 +1,285 @@
+// The prefs records (Prefs.cpp): saves append records instead of rewriting the block, the
+// prefs are rebuilt from the snapshot and records at startup, and a power cut at any point
+// in a save leaves either the old or the new prefs
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "ReflowWizard.h"
+#include "FlashCache.h"
+#include "NVMPrefs.h"
+#include "Prefs.h"
+#include "NVMModel.h"
+#include "W25Q80.h"
+#include "HostTest.h"
+
+#define IMAGE_FILE                  "test_prefs.img"
+#define POWER_CUTS                  600
+
+
+static NVMModel *nvm;
+
+
+// Start the firmware again: the flash is protected, the cache is empty, and the prefs in
+// RAM are lost
+static void reboot(W25Q80 &chip)
+{
+    if (chip.isPoweredOff())
+        chip.powerOn();
+    flash.begin();
+    invalidateFlashCache(0, 4096);
+    nvm->attach();
+    memset(&prefs, 0xA5, sizeof(prefs));
+    hostQuiet = true;
+    getPrefs();
+    hostQuiet = false;
+}
+
+
+static void save()
+{
+    hostQuiet = true;
+    writePrefsToFlash();
+    hostQuiet = false;
+}
+
+
+// Are the prefs the same (apart from the sequence number, which belongs to the block)?
+static bool samePrefs(const Controleo3Prefs &a, const Controleo3Prefs &b)
+{
+    return memcmp((const uint8_t *) &a + sizeof(uint32_t), (const uint8_t *) &b + sizeof(uint32_t), sizeof(Controleo3Prefs) - sizeof(uint32_t)) == 0;
+}
+
+
+// Change some of the prefs that are kept in the external flash
+static void edit(int kind)
+{
+    switch (kind) {
+        case 0:
+            prefs.numReflows++;
+            break;
+        case 1:
+            // Two changes far apart make two records
+            prefs.numBakes++;
+            prefs.profile[MAX_PROFILES - 1].noOfTokens++;
+            break;
+        case 2:
+            prefs.learnedPower[rand() % 4] = rand();
+            prefs.learnedInertia[rand() % 4] = rand();
+            break;
+        default:
+            // A change too big for one record, that needs more than one page
+            for (int i=0; i < MAX_PROFILES; i++)
+                snprintf(prefs.profile[i].name, sizeof(prefs.profile[i].name), "Profile %d-%d", i, rand() % 1000);
+            break;
+    }
+}
+
+
+static void testFirstSave(W25Q80 &chip)
+{
+    testStart("First save");
+    reboot(chip);
+    CHECK_EQUAL(prefs.sequenceNumber, 0);
+    CHECK_EQUAL(prefs.versionNumber, PREFS_VERSION);
+    CHECK_EQUAL(prefs.lastUsedProfileBlock, FIRST_PROFILE_BLOCK);
+
+    // The first save writes a snapshot
+    chip.resetStatistics();
+    save();
+    CHECK_EQUAL(chip.stats.sectorErases, 1);
+    Controleo3Prefs saved = prefs;
+    reboot(chip);
+    CHECK(samePrefs(prefs, saved));
+    CHECK_EQUAL(prefs.sequenceNumber, 1);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+static void testRecords(W25Q80 &chip)
+{
+    testStart("Records");
+
+    // A small change is one partial page program
+    chip.resetStatistics();
+    prefs.numReflows = 1234;
+    save();
+    CHECK_EQUAL(chip.stats.sectorErases, 0);
+    CHECK_EQUAL(chip.stats.pagesProgrammed, 1);
+    CHECK(chip.stats.bytesProgrammed < 32);
+    Controleo3Prefs saved = prefs;
+    reboot(chip);
+    CHECK(samePrefs(prefs, saved));
+    CHECK_EQUAL(prefs.numReflows, 1234);
+
+    // Nothing is written if nothing changed
+    chip.resetStatistics();
+    save();
+    CHECK_EQUAL(chip.stats.pagesProgrammed, 0);
+
+    // Nor if only the prefs kept in NVM changed
+    prefs.bakeTemperature++;
+    save();
+    CHECK_EQUAL(chip.stats.pagesProgrammed, 0);
+    saved = prefs;
+    reboot(chip);
+    CHECK(samePrefs(prefs, saved));
+
+    // Changes in different places
+    for (int kind=0; kind < 4; kind++) {
+        edit(kind);
+        save();
+        saved = prefs;
+        reboot(chip);
+        CHECK(samePrefs(prefs, saved));
+    }
+    CHECK_EQUAL(chip.stats.sectorErases, 0);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+static void testCompaction(W25Q80 &chip)
+{
+    testStart("Compaction");
+
+    // When the block is full a snapshot is written to the next block
+    uint32_t sequenceNumber = prefs.sequenceNumber, saves = 0;
+    chip.resetStatistics();
+    while (chip.stats.sectorErases == 0 && saves < 1000) {
+        edit(saves % 3);
+        save();
+        saves++;
+    }
+    printf("  %u saves before the block was full\n", (unsigned int) saves);
+    CHECK(saves > 20);
+    Controleo3Prefs saved = prefs;
+    reboot(chip);
+    CHECK(samePrefs(prefs, saved));
+    CHECK_EQUAL(prefs.sequenceNumber, sequenceNumber + 1);
+
+    // The blocks are used in turn
+    for (int i=0; i < 300; i++) {
+        edit(i % 4);
+        save();
+    }
+    saved = prefs;
+    reboot(chip);
+    CHECK(samePrefs(prefs, saved));
+    CHECK(prefs.sequenceNumber > sequenceNumber + 4);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+// Cut the power part way through a save, at every point a save programs or erases
+static void testPowerCuts(W25Q80 &chip)
+{
+    unsigned int cuts = 0, compactionCuts = 0, oldPrefs = 0, newPrefs = 0;
+
+    testStart("Power cuts");
+    srand(1);
+    reboot(chip);
+    for (uint32_t i=1; i <= POWER_CUTS; i++) {
+        Controleo3Prefs before = prefs;
+        int kind = rand() % 8 == 0? 3 : rand() % 3;
+        edit(kind);
+
+        // Records are one or two page programs, or more for a big change
+        chip.cutPowerAfter(1 + rand() % (kind == 3? 5 : 2), i);
+        while (true) {
+            Controleo3Prefs after = prefs;
+            uint32_t erases = chip.stats.commands[0x20];
+            save();
+            if (!chip.isPoweredOff())
+                break;
+            cuts++;
+            compactionCuts += chip.stats.commands[0x20] != erases;
+            reboot(chip);
+            if (samePrefs(prefs, before))
+                oldPrefs++;
+            else if (CHECK(samePrefs(prefs, after)))
+                newPrefs++;
+            else
+                printf("  power cut %u: the prefs are neither the old nor the new ones\n", (unsigned int) i);
+
+            // The block can't be appended to now, so the next save writes a snapshot: an erase,
+            // the pages, the CRC and the first page.  Cut that too.
+            before = prefs;
+            prefs.numBakes++;
+            chip.cutPowerAfter(1 + rand() % 12, i);
+        }
+        chip.cutPowerAfter(0, 0);
+
+        // The save that wasn't cut short is read back
+        Controleo3Prefs saved = prefs;
+        reboot(chip);
+        CHECK(samePrefs(prefs, saved));
+    }
+    printf("  %u power cuts (%u while writing a snapshot): %u left the old prefs, %u the new prefs\n", cuts, compactionCuts,
+           oldPrefs, newPrefs);
+    CHECK(cuts > POWER_CUTS / 2);
+    CHECK(compactionCuts > 10);
+}
+
+
+// Prefs from firmware before the profile sources were added are upgraded
+static void testUpgrade(W25Q80 &chip)
+{
+    testStart("Upgrade");
+    flash.factoryReset();
+    reboot(chip);
+
+    // A version 0 snapshot, and a record after it
+    memset(&prefs, 0, sizeof(prefs));
+    prefs.sequenceNumber = 5;
+    prefs.numReflows = 10;
+    prefs.numProfiles = 1;
+    prefs.profile[0].startBlock = 64;
+    strcpy(prefs.profile[0].name, "Old profile");
+    uint16_t snapshotSize = offsetof(Controleo3Prefs, profileSources);
+    memcpy(chip.memory(), &prefs, snapshotSize);
+    struct __attribute__((packed)) {
+        uint16_t offset, length, crc;
+        uint16_t data;
+    } record = {offsetof(Controleo3Prefs, numReflows), 2, 0, 77};
+    record.crc = prefsCRC(prefsCRC(0xFFFF, (uint8_t *) &record, 4), (uint8_t *) &record.data, 2);
+    memcpy(chip.memory() + (snapshotSize + 255) / 256 * 256, &record, sizeof(record));
+
+    reboot(chip);
+    CHECK_EQUAL(prefs.versionNumber, PREFS_VERSION);
+    CHECK_EQUAL(prefs.numReflows, 77);
+    CHECK_EQUAL(prefs.profile[0].startBlock, 64);
+    CHECK(strcmp(prefs.profile[0].name, "Old profile") == 0);
+    bool cleared = true;
+    for (size_t i=0; i < sizeof(prefs.profileSources); i++)
+        cleared &= ((uint8_t *) prefs.profileSources)[i] == 0;
+    CHECK(cleared);
+
+    // The next save writes a version 1 snapshot to the next block
+    chip.resetStatistics();
+    prefs.profileSources[0].pathHash = 0x12345678;
+    save();
+    CHECK_EQUAL(chip.stats.sectorErases, 1);
+    reboot(chip);
+    CHECK_EQUAL(prefs.sequenceNumber, 6);
+    CHECK_EQUAL(prefs.numReflows, 77);
+    CHECK_EQUAL(prefs.profileSources[0].pathHash, 0x12345678);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+int main()
+{
+    unlink(IMAGE_FILE);
+    W25Q80 chip(IMAGE_FILE);
+    NVMModel nvmModel;
+    nvm = &nvmModel;
+    flash.begin();
+
+    testFirstSave(chip);
+    testRecords(chip);
+    testCompaction(chip);
+    testPowerCuts(chip);
+    testUpgrade(chip);
+    CHECK_EQUAL(nvm->stats.unerasedBits, 0);
+    PrintPrefsStats();
+    return testResult("test_prefs");
+}
@@ -0,0 +1,230 @@
+// Importing profiles from the SD card (ReadProfiles.cpp) on the SD card and flash models:
+// the first insert imports every profile, an unchanged card imports nothing and writes
+// nothing to the flash (even after a reboot), edited and new files are imported, a file
+// copied again with a new date isn't, and a profile deleted on the oven comes back.
+#include <string.h>
+#include <unistd.h>
+#include "ReadProfiles.h"
+#include "FlashCache.h"
+#include "NVMPrefs.h"
+#include "Prefs.h"
+#include "NVMModel.h"
+#include "W25Q80.h"
+#include "SDCardModel.h"
+#include "FatImage.h"
+#include "TestProfiles.h"
+#include "HostTest.h"
+
+#define IMAGE_FILE                  "test_profile_import.img"
+#define PROFILES                    20
+
+
+static W25Q80 *chip;
+static NVMModel *nvm;
+static FatImage *fat;
+static SDCardModel *card;
+static Controleo3Prefs before;
+
+
+// Start the firmware again: the cache is empty and the prefs in RAM are lost
+static void reboot()
+{
+    flash.begin();
+    invalidateFlashCache(0, 4096);
+    nvm->attach();
+    memset(&prefs, 0xA5, sizeof(prefs));
+    hostQuiet = true;
+    getPrefs();
+    hostQuiet = false;
+}
+
+
+// Insert the card, and write the prefs as the UI task does afterwards
+static int insertCard()
+{
+    hostQuiet = true;
+    chip->resetStatistics();
+    card->resetStatistics();
+    before = prefs;
+    int imported = importTestProfiles();
+    writePrefsToFlash();
+    hostQuiet = false;
+    return imported;
+}
+
+
+// The flash wasn't touched by the last insert
+static bool flashUnchanged()
+{
+    return chip->stats.sectorErases == 0 && chip->stats.pagesProgrammed == 0 && !memcmp(&prefs, &before, sizeof(prefs));
+}
+
+
+static profiles *findProfile(uint16_t n)
+{
+    char name[MAX_PROFILE_NAME_LENGTH + 1];
+    getTestProfileName(name, n);
+    for (uint8_t i=0; i < prefs.numProfiles; i++)
+        if (!strcmp(prefs.profile[i].name, name))
+            return &prefs.profile[i];
+    return 0;
+}
+
+
+static uint16_t peakTemperature(uint16_t n, uint16_t revision)
+{
+    // The highest "ramp temperature" in makeTestProfile()
+    return 220 + (n * 7 + revision * 3) % 40;
+}
+
+
+static bool hasSource(uint16_t startBlock)
+{
+    for (uint8_t i=0; i < MAX_PROFILES; i++)
+        if (prefs.profileSources[i].startBlock == startBlock)
+            return true;
+    return false;
+}
+
+
+// Profiles 0 to count-1 are there, and each has a manifest entry
+static bool profilesImported(uint16_t count)
+{
+    bool allFound = prefs.numProfiles == count;
+    for (uint16_t n=0; n < count; n++) {
+        profiles *p = findProfile(n);
+        allFound &= p && p->noOfTokens > 20 && hasSource(p->startBlock);
+    }
+    return allFound;
+}
+
+
+static void editProfile(uint16_t n, uint16_t revision, uint16_t date)
+{
+    static char profile[TEST_PROFILE_MAX_SIZE];
+    char path[64];
+    uint32_t size = makeTestProfile(profile, n, revision);
+    getTestProfilePath(path, n);
+    fat->writeFile(path, profile, size, date);
+}
+
+
+static void testFirstInsert()
+{
+    testStart("First insert");
+    CHECK_EQUAL(insertCard(), PROFILES);
+    CHECK(profilesImported(PROFILES));
+    CHECK(chip->stats.sectorErases >= PROFILES);
+    uint8_t sources = 0;
+    for (uint8_t i=0; i < MAX_PROFILES; i++)
+        sources += prefs.profileSources[i].startBlock != 0;
+    CHECK_EQUAL(sources, PROFILES);
+    CHECK_EQUAL(findProfile(3)->peakTemperature, peakTemperature(3, 0));
+}
+
+
+static void testUnchanged()
+{
+    testStart("Unchanged");
+    CHECK_EQUAL(insertCard(), 0);
+    CHECK(flashUnchanged());
+    // Only the directories and the FAT are read, not the profiles
+    CHECK(card->stats.blocksRead < 40);
+
+    // The manifest is kept in the prefs, so it is still there after a reboot
+    reboot();
+    CHECK_EQUAL(insertCard(), 0);
+    CHECK(flashUnchanged());
+    CHECK(profilesImported(PROFILES));
+}
+
+
+static void testEdited()
+{
+    testStart("Edited");
+    editProfile(3, 1, FAT_DATE(2021, 3, 1));
+    editProfile(12, 1, FAT_DATE(2021, 3, 2));
+    CHECK_EQUAL(insertCard(), 2);
+    CHECK(profilesImported(PROFILES));
+    CHECK_EQUAL(findProfile(3)->peakTemperature, peakTemperature(3, 1));
+    CHECK_EQUAL(findProfile(12)->peakTemperature, peakTemperature(12, 1));
+    CHECK_EQUAL(findProfile(4)->peakTemperature, peakTemperature(4, 0));
+    CHECK_EQUAL(insertCard(), 0);
+    CHECK(flashUnchanged());
+}
+
+
+// The same contents with a new date (copied to the card again) only updates the date
+static void testNewDate()
+{
+    char path[64];
+
+    testStart("New date");
+    getTestProfilePath(path, 5);
+    CHECK(fat->touch(path, FAT_DATE(2022, 1, 1), FAT_TIME(9, 30, 0)));
+    getTestProfilePath(path, 6);
+    CHECK(fat->touch(path, FAT_DATE(2022, 1, 1), FAT_TIME(9, 30, 0)));
+    profiles saved = *findProfile(5);
+    CHECK_EQUAL(insertCard(), 0);
+    CHECK_EQUAL(chip->stats.sectorErases, 0);
+    CHECK(!memcmp(findProfile(5), &saved, sizeof(saved)));
+
+    // Only the dates changed in the prefs, so the next insert reads nothing
+    CHECK_EQUAL(insertCard(), 0);
+    CHECK(flashUnchanged());
+}
+
+
+static void testDeletedOnOven()
+{
+    testStart("Deleted on the oven");
+    hostQuiet = true;
+    deleteProfile(findProfile(7) - prefs.profile);
+    writePrefsToFlash();
+    hostQuiet = false;
+    CHECK(!findProfile(7));
+    CHECK_EQUAL(prefs.numProfiles, PROFILES - 1);
+    CHECK_EQUAL(insertCard(), 1);
+    CHECK(profilesImported(PROFILES));
+}
+
+
+static void testNewFile()
+{
+    static char profile[TEST_PROFILE_MAX_SIZE];
+
+    testStart("New file");
+    uint32_t size = makeTestProfile(profile, PROFILES);
+    CHECK(fat->writeFile("/NEW.TXT", profile, size));
+    CHECK_EQUAL(insertCard(), 1);
+    CHECK_EQUAL(prefs.numProfiles, PROFILES + 1);
+    CHECK(findProfile(PROFILES));
+    CHECK_EQUAL(insertCard(), 0);
+    CHECK(flashUnchanged());
+    CHECK_EQUAL(card->violations(), 0);
+    CHECK_EQUAL(chip->violations(), 0);
+}
+
+
+int main()
+{
+    unlink(IMAGE_FILE);
+    W25Q80 flashChip(IMAGE_FILE);
+    NVMModel nvmModel;
+    FatImage image;
+    SDCardModel sdCard(image.data(), image.blocks());
+    chip = &flashChip;
+    nvm = &nvmModel;
+    fat = &image;
+    card = &sdCard;
+    CHECK(addTestProfiles(image, PROFILES, 4, 2));
+    reboot();
+
+    testFirstInsert();
+    testUnchanged();
+    testEdited();
+    testNewDate();
+    testDeletedOnOven();
+    testNewFile();
+    return testResult("test_profile_import");
+}
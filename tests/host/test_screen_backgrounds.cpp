@@ -0,0 +1,318 @@
+// Saved screen backgrounds (ScreenBackgrounds.cpp) on the LCD and flash models: a saved
+// background blits back to the same pixels and touch areas, is found again after a reboot,
+// is drawn instead when that is quicker, isn't used once the key changes or when it is
+// corrupt, and power cuts while one is being saved never leave a partial background that
+// gets used
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "ReflowWizard.h"
+#include "FlashCache.h"
+#include "Render.h"
+#include "Screens.h"
+#include "ScreenBackgrounds.h"
+#include "Touch.h"
+#include "LCDModel.h"
+#include "W25Q80.h"
+#include "TestBitmaps.h"
+#include "HostTest.h"
+
+#define IMAGE_FILE                  "test_screen_backgrounds.img"
+#define POWER_CUTS                  40
+
+// The last page of the bitmap address table.  Its last 4 bytes aren't used by any entry.
+#define ADDRESS_TABLE_LAST_PAGE     527
+
+
+static LCDModel *lcd;
+static uint16_t drawn[LCD_MODEL_HEIGHT][LCD_MODEL_WIDTH];
+static uint16_t drawnTouchAreas[SCREEN_BACKGROUND_TOUCH_AREAS][4];
+static uint8_t drawnTouchAreaCount;
+
+
+// Start the firmware again, and find the saved backgrounds
+static void reboot(W25Q80 &chip)
+{
+    if (chip.isPoweredOff())
+        chip.powerOn();
+    flash.begin();
+    invalidateFlashCache(0, 4096);
+    hostQuiet = true;
+    initScreenBackgrounds();
+    hostQuiet = false;
+}
+
+
+// The static part of the test screens, as Screens.cpp draws them.  On the models the bake
+// edit screen takes longer to draw than to blit, and the statistics screen (mostly white)
+// is quicker to draw.
+static void drawStaticPart(uint8_t screen)
+{
+    switch (screen) {
+        case SCREEN_HOME:
+            renderBitmap(BITMAP_CONTROLEO3_SMALL, 106, 5);
+            drawTouchButton(110, 80, 260, BUTTON_LARGE_FONT, (char *) "Reflow");
+            drawTouchButton(110, 160, 260, BUTTON_LARGE_FONT, (char *) "Bake");
+            drawTouchButtonWithIcon(110, 240, 260, BUTTON_LARGE_FONT, (char *) "Settings", BITMAP_SETTINGS, 252);
+            break;
+        case SCREEN_EDIT_BAKE1:
+            displayHeader((char *) "Bake", true);
+            displayString(20, LINE(0), FONT_9PT_BLACK_ON_WHITE, (char *) "Temperature:");
+            displayString(20, LINE(3), FONT_9PT_BLACK_ON_WHITE, (char *) "Duration:");
+            drawIncreaseDecreaseTapTargets(TWO_SETTINGS);
+            drawNavigationButtons(true, true);
+            break;
+        default:
+            displayHeader((char *) "Statistics", false);
+            displayString(10, LINE(0), FONT_9PT_BLACK_ON_WHITE, (char *) "Number of reflows: ");
+            displayString(10, LINE(1), FONT_9PT_BLACK_ON_WHITE, (char *) "Number of bakes: ");
+            drawNavigationButtons(false, true);
+            break;
+    }
+}
+
+
+// Draw a screen a piece at a time, and remember the pixels and touch areas
+static void drawReference(uint8_t screen)
+{
+    clearTouchTargets();
+    tft.fillScreen(WHITE);
+    drawStaticPart(screen);
+    tft.waitUntilIdle();
+    for (uint16_t y=0; y < LCD_MODEL_HEIGHT; y++)
+        for (uint16_t x=0; x < LCD_MODEL_WIDTH; x++)
+            drawn[y][x] = lcd->pixel(x, y);
+    drawnTouchAreaCount = getNumberOfTouchAreas();
+    for (uint8_t t=0; t < drawnTouchAreaCount; t++)
+        getTouchArea(t, &drawnTouchAreas[t][0], &drawnTouchAreas[t][1], &drawnTouchAreas[t][2], &drawnTouchAreas[t][3]);
+}
+
+
+// Show a screen over a black one, as showScreen() does.  Returns true if the background was blitted
+static bool show(uint8_t screen)
+{
+    bool blitted;
+
+    lcd->fill(BLACK);
+    hostQuiet = true;
+    clearTouchTargets();
+    if (!hasScreenBackground(screen))
+        tft.fillScreen(WHITE);
+    blitted = drawScreenBackground(screen);
+    if (!blitted) {
+        drawStaticPart(screen);
+        saveScreenBackground(screen);
+    }
+    tft.waitUntilIdle();
+    hostQuiet = false;
+    return blitted;
+}
+
+
+// Does the screen look like the reference, with the same touch areas?
+static bool matchesReference()
+{
+    uint16_t area[4];
+
+    for (uint16_t y=0; y < LCD_MODEL_HEIGHT; y++)
+        for (uint16_t x=0; x < LCD_MODEL_WIDTH; x++)
+            if (lcd->pixel(x, y) != drawn[y][x]) {
+                printf("  pixel (%u, %u) is 0x%04X, expected 0x%04X\n", x, y, lcd->pixel(x, y), drawn[y][x]);
+                return false;
+            }
+    if (getNumberOfTouchAreas() != drawnTouchAreaCount)
+        return false;
+    for (uint8_t t=0; t < drawnTouchAreaCount; t++) {
+        getTouchArea(t, &area[0], &area[1], &area[2], &area[3]);
+        if (memcmp(area, drawnTouchAreas[t], sizeof(area)))
+            return false;
+    }
+    return true;
+}
+
+
+static void testSaveAndBlit(W25Q80 &chip)
+{
+    testStart("Save and blit");
+    reboot(chip);
+    CHECK(!hasScreenBackground(SCREEN_EDIT_BAKE1));
+
+    // The first time the screen is drawn and saved
+    drawReference(SCREEN_EDIT_BAKE1);
+    uint64_t start = hostCycleCount();
+    CHECK(!show(SCREEN_EDIT_BAKE1));
+    uint64_t saveCycles = hostCycleCount() - start;
+    CHECK(matchesReference());
+    CHECK(hasScreenBackground(SCREEN_EDIT_BAKE1));
+
+    // Then it is blitted, in one bitmap window
+    lcd->resetStatistics();
+    start = hostCycleCount();
+    CHECK(show(SCREEN_EDIT_BAKE1));
+    uint64_t blitCycles = hostCycleCount() - start;
+    CHECK(matchesReference());
+    CHECK_EQUAL(lcd->stats.commands[ILI9488_MEMORYWRITE], 1);
+    CHECK_EQUAL(lcd->stats.pixelsWritten, LCD_WIDTH * LCD_HEIGHT);
+    CHECK(hasScreenBackground(SCREEN_EDIT_BAKE1));
+
+    // It is blitted from then on because that is quicker than drawing it (with the bitmaps
+    // already cached)
+    drawReference(SCREEN_EDIT_BAKE1);
+    start = hostCycleCount();
+    drawReference(SCREEN_EDIT_BAKE1);
+    uint64_t drawCycles = hostCycleCount() - start;
+    printf("  Bake edit screen: drawn in %.1f ms, saved in %.1f ms, blitted in %.1f ms\n", drawCycles / (HOST_CPU_MHZ * 1000.0),
+           saveCycles / (HOST_CPU_MHZ * 1000.0), blitCycles / (HOST_CPU_MHZ * 1000.0));
+    CHECK(blitCycles < drawCycles);
+
+    // A second screen, and both are found again after a reboot
+    drawReference(SCREEN_HOME);
+    CHECK(!show(SCREEN_HOME));
+    reboot(chip);
+    CHECK(hasScreenBackground(SCREEN_HOME));
+    CHECK(show(SCREEN_HOME));
+    CHECK(matchesReference());
+    drawReference(SCREEN_EDIT_BAKE1);
+    CHECK(show(SCREEN_EDIT_BAKE1));
+    CHECK(matchesReference());
+    CHECK_EQUAL(lcd->violations(), 0);
+    CHECK_EQUAL(chip.violations(), 0);
+}
+
+
+// A screen that is quicker to draw than to blit is blitted once, then drawn again.  It
+// isn't saved again, and after a reboot it is tried once more.
+static void testSlowerBlit(W25Q80 &chip)
+{
+    testStart("Slower blit");
+    drawReference(SCREEN_STATS);
+    CHECK(!show(SCREEN_STATS));
+    CHECK(show(SCREEN_STATS));
+    CHECK(matchesReference());
+    CHECK(!hasScreenBackground(SCREEN_STATS));
+    chip.resetStatistics();
+    CHECK(!show(SCREEN_STATS));
+    CHECK(matchesReference());
+    CHECK_EQUAL(chip.stats.pagesProgrammed, 0);
+    CHECK(hasScreenBackground(SCREEN_EDIT_BAKE1));
+
+    reboot(chip);
+    CHECK(hasScreenBackground(SCREEN_STATS));
+    CHECK(show(SCREEN_STATS));
+    CHECK(!hasScreenBackground(SCREEN_STATS));
+}
+
+
+// The key covers the bitmap address table, so changed bitmaps mean the backgrounds are
+// drawn and saved again
+static void testKeyChange(W25Q80 &chip)
+{
+    testStart("Key change");
+    chip.memory()[ADDRESS_TABLE_LAST_PAGE * W25Q80_PAGE_SIZE + W25Q80_PAGE_SIZE - 1] ^= 1;
+    reboot(chip);
+    CHECK(!hasScreenBackground(SCREEN_HOME));
+    CHECK(!hasScreenBackground(SCREEN_EDIT_BAKE1));
+    drawReference(SCREEN_EDIT_BAKE1);
+    CHECK(!show(SCREEN_EDIT_BAKE1));
+    CHECK(show(SCREEN_EDIT_BAKE1));
+    CHECK(matchesReference());
+    chip.memory()[ADDRESS_TABLE_LAST_PAGE * W25Q80_PAGE_SIZE + W25Q80_PAGE_SIZE - 1] ^= 1;
+    reboot(chip);
+    CHECK(!hasScreenBackground(SCREEN_EDIT_BAKE1));
+}
+
+
+// A background whose pixels don't add up to a screen isn't used, and the screen is cleared
+static void testCorruptBackground(W25Q80 &chip)
+{
+    testStart("Corrupt background");
+    reboot(chip);
+    drawReference(SCREEN_EDIT_BAKE1);
+    show(SCREEN_EDIT_BAKE1);
+    reboot(chip);
+    CHECK(hasScreenBackground(SCREEN_EDIT_BAKE1));
+
+    // The first data page starts with a run.  Make it longer than the screen.
+    uint32_t dataPage = 0;
+    for (uint32_t page=ADDRESS_TABLE_LAST_PAGE + 1; page < 4096 && !dataPage; page++)
+        if (*(uint32_t *) (chip.memory() + page * W25Q80_PAGE_SIZE) == SCREEN_BACKGROUND_MAGIC)
+            dataPage = page + 1;
+    CHECK(dataPage != 0);
+    *(uint16_t *) (chip.memory() + dataPage * W25Q80_PAGE_SIZE) = 0xFFFF;
+    invalidateFlashCache(0, 4096);
+    lcd->fill(BLACK);
+    hostQuiet = true;
+    CHECK(!drawScreenBackground(SCREEN_EDIT_BAKE1));
+    hostQuiet = false;
+    CHECK(!hasScreenBackground(SCREEN_EDIT_BAKE1));
+    tft.waitUntilIdle();
+    bool white = true;
+    for (uint16_t y=0; y < LCD_MODEL_HEIGHT; y++)
+        for (uint16_t x=0; x < LCD_MODEL_WIDTH; x++)
+            white &= lcd->pixel(x, y) == WHITE;
+    CHECK(white);
+}
+
+
+// Cut the power during the erases and programs of a save.  After a reboot the screen
+// either has no background or one that blits back exactly.
+static void testPowerCuts(W25Q80 &chip)
+{
+    unsigned int cuts = 0, saved = 0;
+
+    testStart("Power cuts");
+
+    // The erases and programs of a whole save
+    drawReference(SCREEN_EDIT_BAKE1);
+    chip.memory()[ADDRESS_TABLE_LAST_PAGE * W25Q80_PAGE_SIZE + W25Q80_PAGE_SIZE - 4] = 0;
+    reboot(chip);
+    chip.resetStatistics();
+    show(SCREEN_EDIT_BAKE1);
+    uint32_t operations = chip.stats.pagesProgrammed + chip.stats.sectorErases;
+
+    srand(1);
+    for (uint32_t i=1; i <= POWER_CUTS; i++) {
+        // Start again from an empty background area, with a new key each time.  The last
+        // cut is in the program of the header.
+        chip.memory()[ADDRESS_TABLE_LAST_PAGE * W25Q80_PAGE_SIZE + W25Q80_PAGE_SIZE - 4] = i;
+        reboot(chip);
+        chip.cutPowerAfter(i == POWER_CUTS? operations : 1 + rand() % operations, i);
+        show(SCREEN_EDIT_BAKE1);
+        CHECK(chip.isPoweredOff());
+        cuts++;
+        reboot(chip);
+        if (hasScreenBackground(SCREEN_EDIT_BAKE1)) {
+            saved++;
+            CHECK(show(SCREEN_EDIT_BAKE1));
+            CHECK(matchesReference());
+        }
+
+        // It can be saved afterwards
+        show(SCREEN_EDIT_BAKE1);
+        CHECK(show(SCREEN_EDIT_BAKE1));
+        CHECK(matchesReference());
+    }
+    printf("  %u power cuts in the %u erases and programs of a save, %u left a background\n", cuts, (unsigned int) operations, saved);
+    CHECK_EQUAL(cuts, POWER_CUTS);
+}
+
+
+int main()
+{
+    unlink(IMAGE_FILE);
+    W25Q80 chip(IMAGE_FILE);
+    LCDModel model;
+    lcd = &model;
+    flash.begin();
+    tft.begin();
+    hostQuiet = true;
+    provisionTestBitmaps();
+    hostQuiet = false;
+
+    testSaveAndBlit(chip);
+    testSlowerBlit(chip);
+    testKeyChange(chip);
+    testCorruptBackground(chip);
+    testPowerCuts(chip);
+    return testResult("test_screen_backgrounds");
+}
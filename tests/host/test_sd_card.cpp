@@ -0,0 +1,240 @@
+// Sd2Card and SdFile on the SD card model: the card starts up as SDHC, a block read after
+// the one before it starts a CMD18 that stays open while the blocks come in order, writes
+// in sequence go through one CMD25 (pre-erased with ACMD23 when the count is known), and
+// files read and written through SdFile end up the same as on a FAT image.
+#include <stdlib.h>
+#include <string.h>
+#include "SdFat.h"
+#include "SDCardModel.h"
+#include "FatImage.h"
+#include "HostTest.h"
+
+// Blocks away from the file system, for the raw tests
+#define RAW_BLOCKS                  1024
+
+#define FILE_SIZE                   (200 * 1024)
+
+
+static SDCardModel *card;
+static FatImage *fat;
+static Sd2Card sd;
+static SdVolume volume;
+static uint8_t block[512], readBack[FILE_SIZE];
+
+
+static uint8_t *imageBlock(uint32_t n)
+{
+    return fat->data() + (uint64_t) n * 512;
+}
+
+
+static void fillBlock(uint8_t *data, uint32_t seed)
+{
+    for (int i=0; i < 512; i++)
+        data[i] = (i * 7 + seed * 13) ^ (i >> 3);
+}
+
+
+static uint32_t readCommands()
+{
+    return card->stats.commands[17] + card->stats.commands[18];
+}
+
+
+static void testInit()
+{
+    testStart("Init");
+    CHECK(sd.init());
+    CHECK_EQUAL(sd.type(), SD_CARD_TYPE_SDHC);
+    CHECK_EQUAL(sd.cardSize(), fat->blocks());
+    CHECK_EQUAL(card->stats.commands[0], 1);
+    CHECK_EQUAL(card->stats.appCommands[41], 2);
+    CHECK(volume.init(sd));
+    CHECK_EQUAL(volume.fatType(), 16);
+    CHECK_EQUAL(card->violations(), 0);
+}
+
+
+static void testReads()
+{
+    bool allMatch = true;
+
+    testStart("Reads");
+    // A single block is one CMD17
+    card->resetStatistics();
+    sdStats = {};
+    CHECK(sd.readBlock(RAW_BLOCKS + 100, block));
+    CHECK(!memcmp(block, imageBlock(RAW_BLOCKS + 100), 512));
+    CHECK_EQUAL(card->stats.commands[17], 1);
+
+    // The next one starts a CMD18, and the blocks after it don't need a command
+    for (uint32_t n=RAW_BLOCKS + 101; n < RAW_BLOCKS + 164; n++) {
+        CHECK(sd.readBlock(n, block));
+        allMatch &= !memcmp(block, imageBlock(n), 512);
+    }
+    CHECK(allMatch);
+    CHECK_EQUAL(card->stats.commands[17], 1);
+    CHECK_EQUAL(card->stats.commands[18], 1);
+    CHECK_EQUAL(sdStats.streamedReads, 62);
+
+    // Part of the next block is still in the stream
+    CHECK(sd.readData(RAW_BLOCKS + 164, 100, 50, block));
+    CHECK(!memcmp(block, imageBlock(RAW_BLOCKS + 164) + 100, 50));
+    CHECK_EQUAL(readCommands(), 2);
+
+    // A block out of sequence stops it with CMD12
+    CHECK(sd.readBlock(RAW_BLOCKS + 10, block));
+    CHECK(!memcmp(block, imageBlock(RAW_BLOCKS + 10), 512));
+    CHECK_EQUAL(card->stats.commands[12], 1);
+    CHECK_EQUAL(card->stats.commands[17], 2);
+    CHECK(sd.stopStream());
+    CHECK_EQUAL(card->stats.commands[12], 1);
+    CHECK_EQUAL(card->violations(), 0);
+    card->printStatistics();
+}
+
+
+static void testWrites()
+{
+    bool allMatch = true;
+
+    testStart("Writes");
+    // One block is a CMD24 and a status check
+    card->resetStatistics();
+    fillBlock(block, 1);
+    CHECK(sd.writeBlock(RAW_BLOCKS + 200, block));
+    CHECK(!memcmp(block, imageBlock(RAW_BLOCKS + 200), 512));
+    CHECK_EQUAL(card->stats.commands[24], 1);
+    CHECK_EQUAL(card->stats.commands[13], 1);
+
+    // The next one starts a CMD25 (without a pre-erase, because the count isn't known)
+    for (uint32_t n=RAW_BLOCKS + 201; n < RAW_BLOCKS + 232; n++) {
+        fillBlock(block, n);
+        CHECK(sd.writeBlock(n, block));
+    }
+    CHECK(sd.stopStream());
+    for (uint32_t n=RAW_BLOCKS + 201; n < RAW_BLOCKS + 232; n++) {
+        fillBlock(block, n);
+        allMatch &= !memcmp(block, imageBlock(n), 512);
+    }
+    CHECK(allMatch);
+    CHECK_EQUAL(card->stats.commands[25], 1);
+    CHECK_EQUAL(card->stats.appCommands[23], 0);
+    CHECK_EQUAL(card->stats.blocksWritten, 32);
+
+    // When the caller knows how many blocks follow, they are pre-erased
+    for (uint32_t n=RAW_BLOCKS + 300; n < RAW_BLOCKS + 316; n++) {
+        fillBlock(block, n);
+        CHECK(sd.writeBlock(n, block, RAW_BLOCKS + 316 - n));
+    }
+    CHECK(sd.stopStream());
+    CHECK_EQUAL(card->stats.commands[25], 2);
+    CHECK_EQUAL(card->stats.appCommands[23], 1);
+    CHECK_EQUAL(card->stats.preErasedBlocks, 16);
+    fillBlock(block, RAW_BLOCKS + 315);
+    CHECK(!memcmp(block, imageBlock(RAW_BLOCKS + 315), 512));
+
+    // A read ends a write stream
+    fillBlock(block, 3);
+    CHECK(sd.writeBlock(RAW_BLOCKS + 400, block, 2));
+    CHECK(sd.readBlock(RAW_BLOCKS + 100, block));
+    CHECK(!memcmp(block, imageBlock(RAW_BLOCKS + 100), 512));
+    CHECK_EQUAL(card->violations(), 1);
+    CHECK_EQUAL(card->stats.unwrittenBlocks, 1);
+    card->printStatistics();
+    card->resetStatistics();
+}
+
+
+// A file read a block at a time, the way FileReader reads profiles, and written the same way
+static void testFiles()
+{
+    static uint8_t contents[FILE_SIZE];
+    SdFile root, file;
+    bool allMatch = true;
+
+    testStart("Files");
+    for (uint32_t i=0; i < FILE_SIZE; i++)
+        contents[i] = i * 31 + (i >> 9);
+    CHECK(fat->writeFile("/LOGS/BIG.BIN", contents, FILE_SIZE));
+    CHECK(volume.init(sd));
+    CHECK(root.openRoot(volume));
+
+    // Whole blocks bypass the cache, so the file streams from one CMD18
+    SdFile logs;
+    CHECK(logs.open(root, "LOGS", O_READ));
+    CHECK(file.open(logs, "BIG.BIN", O_READ));
+    card->resetStatistics();
+    sdStats = {};
+    uint32_t offset = 0;
+    int16_t n;
+    while ((n = file.read(readBack + offset, 512)) > 0)
+        offset += n;
+    CHECK_EQUAL(offset, FILE_SIZE);
+    CHECK(!memcmp(readBack, contents, FILE_SIZE));
+    file.close();
+    printf("  Read %u blocks with %u CMD17 and %u CMD18\n", FILE_SIZE / 512, card->stats.commands[17], card->stats.commands[18]);
+    CHECK(readCommands() < FILE_SIZE / 512 / 20);
+    CHECK_EQUAL(card->violations(), 0);
+
+    // Writing a copy in 512-byte pieces streams the data blocks
+    card->resetStatistics();
+    CHECK(file.open(logs, "COPY.BIN", O_READ | O_WRITE | O_CREAT));
+    for (offset=0; offset < FILE_SIZE; offset += 512)
+        allMatch &= file.write(contents + offset, 512) == 512;
+    CHECK(allMatch);
+    CHECK(file.close());
+    printf("  Wrote %u blocks with %u CMD24 and %u CMD25, %u pre-erased\n", FILE_SIZE / 512, card->stats.commands[24],
+           card->stats.commands[25], card->stats.preErasedBlocks);
+    CHECK(card->stats.commands[24] + card->stats.commands[25] < FILE_SIZE / 512 / 20);
+    memset(readBack, 0, FILE_SIZE);
+    CHECK_EQUAL(fat->readFile("/LOGS/COPY.BIN", readBack, FILE_SIZE), FILE_SIZE);
+    CHECK(!memcmp(readBack, contents, FILE_SIZE));
+    CHECK(fat->fatsMatch());
+    CHECK_EQUAL(card->violations(), 0);
+    card->printStatistics();
+
+    // Writing a cluster at a time lets SdFile give the count, so each CMD25 pre-erases the
+    // rest of its cluster (the stream then carries on into the clusters after it)
+    card->resetStatistics();
+    CHECK(file.open(logs, "CLUSTERS.BIN", O_READ | O_WRITE | O_CREAT));
+    allMatch = true;
+    for (offset=0; offset < FILE_SIZE; offset += 2048)
+        allMatch &= file.write(contents + offset, 2048) == 2048;
+    CHECK(allMatch);
+    CHECK(file.close());
+    CHECK(card->stats.commands[25] > 0);
+    CHECK_EQUAL(card->stats.appCommands[23], card->stats.commands[25]);
+    CHECK(card->stats.preErasedBlocks > 0);
+    memset(readBack, 0, FILE_SIZE);
+    CHECK_EQUAL(fat->readFile("/LOGS/CLUSTERS.BIN", readBack, FILE_SIZE), FILE_SIZE);
+    CHECK(!memcmp(readBack, contents, FILE_SIZE));
+    CHECK(fat->fatsMatch());
+    CHECK_EQUAL(card->violations(), 0);
+    card->printStatistics();
+    logs.close();
+    root.close();
+}
+
+
+int main()
+{
+    FatImage image;
+    SDCardModel model(image.data(), image.blocks());
+    fat = &image;
+    card = &model;
+    CHECK(fat->addDirectory("/LOGS"));
+
+    // The raw tests use blocks at the start of the card, before the partition
+    for (uint32_t n=1; n < RAW_BLOCKS; n++)
+        fillBlock(imageBlock(n), n);
+    for (uint32_t n=RAW_BLOCKS; n < 2 * RAW_BLOCKS; n++)
+        fillBlock(imageBlock(n), n * 3);
+    hostQuiet = true;
+
+    testInit();
+    testReads();
+    testWrites();
+    testFiles();
+    return testResult("test_sd_card");
+}
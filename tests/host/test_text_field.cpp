@@ -0,0 +1,201 @@
+// TextField on the LCD model: after every update the field must look exactly like the
+// string drawn from scratch, while only the glyphs that changed are written.  Timers
+// counting down (centred, 22pt), numbers changing length (left and right aligned), a
+// status message whose text stays the same, and erasing, moving and invalidating.
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "ReflowWizard.h"
+#include "Render.h"
+#include "TextField.h"
+#include "Utility.h"
+#include "LCDModel.h"
+#include "W25Q80.h"
+#include "TestBitmaps.h"
+#include "HostTest.h"
+
+#define IMAGE_FILE                  "test_text_field.img"
+
+// The field is drawn at FIELD_Y, and the same string from scratch REFERENCE_OFFSET below.
+// Glyphs go at most MARGIN above y and below y + MARGIN.
+#define FIELD_Y                     60
+#define REFERENCE_OFFSET            140
+#define MARGIN                      60
+
+
+static LCDModel *lcd;
+
+
+// Draw the string from scratch below the field, as displayString() and friends would
+static uint32_t drawReference(uint16_t x, uint8_t font, uint8_t align, const char *str)
+{
+    uint16_t y = FIELD_Y + REFERENCE_OFFSET;
+
+    tft.fillRect(0, y - MARGIN, LCD_WIDTH, MARGIN * 2, WHITE);
+    tft.waitUntilIdle();
+    lcd->resetStatistics();
+    if (align == TEXT_ALIGN_LEFT)
+        displayString(x, y, font, (char *) str);
+    else if (align == TEXT_ALIGN_CENTER)
+        displayCenteredString(x, y, font, (char *) str);
+    else
+        displayRightAlignedString(x, y, font, (char *) str);
+    return lcd->stats.pixelsWritten;
+}
+
+
+// Does the field look like the string drawn from scratch?
+static bool matchesReference()
+{
+    for (uint16_t y=FIELD_Y - MARGIN; y < FIELD_Y + MARGIN; y++)
+        for (uint16_t x=0; x < LCD_WIDTH; x++)
+            if (lcd->pixel(x, y) != lcd->pixel(x, y + REFERENCE_OFFSET)) {
+                printf("  pixel (%u, %u) is 0x%04X, expected 0x%04X\n", x, y, lcd->pixel(x, y), lcd->pixel(x, y + REFERENCE_OFFSET));
+                return false;
+            }
+    return true;
+}
+
+
+// Display a string in the field.  Returns the pixels written.
+static uint32_t update(TextField &field, const char *str)
+{
+    tft.waitUntilIdle();
+    lcd->resetStatistics();
+    field.display(str);
+    return lcd->stats.pixelsWritten;
+}
+
+
+static void testTimer()
+{
+    TextField timer(240, FIELD_Y, FONT_22PT_BLACK_ON_WHITE_FIXED, TEXT_ALIGN_CENTER);
+    uint32_t fieldPixels = 0, redrawPixels = 0;
+    bool allMatch = true;
+    char str[20];
+
+    testStart("Timer");
+    tft.fillScreen(WHITE);
+
+    // Counting down from 10:05 to 9:00, past the change in width.  When only the last
+    // digit changes, only its glyph is written (it hides the old one, so nothing is erased).
+    bool oneGlyph = true;
+    for (uint32_t seconds=605; seconds >= 540; seconds--) {
+        secondsInClockFormat(str, seconds);
+        uint32_t pixels = update(timer, str);
+        redrawPixels += drawReference(240, FONT_22PT_BLACK_ON_WHITE_FIXED, TEXT_ALIGN_CENTER, str);
+        allMatch &= matchesReference();
+        if (seconds % 10 != 9 && seconds != 605) {
+            uint8_t font = FONT_22PT_BLACK_ON_WHITE_FIXED;
+            uint16_t width, height;
+            getBitmapSize(getBitmapNumberForCharacter(&font, str[strlen(str) - 1]), &width, &height);
+            oneGlyph &= pixels == (uint32_t) width * height;
+        }
+        fieldPixels += pixels;
+    }
+    CHECK(allMatch);
+    CHECK(oneGlyph);
+    printf("  %u pixels written, against %u redrawing the whole timer\n", (unsigned int) fieldPixels, (unsigned int) redrawPixels);
+    CHECK(fieldPixels * 2 < redrawPixels);
+
+    // Nothing is written when the string is the same
+    CHECK_EQUAL(update(timer, str), 0);
+    CHECK_EQUAL(lcd->violations(), 0);
+}
+
+
+// Numbers that change length, left and right aligned
+static void testAlignments()
+{
+    const uint8_t aligns[] = {TEXT_ALIGN_LEFT, TEXT_ALIGN_RIGHT};
+    char str[20];
+
+    testStart("Alignments");
+    srand(1);
+    for (uint8_t align : aligns) {
+        uint16_t x = align == TEXT_ALIGN_LEFT? 20 : 460;
+        TextField number(x, FIELD_Y, FONT_9PT_BLACK_ON_WHITE_FIXED, align);
+        bool allMatch = true;
+        tft.fillScreen(WHITE);
+        for (int i=0; i < 200; i++) {
+            snprintf(str, sizeof(str), "%d", rand() % (i % 3? 1000 : 100000));
+            update(number, str);
+            drawReference(x, FONT_9PT_BLACK_ON_WHITE_FIXED, align, str);
+            allMatch &= matchesReference();
+        }
+        CHECK(allMatch);
+    }
+    CHECK_EQUAL(lcd->violations(), 0);
+}
+
+
+// The reflow status message: the text stays the same while a number after it counts down
+static void testStatusMessage()
+{
+    TextField text(20, FIELD_Y, FONT_9PT_BLACK_ON_WHITE, TEXT_ALIGN_LEFT);
+    const char *message = "Ramping oven to 150~C ...";
+
+    testStart("Status message");
+    tft.fillScreen(WHITE);
+    CHECK(update(text, message) > 0);
+    CHECK(text.isShowing(message));
+    CHECK_EQUAL(update(text, message), 0);
+
+    // A different message only redraws from the first glyph that differs
+    const char *next = "Ramping oven to 150~C, 10s";
+    uint32_t full = drawReference(20, FONT_9PT_BLACK_ON_WHITE, TEXT_ALIGN_LEFT, next);
+    uint32_t changed = update(text, next);
+    CHECK(matchesReference());
+    printf("  %u pixels written for the new message, against %u for all of it\n", (unsigned int) changed, (unsigned int) full);
+    CHECK(changed > 0 && changed * 4 < full);
+    CHECK_EQUAL(lcd->violations(), 0);
+}
+
+
+static void testEraseAndMove()
+{
+    TextField field(240, FIELD_Y, FONT_12PT_BLACK_ON_WHITE, TEXT_ALIGN_CENTER);
+
+    testStart("Erase, move and invalidate");
+    tft.fillScreen(WHITE);
+    update(field, "Oven setup");
+    field.erase();
+    drawReference(240, FONT_12PT_BLACK_ON_WHITE, TEXT_ALIGN_CENTER, "");
+    CHECK(matchesReference());
+    CHECK(!field.isShowing("Oven setup"));
+
+    // Moving erases the text, and it is redrawn at the new position
+    update(field, "Learning");
+    field.moveTo(300);
+    update(field, "Learning");
+    drawReference(300, FONT_12PT_BLACK_ON_WHITE, TEXT_ALIGN_CENTER, "Learning");
+    CHECK(matchesReference());
+
+    // After the screen is cleared, everything is drawn again
+    tft.fillScreen(WHITE);
+    field.invalidate();
+    CHECK(update(field, "Learning") > 0);
+    drawReference(300, FONT_12PT_BLACK_ON_WHITE, TEXT_ALIGN_CENTER, "Learning");
+    CHECK(matchesReference());
+    CHECK_EQUAL(lcd->violations(), 0);
+}
+
+
+int main()
+{
+    unlink(IMAGE_FILE);
+    W25Q80 chip(IMAGE_FILE);
+    LCDModel model;
+    lcd = &model;
+    flash.begin();
+    tft.begin();
+    hostQuiet = true;
+    provisionTestBitmaps();
+    hostQuiet = false;
+
+    testTimer();
+    testAlignments();
+    testStatusMessage();
+    testEraseAndMove();
+    return testResult("test_text_field");
+}
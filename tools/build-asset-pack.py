@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+#
+# Build an asset pack (ASSETS.PAK) of bitmaps for the external flash.
+#
+# Copy the pack to the root of the SD card; at boot the controller installs it into
+# external flash if it isn't already installed.  The format is described in
+# OvenACE/RW/AssetPack.h.
+#
+# Installing a pack replaces every bitmap in external flash, so the pack must have all
+# the bitmaps from 0 to BITMAP_LAST_ONE (see ReflowWizard.h); the controller rejects a
+# pack with any missing.  Bitmaps come from, in order (later ones replace earlier ones):
+#   - --base adds every bitmap in an existing pack, so a complete pack only needs the
+#     changed bitmaps on the command line.
+#   - --bitmaps-cpp adds every bmpN array in Bitmaps.cpp as bitmap N (raw or RLE).  These
+#     aren't all the bitmaps: the fonts, for example, are only in external flash.
+#   - Image files are uncompressed 24 or 32-bit BMP files.  The file name must start
+#     with the bitmap number, for example "242-controleo3.bmp".
+#
+# Each bitmap is stored raw or run-length encoded (the encoding used by
+# compress-bitmaps.py), whichever is smaller unless --format says otherwise.
+#
+# Usage: tools/build-asset-pack.py -o ASSETS.PAK [--version N] [--format auto|raw|rle]
+#                                  [--base OLD.PAK] [--bitmaps-cpp path/to/Bitmaps.cpp] [image.bmp ...]
+#        tools/build-asset-pack.py --list ASSETS.PAK
+
+import argparse
+import importlib.util
+import os
+import re
+import struct
+import sys
+import zlib
+
+# The RLE encoder and Bitmaps.cpp parser are shared with compress-bitmaps.py
+_spec = importlib.util.spec_from_file_location(
+    "compress_bitmaps", os.path.join(os.path.dirname(os.path.abspath(__file__)), "compress-bitmaps.py"))
+compress_bitmaps = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(compress_bitmaps)
+
+MAGIC = 0x4B504141              # "AAPK"
+FORMAT_VERSION = 1
+ALIGNMENT = 256
+HEADER = struct.Struct("<IHHIHHIIII")
+ENTRY = struct.Struct("<HHHBBIII")
+FORMAT_RAW = 0
+FORMAT_RLE = 1
+FORMAT_NAMES = {FORMAT_RAW: "raw", FORMAT_RLE: "rle"}
+MAXIMUM_BITMAPS = 672           # Entries in the flash bitmap address table
+REQUIRED_BITMAPS = 258          # BITMAP_LAST_ONE + 1 in ReflowWizard.h
+MAXIMUM_SIZE = 0x3FF            # Width and height are 10 bits in the RAM directory
+FLASH_PAGES = 4096 - 528        # Pages available for bitmaps
+
+
+def crc32(data):
+    return zlib.crc32(data) & 0xFFFFFFFF
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def read_bmp(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:2] != b"BM":
+        sys.exit("%s: not a BMP file" % path)
+    offset, = struct.unpack_from("<I", data, 10)
+    width, height, planes, bpp, compression = struct.unpack_from("<iiHHI", data, 18)
+    if bpp not in (24, 32) or compression not in (0, 3):
+        sys.exit("%s: only uncompressed 24 and 32-bit BMP files are supported" % path)
+    bottom_up = height > 0
+    height = abs(height)
+    stride = (width * (bpp // 8) + 3) & ~3
+    pixels = []
+    for y in range(height):
+        row = offset + (height - 1 - y if bottom_up else y) * stride
+        for x in range(width):
+            b, g, r = data[row + x * (bpp // 8):row + x * (bpp // 8) + 3]
+            pixels.append(rgb565(r, g, b))
+    return width, height, pixels
+
+
+def read_bitmaps_cpp(path):
+    with open(path, newline="") as f:
+        source = f.read().replace("\r\n", "\n")
+    bitmaps = {}
+    for m in compress_bitmaps.BITMAP_RE.finditer(source):
+        number = int(m.group(1))
+        words = compress_bitmaps.parse_words(m.group(2))
+        width, height = words[0] >> 8, words[0] & 0xFF
+        if "(RLE" in m.group(0).split("\n")[0]:
+            pixels = compress_bitmaps.decode(words[1:], width * height)
+        else:
+            pixels = words[1:]
+        bitmaps[number] = (width, height, pixels)
+    return bitmaps
+
+
+def words_to_bytes(words):
+    return struct.pack("<%dH" % len(words), *words)
+
+
+def build(args):
+    bitmaps = {}
+    if args.base:
+        bitmaps.update(read_pack_bitmaps(args.base))
+    if args.bitmaps_cpp:
+        bitmaps.update(read_bitmaps_cpp(args.bitmaps_cpp))
+    for path in args.images:
+        m = re.match(r"(\d+)", os.path.basename(path))
+        if not m:
+            sys.exit("%s: the file name must start with the bitmap number" % path)
+        bitmaps[int(m.group(1))] = read_bmp(path)
+    missing = [n for n in range(REQUIRED_BITMAPS) if n not in bitmaps]
+    if missing:
+        sys.exit("The pack must have bitmaps 0 to %d, but %d are missing (the first is %d).  Use --base to start from a complete pack" %
+                 (REQUIRED_BITMAPS - 1, len(missing), missing[0]))
+
+    entries = []
+    payload = bytearray()
+    pages = 0
+    print("%-8s %9s %7s %7s %7s %8s" % ("Bitmap", "Size", "Raw", "RLE", "Stored", "Format"))
+    for number in sorted(bitmaps):
+        width, height, pixels = bitmaps[number]
+        if number >= MAXIMUM_BITMAPS or width > MAXIMUM_SIZE or height > MAXIMUM_SIZE:
+            sys.exit("Bitmap %d (%dx%d) doesn't fit in the flash directory" % (number, width, height))
+        raw = words_to_bytes(pixels)
+        rle = words_to_bytes(compress_bitmaps.encode(pixels))
+        if args.format == "rle" or (args.format == "auto" and len(rle) < len(raw)):
+            fmt, data = FORMAT_RLE, rle
+        else:
+            fmt, data = FORMAT_RAW, raw
+        print("bmp%-5d %4dx%-4d %7d %7d %7d %8s" % (number, width, height, len(raw), len(rle), len(data), FORMAT_NAMES[fmt]))
+
+        entries.append(ENTRY.pack(number, width, height, fmt, 0, len(payload), len(data), crc32(data)))
+        payload += data
+        payload += b"\xff" * (-len(payload) % ALIGNMENT)
+        pages += (len(raw) + 255) // 256
+
+    if pages > FLASH_PAGES:
+        sys.exit("The bitmaps need %d flash pages, but there are only %d" % (pages, FLASH_PAGES))
+
+    directory = b"".join(entries)
+    payload_offset = HEADER.size + len(directory)
+    payload_offset += -payload_offset % ALIGNMENT
+    header = HEADER.pack(MAGIC, FORMAT_VERSION, HEADER.size, args.version, len(entries), ENTRY.size,
+                         crc32(directory), payload_offset, len(payload), 0)[:-4]
+    header += struct.pack("<I", crc32(header))
+
+    pack = header + directory
+    pack += b"\xff" * (payload_offset - len(pack))
+    pack += payload
+    with open(args.output, "wb") as f:
+        f.write(pack)
+    print("%s: version %d, %d bitmaps, %d bytes (%d flash pages)" % (args.output, args.version, len(entries), len(pack), pages))
+
+
+def read_pack(path):
+    # Returns the header fields and a list of (entry fields, data)
+    with open(path, "rb") as f:
+        pack = f.read()
+    fields = HEADER.unpack_from(pack)
+    magic, fmt_version, header_size, version, count, entry_size, dir_crc, payload_offset, payload_size, header_crc = fields
+    if magic != MAGIC or crc32(pack[:HEADER.size - 4]) != header_crc:
+        sys.exit("%s: bad header" % path)
+    directory = pack[header_size:header_size + count * entry_size]
+    entries = []
+    for i in range(count):
+        entry = ENTRY.unpack_from(directory, i * entry_size)
+        offset, size = entry[5], entry[6]
+        entries.append((entry, pack[payload_offset + offset:payload_offset + offset + size]))
+    return fields, crc32(directory) == dir_crc, entries
+
+
+def read_pack_bitmaps(path):
+    _, directory_ok, entries = read_pack(path)
+    if not directory_ok:
+        sys.exit("%s: bad directory CRC" % path)
+    bitmaps = {}
+    for (number, width, height, fmt, _, _, _, crc), data in entries:
+        if crc32(data) != crc:
+            sys.exit("%s: bitmap %d has a bad CRC" % (path, number))
+        words = list(struct.unpack("<%dH" % (len(data) // 2), data))
+        pixels = compress_bitmaps.decode(words, width * height) if fmt == FORMAT_RLE else words
+        bitmaps[number] = (width, height, pixels)
+    return bitmaps
+
+
+def list_pack(path):
+    fields, directory_ok, entries = read_pack(path)
+    fmt_version, version, count, dir_crc = fields[1], fields[3], fields[4], fields[6]
+    print("%s: format %d, version %d, %d bitmaps, directory CRC %08X %s" %
+          (path, fmt_version, version, count, dir_crc, "ok" if directory_ok else "BAD"))
+    for (number, width, height, fmt, _, offset, size, crc), data in entries:
+        print("bmp%-5d %4dx%-4d %-4s offset %8d size %7d CRC %08X %s" %
+              (number, width, height, FORMAT_NAMES.get(fmt, "?"), offset, size, crc, "ok" if crc32(data) == crc else "BAD"))
+    missing = [n for n in range(REQUIRED_BITMAPS) if n not in [e[0][0] for e in entries]]
+    if missing:
+        print("INCOMPLETE: %d of bitmaps 0 to %d are missing, so the controller won't install this pack" %
+              (len(missing), REQUIRED_BITMAPS - 1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Build an asset pack of bitmaps for the external flash")
+    parser.add_argument("images", nargs="*", help="BMP files named after their bitmap number")
+    parser.add_argument("-o", "--output", default="ASSETS.PAK")
+    parser.add_argument("--version", type=int, default=1, help="version of the artwork")
+    parser.add_argument("--format", choices=("auto", "raw", "rle"), default="auto")
+    parser.add_argument("--base", metavar="PACK", help="start with the bitmaps in an existing pack")
+    parser.add_argument("--bitmaps-cpp", help="add the bitmaps in Bitmaps.cpp")
+    parser.add_argument("--list", metavar="PACK", help="list (and check) an existing pack")
+    args = parser.parse_args()
+    if args.list:
+        list_pack(args.list)
+    else:
+        build(args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+#
+# Regenerate OvenACE/RW/Bitmaps.cpp with run-length encoded bitmaps.
+#
+# Bitmaps in Bitmaps.cpp can be either raw RGB565 or already run-length encoded, so
+# new bitmaps can be added in raw form (as exported) and this script run again.
+# Every bitmap is decoded to raw pixels and then encoded again, so the output does
+# not depend on how the input was encoded.
+#
+# RLE format (16-bit words):
+#   word 0       : width << 8 | height (unchanged from the raw format)
+#   0x8000 | n   : a run of n pixels, followed by the color of the run
+#   n            : n literal pixels follow (n < 0x8000)
+#
+# A size and estimated decode-time report is printed for each bitmap.  The time
+# estimate uses the documented cycle counts of LCD_WRITE_BITMAP and LCD_WRITE_RLE in
+# OvenACE/BitBash.S (used when LCD_ASM is defined in Controleo3LCD.cpp), so it is a
+# guide rather than a measurement.
+#
+# Usage: tools/compress-bitmaps.py [path/to/Bitmaps.cpp]
+
+import argparse
+import os
+import re
+import sys
+
+DEFAULT_PATH = os.path.join(os.path.dirname(__file__), "..", "OvenACE", "RW", "Bitmaps.cpp")
+
+RUN_FLAG = 0x8000
+MAX_COUNT = 0x7FFF
+MIN_RUN = 3                 # Runs shorter than this cost more than literal pixels
+
+# Estimated CPU cycles
+CYCLES_RAW_PIXEL = 11       # LCD_WRITE_BITMAP, per pixel
+CYCLES_LITERAL_PIXEL = 12   # LCD_WRITE_RLE, per literal pixel
+CYCLES_RUN_PIXEL = 8        # LCD_WRITE_RLE, per run pixel (any color)
+CYCLES_LITERAL_TOKEN = 12   # LCD_WRITE_RLE, decoding a literal token
+CYCLES_RUN_TOKEN = 20       # LCD_WRITE_RLE, decoding a run token and loading its color
+CYCLES_PER_CALL = 20        # Calling either routine
+
+BITMAP_RE = re.compile(
+    r"const uint16_t bmp(\d+)\[\d+\]\s*=\s*// Bitmap \d+[^\n]*\n\{\n(.*?)\n\};", re.S)
+TABLE_RE = re.compile(r"const uint16_t \*flashBitmaps\[\d+\].*", re.S)
+
+
+def parse_words(body):
+    # Drop the comments, then pick up every hex number
+    body = re.sub(r"//[^\n]*", "", body)
+    return [int(w, 16) for w in re.findall(r"0x[0-9a-fA-F]+", body)]
+
+
+def decode(words, pixels):
+    out = []
+    i = 0
+    while len(out) < pixels:
+        token = words[i]
+        count = token & MAX_COUNT
+        if token & RUN_FLAG:
+            out.extend([words[i + 1]] * count)
+            i += 2
+        else:
+            out.extend(words[i + 1:i + 1 + count])
+            i += 1 + count
+    return out
+
+
+def encode(pixels):
+    out = []
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:MAX_COUNT]
+            del literals[:MAX_COUNT]
+            out.append(len(chunk))
+            out.extend(chunk)
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and pixels[i + run] == pixels[i] and run < MAX_COUNT:
+            run += 1
+        if run >= MIN_RUN:
+            flush_literals()
+            out.extend([RUN_FLAG | run, pixels[i]])
+        else:
+            literals.extend(pixels[i:i + run])
+        i += run
+    flush_literals()
+    return out
+
+
+def tokens(encoded):
+    i = 0
+    count = 0
+    while i < len(encoded):
+        count += 1
+        i += 2 if encoded[i] & RUN_FLAG else 1 + encoded[i]
+    return count
+
+
+def estimate_cycles(encoded):
+    cycles = CYCLES_PER_CALL
+    i = 0
+    while i < len(encoded):
+        count = encoded[i] & MAX_COUNT
+        if encoded[i] & RUN_FLAG:
+            cycles += CYCLES_RUN_TOKEN + count * CYCLES_RUN_PIXEL
+            i += 2
+        else:
+            cycles += CYCLES_LITERAL_TOKEN + count * CYCLES_LITERAL_PIXEL
+            i += 1 + count
+    return cycles
+
+
+def format_bitmap(number, size_word, encoded, raw_words):
+    lines = ["const uint16_t bmp%d[%d]   = // Bitmap %d (RLE, %d words raw)" %
+             (number, len(encoded) + 1, number, raw_words),
+             "{",
+             "    0x%04x, // Width and height" % size_word]
+    data = ["0x%04x" % w for w in encoded]
+    rows = [",".join(data[i:i + 16]) for i in range(0, len(data), 16)]
+    lines.append(",\n".join("    " + r for r in rows))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run-length encode the bitmaps in Bitmaps.cpp")
+    parser.add_argument("path", nargs="?", default=DEFAULT_PATH, help="Bitmaps.cpp to rewrite (default: OvenACE/RW/Bitmaps.cpp)")
+    args = parser.parse_args()
+    path = args.path
+    with open(path, newline="") as f:
+        source = f.read()
+    crlf = "\r\n" in source
+    source = source.replace("\r\n", "\n")
+
+    header = source[:BITMAP_RE.search(source).start()]
+    table = TABLE_RE.search(source).group(0)
+
+    bitmaps = []
+    total_raw = total_rle = total_raw_cycles = total_rle_cycles = 0
+    print("%-8s %7s %7s %7s %6s %9s %9s %7s" %
+          ("Bitmap", "Size", "Raw", "RLE", "Tokens", "RawCyc", "RLECyc", "Saved"))
+    for m in BITMAP_RE.finditer(source):
+        number = int(m.group(1))
+        words = parse_words(m.group(2))
+        size_word = words[0]
+        width, height = size_word >> 8, size_word & 0xFF
+        pixels = width * height
+        if "(RLE" in m.group(0).split("\n")[0]:
+            raw = decode(words[1:], pixels)
+        else:
+            raw = words[1:]
+        if len(raw) != pixels:
+            sys.exit("bmp%d: expected %d pixels, found %d" % (number, pixels, len(raw)))
+        encoded = encode(raw)
+        if decode(encoded, pixels) != raw:
+            sys.exit("bmp%d: encoding check failed" % number)
+
+        raw_cycles = CYCLES_PER_CALL + pixels * CYCLES_RAW_PIXEL
+        rle_cycles = estimate_cycles(encoded)
+        total_raw += (pixels + 1) * 2
+        total_rle += (len(encoded) + 1) * 2
+        total_raw_cycles += raw_cycles
+        total_rle_cycles += rle_cycles
+        print("bmp%-5d %3dx%-3d %7d %7d %6d %9d %9d %6.1f%%" %
+              (number, width, height, (pixels + 1) * 2, (len(encoded) + 1) * 2, tokens(encoded),
+               raw_cycles, rle_cycles, 100.0 * (raw_cycles - rle_cycles) / raw_cycles))
+        bitmaps.append(format_bitmap(number, size_word, encoded, pixels + 1))
+
+    print("Total bytes: raw %d, RLE %d (%.1f%% smaller)" %
+          (total_raw, total_rle, 100.0 * (total_raw - total_rle) / total_raw))
+    print("Total estimated cycles: raw %d, RLE %d (%+.1f%% time)" %
+          (total_raw_cycles, total_rle_cycles,
+           100.0 * (total_rle_cycles - total_raw_cycles) / total_raw_cycles))
+
+    output = header + "\n\n".join(bitmaps) + "\n\n" + table
+    if crlf:
+        output = output.replace("\n", "\r\n")
+    with open(path, "w", newline="") as f:
+        f.write(output)
+
+
+if __name__ == "__main__":
+    main()